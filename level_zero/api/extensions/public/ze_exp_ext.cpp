@@ -7,7 +7,12 @@
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue.h"
+#include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/kernel/kernel.h"
+#include "level_zero/core/source/module/module.h"
+#include "level_zero/tools/source/metrics/metric.h"
 
 #if defined(__cplusplus)
 extern "C" {
@@ -22,6 +27,139 @@ zeKernelSetGlobalOffsetExp(
     return L0::Kernel::fromHandle(hKernel)->setGlobalOffsetExp(offsetX, offsetY, offsetZ);
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeKernelSetArgumentValuesExp(
+    ze_kernel_handle_t hKernel,
+    uint32_t numArgs,
+    const size_t *pArgSizes,
+    const void *const *ppArgValues) {
+    return L0::Kernel::fromHandle(hKernel)->setArgumentValues(numArgs, pArgSizes, ppArgValues);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeEventHostSynchronizeMultipleExp(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    uint64_t timeout,
+    ze_bool_t waitAll,
+    uint32_t *pSignaledIndex) {
+    return L0::Event::hostSynchronizeMultiple(numEvents, phEvents, timeout, !!waitAll, pSignaledIndex);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListGetLastKernelLaunchIdExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t *pLaunchId) {
+    return L0::CommandList::fromHandle(hCommandList)->getLastKernelLaunchId(pLaunchId);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchArgumentExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue) {
+    return L0::CommandList::fromHandle(hCommandList)->updateKernelLaunchArgument(launchId, argIndex, argSize, pArgValue);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchGroupCountExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    const ze_group_count_t *pLaunchFuncArgs) {
+    return L0::CommandList::fromHandle(hCommandList)->updateKernelLaunchGroupCount(launchId, pLaunchFuncArgs);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchSignalEventExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    ze_event_handle_t hSignalEvent) {
+    return L0::CommandList::fromHandle(hCommandList)->updateKernelLaunchSignalEvent(launchId, hSignalEvent);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchWaitEventsExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    return L0::CommandList::fromHandle(hCommandList)->updateKernelLaunchWaitEvents(launchId, numWaitEvents, phWaitEvents);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListCloneExp(
+    ze_command_list_handle_t hCommandList,
+    ze_command_list_handle_t *phClonedCommandList) {
+    L0::CommandList *clonedCommandList = nullptr;
+    auto ret = L0::CommandList::fromHandle(hCommandList)->clone(clonedCommandList);
+    if (ret == ZE_RESULT_SUCCESS) {
+        *phClonedCommandList = clonedCommandList->toHandle();
+    }
+    return ret;
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandQueueExportSyncFileExp(
+    ze_command_queue_handle_t hCommandQueue,
+    int *pSyncFileFd) {
+    return L0::CommandQueue::fromHandle(hCommandQueue)->exportSyncFile(pSyncFileFd);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandQueueImportSyncFileExp(
+    ze_command_queue_handle_t hCommandQueue,
+    int syncFileFd) {
+    return L0::CommandQueue::fromHandle(hCommandQueue)->importSyncFile(syncFileFd);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandQueueGetPriorityHonoredExp(
+    ze_command_queue_handle_t hCommandQueue,
+    ze_bool_t *pHonored) {
+    return L0::CommandQueue::fromHandle(hCommandQueue)->getPriorityHonored(pHonored);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeModuleGetBuildStatusExp(
+    ze_module_handle_t hModule) {
+    return L0::Module::fromHandle(hModule)->getBuildStatus();
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricStreamerGetReportRingExp(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    zet_metric_streamer_report_ring_exp_t *pRing) {
+    return L0::MetricStreamer::fromHandle(hMetricStreamer)->getReportRing(pRing);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricStreamerAcquireReportsExp(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint64_t *pHead,
+    uint64_t *pTail,
+    uint64_t *pOverflowReportCount) {
+    return L0::MetricStreamer::fromHandle(hMetricStreamer)->acquireReports(pHead, pTail, pOverflowReportCount);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricStreamerReleaseReportsExp(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint64_t head) {
+    return L0::MetricStreamer::fromHandle(hMetricStreamer)->releaseReports(head);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricQueryPoolGetDataExp(
+    zet_metric_query_pool_handle_t hMetricQueryPool,
+    uint32_t count,
+    zet_metric_query_handle_t *phMetricQueries,
+    size_t *pRawDataSize,
+    uint8_t *pRawData) {
+    return L0::MetricQueryPool::fromHandle(hMetricQueryPool)->getData(count, phMetricQueries, pRawDataSize, pRawData);
+}
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -8,3 +8,216 @@
 #pragma once
 
 #include <level_zero/ze_api.h>
+#include <level_zero/zet_api.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Chained to ze_device_mem_alloc_desc_t, places allocation in L3 region reserved on first use,
+// so latency critical data is not evicted by streaming traffic of allocations in default region
+#define ZE_STRUCTURE_TYPE_CACHE_REGION_EXP_DESC ((ze_structure_type_t)0x0002f000)
+
+typedef enum _ze_cache_region_exp_t {
+    ZE_CACHE_REGION_EXP_DEFAULT = 0,
+    ZE_CACHE_REGION_EXP_RESERVED = 1,
+    ZE_CACHE_REGION_EXP_FORCE_UINT32 = 0x7fffffff
+} ze_cache_region_exp_t;
+
+typedef struct _ze_cache_region_exp_desc_t {
+    ze_structure_type_t stype;
+    const void *pNext;
+    ze_cache_region_exp_t region;
+} ze_cache_region_exp_desc_t;
+
+// Chained to ze_event_pool_desc_t, events of pool are pairs of command queue counter and its value assigned when
+// command list signaling event is submitted, so they are never reset and one semaphore waits for whole signaling submission.
+// Waiting on event which was not submitted yet completes immediately, host signal is not supported
+// and pool can not be combined with ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP.
+#define ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC ((ze_structure_type_t)0x0002f001)
+
+typedef struct _ze_event_pool_counter_based_exp_desc_t {
+    ze_structure_type_t stype;
+    const void *pNext;
+} ze_event_pool_counter_based_exp_desc_t;
+
+// Chained to ze_device_mem_alloc_desc_t, allocation reads as zeros. Zeroing is deferred until first submission
+// referencing allocation and skipped when whole allocation is overwritten by copy appended before any other use of it.
+#define ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_ZERO_INIT_EXP_DESC ((ze_structure_type_t)0x0002f002)
+
+typedef struct _ze_device_mem_alloc_zero_init_exp_desc_t {
+    ze_structure_type_t stype;
+    const void *pNext;
+} ze_device_mem_alloc_zero_init_exp_desc_t;
+
+// Chained to ze_memory_allocation_properties_t queried for device allocation, returns dma-buf fd of whole allocation
+// and offset of queried pointer within it, e.g. for registering memory with RDMA capable devices.
+// Fd is exported once per allocation, owned by driver and closed when allocation is freed.
+#define ZE_STRUCTURE_TYPE_MEMORY_DMA_BUF_EXPORT_EXP_PROPERTIES ((ze_structure_type_t)0x0002f003)
+
+typedef struct _ze_memory_dma_buf_export_exp_properties_t {
+    ze_structure_type_t stype;
+    void *pNext;
+    int fd;
+    size_t offset;
+} ze_memory_dma_buf_export_exp_properties_t;
+
+// Chained to ze_command_queue_desc_t passed to zeCommandListCreateImmediate, command list accepts appends from multiple threads.
+// Appends of each thread are encoded into command buffers and heaps of that thread and submitted to the same engine,
+// so appends are executed in order they were submitted.
+#define ZE_STRUCTURE_TYPE_COMMAND_LIST_CONCURRENT_APPENDS_EXP_DESC ((ze_structure_type_t)0x0002f004)
+
+typedef struct _ze_command_list_concurrent_appends_exp_desc_t {
+    ze_structure_type_t stype;
+    const void *pNext;
+} ze_command_list_concurrent_appends_exp_desc_t;
+
+// Chained to ze_command_queue_desc_t, trades latency of synchronization for CPU time and power.
+// High throttle polls for completion (default), medium sleeps in KMD after adaptive busy wait
+// and low waits in power saving mode.
+#define ZE_STRUCTURE_TYPE_COMMAND_QUEUE_THROTTLE_EXP_DESC ((ze_structure_type_t)0x0002f005)
+
+typedef enum _ze_command_queue_throttle_exp_t {
+    ZE_COMMAND_QUEUE_THROTTLE_EXP_LOW = 0,
+    ZE_COMMAND_QUEUE_THROTTLE_EXP_MEDIUM = 1,
+    ZE_COMMAND_QUEUE_THROTTLE_EXP_HIGH = 2,
+    ZE_COMMAND_QUEUE_THROTTLE_EXP_FORCE_UINT32 = 0x7fffffff
+} ze_command_queue_throttle_exp_t;
+
+typedef struct _ze_command_queue_throttle_exp_desc_t {
+    ze_structure_type_t stype;
+    const void *pNext;
+    ze_command_queue_throttle_exp_t throttle;
+} ze_command_queue_throttle_exp_desc_t;
+
+// Waits until all (waitAll is true) or any of the events is signaled, pSignaledIndex receives index of signaled event for wait-any
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeEventHostSynchronizeMultipleExp(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    uint64_t timeout,
+    ze_bool_t waitAll,
+    uint32_t *pSignaledIndex);
+
+// Sets arguments [0, numArgs) of kernel in one call, stops at first argument which could not be set
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeKernelSetArgumentValuesExp(
+    ze_kernel_handle_t hKernel,
+    uint32_t numArgs,
+    const size_t *pArgSizes,
+    const void *const *ppArgValues);
+
+// Kernel launches appended to regular command list with zeCommandListAppendLaunchKernel or
+// zeCommandListAppendLaunchCooperativeKernel can be updated in place after command list is closed,
+// launch ids are valid until command list is reset. Command list must not be executing while it is updated.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListGetLastKernelLaunchIdExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t *pLaunchId);
+
+// Sets kernel argument and patches it in recorded launch, local memory, image and sampler arguments are not supported
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchArgumentExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchGroupCountExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    const ze_group_count_t *pLaunchFuncArgs);
+
+// Events have to be programmed with the same commands size as events of recorded launch
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchSignalEventExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    ze_event_handle_t hSignalEvent);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateKernelLaunchWaitEventsExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t launchId,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents);
+
+// Creates closed copy of closed regular command list without encoding its commands again,
+// launches recorded in template keep their ids in clone and can be updated independently.
+// Returns ZE_RESULT_ERROR_UNSUPPORTED_FEATURE for command lists referring to memory they own,
+// e.g. with indirect launches, copies from host pointers or command buffers chained during recording.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListCloneExp(
+    ze_command_list_handle_t hCommandList,
+    ze_command_list_handle_t *phClonedCommandList);
+
+// Exports sync_file fd signaled when all work submitted to command queue so far completes, caller owns returned fd.
+// Returns ZE_RESULT_ERROR_UNSUPPORTED_FEATURE when command queue is not backed by kernel fences, e.g. with direct submission.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandQueueExportSyncFileExp(
+    ze_command_queue_handle_t hCommandQueue,
+    int *pSyncFileFd);
+
+// Next zeCommandQueueExecuteCommandLists on command queue waits on GPU for sync_file fd to signal, fd stays owned by caller
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandQueueImportSyncFileExp(
+    ze_command_queue_handle_t hCommandQueue,
+    int syncFileFd);
+
+// pHonored receives false when KMD did not apply scheduling priority requested in ze_command_queue_desc_t,
+// e.g. high priority without CAP_SYS_NICE, command queue then runs with normal priority
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandQueueGetPriorityHonoredExp(
+    ze_command_queue_handle_t hCommandQueue,
+    ze_bool_t *pHonored);
+
+// Returns ZE_RESULT_NOT_READY while module created with asynchronous build is still building,
+// ZE_RESULT_ERROR_MODULE_BUILD_FAILURE if build failed and ZE_RESULT_SUCCESS otherwise
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeModuleGetBuildStatusExp(
+    ze_module_handle_t hModule);
+
+// Read-only ring of raw reports owned by metric streamer, valid until streamer is closed.
+// Reports are stored at byte positions modulo ringSize, positions returned by zetMetricStreamerAcquireReportsExp
+// grow monotonically and are always multiples of reportSize.
+typedef struct _zet_metric_streamer_report_ring_exp_t {
+    const uint8_t *pData;
+    size_t ringSize;
+    size_t reportSize;
+} zet_metric_streamer_report_ring_exp_t;
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricStreamerGetReportRingExp(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    zet_metric_streamer_report_ring_exp_t *pRing);
+
+// Moves reports collected by hardware into the ring and returns range [*pHead, *pTail) of unconsumed reports.
+// pOverflowReportCount receives total number of reports dropped because ring was full.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricStreamerAcquireReportsExp(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint64_t *pHead,
+    uint64_t *pTail,
+    uint64_t *pOverflowReportCount);
+
+// Marks reports before head as consumed, released space is reused by subsequent acquire
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricStreamerReleaseReportsExp(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint64_t head);
+
+// Resolves metric queries from one pool with as few metrics library calls as possible.
+// Reports are written contiguously in order of phMetricQueries, *pRawDataSize equal to 0 returns required size.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zetMetricQueryPoolGetDataExp(
+    zet_metric_query_pool_handle_t hMetricQueryPool,
+    uint32_t count,
+    zet_metric_query_handle_t *phMetricQueries,
+    size_t *pRawDataSize,
+    uint8_t *pRawData);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
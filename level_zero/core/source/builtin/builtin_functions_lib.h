@@ -27,6 +27,7 @@ enum class Builtin : uint32_t {
     FillBufferImmediate,
     FillBufferSSHOffset,
     FillBufferMiddle,
+    FillBufferMiddleWide,
     FillBufferRightLeftover,
     QueryKernelTimestamps,
     QueryKernelTimestampsWithOffsets,
@@ -60,6 +61,7 @@ struct BuiltinFunctionsLib {
     virtual void initBuiltinImageKernel(ImageBuiltin func) = 0;
     virtual Kernel *getPageFaultFunction() = 0;
     virtual void initPageFaultFunction() = 0;
+    virtual void initBuiltinsAsync() = 0;
     MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
 
   protected:
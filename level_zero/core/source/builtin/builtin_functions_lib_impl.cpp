@@ -8,6 +8,8 @@
 #include "level_zero/core/source/builtin/builtin_functions_lib_impl.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/utilities/worker_pool.h"
 
 namespace L0 {
 
@@ -54,6 +56,10 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
         builtinName = "FillBufferMiddle";
         builtin = NEO::EBuiltInOps::FillBuffer;
         break;
+    case Builtin::FillBufferMiddleWide:
+        builtinName = "FillBufferMiddleWide";
+        builtin = NEO::EBuiltInOps::FillBuffer;
+        break;
     case Builtin::FillBufferRightLeftover:
         builtinName = "FillBufferRightLeftover";
         builtin = NEO::EBuiltInOps::FillBuffer;
@@ -162,14 +168,48 @@ Kernel *BuiltinFunctionsLibImpl::getPageFaultFunction() {
     return pageFaultBuiltin->func.get();
 }
 
-std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) {
+void BuiltinFunctionsLibImpl::initBuiltinsAsync() {
+    {
+        std::lock_guard<std::mutex> lock(asyncInitMutex);
+        asyncInitPending = true;
+    }
+    // modules are created on worker thread, so first copy or fill does not pay builtins build
+    device->getNEODevice()->getExecutionEnvironment()->getDriverWorkerPool()->enqueue(NEO::WorkerPoolClient::Build, [this]() {
+        {
+            auto lock = obtainUniqueOwnership();
+            for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+                getFunction(static_cast<Builtin>(builtId));
+            }
+            if (device->getHwInfo().capabilityTable.supportsImages) {
+                for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::COUNT); builtId++) {
+                    getImageFunction(static_cast<ImageBuiltin>(builtId));
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(asyncInitMutex);
+        asyncInitPending = false;
+        asyncInitCompleted.notify_all();
+    });
+}
+
+void BuiltinFunctionsLibImpl::waitForAsyncInit() {
+    std::unique_lock<std::mutex> lock(asyncInitMutex);
+    asyncInitCompleted.wait(lock, [this]() { return !asyncInitPending; });
+}
+
+Module *BuiltinFunctionsLibImpl::getBuiltinModule(NEO::EBuiltInOps::Type builtin) {
     using BuiltInCodeType = NEO::BuiltinCode::ECodeType;
 
+    auto &module = builtinModules[builtin];
+    if (module) {
+        return module.get();
+    }
+
     auto builtInCodeType = NEO::DebugManager.flags.RebuildPrecompiledKernels.get() ? BuiltInCodeType::Intermediate : BuiltInCodeType::Binary;
     auto builtInCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtInCodeType, *device->getNEODevice());
 
     ze_result_t res;
-    std::unique_ptr<Module> module;
     ze_module_handle_t moduleHandle;
     ze_module_desc_t moduleDesc = {};
     moduleDesc.format = builtInCode.type == BuiltInCodeType::Binary ? ZE_MODULE_FORMAT_NATIVE : ZE_MODULE_FORMAT_IL_SPIRV;
@@ -179,16 +219,21 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
     UNRECOVERABLE_IF(res != ZE_RESULT_SUCCESS);
 
     module.reset(Module::fromHandle(moduleHandle));
+    return module.get();
+}
+
+std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) {
+    auto module = getBuiltinModule(builtin);
 
     std::unique_ptr<Kernel> kernel;
     ze_kernel_handle_t kernelHandle;
     ze_kernel_desc_t kernelDesc = {};
     kernelDesc.pKernelName = builtInName;
-    res = module->createKernel(&kernelDesc, &kernelHandle);
+    auto res = module->createKernel(&kernelDesc, &kernelHandle);
     DEBUG_BREAK_IF(res != ZE_RESULT_SUCCESS);
     UNUSED_VARIABLE(res);
     kernel.reset(Kernel::fromHandle(kernelHandle));
-    return std::unique_ptr<BuiltinData>(new BuiltinData{std::move(module), std::move(kernel)});
+    return std::unique_ptr<BuiltinData>(new BuiltinData{nullptr, std::move(kernel)});
 }
 
 } // namespace L0
@@ -11,6 +11,10 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/module/module.h"
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+
 namespace NEO {
 namespace EBuiltInOps {
 using Type = uint32_t;
@@ -25,6 +29,7 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
         : device(device), builtInsLib(builtInsLib) {
     }
     ~BuiltinFunctionsLibImpl() override {
+        waitForAsyncInit();
         builtins->reset();
         pageFaultBuiltin.reset();
         imageBuiltins->reset();
@@ -36,15 +41,25 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     void initBuiltinKernel(Builtin builtId) override;
     void initBuiltinImageKernel(ImageBuiltin func) override;
     void initPageFaultFunction() override;
+    void initBuiltinsAsync() override;
     MOCKABLE_VIRTUAL std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName);
+    void waitForAsyncInit();
 
   protected:
+    Module *getBuiltinModule(NEO::EBuiltInOps::Type builtin);
+
+    // kernels of one builtin source (e.g. all fill buffer variants) are created from single module
+    std::map<NEO::EBuiltInOps::Type, std::unique_ptr<Module>> builtinModules;
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::COUNT)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::COUNT)];
     std::unique_ptr<BuiltinData> pageFaultBuiltin;
 
     Device *device;
     NEO::BuiltIns *builtInsLib;
+
+    std::mutex asyncInitMutex;
+    std::condition_variable asyncInitCompleted;
+    bool asyncInitPending = false;
 };
 struct BuiltinFunctionsLibImpl::BuiltinData {
     MOCKABLE_VIRTUAL ~BuiltinData() {
@@ -14,6 +14,10 @@
 namespace L0 {
 
 CommandList::~CommandList() {
+    for (auto &threadCommandList : threadCommandLists) {
+        threadCommandList.second->destroy();
+    }
+    threadCommandLists.clear();
     if (cmdQImmediate) {
         cmdQImmediate->destroy();
     }
@@ -105,6 +109,32 @@ void CommandList::eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocati
     }
 }
 
+void CommandList::initializePendingZeroAllocations() {
+    auto neoDevice = device->getNEODevice();
+    const auto &hwInfo = neoDevice->getHardwareInfo();
+    auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+    std::unique_ptr<uint8_t[]> zeros;
+    size_t zerosSize = 0u;
+
+    for (auto allocation : commandContainer.getResidencyContainer()) {
+        if (allocation == nullptr || !allocation->isZeroInitPending()) {
+            continue;
+        }
+        auto allocationSize = allocation->getUnderlyingBufferSize();
+        auto chunkSize = std::min(allocationSize, MemoryConstants::pageSize2Mb);
+        if (zerosSize < chunkSize) {
+            zeros = std::make_unique<uint8_t[]>(chunkSize);
+            zerosSize = chunkSize;
+        }
+        auto useBlitter = hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation);
+        for (size_t offset = 0u; offset < allocationSize; offset += chunkSize) {
+            NEO::MemoryTransferHelper::transferMemoryToAllocation(useBlitter, *neoDevice, allocation, offset,
+                                                                  zeros.get(), std::min(chunkSize, allocationSize - offset));
+        }
+        allocation->setZeroInitPending(false);
+    }
+}
+
 bool CommandList::isCopyOnly() const {
     const auto &hardwareInfo = device->getNEODevice()->getHardwareInfo();
     auto &hwHelper = NEO::HwHelper::get(hardwareInfo.platform.eRenderCoreFamily);
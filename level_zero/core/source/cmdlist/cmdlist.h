@@ -16,6 +16,9 @@
 #include <level_zero/ze_api.h>
 #include <level_zero/zet_api.h>
 
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 struct _ze_command_list_handle_t {};
@@ -82,7 +85,7 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendMemoryCopy(void *dstptr, const void *srcptr, size_t size,
                                          ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                          ze_event_handle_t *phWaitEvents) = 0;
-    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) = 0;
+    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) = 0;
     virtual ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                                const ze_copy_region_t *dstRegion,
                                                uint32_t dstPitch,
@@ -130,12 +133,21 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendMINoop() = 0;
     virtual ze_result_t appendPipeControl(void *dstPtr, uint64_t value) = 0;
 
+    // in place updates of kernel launches recorded in regular command list, see zeCommandListUpdateKernelLaunch*Exp
+    virtual ze_result_t getLastKernelLaunchId(uint64_t *pLaunchId) = 0;
+    virtual ze_result_t updateKernelLaunchArgument(uint64_t launchId, uint32_t argIndex, size_t argSize, const void *pArgValue) = 0;
+    virtual ze_result_t updateKernelLaunchGroupCount(uint64_t launchId, const ze_group_count_t *pThreadGroupDimensions) = 0;
+    virtual ze_result_t updateKernelLaunchSignalEvent(uint64_t launchId, ze_event_handle_t hSignalEvent) = 0;
+    virtual ze_result_t updateKernelLaunchWaitEvents(uint64_t launchId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) = 0;
+    virtual ze_result_t clone(CommandList *&clonedCommandList) = 0;
+
     static CommandList *create(uint32_t productFamily, Device *device, NEO::EngineGroupType engineGroupType,
                                ze_result_t &resultValue);
     static CommandList *createImmediate(uint32_t productFamily, Device *device,
                                         const ze_command_queue_desc_t *desc,
                                         bool internalUsage, NEO::EngineGroupType engineGroupType,
                                         ze_result_t &resultValue);
+    static bool isConcurrentAppendsDesc(const ze_command_queue_desc_t *desc);
 
     static CommandList *fromHandle(ze_command_list_handle_t handle) {
         return static_cast<CommandList *>(handle);
@@ -163,17 +175,35 @@ struct CommandList : _ze_command_list_handle_t {
         return indirectAllocationsAllowed;
     }
 
+    bool isInternalAllocationsResidencyCached(uint64_t allocationsVersion, uint32_t requestedTypesMask) const {
+        return executionCache.internalAllocationsResident &&
+               executionCache.internalAllocationsVersion == allocationsVersion &&
+               executionCache.internalAllocationsMask == requestedTypesMask;
+    }
+
+    void cacheInternalAllocationsResidency(uint64_t allocationsVersion, uint32_t requestedTypesMask) {
+        executionCache.internalAllocationsVersion = allocationsVersion;
+        executionCache.internalAllocationsMask = requestedTypesMask;
+        executionCache.internalAllocationsResident = true;
+    }
+
     NEO::PreemptionMode obtainFunctionPreemptionMode(Kernel *kernel);
 
     std::vector<Kernel *> &getPrintfFunctionContainer() {
         return this->printfFunctionContainer;
     }
 
+    std::vector<Event *> &getCounterBasedSignalEvents() {
+        return this->counterBasedSignalEvents;
+    }
+
     void storePrintfFunction(Kernel *kernel);
     void removeDeallocationContainerData();
     void removeHostPtrAllocations();
     void eraseDeallocationContainerEntry(NEO::GraphicsAllocation *allocation);
     void eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocation);
+    // zeroes allocations created with zero init request before first submission referencing them
+    void initializePendingZeroAllocations();
     bool isCopyOnly() const;
     bool isInternal() const {
         return internalUsage;
@@ -186,6 +216,7 @@ struct CommandList : _ze_command_list_handle_t {
 
     CommandQueue *cmdQImmediate = nullptr;
     uint32_t cmdListType = CommandListType::TYPE_REGULAR;
+    bool isFlushTaskSubmissionEnabled = false;
     Device *device = nullptr;
     std::vector<Kernel *> printfFunctionContainer;
 
@@ -200,14 +231,31 @@ struct CommandList : _ze_command_list_handle_t {
 
     virtual ze_result_t setSyncModeQueue(bool syncMode) = 0;
 
+    // immediate command list with concurrent appends forwards appends of calling thread to command list of that thread,
+    // created on first append, returns nullptr when command list of thread can not be created
+    CommandList *getThreadCommandList();
+    bool areConcurrentAppendsAllowed() const { return concurrentAppendsAllowed; }
+
   protected:
+    struct ExecutionCache {
+        uint64_t internalAllocationsVersion = 0u;
+        uint32_t internalAllocationsMask = 0u;
+        bool internalAllocationsResident = false;
+    };
+
     std::map<const void *, NEO::GraphicsAllocation *> hostPtrMap;
+    std::vector<Event *> counterBasedSignalEvents;
+    ExecutionCache executionCache;
     uint32_t commandListPerThreadScratchSize = 0u;
     NEO::PreemptionMode commandListPreemptionMode = NEO::PreemptionMode::Initial;
     NEO::EngineGroupType engineGroupType;
     UnifiedMemoryControls unifiedMemoryControls;
     bool indirectAllocationsAllowed = false;
     bool internalUsage = false;
+    bool concurrentAppendsAllowed = false;
+    ze_command_queue_desc_t threadCommandListDesc = {};
+    std::unordered_map<std::thread::id, CommandList *> threadCommandLists;
+    std::mutex threadCommandListsMutex;
     NEO::GraphicsAllocation *getAllocationFromHostPtrMap(const void *buffer, uint64_t bufferSize);
     NEO::GraphicsAllocation *getHostPtrAlloc(const void *buffer, uint64_t bufferSize);
     bool containsStatelessUncachedResource = false;
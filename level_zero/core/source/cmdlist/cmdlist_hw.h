@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include "shared/source/command_container/command_encoder.h"
+#include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/helpers/ptr_math.h"
+
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 
@@ -29,6 +33,37 @@ struct AlignedAllocationData {
     bool needsFlush = false;
 };
 
+// commands programmed between begin and end, empty when command buffer was chained in between
+struct RecordedCommands {
+    void begin(NEO::LinearStream &commandStream) {
+        cmdBufferBase = commandStream.getCpuBase();
+        cmds = ptrOffset(cmdBufferBase, commandStream.getUsed());
+        size = 0u;
+    }
+    void end(NEO::LinearStream &commandStream) {
+        if (commandStream.getCpuBase() != cmdBufferBase) {
+            cmds = nullptr;
+            return;
+        }
+        size = ptrDiff(ptrOffset(cmdBufferBase, commandStream.getUsed()), cmds);
+    }
+    bool isValid() const { return cmds != nullptr; }
+
+    void *cmdBufferBase = nullptr;
+    void *cmds = nullptr;
+    size_t size = 0u;
+};
+
+// kernel launch recorded in regular command list which can be patched in place until command list is reset
+struct MutableKernelLaunch {
+    Kernel *kernel = nullptr;
+    NEO::EncodedDispatchKernelData encodedData;
+    RecordedCommands waitEventsCmds;
+    RecordedCommands signalEventCmds;
+    uint32_t groupSize[3] = {};
+    bool requiresUncachedMocs = false;
+};
+
 struct EventPool;
 struct Event;
 
@@ -97,6 +132,7 @@ struct CommandListCoreFamily : CommandListImp {
                                  ze_event_handle_t *phWaitEvents) override;
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr,
                                     NEO::GraphicsAllocation *srcptr,
+                                    size_t offset,
                                     size_t size,
                                     bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
@@ -127,6 +163,13 @@ struct CommandListCoreFamily : CommandListImp {
     ze_result_t appendMINoop() override;
     ze_result_t appendPipeControl(void *dstPtr, uint64_t value) override;
 
+    ze_result_t getLastKernelLaunchId(uint64_t *pLaunchId) override;
+    ze_result_t updateKernelLaunchArgument(uint64_t launchId, uint32_t argIndex, size_t argSize, const void *pArgValue) override;
+    ze_result_t updateKernelLaunchGroupCount(uint64_t launchId, const ze_group_count_t *pThreadGroupDimensions) override;
+    ze_result_t updateKernelLaunchSignalEvent(uint64_t launchId, ze_event_handle_t hSignalEvent) override;
+    ze_result_t updateKernelLaunchWaitEvents(uint64_t launchId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+    ze_result_t clone(CommandList *&clonedCommandList) override;
+
     ze_result_t appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
                                             const size_t *pOffsets, ze_event_handle_t hSignalEvent,
                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
@@ -228,6 +271,18 @@ struct CommandListCoreFamily : CommandListImp {
     uint64_t getInputBufferSize(NEO::ImageType imageType, uint64_t bytesPerPixel, const ze_image_region_t *region);
     MOCKABLE_VIRTUAL AlignedAllocationData getAlignedAllocation(Device *device, const void *buffer, uint64_t bufferSize);
     ze_result_t addEventsToCmdList(uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+
+    void programSignalEvent(NEO::LinearStream &commandStream, Event &event);
+    void programWaitOnEvents(NEO::LinearStream &commandStream, uint32_t numEvents, ze_event_handle_t *phEvent);
+    void recordKernelLaunch(const RecordedCommands &waitEventsCmds);
+    MutableKernelLaunch *getMutableKernelLaunch(uint64_t launchId);
+    ze_result_t replaceRecordedCommands(RecordedCommands &recordedCmds, const NEO::LinearStream &newCmds);
+
+    MutableKernelLaunch lastKernelLaunch;
+    std::vector<MutableKernelLaunch> mutableKernelLaunches;
+    std::vector<size_t> walkerCmdOffsets;
+    bool closed = false;
+    bool containsHeapAddressReferences = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
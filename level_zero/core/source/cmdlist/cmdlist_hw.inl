@@ -24,8 +24,10 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/program/sync_buffer_handler.h"
 #include "shared/source/program/sync_buffer_handler.inl"
+#include "shared/source/utilities/runtime_tracer.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -68,15 +70,21 @@ void CommandListCoreFamily<gfxCoreFamily>::programThreadArbitrationPolicy(Device
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     printfFunctionContainer.clear();
+    counterBasedSignalEvents.clear();
     removeDeallocationContainerData();
     removeHostPtrAllocations();
     commandContainer.reset();
+    mutableKernelLaunches.clear();
+    walkerCmdOffsets.clear();
+    closed = false;
+    containsHeapAddressReferences = false;
     containsStatelessUncachedResource = false;
     indirectAllocationsAllowed = false;
     unifiedMemoryControls.indirectHostAllocationsAllowed = false;
     unifiedMemoryControls.indirectSharedAllocationsAllowed = false;
     commandListPreemptionMode = device->getDevicePreemptionMode();
     commandListPerThreadScratchSize = 0u;
+    executionCache = {};
 
     if (!isCopyOnly()) {
         if (!NEO::ApiSpecificConfig::getBindlessConfiguration()) {
@@ -129,12 +137,16 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
 
     commandContainer.removeDuplicatesFromResidencyContainer();
     NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(commandContainer);
+    closed = true;
 
     return ZE_RESULT_SUCCESS;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-void CommandListCoreFamily<gfxCoreFamily>::programL3(bool isSLMused) {}
+void CommandListCoreFamily<gfxCoreFamily>::programL3(bool isSLMused) {
+    NEO::EncodeL3State<GfxFamily>::encode(commandContainer, isSLMused);
+    commandContainer.lastSentL3Config = NEO::PreambleHelper<GfxFamily>::getL3Config(device->getHwInfo(), isSLMused);
+}
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_handle_t hKernel,
@@ -142,14 +154,22 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
                                                                      ze_event_handle_t hEvent,
                                                                      uint32_t numWaitEvents,
                                                                      ze_event_handle_t *phWaitEvents) {
+    RUNTIME_TRACE_SCOPE("appendLaunchKernel");
 
+    RecordedCommands waitEventsCmds;
+    waitEventsCmds.begin(*commandContainer.getCommandStream());
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
     if (ret) {
         return ret;
     }
+    waitEventsCmds.end(*commandContainer.getCommandStream());
 
-    return appendLaunchKernelWithParams(hKernel, pThreadGroupDimensions,
-                                        hEvent, false, false, false);
+    ret = appendLaunchKernelWithParams(hKernel, pThreadGroupDimensions,
+                                       hEvent, false, false, false);
+    if (ret == ZE_RESULT_SUCCESS) {
+        recordKernelLaunch(waitEventsCmds);
+    }
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -159,13 +179,20 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchCooperativeKernel(
                                                                                 uint32_t numWaitEvents,
                                                                                 ze_event_handle_t *phWaitEvents) {
 
+    RecordedCommands waitEventsCmds;
+    waitEventsCmds.begin(*commandContainer.getCommandStream());
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
     if (ret) {
         return ret;
     }
+    waitEventsCmds.end(*commandContainer.getCommandStream());
 
-    return appendLaunchKernelWithParams(hKernel, pLaunchFuncArgs,
-                                        hSignalEvent, false, false, true);
+    ret = appendLaunchKernelWithParams(hKernel, pLaunchFuncArgs,
+                                       hSignalEvent, false, false, true);
+    if (ret == ZE_RESULT_SUCCESS) {
+        recordKernelLaunch(waitEventsCmds);
+    }
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -210,6 +237,18 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
     for (uint32_t i = 0; i < numKernels; i++) {
         NEO::EncodeMathMMIO<GfxFamily>::encodeGreaterThanPredicate(commandContainer, alloc->getGpuAddress(), i);
 
+        // consecutive entries of the same kernel differ only in group count read by GPU, so only thread data is encoded again
+        if (i > 0 && phKernels[i] == phKernels[i - 1] && NEO::DebugManager.flags.EnableRepeatedIndirectDispatch.get() != 0) {
+            if (haveLaunchArguments) {
+                prepareIndirectParams(&pLaunchArgumentsBuffer[i]);
+            }
+            auto previousWalkerCmd = lastKernelLaunch.encodedData.walkerCmd;
+            NEO::EncodeDispatchKernel<GfxFamily>::encodeRepeatedIndirect(commandContainer, previousWalkerCmd, Kernel::fromHandle(phKernels[i]),
+                                                                         device->getNEODevice(), &lastKernelLaunch.encodedData);
+            walkerCmdOffsets.push_back(ptrDiff(lastKernelLaunch.encodedData.walkerCmd, commandContainer.getCommandStream()->getCpuBase()));
+            continue;
+        }
+
         ret = appendLaunchKernelWithParams(phKernels[i],
                                            haveLaunchArguments ? &pLaunchArgumentsBuffer[i] : nullptr,
                                            nullptr, true, true, false);
@@ -227,6 +266,9 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
     using POST_SYNC_OPERATION = typename GfxFamily::PIPE_CONTROL::POST_SYNC_OPERATION;
     auto event = Event::fromHandle(hEvent);
+    if (event->isCounterBased) {
+        return ZE_RESULT_SUCCESS;
+    }
 
     uint64_t baseAddr = event->getGpuAddress(this->device);
 
@@ -675,10 +717,33 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemAdvise(ze_device_hand
                                                                   ze_memory_advice_t advice) {
 
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
-    if (allocData) {
+    if (allocData == nullptr) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    auto pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+    if (pageFaultManager == nullptr || allocData->memoryType != InternalMemoryType::SHARED_UNIFIED_MEMORY) {
         return ZE_RESULT_SUCCESS;
     }
-    return ZE_RESULT_ERROR_UNKNOWN;
+
+    auto allocPtr = reinterpret_cast<void *>(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex())->getGpuAddress());
+    switch (advice) {
+    case ZE_MEMORY_ADVICE_SET_READ_MOSTLY:
+        pageFaultManager->setReadMostly(allocPtr, true);
+        break;
+    case ZE_MEMORY_ADVICE_CLEAR_READ_MOSTLY:
+        pageFaultManager->setReadMostly(allocPtr, false);
+        break;
+    case ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION:
+        pageFaultManager->setPreferredGpuLocation(allocPtr, true);
+        break;
+    case ZE_MEMORY_ADVICE_CLEAR_PREFERRED_LOCATION:
+        pageFaultManager->setPreferredGpuLocation(allocPtr, false);
+        break;
+    default:
+        break;
+    }
+    return ZE_RESULT_SUCCESS;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -803,7 +868,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyBlitRegion(NEO
     if (copyOneCommand) {
         NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsRegion(blitProperties, *commandContainer.getCommandStream(), *device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
     } else {
-        NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBufferPerRow(blitProperties, *commandContainer.getCommandStream(), *device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
+        // multi row blits are used when they need fewer commands than copying row by row
+        NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitCommands(blitProperties, *commandContainer.getCommandStream(), *device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
     }
     appendSignalEventPostWalker(hSignalEvent);
     return ZE_RESULT_SUCCESS;
@@ -839,6 +905,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr,
                                                                       NEO::GraphicsAllocation *srcptr,
+                                                                      size_t offset,
                                                                       size_t size, bool flushHost) {
 
     auto lock = device->getBuiltinFunctionsLib()->obtainUniqueOwnership();
@@ -856,8 +923,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 
-    auto dstValPtr = static_cast<uintptr_t>(dstptr->getGpuAddress());
-    auto srcValPtr = static_cast<uintptr_t>(srcptr->getGpuAddress());
+    auto dstValPtr = static_cast<uintptr_t>(dstptr->getGpuAddress() + offset);
+    auto srcValPtr = static_cast<uintptr_t>(srcptr->getGpuAddress() + offset);
 
     builtinFunction->setArgBufferWithAlloc(0, dstValPtr, dstptr);
     builtinFunction->setArgBufferWithAlloc(1, srcValPtr, srcptr);
@@ -913,6 +980,16 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(void *dstptr,
     auto dstAllocationStruct = getAlignedAllocation(this->device, dstptr, size);
     auto srcAllocationStruct = getAlignedAllocation(this->device, srcptr, size);
 
+    if (dstAllocationStruct.alloc && dstAllocationStruct.alloc->isZeroInitPending()) {
+        // copy overwriting whole allocation before any other use makes its pending zeroing redundant
+        auto &residencyContainer = commandContainer.getResidencyContainer();
+        auto dstAllocData = this->device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(dstptr);
+        if (dstAllocData && castToUint64(dstptr) == dstAllocationStruct.alloc->getGpuAddress() && size >= dstAllocData->size &&
+            std::find(residencyContainer.begin(), residencyContainer.end(), dstAllocationStruct.alloc) == residencyContainer.end()) {
+            dstAllocationStruct.alloc->setZeroInitPending(false);
+        }
+    }
+
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
 
     if (ret) {
@@ -1171,10 +1248,16 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(const void *ptr,
                                                                        size_t count) {
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
-    if (allocData) {
-        return ZE_RESULT_SUCCESS;
+    if (allocData == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (allocData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+        // shared allocations in residency are moved to GPU domain before submission,
+        // with KMD migration making allocation resident migrates it
+        commandContainer.addToResidencyContainer(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
     }
-    return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    return ZE_RESULT_SUCCESS;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -1216,7 +1299,15 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
     auto dstAllocation = this->getAlignedAllocation(this->device, ptr, size);
     auto lock = device->getBuiltinFunctionsLib()->obtainUniqueOwnership();
 
+    constexpr size_t wideElSize = sizeof(uint32_t) * 4;
+    auto dstAddress = dstAllocation.alignedAllocationPtr + dstAllocation.offset;
+    bool useWideStores = isAligned<wideElSize>(dstAddress) && size >= wideElSize;
     if (patternSize == 1) {
+        // byte pattern is replicated into pattern allocation for large fills, so they are done with 16 byte stores
+        useWideStores &= size >= MemoryConstants::pageSize;
+    }
+
+    if (patternSize == 1 && !useWideStores) {
         auto builtinFunction = device->getBuiltinFunctionsLib()->getFunction(Builtin::FillBufferImmediate);
 
         uint32_t groupSizeX = builtinFunction->getImmutableData()->getDescriptor().kernelAttributes.simdSize;
@@ -1257,21 +1348,20 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
             }
         }
     } else {
-        auto builtinFunction = device->getBuiltinFunctionsLib()->getFunction(Builtin::FillBufferMiddle);
-
-        size_t middleElSize = sizeof(uint32_t);
-        size_t adjustedSize = size / middleElSize;
-        uint32_t groupSizeX = static_cast<uint32_t>(adjustedSize);
-        uint32_t groupSizeY = 1, groupSizeZ = 1;
-        builtinFunction->suggestGroupSize(groupSizeX, groupSizeY, groupSizeZ, &groupSizeX, &groupSizeY, &groupSizeZ);
-        builtinFunction->setGroupSize(groupSizeX, groupSizeY, groupSizeZ);
-
-        uint32_t groups = static_cast<uint32_t>(adjustedSize) / groupSizeX;
-        uint32_t groupRemainderSizeX = static_cast<uint32_t>(size) % groupSizeX;
+        auto builtinFunction = device->getBuiltinFunctionsLib()->getFunction(useWideStores ? Builtin::FillBufferMiddleWide : Builtin::FillBufferMiddle);
 
+        size_t middleElSize = useWideStores ? wideElSize : sizeof(uint32_t);
         size_t patternAllocationSize = alignUp(patternSize, MemoryConstants::cacheLineSize);
         uint32_t patternSizeInEls = static_cast<uint32_t>(patternAllocationSize / middleElSize);
 
+        // large fills keep middle part multiple of pattern allocation, so leftover starts at beginning of pattern
+        size_t middleEls = size / middleElSize;
+        size_t middleElsAlignment = std::max(static_cast<size_t>(builtinFunction->getImmutableData()->getDescriptor().kernelAttributes.simdSize),
+                                             static_cast<size_t>(patternSizeInEls));
+        if (middleEls >= middleElsAlignment) {
+            middleEls = alignDown(middleEls, middleElsAlignment);
+        }
+
         auto patternGfxAlloc = getAllocationFromHostPtrMap(pattern, patternAllocationSize);
         if (patternGfxAlloc == nullptr) {
             patternGfxAlloc = device->getDriverHandle()->getMemoryManager()->allocateGraphicsMemoryWithProperties({device->getNEODevice()->getRootDeviceIndex(),
@@ -1296,26 +1386,40 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
             patternAllocOffset += patternSizeToCopy;
         } while (patternAllocOffset < patternAllocationSize);
 
-        builtinFunction->setArgBufferWithAlloc(0, dstAllocation.alignedAllocationPtr, dstAllocation.alloc);
-        builtinFunction->setArgumentValue(1, sizeof(dstAllocation.offset), &dstAllocation.offset);
-        builtinFunction->setArgBufferWithAlloc(2, reinterpret_cast<uintptr_t>(patternGfxAllocPtr), patternGfxAlloc);
-        builtinFunction->setArgumentValue(3, sizeof(patternSizeInEls), &patternSizeInEls);
-
         appendEventForProfilingAllWalkers(hSignalEvent, true);
 
-        ze_group_count_t dispatchFuncArgs{groups, 1u, 1u};
-        res = appendLaunchKernelSplit(builtinFunction->toHandle(), &dispatchFuncArgs, hSignalEvent);
-        if (res) {
-            return res;
+        if (middleEls) {
+            uint32_t groupSizeX = static_cast<uint32_t>(middleEls);
+            uint32_t groupSizeY = 1, groupSizeZ = 1;
+            builtinFunction->suggestGroupSize(groupSizeX, groupSizeY, groupSizeZ, &groupSizeX, &groupSizeY, &groupSizeZ);
+            builtinFunction->setGroupSize(groupSizeX, groupSizeY, groupSizeZ);
+
+            builtinFunction->setArgBufferWithAlloc(0, dstAllocation.alignedAllocationPtr, dstAllocation.alloc);
+            builtinFunction->setArgumentValue(1, sizeof(dstAllocation.offset), &dstAllocation.offset);
+            builtinFunction->setArgBufferWithAlloc(2, reinterpret_cast<uintptr_t>(patternGfxAllocPtr), patternGfxAlloc);
+            builtinFunction->setArgumentValue(3, sizeof(patternSizeInEls), &patternSizeInEls);
+
+            ze_group_count_t dispatchFuncArgs{static_cast<uint32_t>(middleEls) / groupSizeX, 1u, 1u};
+            res = appendLaunchKernelSplit(builtinFunction->toHandle(), &dispatchFuncArgs, hSignalEvent);
+            if (res) {
+                return res;
+            }
         }
 
-        if (groupRemainderSizeX) {
-            uint32_t dstOffsetRemainder = groups * groupSizeX * static_cast<uint32_t>(middleElSize);
-            uint64_t patternOffsetRemainder = (groupSizeX * groups & (patternSizeInEls - 1)) * middleElSize;
+        // whole remainder is filled with single byte granularity dispatch
+        size_t middleSize = middleEls * middleElSize;
+        uint32_t leftoverSize = static_cast<uint32_t>(size - middleSize);
+        if (leftoverSize) {
+            uint32_t dstOffsetRemainder = static_cast<uint32_t>(dstAllocation.offset + middleSize);
+            uint64_t patternOffsetRemainder = middleSize & (patternAllocationSize - 1);
+            uint32_t patternSizeInBytes = static_cast<uint32_t>(patternAllocationSize);
 
             auto builtinFunctionRemainder = device->getBuiltinFunctionsLib()->getFunction(Builtin::FillBufferRightLeftover);
-            builtinFunctionRemainder->setGroupSize(groupRemainderSizeX, 1u, 1u);
-            ze_group_count_t dispatchFuncArgs{1u, 1u, 1u};
+            uint32_t groupSizeX = leftoverSize;
+            uint32_t groupSizeY = 1, groupSizeZ = 1;
+            builtinFunctionRemainder->suggestGroupSize(groupSizeX, groupSizeY, groupSizeZ, &groupSizeX, &groupSizeY, &groupSizeZ);
+            builtinFunctionRemainder->setGroupSize(groupSizeX, groupSizeY, groupSizeZ);
+            ze_group_count_t dispatchFuncArgs{leftoverSize / groupSizeX, 1u, 1u};
 
             builtinFunctionRemainder->setArgBufferWithAlloc(0,
                                                             dstAllocation.alignedAllocationPtr,
@@ -1326,7 +1430,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
             builtinFunctionRemainder->setArgBufferWithAlloc(2,
                                                             reinterpret_cast<uintptr_t>(patternGfxAllocPtr) + patternOffsetRemainder,
                                                             patternGfxAlloc);
-            builtinFunctionRemainder->setArgumentValue(3, sizeof(patternSizeInEls), &patternSizeInEls);
+            builtinFunctionRemainder->setArgumentValue(3, sizeof(patternSizeInBytes), &patternSizeInBytes);
             res = appendLaunchKernelSplit(builtinFunctionRemainder->toHandle(), &dispatchFuncArgs, hSignalEvent);
             if (res) {
                 return res;
@@ -1459,6 +1563,10 @@ inline AlignedAllocationData CommandListCoreFamily<gfxCoreFamily>::getAlignedAll
 
     if (srcAllocFound == false) {
         alloc = device->getDriverHandle()->findHostPointerAllocation(ptr, static_cast<size_t>(bufferSize), device->getRootDeviceIndex());
+        if (alloc == nullptr) {
+            DriverHandleImp *driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+            alloc = driverHandle->importImplicitHostPointer(ptr, static_cast<size_t>(bufferSize), device->getRootDeviceIndex());
+        }
         if (alloc != nullptr) {
             alignedPtr = static_cast<uintptr_t>(alloc->getGpuAddress());
             offset = reinterpret_cast<size_t>(ptr) - reinterpret_cast<size_t>(alloc->getUnderlyingBuffer());
@@ -1505,37 +1613,63 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::addEventsToCmdList(uint
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hEvent) {
-    using POST_SYNC_OPERATION = typename GfxFamily::PIPE_CONTROL::POST_SYNC_OPERATION;
-    using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     auto event = Event::fromHandle(hEvent);
+    if (event->isCounterBased) {
+        // counter is assigned when command list is submitted
+        if (std::find(counterBasedSignalEvents.begin(), counterBasedSignalEvents.end(), event) == counterBasedSignalEvents.end()) {
+            counterBasedSignalEvents.push_back(event);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
 
     commandContainer.addToResidencyContainer(&event->getAllocation(this->device));
-    uint64_t baseAddr = event->getGpuAddress(this->device);
+    programSignalEvent(*commandContainer.getCommandStream(), *event);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::programSignalEvent(NEO::LinearStream &commandStream, Event &event) {
+    using POST_SYNC_OPERATION = typename GfxFamily::PIPE_CONTROL::POST_SYNC_OPERATION;
+
+    uint64_t baseAddr = event.getGpuAddress(this->device);
     size_t eventSignalOffset = 0;
-    if (event->isTimestampEvent) {
+    if (event.isTimestampEvent) {
         eventSignalOffset = NEO::TimestampPackets<uint32_t>::getContextEndOffset();
     }
 
     if (isCopyOnly()) {
-        NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(*commandContainer.getCommandStream(), ptrOffset(baseAddr, eventSignalOffset), Event::STATE_SIGNALED, false, true);
+        NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(commandStream, ptrOffset(baseAddr, eventSignalOffset), Event::STATE_SIGNALED, false, true);
     } else {
         NEO::PipeControlArgs args;
-        args.dcFlushEnable = (!event->signalScope) ? false : true;
+        args.dcFlushEnable = (!event.signalScope) ? false : true;
         NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
-            *commandContainer.getCommandStream(), POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA,
+            commandStream, POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA,
             ptrOffset(baseAddr, eventSignalOffset), Event::STATE_SIGNALED,
             commandContainer.getDevice()->getHardwareInfo(),
             args);
     }
-    return ZE_RESULT_SUCCESS;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents,
                                                                      ze_event_handle_t *phEvent) {
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(phEvent[i]);
+        if (event->isCounterBased) {
+            commandContainer.addToResidencyContainer(event->counterAllocation);
+            continue;
+        }
+        commandContainer.addToResidencyContainer(&event->getAllocation(this->device));
+    }
+    programWaitOnEvents(*commandContainer.getCommandStream(), numEvents, phEvent);
+
+    return ZE_RESULT_SUCCESS;
+}
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::programWaitOnEvents(NEO::LinearStream &commandStream, uint32_t numEvents,
+                                                               ze_event_handle_t *phEvent) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
-    using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
     using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
 
     uint64_t gpuAddr = 0;
@@ -1549,16 +1683,24 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
 
     if (dcFlushRequired) {
         if (isCopyOnly()) {
-            NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(*commandContainer.getCommandStream(), 0, 0, false, false);
+            NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(commandStream, 0, 0, false, false);
         } else {
             NEO::PipeControlArgs args(true);
-            NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(*commandContainer.getCommandStream(), args);
+            NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(commandStream, args);
         }
     }
 
     for (uint32_t i = 0; i < numEvents; i++) {
         auto event = Event::fromHandle(phEvent[i]);
-        commandContainer.addToResidencyContainer(&event->getAllocation(this->device));
+        if (event->isCounterBased) {
+            if (event->counterAllocation) {
+                NEO::EncodeSempahore<GfxFamily>::addMiSemaphoreWaitCommand(commandStream,
+                                                                           event->counterGpuAddress,
+                                                                           event->counterValue,
+                                                                           COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+            }
+            continue;
+        }
         gpuAddr = event->getGpuAddress(this->device);
         uint32_t packetsToWait = event->getPacketsInUse();
 
@@ -1566,7 +1708,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
             gpuAddr += NEO::TimestampPackets<uint32_t>::getContextEndOffset();
         }
         for (uint32_t i = 0u; i < packetsToWait; i++) {
-            NEO::EncodeSempahore<GfxFamily>::addMiSemaphoreWaitCommand(*commandContainer.getCommandStream(),
+            NEO::EncodeSempahore<GfxFamily>::addMiSemaphoreWaitCommand(commandStream,
                                                                        gpuAddr,
                                                                        eventStateClear,
                                                                        COMPARE_OPERATION::COMPARE_OPERATION_SAD_NOT_EQUAL_SDD);
@@ -1574,8 +1716,6 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
             gpuAddr += NEO::TimestampPackets<uint32_t>::getSinglePacketSize();
         }
     }
-
-    return ZE_RESULT_SUCCESS;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -1741,7 +1881,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(
     UNRECOVERABLE_IF(!result);
 
     Kernel *builtinFunction = nullptr;
-    auto useOnlyGlobalTimestamps = NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily).useOnlyGlobalTimestamps() ? 1u : 0u;
+    auto useOnlyGlobalTimestamps = NEO::HwHelperHw<GfxFamily>::get().useOnlyGlobalTimestamps() ? 1u : 0u;
     auto lock = device->getBuiltinFunctionsLib()->obtainUniqueOwnership();
 
     if (pOffsets == nullptr) {
@@ -1859,4 +1999,303 @@ void CommandListCoreFamily<gfxCoreFamily>::programStateBaseAddress(NEO::CommandC
     }
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::recordKernelLaunch(const RecordedCommands &waitEventsCmds) {
+    if (cmdListType != CommandListType::TYPE_REGULAR || lastKernelLaunch.encodedData.walkerCmd == nullptr) {
+        return;
+    }
+    // builtin kernels are shared between command lists, their launches are not exposed for updates
+    auto isaAllocation = lastKernelLaunch.kernel->getImmutableData()->getIsaGraphicsAllocation();
+    if (isaAllocation->getAllocationType() == NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL) {
+        return;
+    }
+
+    lastKernelLaunch.waitEventsCmds = waitEventsCmds;
+    mutableKernelLaunches.push_back(lastKernelLaunch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+MutableKernelLaunch *CommandListCoreFamily<gfxCoreFamily>::getMutableKernelLaunch(uint64_t launchId) {
+    if (launchId >= mutableKernelLaunches.size()) {
+        return nullptr;
+    }
+    return &mutableKernelLaunches[static_cast<size_t>(launchId)];
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::replaceRecordedCommands(RecordedCommands &recordedCmds, const NEO::LinearStream &newCmds) {
+    // recorded commands are patched in place, so following commands can't be moved
+    if (!recordedCmds.isValid() || recordedCmds.size != newCmds.getUsed()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    memcpy_s(recordedCmds.cmds, recordedCmds.size, newCmds.getCpuBase(), newCmds.getUsed());
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::getLastKernelLaunchId(uint64_t *pLaunchId) {
+    if (mutableKernelLaunches.empty()) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+    *pLaunchId = mutableKernelLaunches.size() - 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateKernelLaunchArgument(uint64_t launchId, uint32_t argIndex,
+                                                                             size_t argSize, const void *pArgValue) {
+    auto launch = getMutableKernelLaunch(launchId);
+    if (launch == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto kernel = launch->kernel;
+    const auto &explicitArgs = kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+    if (argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const auto &arg = explicitArgs[argIndex];
+    if (arg.is<NEO::ArgDescriptor::ArgTPointer>()) {
+        const auto &argAsPtr = arg.as<NEO::ArgDescPointer>();
+        // slm layout and bindless surface states are programmed once per dispatch
+        if (arg.getTraits().getAddressQualifier() == NEO::KernelArgMetadata::AddrLocal ||
+            NEO::isValidOffset(argAsPtr.bindless)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        if (NEO::isValidOffset(argAsPtr.bindful) && launch->encodedData.surfaceStateHeapData == nullptr) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        if (pArgValue != nullptr && launch->requiresUncachedMocs == false) {
+            auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(*reinterpret_cast<void *const *>(pArgValue));
+            if (allocData && allocData->allocationFlagsProperty.flags.locallyUncachedResource) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+        }
+    } else if (!arg.is<NEO::ArgDescriptor::ArgTValue>()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto ret = kernel->setArgumentValue(argIndex, argSize, pArgValue);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    auto copyCrossThreadData = [&](NEO::CrossThreadDataOffset offset, size_t size) {
+        if (NEO::isValidOffset(offset)) {
+            memcpy_s(ptrOffset(launch->encodedData.crossThreadData, offset), size,
+                     ptrOffset(kernel->getCrossThreadData(), offset), size);
+        }
+    };
+
+    if (arg.is<NEO::ArgDescriptor::ArgTValue>()) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            copyCrossThreadData(element.offset, element.size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    const auto &argAsPtr = arg.as<NEO::ArgDescPointer>();
+    copyCrossThreadData(argAsPtr.stateless, argAsPtr.pointerSize);
+    copyCrossThreadData(argAsPtr.bufferOffset, sizeof(uint32_t));
+    if (NEO::isValidOffset(argAsPtr.bindful)) {
+        using RENDER_SURFACE_STATE = typename GfxFamily::RENDER_SURFACE_STATE;
+        memcpy_s(ptrOffset(launch->encodedData.surfaceStateHeapData, argAsPtr.bindful), sizeof(RENDER_SURFACE_STATE),
+                 ptrOffset(kernel->getSurfaceStateHeapData(), argAsPtr.bindful), sizeof(RENDER_SURFACE_STATE));
+    }
+
+    auto allocation = kernel->getResidencyContainer()[argIndex];
+    if (allocation != nullptr) {
+        commandContainer.addToResidencyContainer(allocation);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateKernelLaunchGroupCount(uint64_t launchId, const ze_group_count_t *pThreadGroupDimensions) {
+    using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
+
+    auto launch = getMutableKernelLaunch(launchId);
+    if (launch == nullptr || pThreadGroupDimensions == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    // sync buffer is sized for group count of recorded launch
+    if (launch->kernel->usesSyncBuffer()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto walkerCmd = reinterpret_cast<WALKER_TYPE *>(launch->encodedData.walkerCmd);
+    walkerCmd->setThreadGroupIdXDimension(pThreadGroupDimensions->groupCountX);
+    walkerCmd->setThreadGroupIdYDimension(pThreadGroupDimensions->groupCountY);
+    walkerCmd->setThreadGroupIdZDimension(pThreadGroupDimensions->groupCountZ);
+
+    if (launch->encodedData.crossThreadData != nullptr) {
+        const auto &dispatchTraits = launch->kernel->getKernelDescriptor().payloadMappings.dispatchTraits;
+        uint32_t groupCount[3] = {pThreadGroupDimensions->groupCountX,
+                                  pThreadGroupDimensions->groupCountY,
+                                  pThreadGroupDimensions->groupCountZ};
+        uint32_t globalWorkSize[3] = {groupCount[0] * launch->groupSize[0],
+                                      groupCount[1] * launch->groupSize[1],
+                                      groupCount[2] * launch->groupSize[2]};
+        auto dst = ArrayRef<uint8_t>(reinterpret_cast<uint8_t *>(launch->encodedData.crossThreadData), launch->kernel->getCrossThreadDataSize());
+        NEO::patchVecNonPointer(dst, dispatchTraits.globalWorkSize, globalWorkSize);
+        NEO::patchVecNonPointer(dst, dispatchTraits.numWorkGroups, groupCount);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateKernelLaunchSignalEvent(uint64_t launchId, ze_event_handle_t hSignalEvent) {
+    auto launch = getMutableKernelLaunch(launchId);
+    if (launch == nullptr || hSignalEvent == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto event = Event::fromHandle(hSignalEvent);
+    // timestamp events are written before and after walker, counter-based events are not programmed at all
+    if (event->isTimestampEvent || event->isCounterBased || launch->signalEventCmds.size == 0u) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto maxCmdsSize = NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(device->getHwInfo());
+    std::vector<uint8_t> cmdsBuffer(std::max(maxCmdsSize, launch->signalEventCmds.size));
+    NEO::LinearStream cmds(cmdsBuffer.data(), cmdsBuffer.size());
+    programSignalEvent(cmds, *event);
+
+    auto ret = replaceRecordedCommands(launch->signalEventCmds, cmds);
+    if (ret == ZE_RESULT_SUCCESS) {
+        commandContainer.addToResidencyContainer(&event->getAllocation(this->device));
+    }
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateKernelLaunchWaitEvents(uint64_t launchId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto launch = getMutableKernelLaunch(launchId);
+    if (launch == nullptr || (numWaitEvents > 0 && phWaitEvents == nullptr)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    size_t maxCmdsSize = NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForSinglePipeControl();
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        maxCmdsSize += Event::fromHandle(phWaitEvents[i])->getPacketsInUse() * NEO::EncodeSempahore<GfxFamily>::getSizeMiSemaphoreWait();
+    }
+    std::vector<uint8_t> cmdsBuffer(std::max(maxCmdsSize, launch->waitEventsCmds.size));
+    NEO::LinearStream cmds(cmdsBuffer.data(), cmdsBuffer.size());
+    programWaitOnEvents(cmds, numWaitEvents, phWaitEvents);
+
+    auto ret = replaceRecordedCommands(launch->waitEventsCmds, cmds);
+    if (ret == ZE_RESULT_SUCCESS) {
+        for (uint32_t i = 0; i < numWaitEvents; i++) {
+            commandContainer.addToResidencyContainer(&Event::fromHandle(phWaitEvents[i])->getAllocation(this->device));
+        }
+    }
+    return ret;
+}
+
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::clone(CommandList *&clonedCommandList) {
+    using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
+
+    // commands are copied as is, so command list can't refer to memory it owns other than its own heaps
+    if (!closed || cmdListType != CommandListType::TYPE_REGULAR || isCopyOnly() ||
+        NEO::ApiSpecificConfig::getBindlessConfiguration() || containsHeapAddressReferences || !hostPtrMap.empty() ||
+        commandContainer.getCmdBufferAllocations().size() != 1u || !commandContainer.getDeallocationContainer().empty()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto commandList = static_cast<CommandListCoreFamily<gfxCoreFamily> *>(CommandList::create(device->getHwInfo().platform.eProductFamily,
+                                                                                               device, engineGroupType, returnValue));
+    if (commandList == nullptr) {
+        return returnValue;
+    }
+    auto &clonedContainer = commandList->commandContainer;
+
+    // state base address programmed by initialize already points to heaps of cloned command list
+    auto srcStream = commandContainer.getCommandStream();
+    auto dstStream = clonedContainer.getCommandStream();
+    auto prologueSize = dstStream->getUsed();
+    UNRECOVERABLE_IF(prologueSize > srcStream->getUsed());
+    auto commandsSize = srcStream->getUsed() - prologueSize;
+    memcpy_s(dstStream->getSpace(commandsSize), commandsSize, ptrOffset(srcStream->getCpuBase(), prologueSize), commandsSize);
+
+    for (uint32_t i = 0; i < NEO::HeapType::NUM_TYPES; i++) {
+        auto heapType = static_cast<NEO::HeapType>(i);
+        auto srcHeap = commandContainer.getIndirectHeap(heapType);
+        auto dstHeap = clonedContainer.getIndirectHeap(heapType);
+        if (srcHeap == nullptr) {
+            continue;
+        }
+        if (dstHeap->getMaxAvailableSpace() < srcHeap->getUsed()) {
+            commandList->destroy();
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+        memcpy_s(dstHeap->getCpuBase(), dstHeap->getMaxAvailableSpace(), srcHeap->getCpuBase(), srcHeap->getUsed());
+        dstHeap->getSpace(srcHeap->getUsed() - dstHeap->getUsed());
+    }
+
+    // walkers address thread data by offset in internal heap, which differs between indirect object heaps
+    auto srcIoh = commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+    auto dstIoh = clonedContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+    auto iohOffsetDelta = dstIoh->getHeapGpuStartOffset() - srcIoh->getHeapGpuStartOffset();
+    for (auto walkerCmdOffset : walkerCmdOffsets) {
+        auto walkerCmd = reinterpret_cast<WALKER_TYPE *>(ptrOffset(dstStream->getCpuBase(), walkerCmdOffset));
+        walkerCmd->setIndirectDataStartAddress(static_cast<uint32_t>(walkerCmd->getIndirectDataStartAddress() + iohOffsetDelta));
+    }
+
+    for (auto allocation : commandContainer.getResidencyContainer()) {
+        auto &cmdBufferAllocations = commandContainer.getCmdBufferAllocations();
+        bool ownedAllocation = std::find(cmdBufferAllocations.begin(), cmdBufferAllocations.end(), allocation) != cmdBufferAllocations.end();
+        for (uint32_t i = 0; i < NEO::HeapType::NUM_TYPES; i++) {
+            ownedAllocation |= (allocation == commandContainer.getIndirectHeapAllocation(static_cast<NEO::HeapType>(i)));
+        }
+        if (!ownedAllocation) {
+            clonedContainer.addToResidencyContainer(allocation);
+        }
+    }
+    clonedContainer.removeDuplicatesFromResidencyContainer();
+
+    auto srcDsh = commandContainer.getIndirectHeap(NEO::HeapType::DYNAMIC_STATE);
+    auto dstDsh = clonedContainer.getIndirectHeap(NEO::HeapType::DYNAMIC_STATE);
+    if (commandContainer.getIddBlock() != nullptr) {
+        clonedContainer.setIddBlock(ptrOffset(dstDsh->getCpuBase(), ptrDiff(commandContainer.getIddBlock(), srcDsh->getCpuBase())));
+    }
+    clonedContainer.nextIddInBlock = commandContainer.nextIddInBlock;
+    clonedContainer.slmSize = commandContainer.slmSize;
+    clonedContainer.initialL3Config = commandContainer.initialL3Config;
+    clonedContainer.lastSentL3Config = commandContainer.lastSentL3Config;
+    clonedContainer.l3ConfigChangesCount = commandContainer.l3ConfigChangesCount;
+    clonedContainer.lastSentNumGrfRequired = commandContainer.lastSentNumGrfRequired;
+
+    commandList->commandListPerThreadScratchSize = commandListPerThreadScratchSize;
+    commandList->commandListPreemptionMode = commandListPreemptionMode;
+    commandList->unifiedMemoryControls = unifiedMemoryControls;
+    commandList->indirectAllocationsAllowed = indirectAllocationsAllowed;
+    commandList->containsStatelessUncachedResource = containsStatelessUncachedResource;
+    commandList->printfFunctionContainer = printfFunctionContainer;
+    commandList->counterBasedSignalEvents = counterBasedSignalEvents;
+    commandList->walkerCmdOffsets = walkerCmdOffsets;
+    commandList->closed = true;
+
+    // recorded launches of clone point to its own copies, so they are updated independently of this command list
+    auto rebase = [](void *ptr, const void *srcBase, void *dstBase) -> void * {
+        return ptr ? ptrOffset(dstBase, ptrDiff(ptr, srcBase)) : nullptr;
+    };
+    auto srcSsh = commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE);
+    auto dstSsh = clonedContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE);
+    commandList->mutableKernelLaunches = mutableKernelLaunches;
+    for (auto &launch : commandList->mutableKernelLaunches) {
+        launch.encodedData.walkerCmd = rebase(launch.encodedData.walkerCmd, srcStream->getCpuBase(), dstStream->getCpuBase());
+        launch.encodedData.crossThreadData = rebase(launch.encodedData.crossThreadData, srcIoh->getCpuBase(), dstIoh->getCpuBase());
+        launch.encodedData.surfaceStateHeapData = rebase(launch.encodedData.surfaceStateHeapData, srcSsh->getCpuBase(), dstSsh->getCpuBase());
+        for (auto recordedCmds : {&launch.waitEventsCmds, &launch.signalEventCmds}) {
+            recordedCmds->cmds = rebase(recordedCmds->cmds, recordedCmds->cmdBufferBase, dstStream->getCpuBase());
+            recordedCmds->cmdBufferBase = dstStream->getCpuBase();
+        }
+    }
+
+    clonedCommandList = commandList;
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
@@ -28,8 +28,7 @@ struct DeviceImp;
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 size_t CommandListCoreFamily<gfxCoreFamily>::getReserveSshSize() {
-    auto &helper = NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily);
-    return helper.getRenderSurfaceStateSize();
+    return NEO::HwHelperHw<GfxFamily>::get().getRenderSurfaceStateSize();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -41,8 +40,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
                                                                                bool isCooperative) {
     const auto kernel = Kernel::fromHandle(hKernel);
     UNRECOVERABLE_IF(kernel == nullptr);
+    lastKernelLaunch = {};
+    lastKernelLaunch.kernel = kernel;
     appendEventForProfiling(hEvent, true);
     const auto functionImmutableData = kernel->getImmutableData();
+    functionImmutableData->waitForUpload();
     auto perThreadScratchSize = std::max<std::uint32_t>(this->getCommandListPerThreadScratchSize(),
                                                         kernel->getImmutableData()->getDescriptor().kernelAttributes.perThreadScratchSize[0]);
 
@@ -113,7 +115,13 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
                                                  commandListPreemptionMode,
                                                  this->containsStatelessUncachedResource,
                                                  partitionCount,
-                                                 internalUsage);
+                                                 internalUsage,
+                                                 &lastKernelLaunch.encodedData);
+    lastKernelLaunch.requiresUncachedMocs = this->containsStatelessUncachedResource;
+    walkerCmdOffsets.push_back(ptrDiff(lastKernelLaunch.encodedData.walkerCmd, commandContainer.getCommandStream()->getCpuBase()));
+    // indirect dispatch stores group count into cross thread data by its GPU address
+    this->containsHeapAddressReferences |= isIndirect;
+    memcpy_s(lastKernelLaunch.groupSize, sizeof(lastKernelLaunch.groupSize), kernel->getGroupSize(), sizeof(lastKernelLaunch.groupSize));
 
     if (neoDevice->getDebugger()) {
         auto *ssh = commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE);
@@ -126,7 +134,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
                                                          debugSurface, neoDevice->getGmmHelper(), kernelImp->getKernelDescriptor().kernelAttributes.flags.useGlobalAtomics, 1u);
     }
 
+    lastKernelLaunch.signalEventCmds.begin(*commandContainer.getCommandStream());
     appendSignalEventPostWalker(hEvent);
+    lastKernelLaunch.signalEventCmds.end(*commandContainer.getCommandStream());
 
     commandContainer.addToResidencyContainer(functionImmutableData->getIsaGraphicsAllocation());
     auto &residencyContainer = kernel->getResidencyContainer();
@@ -16,11 +16,13 @@ struct Event;
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFamily> {
+    using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     using BaseClass = CommandListCoreFamily<gfxCoreFamily>;
-    using BaseClass::executeCommandListImmediate;
 
     using BaseClass::BaseClass;
 
+    static constexpr size_t minimalCmdBufferSpaceForFlushTask = NEO::CommandContainer::defaultListCmdBufferSize / 8;
+
     ze_result_t appendLaunchKernel(ze_kernel_handle_t hKernel,
                                    const ze_group_count_t *pThreadGroupDimensions,
                                    ze_event_handle_t hEvent, uint32_t numWaitEvents,
@@ -65,7 +67,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     ze_result_t appendEventReset(ze_event_handle_t hEvent) override;
 
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr,
-                                    size_t size, bool flushHost) override;
+                                    size_t offset, size_t size, bool flushHost) override;
 
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) override;
 
@@ -95,8 +97,24 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t executeCommandListImmediate(bool performMigration) override;
+    ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration);
+
   protected:
+    template <typename AppendT>
+    ze_result_t appendOnThreadCommandList(AppendT &&append) {
+        auto threadCommandList = this->getThreadCommandList();
+        if (threadCommandList == nullptr) {
+            return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        return append(*threadCommandList);
+    }
+
+    void makeResidentForFlushTask(NEO::CommandStreamReceiver &csr);
+    NEO::CompletionStamp flushTask(NEO::CommandStreamReceiver &csr, NEO::LinearStream &commandStream, size_t commandStreamStart);
+
     bool isSyncModeQueue = false;
+    size_t cmdListCurrentStartOffset = 0u;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
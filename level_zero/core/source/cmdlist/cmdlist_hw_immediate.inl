@@ -7,16 +7,178 @@
 
 #pragma once
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/csr_definitions.h"
+#include "shared/source/helpers/completion_stamp.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/kernel/kernel.h"
 
 namespace L0 {
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommandListImmediate(bool performMigration) {
+    if (this->isFlushTaskSubmissionEnabled) {
+        return executeCommandListImmediateWithFlushTask(performMigration);
+    }
+    return BaseClass::executeCommandListImmediate(performMigration);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommandListImmediateWithFlushTask(bool performMigration) {
+    using MI_BATCH_BUFFER_END = typename GfxFamily::MI_BATCH_BUFFER_END;
+
+    auto csr = static_cast<CommandQueueImp *>(this->cmdQImmediate)->getCsr();
+    auto commandStream = this->commandContainer.getCommandStream();
+    auto &cmdBufferAllocations = this->commandContainer.getCmdBufferAllocations();
+
+    if (performMigration) {
+        auto pageFaultManager = this->device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+        if (pageFaultManager) {
+            for (auto alloc : this->commandContainer.getResidencyContainer()) {
+                if (alloc && (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
+                              alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
+                    pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
+                }
+            }
+            DriverHandleImp *driverHandleImp = static_cast<DriverHandleImp *>(this->device->getDriverHandle());
+            std::lock_guard<std::mutex> lock(driverHandleImp->sharedMakeResidentAllocationsLock);
+            for (auto alloc : driverHandleImp->sharedMakeResidentAllocations) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc.second->getGpuAddress()));
+            }
+        }
+    }
+
+    this->initializePendingZeroAllocations();
+
+    auto lockCSR = csr->obtainUniqueOwnership();
+    csr->setRequiredScratchSizes(this->getCommandListPerThreadScratchSize(), 0u);
+
+    auto commandStreamStart = this->cmdListCurrentStartOffset;
+    if (cmdBufferAllocations.size() > 1) {
+        // append did not fit into command buffer it started in, submit its beginning first,
+        // replacing MI_BATCH_BUFFER_END programmed by encoder with ending of task
+        auto previousCmdBuffer = cmdBufferAllocations[cmdBufferAllocations.size() - 2];
+        NEO::LinearStream previousCommandStream(previousCmdBuffer);
+        previousCommandStream.getSpace(this->commandContainer.getPreviousCmdBufferUsedSize() - sizeof(MI_BATCH_BUFFER_END));
+        flushTask(*csr, previousCommandStream, commandStreamStart);
+        commandStreamStart = 0u;
+    }
+    auto completionStamp = flushTask(*csr, *commandStream, commandStreamStart);
+    for (auto event : this->counterBasedSignalEvents) {
+        event->assignCounter(*csr, completionStamp.taskCount);
+    }
+    this->counterBasedSignalEvents.clear();
+
+    this->commandContainer.getResidencyContainer().clear();
+    // command stream receiver programs L3 config of next flush from its useSLM, so changes are not encoded in list
+    this->commandContainer.lastSentL3Config = std::numeric_limits<uint32_t>::max();
+    this->commandContainer.storeCmdBuffersForReuse(completionStamp.taskCount);
+    if (commandStream->getAvailableSpace() < minimalCmdBufferSpaceForFlushTask) {
+        this->commandContainer.allocateNextCommandBuffer();
+        this->commandContainer.storeCmdBuffersForReuse(completionStamp.taskCount);
+    }
+    this->cmdListCurrentStartOffset = commandStream->getUsed();
+    lockCSR.unlock();
+
+    auto &printfFunctions = this->getPrintfFunctionContainer();
+    if (this->isSyncModeQueue || !printfFunctions.empty()) {
+        csr->waitForCompletionWithTimeout(false, 0, completionStamp.taskCount);
+        for (auto kernel : printfFunctions) {
+            kernel->printPrintfOutput();
+        }
+        printfFunctions.clear();
+        if (this->isSyncModeQueue) {
+            this->removeHostPtrAllocations();
+        }
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::makeResidentForFlushTask(NEO::CommandStreamReceiver &csr) {
+    // residency container holds only allocations used since previous flush, heaps are made resident by CSR
+    for (auto alloc : this->commandContainer.getResidencyContainer()) {
+        if (alloc) {
+            csr.makeResident(*alloc);
+        }
+    }
+    for (auto cmdBuffer : this->commandContainer.getCmdBufferAllocations()) {
+        csr.makeResident(*cmdBuffer);
+    }
+    if (this->hasIndirectAllocationsAllowed()) {
+        auto svmAllocsManager = this->device->getDriverHandle()->getSvmAllocsManager();
+        svmAllocsManager->makeInternalAllocationsResident(csr, this->getUnifiedMemoryControls().generateMask());
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+NEO::CompletionStamp CommandListCoreFamilyImmediate<gfxCoreFamily>::flushTask(NEO::CommandStreamReceiver &csr, NEO::LinearStream &commandStream, size_t commandStreamStart) {
+    auto neoDevice = this->device->getNEODevice();
+    auto &hwHelper = NEO::HwHelper::get(neoDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    uint32_t threadArbitrationPolicy = hwHelper.getDefaultThreadArbitrationPolicy();
+    if (NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get() != -1) {
+        threadArbitrationPolicy = static_cast<uint32_t>(NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get());
+    }
+    auto slmSize = this->commandContainer.slmSize;
+    bool useSlm = slmSize != 0u && slmSize != std::numeric_limits<uint32_t>::max();
+
+    NEO::DispatchFlags dispatchFlags(
+        {},                                                       //csrDependencies
+        nullptr,                                                  //barrierTimestampPacketNodes
+        {},                                                       //pipelineSelectArgs
+        nullptr,                                                  //flushStampReference
+        NEO::QueueThrottle::MEDIUM,                               //throttle
+        this->getCommandListPreemptionMode(),                     //preemptionMode
+        this->commandContainer.lastSentNumGrfRequired,            //numGrfRequired
+        NEO::L3CachingSettings::l3CacheOn,                        //l3CacheSettings
+        threadArbitrationPolicy,                                  //threadArbitrationPolicy
+        NEO::AdditionalKernelExecInfo::NotApplicable,             //additionalKernelExecInfo
+        NEO::KernelExecutionType::NotApplicable,                  //kernelExecutionType
+        NEO::MemoryCompressionState::NotApplicable,               //memoryCompressionState
+        NEO::QueueSliceCount::defaultSliceCount,                  //sliceCount
+        this->isSyncModeQueue,                                    //blocking
+        true,                                                     //dcFlush
+        useSlm,                                                   //useSLM
+        true,                                                     //guardCommandBufferWithPipeControl
+        false,                                                    //GSBA32BitRequired
+        false,                                                    //requiresCoherency
+        false,                                                    //lowPriority
+        true,                                                     //implicitFlush
+        false,                                                    //outOfOrderExecutionAllowed
+        false,                                                    //epilogueRequired
+        false,                                                    //usePerDssBackedBuffer
+        false,                                                    //useSingleSubdevice
+        this->commandContainer.lastSentUseGlobalAtomics,          //useGlobalAtomics
+        neoDevice->getNumAvailableDevices() > 1                   //areMultipleSubDevicesInContext
+    );
+    dispatchFlags.pipelineSelectArgs.specialPipelineSelectMode = this->commandContainer.lastPipelineSelectModeRequired;
+
+    makeResidentForFlushTask(csr);
+
+    return csr.flushTask(commandStream,
+                         commandStreamStart,
+                         *this->commandContainer.getIndirectHeap(NEO::HeapType::DYNAMIC_STATE),
+                         *this->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT),
+                         *this->commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE),
+                         csr.peekTaskLevel(),
+                         dispatchFlags,
+                         *neoDevice);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t hKernel, const ze_group_count_t *pThreadGroupDimensions,
     ze_event_handle_t hEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
-
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendLaunchKernel(hKernel, pThreadGroupDimensions, hEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(hKernel, pThreadGroupDimensions,
                                                                         hEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
@@ -28,7 +190,9 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t hKernel, const ze_group_count_t *pDispatchArgumentsBuffer,
     ze_event_handle_t hEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
-
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendLaunchKernelIndirect(hKernel, pDispatchArgumentsBuffer, hEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelIndirect(hKernel, pDispatchArgumentsBuffer,
                                                                                 hEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
@@ -42,16 +206,22 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents); });
+    }
     bool isTimestampEvent = false;
+    bool isCounterBasedEvent = false;
     for (uint32_t i = 0; i < numWaitEvents; i++) {
         auto event = Event::fromHandle(phWaitEvents[i]);
         isTimestampEvent |= (event->isTimestampEvent) ? true : false;
+        isCounterBasedEvent |= event->isCounterBased;
     }
     if (hSignalEvent) {
         auto signalEvent = Event::fromHandle(hSignalEvent);
         isTimestampEvent |= signalEvent->isTimestampEvent;
+        isCounterBasedEvent |= signalEvent->isCounterBased;
     }
-    if (isSyncModeQueue || isTimestampEvent) {
+    if (isSyncModeQueue || isTimestampEvent || isCounterBasedEvent) {
         auto ret = CommandListCoreFamily<gfxCoreFamily>::appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents);
         if (ret == ZE_RESULT_SUCCESS) {
             executeCommandListImmediate(true);
@@ -79,7 +249,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, hSignalEvent,
                                                                       numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
@@ -100,7 +272,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch, srcPtr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch,
                                                                             srcPtr, srcRegion, srcPitch, srcSlicePitch,
                                                                             hSignalEvent, numWaitEvents, phWaitEvents);
@@ -116,6 +290,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents) {
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
         executeCommandListImmediate(true);
@@ -125,8 +302,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hEvent) {
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendSignalEvent(hEvent); });
+    }
     auto event = Event::fromHandle(hEvent);
-    if (isSyncModeQueue || event->isTimestampEvent) {
+    if (isSyncModeQueue || event->isTimestampEvent || event->isCounterBased) {
         auto ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hEvent);
         if (ret == ZE_RESULT_SUCCESS) {
             executeCommandListImmediate(true);
@@ -145,7 +325,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendEventReset(hEvent); });
+    }
     auto event = Event::fromHandle(hEvent);
+    if (event->isCounterBased) {
+        return ZE_RESULT_SUCCESS;
+    }
     if (isSyncModeQueue || event->isTimestampEvent) {
         auto ret = CommandListCoreFamily<gfxCoreFamily>::appendEventReset(hEvent);
         if (ret == ZE_RESULT_SUCCESS) {
@@ -164,8 +350,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) {
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstptr, srcptr, size, flushHost);
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) {
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendPageFaultCopy(dstptr, srcptr, offset, size, flushHost); });
+    }
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstptr, srcptr, offset, size, flushHost);
     if (ret == ZE_RESULT_SUCCESS) {
         executeCommandListImmediate(false);
     }
@@ -174,12 +363,17 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) {
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendWaitOnEvents(numEvents, phEvent); });
+    }
     bool isTimestampEvent = false;
+    bool isCounterBasedEvent = false;
     for (uint32_t i = 0; i < numEvents; i++) {
         auto event = Event::fromHandle(phEvent[i]);
         isTimestampEvent |= (event->isTimestampEvent) ? true : false;
+        isCounterBasedEvent |= event->isCounterBased;
     }
-    if (isSyncModeQueue || isTimestampEvent) {
+    if (isSyncModeQueue || isTimestampEvent || isCounterBasedEvent) {
         auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(numEvents, phEvent);
         if (ret == ZE_RESULT_SUCCESS) {
             executeCommandListImmediate(true);
@@ -211,6 +405,9 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
         executeCommandListImmediate(true);
@@ -234,7 +431,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hEvent,
                                                                                numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
@@ -251,7 +450,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-
+    if (this->concurrentAppendsAllowed) {
+        return appendOnThreadCommandList([&](CommandList &commandList) { return commandList.appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hEvent, numWaitEvents, phWaitEvents); });
+    }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hEvent,
                                                                              numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
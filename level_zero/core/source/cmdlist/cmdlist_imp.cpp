@@ -9,10 +9,14 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/tools/source/metrics/metric.h"
@@ -115,10 +119,57 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
         commandList->cmdListType = CommandListType::TYPE_IMMEDIATE;
         commandList->commandListPreemptionMode = device->getDevicePreemptionMode();
         commandList->setSyncModeQueue(desc->mode == ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS);
+        commandList->isFlushTaskSubmissionEnabled = NEO::DebugManager.flags.EnableFlushTaskSubmission.get() == 1 &&
+                                                    !commandList->isCopyOnly() &&
+                                                    !NEO::ApiSpecificConfig::getBindlessConfiguration();
+        if (commandList->isFlushTaskSubmissionEnabled) {
+            commandList->commandContainer.setImmediateCmdListCsr(csr);
+        }
+        if (!internalUsage && isConcurrentAppendsDesc(desc)) {
+            commandList->concurrentAppendsAllowed = true;
+            commandList->threadCommandListDesc = *desc;
+            commandList->threadCommandListDesc.pNext = nullptr;
+        }
         return commandList;
     }
 
     return commandList;
 }
 
+bool CommandList::isConcurrentAppendsDesc(const ze_command_queue_desc_t *desc) {
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        if (extendedDesc->stype == ZE_STRUCTURE_TYPE_COMMAND_LIST_CONCURRENT_APPENDS_EXP_DESC) {
+            return true;
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+    return false;
+}
+
+CommandList *CommandList::getThreadCommandList() {
+    std::lock_guard<std::mutex> lock(threadCommandListsMutex);
+    auto threadId = std::this_thread::get_id();
+    auto threadCommandList = threadCommandLists.find(threadId);
+    if (threadCommandList != threadCommandLists.end()) {
+        return threadCommandList->second;
+    }
+
+    // command list of thread uses the same engine, its submissions are ordered with submissions of other threads by CSR
+    ze_command_queue_throttle_exp_desc_t throttleDesc = {};
+    throttleDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_THROTTLE_EXP_DESC;
+    throttleDesc.throttle = static_cast<ze_command_queue_throttle_exp_t>(static_cast<CommandQueueImp *>(cmdQImmediate)->getThrottle());
+    auto desc = threadCommandListDesc;
+    desc.pNext = &throttleDesc;
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto commandList = CommandList::createImmediate(device->getHwInfo().platform.eProductFamily, device, &desc,
+                                                    internalUsage, engineGroupType, returnValue);
+    if (commandList == nullptr) {
+        return nullptr;
+    }
+    threadCommandLists[threadId] = commandList;
+    return commandList;
+}
+
 } // namespace L0
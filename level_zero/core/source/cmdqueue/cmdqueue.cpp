@@ -10,7 +10,10 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/runtime_tracer.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device.h"
@@ -59,7 +62,7 @@ void CommandQueueImp::submitBatchBuffer(size_t offset, NEO::ResidencyContainer &
     UNRECOVERABLE_IF(csr == nullptr);
 
     NEO::BatchBuffer batchBuffer(commandStream->getGraphicsAllocation(), offset, 0u, nullptr, false, false,
-                                 NEO::QueueThrottle::HIGH, NEO::QueueSliceCount::defaultSliceCount,
+                                 throttle, NEO::QueueSliceCount::defaultSliceCount,
                                  commandStream->getUsed(), commandStream, endingCmdPtr, false);
 
     csr->submitBatchBuffer(batchBuffer, residencyContainer);
@@ -67,9 +70,33 @@ void CommandQueueImp::submitBatchBuffer(size_t offset, NEO::ResidencyContainer &
 }
 
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
+    RUNTIME_TRACE_SCOPE("synchronize");
     return synchronizeByPollingForTaskCount(timeout);
 }
 
+ze_result_t CommandQueueImp::exportSyncFile(int *pSyncFileFd) {
+    int32_t syncFileFd = -1;
+    if (!csr->exportSubmissionSyncFile(syncFileFd)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    *pSyncFileFd = syncFileFd;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t CommandQueueImp::importSyncFile(int syncFileFd) {
+    if (!csr->importSyncFileForNextSubmission(syncFileFd)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t CommandQueueImp::getPriorityHonored(ze_bool_t *pHonored) {
+    auto &osContext = csr->getOsContext();
+    osContext.ensureContextInitialized();
+    *pHonored = osContext.isPriorityHonored();
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t CommandQueueImp::synchronizeByPollingForTaskCount(uint64_t timeout) {
     UNRECOVERABLE_IF(csr == nullptr);
 
@@ -81,7 +108,20 @@ ze_result_t CommandQueueImp::synchronizeByPollingForTaskCount(uint64_t timeout)
         timeoutMicroseconds = NEO::TimeoutControls::maxTimeout;
     }
 
-    csr->waitForCompletionWithTimeout(enableTimeout, timeoutMicroseconds, this->taskCount);
+    bool activeCompletionWaiter = false;
+    bool waitCoalesced = !enableTimeout && NEO::DebugManager.flags.CoalesceCompletionWaits.get() == 1 &&
+                         csr->joinCompletionWait(taskCountToWait, activeCompletionWaiter);
+    if (!waitCoalesced) {
+        auto throttlePolicy = NEO::QueueThrottlePolicy::get(throttle);
+        if (enableTimeout || throttlePolicy.pollingWait) {
+            csr->waitForCompletionWithTimeout(enableTimeout, timeoutMicroseconds, this->taskCount);
+        } else {
+            csr->waitForTaskCountWithKmdNotifyFallback(this->taskCount, csr->obtainCurrentFlushStamp(), false, throttlePolicy.powerSavingWait);
+        }
+    }
+    if (activeCompletionWaiter) {
+        csr->leaveCompletionWait();
+    }
 
     if (*csr->getTagAddress() < taskCountToWait) {
         return ZE_RESULT_NOT_READY;
@@ -125,6 +165,24 @@ CommandQueue *CommandQueue::create(uint32_t productFamily, Device *device, NEO::
     return commandQueue;
 }
 
+NEO::QueueThrottle CommandQueueImp::getThrottleFromDesc(const ze_command_queue_desc_t *desc) {
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        if (extendedDesc->stype == ZE_STRUCTURE_TYPE_COMMAND_QUEUE_THROTTLE_EXP_DESC) {
+            switch (reinterpret_cast<const ze_command_queue_throttle_exp_desc_t *>(extendedDesc)->throttle) {
+            case ZE_COMMAND_QUEUE_THROTTLE_EXP_LOW:
+                return NEO::QueueThrottle::LOW;
+            case ZE_COMMAND_QUEUE_THROTTLE_EXP_MEDIUM:
+                return NEO::QueueThrottle::MEDIUM;
+            default:
+                return NEO::QueueThrottle::HIGH;
+            }
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+    return NEO::QueueThrottle::HIGH;
+}
+
 ze_command_queue_mode_t CommandQueueImp::getSynchronousMode() {
     return desc.mode;
 }
@@ -39,6 +39,9 @@ struct CommandQueue : _ze_command_queue_handle_t {
                                         void *phCommands,
                                         ze_fence_handle_t hFence) = 0;
     virtual ze_result_t synchronize(uint64_t timeout) = 0;
+    virtual ze_result_t exportSyncFile(int *pSyncFileFd) = 0;
+    virtual ze_result_t importSyncFile(int syncFileFd) = 0;
+    virtual ze_result_t getPriorityHonored(ze_bool_t *pHonored) = 0;
 
     static CommandQueue *create(uint32_t productFamily, Device *device, NEO::CommandStreamReceiver *csr,
                                 const ze_command_queue_desc_t *desc, bool isCopyOnly, bool isInternal, ze_result_t &resultValue);
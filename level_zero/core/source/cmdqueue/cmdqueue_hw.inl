@@ -15,6 +15,7 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/device/device.h"
+#include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/preamble.h"
@@ -23,6 +24,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/runtime_tracer.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
@@ -30,6 +32,7 @@
 #include "level_zero/core/source/cmdqueue/cmdqueue_hw.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/fence/fence.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
@@ -65,6 +68,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     ze_command_list_handle_t *phCommandLists,
     ze_fence_handle_t hFence,
     bool performMigration) {
+    RUNTIME_TRACE_SCOPE("executeCommandLists");
 
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
@@ -72,6 +76,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     using PIPE_CONTROL = typename GfxFamily::PIPE_CONTROL;
     using POST_SYNC_OPERATION = typename PIPE_CONTROL::POST_SYNC_OPERATION;
+    using MI_LOAD_REGISTER_IMM = typename GfxFamily::MI_LOAD_REGISTER_IMM;
 
     auto lockCSR = csr->obtainUniqueOwnership();
 
@@ -94,7 +99,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     const bool initialPreemptionMode = commandQueuePreemptionMode == NEO::PreemptionMode::Initial;
     NEO::PreemptionMode cmdQueuePreemption = commandQueuePreemptionMode;
     if (initialPreemptionMode) {
-        cmdQueuePreemption = devicePreemption;
+        cmdQueuePreemption = NEO::PreemptionHelper::limitToContextPreemptionMode(devicePreemption, csr->getOsContext().getPreemptionMode());
     }
     NEO::PreemptionMode statePreemption = cmdQueuePreemption;
 
@@ -126,6 +131,8 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     device->activateMetricGroups();
 
     size_t totalCmdBuffers = 0;
+    size_t l3ConfigSize = 0;
+    auto l3Config = csr->peekLastSentL3Config();
     uint32_t perThreadScratchSpaceSize = 0;
     for (auto i = 0u; i < numCommandLists; i++) {
         auto commandList = CommandList::fromHandle(phCommandLists[i]);
@@ -135,14 +142,28 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             UnifiedMemoryControls unifiedMemoryControls = commandList->getUnifiedMemoryControls();
 
             auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
-            svmAllocsManager->addInternalAllocationsToResidencyContainer(neoDevice->getRootDeviceIndex(),
-                                                                         commandList->commandContainer.getResidencyContainer(),
-                                                                         unifiedMemoryControls.generateMask());
+            auto requestedTypesMask = unifiedMemoryControls.generateMask();
+            // a closed list needs a rescan only after allocations of one of requested memory types were created or freed
+            auto allocationsVersion = svmAllocsManager->getInternalAllocationsGeneration(requestedTypesMask);
+            if (!commandList->isInternalAllocationsResidencyCached(allocationsVersion, requestedTypesMask)) {
+                svmAllocsManager->addInternalAllocationsToResidencyContainer(neoDevice->getRootDeviceIndex(),
+                                                                             commandList->commandContainer.getResidencyContainer(),
+                                                                             requestedTypesMask);
+                commandList->cacheInternalAllocationsResidency(allocationsVersion, requestedTypesMask);
+            }
         }
 
+        commandList->initializePendingZeroAllocations();
+
         totalCmdBuffers += commandList->commandContainer.getCmdBufferAllocations().size();
+        if (commandList->commandContainer.initialL3Config != std::numeric_limits<uint32_t>::max()) {
+            if (commandList->commandContainer.initialL3Config != l3Config) {
+                l3ConfigSize += sizeof(PIPE_CONTROL) + sizeof(MI_LOAD_REGISTER_IMM);
+            }
+            l3Config = commandList->commandContainer.lastSentL3Config;
+        }
         spaceForResidency += commandList->commandContainer.getResidencyContainer().size();
-        auto commandListPreemption = commandList->getCommandListPreemptionMode();
+        auto commandListPreemption = NEO::PreemptionHelper::limitToContextPreemptionMode(commandList->getCommandListPreemptionMode(), csr->getOsContext().getPreemptionMode());
         if (statePreemption != commandListPreemption) {
             if (preemptionCmdSyncProgramming) {
                 preemptionSize += NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForSinglePipeControl();
@@ -209,7 +230,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             linearStreamSizeEstimate += estimateStateBaseAddressCmdSize();
         }
 
-        linearStreamSizeEstimate += preemptionSize + debuggerCmdsSize;
+        linearStreamSizeEstimate += preemptionSize + debuggerCmdsSize + l3ConfigSize;
     }
 
     if (NEO::DebugManager.flags.EnableSWTags.get()) {
@@ -264,6 +285,16 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             programStateBaseAddress(scratchSpaceController->calculateNewGSH(), indirectHeap->getGraphicsAllocation()->isAllocatedInLocalMemoryPool(), child);
         }
 
+        if (auto pageTableManager = neoDevice->getRootDeviceEnvironment().pageTableManager.get()) {
+            auto auxTableUpdated = pageTableManager->flushPendingAuxTableUpdates();
+            DEBUG_BREAK_IF(!auxTableUpdated);
+        }
+
+        if (devicePreemption == NEO::PreemptionMode::MidThread) {
+            auto preemptionAllocationCreated = csr->ensurePreemptionAllocationCreated();
+            UNRECOVERABLE_IF(!preemptionAllocationCreated);
+        }
+
         if (initialPreemptionMode) {
             NEO::PreemptionHelper::programCsrBaseAddress<GfxFamily>(child, *neoDevice, csr->getPreemptionAllocation());
         }
@@ -307,12 +338,37 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
         }
     }
 
+    // stamp allocations already added so merging command list residency is linear instead of quadratic
+    auto submissionStamp = csr->obtainNextSubmissionStamp();
+    auto contextId = csr->getOsContext().getContextId();
+    for (auto alloc : residencyContainer) {
+        if (alloc) {
+            alloc->setSubmissionStamp(submissionStamp, contextId);
+        }
+    }
+
+    l3ConfigChangesCount = 0;
     for (auto i = 0u; i < numCommandLists; ++i) {
         auto commandList = CommandList::fromHandle(phCommandLists[i]);
         auto cmdBufferAllocations = commandList->commandContainer.getCmdBufferAllocations();
         auto cmdBufferCount = cmdBufferAllocations.size();
 
-        auto commandListPreemption = commandList->getCommandListPreemptionMode();
+        // L3 config of command list's first kernel is programmed here only when it differs from config left by previous submission
+        auto &commandContainer = commandList->commandContainer;
+        if (!isCopyOnlyCommandQueue && commandContainer.initialL3Config != std::numeric_limits<uint32_t>::max()) {
+            if (commandContainer.initialL3Config != csr->peekLastSentL3Config()) {
+                PIPE_CONTROL cmd = GfxFamily::cmdInitPipeControl;
+                cmd.setCommandStreamerStallEnable(true);
+                cmd.setDcFlushEnable(true);
+                *child.getSpaceForCmd<PIPE_CONTROL>() = cmd;
+                NEO::PreambleHelper<GfxFamily>::programL3(&child, commandContainer.initialL3Config);
+                l3ConfigChangesCount++;
+            }
+            csr->setLastSentL3Config(commandContainer.lastSentL3Config);
+            l3ConfigChangesCount += commandContainer.l3ConfigChangesCount;
+        }
+
+        auto commandListPreemption = NEO::PreemptionHelper::limitToContextPreemptionMode(commandList->getCommandListPreemptionMode(), csr->getOsContext().getPreemptionMode());
         if (statePreemption != commandListPreemption) {
             if (NEO::DebugManager.flags.EnableSWTags.get()) {
                 neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::PipeControlReasonTag>(
@@ -342,16 +398,16 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
                                        commandList->getPrintfFunctionContainer().end());
 
         for (auto alloc : commandList->commandContainer.getResidencyContainer()) {
-            if (residencyContainer.end() ==
-                std::find(residencyContainer.begin(), residencyContainer.end(), alloc)) {
-                residencyContainer.push_back(alloc);
-
-                if (performMigration) {
-                    if (alloc &&
-                        (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
-                         alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
-                        pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
-                    }
+            if (alloc == nullptr || alloc->getSubmissionStamp(contextId) == submissionStamp) {
+                continue;
+            }
+            alloc->setSubmissionStamp(submissionStamp, contextId);
+            residencyContainer.push_back(alloc);
+
+            if (performMigration) {
+                if (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
+                    alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU) {
+                    pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
                 }
             }
         }
@@ -407,6 +463,12 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     submitBatchBuffer(ptrDiff(child.getCpuBase(), commandStream->getCpuBase()), residencyContainer, endingCmd);
 
     this->taskCount = csr->peekTaskCount();
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        for (auto event : commandList->getCounterBasedSignalEvents()) {
+            event->assignCounter(*csr, this->taskCount);
+        }
+    }
 
     csr->makeSurfacePackNonResident(residencyContainer);
 
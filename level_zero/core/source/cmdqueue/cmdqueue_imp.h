@@ -61,23 +61,32 @@ struct CommandQueueImp : public CommandQueue {
 
     CommandQueueImp() = delete;
     CommandQueueImp(Device *device, NEO::CommandStreamReceiver *csr, const ze_command_queue_desc_t *desc)
-        : device(device), csr(csr), desc(*desc) {
+        : device(device), csr(csr), desc(*desc), throttle(getThrottleFromDesc(desc)) {
     }
 
     ze_result_t destroy() override;
 
     ze_result_t synchronize(uint64_t timeout) override;
 
+    ze_result_t exportSyncFile(int *pSyncFileFd) override;
+    ze_result_t importSyncFile(int syncFileFd) override;
+    ze_result_t getPriorityHonored(ze_bool_t *pHonored) override;
+
     ze_result_t initialize(bool copyOnly, bool isInternal);
 
     Device *getDevice() { return device; }
 
     uint32_t getTaskCount() { return taskCount; }
 
+    // number of L3 reconfigurations programmed by last execution, including ones inside executed command lists
+    uint32_t getL3ConfigChangesCount() const { return l3ConfigChangesCount; }
+
     NEO::CommandStreamReceiver *getCsr() { return csr; }
 
     void reserveLinearStreamSize(size_t size);
     ze_command_queue_mode_t getSynchronousMode();
+    NEO::QueueThrottle getThrottle() const { return throttle; }
+    static NEO::QueueThrottle getThrottleFromDesc(const ze_command_queue_desc_t *desc);
     virtual void dispatchTaskCountWrite(NEO::LinearStream &commandStream, bool flushDataCache) = 0;
     virtual bool getPreemptionCmdProgramming() = 0;
 
@@ -91,8 +100,10 @@ struct CommandQueueImp : public CommandQueue {
     Device *device = nullptr;
     NEO::CommandStreamReceiver *csr = nullptr;
     const ze_command_queue_desc_t desc;
+    const NEO::QueueThrottle throttle;
     NEO::LinearStream *commandStream = nullptr;
     std::atomic<uint32_t> taskCount{0};
+    uint32_t l3ConfigChangesCount = 0;
     std::vector<Kernel *> printfFunctionContainer;
     bool gpgpuEnabled = false;
     CommandBufferManager buffers;
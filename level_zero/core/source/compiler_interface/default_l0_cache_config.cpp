@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,7 +25,20 @@ NEO::CompilerCacheConfig getDefaultL0CompilerCacheConfig() {
     std::unique_ptr<NEO::SettingsReader> settingsReader(NEO::SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(L0_CACHE_LOCATION));
 
+    std::string sizeKeyName = registryPath;
+    sizeKeyName += "l0_c_cache_size";
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(sizeKeyName), static_cast<int64_t>(NEO::defaultCompilerCacheSize)));
+
     ret.cacheFileExtension = ".l0_c_cache";
+    ret.memoryCacheEnabled = true;
+
+    std::string sharedDirKeyName = registryPath;
+    sharedDirKeyName += "l0_c_cache_shared_dir";
+    ret.sharedCacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(sharedDirKeyName), std::string(""));
+
+    std::string sharedSizeKeyName = registryPath;
+    sharedSizeKeyName += "l0_c_cache_shared_size";
+    ret.sharedCacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(sharedSizeKeyName), static_cast<int64_t>(NEO::defaultCompilerSharedCacheSize)));
 
     return ret;
 }
@@ -15,6 +15,8 @@ struct _ze_context_handle_t {
     virtual ~_ze_context_handle_t() = default;
 };
 
+struct _ze_physical_mem_handle_t {};
+
 namespace L0 {
 struct DriverHandle;
 
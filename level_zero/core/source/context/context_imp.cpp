@@ -7,6 +7,10 @@
 
 #include "level_zero/core/source/context/context_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
@@ -15,9 +19,13 @@
 #include "level_zero/core/source/image/image.h"
 #include "level_zero/core/source/memory/memory_operations_helper.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 ze_result_t ContextImp::destroy() {
+    releaseImportedIpcHandles();
+    releaseVirtualMemory();
     delete this;
 
     return ZE_RESULT_SUCCESS;
@@ -93,6 +101,23 @@ bool ContextImp::isDeviceDefinedForThisContext(Device *inDevice) {
     return (this->getDevices().find(inDevice->toHandle()) != this->getDevices().end());
 }
 
+ze_result_t ContextImp::getCacheRegion(const ze_cache_region_exp_desc_t *cacheRegionDesc, const NEO::HardwareInfo &hwInfo, uint32_t &cacheRegion) {
+    switch (cacheRegionDesc->region) {
+    case ZE_CACHE_REGION_EXP_DEFAULT:
+        cacheRegion = 0u;
+        return ZE_RESULT_SUCCESS;
+    case ZE_CACHE_REGION_EXP_RESERVED:
+        // region 0 is default one, so at least one more region is needed for reservation
+        if (NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily).getNumCacheRegions(hwInfo) <= 1) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        cacheRegion = 1u;
+        return ZE_RESULT_SUCCESS;
+    default:
+        return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+}
+
 ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
                                        const ze_device_mem_alloc_desc_t *deviceDesc,
                                        size_t size,
@@ -103,6 +128,8 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
     }
 
     bool relaxedSizeAllowed = false;
+    bool zeroInitRequested = false;
+    uint32_t cacheRegion = 0u;
     if (deviceDesc->pNext) {
         const ze_base_desc_t *extendedDesc = reinterpret_cast<const ze_base_desc_t *>(deviceDesc->pNext);
         if (extendedDesc->stype == ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC) {
@@ -133,6 +160,13 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
                 return ZE_RESULT_ERROR_INVALID_ARGUMENT;
             }
             relaxedSizeAllowed = true;
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_CACHE_REGION_EXP_DESC) {
+            auto result = getCacheRegion(reinterpret_cast<const ze_cache_region_exp_desc_t *>(extendedDesc), Device::fromHandle(hDevice)->getHwInfo(), cacheRegion);
+            if (result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_ZERO_INIT_EXP_DESC) {
+            zeroInitRequested = true;
         }
     }
 
@@ -150,6 +184,7 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
 
     NEO::SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, this->driverHandle->rootDeviceIndices, deviceBitfields);
     unifiedMemoryProperties.allocationFlags.flags.shareable = 1u;
+    unifiedMemoryProperties.allocationFlags.cacheRegion = cacheRegion;
     unifiedMemoryProperties.device = neoDevice;
 
     if (deviceDesc->flags & ZE_DEVICE_MEM_ALLOC_FLAG_BIAS_UNCACHED) {
@@ -161,6 +196,13 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
     if (usmPtr == nullptr) {
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
+    if (zeroInitRequested) {
+        for (auto allocation : this->driverHandle->svmAllocsManager->getSVMAlloc(usmPtr)->gpuAllocations.getGraphicsAllocations()) {
+            if (allocation) {
+                allocation->setZeroInitPending(true);
+            }
+        }
+    }
     *ptr = usmPtr;
 
     return ZE_RESULT_SUCCESS;
@@ -173,6 +215,7 @@ ze_result_t ContextImp::allocSharedMem(ze_device_handle_t hDevice,
                                        size_t alignment,
                                        void **ptr) {
     bool relaxedSizeAllowed = false;
+    const ze_cache_region_exp_desc_t *cacheRegionDesc = nullptr;
     if (deviceDesc->pNext) {
         const ze_base_desc_t *extendedDesc = reinterpret_cast<const ze_base_desc_t *>(deviceDesc->pNext);
         if (extendedDesc->stype == ZE_STRUCTURE_TYPE_RELAXED_ALLOCATION_LIMITS_EXP_DESC) {
@@ -182,6 +225,8 @@ ze_result_t ContextImp::allocSharedMem(ze_device_handle_t hDevice,
                 return ZE_RESULT_ERROR_INVALID_ARGUMENT;
             }
             relaxedSizeAllowed = true;
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_CACHE_REGION_EXP_DESC) {
+            cacheRegionDesc = reinterpret_cast<const ze_cache_region_exp_desc_t *>(extendedDesc);
         }
     }
 
@@ -211,6 +256,13 @@ ze_result_t ContextImp::allocSharedMem(ze_device_handle_t hDevice,
                                                                            deviceBitfields);
     unifiedMemoryProperties.device = unifiedMemoryPropertiesDevice;
 
+    if (cacheRegionDesc) {
+        auto result = getCacheRegion(cacheRegionDesc, neoDevice->getHardwareInfo(), unifiedMemoryProperties.allocationFlags.cacheRegion);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
     if (deviceDesc->flags & ZE_DEVICE_MEM_ALLOC_FLAG_BIAS_UNCACHED) {
         unifiedMemoryProperties.allocationFlags.flags.locallyUncachedResource = 1;
     }
@@ -234,6 +286,14 @@ ze_result_t ContextImp::freeMem(const void *ptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+        if (findVirtualMemoryReservation(ptr, 1u) != nullptr) {
+            // physical memory mapped into a reserved range is released with zePhysicalMemDestroy
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
     for (auto pairDevice : this->devices) {
         DeviceImp *deviceImp = static_cast<DeviceImp *>(pairDevice.second);
 
@@ -332,11 +392,11 @@ ze_result_t ContextImp::getMemAddressRange(const void *ptr,
         alloc = allocData->gpuAllocations.getDefaultGraphicsAllocation();
         if (pBase) {
             uint64_t *allocBase = reinterpret_cast<uint64_t *>(pBase);
-            *allocBase = alloc->getGpuAddress();
+            *allocBase = allocData->getBaseGpuAddress();
         }
 
         if (pSize) {
-            *pSize = alloc->getUnderlyingBufferSize();
+            *pSize = allocData->usmPool ? allocData->size : alloc->getUnderlyingBufferSize();
         }
 
         return ZE_RESULT_SUCCESS;
@@ -346,6 +406,21 @@ ze_result_t ContextImp::getMemAddressRange(const void *ptr,
 }
 
 ze_result_t ContextImp::closeIpcMemHandle(const void *ptr) {
+    {
+        std::lock_guard<std::mutex> lock(importedIpcHandlesMutex);
+        auto importedHandle = std::find_if(importedIpcHandles.begin(), importedIpcHandles.end(),
+                                           [&ptr](const ImportedIpcHandle &entry) { return entry.ptr == ptr; });
+        if (importedHandle != importedIpcHandles.end()) {
+            if (importedHandle->openCount == 0u) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            importedHandle->openCount--;
+            if (importedHandle->openCount > 0u || NEO::DebugManager.flags.EnableIpcImportCache.get() == 1) {
+                return ZE_RESULT_SUCCESS;
+            }
+            importedIpcHandles.erase(importedHandle);
+        }
+    }
     return this->freeMem(ptr);
 }
 
@@ -353,6 +428,9 @@ ze_result_t ContextImp::getIpcMemHandle(const void *ptr,
                                         ze_ipc_mem_handle_t *pIpcHandle) {
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
+        if (allocData->usmPool) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
         uint64_t handle = allocData->gpuAllocations.getDefaultGraphicsAllocation()->peekInternalHandle(this->driverHandle->getMemoryManager());
         memcpy_s(reinterpret_cast<void *>(pIpcHandle->data),
                  sizeof(ze_ipc_mem_handle_t),
@@ -374,10 +452,38 @@ ze_result_t ContextImp::openIpcMemHandle(ze_device_handle_t hDevice,
              reinterpret_cast<void *>(pIpcHandle.data),
              sizeof(handle));
 
+    // handle value may be reused by exporter for other buffer, so imports are matched by buffer identity
+    auto bufferId = this->driverHandle->getMemoryManager()->getSharedHandleIdentity(static_cast<NEO::osHandle>(handle));
+    if (bufferId == 0u) {
+        *ptr = this->driverHandle->importFdHandle(hDevice, flags, handle, nullptr);
+        return (nullptr == *ptr) ? ZE_RESULT_ERROR_INVALID_ARGUMENT : ZE_RESULT_SUCCESS;
+    }
+
+    auto rootDeviceIndex = Device::fromHandle(hDevice)->getRootDeviceIndex();
+    std::lock_guard<std::mutex> lock(importedIpcHandlesMutex);
+    for (auto importedHandle = importedIpcHandles.begin(); importedHandle != importedIpcHandles.end();) {
+        if (importedHandle->rootDeviceIndex != rootDeviceIndex || importedHandle->handle != handle || importedHandle->flags != flags) {
+            ++importedHandle;
+            continue;
+        }
+        if (importedHandle->bufferId == bufferId) {
+            importedHandle->openCount++;
+            *ptr = importedHandle->ptr;
+            return ZE_RESULT_SUCCESS;
+        }
+        if (importedHandle->openCount == 0u) {
+            this->freeMem(importedHandle->ptr);
+            importedHandle = importedIpcHandles.erase(importedHandle);
+            continue;
+        }
+        ++importedHandle;
+    }
+
     *ptr = this->driverHandle->importFdHandle(hDevice, flags, handle, nullptr);
     if (nullptr == *ptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    importedIpcHandles.push_back({rootDeviceIndex, handle, bufferId, flags, *ptr, 1u});
 
     return ZE_RESULT_SUCCESS;
 }
@@ -418,6 +524,19 @@ ze_result_t ContextImp::getMemAllocProperties(const void *ptr,
             }
             uint64_t handle = alloc->gpuAllocations.getDefaultGraphicsAllocation()->peekInternalHandle(this->driverHandle->getMemoryManager());
             extendedMemoryExportProperties->fd = static_cast<int>(handle);
+        } else if (extendedProperties->stype == ZE_STRUCTURE_TYPE_MEMORY_DMA_BUF_EXPORT_EXP_PROPERTIES) {
+            ze_memory_dma_buf_export_exp_properties_t *dmaBufExportProperties =
+                reinterpret_cast<ze_memory_dma_buf_export_exp_properties_t *>(extendedProperties);
+            if (pMemAllocProperties->type != ZE_MEMORY_TYPE_DEVICE) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            auto allocation = alloc->gpuAllocations.getDefaultGraphicsAllocation();
+            auto fd = allocation->peekDmaBufFd(this->driverHandle->getMemoryManager());
+            if (fd < 0) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            dmaBufExportProperties->fd = fd;
+            dmaBufExportProperties->offset = static_cast<size_t>(castToUint64(ptr) - allocation->getGpuAddress());
         }
     }
 
@@ -464,28 +583,93 @@ ze_result_t ContextImp::activateMetricGroups(zet_device_handle_t hDevice,
 ze_result_t ContextImp::reserveVirtualMem(const void *pStart,
                                           size_t size,
                                           void **pptr) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    if (size == 0u || !isAligned(size, MemoryConstants::pageSize64k)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+    }
+
+    // start address is only a hint, reservation is placed wherever the GPU address space has room
+    auto rootDeviceIndex = *this->rootDeviceIndices.begin();
+    auto addressRange = this->driverHandle->getMemoryManager()->reserveGpuAddress(size, rootDeviceIndex);
+    if (addressRange.address == 0u) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    auto ptr = reinterpret_cast<void *>(addressRange.address);
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    auto &reservation = virtualMemoryReservations[ptr];
+    reservation.addressRange = addressRange;
+    reservation.rootDeviceIndex = rootDeviceIndex;
+    *pptr = ptr;
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::freeVirtualMem(const void *ptr,
                                        size_t size) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    auto reservation = virtualMemoryReservations.find(ptr);
+    if (reservation == virtualMemoryReservations.end() || reservation->second.addressRange.size != size) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (!reservation->second.mappings.empty()) {
+        return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    }
+
+    this->driverHandle->getMemoryManager()->freeGpuAddress(reservation->second.addressRange, reservation->second.rootDeviceIndex);
+    virtualMemoryReservations.erase(reservation);
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::queryVirtualMemPageSize(ze_device_handle_t hDevice,
                                                 size_t size,
                                                 size_t *pagesize) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    *pagesize = MemoryConstants::pageSize64k;
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::createPhysicalMem(ze_device_handle_t hDevice,
                                           ze_physical_mem_desc_t *desc,
                                           ze_physical_mem_handle_t *phPhysicalMemory) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    auto device = Device::fromHandle(hDevice);
+    if (isDeviceDefinedForThisContext(device) == false) {
+        return ZE_RESULT_ERROR_DEVICE_LOST;
+    }
+    if (desc->size == 0u || !isAligned(desc->size, MemoryConstants::pageSize64k)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+    }
+
+    auto neoDevice = device->getNEODevice();
+    NEO::AllocationProperties properties(neoDevice->getRootDeviceIndex(), true, desc->size, NEO::GraphicsAllocation::AllocationType::BUFFER, false, neoDevice->getDeviceBitfield());
+    auto allocation = this->driverHandle->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    if (allocation == nullptr) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    auto physicalMemory = new PhysicalMemory();
+    physicalMemory->device = device;
+    physicalMemory->allocation = allocation;
+    physicalMemory->ownGpuAddress = allocation->getGpuAddress();
+
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    physicalMemoryObjects.insert(physicalMemory);
+    *phPhysicalMemory = physicalMemory->toHandle();
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::destroyPhysicalMem(ze_physical_mem_handle_t hPhysicalMemory) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    auto physicalMemory = PhysicalMemory::fromHandle(hPhysicalMemory);
+
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    if (physicalMemoryObjects.find(physicalMemory) == physicalMemoryObjects.end()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (physicalMemory->mappedPtr != nullptr) {
+        return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    }
+
+    this->driverHandle->getMemoryManager()->freeGraphicsMemory(physicalMemory->allocation);
+    physicalMemoryObjects.erase(physicalMemory);
+    delete physicalMemory;
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::mapVirtualMem(const void *ptr,
@@ -493,25 +677,163 @@ ze_result_t ContextImp::mapVirtualMem(const void *ptr,
                                       ze_physical_mem_handle_t hPhysicalMemory,
                                       size_t offset,
                                       ze_memory_access_attribute_t access) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    auto physicalMemory = PhysicalMemory::fromHandle(hPhysicalMemory);
+
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    if (physicalMemoryObjects.find(physicalMemory) == physicalMemoryObjects.end() || physicalMemory->mappedPtr != nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    // buffer objects are moved as a whole, partial mappings of a physical memory object are not possible
+    if (offset != 0u || size != physicalMemory->allocation->getUnderlyingBufferSize()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+    }
+
+    auto gpuAddress = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr));
+    auto reservation = findVirtualMemoryReservation(ptr, size);
+    if (reservation == nullptr ||
+        reservation->rootDeviceIndex != physicalMemory->allocation->getRootDeviceIndex() ||
+        !isAligned(gpuAddress - reservation->addressRange.address, MemoryConstants::pageSize64k)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto nextMapping = reservation->mappings.lower_bound(ptr);
+    if (nextMapping != reservation->mappings.end() && nextMapping->first < ptrOffset(ptr, size)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (nextMapping != reservation->mappings.begin()) {
+        auto previousMapping = std::prev(nextMapping);
+        if (ptrOffset(previousMapping->first, previousMapping->second.size) > ptr) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    if (!this->driverHandle->getMemoryManager()->mapPhysicalToVirtualMemory(physicalMemory->allocation, gpuAddress)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    NEO::SvmAllocationData allocData(reservation->rootDeviceIndex);
+    allocData.gpuAllocations.addAllocation(physicalMemory->allocation);
+    allocData.cpuAllocation = nullptr;
+    allocData.device = physicalMemory->device->getNEODevice();
+    allocData.size = size;
+    allocData.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+    this->driverHandle->svmAllocsManager->insertSVMAlloc(allocData);
+
+    physicalMemory->mappedPtr = ptr;
+    reservation->mappings[ptr] = {physicalMemory, size, access};
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::unMapVirtualMem(const void *ptr,
                                         size_t size) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    auto reservation = findVirtualMemoryReservation(ptr, size);
+    if (reservation == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto mapping = reservation->mappings.find(ptr);
+    if (mapping == reservation->mappings.end() || mapping->second.size != size) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    unMapPhysicalMemory(*reservation, ptr);
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::setVirtualMemAccessAttribute(const void *ptr,
                                                      size_t size,
                                                      ze_memory_access_attribute_t access) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    auto mapping = findVirtualMemoryMapping(ptr, size);
+    if (mapping == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    mapping->access = access;
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::getVirtualMemAccessAttribute(const void *ptr,
                                                      size_t size,
                                                      ze_memory_access_attribute_t *access,
                                                      size_t *outSize) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    auto mapping = findVirtualMemoryMapping(ptr, size);
+    if (mapping == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    *access = mapping->access;
+    *outSize = mapping->size;
+    return ZE_RESULT_SUCCESS;
+}
+
+VirtualMemoryReservation *ContextImp::findVirtualMemoryReservation(const void *ptr, size_t size) {
+    auto reservation = virtualMemoryReservations.upper_bound(ptr);
+    if (reservation == virtualMemoryReservations.begin()) {
+        return nullptr;
+    }
+    reservation--;
+    if (ptrOffset(ptr, size) > ptrOffset(reservation->first, reservation->second.addressRange.size)) {
+        return nullptr;
+    }
+    return &reservation->second;
+}
+
+VirtualMemoryMapping *ContextImp::findVirtualMemoryMapping(const void *ptr, size_t size) {
+    auto reservation = findVirtualMemoryReservation(ptr, size);
+    if (reservation == nullptr) {
+        return nullptr;
+    }
+    auto mapping = reservation->mappings.upper_bound(ptr);
+    if (mapping == reservation->mappings.begin()) {
+        return nullptr;
+    }
+    mapping--;
+    if (ptrOffset(ptr, size) > ptrOffset(mapping->first, mapping->second.size)) {
+        return nullptr;
+    }
+    return &mapping->second;
+}
+
+void ContextImp::unMapPhysicalMemory(VirtualMemoryReservation &reservation, const void *ptr) {
+    auto mapping = reservation.mappings.find(ptr);
+    auto physicalMemory = mapping->second.physicalMemory;
+
+    auto allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+    this->driverHandle->svmAllocsManager->removeSVMAlloc(*allocData);
+
+    auto ret = this->driverHandle->getMemoryManager()->mapPhysicalToVirtualMemory(physicalMemory->allocation, physicalMemory->ownGpuAddress);
+    UNRECOVERABLE_IF(!ret);
+    physicalMemory->mappedPtr = nullptr;
+    reservation.mappings.erase(mapping);
+}
+
+void ContextImp::releaseVirtualMemory() {
+    std::lock_guard<std::mutex> lock(virtualMemoryMutex);
+    auto memoryManager = this->driverHandle->getMemoryManager();
+    for (auto &reservation : virtualMemoryReservations) {
+        while (!reservation.second.mappings.empty()) {
+            unMapPhysicalMemory(reservation.second, reservation.second.mappings.begin()->first);
+        }
+        memoryManager->freeGpuAddress(reservation.second.addressRange, reservation.second.rootDeviceIndex);
+    }
+    virtualMemoryReservations.clear();
+
+    for (auto physicalMemory : physicalMemoryObjects) {
+        memoryManager->freeGraphicsMemory(physicalMemory->allocation);
+        delete physicalMemory;
+    }
+    physicalMemoryObjects.clear();
+}
+
+void ContextImp::releaseImportedIpcHandles() {
+    std::lock_guard<std::mutex> lock(importedIpcHandlesMutex);
+    for (auto &importedHandle : importedIpcHandles) {
+        if (importedHandle.openCount == 0u) {
+            this->freeMem(importedHandle.ptr);
+        }
+    }
+    importedIpcHandles.clear();
 }
 
 ze_result_t ContextImp::openEventPoolIpcHandle(ze_ipc_event_pool_handle_t hIpc,
@@ -524,6 +846,10 @@ ze_result_t ContextImp::createEventPool(const ze_event_pool_desc_t *desc,
                                         uint32_t numDevices,
                                         ze_device_handle_t *phDevices,
                                         ze_event_pool_handle_t *phEventPool) {
+    if ((desc->flags & ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP) && EventPool::isCounterBasedPoolDesc(desc)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
     EventPool *eventPool = EventPool::create(this->driverHandle, this, numDevices, phDevices, desc);
 
     if (eventPool == nullptr) {
@@ -7,11 +7,41 @@
 
 #pragma once
 
+#include "shared/source/memory_manager/memory_manager.h"
+
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
 namespace L0 {
 
+struct PhysicalMemory : _ze_physical_mem_handle_t {
+    static PhysicalMemory *fromHandle(ze_physical_mem_handle_t handle) { return static_cast<PhysicalMemory *>(handle); }
+    inline ze_physical_mem_handle_t toHandle() { return this; }
+
+    Device *device = nullptr;
+    NEO::GraphicsAllocation *allocation = nullptr;
+    // address the allocation was created at, restored when it gets unmapped
+    uint64_t ownGpuAddress = 0u;
+    const void *mappedPtr = nullptr;
+};
+
+struct VirtualMemoryMapping {
+    PhysicalMemory *physicalMemory;
+    size_t size;
+    ze_memory_access_attribute_t access;
+};
+
+struct VirtualMemoryReservation {
+    NEO::AddressRange addressRange;
+    uint32_t rootDeviceIndex;
+    std::map<const void *, VirtualMemoryMapping> mappings;
+};
+
 struct ContextImp : Context {
     ContextImp(DriverHandle *driverHandle);
     ~ContextImp() override = default;
@@ -121,8 +151,31 @@ struct ContextImp : Context {
     bool isDeviceDefinedForThisContext(Device *inDevice);
 
   protected:
+    struct ImportedIpcHandle {
+        uint32_t rootDeviceIndex;
+        uint64_t handle;
+        uint64_t bufferId;
+        ze_ipc_memory_flags_t flags;
+        void *ptr;
+        uint32_t openCount;
+    };
+
+    VirtualMemoryReservation *findVirtualMemoryReservation(const void *ptr, size_t size);
+    VirtualMemoryMapping *findVirtualMemoryMapping(const void *ptr, size_t size);
+    void unMapPhysicalMemory(VirtualMemoryReservation &reservation, const void *ptr);
+    void releaseVirtualMemory();
+    void releaseImportedIpcHandles();
+    static ze_result_t getCacheRegion(const ze_cache_region_exp_desc_t *cacheRegionDesc, const NEO::HardwareInfo &hwInfo, uint32_t &cacheRegion);
+
     std::map<ze_device_handle_t, Device *> devices;
     DriverHandleImp *driverHandle = nullptr;
+
+    std::map<const void *, VirtualMemoryReservation> virtualMemoryReservations;
+    std::unordered_set<PhysicalMemory *> physicalMemoryObjects;
+    std::mutex virtualMemoryMutex;
+
+    std::vector<ImportedIpcHandle> importedIpcHandles;
+    std::mutex importedIpcHandlesMutex;
 };
 
 } // namespace L0
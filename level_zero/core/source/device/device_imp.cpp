@@ -46,6 +46,8 @@
 
 #include "hw_helpers.h"
 
+#include <limits>
+
 namespace NEO {
 bool releaseFP64Override();
 } // namespace NEO
@@ -112,8 +114,23 @@ ze_result_t DeviceImp::createCommandQueue(const ze_command_queue_desc_t *desc,
     NEO::CommandStreamReceiver *csr = nullptr;
     uint32_t engineGroupIndex = desc->ordinal;
     mapOrdinalForAvailableEngineGroup(&engineGroupIndex);
+    bool selectLeastLoadedEngine = NEO::DebugManager.flags.SelectLeastLoadedEngineForCommandQueue.get() == 1 &&
+                                   !(desc->flags & ZE_COMMAND_QUEUE_FLAG_EXPLICIT_ONLY);
+    auto &hwHelper = NEO::HwHelper::get(platform.eRenderCoreFamily);
+    bool isCopyOnly = hwHelper.isCopyOnlyEngineType(static_cast<NEO::EngineGroupType>(engineGroupIndex));
+
     if (desc->priority == ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW) {
         getCsrForLowPriority(&csr);
+    } else if (desc->priority == ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH && !isCopyOnly && NEO::Device::isHighPriorityEngineEnabled()) {
+        auto ret = getCsrForHighPriority(&csr);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    } else if (selectLeastLoadedEngine) {
+        auto ret = getCsrForLeastLoadedEngine(&csr, desc->ordinal);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
     } else {
         auto ret = getCsrForOrdinalAndIndex(&csr, desc->ordinal, desc->index);
         if (ret != ZE_RESULT_SUCCESS) {
@@ -125,9 +142,6 @@ ze_result_t DeviceImp::createCommandQueue(const ze_command_queue_desc_t *desc,
 
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
 
-    auto &hwHelper = NEO::HwHelper::get(platform.eRenderCoreFamily);
-    bool isCopyOnly = hwHelper.isCopyOnlyEngineType(static_cast<NEO::EngineGroupType>(engineGroupIndex));
-
     *commandQueue = CommandQueue::create(platform.eProductFamily, this, csr, desc, isCopyOnly, false, returnValue);
     csr->getOsContext().ensureContextInitialized();
 
@@ -598,11 +612,15 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
 
     device->neoDevice = neoDevice;
     neoDevice->incRefInternal();
+    UNRECOVERABLE_IF(!neoDevice->ensureDefaultEnginesInitialized());
 
     device->execEnvironment = (void *)neoDevice->getExecutionEnvironment();
     device->metricContext = MetricContext::create(*device);
     device->builtins = BuiltinFunctionsLib::create(
         device, neoDevice->getBuiltIns());
+    if (NEO::DebugManager.flags.EnableAsyncBuiltinsInit.get() == 1) {
+        device->builtins->initBuiltinsAsync();
+    }
     device->maxNumHwThreads = NEO::HwHelper::getMaxThreadsForVfe(neoDevice->getHardwareInfo());
 
     const bool allocateDebugSurface = (device->getL0Debugger() || neoDevice->getDeviceInfo().debuggerActive) && !isSubDevice;
@@ -841,7 +859,52 @@ ze_result_t DeviceImp::getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr
     if (index >= activeDevice->getEngineGroups()[engineGroupIndex].size()) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    *csr = activeDevice->getEngineGroups()[engineGroupIndex][index].commandStreamReceiver;
+    auto &engine = activeDevice->getEngineGroups()[engineGroupIndex][index];
+    if (!activeDevice->ensureEngineInitialized(engine)) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    *csr = engine.commandStreamReceiver;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t DeviceImp::getCsrForLeastLoadedEngine(NEO::CommandStreamReceiver **csr, uint32_t ordinal) {
+    if (ordinal >= static_cast<uint32_t>(NEO::EngineGroupType::MaxEngineGroups)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    uint32_t engineGroupIndex = ordinal;
+    auto ret = mapOrdinalForAvailableEngineGroup(&engineGroupIndex);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    NEO::Device *activeDevice = getActiveDevice();
+    auto &engineGroup = activeDevice->getEngineGroups()[engineGroupIndex];
+    if (engineGroup.empty()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const auto enginesCount = static_cast<uint32_t>(engineGroup.size());
+    const auto searchStart = leastLoadedEngineSearchStart++;
+    auto selectedEngine = &engineGroup[searchStart % enginesCount];
+    uint32_t lowestLoad = std::numeric_limits<uint32_t>::max();
+    for (uint32_t i = 0; i < enginesCount; i++) {
+        auto &engine = engineGroup[(searchStart + i) % enginesCount];
+        // tasks submitted to not yet initialized engine are none, it has no tag to read
+        uint32_t load = 0u;
+        auto tagAddress = engine.commandStreamReceiver->getTagAddress();
+        if (tagAddress != nullptr) {
+            auto taskCount = engine.commandStreamReceiver->peekTaskCount();
+            load = taskCount > *tagAddress ? taskCount - *tagAddress : 0u;
+        }
+        if (load < lowestLoad) {
+            lowestLoad = load;
+            selectedEngine = &engine;
+        }
+    }
+
+    if (!activeDevice->ensureEngineInitialized(*selectedEngine)) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    *csr = selectedEngine->commandStreamReceiver;
     return ZE_RESULT_SUCCESS;
 }
 
@@ -849,6 +912,9 @@ ze_result_t DeviceImp::getCsrForLowPriority(NEO::CommandStreamReceiver **csr) {
     NEO::Device *activeDevice = getActiveDevice();
     for (auto &it : activeDevice->getEngines()) {
         if (it.osContext->isLowPriority()) {
+            if (!activeDevice->ensureEngineInitialized(it)) {
+                return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+            }
             *csr = it.commandStreamReceiver;
             return ZE_RESULT_SUCCESS;
         }
@@ -858,6 +924,20 @@ ze_result_t DeviceImp::getCsrForLowPriority(NEO::CommandStreamReceiver **csr) {
     return ZE_RESULT_ERROR_UNKNOWN;
 }
 
+ze_result_t DeviceImp::getCsrForHighPriority(NEO::CommandStreamReceiver **csr) {
+    NEO::Device *activeDevice = getActiveDevice();
+    for (auto &it : activeDevice->getEngines()) {
+        if (it.osContext->isHighPriority()) {
+            if (!activeDevice->ensureEngineInitialized(it)) {
+                return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+            }
+            *csr = it.commandStreamReceiver;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ze_result_t DeviceImp::mapOrdinalForAvailableEngineGroup(uint32_t *ordinal) {
     NEO::Device *activeDevice = getActiveDevice();
     auto engines = activeDevice->getEngineGroups();
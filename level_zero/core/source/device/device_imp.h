@@ -17,6 +17,7 @@
 #include "level_zero/tools/source/debug/debug_session.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
+#include <atomic>
 #include <mutex>
 
 namespace L0 {
@@ -88,6 +89,8 @@ struct DeviceImp : public Device {
     SysmanDevice *getSysmanHandle() override;
     ze_result_t getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr, uint32_t ordinal, uint32_t index) override;
     ze_result_t getCsrForLowPriority(NEO::CommandStreamReceiver **csr) override;
+    ze_result_t getCsrForHighPriority(NEO::CommandStreamReceiver **csr);
+    ze_result_t getCsrForLeastLoadedEngine(NEO::CommandStreamReceiver **csr, uint32_t ordinal);
     ze_result_t mapOrdinalForAvailableEngineGroup(uint32_t *ordinal) override;
     NEO::Device *getActiveDevice() const;
     void getDeviceMemoryName(std::string &memoryName);
@@ -109,6 +112,9 @@ struct DeviceImp : public Device {
     NEO::SVMAllocsManager::MapBasedAllocationTracker peerAllocations;
     NEO::SpinLock peerAllocationsMutex;
 
+    // engines with equal load are handed out round robin, starting after previously selected one
+    std::atomic<uint32_t> leastLoadedEngineSearchStart{0u};
+
   protected:
     NEO::GraphicsAllocation *debugSurface = nullptr;
     SysmanDevice *pSysmanDevice = nullptr;
@@ -9,8 +9,10 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/os_interface/os_library.h"
 
 #include "level_zero/core/source/context/context_imp.h"
@@ -129,7 +131,21 @@ ze_result_t DriverHandleImp::getExtensionProperties(uint32_t *pCount,
     return ZE_RESULT_SUCCESS;
 }
 
+bool DriverHandleImp::prepareForFastExit() {
+    if (devices.empty()) {
+        return false;
+    }
+    return devices[0]->getNEODevice()->getExecutionEnvironment()->prepareForFastExit();
+}
+
 DriverHandleImp::~DriverHandleImp() {
+    releaseEventPoolAllocationsCache();
+    if (this->svmAllocsManager) {
+        this->svmAllocsManager->releaseUsmMemAllocPools();
+    }
+    if (this->hostPointerManager) {
+        this->hostPointerManager->freeImplicitHostPointerAllocations();
+    }
     for (auto &device : this->devices) {
         delete device;
     }
@@ -139,6 +155,45 @@ DriverHandleImp::~DriverHandleImp() {
     }
 }
 
+NEO::MultiGraphicsAllocation *DriverHandleImp::obtainCachedEventPoolAllocations(const EventPoolAllocationsKey &key) {
+    if (NEO::DebugManager.flags.EventPoolAllocationsCacheSize.get() <= 0) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(eventPoolAllocationsCacheLock);
+    for (auto it = eventPoolAllocationsCache.begin(); it != eventPoolAllocationsCache.end(); it++) {
+        if (it->first == key) {
+            auto allocations = it->second;
+            eventPoolAllocationsCache.erase(it);
+            return allocations;
+        }
+    }
+    return nullptr;
+}
+
+bool DriverHandleImp::cacheEventPoolAllocations(const EventPoolAllocationsKey &key, NEO::MultiGraphicsAllocation *allocations) {
+    auto cacheSize = NEO::DebugManager.flags.EventPoolAllocationsCacheSize.get();
+    if (cacheSize <= 0) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(eventPoolAllocationsCacheLock);
+    if (eventPoolAllocationsCache.size() >= static_cast<size_t>(cacheSize)) {
+        return false;
+    }
+    eventPoolAllocationsCache.emplace_back(key, allocations);
+    return true;
+}
+
+void DriverHandleImp::releaseEventPoolAllocationsCache() {
+    std::unique_lock<std::mutex> lock(eventPoolAllocationsCacheLock);
+    for (auto &cachedAllocations : eventPoolAllocationsCache) {
+        for (auto graphicsAllocation : cachedAllocations.second->getGraphicsAllocations()) {
+            memoryManager->freeGraphicsMemory(graphicsAllocation);
+        }
+        delete cachedAllocations.second;
+    }
+    eventPoolAllocationsCache.clear();
+}
+
 ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>> neoDevices) {
     if (enablePciIdDeviceOrder) {
         sortNeoDevices(neoDevices);
@@ -195,7 +250,8 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
 
     uuidTimestamp = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
 
-    if (NEO::DebugManager.flags.EnableHostPointerImport.get() == 1) {
+    if (NEO::DebugManager.flags.EnableHostPointerImport.get() == 1 ||
+        NEO::DebugManager.flags.EnableImplicitHostPointerImport.get() == 1) {
         createHostPointerManager();
     }
 
@@ -246,6 +302,17 @@ bool DriverHandleImp::findAllocationDataForRange(const void *buffer,
     // Make sure the host buffer does not overlap any existing allocation
     const char *baseAddress = reinterpret_cast<const char *>(buffer);
     NEO::SvmAllocationData *beginAllocData = svmAllocsManager->getSVMAlloc(baseAddress);
+
+    if (beginAllocData && size > 0) {
+        auto allocationBase = reinterpret_cast<const char *>(beginAllocData->getBaseGpuAddress());
+        if ((baseAddress + size) <= (allocationBase + beginAllocData->size)) {
+            if (allocData) {
+                *allocData = beginAllocData;
+            }
+            return true;
+        }
+    }
+
     NEO::SvmAllocationData *endAllocData = svmAllocsManager->getSVMAlloc(baseAddress + size - 1);
 
     if (allocData) {
@@ -257,8 +324,7 @@ bool DriverHandleImp::findAllocationDataForRange(const void *buffer,
     }
 
     // Return true if the whole range requested is covered by the same allocation
-    if (beginAllocData && endAllocData &&
-        (beginAllocData->gpuAllocations.getDefaultGraphicsAllocation() == endAllocData->gpuAllocations.getDefaultGraphicsAllocation())) {
+    if (beginAllocData && endAllocData && (beginAllocData == endAllocData)) {
         return true;
     }
     return false;
@@ -280,15 +346,14 @@ std::vector<NEO::SvmAllocationData *> DriverHandleImp::findAllocationsWithinRang
     // Add the allocation that matches the end address range if there was no beginning allocation
     // or the beginning allocation does not match the ending allocation
     if (endAllocData) {
-        if ((beginAllocData && (beginAllocData->gpuAllocations.getDefaultGraphicsAllocation() != endAllocData->gpuAllocations.getDefaultGraphicsAllocation())) ||
+        if ((beginAllocData && (beginAllocData != endAllocData)) ||
             !beginAllocData) {
             allocDataArray.push_back(endAllocData);
         }
     }
 
     // Return true if the whole range requested is covered by the same allocation
-    if (beginAllocData && endAllocData &&
-        (beginAllocData->gpuAllocations.getDefaultGraphicsAllocation() == endAllocData->gpuAllocations.getDefaultGraphicsAllocation())) {
+    if (beginAllocData && endAllocData && (beginAllocData == endAllocData)) {
         *allocationRangeCovered = true;
     } else {
         *allocationRangeCovered = false;
@@ -338,6 +403,18 @@ ze_result_t DriverHandleImp::getHostPointerBaseAddress(void *ptr, void **baseAdd
     return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
+NEO::GraphicsAllocation *DriverHandleImp::importImplicitHostPointer(void *ptr, size_t size, uint32_t rootDeviceIndex) {
+    if (hostPointerManager.get() == nullptr || NEO::DebugManager.flags.EnableImplicitHostPointerImport.get() != 1) {
+        return nullptr;
+    }
+    // imported range stays cached until released with zexDriverReleaseImportedPointer or driver teardown
+    auto ret = hostPointerManager->createImplicitHostPointerMultiAllocation(this->devices, ptr, size);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return nullptr;
+    }
+    return findHostPointerAllocation(ptr, size, rootDeviceIndex);
+}
+
 NEO::GraphicsAllocation *DriverHandleImp::findHostPointerAllocation(void *ptr, size_t size, uint32_t rootDeviceIndex) {
     if (hostPointerManager.get() != nullptr) {
         HostPointerData *hostData = hostPointerManager->getHostPointerAllocation(ptr);
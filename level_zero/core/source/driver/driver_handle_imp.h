@@ -7,15 +7,33 @@
 
 #pragma once
 
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/os_interface/os_library.h"
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
+namespace NEO {
+class MultiGraphicsAllocation;
+} // namespace NEO
+
 namespace L0 {
 class HostPointerManager;
 
+struct EventPoolAllocationsKey {
+    std::vector<uint32_t> rootDeviceIndices;
+    NEO::GraphicsAllocation::AllocationType allocationType = NEO::GraphicsAllocation::AllocationType::UNKNOWN;
+    size_t size = 0u;
+    uint64_t deviceBitfield = 0u;
+    bool usmHostAllocation = false;
+
+    bool operator==(const EventPoolAllocationsKey &other) const {
+        return rootDeviceIndices == other.rootDeviceIndices && allocationType == other.allocationType && size == other.size &&
+               deviceBitfield == other.deviceBitfield && usmHostAllocation == other.usmHostAllocation;
+    }
+};
+
 struct DriverHandleImp : public DriverHandle {
     ~DriverHandleImp() override;
     DriverHandleImp();
@@ -39,6 +57,7 @@ struct DriverHandleImp : public DriverHandle {
     ze_result_t checkMemoryAccessFromDevice(Device *device, const void *ptr) override;
     NEO::SVMAllocsManager *getSvmAllocsManager() override;
     ze_result_t initialize(std::vector<std::unique_ptr<NEO::Device>> neoDevices);
+    bool prepareForFastExit();
     bool findAllocationDataForRange(const void *buffer,
                                     size_t size,
                                     NEO::SvmAllocationData **allocData) override;
@@ -55,6 +74,7 @@ struct DriverHandleImp : public DriverHandle {
     ze_result_t importExternalPointer(void *ptr, size_t size) override;
     ze_result_t releaseImportedPointer(void *ptr) override;
     ze_result_t getHostPointerBaseAddress(void *ptr, void **baseAddress) override;
+    NEO::GraphicsAllocation *importImplicitHostPointer(void *ptr, size_t size, uint32_t rootDeviceIndex);
 
     virtual NEO::GraphicsAllocation *findHostPointerAllocation(void *ptr, size_t size, uint32_t rootDeviceIndex) override;
     virtual NEO::GraphicsAllocation *getDriverSystemMemoryAllocation(void *ptr,
@@ -73,6 +93,10 @@ struct DriverHandleImp : public DriverHandle {
                                 NEO::SvmAllocationData *allocData,
                                 Device *device);
 
+    NEO::MultiGraphicsAllocation *obtainCachedEventPoolAllocations(const EventPoolAllocationsKey &key);
+    bool cacheEventPoolAllocations(const EventPoolAllocationsKey &key, NEO::MultiGraphicsAllocation *allocations);
+    void releaseEventPoolAllocationsCache();
+
     std::unique_ptr<HostPointerManager> hostPointerManager;
     // Experimental functions
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
@@ -80,6 +104,9 @@ struct DriverHandleImp : public DriverHandle {
     std::mutex sharedMakeResidentAllocationsLock;
     std::map<void *, NEO::GraphicsAllocation *> sharedMakeResidentAllocations;
 
+    std::mutex eventPoolAllocationsCacheLock;
+    std::vector<std::pair<EventPoolAllocationsKey, NEO::MultiGraphicsAllocation *>> eventPoolAllocationsCache;
+
     std::vector<Device *> devices;
     // Spec extensions
     const std::vector<std::pair<std::string, uint32_t>> extensionsSupported = {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -61,6 +61,14 @@ HostPointerManager::~HostPointerManager() {
 }
 
 ze_result_t HostPointerManager::createHostPointerMultiAllocation(std::vector<Device *> &devices, void *ptr, size_t size) {
+    return createHostPointerMultiAllocationImpl(devices, ptr, size, false);
+}
+
+ze_result_t HostPointerManager::createImplicitHostPointerMultiAllocation(std::vector<Device *> &devices, void *ptr, size_t size) {
+    return createHostPointerMultiAllocationImpl(devices, ptr, size, true);
+}
+
+ze_result_t HostPointerManager::createHostPointerMultiAllocationImpl(std::vector<Device *> &devices, void *ptr, size_t size, bool implicitImport) {
     if (size == 0) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
@@ -90,6 +98,7 @@ ze_result_t HostPointerManager::createHostPointerMultiAllocation(std::vector<Dev
     HostPointerData hostData(static_cast<uint32_t>(devices.size() - 1));
     hostData.basePtr = basePtr;
     hostData.size = totalSize;
+    hostData.implicitImport = implicitImport;
     for (auto device : devices) {
         NEO::GraphicsAllocation *gfxAlloc = createHostPointerAllocation(device->getRootDeviceIndex(),
                                                                         basePtr,
@@ -140,4 +149,21 @@ bool HostPointerManager::freeHostPointerAllocation(void *ptr) {
     return true;
 }
 
+void HostPointerManager::freeImplicitHostPointerAllocations() {
+    std::unique_lock<NEO::SpinLock> lock(mtx);
+    auto &allocations = hostPointerAllocations.allocations;
+    for (auto it = allocations.begin(); it != allocations.end();) {
+        if (!it->second.implicitImport) {
+            it++;
+            continue;
+        }
+        for (auto gpuAllocation : it->second.hostPtrAllocations.getGraphicsAllocations()) {
+            if (gpuAllocation) {
+                memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(gpuAllocation);
+            }
+        }
+        it = allocations.erase(it);
+    }
+}
+
 } // namespace L0
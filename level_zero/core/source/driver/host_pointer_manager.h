@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@ struct HostPointerData {
         : HostPointerData(hostPtrData.maxRootDeviceIndex) {
         basePtr = hostPtrData.basePtr;
         size = hostPtrData.size;
+        implicitImport = hostPtrData.implicitImport;
         for (auto allocation : hostPtrData.hostPtrAllocations.getGraphicsAllocations()) {
             if (allocation) {
                 this->hostPtrAllocations.addAllocation(allocation);
@@ -43,6 +44,7 @@ struct HostPointerData {
     NEO::MultiGraphicsAllocation hostPtrAllocations;
     void *basePtr = nullptr;
     size_t size = 0u;
+    bool implicitImport = false;
 
   protected:
     const uint32_t maxRootDeviceIndex;
@@ -67,10 +69,13 @@ class HostPointerManager {
     HostPointerManager(NEO::MemoryManager *memoryManager);
     virtual ~HostPointerManager();
     ze_result_t createHostPointerMultiAllocation(std::vector<Device *> &devices, void *ptr, size_t size);
+    ze_result_t createImplicitHostPointerMultiAllocation(std::vector<Device *> &devices, void *ptr, size_t size);
     HostPointerData *getHostPointerAllocation(const void *ptr);
     bool freeHostPointerAllocation(void *ptr);
+    void freeImplicitHostPointerAllocations();
 
   protected:
+    ze_result_t createHostPointerMultiAllocationImpl(std::vector<Device *> &devices, void *ptr, size_t size, bool implicitImport);
     NEO::GraphicsAllocation *createHostPointerAllocation(uint32_t rootDeviceIndex,
                                                          void *ptr,
                                                          size_t size,
@@ -17,6 +17,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
+#include "shared/source/utilities/stackvec.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/wait_util.h"
 
@@ -68,6 +69,19 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, Context *context, uin
                                                           deviceBitfield};
         unifiedMemoryProperties.alignment = eventAlignment;
 
+        if (isDeviceLocalMemoryPreferred(driver, rootDeviceIndices)) {
+            eventPoolPtr = allocateInDeviceLocalMemory(driver, rootDeviceIndex, maxRootDeviceIndex, alignedSize, deviceBitfield);
+            if (eventPoolPtr) {
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+
+        allocationsKey = {rootDeviceIndices, allocationType, alignedSize, deviceBitfield.to_ullong(), false};
+        eventPoolAllocations = static_cast<DriverHandleImp *>(driver)->obtainCachedEventPoolAllocations(allocationsKey);
+        if (eventPoolAllocations) {
+            return ZE_RESULT_SUCCESS;
+        }
+
         eventPoolAllocations = new NEO::MultiGraphicsAllocation(maxRootDeviceIndex);
         eventPoolPtr = driver->getMemoryManager()->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices,
                                                                                                    unifiedMemoryProperties,
@@ -102,6 +116,12 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, Context *context, uin
         unifiedMemoryProperties.flags.isUSMDeviceAllocation = false;
         unifiedMemoryProperties.alignment = eventAlignment;
 
+        allocationsKey = {rootDeviceIndices, allocationType, alignedSize, deviceBitfield.to_ullong(), true};
+        eventPoolAllocations = static_cast<DriverHandleImp *>(driver)->obtainCachedEventPoolAllocations(allocationsKey);
+        if (eventPoolAllocations) {
+            return ZE_RESULT_SUCCESS;
+        }
+
         eventPoolAllocations = new NEO::MultiGraphicsAllocation(maxRootDeviceIndex);
         eventPoolPtr = driver->getMemoryManager()->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices,
                                                                                                    unifiedMemoryProperties,
@@ -114,9 +134,58 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, Context *context, uin
     return ZE_RESULT_SUCCESS;
 }
 
+bool EventPoolImp::isDeviceLocalMemoryPreferred(DriverHandle *driver, const std::vector<uint32_t> &rootDeviceIndices) const {
+    if (NEO::DebugManager.flags.EnableDeviceLocalEventPool.get() != 1 ||
+        (eventPoolFlags & ZE_EVENT_POOL_FLAG_HOST_VISIBLE) ||
+        rootDeviceIndices.size() != 1) {
+        return false;
+    }
+    return driver->getMemoryManager()->isLocalMemorySupported(rootDeviceIndices[0]);
+}
+
+void *EventPoolImp::allocateInDeviceLocalMemory(DriverHandle *driver, uint32_t rootDeviceIndex, uint32_t maxRootDeviceIndex, size_t alignedSize, NEO::DeviceBitfield deviceBitfield) {
+    // GPU signals and waits stay in local memory, host reads and resets events through mapping of the allocation
+    EventPoolAllocationsKey deviceLocalKey = {{rootDeviceIndex}, NEO::GraphicsAllocation::AllocationType::BUFFER, alignedSize, deviceBitfield.to_ullong(), false};
+    auto driverHandleImp = static_cast<DriverHandleImp *>(driver);
+    eventPoolAllocations = driverHandleImp->obtainCachedEventPoolAllocations(deviceLocalKey);
+    if (eventPoolAllocations) {
+        allocationsKey = deviceLocalKey;
+        return eventPoolAllocations->getGraphicsAllocation(rootDeviceIndex)->getLockedPtr();
+    }
+
+    auto memoryManager = driver->getMemoryManager();
+    NEO::AllocationProperties deviceMemoryProperties{rootDeviceIndex, alignedSize, NEO::GraphicsAllocation::AllocationType::BUFFER, deviceBitfield};
+    deviceMemoryProperties.alignment = eventAlignment;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(deviceMemoryProperties);
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+
+    void *hostPtr = allocation->isAllocatedInLocalMemoryPool() ? memoryManager->lockResource(allocation) : nullptr;
+    if (hostPtr == nullptr) {
+        memoryManager->freeGraphicsMemory(allocation);
+        return nullptr;
+    }
+
+    eventPoolAllocations = new NEO::MultiGraphicsAllocation(maxRootDeviceIndex);
+    eventPoolAllocations->addAllocation(allocation);
+    allocationsKey = deviceLocalKey;
+    return hostPtr;
+}
+
 EventPoolImp::~EventPoolImp() {
+    if (eventPoolAllocations == nullptr) {
+        return;
+    }
+    auto driverHandle = static_cast<DriverHandleImp *>(devices[0]->getDriverHandle());
+    // events are initialized on creation, so backing memory can be handed to next pool of the same kind as is
+    if (eventPoolAllocations->getDefaultGraphicsAllocation() &&
+        driverHandle->cacheEventPoolAllocations(allocationsKey, eventPoolAllocations)) {
+        eventPoolAllocations = nullptr;
+        return;
+    }
     auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
-    auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
+    auto memoryManager = driverHandle->getMemoryManager();
     for (auto gpuAllocation : graphicsAllocations) {
         memoryManager->freeGraphicsMemory(gpuAllocation);
     }
@@ -163,8 +232,9 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
 
     auto alloc = eventPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
 
-    uint64_t baseHostAddr = reinterpret_cast<uint64_t>(alloc->getUnderlyingBuffer());
+    uint64_t baseHostAddr = reinterpret_cast<uint64_t>(alloc->isLocked() ? alloc->getLockedPtr() : alloc->getUnderlyingBuffer());
     event->hostAddress = reinterpret_cast<void *>(baseHostAddr + (desc->index * eventPool->getEventSize()));
+    event->isCounterBased = eventPool->isEventPoolCounterBased;
     event->signalScope = desc->signal;
     event->waitScope = desc->wait;
     event->csr = static_cast<DeviceImp *>(device)->neoDevice->getDefaultEngine().commandStreamReceiver;
@@ -200,6 +270,14 @@ void Event::setPacketsInUse(uint32_t value) {
     kernelTimestampsData[getCurrKernelDataIndex()].setPacketsUsed(value);
 };
 
+void Event::assignCounter(NEO::CommandStreamReceiver &counterCsr, uint32_t value) {
+    counterAllocation = counterCsr.getTagAllocation();
+    counterGpuAddress = counterAllocation->getGpuAddress();
+    counterHostAddress = counterCsr.getTagAddress();
+    counterValue = value;
+    csr = &counterCsr;
+}
+
 uint64_t Event::getPacketAddress(Device *device) {
     uint64_t address = getGpuAddress(device);
     if (isTimestampEvent && kernelCount > 1) {
@@ -265,11 +343,23 @@ ze_result_t EventImp::queryStatusKernelTimestamp() {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t EventImp::queryStatusCounter() {
+    if (counterHostAddress == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+    this->csr->downloadAllocations();
+    return (*counterHostAddress >= counterValue) ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+}
+
 ze_result_t EventImp::queryStatus() {
     uint64_t *hostAddr = static_cast<uint64_t *>(hostAddress);
     uint32_t queryVal = Event::STATE_CLEARED;
     ze_result_t retVal;
 
+    if (isCounterBased) {
+        return queryStatusCounter();
+    }
+
     if (metricStreamer != nullptr) {
         *hostAddr = metricStreamer->getNotificationState();
     }
@@ -340,6 +430,9 @@ ze_result_t EventImp::hostEventSetValue(uint32_t eventVal) {
 }
 
 ze_result_t EventImp::hostSignal() {
+    if (isCounterBased) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     return hostEventSetValue(Event::STATE_SIGNALED);
 }
 
@@ -364,24 +457,86 @@ ze_result_t EventImp::hostSynchronize(uint64_t timeout) {
             return ret;
         }
 
-        NEO::WaitUtils::waitFunction(nullptr, 0u);
+        time2 = std::chrono::high_resolution_clock::now();
+        timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(time2 - time1).count();
 
-        if (timeout == std::numeric_limits<uint32_t>::max()) {
+        if (timeout != std::numeric_limits<uint32_t>::max() && timeDiff >= timeout) {
+            break;
+        }
+
+        NEO::WaitUtils::waitWithPolicy(getWaitPolicy(), hostAddress, static_cast<int64_t>(timeDiff / 1000));
+    }
+
+    return ret;
+}
+
+ze_result_t Event::hostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout, bool waitAll, uint32_t *pSignaledIndex) {
+    if (numEvents == 0) {
+        return waitAll ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    if (phEvents == nullptr || (!waitAll && pSignaledIndex == nullptr)) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    StackVec<uint32_t, 64> pendingEvents;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(phEvents[i]);
+        if (event->csr && event->csr->getType() == NEO::CommandStreamReceiverType::CSR_AUB) {
+            if (!waitAll) {
+                *pSignaledIndex = i;
+                return ZE_RESULT_SUCCESS;
+            }
             continue;
         }
+        pendingEvents.push_back(i);
+    }
+
+    auto waitPolicy = Event::fromHandle(phEvents[0])->getWaitPolicy();
+
+    std::chrono::high_resolution_clock::time_point time1, time2;
+    uint64_t timeDiff = 0;
+    time1 = std::chrono::high_resolution_clock::now();
+    while (true) {
+        // single pass over all pending events, completed ones are dropped so next passes only touch what is left
+        size_t pendingLeft = 0;
+        for (auto eventIndex : pendingEvents) {
+            if (Event::fromHandle(phEvents[eventIndex])->queryStatus() == ZE_RESULT_SUCCESS) {
+                if (!waitAll) {
+                    *pSignaledIndex = eventIndex;
+                    return ZE_RESULT_SUCCESS;
+                }
+                continue;
+            }
+            pendingEvents[pendingLeft++] = eventIndex;
+        }
+        pendingEvents.resize(pendingLeft);
+
+        if (pendingEvents.empty()) {
+            return ZE_RESULT_SUCCESS;
+        }
+        if (timeout == 0) {
+            return ZE_RESULT_NOT_READY;
+        }
 
         time2 = std::chrono::high_resolution_clock::now();
         timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(time2 - time1).count();
 
-        if (timeDiff >= timeout) {
-            break;
+        if (timeout != std::numeric_limits<uint64_t>::max() && timeDiff >= timeout) {
+            return ZE_RESULT_NOT_READY;
         }
+
+        NEO::WaitUtils::waitWithPolicy(waitPolicy, Event::fromHandle(phEvents[pendingEvents[0]])->getHostAddress(), static_cast<int64_t>(timeDiff / 1000));
     }
+}
 
-    return ret;
+NEO::WaitUtils::WaitPolicy EventImp::getWaitPolicy() const {
+    return eventPool->waitPolicy;
 }
 
 ze_result_t EventImp::reset() {
+    if (isCounterBased) {
+        return ZE_RESULT_SUCCESS;
+    }
     if (isTimestampEvent) {
         kernelCount = EventPacketsCount::maxKernelSplit;
         for (uint32_t i = 0; i < kernelCount; i++) {
@@ -433,6 +588,7 @@ EventPool *EventPool::create(DriverHandle *driver, Context *context, uint32_t nu
         DEBUG_BREAK_IF(true);
         return nullptr;
     }
+    eventPool->isEventPoolCounterBased = isCounterBasedPoolDesc(desc);
 
     ze_result_t result = eventPool->initialize(driver, context, numDevices, phDevices, desc->count);
     if (result) {
@@ -442,4 +598,15 @@ EventPool *EventPool::create(DriverHandle *driver, Context *context, uint32_t nu
     return eventPool;
 }
 
+bool EventPool::isCounterBasedPoolDesc(const ze_event_pool_desc_t *desc) {
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        if (extendedDesc->stype == ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC) {
+            return true;
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+    return false;
+}
+
 } // namespace L0
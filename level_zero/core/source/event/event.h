@@ -8,10 +8,11 @@
 #pragma once
 
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/device/device.h"
-#include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include <level_zero/ze_api.h>
 
 struct _ze_event_handle_t {};
@@ -43,6 +44,7 @@ struct Event : _ze_event_handle_t {
     };
 
     static Event *create(EventPool *eventPool, const ze_event_desc_t *desc, Device *device);
+    static ze_result_t hostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout, bool waitAll, uint32_t *pSignaledIndex);
 
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
@@ -51,11 +53,13 @@ struct Event : _ze_event_handle_t {
     virtual NEO::GraphicsAllocation &getAllocation(Device *device) = 0;
 
     virtual uint64_t getGpuAddress(Device *device) = 0;
+    virtual NEO::WaitUtils::WaitPolicy getWaitPolicy() const { return NEO::WaitUtils::defaultWaitPolicy; }
     uint32_t getPacketsInUse();
     uint64_t getPacketAddress(Device *device);
     void resetPackets();
     void *getHostAddress() { return hostAddress; }
     void setPacketsInUse(uint32_t value);
+    void assignCounter(NEO::CommandStreamReceiver &counterCsr, uint32_t value);
     uint32_t getCurrKernelDataIndex() const { return kernelCount - 1; }
     void *hostAddress = nullptr;
     uint32_t kernelCount = 1u;
@@ -64,6 +68,14 @@ struct Event : _ze_event_handle_t {
     bool isTimestampEvent = false;
     bool updateTaskCountEnabled = false;
 
+    // counter-based event is signaled when tag of CSR which executed signaling command list reaches counterValue,
+    // event without assigned counter is treated as signaled
+    bool isCounterBased = false;
+    volatile uint32_t *counterHostAddress = nullptr;
+    uint64_t counterGpuAddress = 0u;
+    NEO::GraphicsAllocation *counterAllocation = nullptr;
+    uint32_t counterValue = 0u;
+
     std::unique_ptr<NEO::TimestampPackets<uint32_t>[]> kernelTimestampsData = nullptr;
     uint64_t globalStartTS;
     uint64_t globalEndTS;
@@ -99,6 +111,8 @@ struct EventImp : public Event {
 
     uint64_t getGpuAddress(Device *device) override;
 
+    NEO::WaitUtils::WaitPolicy getWaitPolicy() const override;
+
     Device *device;
     int index;
     EventPool *eventPool;
@@ -106,6 +120,7 @@ struct EventImp : public Event {
   protected:
     ze_result_t calculateProfilingData();
     ze_result_t queryStatusKernelTimestamp();
+    ze_result_t queryStatusCounter();
     ze_result_t hostEventSetValue(uint32_t eventValue);
     ze_result_t hostEventSetValueTimestamps(uint32_t eventVal);
     void assignTimestampData(void *address);
@@ -113,6 +128,7 @@ struct EventImp : public Event {
 
 struct EventPool : _ze_event_pool_handle_t {
     static EventPool *create(DriverHandle *driver, Context *context, uint32_t numDevices, ze_device_handle_t *phDevices, const ze_event_pool_desc_t *desc);
+    static bool isCounterBasedPoolDesc(const ze_event_pool_desc_t *desc);
     virtual ~EventPool() = default;
     virtual ze_result_t destroy() = 0;
     virtual ze_result_t getIpcHandle(ze_ipc_event_pool_handle_t *pIpcHandle) = 0;
@@ -131,13 +147,15 @@ struct EventPool : _ze_event_pool_handle_t {
     virtual uint32_t getEventSize() = 0;
 
     bool isEventPoolUsedForTimestamp = false;
+    bool isEventPoolCounterBased = false;
+    NEO::WaitUtils::WaitPolicy waitPolicy = NEO::WaitUtils::defaultWaitPolicy;
 
   protected:
     NEO::MultiGraphicsAllocation *eventPoolAllocations = nullptr;
 };
 
 struct EventPoolImp : public EventPool {
-    EventPoolImp(DriverHandle *driver, uint32_t numDevices, ze_device_handle_t *phDevices, uint32_t numEvents, ze_event_pool_flags_t flags) : numEvents(numEvents) {
+    EventPoolImp(DriverHandle *driver, uint32_t numDevices, ze_device_handle_t *phDevices, uint32_t numEvents, ze_event_pool_flags_t flags) : numEvents(numEvents), eventPoolFlags(flags) {
         if (flags & ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP) {
             isEventPoolUsedForTimestamp = true;
         }
@@ -167,6 +185,11 @@ struct EventPoolImp : public EventPool {
     size_t numEvents;
 
   protected:
+    bool isDeviceLocalMemoryPreferred(DriverHandle *driver, const std::vector<uint32_t> &rootDeviceIndices) const;
+    void *allocateInDeviceLocalMemory(DriverHandle *driver, uint32_t rootDeviceIndex, uint32_t maxRootDeviceIndex, size_t alignedSize, NEO::DeviceBitfield deviceBitfield);
+
+    ze_event_pool_flags_t eventPoolFlags = 0u;
+    EventPoolAllocationsKey allocationsKey;
     const uint32_t eventAlignment = 4 * MemoryConstants::cacheLineSize;
     const uint32_t eventSize = static_cast<uint32_t>(alignUp(EventPacketsCount::eventPackets *
                                                                  NEO::TimestampPackets<uint32_t>::getSinglePacketSize(),
@@ -82,14 +82,10 @@ ze_result_t FenceImp::hostSynchronize(uint64_t timeout) {
             return ZE_RESULT_SUCCESS;
         }
 
-        NEO::WaitUtils::waitFunction(nullptr, 0u);
-
-        if (timeout == std::numeric_limits<uint64_t>::max()) {
-            continue;
-        }
-
         time2 = std::chrono::high_resolution_clock::now();
         timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(time2 - time1).count();
+
+        NEO::WaitUtils::waitWithPolicy(NEO::WaitUtils::defaultWaitPolicy, allocation->getUnderlyingBuffer(), static_cast<int64_t>(timeDiff / 1000));
     }
 
     return ret;
@@ -21,11 +21,6 @@ namespace L0 {
 template <PRODUCT_FAMILY gfxProductFamily>
 struct CommandListProductFamily : public CommandListCoreFamily<IGFX_GEN9_CORE> {
     using CommandListCoreFamily::CommandListCoreFamily;
-
-    void programL3(bool isSLMused) override {
-        using GfxFamily = typename NEO::GfxFamilyMapper<IGFX_GEN9_CORE>::GfxFamily;
-        NEO::EncodeL3State<GfxFamily>::encode(commandContainer, isSLMused);
-    }
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
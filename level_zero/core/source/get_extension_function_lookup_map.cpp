@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,28 @@
 
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
+
 namespace L0 {
 std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
-    return std::unordered_map<std::string, void *>();
+    std::unordered_map<std::string, void *> lookupMap;
+    lookupMap["zeEventHostSynchronizeMultipleExp"] = reinterpret_cast<void *>(zeEventHostSynchronizeMultipleExp);
+    lookupMap["zeKernelSetArgumentValuesExp"] = reinterpret_cast<void *>(zeKernelSetArgumentValuesExp);
+    lookupMap["zeCommandListGetLastKernelLaunchIdExp"] = reinterpret_cast<void *>(zeCommandListGetLastKernelLaunchIdExp);
+    lookupMap["zeCommandListUpdateKernelLaunchArgumentExp"] = reinterpret_cast<void *>(zeCommandListUpdateKernelLaunchArgumentExp);
+    lookupMap["zeCommandListUpdateKernelLaunchGroupCountExp"] = reinterpret_cast<void *>(zeCommandListUpdateKernelLaunchGroupCountExp);
+    lookupMap["zeCommandListUpdateKernelLaunchSignalEventExp"] = reinterpret_cast<void *>(zeCommandListUpdateKernelLaunchSignalEventExp);
+    lookupMap["zeCommandListUpdateKernelLaunchWaitEventsExp"] = reinterpret_cast<void *>(zeCommandListUpdateKernelLaunchWaitEventsExp);
+    lookupMap["zeCommandListCloneExp"] = reinterpret_cast<void *>(zeCommandListCloneExp);
+    lookupMap["zeCommandQueueExportSyncFileExp"] = reinterpret_cast<void *>(zeCommandQueueExportSyncFileExp);
+    lookupMap["zeCommandQueueImportSyncFileExp"] = reinterpret_cast<void *>(zeCommandQueueImportSyncFileExp);
+    lookupMap["zeCommandQueueGetPriorityHonoredExp"] = reinterpret_cast<void *>(zeCommandQueueGetPriorityHonoredExp);
+    lookupMap["zeModuleGetBuildStatusExp"] = reinterpret_cast<void *>(zeModuleGetBuildStatusExp);
+    lookupMap["zetMetricStreamerGetReportRingExp"] = reinterpret_cast<void *>(zetMetricStreamerGetReportRingExp);
+    lookupMap["zetMetricStreamerAcquireReportsExp"] = reinterpret_cast<void *>(zetMetricStreamerAcquireReportsExp);
+    lookupMap["zetMetricStreamerReleaseReportsExp"] = reinterpret_cast<void *>(zetMetricStreamerReleaseReportsExp);
+    lookupMap["zetMetricQueryPoolGetDataExp"] = reinterpret_cast<void *>(zetMetricQueryPoolGetDataExp);
+    return lookupMap;
 }
 
 } // namespace L0
\ No newline at end of file
@@ -16,11 +16,13 @@
 #include <level_zero/zet_api.h>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 struct _ze_kernel_handle_t {};
 
 namespace NEO {
+class BatchedMemoryTransfer;
 class Device;
 struct KernelInfo;
 class MemoryManager;
@@ -36,7 +38,14 @@ struct KernelImmutableData {
 
     void initialize(NEO::KernelInfo *kernelInfo, Device *device,
                     uint32_t computeUnitsUsedForSratch,
-                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel);
+                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel,
+                    bool deferIsaAllocation = false, bool shareIsaAllocation = false,
+                    NEO::BatchedMemoryTransfer *batchedUpload = nullptr);
+
+    void allocateIsa(NEO::BatchedMemoryTransfer *batchedUpload = nullptr);
+    void waitForUpload() const;
+    bool isIsaAllocationDeferred() const { return isaAllocationDeferred && (nullptr == isaGraphicsAllocation); }
+    void setPatchedIsa(const void *isa, size_t isaSize);
 
     const std::vector<NEO::GraphicsAllocation *> &getResidencyContainer() const {
         return residencyContainer;
@@ -71,6 +80,12 @@ struct KernelImmutableData {
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    std::mutex isaAllocationMutex;
+    std::vector<char> patchedIsa;
+    bool isaAllocationDeferred = false;
+    NEO::BatchedMemoryTransfer *pendingUpload = nullptr;
+    bool isaAllocationShared = false;
+    bool internalKernel = false;
 
     uint32_t crossThreadDataSize = 0;
     std::unique_ptr<uint8_t[]> crossThreadDataTemplate = nullptr;
@@ -101,6 +116,7 @@ struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI {
     virtual ze_result_t getSourceAttributes(uint32_t *pSize, char **pString) = 0;
     virtual ze_result_t getProperties(ze_kernel_properties_t *pKernelProperties) = 0;
     virtual ze_result_t setArgumentValue(uint32_t argIndex, size_t argSize, const void *pArgValue) = 0;
+    virtual ze_result_t setArgumentValues(uint32_t numArgs, const size_t *pArgSizes, const void *const *ppArgValues) = 0;
     virtual void setGroupCount(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) = 0;
 
     virtual ze_result_t setArgBufferWithAlloc(uint32_t argIndex, uintptr_t argVal, NEO::GraphicsAllocation *allocation) = 0;
@@ -50,7 +50,7 @@ struct KernelHw : public KernelImp {
         if (NEO::isValidOffset(argInfo.bindless)) {
             surfaceStateAddress = patchBindlessSurfaceState(alloc, argInfo.bindless);
         } else {
-            surfaceStateAddress = ptrOffset(surfaceStateHeapData.get(), argInfo.bindful);
+            surfaceStateAddress = ptrOffset(this->getSurfaceStateHeapDataForWrite(), argInfo.bindful);
         }
         uint64_t bufferAddressForSsh = baseAddress;
         auto alignment = NEO::EncodeSurfaceState<GfxFamily>::getSurfaceBaseAddressAlignment();
@@ -95,12 +95,12 @@ struct KernelHw : public KernelImp {
         cloned->numThreadsPerThreadGroup = this->numThreadsPerThreadGroup;
         cloned->threadExecutionMask = this->threadExecutionMask;
 
-        if (this->surfaceStateHeapDataSize > 0) {
+        cloned->surfaceStateHeapDataSize = this->surfaceStateHeapDataSize;
+        if (this->surfaceStateHeapData != nullptr) {
             cloned->surfaceStateHeapData.reset(new uint8_t[this->surfaceStateHeapDataSize]);
             memcpy_s(cloned->surfaceStateHeapData.get(),
                      this->surfaceStateHeapDataSize,
                      this->surfaceStateHeapData.get(), this->surfaceStateHeapDataSize);
-            cloned->surfaceStateHeapDataSize = this->surfaceStateHeapDataSize;
         }
 
         if (this->crossThreadDataSize != 0) {
@@ -112,12 +112,12 @@ struct KernelHw : public KernelImp {
             cloned->crossThreadDataSize = this->crossThreadDataSize;
         }
 
-        if (this->dynamicStateHeapDataSize != 0) {
+        cloned->dynamicStateHeapDataSize = this->dynamicStateHeapDataSize;
+        if (this->dynamicStateHeapData != nullptr) {
             cloned->dynamicStateHeapData.reset(new uint8_t[this->dynamicStateHeapDataSize]);
             memcpy_s(cloned->dynamicStateHeapData.get(),
                      this->dynamicStateHeapDataSize,
                      this->dynamicStateHeapData.get(), this->dynamicStateHeapDataSize);
-            cloned->dynamicStateHeapDataSize = this->dynamicStateHeapDataSize;
         }
 
         if (this->perThreadDataForWholeThreadGroup != nullptr) {
@@ -8,6 +8,7 @@
 #include "level_zero/core/source/kernel/kernel_imp.h"
 
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/kernel_helpers.h"
@@ -15,6 +16,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/memory_manager/batched_memory_transfer.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/arrayref.h"
@@ -71,7 +73,10 @@ KernelImmutableData::KernelImmutableData(L0::Device *l0device) : device(l0device
 
 KernelImmutableData::~KernelImmutableData() {
     if (nullptr != isaGraphicsAllocation) {
-        this->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(&*isaGraphicsAllocation);
+        auto memoryManager = this->getDevice()->getNEODevice()->getMemoryManager();
+        if (memoryManager->getKernelIsaCache().releaseAllocation(&*isaGraphicsAllocation)) {
+            memoryManager->freeGraphicsMemory(&*isaGraphicsAllocation);
+        }
         isaGraphicsAllocation.release();
     }
     crossThreadDataTemplate.reset();
@@ -95,40 +100,54 @@ inline void patchWithImplicitSurface(ArrayRef<uint8_t> crossThreadData, ArrayRef
     }
 }
 
+inline NEO::GraphicsAllocation *patchWithImplicitSurfaceBindless(ArrayRef<uint8_t> crossThreadData, NEO::GraphicsAllocation &allocation,
+                                                                 const NEO::ArgDescPointer &ptr, const NEO::Device &device, bool useGlobalAtomics) {
+    auto bindlessHeapsHelper = device.getBindlessHeapsHelper();
+    if (crossThreadData.empty() || (false == NEO::isValidOffset(ptr.bindless)) || (nullptr == bindlessHeapsHelper)) {
+        return nullptr;
+    }
+
+    // surface state is kept in global heap per allocation, so all kernels sharing the surface reference the same offset
+    auto &hwHelper = NEO::HwHelper::get(device.getHardwareInfo().platform.eRenderCoreFamily);
+    auto ssInHeap = bindlessHeapsHelper->allocateSSInHeap(hwHelper.getRenderSurfaceStateSize(), &allocation, NEO::BindlessHeapsHelper::GLOBAL_SSH);
+    void *addressToPatch = reinterpret_cast<void *>(allocation.getUnderlyingBuffer());
+    size_t sizeToPatch = allocation.getUnderlyingBufferSize();
+    NEO::Buffer::setSurfaceState(&device, ssInHeap.ssPtr, false, false, sizeToPatch, addressToPatch, 0,
+                                 &allocation, 0, 0, useGlobalAtomics, device.getNumAvailableDevices() > 1);
+
+    auto patchValue = hwHelper.getBindlessSurfaceExtendedMessageDescriptorValue(static_cast<uint32_t>(ssInHeap.surfaceStateOffset));
+    patchWithRequiredSize(ptrOffset(crossThreadData.begin(), ptr.bindless), sizeof(patchValue), patchValue);
+    return ssInHeap.heapAllocation;
+}
+
 void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device,
                                      uint32_t computeUnitsUsedForSratch,
                                      NEO::GraphicsAllocation *globalConstBuffer,
-                                     NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel) {
+                                     NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel,
+                                     bool deferIsaAllocation, bool shareIsaAllocation,
+                                     NEO::BatchedMemoryTransfer *batchedUpload) {
 
     UNRECOVERABLE_IF(kernelInfo == nullptr);
     this->kernelInfo = kernelInfo;
     this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+    this->internalKernel = internalKernel;
 
     auto neoDevice = device->getNEODevice();
-    auto memoryManager = device->getNEODevice()->getMemoryManager();
-
-    auto kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
-    const auto allocType = internalKernel ? NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : NEO::GraphicsAllocation::AllocationType::KERNEL_ISA;
 
-    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
-        {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
-    UNRECOVERABLE_IF(allocation == nullptr);
-
-    auto &hwInfo = neoDevice->getHardwareInfo();
-    auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
-
-    if (kernelInfo->heapInfo.pKernelHeap != nullptr && internalKernel == false) {
-        NEO::MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation),
-                                                              *neoDevice, allocation, 0, kernelInfo->heapInfo.pKernelHeap,
-                                                              static_cast<size_t>(kernelIsaSize));
+    // relocated debug data needs ISA address, so kernels of debuggable modules are never deferred
+    this->isaAllocationDeferred = deferIsaAllocation && (nullptr == neoDevice->getDebugger());
+    // internal kernels upload ISA after allocation, so only user kernels with final ISA are shared
+    this->isaAllocationShared = shareIsaAllocation && (false == internalKernel) && (nullptr == neoDevice->getDebugger()) &&
+                                (nullptr != kernelInfo->heapInfo.pKernelHeap);
+    this->pendingUpload = batchedUpload;
+    if (false == this->isaAllocationDeferred) {
+        allocateIsa(batchedUpload);
     }
 
-    isaGraphicsAllocation.reset(allocation);
-
     if (neoDevice->getDebugger() && kernelInfo->kernelDescriptor.external.debugData.get()) {
         createRelocatedDebugData(globalConstBuffer, globalVarBuffer);
         if (device->getL0Debugger()) {
-            device->getL0Debugger()->registerElf(kernelInfo->kernelDescriptor.external.debugData.get(), allocation);
+            device->getL0Debugger()->registerElf(kernelInfo->kernelDescriptor.external.debugData.get(), isaGraphicsAllocation.get());
         }
     }
 
@@ -177,6 +196,12 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device
                                  *globalConstBuffer, kernelDescriptor->payloadMappings.implicitArgs.globalConstantsSurfaceAddress,
                                  *neoDevice, kernelDescriptor->kernelAttributes.flags.useGlobalAtomics);
         this->residencyContainer.push_back(globalConstBuffer);
+        auto bindlessHeapAllocation = patchWithImplicitSurfaceBindless(crossThredDataArrayRef, *globalConstBuffer,
+                                                                       kernelDescriptor->payloadMappings.implicitArgs.globalConstantsSurfaceAddress,
+                                                                       *neoDevice, kernelDescriptor->kernelAttributes.flags.useGlobalAtomics);
+        if (bindlessHeapAllocation) {
+            this->residencyContainer.push_back(bindlessHeapAllocation);
+        }
     } else if (nullptr != globalConstBuffer) {
         this->residencyContainer.push_back(globalConstBuffer);
     }
@@ -189,6 +214,12 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device
                                  *globalVarBuffer, kernelDescriptor->payloadMappings.implicitArgs.globalVariablesSurfaceAddress,
                                  *neoDevice, kernelDescriptor->kernelAttributes.flags.useGlobalAtomics);
         this->residencyContainer.push_back(globalVarBuffer);
+        auto bindlessHeapAllocation = patchWithImplicitSurfaceBindless(crossThredDataArrayRef, *globalVarBuffer,
+                                                                       kernelDescriptor->payloadMappings.implicitArgs.globalVariablesSurfaceAddress,
+                                                                       *neoDevice, kernelDescriptor->kernelAttributes.flags.useGlobalAtomics);
+        if (bindlessHeapAllocation) {
+            this->residencyContainer.push_back(bindlessHeapAllocation);
+        }
     } else if (nullptr != globalVarBuffer) {
         this->residencyContainer.push_back(globalVarBuffer);
     }
@@ -229,6 +260,60 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
     }
 }
 
+void KernelImmutableData::allocateIsa(NEO::BatchedMemoryTransfer *batchedUpload) {
+    std::lock_guard<std::mutex> lock(isaAllocationMutex);
+    if (nullptr != isaGraphicsAllocation) {
+        return;
+    }
+
+    auto neoDevice = device->getNEODevice();
+    auto memoryManager = neoDevice->getMemoryManager();
+
+    auto kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
+    const auto allocType = internalKernel ? NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : NEO::GraphicsAllocation::AllocationType::KERNEL_ISA;
+
+    if (isaAllocationShared) {
+        auto allocation = memoryManager->getKernelIsaCache().obtainAllocation(*neoDevice, kernelInfo->heapInfo.pKernelHeap, kernelIsaSize, allocType);
+        UNRECOVERABLE_IF(allocation == nullptr);
+        isaGraphicsAllocation.reset(allocation);
+        return;
+    }
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+        {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
+    UNRECOVERABLE_IF(allocation == nullptr);
+
+    auto &hwInfo = neoDevice->getHardwareInfo();
+    auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+
+    if (kernelInfo->heapInfo.pKernelHeap != nullptr && internalKernel == false) {
+        // deferred kernel uploads ISA with relocations already applied during module linking
+        const void *isa = patchedIsa.empty() ? kernelInfo->heapInfo.pKernelHeap : patchedIsa.data();
+        if (batchedUpload != nullptr) {
+            batchedUpload->add(allocation, 0, isa, static_cast<size_t>(kernelIsaSize));
+        } else {
+            NEO::MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation),
+                                                                  *neoDevice, allocation, 0, isa,
+                                                                  static_cast<size_t>(kernelIsaSize));
+        }
+    }
+
+    isaGraphicsAllocation.reset(allocation);
+    std::vector<char>().swap(patchedIsa);
+}
+
+void KernelImmutableData::waitForUpload() const {
+    if (pendingUpload != nullptr) {
+        pendingUpload->wait();
+    }
+}
+
+void KernelImmutableData::setPatchedIsa(const void *isa, size_t isaSize) {
+    std::lock_guard<std::mutex> lock(isaAllocationMutex);
+    auto isaBytes = reinterpret_cast<const char *>(isa);
+    patchedIsa.assign(isaBytes, isaBytes + isaSize);
+}
+
 uint32_t KernelImmutableData::getIsaSize() const {
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
@@ -262,6 +347,26 @@ ze_result_t KernelImp::setArgumentValue(uint32_t argIndex, size_t argSize,
     return (this->*kernelArgHandlers[argIndex])(argIndex, argSize, pArgValue);
 }
 
+ze_result_t KernelImp::setArgumentValues(uint32_t numArgs, const size_t *pArgSizes, const void *const *ppArgValues) {
+    if (numArgs > kernelArgHandlers.size() || (numArgs > 0 && (pArgSizes == nullptr || ppArgValues == nullptr))) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t argIndex = 0; argIndex < numArgs; argIndex++) {
+        auto result = (this->*kernelArgHandlers[argIndex])(argIndex, pArgSizes[argIndex], ppArgValues[argIndex]);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+NEO::DispatchKernelTemplate *KernelImp::getDispatchTemplate() {
+    if (NEO::DebugManager.flags.EnableDispatchKernelTemplate.get() == 0) {
+        return nullptr;
+    }
+    return &dispatchTemplate;
+}
+
 void KernelImp::setGroupCount(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
     const NEO::KernelDescriptor &desc = kernelImmData->getDescriptor();
     uint32_t globalWorkSize[3] = {groupCountX * groupSize[0], groupCountY * groupSize[1],
@@ -319,8 +424,9 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
 
         if (numChannels > 0) {
             UNRECOVERABLE_IF(3 != numChannels);
-            NEO::generateLocalIDs(
+            module->getDevice()->getNEODevice()->getLocalIdsCache().generateLocalIds(
                 perThreadDataForWholeThreadGroup,
+                perThreadDataSizeForWholeThreadGroup,
                 static_cast<uint16_t>(simdSize),
                 std::array<uint16_t, 3>{{static_cast<uint16_t>(groupSizeX),
                                          static_cast<uint16_t>(groupSizeY),
@@ -485,8 +591,9 @@ ze_result_t KernelImp::setArgRedescribedImage(uint32_t argIndex, ze_image_handle
         return ZE_RESULT_SUCCESS;
     }
 
+    argBufferCache[argIndex] = {};
     const auto image = Image::fromHandle(argVal);
-    image->copyRedescribedSurfaceStateToSSH(surfaceStateHeapData.get(), arg.bindful);
+    image->copyRedescribedSurfaceStateToSSH(getSurfaceStateHeapDataForWrite(), arg.bindful);
     residencyContainer[argIndex] = image->getAllocation();
 
     return ZE_RESULT_SUCCESS;
@@ -495,6 +602,7 @@ ze_result_t KernelImp::setArgRedescribedImage(uint32_t argIndex, ze_image_handle
 ze_result_t KernelImp::setArgBufferWithAlloc(uint32_t argIndex, uintptr_t argVal, NEO::GraphicsAllocation *allocation) {
     const auto &arg = kernelImmData->getDescriptor().payloadMappings.explicitArgs[argIndex].as<NEO::ArgDescPointer>();
     const auto val = argVal;
+    argBufferCache[argIndex] = {};
 
     NEO::patchPointer(ArrayRef<uint8_t>(crossThreadData.get(), crossThreadDataSize), arg, val);
     if (NEO::isValidOffset(arg.bindful) || NEO::isValidOffset(arg.bindless)) {
@@ -550,6 +658,7 @@ ze_result_t KernelImp::setArgBuffer(uint32_t argIndex, size_t argSize, const voi
 
     if (nullptr == argVal) {
         residencyContainer[argIndex] = nullptr;
+        argBufferCache[argIndex] = {};
         const auto &arg = kernelImmData->getDescriptor().payloadMappings.explicitArgs[argIndex].as<NEO::ArgDescPointer>();
         uintptr_t nullBufferValue = 0;
         NEO::patchPointer(ArrayRef<uint8_t>(crossThreadData.get(), crossThreadDataSize), arg, nullBufferValue);
@@ -557,22 +666,36 @@ ze_result_t KernelImp::setArgBuffer(uint32_t argIndex, size_t argSize, const voi
     }
 
     auto requestedAddress = *reinterpret_cast<void *const *>(argVal);
-    uintptr_t gpuAddress = 0u;
-    NEO::GraphicsAllocation *alloc = module->getDevice()->getDriverHandle()->getDriverSystemMemoryAllocation(requestedAddress,
-                                                                                                             1u,
-                                                                                                             module->getDevice()->getRootDeviceIndex(),
-                                                                                                             &gpuAddress);
     DeviceImp *device = static_cast<DeviceImp *>(this->module->getDevice());
     DriverHandleImp *driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
-    auto allocData = driverHandle->getSvmAllocsManager()->getSVMAlloc(requestedAddress);
-    if (driverHandle->isRemoteResourceNeeded(requestedAddress, alloc, allocData, device)) {
+    auto svmAllocsManager = driverHandle->getSvmAllocsManager();
+
+    // same USM pointer set again, patched address, surface state and residency are still valid
+    auto allocationsVersion = svmAllocsManager->getAllocationsVersion();
+    if (argBufferCache[argIndex].requestedAddress == requestedAddress &&
+        argBufferCache[argIndex].allocationsVersion == allocationsVersion) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    uintptr_t gpuAddress = 0u;
+    NEO::GraphicsAllocation *alloc = driverHandle->getDriverSystemMemoryAllocation(requestedAddress,
+                                                                                   1u,
+                                                                                   device->getRootDeviceIndex(),
+                                                                                   &gpuAddress);
+    auto allocData = svmAllocsManager->getSVMAlloc(requestedAddress);
+    bool remoteResourceNeeded = driverHandle->isRemoteResourceNeeded(requestedAddress, alloc, allocData, device);
+    if (remoteResourceNeeded) {
         alloc = driverHandle->getPeerAllocation(device, allocData, requestedAddress, &gpuAddress);
         if (alloc == nullptr) {
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
     }
 
-    return setArgBufferWithAlloc(argIndex, gpuAddress, alloc);
+    auto result = setArgBufferWithAlloc(argIndex, gpuAddress, alloc);
+    if (result == ZE_RESULT_SUCCESS && allocData != nullptr && remoteResourceNeeded == false) {
+        argBufferCache[argIndex] = {requestedAddress, allocationsVersion};
+    }
+    return result;
 }
 
 ze_result_t KernelImp::setArgImage(uint32_t argIndex, size_t argSize, const void *argVal) {
@@ -587,7 +710,7 @@ ze_result_t KernelImp::setArgImage(uint32_t argIndex, size_t argSize, const void
     if (kernelImmData->getDescriptor().kernelAttributes.imageAddressingMode == NEO::KernelDescriptor::Bindless) {
         image->copySurfaceStateToSSH(patchBindlessSurfaceState(image->getAllocation(), arg.bindless), 0u, isMediaBlockImage);
     } else {
-        image->copySurfaceStateToSSH(surfaceStateHeapData.get(), arg.bindful, isMediaBlockImage);
+        image->copySurfaceStateToSSH(getSurfaceStateHeapDataForWrite(), arg.bindful, isMediaBlockImage);
     }
     residencyContainer[argIndex] = image->getAllocation();
 
@@ -616,7 +739,7 @@ ze_result_t KernelImp::setArgImage(uint32_t argIndex, size_t argSize, const void
 ze_result_t KernelImp::setArgSampler(uint32_t argIndex, size_t argSize, const void *argVal) {
     const auto &arg = kernelImmData->getDescriptor().payloadMappings.explicitArgs[argIndex].as<NEO::ArgDescSampler>();
     const auto sampler = Sampler::fromHandle(*static_cast<const ze_sampler_handle_t *>(argVal));
-    sampler->copySamplerStateToDSH(dynamicStateHeapData.get(), dynamicStateHeapDataSize, arg.bindful);
+    sampler->copySamplerStateToDSH(getDynamicStateHeapDataForWrite(), dynamicStateHeapDataSize, arg.bindful);
 
     auto samplerDesc = sampler->getSamplerDesc();
 
@@ -706,14 +829,9 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
 
     isArgUncached.resize(this->kernelArgHandlers.size(), 0);
 
-    if (kernelImmData->getSurfaceStateHeapSize() > 0) {
-        this->surfaceStateHeapData.reset(new uint8_t[kernelImmData->getSurfaceStateHeapSize()]);
-        memcpy_s(this->surfaceStateHeapData.get(),
-                 kernelImmData->getSurfaceStateHeapSize(),
-                 kernelImmData->getSurfaceStateHeapTemplate(),
-                 kernelImmData->getSurfaceStateHeapSize());
-        this->surfaceStateHeapDataSize = kernelImmData->getSurfaceStateHeapSize();
-    }
+    argBufferCache.resize(this->kernelArgHandlers.size());
+
+    this->surfaceStateHeapDataSize = kernelImmData->getSurfaceStateHeapSize();
 
     if (kernelImmData->getDescriptor().kernelAttributes.crossThreadDataSize != 0) {
         this->crossThreadData.reset(new uint8_t[kernelImmData->getDescriptor().kernelAttributes.crossThreadDataSize]);
@@ -724,14 +842,7 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         this->crossThreadDataSize = kernelImmData->getDescriptor().kernelAttributes.crossThreadDataSize;
     }
 
-    if (kernelImmData->getDynamicStateHeapDataSize() != 0) {
-        this->dynamicStateHeapData.reset(new uint8_t[kernelImmData->getDynamicStateHeapDataSize()]);
-        memcpy_s(this->dynamicStateHeapData.get(),
-                 kernelImmData->getDynamicStateHeapDataSize(),
-                 kernelImmData->getDynamicStateHeapTemplate(),
-                 kernelImmData->getDynamicStateHeapDataSize());
-        this->dynamicStateHeapDataSize = kernelImmData->getDynamicStateHeapDataSize();
-    }
+    this->dynamicStateHeapDataSize = kernelImmData->getDynamicStateHeapDataSize();
 
     if (kernelImmData->getDescriptor().kernelAttributes.requiredWorkgroupSize[0] > 0) {
         auto *reqdSize = kernelImmData->getDescriptor().kernelAttributes.requiredWorkgroupSize;
@@ -763,7 +874,7 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         UNRECOVERABLE_IF(this->privateMemoryGraphicsAllocation == nullptr);
 
         ArrayRef<uint8_t> crossThredDataArrayRef = ArrayRef<uint8_t>(this->crossThreadData.get(), this->crossThreadDataSize);
-        ArrayRef<uint8_t> surfaceStateHeapArrayRef = ArrayRef<uint8_t>(this->surfaceStateHeapData.get(), this->surfaceStateHeapDataSize);
+        ArrayRef<uint8_t> surfaceStateHeapArrayRef = ArrayRef<uint8_t>(getSurfaceStateHeapDataForWrite(), this->surfaceStateHeapDataSize);
 
         patchWithImplicitSurface(crossThredDataArrayRef, surfaceStateHeapArrayRef,
                                  static_cast<uintptr_t>(privateMemoryGraphicsAllocation->getGpuAddressToPatch()),
@@ -771,6 +882,12 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
                                  *neoDevice, kernelAttributes.flags.useGlobalAtomics);
 
         this->residencyContainer.push_back(this->privateMemoryGraphicsAllocation);
+        auto bindlessHeapAllocation = patchWithImplicitSurfaceBindless(crossThredDataArrayRef, *privateMemoryGraphicsAllocation,
+                                                                       kernelImmData->getDescriptor().payloadMappings.implicitArgs.privateMemoryAddress,
+                                                                       *neoDevice, kernelAttributes.flags.useGlobalAtomics);
+        if (bindlessHeapAllocation) {
+            this->residencyContainer.push_back(bindlessHeapAllocation);
+        }
     }
 
     this->createPrintfBuffer();
@@ -816,7 +933,7 @@ void KernelImp::setDebugSurface() {
     auto device = module->getDevice();
     if (module->isDebugEnabled() && device->getNEODevice()->getDebugger()) {
 
-        auto surfaceStateHeapRef = ArrayRef<uint8_t>(surfaceStateHeapData.get(), surfaceStateHeapDataSize);
+        auto surfaceStateHeapRef = ArrayRef<uint8_t>(getSurfaceStateHeapDataForWrite(), surfaceStateHeapDataSize);
 
         patchWithImplicitSurface(ArrayRef<uint8_t>(), surfaceStateHeapRef,
                                  0,
@@ -824,6 +941,28 @@ void KernelImp::setDebugSurface() {
                                  *device->getNEODevice(), getKernelDescriptor().kernelAttributes.flags.useGlobalAtomics);
     }
 }
+uint8_t *KernelImp::getSurfaceStateHeapDataForWrite() {
+    if (this->surfaceStateHeapData == nullptr && this->surfaceStateHeapDataSize > 0) {
+        this->surfaceStateHeapData.reset(new uint8_t[this->surfaceStateHeapDataSize]);
+        memcpy_s(this->surfaceStateHeapData.get(),
+                 this->surfaceStateHeapDataSize,
+                 kernelImmData->getSurfaceStateHeapTemplate(),
+                 this->surfaceStateHeapDataSize);
+    }
+    return this->surfaceStateHeapData.get();
+}
+
+uint8_t *KernelImp::getDynamicStateHeapDataForWrite() {
+    if (this->dynamicStateHeapData == nullptr && this->dynamicStateHeapDataSize > 0) {
+        this->dynamicStateHeapData.reset(new uint8_t[this->dynamicStateHeapDataSize]);
+        memcpy_s(this->dynamicStateHeapData.get(),
+                 this->dynamicStateHeapDataSize,
+                 kernelImmData->getDynamicStateHeapTemplate(),
+                 this->dynamicStateHeapDataSize);
+    }
+    return this->dynamicStateHeapData.get();
+}
+
 void *KernelImp::patchBindlessSurfaceState(NEO::GraphicsAllocation *alloc, uint32_t bindless) {
     auto &hwHelper = NEO::HwHelper::get(this->module->getDevice()->getHwInfo().platform.eRenderCoreFamily);
     auto surfaceStateSize = hwHelper.getRenderSurfaceStateSize();
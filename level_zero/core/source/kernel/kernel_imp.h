@@ -34,6 +34,8 @@ struct KernelImp : Kernel {
 
     ze_result_t setArgumentValue(uint32_t argIndex, size_t argSize, const void *pArgValue) override;
 
+    ze_result_t setArgumentValues(uint32_t numArgs, const size_t *pArgSizes, const void *const *ppArgValues) override;
+
     void setGroupCount(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) override;
 
     ze_result_t setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
@@ -85,10 +87,10 @@ struct KernelImp : Kernel {
     bool usesSyncBuffer() override;
     void patchSyncBuffer(NEO::GraphicsAllocation *gfxAllocation, size_t bufferOffset) override;
 
-    const uint8_t *getSurfaceStateHeapData() const override { return surfaceStateHeapData.get(); }
+    const uint8_t *getSurfaceStateHeapData() const override { return (surfaceStateHeapData || surfaceStateHeapDataSize == 0) ? surfaceStateHeapData.get() : kernelImmData->getSurfaceStateHeapTemplate(); }
     uint32_t getSurfaceStateHeapDataSize() const override { return surfaceStateHeapDataSize; }
 
-    const uint8_t *getDynamicStateHeapData() const override { return dynamicStateHeapData.get(); }
+    const uint8_t *getDynamicStateHeapData() const override { return (dynamicStateHeapData || dynamicStateHeapDataSize == 0) ? dynamicStateHeapData.get() : kernelImmData->getDynamicStateHeapTemplate(); }
 
     const KernelImmutableData *getImmutableData() const override { return kernelImmData; }
 
@@ -117,6 +119,7 @@ struct KernelImp : Kernel {
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
+    NEO::DispatchKernelTemplate *getDispatchTemplate() override;
     bool getKernelRequiresUncachedMocs() { return (kernelRequiresUncachedMocsCount > 0); }
     void setKernelArgUncached(uint32_t index, bool val) { isArgUncached[index] = val; }
 
@@ -166,12 +169,18 @@ struct KernelImp : Kernel {
     std::unique_ptr<uint8_t[]> crossThreadData = nullptr;
     uint32_t crossThreadDataSize = 0;
 
+    // surface and dynamic state heaps are shared with kernel immutable data until first modification
+    uint8_t *getSurfaceStateHeapDataForWrite();
+    uint8_t *getDynamicStateHeapDataForWrite();
+
     std::unique_ptr<uint8_t[]> surfaceStateHeapData = nullptr;
     uint32_t surfaceStateHeapDataSize = 0;
 
     std::unique_ptr<uint8_t[]> dynamicStateHeapData = nullptr;
     uint32_t dynamicStateHeapDataSize = 0;
 
+    NEO::DispatchKernelTemplate dispatchTemplate;
+
     uint8_t *perThreadDataForWholeThreadGroup = nullptr;
     uint32_t perThreadDataSizeForWholeThreadGroupAllocated = 0;
     uint32_t perThreadDataSizeForWholeThreadGroup = 0u;
@@ -186,6 +195,13 @@ struct KernelImp : Kernel {
     uint32_t kernelRequiresUncachedMocsCount = false;
     std::vector<bool> isArgUncached;
 
+    // USM pointer last set through setArgBuffer, valid while no allocation was added to SVM manager since
+    struct ArgBufferCacheEntry {
+        const void *requestedAddress = nullptr;
+        uint64_t allocationsVersion = 0u;
+    };
+    std::vector<ArgBufferCacheEntry> argBufferCache;
+
     uint32_t globalOffsets[3] = {};
 
     ze_cache_config_flags_t cacheConfigFlags = 0u;
@@ -11,6 +11,11 @@ using namespace L0;
 
 void __attribute__((destructor)) driverHandleDestructor() {
     if (GlobalDriver != nullptr) {
+        if (GlobalDriver->prepareForFastExit()) {
+            // GPU work is completed, kernel reclaims remaining resources at process exit
+            GlobalDriver = nullptr;
+            return;
+        }
         delete GlobalDriver;
         GlobalDriver = nullptr;
     }
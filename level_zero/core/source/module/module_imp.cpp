@@ -11,6 +11,7 @@
 #include "shared/source/compiler_interface/linker.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/string.h"
@@ -18,6 +19,8 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
+#include "shared/source/utilities/parallel_tasks.h"
+#include "shared/source/utilities/worker_pool.h"
 
 #include "opencl/source/program/kernel_info.h"
 
@@ -132,6 +135,9 @@ bool ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t inputSize
     inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
     inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
     inputArgs.specializedValues = this->specConstantsValues;
+    // cache key covers specialization constants, so every specialization of a module is cached separately
+    inputArgs.allowCaching = NEO::DebugManager.flags.EnableL0ModuleCaching.get() == 1 &&
+                             !device->getNEODevice()->getDeviceInfo().debuggerActive && !device->getL0Debugger();
     NEO::TranslationOutput compilerOuput = {};
     auto compilerErr = compilerInterface->build(*device->getNEODevice(), inputArgs, compilerOuput);
     this->updateBuildLog(compilerOuput.frontendCompilerLog);
@@ -143,6 +149,7 @@ bool ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t inputSize
     this->irBinarySize = compilerOuput.intermediateRepresentation.size;
     this->unpackedDeviceBinary = std::move(compilerOuput.deviceBinary.mem);
     this->unpackedDeviceBinarySize = compilerOuput.deviceBinary.size;
+    this->trustedDeviceBinary = compilerOuput.deviceBinaryLoadedFromCache && (NEO::DebugManager.flags.TrustCachedDeviceBinaries.get() == 1);
     this->debugData = std::move(compilerOuput.debugData.mem);
     this->debugDataSize = compilerOuput.debugData.size;
 
@@ -184,8 +191,11 @@ bool ModuleTranslationUnit::createFromNativeBinary(const char *input, size_t inp
         if ((false == singleDeviceBinary.deviceBinary.empty()) && (false == rebuild)) {
             this->unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
             this->unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
-            this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
-            this->packedDeviceBinarySize = archive.size();
+            bool isArchiveUnpacked = (archive.begin() == singleDeviceBinary.deviceBinary.begin()) && (archive.size() == singleDeviceBinary.deviceBinary.size());
+            if (false == (isArchiveUnpacked && NEO::isAnyPackedDeviceBinaryFormat(archive))) {
+                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
+                this->packedDeviceBinarySize = archive.size();
+            }
         }
     }
 
@@ -196,6 +206,17 @@ bool ModuleTranslationUnit::createFromNativeBinary(const char *input, size_t inp
     }
 }
 
+ArrayRef<const uint8_t> ModuleTranslationUnit::getPackedDeviceBinary() const {
+    if (nullptr != this->packedDeviceBinary) {
+        return ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->packedDeviceBinary.get()), this->packedDeviceBinarySize);
+    }
+    auto unpackedBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+    if (NEO::isAnyPackedDeviceBinaryFormat(unpackedBinary)) {
+        return unpackedBinary;
+    }
+    return {};
+}
+
 bool ModuleTranslationUnit::processUnpackedBinary() {
     if (0 == unpackedDeviceBinarySize) {
         return false;
@@ -203,6 +224,7 @@ bool ModuleTranslationUnit::processUnpackedBinary() {
     auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
     NEO::SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
+    binary.trusted = this->trustedDeviceBinary;
     std::string decodeErrors;
     std::string decodeWarnings;
 
@@ -236,12 +258,17 @@ bool ModuleTranslationUnit::processUnpackedBinary() {
     }
 
     auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    // data relocations are written directly to global surfaces during linking, so they have to be initialized first
+    auto globalsUpload = this->batchedUpload.get();
+    if (programInfo.linkerInput && (false == programInfo.linkerInput->getDataRelocations().empty())) {
+        globalsUpload = nullptr;
+    }
     if (programInfo.globalConstants.size != 0) {
-        this->globalConstBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalConstants.size, true, programInfo.linkerInput.get(), programInfo.globalConstants.initData);
+        this->globalConstBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalConstants.size, true, programInfo.linkerInput.get(), programInfo.globalConstants.initData, globalsUpload);
     }
 
     if (programInfo.globalVariables.size != 0) {
-        this->globalVarBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalVariables.size, false, programInfo.linkerInput.get(), programInfo.globalVariables.initData);
+        this->globalVarBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalVariables.size, false, programInfo.linkerInput.get(), programInfo.globalVariables.initData, globalsUpload);
     }
 
     for (auto &kernelInfo : this->programInfo.kernelInfos) {
@@ -267,6 +294,10 @@ bool ModuleTranslationUnit::processUnpackedBinary() {
         return true;
     }
 
+    if (NEO::isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize))) {
+        return true;
+    }
+
     NEO::SingleDeviceBinary singleDeviceBinary;
     singleDeviceBinary.buildOptions = this->options;
     singleDeviceBinary.targetDevice.coreFamily = gfxCore;
@@ -342,6 +373,10 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 }
 
 ModuleImp::~ModuleImp() {
+    if (translationUnit->batchedUpload) {
+        translationUnit->batchedUpload->wait();
+    }
+    kernelImmDatasIndex.clear();
     kernelImmDatas.clear();
 }
 
@@ -353,6 +388,10 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
 
     this->createBuildOptions(desc->pBuildFlags, buildOptions, internalBuildOptions);
 
+    if (NEO::BatchedMemoryTransfer::isEnabled() && (this->type == ModuleType::User)) {
+        this->translationUnit->batchedUpload = std::make_unique<NEO::BatchedMemoryTransfer>(*neoDevice);
+    }
+
     if (desc->format == ZE_MODULE_FORMAT_NATIVE) {
         success = this->translationUnit->createFromNativeBinary(
             reinterpret_cast<const char *>(desc->pInputModule), desc->inputSize);
@@ -375,11 +414,24 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
     }
 
     kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
+    kernelImmDatasIndex.reserve(this->translationUnit->programInfo.kernelInfos.size());
+    bool deferIsaAllocation = (NEO::DebugManager.flags.EnableLazyKernelIsaAllocation.get() == 1) && (this->type == ModuleType::User);
+    // exported functions segment is referenced by symbols of this and other modules, so it is always allocated
+    int32_t exportedFunctionsSegmentId = -1;
+    // ISA patched in place during linking is unique to this module
+    bool shareIsaAllocation = NEO::KernelIsaCache::isEnabled() && (this->type == ModuleType::User);
+    if (this->translationUnit->programInfo.linkerInput) {
+        exportedFunctionsSegmentId = this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId();
+        shareIsaAllocation &= (false == this->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments);
+    }
     for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
+        auto segmentId = static_cast<int32_t>(kernelImmDatas.size());
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
         kernelImmData->initialize(ki, device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
                                   this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
-                                  this->type == ModuleType::Builtin);
+                                  this->type == ModuleType::Builtin, deferIsaAllocation && (segmentId != exportedFunctionsSegmentId), shareIsaAllocation,
+                                  this->translationUnit->batchedUpload.get());
+        kernelImmDatasIndex.emplace(kernelImmData->getDescriptor().kernelMetadata.kernelName, kernelImmData.get());
         kernelImmDatas.push_back(std::move(kernelImmData));
     }
     this->maxGroupSize = static_cast<uint32_t>(this->translationUnit->device->getNEODevice()->getDeviceInfo().maxWorkGroupSize);
@@ -406,16 +458,65 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
         }
     }
 
-    return this->linkBinary();
+    success = this->linkBinary();
+
+    if (this->translationUnit->batchedUpload) {
+        // kernels wait for upload before their first launch
+        success &= this->translationUnit->batchedUpload->submit();
+        batchedUploadSubmitted = true;
+    }
+
+    return success;
 }
 
-const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *functionName) const {
-    for (auto &kernelImmData : kernelImmDatas) {
-        if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(functionName) == 0) {
-            return kernelImmData.get();
-        }
+bool ModuleImp::isAsyncBuildAllowed(const ze_module_desc_t *desc, ModuleBuildLog *moduleBuildLog, ModuleType type, NEO::Device *neoDevice) {
+    if (NEO::DebugManager.flags.EnableAsyncProgramBuild.get() != 1) {
+        return false;
+    }
+    // build log and specialization constants are read by application right after module creation,
+    // debugger has to be notified about kernels before module can be used
+    return desc->format == ZE_MODULE_FORMAT_IL_SPIRV && type == ModuleType::User && moduleBuildLog == nullptr &&
+           (desc->pConstants == nullptr || desc->pConstants->numConstants == 0) &&
+           neoDevice->getDebugger() == nullptr;
+}
+
+void ModuleImp::initializeAsync(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
+    // application is allowed to free module input and build flags once zeModuleCreate returns
+    std::vector<uint8_t> input(desc->pInputModule, desc->pInputModule + desc->inputSize);
+    std::string buildFlags = desc->pBuildFlags ? desc->pBuildFlags : "";
+    bool hasBuildFlags = desc->pBuildFlags != nullptr;
+    ze_module_desc_t asyncDesc = *desc;
+    asyncDesc.pConstants = nullptr;
+
+    buildPending = true;
+    neoDevice->getExecutionEnvironment()->getDriverWorkerPool()->enqueue(NEO::WorkerPoolClient::Build, [this, asyncDesc, input, buildFlags, hasBuildFlags, neoDevice]() mutable {
+        asyncDesc.pInputModule = input.data();
+        asyncDesc.pBuildFlags = hasBuildFlags ? buildFlags.c_str() : nullptr;
+        auto success = this->initialize(&asyncDesc, neoDevice);
+
+        std::lock_guard<std::mutex> lock(buildMutex);
+        buildSucceeded = success;
+        buildPending = false;
+        buildCompleted.notify_all();
+    });
+}
+
+void ModuleImp::waitForBuild() {
+    std::unique_lock<std::mutex> lock(buildMutex);
+    buildCompleted.wait(lock, [this]() { return !buildPending; });
+}
+
+ze_result_t ModuleImp::getBuildStatus() {
+    std::lock_guard<std::mutex> lock(buildMutex);
+    if (buildPending) {
+        return ZE_RESULT_NOT_READY;
     }
-    return nullptr;
+    return buildSucceeded ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+}
+
+const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *functionName) const {
+    auto it = kernelImmDatasIndex.find(functionName);
+    return (it != kernelImmDatasIndex.end()) ? it->second : nullptr;
 }
 
 void ModuleImp::createBuildOptions(const char *pBuildFlags, std::string &apiOptions, std::string &internalBuildOptions) {
@@ -442,10 +543,15 @@ void ModuleImp::updateBuildLog(NEO::Device *neoDevice) {
 
 ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
                                     ze_kernel_handle_t *phFunction) {
+    waitForBuild();
     ze_result_t res;
     if (!isFullyLinked) {
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     }
+    auto immDataIt = kernelImmDatasIndex.find(desc->pKernelName);
+    if (immDataIt != kernelImmDatasIndex.end()) {
+        immDataIt->second->allocateIsa();
+    }
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
@@ -456,16 +562,18 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
 }
 
 ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBinary) {
-    auto genBinary = this->translationUnit->packedDeviceBinary.get();
+    waitForBuild();
+    auto genBinary = this->translationUnit->getPackedDeviceBinary();
 
-    *pSize = this->translationUnit->packedDeviceBinarySize;
+    *pSize = genBinary.size();
     if (pModuleNativeBinary != nullptr) {
-        memcpy_s(pModuleNativeBinary, this->translationUnit->packedDeviceBinarySize, genBinary, this->translationUnit->packedDeviceBinarySize);
+        memcpy_s(pModuleNativeBinary, genBinary.size(), genBinary.begin(), genBinary.size());
     }
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData) {
+    waitForBuild();
     if (translationUnit == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
@@ -478,16 +586,47 @@ ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData)
 }
 
 void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching) {
+    NEO::BatchedMemoryTransfer *batchedUpload = nullptr;
+    if (this->translationUnit->batchedUpload) {
+        if (batchedUploadSubmitted) {
+            // ISA written directly must not be overwritten by pending initial upload
+            this->translationUnit->batchedUpload->wait();
+        } else {
+            batchedUpload = this->translationUnit->batchedUpload.get();
+        }
+    }
     if (this->translationUnit->programInfo.linkerInput && this->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
-        for (const auto &kernelImmData : this->kernelImmDatas) {
+        size_t patchedIsaSize = 0u;
+        for (const auto &segment : isaSegmentsForPatching) {
+            patchedIsaSize += (nullptr != segment.hostPointer) ? segment.segmentSize : 0u;
+        }
+
+        // segments without host copy were not changed during linking
+        auto copySegment = [&](size_t segmentId) {
+            const auto &kernelImmData = this->kernelImmDatas[segmentId];
+            const auto &segment = isaSegmentsForPatching[segmentId];
+            if (nullptr == segment.hostPointer) {
+                return;
+            }
+            if (kernelImmData->isIsaAllocationDeferred()) {
+                kernelImmData->setPatchedIsa(segment.hostPointer, segment.segmentSize);
+                return;
+            }
             if (nullptr == kernelImmData->getIsaGraphicsAllocation()) {
-                continue;
+                return;
+            }
+            if (batchedUpload != nullptr) {
+                batchedUpload->add(kernelImmData->getIsaGraphicsAllocation(), 0, segment.hostPointer, segment.segmentSize);
+                return;
             }
-            auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
             this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(), 0,
-                                                                                        isaSegmentsForPatching[segmentId].hostPointer,
-                                                                                        isaSegmentsForPatching[segmentId].segmentSize);
-        }
+                                                                                        segment.hostPointer, segment.segmentSize);
+        };
+
+        // each kernel has its own ISA allocation, so big uploads are split between build workers
+        constexpr size_t minPatchedIsaSizeForParallelUpload = 64 * MemoryConstants::kiloByte;
+        auto workersCount = (patchedIsaSize >= minPatchedIsaSizeForParallelUpload) ? NEO::ExecutionEnvironment::getBuildWorkersCount() : 1u;
+        NEO::runParallelTasks(this->kernelImmDatas.size(), workersCount, copySegment);
     }
 }
 
@@ -564,6 +703,7 @@ bool ModuleImp::linkBinary() {
 }
 
 ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnFunction) {
+    waitForBuild();
     auto symbolIt = symbols.find(pFunctionName);
     if ((symbolIt == symbols.end()) || (symbolIt->second.symbol.segment != NEO::SegmentType::Instructions)) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -574,6 +714,7 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
 }
 
 ze_result_t ModuleImp::getGlobalPointer(const char *pGlobalName, size_t *pSize, void **pPtr) {
+    waitForBuild();
     auto symbolIt = symbols.find(pGlobalName);
     if ((symbolIt == symbols.end()) || (symbolIt->second.symbol.segment == NEO::SegmentType::Instructions)) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -591,6 +732,11 @@ Module *Module::create(Device *device, const ze_module_desc_t *desc,
                        ModuleBuildLog *moduleBuildLog, ModuleType type) {
     auto module = new ModuleImp(device, moduleBuildLog, type);
 
+    if (ModuleImp::isAsyncBuildAllowed(desc, moduleBuildLog, type, device->getNEODevice())) {
+        module->initializeAsync(desc, device->getNEODevice());
+        return module;
+    }
+
     bool success = module->initialize(desc, device->getNEODevice());
     if (success == false) {
         module->destroy();
@@ -601,6 +747,7 @@ Module *Module::create(Device *device, const ze_module_desc_t *desc,
 }
 
 ze_result_t ModuleImp::getKernelNames(uint32_t *pCount, const char **pNames) {
+    waitForBuild();
     auto &kernelImmDatas = this->getKernelImmutableDataVector();
     if (*pCount == 0) {
         *pCount = static_cast<uint32_t>(kernelImmDatas.size());
@@ -643,6 +790,7 @@ void ModuleImp::verifyDebugCapabilities() {
 }
 
 ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties) {
+    waitForBuild();
 
     pModuleProperties->flags = 0;
 
@@ -656,6 +804,27 @@ ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties)
 ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                                           ze_module_handle_t *phModules,
                                           ze_module_build_log_handle_t *phLinkLog) {
+    for (auto i = 0u; i < numModules; i++) {
+        static_cast<ModuleImp *>(Module::fromHandle(phModules[i]))->waitForBuild();
+    }
+
+    // symbols of all modules are indexed once, name exported by more than one module is ambiguous and is not resolved
+    struct ExportedSymbol {
+        const NEO::Linker::RelocatedSymbol *symbol = nullptr;
+        ModuleImp *module = nullptr;
+        bool duplicated = false;
+    };
+    std::unordered_map<std::string, ExportedSymbol> exportedSymbols;
+    for (auto i = 0u; i < numModules; i++) {
+        auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
+        exportedSymbols.reserve(exportedSymbols.size() + moduleHandle->symbols.size());
+        for (const auto &symbol : moduleHandle->symbols) {
+            auto exportedSymbol = exportedSymbols.emplace(symbol.first, ExportedSymbol{&symbol.second, moduleHandle, false});
+            if (false == exportedSymbol.second && exportedSymbol.first->second.module != moduleHandle) {
+                exportedSymbol.first->second.duplicated = true;
+            }
+        }
+    }
 
     for (auto i = 0u; i < numModules; i++) {
         auto moduleId = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
@@ -666,28 +835,30 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
         std::vector<std::vector<char>> patchedIsaTempStorage;
         uint32_t numPatchedSymbols = 0u;
         if (moduleId->translationUnit->programInfo.linkerInput && moduleId->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
-            patchedIsaTempStorage.reserve(moduleId->kernelImmDatas.size());
-            for (const auto &kernelInfo : moduleId->translationUnit->programInfo.kernelInfos) {
-                auto &kernHeapInfo = kernelInfo->heapInfo;
-                const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
-                patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-                isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), kernHeapInfo.KernelHeapSize});
-            }
+            const auto &kernelInfos = moduleId->translationUnit->programInfo.kernelInfos;
+            isaSegmentsForPatching.resize(kernelInfos.size());
+            patchedIsaTempStorage.resize(kernelInfos.size());
             for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
-                for (auto i = 0u; i < numModules; i++) {
-                    auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
-
-                    auto symbolIt = moduleHandle->symbols.find(unresolvedExternal.unresolvedRelocation.symbolName);
-                    if (symbolIt != moduleHandle->symbols.end()) {
-                        auto relocAddress = ptrOffset(isaSegmentsForPatching[unresolvedExternal.instructionsSegmentId].hostPointer,
-                                                      static_cast<uintptr_t>(unresolvedExternal.unresolvedRelocation.offset));
-
-                        NEO::Linker::patchAddress(relocAddress, symbolIt->second, unresolvedExternal.unresolvedRelocation);
-                        numPatchedSymbols++;
-                        moduleId->importedSymbolAllocations.insert(moduleHandle->exportedFunctionsSurface);
-                        break;
-                    }
+                auto symbolIt = exportedSymbols.find(unresolvedExternal.unresolvedRelocation.symbolName);
+                if (symbolIt == exportedSymbols.end() || symbolIt->second.duplicated) {
+                    continue;
                 }
+
+                // only kernels referencing imported symbols get host copy of ISA and are uploaded again
+                auto segmentId = unresolvedExternal.instructionsSegmentId;
+                auto &patchedIsa = patchedIsaTempStorage[segmentId];
+                if (nullptr == isaSegmentsForPatching[segmentId].hostPointer) {
+                    auto &kernHeapInfo = kernelInfos[segmentId]->heapInfo;
+                    const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
+                    patchedIsa.assign(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize);
+                    isaSegmentsForPatching[segmentId] = NEO::Linker::PatchableSegment{patchedIsa.data(), kernHeapInfo.KernelHeapSize};
+                }
+
+                auto relocAddress = ptrOffset(isaSegmentsForPatching[segmentId].hostPointer,
+                                              static_cast<uintptr_t>(unresolvedExternal.unresolvedRelocation.offset));
+                NEO::Linker::patchAddress(relocAddress, *symbolIt->second.symbol, unresolvedExternal.unresolvedRelocation);
+                numPatchedSymbols++;
+                moduleId->importedSymbolAllocations.insert(symbolIt->second.module->exportedFunctionsSurface);
             }
         }
         if (numPatchedSymbols != moduleId->unresolvedExternalsInfo.size()) {
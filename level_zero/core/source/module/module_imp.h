@@ -9,7 +9,9 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/memory_manager/batched_memory_transfer.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/const_stringref.h"
 
 #include "level_zero/core/source/device/device.h"
@@ -17,8 +19,11 @@
 
 #include "igfxfmid.h"
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace L0 {
 
@@ -38,6 +43,7 @@ struct ModuleTranslationUnit {
     MOCKABLE_VIRTUAL bool processUnpackedBinary();
     void updateBuildLog(const std::string &newLogEntry);
     void processDebugData();
+    ArrayRef<const uint8_t> getPackedDeviceBinary() const;
     L0::Device *device = nullptr;
 
     NEO::GraphicsAllocation *globalConstBuffer = nullptr;
@@ -53,7 +59,9 @@ struct ModuleTranslationUnit {
 
     std::unique_ptr<char[]> unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
+    bool trustedDeviceBinary = false;
 
+    // not set when unpacked binary is already in packed format (e.g. zebin), so it is kept only once
     std::unique_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
 
@@ -62,6 +70,9 @@ struct ModuleTranslationUnit {
     std::vector<char *> alignedvIsas;
 
     NEO::specConstValuesMap specConstantsValues;
+
+    // initial contents of ISA and global surfaces, submitted once module is initialized
+    std::unique_ptr<NEO::BatchedMemoryTransfer> batchedUpload;
 };
 
 struct ModuleImp : public Module {
@@ -72,6 +83,7 @@ struct ModuleImp : public Module {
     ~ModuleImp() override;
 
     ze_result_t destroy() override {
+        waitForBuild();
         delete this;
         return ZE_RESULT_SUCCESS;
     }
@@ -110,6 +122,10 @@ struct ModuleImp : public Module {
     bool linkBinary();
 
     bool initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice);
+    void initializeAsync(const ze_module_desc_t *desc, NEO::Device *neoDevice);
+    static bool isAsyncBuildAllowed(const ze_module_desc_t *desc, ModuleBuildLog *moduleBuildLog, ModuleType type, NEO::Device *neoDevice);
+    void waitForBuild();
+    ze_result_t getBuildStatus() override;
 
     bool isDebugEnabled() const override;
 
@@ -128,12 +144,19 @@ struct ModuleImp : public Module {
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     uint32_t maxGroupSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
+    std::unordered_map<std::string, KernelImmutableData *> kernelImmDatasIndex;
     NEO::Linker::RelocatedSymbolsMap symbols;
     bool debugEnabled = false;
     bool isFullyLinked = false;
+    bool batchedUploadSubmitted = false;
     ModuleType type;
     NEO::Linker::UnresolvedExternals unresolvedExternalsInfo{};
     std::set<NEO::GraphicsAllocation *> importedSymbolAllocations{};
+
+    std::mutex buildMutex;
+    std::condition_variable buildCompleted;
+    bool buildPending = false;
+    bool buildSucceeded = true;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
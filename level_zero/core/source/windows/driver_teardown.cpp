@@ -14,7 +14,10 @@ using namespace L0;
 BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
         if (GlobalDriver != nullptr) {
-            delete GlobalDriver;
+            // non-null lpvReserved means process is terminating
+            if (lpvReserved == nullptr || !GlobalDriver->prepareForFastExit()) {
+                delete GlobalDriver;
+            }
             GlobalDriver = nullptr;
         }
     }
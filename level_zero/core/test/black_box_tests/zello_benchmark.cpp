@@ -0,0 +1,469 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+bool verbose = false;
+
+const char *emptyKernelSrc = R"==(
+__kernel void empty() {
+}
+)==";
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchmarkSettings {
+    uint32_t warmupIterations = 10;
+    uint32_t iterations = 100;
+    uint32_t threads = 4;
+    size_t maxCopySize = 256 * 1024 * 1024;
+};
+
+// Every benchmark takes warmup samples first, so lazy allocations and first submission costs
+// are excluded, then reports distribution of measured samples as single JSON object.
+struct Samples {
+    void add(Clock::duration duration) {
+        values.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+    }
+
+    std::string toJson(const std::string &name, const std::string &params) const {
+        auto sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        auto mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+
+        std::stringstream json;
+        json << "{\"name\": \"" << name << "\", " << params << (params.empty() ? "" : ", ")
+             << "\"samples\": " << sorted.size()
+             << ", \"minNs\": " << sorted.front()
+             << ", \"medianNs\": " << sorted[sorted.size() / 2]
+             << ", \"meanNs\": " << mean
+             << ", \"maxNs\": " << sorted.back() << "}";
+        return json.str();
+    }
+
+    double median() const {
+        auto sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted[sorted.size() / 2];
+    }
+
+    std::vector<double> values;
+};
+
+struct BenchmarkResults {
+    void add(const std::string &json) {
+        if (verbose) {
+            std::cerr << json << std::endl;
+        }
+        results.push_back(json);
+    }
+
+    void dump(std::ostream &out, const std::string &deviceName, const BenchmarkSettings &settings) const {
+        out << "{\n  \"api\": \"level_zero\",\n  \"device\": \"" << deviceName << "\","
+            << "\n  \"warmupIterations\": " << settings.warmupIterations << ","
+            << "\n  \"iterations\": " << settings.iterations << ","
+            << "\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            out << (i == 0 ? "\n    " : ",\n    ") << results[i];
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    std::vector<std::string> results;
+};
+
+template <typename OperationT>
+Samples measure(const BenchmarkSettings &settings, OperationT &&operation) {
+    for (uint32_t i = 0; i < settings.warmupIterations; i++) {
+        operation();
+    }
+    Samples samples;
+    for (uint32_t i = 0; i < settings.iterations; i++) {
+        auto start = Clock::now();
+        operation();
+        samples.add(Clock::now() - start);
+    }
+    return samples;
+}
+
+const char *getParamValue(int argc, char *argv[], const char *shortName, const char *longName) {
+    for (int i = 1; i < argc - 1; i++) {
+        if ((0 == strcmp(argv[i], shortName)) || (0 == strcmp(argv[i], longName))) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+uint32_t getParamValue(int argc, char *argv[], const char *shortName, const char *longName, uint32_t defaultValue) {
+    auto value = getParamValue(argc, argv, shortName, longName);
+    return value ? static_cast<uint32_t>(std::stoul(value)) : defaultValue;
+}
+
+ze_module_handle_t createModule(ze_context_handle_t context, ze_device_handle_t device, const std::vector<uint8_t> &spirV, const std::string &buildFlags) {
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.stype = ZE_STRUCTURE_TYPE_MODULE_DESC;
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    moduleDesc.pBuildFlags = buildFlags.c_str();
+
+    ze_module_handle_t module = nullptr;
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+    return module;
+}
+
+ze_kernel_handle_t createEmptyKernel(ze_module_handle_t module) {
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.stype = ZE_STRUCTURE_TYPE_KERNEL_DESC;
+    kernelDesc.pKernelName = "empty";
+    ze_kernel_handle_t kernel = nullptr;
+    SUCCESS_OR_TERMINATE(zeKernelCreate(module, &kernelDesc, &kernel));
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(kernel, 1u, 1u, 1u));
+    return kernel;
+}
+
+ze_command_queue_handle_t createQueue(ze_context_handle_t context, ze_device_handle_t device, uint32_t ordinal) {
+    ze_command_queue_desc_t cmdQueueDesc = {};
+    cmdQueueDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+    cmdQueueDesc.ordinal = ordinal;
+    cmdQueueDesc.index = 0;
+    cmdQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_command_queue_handle_t cmdQueue = nullptr;
+    SUCCESS_OR_TERMINATE(zeCommandQueueCreate(context, device, &cmdQueueDesc, &cmdQueue));
+    return cmdQueue;
+}
+
+ze_command_list_handle_t createList(ze_context_handle_t context, ze_device_handle_t device, uint32_t ordinal) {
+    ze_command_list_desc_t cmdListDesc = {};
+    cmdListDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+    cmdListDesc.commandQueueGroupOrdinal = ordinal;
+    ze_command_list_handle_t cmdList = nullptr;
+    SUCCESS_OR_TERMINATE(zeCommandListCreate(context, device, &cmdListDesc, &cmdList));
+    return cmdList;
+}
+
+void benchmarkKernelLaunchLatency(ze_context_handle_t context, ze_device_handle_t device, ze_kernel_handle_t kernel,
+                                  const BenchmarkSettings &settings, BenchmarkResults &results) {
+    ze_group_count_t dispatchTraits = {1u, 1u, 1u};
+    auto ordinal = getCommandQueueOrdinal(device);
+
+    // regular command list, submission and completion of already closed list
+    auto cmdQueue = createQueue(context, device, ordinal);
+    auto cmdList = createList(context, device, ordinal);
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+
+    auto regularSamples = measure(settings, [&]() {
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+    });
+    results.add(regularSamples.toJson("emptyKernelLaunchLatency", "\"commandList\": \"regular\""));
+
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+
+    // immediate command list, append returns after kernel completes
+    ze_command_queue_desc_t immediateDesc = {};
+    immediateDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+    immediateDesc.ordinal = ordinal;
+    immediateDesc.index = 0;
+    immediateDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_command_list_handle_t immediateCmdList = nullptr;
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &immediateDesc, &immediateCmdList));
+
+    auto immediateSamples = measure(settings, [&]() {
+        SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(immediateCmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+    });
+    results.add(immediateSamples.toJson("emptyKernelLaunchLatency", "\"commandList\": \"immediate\""));
+
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(immediateCmdList));
+}
+
+void benchmarkSubmissionThroughput(ze_context_handle_t context, ze_device_handle_t device, ze_kernel_handle_t kernel,
+                                   const BenchmarkSettings &settings, BenchmarkResults &results) {
+    ze_group_count_t dispatchTraits = {1u, 1u, 1u};
+    auto ordinal = getCommandQueueOrdinal(device);
+
+    for (uint32_t threadsCount = 1; threadsCount <= settings.threads; threadsCount *= 2) {
+        // kernel arguments are not modified, so all threads may safely share single kernel
+        std::vector<ze_command_queue_handle_t> queues(threadsCount);
+        std::vector<ze_command_list_handle_t> lists(threadsCount);
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            queues[i] = createQueue(context, device, ordinal);
+            lists[i] = createList(context, device, ordinal);
+            SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(lists[i], kernel, &dispatchTraits, nullptr, 0, nullptr));
+            SUCCESS_OR_TERMINATE(zeCommandListClose(lists[i]));
+        }
+
+        auto submit = [&](uint32_t threadId, uint32_t submissions) {
+            for (uint32_t i = 0; i < submissions; i++) {
+                SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(queues[threadId], 1, &lists[threadId], nullptr));
+            }
+            SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(queues[threadId], std::numeric_limits<uint64_t>::max()));
+        };
+
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            submit(i, settings.warmupIterations);
+        }
+
+        std::atomic<bool> start{false};
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            threads.emplace_back([&, i]() {
+                while (!start.load()) {
+                    std::this_thread::yield();
+                }
+                submit(i, settings.iterations);
+            });
+        }
+        auto startTime = Clock::now();
+        start = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+
+        auto submissions = static_cast<uint64_t>(threadsCount) * settings.iterations;
+        std::stringstream json;
+        json << "{\"name\": \"submissionThroughput\", \"threads\": " << threadsCount
+             << ", \"submissions\": " << submissions
+             << ", \"totalNs\": " << elapsedNs
+             << ", \"submissionsPerSecond\": " << (submissions * 1e9 / elapsedNs) << "}";
+        results.add(json.str());
+
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            SUCCESS_OR_TERMINATE(zeCommandListDestroy(lists[i]));
+            SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(queues[i]));
+        }
+    }
+}
+
+void benchmarkEventLatency(ze_context_handle_t context, ze_device_handle_t device,
+                           const BenchmarkSettings &settings, BenchmarkResults &results) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 2;
+    ze_event_pool_handle_t eventPool = nullptr;
+    SUCCESS_OR_TERMINATE(zeEventPoolCreate(context, &eventPoolDesc, 1, &device, &eventPool));
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    ze_event_handle_t hostEvent = nullptr;
+    ze_event_handle_t gpuEvent = nullptr;
+    eventDesc.index = 0;
+    SUCCESS_OR_TERMINATE(zeEventCreate(eventPool, &eventDesc, &hostEvent));
+    eventDesc.index = 1;
+    SUCCESS_OR_TERMINATE(zeEventCreate(eventPool, &eventDesc, &gpuEvent));
+
+    // GPU is already waiting on host event when measurement starts,
+    // so sample covers host signal, GPU observing it, GPU signal and host wake up
+    auto ordinal = getCommandQueueOrdinal(device);
+    auto cmdQueue = createQueue(context, device, ordinal);
+    auto cmdList = createList(context, device, ordinal);
+    SUCCESS_OR_TERMINATE(zeCommandListAppendWaitOnEvents(cmdList, 1, &hostEvent));
+    SUCCESS_OR_TERMINATE(zeCommandListAppendSignalEvent(cmdList, gpuEvent));
+    SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+
+    auto roundTrip = [&]() {
+        SUCCESS_OR_TERMINATE(zeEventHostReset(hostEvent));
+        SUCCESS_OR_TERMINATE(zeEventHostReset(gpuEvent));
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeEventHostSignal(hostEvent));
+        SUCCESS_OR_TERMINATE(zeEventHostSynchronize(gpuEvent, std::numeric_limits<uint64_t>::max()));
+        auto duration = Clock::now() - start;
+
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+        return duration;
+    };
+
+    for (uint32_t i = 0; i < settings.warmupIterations; i++) {
+        roundTrip();
+    }
+    Samples samples;
+    for (uint32_t i = 0; i < settings.iterations; i++) {
+        samples.add(roundTrip());
+    }
+    results.add(samples.toJson("eventSignalToHostWakeLatency", ""));
+
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+    SUCCESS_OR_TERMINATE(zeEventDestroy(gpuEvent));
+    SUCCESS_OR_TERMINATE(zeEventDestroy(hostEvent));
+    SUCCESS_OR_TERMINATE(zeEventPoolDestroy(eventPool));
+}
+
+void benchmarkCopyBandwidth(ze_context_handle_t context, ze_device_handle_t device,
+                            const BenchmarkSettings &settings, BenchmarkResults &results) {
+    uint32_t numQueueGroups = 0;
+    SUCCESS_OR_TERMINATE(zeDeviceGetCommandQueueGroupProperties(device, &numQueueGroups, nullptr));
+    std::vector<ze_command_queue_group_properties_t> queueProperties(numQueueGroups);
+    SUCCESS_OR_TERMINATE(zeDeviceGetCommandQueueGroupProperties(device, &numQueueGroups, queueProperties.data()));
+
+    void *hostBuffer = nullptr;
+    void *deviceBuffer = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    hostDesc.stype = ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    deviceDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, settings.maxCopySize, 4096, &hostBuffer));
+    SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, settings.maxCopySize, 4096, device, &deviceBuffer));
+    memset(hostBuffer, 1, settings.maxCopySize);
+
+    for (uint32_t ordinal = 0; ordinal < numQueueGroups; ordinal++) {
+        auto &properties = queueProperties[ordinal];
+        if (!(properties.flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY)) {
+            continue;
+        }
+        auto engine = (properties.flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE) ? "compute" : "copy";
+        auto cmdQueue = createQueue(context, device, ordinal);
+        auto cmdList = createList(context, device, ordinal);
+
+        for (size_t size = 4096; size <= settings.maxCopySize; size *= 4) {
+            for (auto hostToDevice : {true, false}) {
+                SUCCESS_OR_TERMINATE(zeCommandListReset(cmdList));
+                auto dst = hostToDevice ? deviceBuffer : hostBuffer;
+                auto src = hostToDevice ? hostBuffer : deviceBuffer;
+                SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, dst, src, size, nullptr, 0, nullptr));
+                SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+
+                auto samples = measure(settings, [&]() {
+                    SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+                    SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+                });
+
+                std::stringstream params;
+                params << "\"engine\": \"" << engine << "\", \"ordinal\": " << ordinal
+                       << ", \"direction\": \"" << (hostToDevice ? "hostToDevice" : "deviceToHost") << "\""
+                       << ", \"size\": " << size
+                       << ", \"medianGBps\": " << (size / samples.median());
+                results.add(samples.toJson("copyBandwidth", params.str()));
+            }
+        }
+
+        SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+        SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+    }
+
+    SUCCESS_OR_TERMINATE(zeMemFree(context, deviceBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, hostBuffer));
+}
+
+void benchmarkUsmAllocFree(ze_context_handle_t context, ze_device_handle_t device,
+                           const BenchmarkSettings &settings, BenchmarkResults &results) {
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    hostDesc.stype = ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    deviceDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+
+    const char *types[] = {"host", "device", "shared"};
+    for (uint32_t type = 0; type < 3; type++) {
+        for (size_t size : {size_t(4096), size_t(2 * 1024 * 1024), size_t(64 * 1024 * 1024)}) {
+            auto samples = measure(settings, [&]() {
+                void *ptr = nullptr;
+                if (type == 0) {
+                    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, size, 4096, &ptr));
+                } else if (type == 1) {
+                    SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, size, 4096, device, &ptr));
+                } else {
+                    SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, size, 4096, device, &ptr));
+                }
+                SUCCESS_OR_TERMINATE(zeMemFree(context, ptr));
+            });
+
+            std::stringstream params;
+            params << "\"type\": \"" << types[type] << "\", \"size\": " << size;
+            results.add(samples.toJson("usmAllocFreeLatency", params.str()));
+        }
+    }
+}
+
+void benchmarkModuleCreate(ze_context_handle_t context, ze_device_handle_t device, const std::vector<uint8_t> &spirV,
+                           const BenchmarkSettings &settings, BenchmarkResults &results) {
+    // unique build option changes cache key, so every sample misses compiler cache
+    uint32_t salt = 0;
+    auto uncachedSamples = measure(settings, [&]() {
+        auto module = createModule(context, device, spirV, "-DZELLO_BENCHMARK_SALT=" + std::to_string(salt++));
+        SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    });
+    results.add(uncachedSamples.toJson("moduleCreateTime", "\"cache\": \"miss\""));
+
+    auto cachedSamples = measure(settings, [&]() {
+        auto module = createModule(context, device, spirV, "");
+        SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    });
+    results.add(cachedSamples.toJson("moduleCreateTime", "\"cache\": \"hit\""));
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+
+    BenchmarkSettings settings;
+    settings.warmupIterations = getParamValue(argc, argv, "-w", "--warmup", settings.warmupIterations);
+    settings.iterations = std::max(1u, getParamValue(argc, argv, "-i", "--iterations", settings.iterations));
+    settings.threads = std::max(1u, getParamValue(argc, argv, "-t", "--threads", settings.threads));
+    settings.maxCopySize = static_cast<size_t>(getParamValue(argc, argv, "-m", "--max_copy_size_mb", static_cast<uint32_t>(settings.maxCopySize >> 20))) << 20;
+    auto outputFile = getParamValue(argc, argv, "-o", "--output");
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {};
+    deviceProperties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+
+    std::string buildLog;
+    auto spirV = compileToSpirV(emptyKernelSrc, "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cerr << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    auto module = createModule(context, device, spirV, "");
+    auto kernel = createEmptyKernel(module);
+
+    BenchmarkResults results;
+    benchmarkKernelLaunchLatency(context, device, kernel, settings, results);
+    benchmarkSubmissionThroughput(context, device, kernel, settings, results);
+    benchmarkEventLatency(context, device, settings, results);
+    benchmarkCopyBandwidth(context, device, settings, results);
+    benchmarkUsmAllocFree(context, device, settings, results);
+    benchmarkModuleCreate(context, device, spirV, settings, results);
+
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(kernel));
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    if (outputFile) {
+        std::ofstream out(outputFile);
+        results.dump(out, deviceProperties.name, settings);
+    } else {
+        results.dump(std::cout, deviceProperties.name, settings);
+    }
+    return 0;
+}
@@ -35,14 +35,21 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::appendMemoryCopyBlitRegion;
     using BaseClass::appendSignalEventPostWalker;
     using BaseClass::applyMemoryRangesBarrier;
+    using BaseClass::closed;
     using BaseClass::commandListPerThreadScratchSize;
     using BaseClass::commandListPreemptionMode;
+    using BaseClass::containsHeapAddressReferences;
     using BaseClass::engineGroupType;
+    using BaseClass::executionCache;
     using BaseClass::getAlignedAllocation;
     using BaseClass::getAllocationFromHostPtrMap;
     using BaseClass::getHostPtrAlloc;
     using BaseClass::hostPtrMap;
+    using BaseClass::indirectAllocationsAllowed;
     using BaseClass::initialize;
+    using BaseClass::mutableKernelLaunches;
+    using BaseClass::unifiedMemoryControls;
+    using BaseClass::walkerCmdOffsets;
 
     WhiteBox() : ::L0::CommandListCoreFamily<gfxCoreFamily>(BaseClass::defaultNumIddsPerBlock) {}
 };
@@ -196,6 +203,7 @@ struct MockCommandList : public CommandList {
     ADDMETHOD_NOBASE(appendPageFaultCopy, ze_result_t, ZE_RESULT_SUCCESS,
                      (NEO::GraphicsAllocation * dstptr,
                       NEO::GraphicsAllocation *srcptr,
+                      size_t offset,
                       size_t size,
                       bool flushHost));
 
@@ -310,6 +318,31 @@ struct MockCommandList : public CommandList {
                      (void *dstPtr,
                       uint64_t value));
 
+    ADDMETHOD_NOBASE(getLastKernelLaunchId, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t * pLaunchId));
+
+    ADDMETHOD_NOBASE(updateKernelLaunchArgument, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t launchId,
+                      uint32_t argIndex,
+                      size_t argSize,
+                      const void *pArgValue));
+
+    ADDMETHOD_NOBASE(updateKernelLaunchGroupCount, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t launchId,
+                      const ze_group_count_t *pThreadGroupDimensions));
+
+    ADDMETHOD_NOBASE(updateKernelLaunchSignalEvent, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t launchId,
+                      ze_event_handle_t hSignalEvent));
+
+    ADDMETHOD_NOBASE(updateKernelLaunchWaitEvents, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t launchId,
+                      uint32_t numWaitEvents,
+                      ze_event_handle_t *phWaitEvents));
+
+    ADDMETHOD_NOBASE(clone, ze_result_t, ZE_RESULT_SUCCESS,
+                     (L0::CommandList * &clonedCommandList));
+
     ADDMETHOD_NOBASE(executeCommandListImmediate, ze_result_t, ZE_RESULT_SUCCESS,
                      (bool perforMigration));
 
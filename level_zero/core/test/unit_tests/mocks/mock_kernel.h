@@ -29,6 +29,7 @@ struct WhiteBox<::L0::KernelImmutableData> : public ::L0::KernelImmutableData {
     using ::L0::KernelImmutableData::kernelDescriptor;
     using ::L0::KernelImmutableData::KernelImmutableData;
     using ::L0::KernelImmutableData::kernelInfo;
+    using ::L0::KernelImmutableData::patchedIsa;
     using ::L0::KernelImmutableData::residencyContainer;
     using ::L0::KernelImmutableData::surfaceStateHeapSize;
     using ::L0::KernelImmutableData::surfaceStateHeapTemplate;
@@ -40,6 +41,7 @@ template <>
 struct WhiteBox<::L0::Kernel> : public ::L0::KernelImp {
     using BaseClass = ::L0::KernelImp;
     using BaseClass::BaseClass;
+    using ::L0::KernelImp::argBufferCache;
     using ::L0::KernelImp::createPrintfBuffer;
     using ::L0::KernelImp::crossThreadData;
     using ::L0::KernelImp::crossThreadDataSize;
@@ -22,6 +22,7 @@ template <>
 struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass = ::L0::ModuleImp;
     using BaseClass::BaseClass;
+    using BaseClass::buildPending;
     using BaseClass::device;
     using BaseClass::exportedFunctionsSurface;
     using BaseClass::isFullyLinked;
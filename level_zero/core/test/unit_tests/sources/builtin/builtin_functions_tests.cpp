@@ -281,5 +281,60 @@ HWTEST_F(TestBuiltinFunctionsLibImplDefault, GivenBuiltinsWhenInitializingFuncti
     EXPECT_EQ(ModuleType::Builtin, testDevice.typeCreated);
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImplDefault, GivenBuiltinsFromSameSourceWhenInitializingFunctionsThenSingleModuleIsCreatedPerSource) {
+    struct MockDeviceWithBuilins : public Mock<DeviceImp> {
+        MockDeviceWithBuilins(L0::Device *device) : Mock(device->getNEODevice(), static_cast<NEO::ExecutionEnvironment *>(device->getExecEnvironment())) {
+            driverHandle = device->getDriverHandle();
+            builtins = BuiltinFunctionsLib::create(this, neoDevice->getBuiltIns());
+        }
+
+        ze_result_t createModule(const ze_module_desc_t *desc,
+                                 ze_module_handle_t *module,
+                                 ze_module_build_log_handle_t *buildLog, ModuleType type) override {
+            createModuleCalled++;
+            return DeviceImp::createModule(desc, module, buildLog, type);
+        }
+
+        uint32_t createModuleCalled = 0;
+    };
+
+    MockDeviceWithBuilins testDevice(device);
+    L0::Device *testDevicePtr = &testDevice;
+    testDevice.builtins.reset(new BuiltinFunctionsLibImpl(testDevicePtr, neoDevice->getBuiltIns()));
+    testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(Builtin::FillBufferImmediate);
+    testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(Builtin::FillBufferSSHOffset);
+    testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(Builtin::FillBufferMiddle);
+    testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(Builtin::FillBufferRightLeftover);
+    EXPECT_EQ(1u, testDevice.createModuleCalled);
+
+    testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(Builtin::CopyBufferBytes);
+    testDevice.getBuiltinFunctionsLib()->initPageFaultFunction();
+    EXPECT_EQ(2u, testDevice.createModuleCalled);
+
+    EXPECT_NE(testDevice.getBuiltinFunctionsLib()->getFunction(Builtin::FillBufferImmediate), testDevice.getBuiltinFunctionsLib()->getFunction(Builtin::FillBufferMiddle));
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImplDefault, givenAsyncInitWhenItIsFinishedThenAllBuiltinFunctionsAreLoaded) {
+    mockBuiltinFunctionsLibImpl->initBuiltinsAsync();
+    mockBuiltinFunctionsLibImpl->waitForAsyncInit();
+
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[builtId]);
+    }
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImplDefault, givenAsyncBuiltinsInitDebugFlagWhenCreatingDeviceThenBuiltinFunctionsAreAvailable) {
+    DebugManagerStateRestore dgbRestorer;
+    NEO::DebugManager.flags.EnableAsyncBuiltinsInit.set(1);
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->compilerInterface.reset(new NEO::MockCompilerInterfaceSpirv());
+    std::unique_ptr<L0::Device> testDevice(Device::create(device->getDriverHandle(), neoDevice, std::numeric_limits<uint32_t>::max(), false, &returnValue));
+
+    auto lock = testDevice->getBuiltinFunctionsLib()->obtainUniqueOwnership();
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        EXPECT_NE(nullptr, testDevice->getBuiltinFunctionsLib()->getFunction(static_cast<L0::Builtin>(builtId)));
+    }
+}
+
 } // namespace ult
 } // namespace L0
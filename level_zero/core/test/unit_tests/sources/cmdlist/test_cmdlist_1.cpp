@@ -9,11 +9,13 @@
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/unit_test/page_fault_manager/mock_cpu_page_fault_manager.h"
 
 #include "opencl/test/unit_test/mocks/mock_compilers.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/builtin/builtin_functions_lib_impl.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/event/event.h"
@@ -24,6 +26,8 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_context.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_device_for_spirv.h"
 
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -173,6 +177,100 @@ TEST_F(CommandListCreate, givenValidPtrThenAppendMemoryPrefetchReturnsSuccess) {
     ASSERT_EQ(res, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(CommandListCreate, givenSharedAllocationWhenAppendingMemoryPrefetchThenAllocationIsAddedToResidencyForMigration) {
+    size_t size = 4096;
+    void *ptr = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto res = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, 0u, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    void *devicePtr = nullptr;
+    res = context->allocDeviceMem(device->toHandle(), &deviceDesc, size, 0u, &devicePtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+
+    auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    auto sharedAllocation = svmAllocsManager->getSVMAlloc(ptr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    auto deviceAllocation = svmAllocsManager->getSVMAlloc(devicePtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    res = commandList->appendMemoryPrefetch(ptr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    res = commandList->appendMemoryPrefetch(devicePtr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), sharedAllocation));
+    EXPECT_EQ(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), deviceAllocation));
+
+    context->freeMem(devicePtr);
+    context->freeMem(ptr);
+}
+
+struct MemAdvisePageFaultManager : public MockPageFaultManager {
+    void setReadMostly(void *ptr, bool readMostly) override {
+        setReadMostlyCalled++;
+        advisedPtr = ptr;
+        this->readMostly = readMostly;
+    }
+    void setPreferredGpuLocation(void *ptr, bool gpuPreferred) override {
+        setPreferredGpuLocationCalled++;
+        advisedPtr = ptr;
+        this->gpuPreferred = gpuPreferred;
+    }
+    uint32_t setReadMostlyCalled = 0;
+    uint32_t setPreferredGpuLocationCalled = 0;
+    void *advisedPtr = nullptr;
+    bool readMostly = false;
+    bool gpuPreferred = false;
+};
+
+TEST_F(CommandListCreate, givenSharedAllocationWhenAppendingMemAdviseThenAdviceIsPassedToPageFaultManager) {
+    size_t size = 4096;
+    void *ptr = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto res = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, 0u, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    auto memoryManager = device->getDriverHandle()->getMemoryManager();
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    auto mockPageFaultManager = new MemAdvisePageFaultManager;
+    mockMemoryManager->pageFaultManager.reset(mockPageFaultManager);
+    device->getDriverHandle()->setMemoryManager(mockMemoryManager.get());
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_READ_MOSTLY));
+    EXPECT_EQ(1u, mockPageFaultManager->setReadMostlyCalled);
+    EXPECT_EQ(ptr, mockPageFaultManager->advisedPtr);
+    EXPECT_TRUE(mockPageFaultManager->readMostly);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_CLEAR_READ_MOSTLY));
+    EXPECT_EQ(2u, mockPageFaultManager->setReadMostlyCalled);
+    EXPECT_FALSE(mockPageFaultManager->readMostly);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION));
+    EXPECT_EQ(1u, mockPageFaultManager->setPreferredGpuLocationCalled);
+    EXPECT_TRUE(mockPageFaultManager->gpuPreferred);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_CLEAR_PREFERRED_LOCATION));
+    EXPECT_EQ(2u, mockPageFaultManager->setPreferredGpuLocationCalled);
+    EXPECT_FALSE(mockPageFaultManager->gpuPreferred);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_BIAS_CACHED));
+    EXPECT_EQ(2u, mockPageFaultManager->setReadMostlyCalled);
+    EXPECT_EQ(2u, mockPageFaultManager->setPreferredGpuLocationCalled);
+
+    device->getDriverHandle()->setMemoryManager(memoryManager);
+    context->freeMem(ptr);
+}
+
 TEST_F(CommandListCreate, givenImmediateCommandListThenInternalEngineIsUsedIfRequested) {
     const ze_command_queue_desc_t desc = {};
     bool internalEngine = true;
@@ -231,6 +329,42 @@ TEST_F(CommandListCreate, givenNonInternalUsageCommandListThenIsInternalReturnsF
     EXPECT_FALSE(commandList0->isInternal());
 }
 
+TEST_F(CommandListCreate, givenConcurrentAppendsDescWhenCreatingImmediateCommandListThenEachThreadGetsOwnCommandListOnSameEngine) {
+    ze_command_list_concurrent_appends_exp_desc_t concurrentAppendsDesc = {};
+    concurrentAppendsDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_CONCURRENT_APPENDS_EXP_DESC;
+    ze_command_queue_desc_t desc = {};
+    desc.pNext = &concurrentAppendsDesc;
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_TRUE(commandList->areConcurrentAppendsAllowed());
+    auto csr = static_cast<CommandQueueImp *>(commandList->cmdQImmediate)->getCsr();
+
+    auto threadCommandList = commandList->getThreadCommandList();
+    ASSERT_NE(nullptr, threadCommandList);
+    EXPECT_EQ(threadCommandList, commandList->getThreadCommandList());
+    EXPECT_FALSE(threadCommandList->areConcurrentAppendsAllowed());
+    EXPECT_EQ(CommandList::CommandListType::TYPE_IMMEDIATE, threadCommandList->cmdListType);
+    EXPECT_EQ(csr, static_cast<CommandQueueImp *>(threadCommandList->cmdQImmediate)->getCsr());
+
+    CommandList *otherThreadCommandList = nullptr;
+    std::thread otherThread([&]() { otherThreadCommandList = commandList->getThreadCommandList(); });
+    otherThread.join();
+    ASSERT_NE(nullptr, otherThreadCommandList);
+    EXPECT_NE(threadCommandList, otherThreadCommandList);
+    EXPECT_EQ(csr, static_cast<CommandQueueImp *>(otherThreadCommandList->cmdQImmediate)->getCsr());
+}
+
+TEST_F(CommandListCreate, givenImmediateCommandListWithoutConcurrentAppendsDescThenConcurrentAppendsAreNotAllowed) {
+    const ze_command_queue_desc_t desc = {};
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_FALSE(commandList->areConcurrentAppendsAllowed());
+}
+
 TEST_F(CommandListCreate, givenImmediateCommandListThenCustomNumIddPerBlockUsed) {
     const ze_command_queue_desc_t desc = {};
 
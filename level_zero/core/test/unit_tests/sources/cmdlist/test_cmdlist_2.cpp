@@ -991,6 +991,41 @@ HWTEST2_F(CommandListCreate, givenCopyCommandListWhenCopyRegionGreaterThanMaxBli
     EXPECT_NE(cmdList.end(), itor);
 }
 
+HWTEST2_F(CommandListCreate, givenCopyCommandListWhenCopyRegionRowsExceedMaxBlitWidthThenMultiRowBlitsAreUsedWhenTheyNeedFewerCommands, BlitBlockCopyPlatforms) {
+    using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
+    using XY_COPY_BLT = typename GfxFamily::XY_COPY_BLT;
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::Copy);
+    uint32_t offsetX = 0x1;
+    uint32_t offsetY = 0x1;
+    Vec3<size_t> copySize = {BlitterConstants::maxBlitWidth + 0x100, 0x10, 1};
+    ze_copy_region_t srcRegion = {offsetX, offsetY, 0, static_cast<uint32_t>(copySize.x), static_cast<uint32_t>(copySize.y), static_cast<uint32_t>(copySize.z)};
+    ze_copy_region_t dstRegion = srcRegion;
+    Vec3<uint32_t> srcSize = {2 * BlitterConstants::maxBlitWidth, 2 * BlitterConstants::maxBlitHeight, 1};
+    Vec3<uint32_t> dstSize = srcSize;
+    NEO::MockGraphicsAllocation mockAllocationSrc(0, NEO::GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
+                                                  reinterpret_cast<void *>(0x1234), 0x1000, 0, sizeof(uint32_t),
+                                                  MemoryPool::System4KBPages);
+    NEO::MockGraphicsAllocation mockAllocationDst(0, NEO::GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
+                                                  reinterpret_cast<void *>(0x1234), 0x1000, 0, sizeof(uint32_t),
+                                                  MemoryPool::System4KBPages);
+    size_t rowPitch = 2 * BlitterConstants::maxBlitWidth;
+    size_t slicePitch = rowPitch * srcSize.y;
+    commandList->appendMemoryCopyBlitRegion(&mockAllocationDst, &mockAllocationSrc, 0, 0, srcRegion, dstRegion, copySize, rowPitch, slicePitch, rowPitch, slicePitch, srcSize, dstSize, nullptr, 0, nullptr);
+    GenCmdList cmdList;
+
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, ptrOffset(commandList->commandContainer.getCommandStream()->getCpuBase(), 0), commandList->commandContainer.getCommandStream()->getUsed()));
+    auto blitCommands = findAll<XY_COPY_BLT *>(cmdList.begin(), cmdList.end());
+
+    auto &rootDeviceEnvironment = *device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()];
+    auto expectedBlitsCount = std::min(NEO::BlitCommandsHelper<GfxFamily>::getNumberOfBlitsForCopyRegion(copySize, rootDeviceEnvironment),
+                                       NEO::BlitCommandsHelper<GfxFamily>::getNumberOfBlitsForCopyPerRow(copySize, rootDeviceEnvironment));
+    EXPECT_EQ(expectedBlitsCount, blitCommands.size());
+    EXPECT_LT(blitCommands.size(), copySize.y);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 class MockCommandListForRegionSize : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>> {
   public:
@@ -6,7 +6,9 @@
  */
 
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
@@ -1165,6 +1167,75 @@ HWTEST2_F(HostPointerManagerCommandListTest,
     EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
 }
 
+HWTEST2_F(HostPointerManagerCommandListTest,
+          givenImplicitHostPointerImportEnabledWhenGettingAlignedAllocationForNotImportedPointerThenPointerIsImportedAndReusedAcrossCommandLists,
+          Platforms) {
+    DebugManager.flags.EnableImplicitHostPointerImport.set(1);
+
+    auto commandList = std::make_unique<::L0::ult::CommandListCoreFamily<gfxCoreFamily>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+    auto otherCommandList = std::make_unique<::L0::ult::CommandListCoreFamily<gfxCoreFamily>>();
+    otherCommandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    size_t offset = 100u;
+    void *offsetPointer = ptrOffset(heapPointer, offset);
+
+    AlignedAllocationData outData = commandList->getAlignedAllocation(device, offsetPointer, MemoryConstants::pageSize);
+    auto hostAllocation = hostDriverHandle->findHostPointerAllocation(offsetPointer, MemoryConstants::pageSize, device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, hostAllocation);
+    EXPECT_EQ(hostAllocation, outData.alloc);
+    EXPECT_EQ(static_cast<uintptr_t>(hostAllocation->getGpuAddress()), outData.alignedAllocationPtr);
+    EXPECT_EQ(offset, outData.offset);
+    EXPECT_TRUE(outData.needsFlush);
+    EXPECT_EQ(0u, commandList->hostPtrMap.size());
+    EXPECT_EQ(1u, openHostPointerManager->hostPointerAllocations.getNumAllocs());
+
+    outData = otherCommandList->getAlignedAllocation(device, offsetPointer, MemoryConstants::pageSize);
+    EXPECT_EQ(hostAllocation, outData.alloc);
+    EXPECT_EQ(0u, otherCommandList->hostPtrMap.size());
+    EXPECT_EQ(1u, openHostPointerManager->hostPointerAllocations.getNumAllocs());
+
+    auto ret = hostDriverHandle->releaseImportedPointer(offsetPointer);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    EXPECT_EQ(0u, openHostPointerManager->hostPointerAllocations.getNumAllocs());
+}
+
+HWTEST2_F(HostPointerManagerCommandListTest,
+          givenImplicitHostPointerImportDisabledWhenGettingAlignedAllocationForNotImportedPointerThenCommandListAllocationIsCreated,
+          Platforms) {
+    DebugManager.flags.EnableImplicitHostPointerImport.set(0);
+
+    auto commandList = std::make_unique<::L0::ult::CommandListCoreFamily<gfxCoreFamily>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    AlignedAllocationData outData = commandList->getAlignedAllocation(device, heapPointer, MemoryConstants::pageSize);
+    EXPECT_NE(nullptr, outData.alloc);
+    EXPECT_EQ(1u, commandList->hostPtrMap.size());
+    EXPECT_EQ(0u, openHostPointerManager->hostPointerAllocations.getNumAllocs());
+}
+
+HWTEST2_F(HostPointerManagerCommandListTest,
+          givenImplicitlyImportedHostPointerWhenReleasingImplicitAllocationsThenOnlyImplicitImportsAreFreed,
+          Platforms) {
+    DebugManager.flags.EnableImplicitHostPointerImport.set(1);
+
+    auto ret = hostDriverHandle->importExternalPointer(heapPointer, MemoryConstants::pageSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+
+    void *implicitPointer = ptrOffset(heapPointer, 2 * MemoryConstants::pageSize);
+    auto implicitAllocation = hostDriverHandle->importImplicitHostPointer(implicitPointer, MemoryConstants::pageSize, device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, implicitAllocation);
+    EXPECT_EQ(2u, openHostPointerManager->hostPointerAllocations.getNumAllocs());
+
+    openHostPointerManager->freeImplicitHostPointerAllocations();
+    EXPECT_EQ(1u, openHostPointerManager->hostPointerAllocations.getNumAllocs());
+    EXPECT_EQ(nullptr, hostDriverHandle->findHostPointerAllocation(implicitPointer, MemoryConstants::pageSize, device->getRootDeviceIndex()));
+    EXPECT_NE(nullptr, hostDriverHandle->findHostPointerAllocation(heapPointer, MemoryConstants::pageSize, device->getRootDeviceIndex()));
+
+    ret = hostDriverHandle->releaseImportedPointer(heapPointer);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+}
+
 HWTEST2_F(HostPointerManagerCommandListTest, givenCommandListWhenMemoryFillWithSignalAndWaitEventsUsingRenderEngineThenPipeControlIsFound, Platforms) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
 
@@ -1474,5 +1545,98 @@ HWTEST2_F(HostPointerManagerCommandListTest, givenImmediateCommandListWhenMemory
     commandList->cmdQImmediate = nullptr;
 }
 
+HWTEST2_F(CommandListCreate, givenFlushTaskSubmissionEnabledWhenAppendingToImmediateCommandListThenCommandStreamIsSubmittedWithFlushTaskFromLastOffset, Platforms) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableFlushTaskSubmission.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_TRUE(commandList->isFlushTaskSubmissionEnabled);
+
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(commandList->cmdQImmediate)->getCsr());
+    auto commandStream = commandList->commandContainer.getCommandStream();
+    auto taskCount = csr->peekTaskCount();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(taskCount + 1, csr->peekTaskCount());
+    EXPECT_EQ(commandStream, csr->lastFlushedCommandStream);
+    EXPECT_TRUE(commandList->commandContainer.getResidencyContainer().empty());
+
+    auto usedAfterFirstAppend = commandStream->getUsed();
+    EXPECT_NE(0u, usedAfterFirstAppend);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(taskCount + 2, csr->peekTaskCount());
+    EXPECT_LT(usedAfterFirstAppend, commandStream->getUsed());
+    EXPECT_EQ(1u, commandList->commandContainer.getCmdBufferAllocations().size());
+}
+
+HWTEST2_F(CommandListCreate, givenFlushTaskSubmissionDisabledWhenCreatingImmediateCommandListThenFlushTaskSubmissionIsNotUsed, Platforms) {
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_FALSE(commandList->isFlushTaskSubmissionEnabled);
+}
+
+HWTEST2_F(CommandListCreate, givenZeroInitDeviceMemoryWhenWholeAllocationIsOverwrittenByFirstCopyThenZeroInitIsSkipped, Platforms) {
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, result));
+
+    ze_device_mem_alloc_zero_init_exp_desc_t zeroInitDesc = {};
+    zeroInitDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_ZERO_INIT_EXP_DESC;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    void *srcBuffer = nullptr;
+    void *dstBuffer = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 16384u, 4096u, &srcBuffer));
+    deviceDesc.pNext = &zeroInitDesc;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 16384u, 4096u, &dstBuffer));
+    auto dstAllocation = driverHandle->svmAllocsManager->getSVMAlloc(dstBuffer)->gpuAllocations.getDefaultGraphicsAllocation();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemoryCopy(ptrOffset(dstBuffer, 4096u), srcBuffer, 4096u, nullptr, 0, nullptr));
+    EXPECT_TRUE(dstAllocation->isZeroInitPending());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemoryCopy(dstBuffer, srcBuffer, 16384u, nullptr, 0, nullptr));
+    EXPECT_TRUE(dstAllocation->isZeroInitPending());
+
+    commandList->reset();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemoryCopy(dstBuffer, srcBuffer, 16384u, nullptr, 0, nullptr));
+    EXPECT_FALSE(dstAllocation->isZeroInitPending());
+
+    context->freeMem(srcBuffer);
+    context->freeMem(dstBuffer);
+}
+
+HWTEST2_F(CommandListCreate, givenZeroInitDeviceMemoryInResidencyWhenInitializingPendingZeroAllocationsThenMemoryIsZeroedOnce, Platforms) {
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, result));
+
+    ze_device_mem_alloc_zero_init_exp_desc_t zeroInitDesc = {};
+    zeroInitDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_ZERO_INIT_EXP_DESC;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    deviceDesc.pNext = &zeroInitDesc;
+    void *buffer = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 4096u, &buffer));
+    auto allocation = driverHandle->svmAllocsManager->getSVMAlloc(buffer)->gpuAllocations.getDefaultGraphicsAllocation();
+    memset(allocation->getUnderlyingBuffer(), 0xff, allocation->getUnderlyingBufferSize());
+
+    commandList->commandContainer.addToResidencyContainer(allocation);
+    commandList->initializePendingZeroAllocations();
+    EXPECT_FALSE(allocation->isZeroInitPending());
+    auto data = reinterpret_cast<uint8_t *>(allocation->getUnderlyingBuffer());
+    std::vector<uint8_t> zeros(allocation->getUnderlyingBufferSize(), 0u);
+    EXPECT_EQ(0, memcmp(zeros.data(), data, zeros.size()));
+
+    data[0] = 0xff;
+    commandList->initializePendingZeroAllocations();
+    EXPECT_EQ(0xffu, data[0]);
+
+    context->freeMem(buffer);
+}
+
 } // namespace ult
 } // namespace L0
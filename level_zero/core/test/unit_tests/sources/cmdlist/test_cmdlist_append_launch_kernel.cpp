@@ -743,6 +743,171 @@ HWTEST_F(CommandListAppendLaunchKernel, WhenAddingKernelsThenResidencyContainerD
 
 using CommandListArbitrationPolicyTest = Test<ModuleFixture>;
 
+HWTEST2_F(CommandListAppendLaunchKernel, givenRegularCommandListWhenAppendingKernelThenLaunchIsRecordedUntilReset, SklPlusMatcher) {
+    Mock<::L0::Kernel> kernel;
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    uint64_t launchId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->getLastKernelLaunchId(&launchId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->getLastKernelLaunchId(&launchId));
+    EXPECT_EQ(1u, launchId);
+    ASSERT_EQ(2u, commandList->mutableKernelLaunches.size());
+    EXPECT_EQ(&kernel, commandList->mutableKernelLaunches[1].kernel);
+    EXPECT_NE(nullptr, commandList->mutableKernelLaunches[1].encodedData.walkerCmd);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunchGroupCount(2u, &groupCount));
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->mutableKernelLaunches.empty());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunchGroupCount(0u, &groupCount));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenRecordedKernelLaunchWhenUpdatingGroupCountThenWalkerAndCrossThreadDataArePatched, SklPlusMatcher) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    Mock<::L0::Kernel> kernel;
+    kernel.crossThreadDataSize = 32u;
+    kernel.groupSize[0] = 4u;
+    kernel.groupSize[1] = 1u;
+    kernel.groupSize[2] = 1u;
+    kernel.descriptor.payloadMappings.dispatchTraits.numWorkGroups[0] = 0u;
+    kernel.descriptor.payloadMappings.dispatchTraits.globalWorkSize[0] = 4u;
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr));
+    commandList->close();
+
+    ze_group_count_t newGroupCount{8, 2, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateKernelLaunchGroupCount(0u, &newGroupCount));
+
+    auto &launch = commandList->mutableKernelLaunches[0];
+    auto walkerCmd = reinterpret_cast<WALKER_TYPE *>(launch.encodedData.walkerCmd);
+    EXPECT_EQ(8u, walkerCmd->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walkerCmd->getThreadGroupIdYDimension());
+    EXPECT_EQ(1u, walkerCmd->getThreadGroupIdZDimension());
+
+    auto crossThreadData = reinterpret_cast<uint32_t *>(launch.encodedData.crossThreadData);
+    EXPECT_EQ(8u, crossThreadData[0]);
+    EXPECT_EQ(32u, crossThreadData[1]);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenRecordedKernelLaunchWithSignalEventWhenUpdatingSignalEventThenPostSyncAddressIsPatched, SklPlusMatcher) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    using POST_SYNC_OPERATION = typename PIPE_CONTROL::POST_SYNC_OPERATION;
+    Mock<::L0::Kernel> kernel;
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 2;
+    ze_event_desc_t eventDesc = {};
+    std::unique_ptr<EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc));
+    eventDesc.index = 0;
+    std::unique_ptr<Event> event(Event::create(eventPool.get(), &eventDesc, device));
+    eventDesc.index = 1;
+    std::unique_ptr<Event> newEvent(Event::create(eventPool.get(), &eventDesc, device));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, event->toHandle(), 0, nullptr));
+    commandList->close();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateKernelLaunchSignalEvent(0u, newEvent->toHandle()));
+
+    auto &signalEventCmds = commandList->mutableKernelLaunches[0].signalEventCmds;
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, signalEventCmds.cmds, signalEventCmds.size));
+    auto itorPC = findAll<PIPE_CONTROL *>(cmdList.begin(), cmdList.end());
+    bool postSyncFound = false;
+    for (auto it : itorPC) {
+        auto cmd = genCmdCast<PIPE_CONTROL *>(*it);
+        if (cmd->getPostSyncOperation() == POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA) {
+            auto gpuAddress = newEvent->getGpuAddress(device);
+            EXPECT_EQ(cmd->getAddressHigh(), gpuAddress >> 32u);
+            EXPECT_EQ(cmd->getAddress(), uint32_t(gpuAddress));
+            postSyncFound = true;
+        }
+    }
+    EXPECT_TRUE(postSyncFound);
+
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), &newEvent->getAllocation(device)));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenClosedCommandListWhenCloningThenCommandsAndHeapsAreCopiedAndLaunchesAreUpdatedIndependently, SklPlusMatcher) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    Mock<::L0::Kernel> kernel;
+    kernel.crossThreadDataSize = 32u;
+    kernel.groupSize[0] = 4u;
+    kernel.groupSize[1] = 1u;
+    kernel.groupSize[2] = 1u;
+    kernel.descriptor.payloadMappings.dispatchTraits.numWorkGroups[0] = 0u;
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr));
+    L0::CommandList *clone = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->clone(clone));
+    commandList->close();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->clone(clone));
+    ASSERT_NE(nullptr, clone);
+    std::unique_ptr<L0::CommandList> clonedCommandList(clone);
+
+    auto &container = commandList->commandContainer;
+    auto &clonedContainer = clonedCommandList->commandContainer;
+    EXPECT_EQ(container.getCommandStream()->getUsed(), clonedContainer.getCommandStream()->getUsed());
+    for (auto heapType : {NEO::HeapType::DYNAMIC_STATE, NEO::HeapType::INDIRECT_OBJECT, NEO::HeapType::SURFACE_STATE}) {
+        EXPECT_EQ(container.getIndirectHeap(heapType)->getUsed(), clonedContainer.getIndirectHeap(heapType)->getUsed());
+    }
+    auto &clonedResidency = clonedContainer.getResidencyContainer();
+    EXPECT_EQ(clonedResidency.end(), std::find(clonedResidency.begin(), clonedResidency.end(), container.getCmdBufferAllocations()[0]));
+    EXPECT_NE(clonedResidency.end(), std::find(clonedResidency.begin(), clonedResidency.end(), kernel.getImmutableData()->getIsaGraphicsAllocation()));
+
+    auto walkerCmdOffset = commandList->walkerCmdOffsets[0];
+    auto walkerCmd = reinterpret_cast<WALKER_TYPE *>(ptrOffset(container.getCommandStream()->getCpuBase(), walkerCmdOffset));
+    auto clonedWalkerCmd = reinterpret_cast<WALKER_TYPE *>(ptrOffset(clonedContainer.getCommandStream()->getCpuBase(), walkerCmdOffset));
+    auto ioh = container.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+    auto clonedIoh = clonedContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+    EXPECT_EQ(walkerCmd->getIndirectDataStartAddress() - ioh->getHeapGpuStartOffset(),
+              clonedWalkerCmd->getIndirectDataStartAddress() - clonedIoh->getHeapGpuStartOffset());
+
+    ze_group_count_t newGroupCount{8, 2, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, clonedCommandList->updateKernelLaunchGroupCount(0u, &newGroupCount));
+    EXPECT_EQ(8u, clonedWalkerCmd->getThreadGroupIdXDimension());
+    EXPECT_EQ(1u, walkerCmd->getThreadGroupIdXDimension());
+    auto crossThreadData = reinterpret_cast<uint32_t *>(commandList->mutableKernelLaunches[0].encodedData.crossThreadData);
+    auto clonedCrossThreadData = reinterpret_cast<uint32_t *>(ptrOffset(clonedIoh->getCpuBase(), ptrDiff(crossThreadData, ioh->getCpuBase())));
+    EXPECT_EQ(8u, clonedCrossThreadData[0]);
+    EXPECT_EQ(1u, crossThreadData[0]);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenCommandListWithIndirectLaunchWhenCloningThenUnsupportedFeatureIsReturned, SklPlusMatcher) {
+    Mock<::L0::Kernel> kernel;
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernelWithParams(kernel.toHandle(), &groupCount, nullptr, true, false, false));
+    EXPECT_TRUE(commandList->containsHeapAddressReferences);
+    commandList->close();
+
+    L0::CommandList *clone = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->clone(clone));
+    EXPECT_EQ(nullptr, clone);
+
+    commandList->reset();
+    EXPECT_FALSE(commandList->containsHeapAddressReferences);
+    EXPECT_FALSE(commandList->closed);
+    EXPECT_TRUE(commandList->walkerCmdOffsets.empty());
+}
+
 HWTEST_F(CommandListArbitrationPolicyTest, whenCreatingCommandListThenDefaultThreadArbitrationPolicyIsUsed) {
     using STATE_BASE_ADDRESS = typename FamilyType::STATE_BASE_ADDRESS;
 
@@ -53,6 +53,53 @@ HWTEST_F(CommandListAppendWaitOnEvent, WhenAppendingWaitOnEventThenSemaphoreWait
     }
 }
 
+HWTEST_F(CommandListAppendWaitOnEvent, givenCounterBasedEventWhenAppendingSignalAndWaitThenOnlySingleGreaterOrEqualSemaphoreOnCsrTagIsProgrammed) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    ze_event_pool_counter_based_exp_desc_t counterBasedDesc = {};
+    counterBasedDesc.stype = ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.pNext = &counterBasedDesc;
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    ze_event_desc_t eventDesc = {};
+
+    std::unique_ptr<EventPool> counterBasedEventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc));
+    std::unique_ptr<Event> counterBasedEvent(Event::create(counterBasedEventPool.get(), &eventDesc, device));
+    ze_event_handle_t hEventHandle = counterBasedEvent->toHandle();
+
+    auto commandStream = commandList->commandContainer.getCommandStream();
+    auto usedSpaceBefore = commandStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendSignalEvent(hEventHandle));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendEventReset(hEventHandle));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendWaitOnEvents(1, &hEventHandle));
+    EXPECT_EQ(usedSpaceBefore, commandStream->getUsed());
+    ASSERT_EQ(1u, commandList->getCounterBasedSignalEvents().size());
+    EXPECT_EQ(counterBasedEvent.get(), commandList->getCounterBasedSignalEvents()[0]);
+
+    auto csr = static_cast<DeviceImp *>(device)->neoDevice->getDefaultEngine().commandStreamReceiver;
+    counterBasedEvent->assignCounter(*csr, 7u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendWaitOnEvents(1, &hEventHandle));
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(commandStream->getCpuBase(), usedSpaceBefore),
+                                                      commandStream->getUsed() - usedSpaceBefore));
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(1u, semaphores.size());
+    auto cmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[0]);
+    EXPECT_EQ(MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD, cmd->getCompareOperation());
+    EXPECT_EQ(7u, cmd->getSemaphoreDataDword());
+    auto addressSpace = device->getHwInfo().capabilityTable.gpuAddressSpace;
+    EXPECT_EQ(csr->getTagAllocation()->getGpuAddress() & addressSpace, cmd->getSemaphoreGraphicsAddress() & addressSpace);
+
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), csr->getTagAllocation()));
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->getCounterBasedSignalEvents().empty());
+}
+
 HWTEST_F(CommandListAppendWaitOnEvent, givenTwoEventsWhenWaitOnEventsAppendedThenTwoSemaphoreWaitCmdsAreGenerated) {
     using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
     auto usedSpaceBefore = commandList->commandContainer.getCommandStream()->getUsed();
@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 
@@ -17,6 +19,7 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 
 #include <limits>
+#include <vector>
 
 namespace L0 {
 namespace ult {
@@ -56,6 +59,7 @@ class AppendFillFixture : public DeviceFixture, public ::testing::Test {
             }
 
             numberOfCallsToAppendLaunchKernelWithParams++;
+            launchedKernels.push_back(hKernel);
             return CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(hKernel,
                                                                                       pThreadGroupDimensions,
                                                                                       hEvent,
@@ -66,8 +70,13 @@ class AppendFillFixture : public DeviceFixture, public ::testing::Test {
 
         uint32_t thresholdOfCallsToAppendLaunchKernelWithParamsToFail = std::numeric_limits<uint32_t>::max();
         uint32_t numberOfCallsToAppendLaunchKernelWithParams = 0;
+        std::vector<ze_kernel_handle_t> launchedKernels;
     };
 
+    ze_kernel_handle_t getBuiltinHandle(Builtin builtin) {
+        return device->getBuiltinFunctionsLib()->getFunction(builtin)->toHandle();
+    }
+
     void SetUp() override {
         dstPtr = new uint8_t[allocSize];
         immediateDstPtr = new uint8_t[allocSize];
@@ -211,5 +220,61 @@ HWTEST2_F(AppendFillFixture,
     delete[] nonMultipleDstPtr;
 }
 
+HWTEST2_F(AppendFillFixture,
+          givenAlignedDestinationWhenAppendingMemoryFillThenWideStoresAndSingleLeftoverDispatchAreUsed, Platforms) {
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    constexpr size_t fillSize = 1000;
+    auto alignedDstPtr = alignedMalloc(fillSize, MemoryConstants::pageSize);
+    uint8_t widePattern[128] = {1, 2, 3, 4};
+
+    auto result = commandList->appendMemoryFill(alignedDstPtr, widePattern, sizeof(widePattern), fillSize, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_EQ(2u, commandList->launchedKernels.size());
+    EXPECT_EQ(getBuiltinHandle(Builtin::FillBufferMiddleWide), commandList->launchedKernels[0]);
+    EXPECT_EQ(getBuiltinHandle(Builtin::FillBufferRightLeftover), commandList->launchedKernels[1]);
+
+    alignedFree(alignedDstPtr);
+}
+
+HWTEST2_F(AppendFillFixture,
+          givenMisalignedDestinationWhenAppendingMemoryFillThenDwordStoresAreUsed, Platforms) {
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    constexpr size_t fillSize = 1000;
+    auto alignedDstPtr = alignedMalloc(fillSize + 4, MemoryConstants::pageSize);
+
+    auto result = commandList->appendMemoryFill(ptrOffset(alignedDstPtr, 4), pattern, 4, fillSize, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_LE(1u, commandList->launchedKernels.size());
+    EXPECT_EQ(getBuiltinHandle(Builtin::FillBufferMiddle), commandList->launchedKernels[0]);
+
+    alignedFree(alignedDstPtr);
+}
+
+HWTEST2_F(AppendFillFixture,
+          givenBytePatternWhenAppendingMemoryFillThenOnlyLargeAlignedFillsUseWideStores, Platforms) {
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    constexpr size_t fillSize = 2 * MemoryConstants::pageSize;
+    auto alignedDstPtr = alignedMalloc(fillSize, MemoryConstants::pageSize);
+
+    auto result = commandList->appendMemoryFill(alignedDstPtr, &immediatePattern, sizeof(immediatePattern), fillSize, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_EQ(1u, commandList->launchedKernels.size());
+    EXPECT_EQ(getBuiltinHandle(Builtin::FillBufferMiddleWide), commandList->launchedKernels[0]);
+
+    commandList->launchedKernels.clear();
+    result = commandList->appendMemoryFill(alignedDstPtr, &immediatePattern, sizeof(immediatePattern), immediateAllocSize, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_LE(1u, commandList->launchedKernels.size());
+    EXPECT_EQ(getBuiltinHandle(Builtin::FillBufferImmediate), commandList->launchedKernels[0]);
+
+    alignedFree(alignedDstPtr);
+}
+
 } // namespace ult
 } // namespace L0
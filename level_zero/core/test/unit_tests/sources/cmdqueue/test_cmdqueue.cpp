@@ -8,6 +8,7 @@
 #include "shared/source/command_stream/scratch_space_controller_base.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/preamble.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
@@ -22,6 +23,7 @@
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -72,6 +74,27 @@ TEST_F(CommandQueueCreate, whenCreatingCommandQueueThenItIsInitialized) {
     EXPECT_EQ(returnValue, ZE_RESULT_SUCCESS);
 }
 
+TEST(CommandQueueThrottle, givenDescWithoutThrottleExtensionWhenGettingThrottleThenHighIsReturned) {
+    ze_command_queue_desc_t desc = {};
+    EXPECT_EQ(NEO::QueueThrottle::HIGH, CommandQueueImp::getThrottleFromDesc(&desc));
+}
+
+TEST(CommandQueueThrottle, givenDescWithThrottleExtensionWhenGettingThrottleThenRequestedThrottleIsReturned) {
+    ze_command_queue_throttle_exp_desc_t throttleDesc = {};
+    throttleDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_THROTTLE_EXP_DESC;
+    ze_command_queue_desc_t desc = {};
+    desc.pNext = &throttleDesc;
+
+    throttleDesc.throttle = ZE_COMMAND_QUEUE_THROTTLE_EXP_LOW;
+    EXPECT_EQ(NEO::QueueThrottle::LOW, CommandQueueImp::getThrottleFromDesc(&desc));
+
+    throttleDesc.throttle = ZE_COMMAND_QUEUE_THROTTLE_EXP_MEDIUM;
+    EXPECT_EQ(NEO::QueueThrottle::MEDIUM, CommandQueueImp::getThrottleFromDesc(&desc));
+
+    throttleDesc.throttle = ZE_COMMAND_QUEUE_THROTTLE_EXP_HIGH;
+    EXPECT_EQ(NEO::QueueThrottle::HIGH, CommandQueueImp::getThrottleFromDesc(&desc));
+}
+
 TEST_F(CommandQueueCreate, whenSynchronizeByPollingTaskCountThenCallsPrintOutputOnPrintfFunctionsStoredAndClearsFunctionContainer) {
     const ze_command_queue_desc_t desc{};
     ze_result_t returnValue;
@@ -97,6 +120,26 @@ TEST_F(CommandQueueCreate, whenSynchronizeByPollingTaskCountThenCallsPrintOutput
     commandQueue->destroy();
 }
 
+TEST_F(CommandQueueCreate, givenCsrWithoutKernelFencesWhenExportingOrImportingSyncFileThenUnsupportedFeatureIsReturned) {
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily,
+                                                           device,
+                                                           neoDevice->getDefaultEngine().commandStreamReceiver,
+                                                           &desc,
+                                                           false,
+                                                           false,
+                                                           returnValue));
+    ASSERT_NE(nullptr, commandQueue);
+
+    int syncFileFd = -1;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandQueue->exportSyncFile(&syncFileFd));
+    EXPECT_EQ(-1, syncFileFd);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandQueue->importSyncFile(3));
+
+    commandQueue->destroy();
+}
+
 TEST_F(CommandQueueCreate, whenReserveLinearStreamThenBufferAllocationSwitched) {
     const ze_command_queue_desc_t desc{};
     ze_result_t returnValue;
@@ -724,6 +767,43 @@ TEST_F(DeviceCreateCommandQueueTest, givenNormalPriorityDescWhenCreateCommandQue
     commandQueue->destroy();
 }
 
+HWTEST_F(DeviceCreateCommandQueueTest, givenLeastLoadedEngineSelectionEnabledWhenCreateCommandQueueIsCalledThenEngineWithLeastWorkInFlightIsAssignedUnlessExplicitOnly) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SelectLeastLoadedEngineForCommandQueue.set(1);
+
+    uint32_t engineGroupIndex = 0u;
+    device->mapOrdinalForAvailableEngineGroup(&engineGroupIndex);
+    auto &engineGroup = neoDevice->getEngineGroups()[engineGroupIndex];
+    auto idleEngine = std::find_if(neoDevice->engines.begin(), neoDevice->engines.end(), [](const auto &engine) {
+        return engine.osContext->isLowPriority();
+    });
+    ASSERT_NE(neoDevice->engines.end(), idleEngine);
+    engineGroup.resize(1);
+    engineGroup.push_back(*idleEngine);
+
+    auto busyCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engineGroup[0].commandStreamReceiver);
+    busyCsr->taskCount = 10u;
+    *busyCsr->getTagAddress() = 5u;
+
+    ze_command_queue_desc_t desc{};
+    desc.ordinal = 0u;
+    desc.index = 0u;
+    desc.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+
+    for (auto flags : {ze_command_queue_flags_t{0u}, ze_command_queue_flags_t{ZE_COMMAND_QUEUE_FLAG_EXPLICIT_ONLY}}) {
+        desc.flags = flags;
+        ze_command_queue_handle_t commandQueueHandle = {};
+        ze_result_t res = device->createCommandQueue(&desc, &commandQueueHandle);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+        auto commandQueue = static_cast<CommandQueueImp *>(L0::CommandQueue::fromHandle(commandQueueHandle));
+        ASSERT_NE(nullptr, commandQueue);
+        auto expectedCsr = (flags & ZE_COMMAND_QUEUE_FLAG_EXPLICIT_ONLY) ? busyCsr : idleEngine->commandStreamReceiver;
+        EXPECT_EQ(expectedCsr, commandQueue->getCsr());
+        commandQueue->destroy();
+    }
+    *busyCsr->getTagAddress() = busyCsr->taskCount;
+}
+
 TEST_F(DeviceCreateCommandQueueTest,
        whenCallingGetCsrForOrdinalAndIndexWithInvalidOrdinalThenInvalidArgumentIsReturned) {
     ze_command_queue_desc_t desc{};
@@ -938,6 +1018,33 @@ HWTEST2_F(CommandQueueDestroy, givenCommandQueueAndCommandListWithWhenBindlessEn
     commandList->destroy();
 }
 
+HWTEST2_F(CommandQueueExecuteTest, givenCommandListRequiringL3ConfigWhenExecutedTwiceThenL3IsReprogrammedOnlyWhenConfigDiffers, CommandQueueExecuteTestSupport) {
+    ze_command_queue_desc_t desc = {};
+    NEO::CommandStreamReceiver *csr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    auto commandQueue = new MockCommandQueue<gfxCoreFamily>(device, csr, &desc);
+    commandQueue->initialize(false, false);
+    auto commandList = new CommandListCoreFamily<gfxCoreFamily>();
+    commandList->initialize(device, NEO::EngineGroupType::Compute);
+    auto l3Config = NEO::PreambleHelper<FamilyType>::getL3Config(device->getHwInfo(), true);
+    csr->setLastSentL3Config(l3Config + 1);
+    commandList->commandContainer.initialL3Config = l3Config;
+    commandList->commandContainer.lastSentL3Config = l3Config;
+    commandList->commandContainer.l3ConfigChangesCount = 1u;
+    commandList->close();
+    auto commandListHandle = commandList->toHandle();
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(2u, commandQueue->getL3ConfigChangesCount());
+    EXPECT_EQ(l3Config, csr->peekLastSentL3Config());
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(1u, commandQueue->getL3ConfigChangesCount());
+
+    commandQueue->destroy();
+    commandList->destroy();
+}
+
 using ExecuteCommandListTests = Test<ContextFixture>;
 HWTEST2_F(ExecuteCommandListTests, givenExecuteCommandListWhenItReturnsThenContainersAreEmpty, CommandQueueExecuteTestSupport) {
     ze_command_queue_desc_t desc = {};
@@ -967,6 +1074,99 @@ HWTEST2_F(ExecuteCommandListTests, givenExecuteCommandListWhenItReturnsThenConta
     alignedFree(alloc);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+class MockCommandQueueSubmitBatchBuffer : public MockCommandQueue<gfxCoreFamily> {
+  public:
+    using MockCommandQueue<gfxCoreFamily>::MockCommandQueue;
+
+    void submitBatchBuffer(size_t offset, NEO::ResidencyContainer &residencyContainer, void *endingCmdPtr) override {
+        submittedResidency = residencyContainer;
+        MockCommandQueue<gfxCoreFamily>::submitBatchBuffer(offset, residencyContainer, endingCmdPtr);
+    }
+
+    NEO::ResidencyContainer submittedResidency;
+};
+
+HWTEST2_F(ExecuteCommandListTests, givenCommandListsSharingAllocationsWhenExecutingThenEachAllocationIsSubmittedOnce, CommandQueueExecuteTestSupport) {
+    ze_command_queue_desc_t desc = {};
+    NEO::CommandStreamReceiver *csr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    auto commandQueue = new MockCommandQueueSubmitBatchBuffer<gfxCoreFamily>(device, csr, &desc);
+    commandQueue->initialize(false, false);
+    auto commandList0 = new CommandListCoreFamily<gfxCoreFamily>();
+    commandList0->initialize(device, NEO::EngineGroupType::Compute);
+    auto commandList1 = new CommandListCoreFamily<gfxCoreFamily>();
+    commandList1->initialize(device, NEO::EngineGroupType::Compute);
+    ze_command_list_handle_t commandListHandles[] = {commandList0->toHandle(), commandList1->toHandle()};
+
+    void *alloc = alignedMalloc(0x100, 0x100);
+    NEO::GraphicsAllocation graphicsAllocation1(0, NEO::GraphicsAllocation::AllocationType::BUFFER, alloc, 0u, 0u, 1u, MemoryPool::System4KBPages, 1u);
+    NEO::GraphicsAllocation graphicsAllocation2(0, NEO::GraphicsAllocation::AllocationType::BUFFER, alloc, 0u, 0u, 1u, MemoryPool::System4KBPages, 1u);
+
+    commandList0->commandContainer.addToResidencyContainer(&graphicsAllocation1);
+    commandList0->commandContainer.addToResidencyContainer(&graphicsAllocation2);
+    commandList1->commandContainer.addToResidencyContainer(&graphicsAllocation2);
+    commandList1->commandContainer.addToResidencyContainer(&graphicsAllocation1);
+
+    for (uint32_t execution = 0; execution < 2; execution++) {
+        commandQueue->executeCommandLists(2, commandListHandles, nullptr, false);
+
+        auto &submittedResidency = commandQueue->submittedResidency;
+        EXPECT_EQ(1, std::count(submittedResidency.begin(), submittedResidency.end(), &graphicsAllocation1));
+        EXPECT_EQ(1, std::count(submittedResidency.begin(), submittedResidency.end(), &graphicsAllocation2));
+        EXPECT_NE(0u, graphicsAllocation1.getSubmissionStamp(csr->getOsContext().getContextId()));
+    }
+
+    commandQueue->destroy();
+    commandList0->destroy();
+    commandList1->destroy();
+    alignedFree(alloc);
+}
+
+HWTEST2_F(ExecuteCommandListTests, givenClosedCommandListWithIndirectAllocationsWhenExecutedAgainThenInternalAllocationsAreRescannedOnlyAfterNewAllocations, CommandQueueExecuteTestSupport) {
+    ze_command_queue_desc_t desc = {};
+    NEO::CommandStreamReceiver *csr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    auto commandQueue = new MockCommandQueue<gfxCoreFamily>(device, csr, &desc);
+    commandQueue->initialize(false, false);
+    auto commandList = new CommandListCoreFamily<gfxCoreFamily>();
+    commandList->initialize(device, NEO::EngineGroupType::Compute);
+    commandList->indirectAllocationsAllowed = true;
+    commandList->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
+    commandList->close();
+    auto commandListHandle = commandList->toHandle();
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    void *deviceBuffer0 = nullptr;
+    void *deviceBuffer1 = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 0x100u, 0x100u, &deviceBuffer0));
+    auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    auto allocation0 = svmAllocsManager->getSVMAlloc(deviceBuffer0)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), allocation0));
+    EXPECT_TRUE(commandList->executionCache.internalAllocationsResident);
+
+    residencyContainer.erase(std::find(residencyContainer.begin(), residencyContainer.end(), allocation0));
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), allocation0));
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 0x100u, 0x100u, &deviceBuffer1));
+    auto allocation1 = svmAllocsManager->getSVMAlloc(deviceBuffer1)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), allocation0));
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), allocation1));
+
+    commandList->reset();
+    EXPECT_FALSE(commandList->executionCache.internalAllocationsResident);
+
+    context->freeMem(deviceBuffer0);
+    context->freeMem(deviceBuffer1);
+    commandQueue->destroy();
+    commandList->destroy();
+}
+
 HWTEST2_F(ExecuteCommandListTests, givenCommandQueueHavingTwoB2BCommandListsThenMVSDirtyFlagAndGSBADirtyFlagAreSetOnlyOnce, CommandQueueExecuteTestSupport) {
     ze_command_queue_desc_t desc = {};
     NEO::CommandStreamReceiver *csr;
@@ -539,7 +539,7 @@ TEST_F(ContextTest, whenGettingDriverThenDriverIsRetrievedSuccessfully) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
-TEST_F(ContextTest, whenCallingVirtualMemInterfacesThenUnsupportedIsReturned) {
+TEST_F(ContextTest, whenReservingAndFreeingVirtualMemThenSuccessIsReturned) {
     ze_context_handle_t hContext;
     ze_context_desc_t desc;
 
@@ -548,24 +548,34 @@ TEST_F(ContextTest, whenCallingVirtualMemInterfacesThenUnsupportedIsReturned) {
 
     ContextImp *contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
 
-    void *pStart = 0x0;
-    size_t size = 0u;
+    size_t pagesize = 0u;
+    res = contextImp->queryVirtualMemPageSize(device, MemoryConstants::megaByte, &pagesize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(MemoryConstants::pageSize64k, pagesize);
+
     void *ptr = nullptr;
-    res = contextImp->reserveVirtualMem(pStart, size, &ptr);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    res = contextImp->reserveVirtualMem(nullptr, pagesize + 1, &ptr);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, res);
 
-    size_t pagesize = 0u;
-    res = contextImp->queryVirtualMemPageSize(device, size, &pagesize);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    size_t size = 4 * pagesize;
+    res = contextImp->reserveVirtualMem(nullptr, size, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+
+    res = contextImp->freeVirtualMem(ptr, pagesize);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 
     res = contextImp->freeVirtualMem(ptr, size);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    res = contextImp->freeVirtualMem(ptr, size);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 
     res = contextImp->destroy();
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
-TEST_F(ContextTest, whenCallingPhysicalMemInterfacesThenUnsupportedIsReturned) {
+TEST_F(ContextTest, whenCreatingAndDestroyingPhysicalMemThenSuccessIsReturned) {
     ze_context_handle_t hContext;
     ze_context_desc_t desc;
 
@@ -575,18 +585,28 @@ TEST_F(ContextTest, whenCallingPhysicalMemInterfacesThenUnsupportedIsReturned) {
     ContextImp *contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
 
     ze_physical_mem_desc_t descMem = {};
+    descMem.size = MemoryConstants::pageSize;
     ze_physical_mem_handle_t mem = {};
     res = contextImp->createPhysicalMem(device, &descMem, &mem);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, res);
+
+    descMem.size = MemoryConstants::pageSize64k;
+    res = contextImp->createPhysicalMem(device, &descMem, &mem);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    ASSERT_NE(nullptr, mem);
+    EXPECT_EQ(MemoryConstants::pageSize64k, L0::PhysicalMemory::fromHandle(mem)->allocation->getUnderlyingBufferSize());
+
+    res = contextImp->destroyPhysicalMem(mem);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 
     res = contextImp->destroyPhysicalMem(mem);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 
     res = contextImp->destroy();
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
-TEST_F(ContextTest, whenCallingMappingVirtualInterfacesThenUnsupportedIsReturned) {
+TEST_F(ContextTest, givenPhysicalMemMappedIntoReservedRangeThenAllocationIsFoundAtMappedAddressUntilUnmapped) {
     ze_context_handle_t hContext;
     ze_context_desc_t desc;
 
@@ -595,32 +615,98 @@ TEST_F(ContextTest, whenCallingMappingVirtualInterfacesThenUnsupportedIsReturned
 
     ContextImp *contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
 
+    size_t pagesize = MemoryConstants::pageSize64k;
+    void *ptr = nullptr;
+    res = contextImp->reserveVirtualMem(nullptr, 2 * pagesize, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
     ze_physical_mem_desc_t descMem = {};
+    descMem.size = pagesize;
     ze_physical_mem_handle_t mem = {};
     res = contextImp->createPhysicalMem(device, &descMem, &mem);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto allocation = L0::PhysicalMemory::fromHandle(mem)->allocation;
+    auto ownGpuAddress = allocation->getGpuAddress();
 
-    ze_memory_access_attribute_t access = {};
-    size_t offset = 0;
-    void *ptr = nullptr;
-    size_t size = 0;
-    res = contextImp->mapVirtualMem(ptr, size, mem, offset, access);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    auto mappedPtr = ptrOffset(ptr, pagesize);
+    res = contextImp->mapVirtualMem(mappedPtr, pagesize, mem, pagesize, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, res);
 
-    res = contextImp->setVirtualMemAccessAttribute(ptr, size, access);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    res = contextImp->mapVirtualMem(ptrOffset(ptr, 2 * pagesize), pagesize, mem, 0u, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+
+    res = contextImp->mapVirtualMem(mappedPtr, pagesize, mem, 0u, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(reinterpret_cast<uint64_t>(mappedPtr), allocation->getGpuAddress());
 
-    ze_memory_access_attribute_t outAccess = {};
-    size_t outSize = 0;
-    res = contextImp->getVirtualMemAccessAttribute(ptr, size, &outAccess, &outSize);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    auto allocData = driverHandle->svmAllocsManager->getSVMAlloc(ptrOffset(mappedPtr, 0x10));
+    ASSERT_NE(nullptr, allocData);
+    EXPECT_EQ(allocation, allocData->gpuAllocations.getDefaultGraphicsAllocation());
+    EXPECT_EQ(nullptr, driverHandle->svmAllocsManager->getSVMAlloc(ptr));
 
-    res = contextImp->unMapVirtualMem(ptr, size);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    res = contextImp->mapVirtualMem(ptr, pagesize, mem, 0u, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+
+    res = contextImp->setVirtualMemAccessAttribute(mappedPtr, pagesize, ZE_MEMORY_ACCESS_ATTRIBUTE_READONLY);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    ze_memory_access_attribute_t access = ZE_MEMORY_ACCESS_ATTRIBUTE_NONE;
+    size_t outSize = 0u;
+    res = contextImp->getVirtualMemAccessAttribute(mappedPtr, pagesize, &access, &outSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(ZE_MEMORY_ACCESS_ATTRIBUTE_READONLY, access);
+    EXPECT_EQ(pagesize, outSize);
+    res = contextImp->getVirtualMemAccessAttribute(ptr, pagesize, &access, &outSize);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, contextImp->freeMem(mappedPtr));
+    EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, contextImp->destroyPhysicalMem(mem));
+    EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, contextImp->freeVirtualMem(ptr, 2 * pagesize));
+
+    res = contextImp->unMapVirtualMem(ptr, pagesize);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+    res = contextImp->unMapVirtualMem(mappedPtr, pagesize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(ownGpuAddress, allocation->getGpuAddress());
+    EXPECT_EQ(nullptr, driverHandle->svmAllocsManager->getSVMAlloc(mappedPtr));
 
     res = contextImp->destroyPhysicalMem(mem);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    res = contextImp->freeVirtualMem(ptr, 2 * pagesize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    res = contextImp->destroy();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+}
+
+TEST_F(ContextTest, givenOverlappingMappingWhenMappingPhysicalMemThenInvalidArgumentIsReturned) {
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc;
+
+    ze_result_t res = driverHandle->createContext(&desc, 0u, nullptr, &hContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    ContextImp *contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
+
+    size_t pagesize = MemoryConstants::pageSize64k;
+    void *ptr = nullptr;
+    res = contextImp->reserveVirtualMem(nullptr, 4 * pagesize, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    ze_physical_mem_desc_t descMem = {};
+    descMem.size = 2 * pagesize;
+    ze_physical_mem_handle_t mem = {};
+    ze_physical_mem_handle_t mem2 = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->createPhysicalMem(device, &descMem, &mem));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->createPhysicalMem(device, &descMem, &mem2));
+
+    res = contextImp->mapVirtualMem(ptrOffset(ptr, pagesize), 2 * pagesize, mem, 0u, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    res = contextImp->mapVirtualMem(ptr, 2 * pagesize, mem2, 0u, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+    res = contextImp->mapVirtualMem(ptrOffset(ptr, 2 * pagesize), 2 * pagesize, mem2, 0u, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 
+    // leftover mappings, reservations and physical memory are released together with the context
     res = contextImp->destroy();
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
@@ -95,6 +95,79 @@ struct EventPoolFailTests : public ::testing::Test {
     std::unique_ptr<ContextImp> context;
 };
 
+class MemoryManagerDeviceLocalEventPoolMock : public NEO::MockMemoryManager {
+  public:
+    MemoryManagerDeviceLocalEventPoolMock(NEO::ExecutionEnvironment &executionEnvironment) : NEO::MockMemoryManager(true, executionEnvironment) {}
+    NEO::GraphicsAllocation *allocateGraphicsMemoryWithProperties(const NEO::AllocationProperties &properties) override {
+        auto allocation = NEO::MockMemoryManager::allocateGraphicsMemoryWithProperties(properties);
+        if (allocation && properties.allocationType == NEO::GraphicsAllocation::AllocationType::BUFFER) {
+            static_cast<NEO::MemoryAllocation *>(allocation)->overrideMemoryPool(MemoryPool::LocalMemory);
+        }
+        return allocation;
+    }
+};
+
+struct EventPoolDeviceLocalTests : public EventPoolFailTests {
+    void SetUp() override {
+        EventPoolFailTests::SetUp();
+        driverHandle->setMemoryManager(prevMemoryManager);
+        delete currMemoryManager;
+        currMemoryManager = new MemoryManagerDeviceLocalEventPoolMock(*neoDevice->executionEnvironment);
+        driverHandle->setMemoryManager(currMemoryManager);
+    }
+};
+
+TEST_F(EventPoolDeviceLocalTests, givenDeviceLocalEventPoolEnabledWhenCreatingPoolWithoutHostVisibleFlagThenEventsAreInLocalMemoryAndAccessedThroughLockedPointer) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeviceLocalEventPool.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 2;
+    auto deviceHandle = device->toHandle();
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context.get(), 1, &deviceHandle, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_TRUE(allocation->isAllocatedInLocalMemoryPool());
+    ASSERT_TRUE(allocation->isLocked());
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 1;
+    std::unique_ptr<L0::Event> event(Event::create(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(ptrOffset(allocation->getLockedPtr(), eventPool->getEventSize()), event->getHostAddress());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+}
+
+TEST_F(EventPoolDeviceLocalTests, givenDeviceLocalEventPoolEnabledWhenCreatingHostVisiblePoolThenEventsAreInSystemMemory) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeviceLocalEventPool.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 2;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    auto deviceHandle = device->toHandle();
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context.get(), 1, &deviceHandle, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_FALSE(allocation->isAllocatedInLocalMemoryPool());
+}
+
+TEST_F(EventPoolDeviceLocalTests, givenDeviceLocalEventPoolDisabledWhenCreatingPoolWithoutHostVisibleFlagThenEventsAreInSystemMemory) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 2;
+    auto deviceHandle = device->toHandle();
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context.get(), 1, &deviceHandle, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_FALSE(allocation->isAllocatedInLocalMemoryPool());
+}
+
 TEST_F(EventPoolFailTests, whenCreatingEventPoolAndAllocationFailsThenOutOfHostMemoryIsReturned) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
@@ -225,6 +298,47 @@ TEST_F(EventPoolCreate, GivenAtLeastOneValidDeviceHandleWhenCreatingEventPoolThe
     ASSERT_NE(nullptr, eventPool);
 }
 
+TEST_F(EventPoolCreate, givenEventPoolAllocationsCacheEnabledWhenEventPoolIsRecreatedThenAllocationIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EventPoolAllocationsCacheSize.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 4;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    auto deviceHandle = device->toHandle();
+    auto eventPool = EventPool::create(driverHandle.get(), context, 1, &deviceHandle, &eventPoolDesc);
+    ASSERT_NE(nullptr, eventPool);
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex());
+    eventPool->destroy();
+
+    eventPool = EventPool::create(driverHandle.get(), context, 1, &deviceHandle, &eventPoolDesc);
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_EQ(allocation, eventPool->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex()));
+
+    eventPoolDesc.flags |= ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+    auto timestampEventPool = EventPool::create(driverHandle.get(), context, 1, &deviceHandle, &eventPoolDesc);
+    ASSERT_NE(nullptr, timestampEventPool);
+    EXPECT_NE(allocation, timestampEventPool->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex()));
+
+    timestampEventPool->destroy();
+    eventPool->destroy();
+}
+
+TEST_F(EventPoolCreate, givenEventPoolAllocationsCacheDisabledWhenEventPoolIsDestroyedThenAllocationIsNotCached) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 4;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    auto eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc);
+    ASSERT_NE(nullptr, eventPool);
+    eventPool->destroy();
+
+    EventPoolAllocationsKey key = {};
+    EXPECT_EQ(nullptr, driverHandle->obtainCachedEventPoolAllocations(key));
+    EXPECT_FALSE(driverHandle->cacheEventPoolAllocations(key, nullptr));
+}
+
 TEST_F(EventCreate, givenAnEventCreatedThenTheEventHasTheDeviceCommandStreamReceiverSet) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
@@ -278,6 +392,57 @@ TEST_F(EventCreate, givenEventWhenSignaledAndResetFromTheHostThenCorrectDataAndO
     EXPECT_EQ(ZE_RESULT_NOT_READY, result);
 }
 
+TEST_F(EventCreate, givenCounterBasedEventPoolWhenEventIsCreatedThenEventIsSignaledUntilCounterIsAssignedAndThenTracksCsrTag) {
+    ze_event_pool_counter_based_exp_desc_t counterBasedDesc = {};
+    counterBasedDesc.stype = ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.pNext = &counterBasedDesc;
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_TRUE(eventPool->isEventPoolCounterBased);
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+    EXPECT_TRUE(event->isCounterBased);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, event->hostSignal());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->reset());
+
+    auto csr = static_cast<DeviceImp *>(device)->neoDevice->getDefaultEngine().commandStreamReceiver;
+    auto tagAddress = csr->getTagAddress();
+    *tagAddress = 4u;
+    event->assignCounter(*csr, 5u);
+    EXPECT_EQ(csr->getTagAllocation(), event->counterAllocation);
+    EXPECT_EQ(csr->getTagAllocation()->getGpuAddress(), event->counterGpuAddress);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(0));
+
+    *tagAddress = 5u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST_F(EventCreate, givenCounterBasedEventPoolDescWithTimestampFlagWhenCreatingEventPoolThenInvalidArgumentIsReturned) {
+    ze_event_pool_counter_based_exp_desc_t counterBasedDesc = {};
+    counterBasedDesc.stype = ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.pNext = &counterBasedDesc;
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+
+    ze_event_pool_handle_t eventPool = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, context->createEventPool(&eventPoolDesc, 0, nullptr, &eventPool));
+    EXPECT_EQ(nullptr, eventPool);
+}
+
 TEST_F(EventCreate, givenAnEventCreateWithInvalidIndexUsingThisEventPoolThenErrorIsReturned) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
@@ -353,6 +518,65 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutNonZeroAn
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+class EventSynchronizeMultipleTest : public Test<DeviceFixture> {
+  public:
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = numEvents;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+        eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc));
+        ASSERT_NE(nullptr, eventPool);
+        for (uint32_t i = 0; i < numEvents; i++) {
+            ze_event_desc_t eventDesc = {};
+            eventDesc.index = i;
+            events[i] = std::unique_ptr<L0::Event>(L0::Event::create(eventPool.get(), &eventDesc, device));
+            ASSERT_NE(nullptr, events[i]);
+            eventHandles[i] = events[i]->toHandle();
+        }
+    }
+
+    void TearDown() override {
+        DeviceFixture::TearDown();
+    }
+
+    void signal(uint32_t index) {
+        *static_cast<uint64_t *>(events[index]->getHostAddress()) = Event::STATE_SIGNALED;
+    }
+
+    static constexpr uint32_t numEvents = 3;
+    std::unique_ptr<L0::EventPool> eventPool = nullptr;
+    std::unique_ptr<L0::Event> events[numEvents];
+    ze_event_handle_t eventHandles[numEvents] = {};
+};
+
+TEST_F(EventSynchronizeMultipleTest, givenNotAllEventsSignaledWhenWaitingForAllThenNotReadyIsReturned) {
+    signal(0);
+    signal(2);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(numEvents, eventHandles, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(numEvents, eventHandles, 10, true, nullptr));
+
+    signal(1);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(numEvents, eventHandles, 10, true, nullptr));
+}
+
+TEST_F(EventSynchronizeMultipleTest, givenOneEventSignaledWhenWaitingForAnyThenIndexOfSignaledEventIsReturned) {
+    uint32_t signaledIndex = 0;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(numEvents, eventHandles, 10, false, &signaledIndex));
+
+    signal(2);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(numEvents, eventHandles, 0, false, &signaledIndex));
+    EXPECT_EQ(2u, signaledIndex);
+}
+
+TEST_F(EventSynchronizeMultipleTest, givenInvalidArgumentsWhenWaitingForMultipleEventsThenErrorIsReturned) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(0, nullptr, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, Event::hostSynchronizeMultiple(0, nullptr, 0, false, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, Event::hostSynchronizeMultiple(numEvents, nullptr, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, Event::hostSynchronizeMultiple(numEvents, eventHandles, 0, false, nullptr));
+}
+
 using EventAubCsrTest = Test<DeviceFixture>;
 
 HWTEST_F(EventAubCsrTest, givenCallToEventHostSynchronizeWithAubModeCsrReturnsSuccess) {
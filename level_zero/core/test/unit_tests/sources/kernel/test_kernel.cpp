@@ -226,6 +226,33 @@ HWTEST2_F(SetKernelArg, givenSamplerAndKernelWhenSetArgSamplerThenCrossThreadDat
     EXPECT_EQ(0x08, *pSamplerNormalizedCoords);
 }
 
+HWTEST2_F(SetKernelArg, givenKernelWhenSetArgImageIsCalledThenSurfaceStateHeapIsSharedWithImmutableDataUntilModified, ImageSupport) {
+    createKernel();
+    ASSERT_NE(0u, kernel->getSurfaceStateHeapDataSize());
+
+    auto sshTemplate = kernel->kernelImmData->getSurfaceStateHeapTemplate();
+    EXPECT_EQ(nullptr, kernel->surfaceStateHeapData.get());
+    EXPECT_EQ(sshTemplate, kernel->getSurfaceStateHeapData());
+
+    ze_image_desc_t desc = {};
+    desc.type = ZE_IMAGE_TYPE_2D;
+    desc.format.layout = ZE_IMAGE_FORMAT_LAYOUT_8_8_8_8;
+    desc.format.type = ZE_IMAGE_FORMAT_TYPE_UINT;
+    desc.width = 11;
+    desc.height = 13;
+    desc.depth = 1;
+
+    auto imageHW = std::make_unique<WhiteBox<::L0::ImageCoreFamily<gfxCoreFamily>>>();
+    auto ret = imageHW->initialize(device, &desc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, ret);
+
+    auto handle = imageHW->toHandle();
+    kernel->setArgImage(3, sizeof(imageHW.get()), &handle);
+
+    EXPECT_NE(nullptr, kernel->surfaceStateHeapData.get());
+    EXPECT_EQ(kernel->surfaceStateHeapData.get(), kernel->getSurfaceStateHeapData());
+}
+
 using ArgSupport = IsWithinProducts<IGFX_SKYLAKE, IGFX_TIGERLAKE_LP>;
 
 HWTEST2_F(SetKernelArg, givenBufferArgumentWhichHasNotBeenAllocatedByRuntimeThenInvalidArgumentIsReturned, ArgSupport) {
@@ -238,6 +265,94 @@ HWTEST2_F(SetKernelArg, givenBufferArgumentWhichHasNotBeenAllocatedByRuntimeThen
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 }
 
+HWTEST2_F(SetKernelArg, givenUsmPointerSetAsArgumentWhenSettingSamePointerAgainThenAllocationLookupIsSkipped, ArgSupport) {
+    createKernel();
+
+    void *devicePtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 0u, &devicePtr));
+    auto alloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(devicePtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(devicePtr), &devicePtr));
+    EXPECT_EQ(alloc, kernel->residencyContainer[0]);
+    EXPECT_EQ(devicePtr, kernel->argBufferCache[0].requestedAddress);
+
+    kernel->residencyContainer[0] = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(devicePtr), &devicePtr));
+    EXPECT_EQ(nullptr, kernel->residencyContainer[0]);
+
+    context->freeMem(devicePtr);
+}
+
+HWTEST2_F(SetKernelArg, givenUsmPointerSetAsArgumentWhenNewAllocationIsCreatedThenSamePointerIsResolvedAgain, ArgSupport) {
+    createKernel();
+
+    void *devicePtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 0u, &devicePtr));
+    auto alloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(devicePtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(devicePtr), &devicePtr));
+    kernel->residencyContainer[0] = nullptr;
+
+    void *otherDevicePtr = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 0u, &otherDevicePtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(devicePtr), &devicePtr));
+    EXPECT_EQ(alloc, kernel->residencyContainer[0]);
+
+    void *nullPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(nullPtr), &nullPtr));
+    EXPECT_EQ(nullptr, kernel->argBufferCache[0].requestedAddress);
+
+    context->freeMem(otherDevicePtr);
+    context->freeMem(devicePtr);
+}
+
+HWTEST2_F(SetKernelArg, givenAllocationSetWithAllocDirectlyWhenSettingCachedPointerThenArgumentIsPatchedAgain, ArgSupport) {
+    createKernel();
+
+    void *devicePtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 0u, &devicePtr));
+    auto alloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(devicePtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(devicePtr), &devicePtr));
+
+    NEO::MockGraphicsAllocation otherAlloc;
+    kernel->setArgBufferWithAlloc(0, 0x1234, &otherAlloc);
+    EXPECT_EQ(nullptr, kernel->argBufferCache[0].requestedAddress);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(devicePtr), &devicePtr));
+    EXPECT_EQ(alloc, kernel->residencyContainer[0]);
+
+    context->freeMem(devicePtr);
+}
+
+HWTEST2_F(SetKernelArg, givenMultipleArgumentValuesWhenSettingThemInOneCallThenEachArgumentIsSetAndFirstErrorIsReturned, ArgSupport) {
+    createKernel();
+
+    void *devicePtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 0u, &devicePtr));
+    auto alloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(devicePtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    size_t argSizes[] = {sizeof(devicePtr)};
+    const void *argValues[] = {&devicePtr};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgumentValues(1u, argSizes, argValues));
+    EXPECT_EQ(alloc, kernel->residencyContainer[0]);
+
+    uint64_t hostAddress = 0x1234;
+    argValues[0] = &hostAddress;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, kernel->setArgumentValues(1u, argSizes, argValues));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, kernel->setArgumentValues(numKernelArguments + 1, argSizes, argValues));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, kernel->setArgumentValues(1u, nullptr, argValues));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgumentValues(0u, nullptr, nullptr));
+
+    context->freeMem(devicePtr);
+}
+
 class KernelImmutableDataTests : public ModuleImmutableDataFixture, public ::testing::Test {
   public:
     void SetUp() override {
@@ -1215,6 +1330,36 @@ TEST_F(KernelImpPatchBindlessTest, GivenKernelImpWhenPatchBindlessOffsetCalledTh
     EXPECT_TRUE(std::find(kernel.getResidencyContainer().begin(), kernel.getResidencyContainer().end(), expectedSsInHeap.heapAllocation) != kernel.getResidencyContainer().end());
 }
 
+TEST_F(KernelImpPatchBindlessTest, GivenGlobalConstantsWithBindlessOffsetWhenInitializingImmutableDataThenSurfaceStateFromGlobalHeapIsPatched) {
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->createBindlessHeapsHelper(neoDevice->getMemoryManager(), neoDevice->getNumAvailableDevices() > 1, neoDevice->getRootDeviceIndex());
+
+    uint32_t kernelHeap = 0;
+    KernelInfo kernelInfo;
+    kernelInfo.heapInfo.KernelHeapSize = 1;
+    kernelInfo.heapInfo.pKernelHeap = &kernelHeap;
+    kernelInfo.kernelDescriptor.kernelAttributes.crossThreadDataSize = 0x80;
+    auto &globalConstantsSurfaceAddress = kernelInfo.kernelDescriptor.payloadMappings.implicitArgs.globalConstantsSurfaceAddress;
+    globalConstantsSurfaceAddress.stateless = 0x0;
+    globalConstantsSurfaceAddress.pointerSize = sizeof(uint64_t);
+    globalConstantsSurfaceAddress.bindless = 0x40;
+
+    uint64_t gpuAddress = 0x2000;
+    NEO::MockGraphicsAllocation globalConstBuffer(reinterpret_cast<void *>(gpuAddress), gpuAddress, MemoryConstants::pageSize);
+
+    KernelImmutableData kernelImmutableData(device);
+    kernelImmutableData.initialize(&kernelInfo, device, 0, &globalConstBuffer, nullptr, false);
+
+    auto &hwHelper = NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily);
+    size_t size = hwHelper.getRenderSurfaceStateSize();
+    auto expectedSsInHeap = device->getNEODevice()->getBindlessHeapsHelper()->allocateSSInHeap(size, &globalConstBuffer, NEO::BindlessHeapsHelper::GLOBAL_SSH);
+    auto patchValue = hwHelper.getBindlessSurfaceExtendedMessageDescriptorValue(static_cast<uint32_t>(expectedSsInHeap.surfaceStateOffset));
+    auto patchLocation = ptrOffset(kernelImmutableData.getCrossThreadDataTemplate(), globalConstantsSurfaceAddress.bindless);
+
+    EXPECT_TRUE(memcmp(patchLocation, &patchValue, sizeof(patchValue)) == 0);
+    auto &residencyContainer = kernelImmutableData.getResidencyContainer();
+    EXPECT_TRUE(std::find(residencyContainer.begin(), residencyContainer.end(), expectedSsInHeap.heapAllocation) != residencyContainer.end());
+}
+
 HWTEST2_F(KernelImpPatchBindlessTest, GivenKernelImpWhenSetSurfaceStateBindlessThenSurfaceStateUpdated, MatchAny) {
     using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
 
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_operations_status.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -501,6 +502,148 @@ TEST_F(MemoryRelaxedSizeTests,
     EXPECT_EQ(nullptr, ptr);
 }
 
+using MemoryCacheRegionTests = MemoryRelaxedSizeTests;
+
+TEST_F(MemoryCacheRegionTests,
+       givenDefaultCacheRegionDescriptorWhenAllocatingDeviceAndSharedMemoryThenAllocationsAreMade) {
+    ze_cache_region_exp_desc_t cacheRegionDesc = {};
+    cacheRegionDesc.stype = ZE_STRUCTURE_TYPE_CACHE_REGION_EXP_DESC;
+    cacheRegionDesc.region = ZE_CACHE_REGION_EXP_DEFAULT;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    deviceDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+    deviceDesc.pNext = &cacheRegionDesc;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+
+    void *devicePtr = nullptr;
+    void *sharedPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 1u, &devicePtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, 4096u, 1u, &sharedPtr));
+    EXPECT_NE(nullptr, devicePtr);
+    EXPECT_NE(nullptr, sharedPtr);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(devicePtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(sharedPtr));
+}
+
+TEST_F(MemoryCacheRegionTests,
+       givenUnsupportedOrInvalidCacheRegionDescriptorWhenAllocatingMemoryThenErrorIsReturned) {
+    ze_cache_region_exp_desc_t cacheRegionDesc = {};
+    cacheRegionDesc.stype = ZE_STRUCTURE_TYPE_CACHE_REGION_EXP_DESC;
+    cacheRegionDesc.region = ZE_CACHE_REGION_EXP_RESERVED;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    deviceDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+    deviceDesc.pNext = &cacheRegionDesc;
+
+    void *ptr = nullptr;
+    auto &hwInfo = device->getHwInfo();
+    if (NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily).getNumCacheRegions(hwInfo) <= 1) {
+        EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 1u, &ptr));
+        EXPECT_EQ(nullptr, ptr);
+    }
+
+    cacheRegionDesc.region = static_cast<ze_cache_region_exp_t>(ZE_CACHE_REGION_EXP_RESERVED + 1);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ENUMERATION, context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, 4096u, 1u, &ptr));
+    EXPECT_EQ(nullptr, ptr);
+}
+
+using MemoryZeroInitTests = MemoryRelaxedSizeTests;
+
+TEST_F(MemoryZeroInitTests,
+       givenZeroInitDescriptorWhenAllocatingDeviceMemoryThenOnlyThatAllocationHasZeroInitPending) {
+    ze_device_mem_alloc_zero_init_exp_desc_t zeroInitDesc = {};
+    zeroInitDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_ZERO_INIT_EXP_DESC;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    deviceDesc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+
+    void *regularPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 1u, &regularPtr));
+    deviceDesc.pNext = &zeroInitDesc;
+    void *zeroInitPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 1u, &zeroInitPtr));
+
+    auto regularAllocation = driverHandle->svmAllocsManager->getSVMAlloc(regularPtr)->gpuAllocations.getDefaultGraphicsAllocation();
+    auto zeroInitAllocation = driverHandle->svmAllocsManager->getSVMAlloc(zeroInitPtr)->gpuAllocations.getDefaultGraphicsAllocation();
+    EXPECT_FALSE(regularAllocation->isZeroInitPending());
+    EXPECT_TRUE(zeroInitAllocation->isZeroInitPending());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(regularPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(zeroInitPtr));
+}
+
+using MemoryDmaBufExportTests = MemoryRelaxedSizeTests;
+
+struct DmaBufExportMockGraphicsAllocation : public NEO::MockGraphicsAllocation {
+    using NEO::MockGraphicsAllocation::MockGraphicsAllocation;
+
+    int peekDmaBufFd(NEO::MemoryManager *memoryManager) override {
+        peekDmaBufFdCalled++;
+        return mockFd;
+    }
+
+    const int mockFd = 63;
+    uint32_t peekDmaBufFdCalled = 0u;
+};
+
+TEST_F(MemoryDmaBufExportTests,
+       givenPointerInsideDeviceAllocationWhenGettingDmaBufExportPropertiesThenFdOfAllocationAndOffsetOfPointerAreReturned) {
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    void *ptr = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 1u, &ptr));
+
+    auto allocData = driverHandle->svmAllocsManager->getSVMAlloc(ptr);
+    auto allocation = allocData->gpuAllocations.getDefaultGraphicsAllocation();
+    DmaBufExportMockGraphicsAllocation exportAllocation(allocation->getRootDeviceIndex(), ptr, 4096u);
+    allocData->gpuAllocations.addAllocation(&exportAllocation);
+
+    ze_memory_dma_buf_export_exp_properties_t dmaBufProperties = {};
+    dmaBufProperties.stype = ZE_STRUCTURE_TYPE_MEMORY_DMA_BUF_EXPORT_EXP_PROPERTIES;
+    ze_memory_allocation_properties_t memoryProperties = {};
+    memoryProperties.pNext = &dmaBufProperties;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->getMemAllocProperties(ptrOffset(ptr, 256u), &memoryProperties, nullptr));
+    EXPECT_EQ(exportAllocation.mockFd, dmaBufProperties.fd);
+    EXPECT_EQ(256u, dmaBufProperties.offset);
+    EXPECT_EQ(1u, exportAllocation.peekDmaBufFdCalled);
+
+    allocData->gpuAllocations.addAllocation(allocation);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr));
+}
+
+TEST_F(MemoryDmaBufExportTests,
+       givenAllocationWithoutDmaBufSupportWhenGettingDmaBufExportPropertiesThenUnsupportedFeatureIsReturned) {
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    void *ptr = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 1u, &ptr));
+
+    ze_memory_dma_buf_export_exp_properties_t dmaBufProperties = {};
+    dmaBufProperties.stype = ZE_STRUCTURE_TYPE_MEMORY_DMA_BUF_EXPORT_EXP_PROPERTIES;
+    dmaBufProperties.fd = std::numeric_limits<int>::max();
+    ze_memory_allocation_properties_t memoryProperties = {};
+    memoryProperties.pNext = &dmaBufProperties;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, context->getMemAllocProperties(ptr, &memoryProperties, nullptr));
+    EXPECT_EQ(std::numeric_limits<int>::max(), dmaBufProperties.fd);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr));
+}
+
+TEST_F(MemoryDmaBufExportTests,
+       givenHostAllocationWhenGettingDmaBufExportPropertiesThenUnsupportedFeatureIsReturned) {
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    void *ptr = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocHostMem(&hostDesc, 4096u, 1u, &ptr));
+
+    ze_memory_dma_buf_export_exp_properties_t dmaBufProperties = {};
+    dmaBufProperties.stype = ZE_STRUCTURE_TYPE_MEMORY_DMA_BUF_EXPORT_EXP_PROPERTIES;
+    ze_memory_allocation_properties_t memoryProperties = {};
+    memoryProperties.pNext = &dmaBufProperties;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, context->getMemAllocProperties(ptr, &memoryProperties, nullptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr));
+}
+
 struct DriverHandleFailGetFdMock : public L0::DriverHandleImp {
     void *importFdHandle(ze_device_handle_t hDevice, ze_ipc_memory_flags_t flags, uint64_t handle, NEO::GraphicsAllocation **pAloc) override {
         if (mockFd == allocationMap.second) {
@@ -1195,6 +1338,9 @@ struct ContextIpcMock : public L0::ContextImp {
         return ZE_RESULT_SUCCESS;
     }
 
+    using L0::ContextImp::importedIpcHandles;
+    using L0::ContextImp::releaseImportedIpcHandles;
+
     const int mockFd = 999;
 };
 
@@ -1727,6 +1873,104 @@ TEST_F(MemoryOpenIpcHandleTest,
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+class MemoryManagerIdentityIpcMock : public MemoryManagerOpenIpcMock {
+  public:
+    MemoryManagerIdentityIpcMock(NEO::ExecutionEnvironment &executionEnvironment) : MemoryManagerOpenIpcMock(executionEnvironment) {}
+    NEO::GraphicsAllocation *createGraphicsAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool requireSpecificBitness) override {
+        importsCount++;
+        return MemoryManagerOpenIpcMock::createGraphicsAllocationFromSharedHandle(handle, properties, requireSpecificBitness);
+    }
+    uint64_t getSharedHandleIdentity(osHandle handle) override {
+        return sharedHandleIdentity;
+    }
+
+    uint64_t sharedHandleIdentity = 0x10u;
+    uint32_t importsCount = 0u;
+};
+
+struct MemoryOpenIpcHandleImportCacheTest : public MemoryOpenIpcHandleTest {
+    void SetUp() override {
+        MemoryOpenIpcHandleTest::SetUp();
+        identityMemoryManager = new MemoryManagerIdentityIpcMock(*neoDevice->executionEnvironment);
+        driverHandle->setMemoryManager(identityMemoryManager);
+        context->getIpcMemHandle(nullptr, &ipcHandle);
+    }
+
+    void TearDown() override {
+        context->releaseImportedIpcHandles();
+        driverHandle->setMemoryManager(currMemoryManager);
+        delete identityMemoryManager;
+        MemoryOpenIpcHandleTest::TearDown();
+    }
+
+    DebugManagerStateRestore restorer;
+    MemoryManagerIdentityIpcMock *identityMemoryManager = nullptr;
+    ze_ipc_mem_handle_t ipcHandle = {};
+    ze_ipc_memory_flags_t flags = {};
+};
+
+TEST_F(MemoryOpenIpcHandleImportCacheTest,
+       givenHandleOpenedTwiceWhenClosingThenSameAllocationIsReturnedAndReleasedOnLastClose) {
+    void *firstPtr = nullptr;
+    void *secondPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &firstPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &secondPtr));
+    EXPECT_EQ(firstPtr, secondPtr);
+    EXPECT_EQ(1u, identityMemoryManager->importsCount);
+    ASSERT_EQ(1u, context->importedIpcHandles.size());
+    EXPECT_EQ(2u, context->importedIpcHandles[0].openCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(firstPtr));
+    EXPECT_NE(nullptr, driverHandle->svmAllocsManager->getSVMAlloc(secondPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(secondPtr));
+    EXPECT_TRUE(context->importedIpcHandles.empty());
+    EXPECT_EQ(nullptr, driverHandle->svmAllocsManager->getSVMAlloc(secondPtr));
+}
+
+TEST_F(MemoryOpenIpcHandleImportCacheTest,
+       givenImportCacheEnabledWhenHandleIsClosedAndOpenedAgainThenImportIsReused) {
+    DebugManager.flags.EnableIpcImportCache.set(1);
+    void *firstPtr = nullptr;
+    void *secondPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &firstPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(firstPtr));
+    ASSERT_EQ(1u, context->importedIpcHandles.size());
+    EXPECT_EQ(0u, context->importedIpcHandles[0].openCount);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, context->closeIpcMemHandle(firstPtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &secondPtr));
+    EXPECT_EQ(firstPtr, secondPtr);
+    EXPECT_EQ(1u, identityMemoryManager->importsCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(secondPtr));
+}
+
+TEST_F(MemoryOpenIpcHandleImportCacheTest,
+       givenImportCacheEnabledWhenHandleRefersToOtherBufferThenStaleImportIsReleasedAndHandleIsImportedAgain) {
+    DebugManager.flags.EnableIpcImportCache.set(1);
+    void *ipcPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &ipcPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(ipcPtr));
+
+    identityMemoryManager->sharedHandleIdentity = 0x20u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &ipcPtr));
+    EXPECT_EQ(2u, identityMemoryManager->importsCount);
+    ASSERT_EQ(1u, context->importedIpcHandles.size());
+    EXPECT_EQ(0x20u, context->importedIpcHandles[0].bufferId);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(ipcPtr));
+}
+
+TEST_F(MemoryOpenIpcHandleImportCacheTest,
+       givenUnknownHandleIdentityWhenHandleIsOpenedTwiceThenEachOpenImportsHandle) {
+    identityMemoryManager->sharedHandleIdentity = 0u;
+    void *firstPtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &firstPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(firstPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &firstPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->closeIpcMemHandle(firstPtr));
+    EXPECT_EQ(2u, identityMemoryManager->importsCount);
+    EXPECT_TRUE(context->importedIpcHandles.empty());
+}
+
 struct MemoryFailedOpenIpcHandleTest : public ::testing::Test {
     void SetUp() override {
         NEO::MockCompilerEnableGuard mock(true);
@@ -1974,6 +2218,31 @@ TEST_F(MemoryTest, givenCallToCheckMemoryAccessFromDeviceWithValidHostAllocation
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
+TEST_F(MemoryTest, givenRangeInsideDeviceAllocationWhenFindingAllocationDataForRangeThenAllocationIsFoundAndRangeIsCovered) {
+    size_t size = 4096;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_result_t res = context->allocDeviceMem(device->toHandle(),
+                                              &deviceDesc,
+                                              size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+
+    NEO::SvmAllocationData *allocData = nullptr;
+    EXPECT_TRUE(driverHandle->findAllocationDataForRange(ptrOffset(ptr, 16), size - 16, &allocData));
+    ASSERT_NE(nullptr, allocData);
+    EXPECT_EQ(driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr), allocData);
+
+    allocData = nullptr;
+    EXPECT_FALSE(driverHandle->findAllocationDataForRange(ptrOffset(ptr, 16), size, &allocData));
+    EXPECT_EQ(driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr), allocData);
+
+    res = context->freeMem(ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+}
+
 struct MemoryBitfieldTest : testing::Test {
     void SetUp() override {
         NEO::MockCompilerEnableGuard mock(true);
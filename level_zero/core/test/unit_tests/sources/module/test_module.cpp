@@ -18,6 +18,7 @@
 
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/kernel/kernel_imp.h"
+#include "level_zero/core/source/module/module_build_log.h"
 #include "level_zero/core/source/module/module_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
@@ -98,6 +99,67 @@ HWTEST_F(ModuleTest, givenBuiltinModuleWhenCreatedThenCorrectAllocationTypeIsUse
     EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL, kernel->getIsaAllocation()->getAllocationType());
 }
 
+HWTEST_F(ModuleTest, givenLazyKernelIsaAllocationEnabledWhenUserModuleIsCreatedThenIsaIsAllocatedOnFirstKernelCreation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelIsaAllocation.set(1);
+    createModuleFromBinary(ModuleType::User);
+
+    auto whiteboxModule = whitebox_cast(module.get());
+    auto kernelImmData = whiteboxModule->kernelImmDatas[0].get();
+    EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelName.c_str();
+    ze_kernel_handle_t kernelHandle;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+
+    auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
+    ASSERT_NE(nullptr, isaAllocation);
+    EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, isaAllocation->getAllocationType());
+    EXPECT_EQ(isaAllocation, Kernel::fromHandle(kernelHandle)->getIsaAllocation());
+    Kernel::fromHandle(kernelHandle)->destroy();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+    EXPECT_EQ(isaAllocation, kernelImmData->getIsaGraphicsAllocation());
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+HWTEST_F(ModuleTest, givenLazyKernelIsaAllocationEnabledWhenBuiltinModuleIsCreatedThenIsaIsAllocatedImmediately) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelIsaAllocation.set(1);
+    createModuleFromBinary(ModuleType::Builtin);
+
+    auto whiteboxModule = whitebox_cast(module.get());
+    EXPECT_NE(nullptr, whiteboxModule->kernelImmDatas[0]->getIsaGraphicsAllocation());
+}
+
+using KernelImmutableDataIsaTest = Test<DeviceFixture>;
+
+TEST_F(KernelImmutableDataIsaTest, givenDeferredIsaAllocationWithPatchedIsaWhenAllocatingIsaThenPatchedIsaIsUploaded) {
+    uint8_t kernelHeap[4] = {1, 2, 3, 4};
+    uint8_t patchedHeap[4] = {5, 6, 7, 8};
+    KernelInfo kernelInfo;
+    kernelInfo.heapInfo.KernelHeapSize = sizeof(kernelHeap);
+    kernelInfo.heapInfo.pKernelHeap = kernelHeap;
+
+    WhiteBox<::L0::KernelImmutableData> kernelImmData(device);
+    kernelImmData.initialize(&kernelInfo, device, 0, nullptr, nullptr, false, true);
+    EXPECT_TRUE(kernelImmData.isIsaAllocationDeferred());
+    EXPECT_EQ(nullptr, kernelImmData.getIsaGraphicsAllocation());
+
+    kernelImmData.setPatchedIsa(patchedHeap, sizeof(patchedHeap));
+    kernelImmData.allocateIsa();
+
+    auto isaAllocation = kernelImmData.getIsaGraphicsAllocation();
+    ASSERT_NE(nullptr, isaAllocation);
+    EXPECT_FALSE(kernelImmData.isIsaAllocationDeferred());
+    EXPECT_TRUE(kernelImmData.patchedIsa.empty());
+    EXPECT_EQ(0, memcmp(patchedHeap, isaAllocation->getUnderlyingBuffer(), sizeof(patchedHeap)));
+
+    kernelImmData.allocateIsa();
+    EXPECT_EQ(isaAllocation, kernelImmData.getIsaGraphicsAllocation());
+}
+
 using ModuleTestSupport = IsWithinProducts<IGFX_SKYLAKE, IGFX_TIGERLAKE_LP>;
 
 HWTEST2_F(ModuleTest, givenNonPatchedTokenThenSurfaceBaseAddressIsCorrectlySet, ModuleTestSupport) {
@@ -542,6 +604,66 @@ HWTEST_F(ModuleLinkingTest, givenNotFullyLinkedModuleWhenCreatingKernelThenError
     EXPECT_EQ(ZE_RESULT_ERROR_MODULE_BUILD_FAILURE, retVal);
 }
 
+HWTEST_F(ModuleLinkingTest, givenFailureDuringLinkingWhenModuleIsBuiltAsynchronouslyThenBuildFailureIsReportedAfterBuildCompletes) {
+    auto mockCompiler = new MockCompilerInterface();
+    auto rootDeviceEnvironment = neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+    rootDeviceEnvironment->compilerInterface.reset(mockCompiler);
+
+    auto mockTranslationUnit = new MockModuleTranslationUnit(device);
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->valid = false;
+
+    mockTranslationUnit->programInfo.linkerInput = std::move(linkerInput);
+    auto spirvData = std::make_unique<uint8_t>(0u);
+
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirvData.get();
+    moduleDesc.inputSize = sizeof(uint8_t);
+
+    Module module(device, nullptr, ModuleType::User);
+    module.translationUnit.reset(mockTranslationUnit);
+
+    module.initializeAsync(&moduleDesc, neoDevice);
+    spirvData.reset();
+
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_BUILD_FAILURE, module.createKernel(nullptr, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_BUILD_FAILURE, module.getBuildStatus());
+}
+
+TEST_F(ModuleLinkingTest, givenPendingBuildWhenGettingBuildStatusThenNotReadyIsReturned) {
+    Module module(device, nullptr, ModuleType::User);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module.getBuildStatus());
+
+    module.buildPending = true;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, module.getBuildStatus());
+    module.buildPending = false;
+}
+
+TEST_F(ModuleLinkingTest, givenAsyncProgramBuildEnabledWhenCheckingIfAsyncBuildIsAllowedThenOnlyUserSpirvModulesWithoutBuildLogAndConstantsAreAllowed) {
+    DebugManagerStateRestore restorer;
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    EXPECT_FALSE(ModuleImp::isAsyncBuildAllowed(&moduleDesc, nullptr, ModuleType::User, neoDevice));
+
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+    EXPECT_TRUE(ModuleImp::isAsyncBuildAllowed(&moduleDesc, nullptr, ModuleType::User, neoDevice));
+    EXPECT_FALSE(ModuleImp::isAsyncBuildAllowed(&moduleDesc, nullptr, ModuleType::Builtin, neoDevice));
+
+    std::unique_ptr<ModuleBuildLog> moduleBuildLog{ModuleBuildLog::create()};
+    EXPECT_FALSE(ModuleImp::isAsyncBuildAllowed(&moduleDesc, moduleBuildLog.get(), ModuleType::User, neoDevice));
+
+    uint32_t constantId = 0;
+    ze_module_constants_t constants = {1, &constantId, nullptr};
+    moduleDesc.pConstants = &constants;
+    EXPECT_FALSE(ModuleImp::isAsyncBuildAllowed(&moduleDesc, nullptr, ModuleType::User, neoDevice));
+
+    moduleDesc.pConstants = nullptr;
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    EXPECT_FALSE(ModuleImp::isAsyncBuildAllowed(&moduleDesc, nullptr, ModuleType::User, neoDevice));
+}
+
 using ModulePropertyTest = Test<ModuleFixture>;
 
 TEST_F(ModulePropertyTest, whenZeModuleGetPropertiesIsCalledThenGetPropertiesIsCalled) {
@@ -677,6 +799,66 @@ TEST_F(ModuleDynamicLinkTests, givenModuleWithUnresolvedSymbolWhenTheOtherModule
     EXPECT_EQ(gpuAddress, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtr, offset)));
 }
 
+TEST_F(ModuleDynamicLinkTests, givenSymbolDefinedInMoreThanOneModuleWhenDynamicLinkThenLinkFailureIsReturned) {
+    NEO::Linker::RelocationInfo unresolvedRelocation;
+    unresolvedRelocation.symbolName = "unresolved";
+    module0->unresolvedExternalsInfo.push_back({unresolvedRelocation});
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+    module0->getTranslationUnit()->programInfo.linkerInput = std::move(linkerInput);
+
+    auto module2 = std::make_unique<Module>(device, nullptr, ModuleType::User);
+    NEO::Linker::RelocatedSymbol relocatedSymbol{NEO::SymbolInfo{}, 0x12345};
+    module1->symbols[unresolvedRelocation.symbolName] = relocatedSymbol;
+    module2->symbols[unresolvedRelocation.symbolName] = relocatedSymbol;
+
+    std::vector<ze_module_handle_t> hModules = {module0->toHandle(), module1->toHandle(), module2->toHandle()};
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_LINK_FAILURE, module0->performDynamicLink(3, hModules.data(), nullptr));
+    EXPECT_FALSE(module0->isFullyLinked);
+}
+
+TEST_F(ModuleDynamicLinkTests, givenUnresolvedSymbolInOneOfKernelsWhenDynamicLinkThenOnlyIsaOfThisKernelIsUploaded) {
+    uint64_t gpuAddress = 0x12345;
+    uint32_t offset = 0x20;
+
+    NEO::Linker::RelocationInfo unresolvedRelocation;
+    unresolvedRelocation.symbolName = "unresolved";
+    unresolvedRelocation.offset = offset;
+    unresolvedRelocation.type = NEO::Linker::RelocationInfo::Type::Address;
+
+    char kernelHeap[MemoryConstants::pageSize] = {};
+    std::vector<void *> isaPtrs;
+    for (uint32_t segmentId = 0; segmentId < 2; segmentId++) {
+        auto kernelInfo = std::make_unique<NEO::KernelInfo>();
+        kernelInfo->heapInfo.pKernelHeap = kernelHeap;
+        kernelInfo->heapInfo.KernelHeapSize = MemoryConstants::pageSize;
+        module0->getTranslationUnit()->programInfo.kernelInfos.push_back(kernelInfo.release());
+
+        auto kernelImmData = std::make_unique<WhiteBox<::L0::KernelImmutableData>>(device);
+        kernelImmData->isaGraphicsAllocation.reset(neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+            {device->getRootDeviceIndex(), MemoryConstants::pageSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, neoDevice->getDeviceBitfield()}));
+        isaPtrs.push_back(kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer());
+        memset(isaPtrs.back(), 0xFF, MemoryConstants::pageSize);
+        module0->kernelImmDatas.push_back(std::move(kernelImmData));
+    }
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+    module0->getTranslationUnit()->programInfo.linkerInput = std::move(linkerInput);
+    module0->unresolvedExternalsInfo.push_back({unresolvedRelocation});
+    module0->unresolvedExternalsInfo[0].instructionsSegmentId = 1u;
+
+    module1->symbols[unresolvedRelocation.symbolName] = NEO::Linker::RelocatedSymbol{NEO::SymbolInfo{}, gpuAddress};
+
+    std::vector<ze_module_handle_t> hModules = {module0->toHandle(), module1->toHandle()};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module0->performDynamicLink(2, hModules.data(), nullptr));
+
+    EXPECT_EQ(0xFFFFFFFFFFFFFFFFull, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtrs[0], offset)));
+    EXPECT_EQ(gpuAddress, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtrs[1], offset)));
+    EXPECT_EQ(0u, *reinterpret_cast<uint64_t *>(isaPtrs[1]));
+}
+
 class DeviceModuleSetArgBufferTest : public ModuleFixture, public ::testing::Test {
   public:
     void SetUp() override {
@@ -930,6 +1112,23 @@ kernels:
     EXPECT_NE(nullptr, moduleTuValid.programInfo.linkerInput.get());
 }
 
+HWTEST_F(ModuleTranslationUnitTest, WhenCreatingFromZeBinaryThenBinaryIsStoredOnceAndReturnedAsNativeBinary) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    auto hwInfo = device->getNEODevice()->getHardwareInfo();
+    zebin.elfHeader->machine = hwInfo.platform.eProductFamily;
+
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    bool success = moduleTu.createFromNativeBinary(reinterpret_cast<const char *>(zebin.storage.data()), zebin.storage.size());
+    EXPECT_TRUE(success);
+
+    EXPECT_EQ(nullptr, moduleTu.packedDeviceBinary);
+    ASSERT_NE(nullptr, moduleTu.unpackedDeviceBinary);
+    auto nativeBinary = moduleTu.getPackedDeviceBinary();
+    EXPECT_EQ(reinterpret_cast<const uint8_t *>(moduleTu.unpackedDeviceBinary.get()), nativeBinary.begin());
+    ASSERT_EQ(zebin.storage.size(), nativeBinary.size());
+    EXPECT_EQ(0, memcmp(zebin.storage.data(), nativeBinary.begin(), nativeBinary.size()));
+}
+
 HWTEST_F(ModuleTranslationUnitTest, WhenBuildOptionsAreNullThenReuseExistingOptions) {
     struct MockCompilerInterface : CompilerInterface {
         TranslationOutput::ErrorCode build(const NEO::Device &device,
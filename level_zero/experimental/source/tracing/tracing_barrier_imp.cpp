@@ -13,11 +13,11 @@ zeCommandListAppendBarrier_Tracing(ze_command_list_handle_t hCommandList,
                                    uint32_t numWaitEvents,
                                    ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendBarrier,
-                               hCommandList,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendBarrier,
+                            hCommandList,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_barrier_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -49,14 +49,14 @@ zeCommandListAppendMemoryRangesBarrier_Tracing(ze_command_list_handle_t hCommand
                                                uint32_t numWaitEvents,
                                                ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendMemoryRangesBarrier,
-                               hCommandList,
-                               numRanges,
-                               pRangeSizes,
-                               pRanges,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendMemoryRangesBarrier,
+                            hCommandList,
+                            numRanges,
+                            pRangeSizes,
+                            pRanges,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_memory_ranges_barrier_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
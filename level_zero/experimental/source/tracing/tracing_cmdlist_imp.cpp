@@ -13,11 +13,11 @@ zeCommandListCreate_Tracing(ze_context_handle_t hContext,
                             const ze_command_list_desc_t *desc,
                             ze_command_list_handle_t *phCommandList) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnCreate,
-                               hContext,
-                               hDevice,
-                               desc,
-                               phCommandList);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnCreate,
+                            hContext,
+                            hDevice,
+                            desc,
+                            phCommandList);
 
     ze_command_list_create_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -46,11 +46,11 @@ zeCommandListCreateImmediate_Tracing(ze_context_handle_t hContext,
                                      const ze_command_queue_desc_t *altdesc,
                                      ze_command_list_handle_t *phCommandList) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnCreateImmediate,
-                               hContext,
-                               hDevice,
-                               altdesc,
-                               phCommandList);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnCreateImmediate,
+                            hContext,
+                            hDevice,
+                            altdesc,
+                            phCommandList);
 
     ze_command_list_create_immediate_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -76,7 +76,7 @@ zeCommandListCreateImmediate_Tracing(ze_context_handle_t hContext,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeCommandListDestroy_Tracing(ze_command_list_handle_t hCommandList) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnDestroy, hCommandList);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnDestroy, hCommandList);
 
     ze_command_list_destroy_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -96,7 +96,7 @@ zeCommandListDestroy_Tracing(ze_command_list_handle_t hCommandList) {
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeCommandListClose_Tracing(ze_command_list_handle_t hCommandList) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnClose, hCommandList);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnClose, hCommandList);
 
     ze_command_list_close_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -116,8 +116,8 @@ zeCommandListClose_Tracing(ze_command_list_handle_t hCommandList) {
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeCommandListReset_Tracing(ze_command_list_handle_t hCommandList) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnReset,
-                               hCommandList);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnReset,
+                            hCommandList);
 
     ze_command_list_reset_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -141,12 +141,12 @@ zeCommandListAppendWriteGlobalTimestamp_Tracing(ze_command_list_handle_t hComman
                                                 uint32_t numWaitEvents,
                                                 ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendWriteGlobalTimestamp,
-                               hCommandList,
-                               dstptr,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendWriteGlobalTimestamp,
+                            hCommandList,
+                            dstptr,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_write_global_timestamp_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -181,15 +181,15 @@ zeCommandListAppendQueryKernelTimestamps_Tracing(ze_command_list_handle_t hComma
                                                  uint32_t numWaitEvents,
                                                  ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendQueryKernelTimestamps,
-                               hCommandList,
-                               numEvents,
-                               phEvents,
-                               dstptr,
-                               pOffsets,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendQueryKernelTimestamps,
+                            hCommandList,
+                            numEvents,
+                            phEvents,
+                            dstptr,
+                            pOffsets,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_query_kernel_timestamps_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
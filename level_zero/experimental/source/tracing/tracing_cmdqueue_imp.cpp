@@ -13,11 +13,11 @@ zeCommandQueueCreate_Tracing(ze_context_handle_t hContext,
                              const ze_command_queue_desc_t *desc,
                              ze_command_queue_handle_t *phCommandQueue) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandQueue.pfnCreate,
-                               hContext,
-                               hDevice,
-                               desc,
-                               phCommandQueue);
+    ZE_HANDLE_TRACER_BYPASS(CommandQueue, pfnCreate,
+                            hContext,
+                            hDevice,
+                            desc,
+                            phCommandQueue);
 
     ze_command_queue_create_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -42,8 +42,8 @@ zeCommandQueueCreate_Tracing(ze_context_handle_t hContext,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeCommandQueueDestroy_Tracing(ze_command_queue_handle_t hCommandQueue) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandQueue.pfnDestroy,
-                               hCommandQueue);
+    ZE_HANDLE_TRACER_BYPASS(CommandQueue, pfnDestroy,
+                            hCommandQueue);
 
     ze_command_queue_destroy_params_t tracerParams;
     tracerParams.phCommandQueue = &hCommandQueue;
@@ -65,11 +65,11 @@ zeCommandQueueExecuteCommandLists_Tracing(ze_command_queue_handle_t hCommandQueu
                                           ze_command_list_handle_t *phCommandLists,
                                           ze_fence_handle_t hFence) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandQueue.pfnExecuteCommandLists,
-                               hCommandQueue,
-                               numCommandLists,
-                               phCommandLists,
-                               hFence);
+    ZE_HANDLE_TRACER_BYPASS(CommandQueue, pfnExecuteCommandLists,
+                            hCommandQueue,
+                            numCommandLists,
+                            phCommandLists,
+                            hFence);
 
     ze_command_queue_execute_command_lists_params_t tracerParams;
     tracerParams.phCommandQueue = &hCommandQueue;
@@ -95,9 +95,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeCommandQueueSynchronize_Tracing(ze_command_queue_handle_t hCommandQueue,
                                   uint64_t timeout) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandQueue.pfnSynchronize,
-                               hCommandQueue,
-                               timeout);
+    ZE_HANDLE_TRACER_BYPASS(CommandQueue, pfnSynchronize,
+                            hCommandQueue,
+                            timeout);
 
     ze_command_queue_synchronize_params_t tracerParams;
     tracerParams.phCommandQueue = &hCommandQueue;
@@ -16,14 +16,14 @@ zeCommandListAppendMemoryCopy_Tracing(ze_command_list_handle_t hCommandList,
                                       uint32_t numWaitEvents,
                                       ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendMemoryCopy,
-                               hCommandList,
-                               dstptr,
-                               srcptr,
-                               size,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendMemoryCopy,
+                            hCommandList,
+                            dstptr,
+                            srcptr,
+                            size,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_memory_copy_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -62,15 +62,15 @@ zeCommandListAppendMemoryFill_Tracing(ze_command_list_handle_t hCommandList,
                                       uint32_t numWaitEvents,
                                       ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendMemoryFill,
-                               hCommandList,
-                               ptr,
-                               pattern,
-                               patternSize,
-                               size,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendMemoryFill,
+                            hCommandList,
+                            ptr,
+                            pattern,
+                            patternSize,
+                            size,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_memory_fill_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -115,19 +115,19 @@ zeCommandListAppendMemoryCopyRegion_Tracing(ze_command_list_handle_t hCommandLis
                                             uint32_t numWaitEvents,
                                             ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendMemoryCopyRegion,
-                               hCommandList,
-                               dstptr,
-                               dstRegion,
-                               dstPitch,
-                               dstSlicePitch,
-                               srcptr,
-                               srcRegion,
-                               srcPitch,
-                               srcSlicePitch,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendMemoryCopyRegion,
+                            hCommandList,
+                            dstptr,
+                            dstRegion,
+                            dstPitch,
+                            dstSlicePitch,
+                            srcptr,
+                            srcRegion,
+                            srcPitch,
+                            srcSlicePitch,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_memory_copy_region_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -176,15 +176,15 @@ zeCommandListAppendMemoryCopyFromContext_Tracing(ze_command_list_handle_t hComma
                                                  uint32_t numWaitEvents,
                                                  ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendMemoryCopyFromContext,
-                               hCommandList,
-                               dstptr,
-                               hContextSrc,
-                               srcptr,
-                               size,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendMemoryCopyFromContext,
+                            hCommandList,
+                            dstptr,
+                            hContextSrc,
+                            srcptr,
+                            size,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_memory_copy_from_context_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -223,13 +223,13 @@ zeCommandListAppendImageCopy_Tracing(ze_command_list_handle_t hCommandList,
                                      uint32_t numWaitEvents,
                                      ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendImageCopy,
-                               hCommandList,
-                               hDstImage,
-                               hSrcImage,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendImageCopy,
+                            hCommandList,
+                            hDstImage,
+                            hSrcImage,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_image_copy_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -266,15 +266,15 @@ zeCommandListAppendImageCopyRegion_Tracing(ze_command_list_handle_t hCommandList
                                            uint32_t numWaitEvents,
                                            ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendImageCopyRegion,
-                               hCommandList,
-                               hDstImage,
-                               hSrcImage,
-                               pDstRegion,
-                               pSrcRegion,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendImageCopyRegion,
+                            hCommandList,
+                            hDstImage,
+                            hSrcImage,
+                            pDstRegion,
+                            pSrcRegion,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_image_copy_region_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -314,14 +314,14 @@ zeCommandListAppendImageCopyToMemory_Tracing(ze_command_list_handle_t hCommandLi
                                              uint32_t numWaitEvents,
                                              ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendImageCopyToMemory,
-                               hCommandList,
-                               dstptr,
-                               hSrcImage,
-                               pSrcRegion,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendImageCopyToMemory,
+                            hCommandList,
+                            dstptr,
+                            hSrcImage,
+                            pSrcRegion,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_image_copy_to_memory_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -359,14 +359,14 @@ zeCommandListAppendImageCopyFromMemory_Tracing(ze_command_list_handle_t hCommand
                                                uint32_t numWaitEvents,
                                                ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendImageCopyFromMemory,
-                               hCommandList,
-                               hDstImage,
-                               srcptr,
-                               pDstRegion,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendImageCopyFromMemory,
+                            hCommandList,
+                            hDstImage,
+                            srcptr,
+                            pDstRegion,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_image_copy_from_memory_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -400,10 +400,10 @@ zeCommandListAppendMemoryPrefetch_Tracing(ze_command_list_handle_t hCommandList,
                                           const void *ptr,
                                           size_t size) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendMemoryPrefetch,
-                               hCommandList,
-                               ptr,
-                               size);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendMemoryPrefetch,
+                            hCommandList,
+                            ptr,
+                            size);
 
     ze_command_list_append_memory_prefetch_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -431,12 +431,12 @@ zeCommandListAppendMemAdvise_Tracing(ze_command_list_handle_t hCommandList,
                                      size_t size,
                                      ze_memory_advice_t advice) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendMemAdvise,
-                               hCommandList,
-                               hDevice,
-                               ptr,
-                               size,
-                               advice);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendMemAdvise,
+                            hCommandList,
+                            hDevice,
+                            ptr,
+                            size,
+                            advice);
 
     ze_command_list_append_mem_advise_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -12,10 +12,10 @@ zeDeviceGet_Tracing(ze_driver_handle_t hDriver,
                     uint32_t *pCount,
                     ze_device_handle_t *phDevices) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGet,
-                               hDriver,
-                               pCount,
-                               phDevices);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGet,
+                            hDriver,
+                            pCount,
+                            phDevices);
 
     ze_device_get_params_t tracerParams;
     tracerParams.phDriver = &hDriver;
@@ -40,9 +40,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDeviceGetProperties_Tracing(ze_device_handle_t hDevice,
                               ze_device_properties_t *pDeviceProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetProperties,
-                               hDevice,
-                               pDeviceProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetProperties,
+                            hDevice,
+                            pDeviceProperties);
 
     ze_device_get_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -65,9 +65,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDeviceGetComputeProperties_Tracing(ze_device_handle_t hDevice,
                                      ze_device_compute_properties_t *pComputeProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetComputeProperties,
-                               hDevice,
-                               pComputeProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetComputeProperties,
+                            hDevice,
+                            pComputeProperties);
 
     ze_device_get_compute_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -91,10 +91,10 @@ zeDeviceGetMemoryProperties_Tracing(ze_device_handle_t hDevice,
                                     uint32_t *pCount,
                                     ze_device_memory_properties_t *pMemProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetMemoryProperties,
-                               hDevice,
-                               pCount,
-                               pMemProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetMemoryProperties,
+                            hDevice,
+                            pCount,
+                            pMemProperties);
 
     ze_device_get_memory_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -120,10 +120,10 @@ zeDeviceGetCacheProperties_Tracing(ze_device_handle_t hDevice,
                                    uint32_t *pCount,
                                    ze_device_cache_properties_t *pCacheProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetCacheProperties,
-                               hDevice,
-                               pCount,
-                               pCacheProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetCacheProperties,
+                            hDevice,
+                            pCount,
+                            pCacheProperties);
 
     ze_device_get_cache_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -148,9 +148,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDeviceGetImageProperties_Tracing(ze_device_handle_t hDevice,
                                    ze_device_image_properties_t *pImageProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetImageProperties,
-                               hDevice,
-                               pImageProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetImageProperties,
+                            hDevice,
+                            pImageProperties);
 
     ze_device_get_image_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -174,10 +174,10 @@ zeDeviceGetSubDevices_Tracing(ze_device_handle_t hDevice,
                               uint32_t *pCount,
                               ze_device_handle_t *phSubdevices) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetSubDevices,
-                               hDevice,
-                               pCount,
-                               phSubdevices);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetSubDevices,
+                            hDevice,
+                            pCount,
+                            phSubdevices);
 
     ze_device_get_sub_devices_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -203,10 +203,10 @@ zeDeviceGetP2PProperties_Tracing(ze_device_handle_t hDevice,
                                  ze_device_handle_t hPeerDevice,
                                  ze_device_p2p_properties_t *pP2PProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetP2PProperties,
-                               hDevice,
-                               hPeerDevice,
-                               pP2PProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetP2PProperties,
+                            hDevice,
+                            hPeerDevice,
+                            pP2PProperties);
 
     ze_device_get_p2_p_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -232,10 +232,10 @@ zeDeviceCanAccessPeer_Tracing(ze_device_handle_t hDevice,
                               ze_device_handle_t hPeerDevice,
                               ze_bool_t *value) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnCanAccessPeer,
-                               hDevice,
-                               hPeerDevice,
-                               value);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnCanAccessPeer,
+                            hDevice,
+                            hPeerDevice,
+                            value);
 
     ze_device_can_access_peer_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -260,9 +260,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeKernelSetCacheConfig_Tracing(ze_kernel_handle_t hKernel,
                                ze_cache_config_flags_t flags) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnSetCacheConfig,
-                               hKernel,
-                               flags);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnSetCacheConfig,
+                            hKernel,
+                            flags);
 
     ze_kernel_set_cache_config_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -285,9 +285,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDeviceGetMemoryAccessProperties_Tracing(ze_device_handle_t hDevice,
                                           ze_device_memory_access_properties_t *pMemAccessProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetMemoryAccessProperties,
-                               hDevice,
-                               pMemAccessProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetMemoryAccessProperties,
+                            hDevice,
+                            pMemAccessProperties);
 
     ze_device_get_memory_access_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -311,9 +311,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDeviceGetModuleProperties_Tracing(ze_device_handle_t hDevice,
                                     ze_device_module_properties_t *pModuleProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetModuleProperties,
-                               hDevice,
-                               pModuleProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetModuleProperties,
+                            hDevice,
+                            pModuleProperties);
 
     ze_device_get_module_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -337,10 +337,10 @@ zeDeviceGetCommandQueueGroupProperties_Tracing(ze_device_handle_t hDevice,
                                                uint32_t *pCount,
                                                ze_command_queue_group_properties_t *pCommandQueueGroupProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetCommandQueueGroupProperties,
-                               hDevice,
-                               pCount,
-                               pCommandQueueGroupProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetCommandQueueGroupProperties,
+                            hDevice,
+                            pCount,
+                            pCommandQueueGroupProperties);
 
     ze_device_get_command_queue_group_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -365,9 +365,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDeviceGetExternalMemoryProperties_Tracing(ze_device_handle_t hDevice,
                                             ze_device_external_memory_properties_t *pExternalMemoryProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetExternalMemoryProperties,
-                               hDevice,
-                               pExternalMemoryProperties);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetExternalMemoryProperties,
+                            hDevice,
+                            pExternalMemoryProperties);
 
     ze_device_get_external_memory_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -389,8 +389,8 @@ zeDeviceGetExternalMemoryProperties_Tracing(ze_device_handle_t hDevice,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDeviceGetStatus_Tracing(ze_device_handle_t hDevice) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Device.pfnGetStatus,
-                               hDevice);
+    ZE_HANDLE_TRACER_BYPASS(Device, pfnGetStatus,
+                            hDevice);
 
     ze_device_get_status_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
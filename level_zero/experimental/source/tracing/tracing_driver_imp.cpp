@@ -11,9 +11,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDriverGet_Tracing(uint32_t *pCount,
                     ze_driver_handle_t *phDrivers) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Driver.pfnGet,
-                               pCount,
-                               phDrivers);
+    ZE_HANDLE_TRACER_BYPASS(Driver, pfnGet,
+                            pCount,
+                            phDrivers);
 
     ze_driver_get_params_t tracerParams;
     tracerParams.ppCount = &pCount;
@@ -36,9 +36,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDriverGetProperties_Tracing(ze_driver_handle_t hDriver,
                               ze_driver_properties_t *properties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Driver.pfnGetProperties,
-                               hDriver,
-                               properties);
+    ZE_HANDLE_TRACER_BYPASS(Driver, pfnGetProperties,
+                            hDriver,
+                            properties);
     ze_driver_get_properties_params_t tracerParams;
     tracerParams.phDriver = &hDriver;
     tracerParams.ppDriverProperties = &properties;
@@ -60,7 +60,7 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDriverGetApiVersion_Tracing(ze_driver_handle_t hDrivers,
                               ze_api_version_t *version) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Driver.pfnGetApiVersion, hDrivers, version);
+    ZE_HANDLE_TRACER_BYPASS(Driver, pfnGetApiVersion, hDrivers, version);
 
     ze_driver_get_api_version_params_t tracerParams;
     tracerParams.phDriver = &hDrivers;
@@ -83,9 +83,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeDriverGetIpcProperties_Tracing(ze_driver_handle_t hDriver,
                                  ze_driver_ipc_properties_t *pIpcProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Driver.pfnGetIpcProperties,
-                               hDriver,
-                               pIpcProperties);
+    ZE_HANDLE_TRACER_BYPASS(Driver, pfnGetIpcProperties,
+                            hDriver,
+                            pIpcProperties);
 
     ze_driver_get_ipc_properties_params_t tracerParams;
     tracerParams.phDriver = &hDriver;
@@ -109,10 +109,10 @@ zeDriverGetExtensionProperties_Tracing(ze_driver_handle_t hDriver,
                                        uint32_t *pCount,
                                        ze_driver_extension_properties_t *pExtensionProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Driver.pfnGetExtensionProperties,
-                               hDriver,
-                               pCount,
-                               pExtensionProperties);
+    ZE_HANDLE_TRACER_BYPASS(Driver, pfnGetExtensionProperties,
+                            hDriver,
+                            pCount,
+                            pExtensionProperties);
 
     ze_driver_get_extension_properties_params_t tracerParams;
     tracerParams.phDriver = &hDriver;
@@ -14,12 +14,12 @@ zeEventPoolCreate_Tracing(ze_context_handle_t hContext,
                           ze_device_handle_t *phDevices,
                           ze_event_pool_handle_t *phEventPool) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.EventPool.pfnCreate,
-                               hContext,
-                               desc,
-                               numDevices,
-                               phDevices,
-                               phEventPool);
+    ZE_HANDLE_TRACER_BYPASS(EventPool, pfnCreate,
+                            hContext,
+                            desc,
+                            numDevices,
+                            phDevices,
+                            phEventPool);
 
     ze_event_pool_create_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -47,8 +47,8 @@ zeEventPoolCreate_Tracing(ze_context_handle_t hContext,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventPoolDestroy_Tracing(ze_event_pool_handle_t hEventPool) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.EventPool.pfnDestroy,
-                               hEventPool);
+    ZE_HANDLE_TRACER_BYPASS(EventPool, pfnDestroy,
+                            hEventPool);
 
     ze_event_pool_destroy_params_t tracerParams;
     tracerParams.phEventPool = &hEventPool;
@@ -70,10 +70,10 @@ zeEventCreate_Tracing(ze_event_pool_handle_t hEventPool,
                       const ze_event_desc_t *desc,
                       ze_event_handle_t *phEvent) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Event.pfnCreate,
-                               hEventPool,
-                               desc,
-                               phEvent);
+    ZE_HANDLE_TRACER_BYPASS(Event, pfnCreate,
+                            hEventPool,
+                            desc,
+                            phEvent);
 
     ze_event_create_params_t tracerParams;
     tracerParams.phEventPool = &hEventPool;
@@ -97,8 +97,8 @@ zeEventCreate_Tracing(ze_event_pool_handle_t hEventPool,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventDestroy_Tracing(ze_event_handle_t hEvent) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Event.pfnDestroy,
-                               hEvent);
+    ZE_HANDLE_TRACER_BYPASS(Event, pfnDestroy,
+                            hEvent);
 
     ze_event_destroy_params_t tracerParams;
     tracerParams.phEvent = &hEvent;
@@ -119,9 +119,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventPoolGetIpcHandle_Tracing(ze_event_pool_handle_t hEventPool,
                                 ze_ipc_event_pool_handle_t *phIpc) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.EventPool.pfnGetIpcHandle,
-                               hEventPool,
-                               phIpc);
+    ZE_HANDLE_TRACER_BYPASS(EventPool, pfnGetIpcHandle,
+                            hEventPool,
+                            phIpc);
 
     ze_event_pool_get_ipc_handle_params_t tracerParams;
     tracerParams.phEventPool = &hEventPool;
@@ -145,10 +145,10 @@ zeEventPoolOpenIpcHandle_Tracing(ze_context_handle_t hContext,
                                  ze_ipc_event_pool_handle_t hIpc,
                                  ze_event_pool_handle_t *phEventPool) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.EventPool.pfnOpenIpcHandle,
-                               hContext,
-                               hIpc,
-                               phEventPool);
+    ZE_HANDLE_TRACER_BYPASS(EventPool, pfnOpenIpcHandle,
+                            hContext,
+                            hIpc,
+                            phEventPool);
 
     ze_event_pool_open_ipc_handle_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -172,8 +172,8 @@ zeEventPoolOpenIpcHandle_Tracing(ze_context_handle_t hContext,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventPoolCloseIpcHandle_Tracing(ze_event_pool_handle_t hEventPool) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.EventPool.pfnCloseIpcHandle,
-                               hEventPool);
+    ZE_HANDLE_TRACER_BYPASS(EventPool, pfnCloseIpcHandle,
+                            hEventPool);
 
     ze_event_pool_close_ipc_handle_params_t tracerParams;
     tracerParams.phEventPool = &hEventPool;
@@ -194,9 +194,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeCommandListAppendSignalEvent_Tracing(ze_command_list_handle_t hCommandList,
                                        ze_event_handle_t hEvent) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendSignalEvent,
-                               hCommandList,
-                               hEvent);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendSignalEvent,
+                            hCommandList,
+                            hEvent);
 
     ze_command_list_append_signal_event_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -220,10 +220,10 @@ zeCommandListAppendWaitOnEvents_Tracing(ze_command_list_handle_t hCommandList,
                                         uint32_t numEvents,
                                         ze_event_handle_t *phEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendWaitOnEvents,
-                               hCommandList,
-                               numEvents,
-                               phEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendWaitOnEvents,
+                            hCommandList,
+                            numEvents,
+                            phEvents);
 
     ze_command_list_append_wait_on_events_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -247,8 +247,8 @@ zeCommandListAppendWaitOnEvents_Tracing(ze_command_list_handle_t hCommandList,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventHostSignal_Tracing(ze_event_handle_t hEvent) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Event.pfnHostSignal,
-                               hEvent);
+    ZE_HANDLE_TRACER_BYPASS(Event, pfnHostSignal,
+                            hEvent);
 
     ze_event_host_signal_params_t tracerParams;
     tracerParams.phEvent = &hEvent;
@@ -269,9 +269,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventHostSynchronize_Tracing(ze_event_handle_t hEvent,
                                uint64_t timeout) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Event.pfnHostSynchronize,
-                               hEvent,
-                               timeout);
+    ZE_HANDLE_TRACER_BYPASS(Event, pfnHostSynchronize,
+                            hEvent,
+                            timeout);
 
     ze_event_host_synchronize_params_t tracerParams;
     tracerParams.phEvent = &hEvent;
@@ -293,8 +293,8 @@ zeEventHostSynchronize_Tracing(ze_event_handle_t hEvent,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventQueryStatus_Tracing(ze_event_handle_t hEvent) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Event.pfnQueryStatus,
-                               hEvent);
+    ZE_HANDLE_TRACER_BYPASS(Event, pfnQueryStatus,
+                            hEvent);
 
     ze_event_query_status_params_t tracerParams;
     tracerParams.phEvent = &hEvent;
@@ -314,8 +314,8 @@ zeEventQueryStatus_Tracing(ze_event_handle_t hEvent) {
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventHostReset_Tracing(ze_event_handle_t hEvent) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Event.pfnHostReset,
-                               hEvent);
+    ZE_HANDLE_TRACER_BYPASS(Event, pfnHostReset,
+                            hEvent);
 
     ze_event_host_reset_params_t tracerParams;
     tracerParams.phEvent = &hEvent;
@@ -336,9 +336,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeCommandListAppendEventReset_Tracing(ze_command_list_handle_t hCommandList,
                                       ze_event_handle_t hEvent) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendEventReset,
-                               hCommandList,
-                               hEvent);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendEventReset,
+                            hCommandList,
+                            hEvent);
 
     ze_command_list_append_event_reset_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -362,9 +362,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeEventQueryKernelTimestamp_Tracing(ze_event_handle_t hEvent,
                                     ze_kernel_timestamp_result_t *dstptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Event.pfnQueryKernelTimestamp,
-                               hEvent,
-                               dstptr);
+    ZE_HANDLE_TRACER_BYPASS(Event, pfnQueryKernelTimestamp,
+                            hEvent,
+                            dstptr);
 
     ze_event_query_kernel_timestamp_params_t tracerParams;
     tracerParams.phEvent = &hEvent;
@@ -12,10 +12,10 @@ zeFenceCreate_Tracing(ze_command_queue_handle_t hCommandQueue,
                       const ze_fence_desc_t *desc,
                       ze_fence_handle_t *phFence) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Fence.pfnCreate,
-                               hCommandQueue,
-                               desc,
-                               phFence);
+    ZE_HANDLE_TRACER_BYPASS(Fence, pfnCreate,
+                            hCommandQueue,
+                            desc,
+                            phFence);
 
     ze_fence_create_params_t tracerParams;
     tracerParams.phCommandQueue = &hCommandQueue;
@@ -39,8 +39,8 @@ zeFenceCreate_Tracing(ze_command_queue_handle_t hCommandQueue,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeFenceDestroy_Tracing(ze_fence_handle_t hFence) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Fence.pfnDestroy,
-                               hFence);
+    ZE_HANDLE_TRACER_BYPASS(Fence, pfnDestroy,
+                            hFence);
 
     ze_fence_destroy_params_t tracerParams;
     tracerParams.phFence = &hFence;
@@ -61,9 +61,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeFenceHostSynchronize_Tracing(ze_fence_handle_t hFence,
                                uint64_t timeout) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Fence.pfnHostSynchronize,
-                               hFence,
-                               timeout);
+    ZE_HANDLE_TRACER_BYPASS(Fence, pfnHostSynchronize,
+                            hFence,
+                            timeout);
 
     ze_fence_host_synchronize_params_t tracerParams;
     tracerParams.phFence = &hFence;
@@ -85,8 +85,8 @@ zeFenceHostSynchronize_Tracing(ze_fence_handle_t hFence,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeFenceQueryStatus_Tracing(ze_fence_handle_t hFence) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Fence.pfnQueryStatus,
-                               hFence);
+    ZE_HANDLE_TRACER_BYPASS(Fence, pfnQueryStatus,
+                            hFence);
 
     ze_fence_query_status_params_t tracerParams;
     tracerParams.phFence = &hFence;
@@ -106,8 +106,8 @@ zeFenceQueryStatus_Tracing(ze_fence_handle_t hFence) {
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeFenceReset_Tracing(ze_fence_handle_t hFence) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Fence.pfnReset,
-                               hFence);
+    ZE_HANDLE_TRACER_BYPASS(Fence, pfnReset,
+                            hFence);
 
     ze_fence_reset_params_t tracerParams;
     tracerParams.phFence = &hFence;
@@ -9,8 +9,8 @@
 
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeInit_Tracing(ze_init_flags_t flags) {
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Global.pfnInit,
-                               flags);
+    ZE_HANDLE_TRACER_BYPASS(Global, pfnInit,
+                            flags);
 
     ze_init_params_t tracerParams;
     tracerParams.pflags = &flags;
@@ -12,10 +12,10 @@ zeImageGetProperties_Tracing(ze_device_handle_t hDevice,
                              const ze_image_desc_t *desc,
                              ze_image_properties_t *pImageProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Image.pfnGetProperties,
-                               hDevice,
-                               desc,
-                               pImageProperties);
+    ZE_HANDLE_TRACER_BYPASS(Image, pfnGetProperties,
+                            hDevice,
+                            desc,
+                            pImageProperties);
 
     ze_image_get_properties_params_t tracerParams;
     tracerParams.phDevice = &hDevice;
@@ -42,11 +42,11 @@ zeImageCreate_Tracing(ze_context_handle_t hContext,
                       const ze_image_desc_t *desc,
                       ze_image_handle_t *phImage) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Image.pfnCreate,
-                               hContext,
-                               hDevice,
-                               desc,
-                               phImage);
+    ZE_HANDLE_TRACER_BYPASS(Image, pfnCreate,
+                            hContext,
+                            hDevice,
+                            desc,
+                            phImage);
 
     ze_image_create_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -72,8 +72,8 @@ zeImageCreate_Tracing(ze_context_handle_t hContext,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeImageDestroy_Tracing(ze_image_handle_t hImage) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Image.pfnDestroy,
-                               hImage);
+    ZE_HANDLE_TRACER_BYPASS(Image, pfnDestroy,
+                            hImage);
 
     ze_image_destroy_params_t tracerParams;
     tracerParams.phImage = &hImage;
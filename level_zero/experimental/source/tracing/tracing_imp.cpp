@@ -9,9 +9,12 @@
 
 #include "shared/source/helpers/debug_helpers.h"
 
+#include <cstring>
+
 namespace L0 {
 
 thread_local ze_bool_t tracingInProgress = 0;
+std::atomic<uint64_t> tracedApiMask[tracedApiMaskSize] = {};
 
 struct APITracerContextImp globalAPITracerContextImp;
 struct APITracerContextImp *pGlobalAPITracerContextImp = &globalAPITracerContextImp;
@@ -196,6 +199,7 @@ int APITracerContextImp::updateTracerArrays() {
     } else {
         newTracerArray = &emptyTracerArray;
     }
+    updateTracedApiMask();
     //
     // active_tracer_array.load can use memory_order_relaxed here because
     // there is logically no transfer of other memory context between
@@ -216,6 +220,28 @@ int APITracerContextImp::updateTracerArrays() {
     return 0;
 }
 
+void APITracerContextImp::updateTracedApiMask() {
+    constexpr size_t callbacksCount = sizeof(zet_core_callbacks_t) / sizeof(void *);
+    static_assert(sizeof(zet_core_callbacks_t) % sizeof(void *) == 0, "core callbacks table has to contain only function pointers");
+
+    uint64_t newMask[tracedApiMaskSize] = {};
+    for (auto tracerImp : enabledTracerImpList) {
+        for (auto callbacksTable : {&tracerImp->tracerFunctions.corePrologues, &tracerImp->tracerFunctions.coreEpilogues}) {
+            void *callbacks[callbacksCount];
+            memcpy(callbacks, callbacksTable, sizeof(zet_core_callbacks_t));
+            for (size_t i = 0; i < callbacksCount; i++) {
+                if (callbacks[i] != nullptr) {
+                    newMask[i / 64] |= 1ull << (i % 64);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < tracedApiMaskSize; i++) {
+        tracedApiMask[i].store(newMask[i], std::memory_order_relaxed);
+    }
+}
+
 ze_result_t APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp, ze_bool_t enable) {
     std::lock_guard<std::mutex> lock(traceTableMutex);
     ze_result_t result;
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <list>
 #include <mutex>
 #include <thread>
@@ -41,6 +42,14 @@ namespace L0 {
 extern thread_local ze_bool_t tracingInProgress;
 extern struct APITracerContextImp *pGlobalAPITracerContextImp;
 
+// One bit per callback of zet_core_callbacks_t, set when any enabled tracer registered prologue or epilogue for it
+constexpr size_t tracedApiMaskSize = (sizeof(zet_core_callbacks_t) / sizeof(void *) + 63) / 64;
+extern std::atomic<uint64_t> tracedApiMask[tracedApiMaskSize];
+
+inline bool isApiTraced(size_t callbackIndex) {
+    return (tracedApiMask[callbackIndex / 64].load(std::memory_order_relaxed) & (1ull << (callbackIndex % 64))) != 0;
+}
+
 typedef struct tracer_array_entry {
     zet_core_callbacks_t corePrologues;
     zet_core_callbacks_t coreEpilogues;
@@ -128,6 +137,7 @@ struct APITracerContextImp : APITracerContext {
     ze_bool_t testForTracerArrayReferences(tracer_array_t *tracerArray);
     size_t testAndFreeRetiredTracers();
     int updateTracerArrays();
+    void updateTracedApiMask();
 
     std::list<ThreadPrivateTracerData *> threadTracerDataList;
     std::mutex threadTracerDataListMutex;
@@ -158,6 +168,18 @@ class APITracerCallbackDataImp {
         L0::tracingInProgress = 1;                  \
     } while (0)
 
+#define ZE_TRACER_CALLBACK_INDEX(callbackCategory, callbackFunction) \
+    (offsetof(zet_core_callbacks_t, callbackCategory.callbackFunction) / sizeof(void *))
+
+// APIs without active callback skip all tracing bookkeeping and go straight to implementation
+#define ZE_HANDLE_TRACER_BYPASS(callbackCategory, apiFunction, ...)                          \
+    do {                                                                                     \
+        if (!L0::isApiTraced(ZE_TRACER_CALLBACK_INDEX(callbackCategory, apiFunction##Cb))) { \
+            return driver_ddiTable.core_ddiTable.callbackCategory.apiFunction(__VA_ARGS__);  \
+        }                                                                                    \
+    } while (0);                                                                             \
+    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.callbackCategory.apiFunction, __VA_ARGS__)
+
 #define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, callbackType, callbackCategory, callbackFunction) \
     do {                                                                                                                        \
         callbackPtr = tracerArray->tracerArrayEntries[tracerArrayIndex].callbackType.callbackCategory.callbackFunction;         \
@@ -16,14 +16,14 @@ zeMemAllocShared_Tracing(ze_context_handle_t hContext,
                          ze_device_handle_t hDevice,
                          void **pptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnAllocShared,
-                               hContext,
-                               deviceDesc,
-                               hostDesc,
-                               size,
-                               alignment,
-                               hDevice,
-                               pptr);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnAllocShared,
+                            hContext,
+                            deviceDesc,
+                            hostDesc,
+                            size,
+                            alignment,
+                            hDevice,
+                            pptr);
 
     ze_mem_alloc_shared_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -60,13 +60,13 @@ zeMemAllocDevice_Tracing(ze_context_handle_t hContext,
                          ze_device_handle_t hDevice,
                          void **pptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnAllocDevice,
-                               hContext,
-                               deviceDesc,
-                               size,
-                               alignment,
-                               hDevice,
-                               pptr);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnAllocDevice,
+                            hContext,
+                            deviceDesc,
+                            size,
+                            alignment,
+                            hDevice,
+                            pptr);
 
     ze_mem_alloc_device_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -100,12 +100,12 @@ zeMemAllocHost_Tracing(ze_context_handle_t hContext,
                        size_t alignment,
                        void **pptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnAllocHost,
-                               hContext,
-                               hostDesc,
-                               size,
-                               alignment,
-                               pptr);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnAllocHost,
+                            hContext,
+                            hostDesc,
+                            size,
+                            alignment,
+                            pptr);
 
     ze_mem_alloc_host_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -134,9 +134,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeMemFree_Tracing(ze_context_handle_t hContext,
                   void *ptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnFree,
-                               hContext,
-                               ptr);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnFree,
+                            hContext,
+                            ptr);
 
     ze_mem_free_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -161,11 +161,11 @@ zeMemGetAllocProperties_Tracing(ze_context_handle_t hContext,
                                 ze_memory_allocation_properties_t *pMemAllocProperties,
                                 ze_device_handle_t *phDevice) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnGetAllocProperties,
-                               hContext,
-                               ptr,
-                               pMemAllocProperties,
-                               phDevice);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnGetAllocProperties,
+                            hContext,
+                            ptr,
+                            pMemAllocProperties,
+                            phDevice);
 
     ze_mem_get_alloc_properties_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -194,11 +194,11 @@ zeMemGetAddressRange_Tracing(ze_context_handle_t hContext,
                              void **pBase,
                              size_t *pSize) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnGetAddressRange,
-                               hContext,
-                               ptr,
-                               pBase,
-                               pSize);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnGetAddressRange,
+                            hContext,
+                            ptr,
+                            pBase,
+                            pSize);
 
     ze_mem_get_address_range_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -226,10 +226,10 @@ zeMemGetIpcHandle_Tracing(ze_context_handle_t hContext,
                           const void *ptr,
                           ze_ipc_mem_handle_t *pIpcHandle) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnGetIpcHandle,
-                               hContext,
-                               ptr,
-                               pIpcHandle);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnGetIpcHandle,
+                            hContext,
+                            ptr,
+                            pIpcHandle);
 
     ze_mem_get_ipc_handle_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -257,12 +257,12 @@ zeMemOpenIpcHandle_Tracing(ze_context_handle_t hContext,
                            ze_ipc_memory_flags_t flags,
                            void **pptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnOpenIpcHandle,
-                               hContext,
-                               hDevice,
-                               handle,
-                               flags,
-                               pptr);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnOpenIpcHandle,
+                            hContext,
+                            hDevice,
+                            handle,
+                            flags,
+                            pptr);
 
     ze_mem_open_ipc_handle_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -291,9 +291,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeMemCloseIpcHandle_Tracing(ze_context_handle_t hContext,
                             const void *ptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Mem.pfnCloseIpcHandle,
-                               hContext,
-                               ptr);
+    ZE_HANDLE_TRACER_BYPASS(Mem, pfnCloseIpcHandle,
+                            hContext,
+                            ptr);
 
     ze_mem_close_ipc_handle_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -318,11 +318,11 @@ zeVirtualMemReserve_Tracing(ze_context_handle_t hContext,
                             size_t size,
                             void **pptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.VirtualMem.pfnReserve,
-                               hContext,
-                               pStart,
-                               size,
-                               pptr);
+    ZE_HANDLE_TRACER_BYPASS(VirtualMem, pfnReserve,
+                            hContext,
+                            pStart,
+                            size,
+                            pptr);
 
     ze_virtual_mem_reserve_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -350,10 +350,10 @@ zeVirtualMemFree_Tracing(ze_context_handle_t hContext,
                          const void *ptr,
                          size_t size) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.VirtualMem.pfnFree,
-                               hContext,
-                               ptr,
-                               size);
+    ZE_HANDLE_TRACER_BYPASS(VirtualMem, pfnFree,
+                            hContext,
+                            ptr,
+                            size);
 
     ze_virtual_mem_free_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -380,11 +380,11 @@ zeVirtualMemQueryPageSize_Tracing(ze_context_handle_t hContext,
                                   size_t size,
                                   size_t *pagesize) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.VirtualMem.pfnQueryPageSize,
-                               hContext,
-                               hDevice,
-                               size,
-                               pagesize);
+    ZE_HANDLE_TRACER_BYPASS(VirtualMem, pfnQueryPageSize,
+                            hContext,
+                            hDevice,
+                            size,
+                            pagesize);
 
     ze_virtual_mem_query_page_size_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -415,13 +415,13 @@ zeVirtualMemMap_Tracing(ze_context_handle_t hContext,
                         size_t offset,
                         ze_memory_access_attribute_t access) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.VirtualMem.pfnMap,
-                               hContext,
-                               ptr,
-                               size,
-                               hPhysicalMemory,
-                               offset,
-                               access);
+    ZE_HANDLE_TRACER_BYPASS(VirtualMem, pfnMap,
+                            hContext,
+                            ptr,
+                            size,
+                            hPhysicalMemory,
+                            offset,
+                            access);
 
     ze_virtual_mem_map_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -453,10 +453,10 @@ zeVirtualMemUnmap_Tracing(ze_context_handle_t hContext,
                           const void *ptr,
                           size_t size) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.VirtualMem.pfnUnmap,
-                               hContext,
-                               ptr,
-                               size);
+    ZE_HANDLE_TRACER_BYPASS(VirtualMem, pfnUnmap,
+                            hContext,
+                            ptr,
+                            size);
 
     ze_virtual_mem_unmap_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -483,11 +483,11 @@ zeVirtualMemSetAccessAttribute_Tracing(ze_context_handle_t hContext,
                                        size_t size,
                                        ze_memory_access_attribute_t access) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.VirtualMem.pfnSetAccessAttribute,
-                               hContext,
-                               ptr,
-                               size,
-                               access);
+    ZE_HANDLE_TRACER_BYPASS(VirtualMem, pfnSetAccessAttribute,
+                            hContext,
+                            ptr,
+                            size,
+                            access);
 
     ze_virtual_mem_set_access_attribute_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -517,12 +517,12 @@ zeVirtualMemGetAccessAttribute_Tracing(ze_context_handle_t hContext,
                                        ze_memory_access_attribute_t *access,
                                        size_t *outSize) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.VirtualMem.pfnGetAccessAttribute,
-                               hContext,
-                               ptr,
-                               size,
-                               access,
-                               outSize);
+    ZE_HANDLE_TRACER_BYPASS(VirtualMem, pfnGetAccessAttribute,
+                            hContext,
+                            ptr,
+                            size,
+                            access,
+                            outSize);
 
     ze_virtual_mem_get_access_attribute_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -553,11 +553,11 @@ zePhysicalMemCreate_Tracing(ze_context_handle_t hContext,
                             ze_physical_mem_desc_t *desc,
                             ze_physical_mem_handle_t *phPhysicalMemory) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.PhysicalMem.pfnCreate,
-                               hContext,
-                               hDevice,
-                               desc,
-                               phPhysicalMemory);
+    ZE_HANDLE_TRACER_BYPASS(PhysicalMem, pfnCreate,
+                            hContext,
+                            hDevice,
+                            desc,
+                            phPhysicalMemory);
 
     ze_physical_mem_create_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -584,9 +584,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zePhysicalMemDestroy_Tracing(ze_context_handle_t hContext,
                              ze_physical_mem_handle_t hPhysicalMemory) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.PhysicalMem.pfnDestroy,
-                               hContext,
-                               hPhysicalMemory);
+    ZE_HANDLE_TRACER_BYPASS(PhysicalMem, pfnDestroy,
+                            hContext,
+                            hPhysicalMemory);
 
     ze_physical_mem_destroy_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -14,12 +14,12 @@ zeModuleCreate_Tracing(ze_context_handle_t hContext,
                        ze_module_handle_t *phModule,
                        ze_module_build_log_handle_t *phBuildLog) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnCreate,
-                               hContext,
-                               hDevice,
-                               desc,
-                               phModule,
-                               phBuildLog);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnCreate,
+                            hContext,
+                            hDevice,
+                            desc,
+                            phModule,
+                            phBuildLog);
 
     ze_module_create_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -47,8 +47,8 @@ zeModuleCreate_Tracing(ze_context_handle_t hContext,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeModuleDestroy_Tracing(ze_module_handle_t hModule) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnDestroy,
-                               hModule);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnDestroy,
+                            hModule);
 
     ze_module_destroy_params_t tracerParams;
     tracerParams.phModule = &hModule;
@@ -68,8 +68,8 @@ zeModuleDestroy_Tracing(ze_module_handle_t hModule) {
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeModuleBuildLogDestroy_Tracing(ze_module_build_log_handle_t hModuleBuildLog) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.ModuleBuildLog.pfnDestroy,
-                               hModuleBuildLog);
+    ZE_HANDLE_TRACER_BYPASS(ModuleBuildLog, pfnDestroy,
+                            hModuleBuildLog);
 
     ze_module_build_log_destroy_params_t tracerParams;
     tracerParams.phModuleBuildLog = &hModuleBuildLog;
@@ -91,10 +91,10 @@ zeModuleBuildLogGetString_Tracing(ze_module_build_log_handle_t hModuleBuildLog,
                                   size_t *pSize,
                                   char *pBuildLog) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.ModuleBuildLog.pfnGetString,
-                               hModuleBuildLog,
-                               pSize,
-                               pBuildLog);
+    ZE_HANDLE_TRACER_BYPASS(ModuleBuildLog, pfnGetString,
+                            hModuleBuildLog,
+                            pSize,
+                            pBuildLog);
 
     ze_module_build_log_get_string_params_t tracerParams;
     tracerParams.phModuleBuildLog = &hModuleBuildLog;
@@ -120,10 +120,10 @@ zeModuleGetNativeBinary_Tracing(ze_module_handle_t hModule,
                                 size_t *pSize,
                                 uint8_t *pModuleNativeBinary) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnGetNativeBinary,
-                               hModule,
-                               pSize,
-                               pModuleNativeBinary);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnGetNativeBinary,
+                            hModule,
+                            pSize,
+                            pModuleNativeBinary);
 
     ze_module_get_native_binary_params_t tracerParams;
     tracerParams.phModule = &hModule;
@@ -150,11 +150,11 @@ zeModuleGetGlobalPointer_Tracing(ze_module_handle_t hModule,
                                  size_t *pSize,
                                  void **pptr) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnGetGlobalPointer,
-                               hModule,
-                               pGlobalName,
-                               pSize,
-                               pptr);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnGetGlobalPointer,
+                            hModule,
+                            pGlobalName,
+                            pSize,
+                            pptr);
 
     ze_module_get_global_pointer_params_t tracerParams;
     tracerParams.phModule = &hModule;
@@ -182,10 +182,10 @@ zeModuleDynamicLink_Tracing(uint32_t numModules,
                             ze_module_handle_t *phModules,
                             ze_module_build_log_handle_t *phLinkLog) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnDynamicLink,
-                               numModules,
-                               phModules,
-                               phLinkLog);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnDynamicLink,
+                            numModules,
+                            phModules,
+                            phLinkLog);
 
     ze_module_dynamic_link_params_t tracerParams;
     tracerParams.pnumModules = &numModules;
@@ -210,9 +210,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeModuleGetProperties_Tracing(ze_module_handle_t hModule,
                               ze_module_properties_t *pModuleProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnGetProperties,
-                               hModule,
-                               pModuleProperties);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnGetProperties,
+                            hModule,
+                            pModuleProperties);
 
     ze_module_get_properties_params_t tracerParams;
     tracerParams.phModule = &hModule;
@@ -236,10 +236,10 @@ zeKernelCreate_Tracing(ze_module_handle_t hModule,
                        const ze_kernel_desc_t *desc,
                        ze_kernel_handle_t *phKernel) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnCreate,
-                               hModule,
-                               desc,
-                               phKernel);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnCreate,
+                            hModule,
+                            desc,
+                            phKernel);
 
     ze_kernel_create_params_t tracerParams;
     tracerParams.phModule = &hModule;
@@ -263,8 +263,8 @@ zeKernelCreate_Tracing(ze_module_handle_t hModule,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeKernelDestroy_Tracing(ze_kernel_handle_t hKernel) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnDestroy,
-                               hKernel);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnDestroy,
+                            hKernel);
 
     ze_kernel_destroy_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -286,10 +286,10 @@ zeModuleGetFunctionPointer_Tracing(ze_module_handle_t hModule,
                                    const char *pKernelName,
                                    void **pfnFunction) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnGetFunctionPointer,
-                               hModule,
-                               pKernelName,
-                               pfnFunction);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnGetFunctionPointer,
+                            hModule,
+                            pKernelName,
+                            pfnFunction);
 
     ze_module_get_function_pointer_params_t tracerParams;
     tracerParams.phModule = &hModule;
@@ -316,11 +316,11 @@ zeKernelSetGroupSize_Tracing(ze_kernel_handle_t hKernel,
                              uint32_t groupSizeY,
                              uint32_t groupSizeZ) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnSetGroupSize,
-                               hKernel,
-                               groupSizeX,
-                               groupSizeY,
-                               groupSizeZ);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnSetGroupSize,
+                            hKernel,
+                            groupSizeX,
+                            groupSizeY,
+                            groupSizeZ);
 
     ze_kernel_set_group_size_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -352,14 +352,14 @@ zeKernelSuggestGroupSize_Tracing(ze_kernel_handle_t hKernel,
                                  uint32_t *groupSizeY,
                                  uint32_t *groupSizeZ) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnSuggestGroupSize,
-                               hKernel,
-                               globalSizeX,
-                               globalSizeY,
-                               globalSizeZ,
-                               groupSizeX,
-                               groupSizeY,
-                               groupSizeZ);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnSuggestGroupSize,
+                            hKernel,
+                            globalSizeX,
+                            globalSizeY,
+                            globalSizeZ,
+                            groupSizeX,
+                            groupSizeY,
+                            groupSizeZ);
 
     ze_kernel_suggest_group_size_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -394,11 +394,11 @@ zeKernelSetArgumentValue_Tracing(ze_kernel_handle_t hKernel,
                                  size_t argSize,
                                  const void *pArgValue) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnSetArgumentValue,
-                               hKernel,
-                               argIndex,
-                               argSize,
-                               pArgValue);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnSetArgumentValue,
+                            hKernel,
+                            argIndex,
+                            argSize,
+                            pArgValue);
 
     ze_kernel_set_argument_value_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -425,9 +425,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeKernelGetProperties_Tracing(ze_kernel_handle_t hKernel,
                               ze_kernel_properties_t *pKernelProperties) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnGetProperties,
-                               hKernel,
-                               pKernelProperties);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnGetProperties,
+                            hKernel,
+                            pKernelProperties);
 
     ze_kernel_get_properties_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -454,13 +454,13 @@ zeCommandListAppendLaunchKernel_Tracing(ze_command_list_handle_t hCommandList,
                                         uint32_t numWaitEvents,
                                         ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendLaunchKernel,
-                               hCommandList,
-                               hKernel,
-                               pLaunchFuncArgs,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendLaunchKernel,
+                            hCommandList,
+                            hKernel,
+                            pLaunchFuncArgs,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_launch_kernel_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -497,13 +497,13 @@ zeCommandListAppendLaunchKernelIndirect_Tracing(ze_command_list_handle_t hComman
                                                 uint32_t numWaitEvents,
                                                 ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendLaunchKernelIndirect,
-                               hCommandList,
-                               hKernel,
-                               pLaunchArgumentsBuffer,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendLaunchKernelIndirect,
+                            hCommandList,
+                            hKernel,
+                            pLaunchArgumentsBuffer,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_launch_kernel_indirect_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -542,15 +542,15 @@ zeCommandListAppendLaunchMultipleKernelsIndirect_Tracing(ze_command_list_handle_
                                                          uint32_t numWaitEvents,
                                                          ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect,
-                               hCommandList,
-                               numKernels,
-                               phKernels,
-                               pCountBuffer,
-                               pLaunchArgumentsBuffer,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendLaunchMultipleKernelsIndirect,
+                            hCommandList,
+                            numKernels,
+                            phKernels,
+                            pCountBuffer,
+                            pLaunchArgumentsBuffer,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_launch_multiple_kernels_indirect_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -591,13 +591,13 @@ zeCommandListAppendLaunchCooperativeKernel_Tracing(ze_command_list_handle_t hCom
                                                    uint32_t numWaitEvents,
                                                    ze_event_handle_t *phWaitEvents) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.CommandList.pfnAppendLaunchCooperativeKernel,
-                               hCommandList,
-                               hKernel,
-                               pLaunchFuncArgs,
-                               hSignalEvent,
-                               numWaitEvents,
-                               phWaitEvents);
+    ZE_HANDLE_TRACER_BYPASS(CommandList, pfnAppendLaunchCooperativeKernel,
+                            hCommandList,
+                            hKernel,
+                            pLaunchFuncArgs,
+                            hSignalEvent,
+                            numWaitEvents,
+                            phWaitEvents);
 
     ze_command_list_append_launch_cooperative_kernel_params_t tracerParams;
     tracerParams.phCommandList = &hCommandList;
@@ -630,10 +630,10 @@ zeModuleGetKernelNames_Tracing(ze_module_handle_t hModule,
                                uint32_t *pCount,
                                const char **pNames) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Module.pfnGetKernelNames,
-                               hModule,
-                               pCount,
-                               pNames);
+    ZE_HANDLE_TRACER_BYPASS(Module, pfnGetKernelNames,
+                            hModule,
+                            pCount,
+                            pNames);
 
     ze_module_get_kernel_names_params_t tracerParams;
     tracerParams.phModule = &hModule;
@@ -658,9 +658,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeKernelSuggestMaxCooperativeGroupCount_Tracing(ze_kernel_handle_t hKernel,
                                                 uint32_t *totalGroupCount) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnSuggestMaxCooperativeGroupCount,
-                               hKernel,
-                               totalGroupCount);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnSuggestMaxCooperativeGroupCount,
+                            hKernel,
+                            totalGroupCount);
 
     ze_kernel_suggest_max_cooperative_group_count_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -684,9 +684,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeKernelGetIndirectAccess_Tracing(ze_kernel_handle_t hKernel,
                                   ze_kernel_indirect_access_flags_t *pFlags) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnGetIndirectAccess,
-                               hKernel,
-                               pFlags);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnGetIndirectAccess,
+                            hKernel,
+                            pFlags);
 
     ze_kernel_get_indirect_access_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -711,10 +711,10 @@ zeKernelGetName_Tracing(ze_kernel_handle_t hKernel,
                         size_t *pSize,
                         char *pName) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnGetName,
-                               hKernel,
-                               pSize,
-                               pName);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnGetName,
+                            hKernel,
+                            pSize,
+                            pName);
 
     ze_kernel_get_name_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -741,10 +741,10 @@ zeKernelGetSourceAttributes_Tracing(ze_kernel_handle_t hKernel,
                                     uint32_t *pSize,
                                     char **pString) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnGetSourceAttributes,
-                               hKernel,
-                               pSize,
-                               pString);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnGetSourceAttributes,
+                            hKernel,
+                            pSize,
+                            pString);
 
     ze_kernel_get_source_attributes_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
@@ -770,9 +770,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeKernelSetIndirectAccess_Tracing(ze_kernel_handle_t hKernel,
                                   ze_kernel_indirect_access_flags_t flags) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Kernel.pfnSetIndirectAccess,
-                               hKernel,
-                               flags);
+    ZE_HANDLE_TRACER_BYPASS(Kernel, pfnSetIndirectAccess,
+                            hKernel,
+                            flags);
 
     ze_kernel_set_indirect_access_params_t tracerParams;
     tracerParams.phKernel = &hKernel;
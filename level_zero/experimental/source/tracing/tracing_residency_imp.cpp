@@ -12,10 +12,10 @@ zeContextCreate_Tracing(ze_driver_handle_t hDriver,
                         const ze_context_desc_t *desc,
                         ze_context_handle_t *phContext) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnCreate,
-                               hDriver,
-                               desc,
-                               phContext);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnCreate,
+                            hDriver,
+                            desc,
+                            phContext);
 
     ze_context_create_params_t tracerParams;
     tracerParams.phDriver = &hDriver;
@@ -39,8 +39,8 @@ zeContextCreate_Tracing(ze_driver_handle_t hDriver,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeContextDestroy_Tracing(ze_context_handle_t hContext) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnDestroy,
-                               hContext);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnDestroy,
+                            hContext);
 
     ze_context_destroy_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -60,8 +60,8 @@ zeContextDestroy_Tracing(ze_context_handle_t hContext) {
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeContextGetStatus_Tracing(ze_context_handle_t hContext) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnGetStatus,
-                               hContext);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnGetStatus,
+                            hContext);
 
     ze_context_get_status_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -82,9 +82,9 @@ ZE_APIEXPORT ze_result_t ZE_APICALL
 zeContextSystemBarrier_Tracing(ze_context_handle_t hContext,
                                ze_device_handle_t hDevice) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnSystemBarrier,
-                               hContext,
-                               hDevice);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnSystemBarrier,
+                            hContext,
+                            hDevice);
 
     ze_context_system_barrier_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -109,11 +109,11 @@ zeContextMakeMemoryResident_Tracing(ze_context_handle_t hContext,
                                     void *ptr,
                                     size_t size) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnMakeMemoryResident,
-                               hContext,
-                               hDevice,
-                               ptr,
-                               size);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnMakeMemoryResident,
+                            hContext,
+                            hDevice,
+                            ptr,
+                            size);
 
     ze_context_make_memory_resident_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -142,11 +142,11 @@ zeContextEvictMemory_Tracing(ze_context_handle_t hContext,
                              void *ptr,
                              size_t size) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnEvictMemory,
-                               hContext,
-                               hDevice,
-                               ptr,
-                               size);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnEvictMemory,
+                            hContext,
+                            hDevice,
+                            ptr,
+                            size);
 
     ze_context_evict_memory_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -174,10 +174,10 @@ zeContextMakeImageResident_Tracing(ze_context_handle_t hContext,
                                    ze_device_handle_t hDevice,
                                    ze_image_handle_t hImage) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnMakeImageResident,
-                               hContext,
-                               hDevice,
-                               hImage);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnMakeImageResident,
+                            hContext,
+                            hDevice,
+                            hImage);
 
     ze_context_make_image_resident_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -203,10 +203,10 @@ zeContextEvictImage_Tracing(ze_context_handle_t hContext,
                             ze_device_handle_t hDevice,
                             ze_image_handle_t hImage) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Context.pfnEvictImage,
-                               hContext,
-                               hDevice,
-                               hImage);
+    ZE_HANDLE_TRACER_BYPASS(Context, pfnEvictImage,
+                            hContext,
+                            hDevice,
+                            hImage);
 
     ze_context_evict_image_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -13,11 +13,11 @@ zeSamplerCreate_Tracing(ze_context_handle_t hContext,
                         const ze_sampler_desc_t *pDesc,
                         ze_sampler_handle_t *phSampler) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Sampler.pfnCreate,
-                               hContext,
-                               hDevice,
-                               pDesc,
-                               phSampler);
+    ZE_HANDLE_TRACER_BYPASS(Sampler, pfnCreate,
+                            hContext,
+                            hDevice,
+                            pDesc,
+                            phSampler);
 
     ze_sampler_create_params_t tracerParams;
     tracerParams.phContext = &hContext;
@@ -43,8 +43,8 @@ zeSamplerCreate_Tracing(ze_context_handle_t hContext,
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zeSamplerDestroy_Tracing(ze_sampler_handle_t hSampler) {
 
-    ZE_HANDLE_TRACER_RECURSION(driver_ddiTable.core_ddiTable.Sampler.pfnDestroy,
-                               hSampler);
+    ZE_HANDLE_TRACER_BYPASS(Sampler, pfnDestroy,
+                            hSampler);
 
     ze_sampler_destroy_params_t tracerParams;
     tracerParams.phSampler = &hSampler;
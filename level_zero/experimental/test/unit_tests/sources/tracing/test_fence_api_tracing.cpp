@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,26 @@ TEST_F(zeAPITracingRuntimeTests, WhenCallingFenceCreateTracingWrapperWithOneSetO
     EXPECT_EQ(defaultUserData, 1);
 }
 
+TEST_F(zeAPITracingRuntimeTests, GivenTracerWithCallbacksOnlyForFenceCreateWhenCallingFenceDestroyTracingWrapperThenImplementationIsCalledDirectly) {
+    ze_result_t result;
+    driver_ddiTable.core_ddiTable.Fence.pfnDestroy =
+        [](ze_fence_handle_t hFence) { return L0::tracingInProgress ? ZE_RESULT_ERROR_UNKNOWN : ZE_RESULT_SUCCESS; };
+
+    prologCbs.Fence.pfnCreateCb = genericPrologCallbackPtr;
+    epilogCbs.Fence.pfnCreateCb = genericEpilogCallbackPtr;
+
+    EXPECT_FALSE(L0::isApiTraced(ZE_TRACER_CALLBACK_INDEX(Fence, pfnCreateCb)));
+
+    setTracerCallbacksAndEnableTracer();
+
+    EXPECT_TRUE(L0::isApiTraced(ZE_TRACER_CALLBACK_INDEX(Fence, pfnCreateCb)));
+    EXPECT_FALSE(L0::isApiTraced(ZE_TRACER_CALLBACK_INDEX(Fence, pfnDestroyCb)));
+
+    result = zeFenceDestroy_Tracing(nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(defaultUserData, 0);
+}
+
 TEST_F(zeAPITracingRuntimeTests, WhenCallingFenceDestroyTracingWrapperWithOneSetOfPrologEpilogsThenReturnSuccess) {
     ze_result_t result;
     driver_ddiTable.core_ddiTable.Fence.pfnDestroy =
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/event/event.h"
 #include <level_zero/zet_api.h>
 
@@ -106,6 +107,10 @@ struct MetricStreamer : _zet_metric_streamer_handle_t {
                                  uint8_t *pRawData) = 0;
     virtual ze_result_t close() = 0;
 
+    virtual ze_result_t getReportRing(zet_metric_streamer_report_ring_exp_t *pRing) = 0;
+    virtual ze_result_t acquireReports(uint64_t *pHead, uint64_t *pTail, uint64_t *pOverflowReportCount) = 0;
+    virtual ze_result_t releaseReports(uint64_t head) = 0;
+
     static ze_result_t open(zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup,
                             zet_metric_streamer_desc_t &desc, ze_event_handle_t hNotificationEvent, zet_metric_streamer_handle_t *phMetricStreamer);
     static MetricStreamer *fromHandle(zet_metric_streamer_handle_t handle) {
@@ -122,6 +127,8 @@ struct MetricQueryPool : _zet_metric_query_pool_handle_t {
     virtual ze_result_t destroy() = 0;
     virtual ze_result_t createMetricQuery(uint32_t index,
                                           zet_metric_query_handle_t *phMetricQuery) = 0;
+    virtual ze_result_t getData(uint32_t count, zet_metric_query_handle_t *phMetricQueries,
+                                size_t *pRawDataSize, uint8_t *pRawData) = 0;
 
     static MetricQueryPool *create(zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, const zet_metric_query_pool_desc_t &desc);
     static MetricQueryPool *fromHandle(zet_metric_query_pool_handle_t handle);
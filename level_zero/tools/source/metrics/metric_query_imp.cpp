@@ -128,14 +128,14 @@ bool MetricsLibrary::getMetricQueryReportSize(size_t &rawDataSize) {
     return result;
 }
 
-bool MetricsLibrary::getMetricQueryReport(QueryHandle_1_0 &query, const uint32_t slot,
+bool MetricsLibrary::getMetricQueryReport(QueryHandle_1_0 &query, const uint32_t slot, const uint32_t slotsCount,
                                           const size_t rawDataSize, uint8_t *pData) {
 
     GetReportData_1_0 report = {};
     report.Type = ObjectType::QueryHwCounters;
     report.Query.Handle = query;
     report.Query.Slot = slot;
-    report.Query.SlotsCount = 1;
+    report.Query.SlotsCount = slotsCount;
     report.Query.Data = pData;
     report.Query.DataSize = static_cast<uint32_t>(rawDataSize);
 
@@ -525,6 +525,65 @@ ze_result_t MetricQueryPoolImp::createMetricQuery(uint32_t index,
                : ZE_RESULT_ERROR_INVALID_ARGUMENT;
 }
 
+bool MetricQueryPoolImp::getSlot(zet_metric_query_handle_t hMetricQuery, uint32_t &slot) {
+    const auto queryAddress = reinterpret_cast<uintptr_t>(static_cast<MetricQueryImp *>(MetricQuery::fromHandle(hMetricQuery)));
+    const auto poolAddress = reinterpret_cast<uintptr_t>(pool.data());
+
+    if (queryAddress < poolAddress || queryAddress >= poolAddress + pool.size() * sizeof(MetricQueryImp)) {
+        return false;
+    }
+    slot = static_cast<uint32_t>((queryAddress - poolAddress) / sizeof(MetricQueryImp));
+    return true;
+}
+
+ze_result_t MetricQueryPoolImp::getData(uint32_t count, zet_metric_query_handle_t *phMetricQueries,
+                                        size_t *pRawDataSize, uint8_t *pRawData) {
+    if (count == 0 || phMetricQueries == nullptr || pRawDataSize == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (description.type != ZET_METRIC_QUERY_POOL_TYPE_PERFORMANCE) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    // Report size does not change during pool lifetime.
+    if (reportSize == 0 && !metricsLibrary.getMetricQueryReportSize(reportSize)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    // Return required size if requested, reports are laid out in order of query handles.
+    const size_t requiredSize = reportSize * count;
+    if (*pRawDataSize == 0) {
+        *pRawDataSize = requiredSize;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (pRawData == nullptr || *pRawDataSize < requiredSize) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Queries from consecutive slots are resolved with single metrics library call.
+    for (uint32_t i = 0; i < count;) {
+        uint32_t slot = 0;
+        if (!getSlot(phMetricQueries[i], slot)) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
+        uint32_t slotsCount = 1;
+        while (i + slotsCount < count && slot + slotsCount < pool.size() &&
+               phMetricQueries[i + slotsCount] == &pool[slot + slotsCount]) {
+            slotsCount++;
+        }
+
+        if (!metricsLibrary.getMetricQueryReport(query, slot, slotsCount, reportSize * slotsCount, pRawData + reportSize * i)) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+        i += slotsCount;
+    }
+
+    *pRawDataSize = requiredSize;
+    return ZE_RESULT_SUCCESS;
+}
+
 MetricQueryImp::MetricQueryImp(MetricContext &metricContextInput, MetricQueryPoolImp &poolInput,
                                const uint32_t slotInput)
     : metricContext(metricContextInput), metricsLibrary(metricContext.getMetricsLibrary()),
@@ -560,7 +619,7 @@ ze_result_t MetricQueryImp::getData(size_t *pRawDataSize, uint8_t *pRawData) {
     const bool calculateSizeOnly = *pRawDataSize == 0;
     const bool result = calculateSizeOnly
                             ? metricsLibrary.getMetricQueryReportSize(*pRawDataSize)
-                            : metricsLibrary.getMetricQueryReport(pool.query, slot, *pRawDataSize, pRawData);
+                            : metricsLibrary.getMetricQueryReport(pool.query, slot, 1, *pRawDataSize, pRawData);
 
     return result
                ? ZE_RESULT_SUCCESS
@@ -58,7 +58,7 @@ struct MetricsLibrary {
     bool createMetricQuery(const uint32_t slotsCount, QueryHandle_1_0 &query,
                            NEO::GraphicsAllocation *&pAllocation);
     uint32_t getMetricQueryCount();
-    bool getMetricQueryReport(QueryHandle_1_0 &query, const uint32_t slot, const size_t rawDataSize, uint8_t *pData);
+    bool getMetricQueryReport(QueryHandle_1_0 &query, const uint32_t slot, const uint32_t slotsCount, const size_t rawDataSize, uint8_t *pData);
     virtual bool getMetricQueryReportSize(size_t &rawDataSize);
     bool destroyMetricQuery(QueryHandle_1_0 &query);
 
@@ -138,9 +138,12 @@ struct MetricQueryPoolImp : MetricQueryPool {
     ze_result_t destroy() override;
 
     ze_result_t createMetricQuery(uint32_t index, zet_metric_query_handle_t *phMetricQuery) override;
+    ze_result_t getData(uint32_t count, zet_metric_query_handle_t *phMetricQueries,
+                        size_t *pRawDataSize, uint8_t *pRawData) override;
 
   protected:
     bool createMetricQueryPool();
+    bool getSlot(zet_metric_query_handle_t hMetricQuery, uint32_t &slot);
     bool createSkipExecutionQueryPool();
 
   public:
@@ -151,5 +154,6 @@ struct MetricQueryPoolImp : MetricQueryPool {
     zet_metric_query_pool_desc_t description = {};
     zet_metric_group_handle_t hMetricGroup = nullptr;
     QueryHandle_1_0 query = {};
+    size_t reportSize = 0;
 };
 } // namespace L0
@@ -12,6 +12,8 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/tools/source/metrics/metric_query_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 ze_result_t MetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize,
@@ -31,6 +33,11 @@ ze_result_t MetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDat
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    // Reports are consumed through report ring.
+    if (!reportRing.empty()) {
+        return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    }
+
     // Retrieve the number of reports that fit into the buffer.
     uint32_t reportCount = static_cast<uint32_t>(*pRawDataSize / rawReportSize);
 
@@ -71,6 +78,92 @@ ze_result_t MetricStreamerImp::close() {
     return result;
 }
 
+ze_result_t MetricStreamerImp::getReportRing(zet_metric_streamer_report_ring_exp_t *pRing) {
+    if (pRing == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    DEBUG_BREAK_IF(rawReportSize == 0);
+
+    if (reportRing.empty()) {
+        const size_t ringReportCount = oaBufferSize / rawReportSize;
+        if (ringReportCount == 0) {
+            return ZE_RESULT_ERROR_NOT_AVAILABLE;
+        }
+        reportRing.resize(ringReportCount * rawReportSize);
+    }
+
+    pRing->pData = reportRing.data();
+    pRing->ringSize = reportRing.size();
+    pRing->reportSize = rawReportSize;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t MetricStreamerImp::readReportsToRing(uint64_t ringOffset, uint32_t maxReportCount, uint32_t &readReportCount) {
+    auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+
+    readReportCount = maxReportCount;
+    const ze_result_t result = metricGroup->readIoStream(readReportCount, reportRing[static_cast<size_t>(ringOffset % reportRing.size())]);
+    if (result != ZE_RESULT_SUCCESS) {
+        readReportCount = 0;
+    }
+    return result;
+}
+
+ze_result_t MetricStreamerImp::acquireReports(uint64_t *pHead, uint64_t *pTail, uint64_t *pOverflowReportCount) {
+    if (pHead == nullptr || pTail == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (reportRing.empty()) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    const uint64_t ringSize = reportRing.size();
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    // Free space may wrap around ring end, so it is filled with up to two reads.
+    for (uint32_t part = 0; part < 2 && result == ZE_RESULT_SUCCESS; part++) {
+        const uint64_t freeSpace = ringSize - (ringTail - ringHead);
+        const uint64_t contiguousSpace = std::min(freeSpace, ringSize - ringTail % ringSize);
+        const uint32_t maxReportCount = static_cast<uint32_t>(contiguousSpace / rawReportSize);
+        if (maxReportCount == 0) {
+            break;
+        }
+
+        uint32_t readReportCount = 0;
+        result = readReportsToRing(ringTail, maxReportCount, readReportCount);
+        ringTail += static_cast<uint64_t>(readReportCount) * rawReportSize;
+        if (readReportCount < maxReportCount) {
+            break;
+        }
+    }
+
+    // Ring is full, hardware buffer is drained anyway so it does not overflow, dropped reports are counted.
+    if (result == ZE_RESULT_SUCCESS && ringTail - ringHead == ringSize) {
+        auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+        overflowReports.resize(oaBufferSize);
+        uint32_t droppedReportCount = oaBufferSize / rawReportSize;
+        result = metricGroup->readIoStream(droppedReportCount, *overflowReports.data());
+        if (result == ZE_RESULT_SUCCESS) {
+            overflowReportCount += droppedReportCount;
+        }
+    }
+
+    *pHead = ringHead;
+    *pTail = ringTail;
+    if (pOverflowReportCount != nullptr) {
+        *pOverflowReportCount = overflowReportCount;
+    }
+    return result;
+}
+
+ze_result_t MetricStreamerImp::releaseReports(uint64_t head) {
+    if (head < ringHead || head > ringTail || (head % rawReportSize) != 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    ringHead = head;
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t MetricStreamerImp::initialize(ze_device_handle_t hDevice,
                                           zet_metric_group_handle_t hMetricGroup) {
     this->hDevice = hDevice;
@@ -9,6 +9,8 @@
 
 #include "level_zero/tools/source/metrics/metric.h"
 
+#include <vector>
+
 struct Event;
 
 namespace L0 {
@@ -19,6 +21,10 @@ struct MetricStreamerImp : MetricStreamer {
     ze_result_t readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) override;
     ze_result_t close() override;
 
+    ze_result_t getReportRing(zet_metric_streamer_report_ring_exp_t *pRing) override;
+    ze_result_t acquireReports(uint64_t *pHead, uint64_t *pTail, uint64_t *pOverflowReportCount) override;
+    ze_result_t releaseReports(uint64_t head) override;
+
     ze_result_t initialize(ze_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup);
     ze_result_t startMeasurements(uint32_t &notifyEveryNReports, uint32_t &samplingPeriodNs, ze_event_handle_t hNotificationEvent);
     Event::State getNotificationState() override;
@@ -28,12 +34,20 @@ struct MetricStreamerImp : MetricStreamer {
     uint32_t getOaBufferSize(const uint32_t notifyEveryNReports) const;
     uint32_t getNotifyEveryNReports(const uint32_t oaBufferSize) const;
     uint32_t getRequiredBufferSize(const uint32_t maxReportCount) const;
+    ze_result_t readReportsToRing(uint64_t ringOffset, uint32_t maxReportCount, uint32_t &readReportCount);
 
     ze_device_handle_t hDevice = nullptr;
     zet_metric_group_handle_t hMetricGroup = nullptr;
     Event *pNotificationEvent = nullptr;
     uint32_t rawReportSize = 0;
     uint32_t oaBufferSize = 0;
+
+    // reports are read from hardware directly into ring, user consumes them in place
+    std::vector<uint8_t> reportRing;
+    std::vector<uint8_t> overflowReports;
+    uint64_t ringHead = 0;
+    uint64_t ringTail = 0;
+    uint64_t overflowReportCount = 0;
 };
 
 } // namespace L0
\ No newline at end of file
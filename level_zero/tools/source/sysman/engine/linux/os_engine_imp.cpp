@@ -45,16 +45,18 @@ ze_result_t OsEngine::getNumEngineTypeAndInstances(std::multimap<zes_engine_grou
 }
 
 ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
-    if (fd < 0) {
+    if (pmuEventIndex < 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    uint64_t data[2] = {};
-    if (pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data)) < 0) {
+    // All engines of device are in one PMU group, so single read returns consistent busyness of every engine
+    std::vector<uint64_t> eventValues;
+    uint64_t timestamp = 0;
+    if (pPmuInterface->pmuGroupRead(eventValues, timestamp) < 0 || eventValues.size() <= static_cast<size_t>(pmuEventIndex)) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    // In data[], First u64 is "active time", And second u64 is "timestamp". Both in nanoseconds
-    pStats->activeTime = data[0] / microSecondsToNanoSeconds;
-    pStats->timestamp = data[1] / microSecondsToNanoSeconds;
+    // Event value is "active time" and group timestamp is "time enabled" of group leader. Both in nanoseconds
+    pStats->activeTime = eventValues[pmuEventIndex] / microSecondsToNanoSeconds;
+    pStats->timestamp = timestamp / microSecondsToNanoSeconds;
     return ZE_RESULT_SUCCESS;
 }
 
@@ -68,7 +70,7 @@ ze_result_t LinuxEngineImp::getProperties(zes_engine_properties_t &properties) {
 void LinuxEngineImp::init() {
     auto i915EngineClass = engineToI915Map.find(engineGroup);
     // I915_PMU_ENGINE_BUSY macro provides the perf type config which we want to listen to get the engine busyness.
-    fd = pPmuInterface->pmuInterfaceOpen(I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    pmuEventIndex = pPmuInterface->pmuGroupAddEvent(I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance));
 }
 
 LinuxEngineImp::LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance) : engineGroup(type), engineInstance(engineInstance) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,12 +21,7 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     ze_result_t getProperties(zes_engine_properties_t &properties) override;
     LinuxEngineImp() = default;
     LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance);
-    ~LinuxEngineImp() override {
-        if (fd != -1) {
-            close(static_cast<int>(fd));
-            fd = -1;
-        }
-    }
+    ~LinuxEngineImp() override = default;
 
   protected:
     zes_engine_group_t engineGroup = ZES_ENGINE_GROUP_ALL;
@@ -37,7 +32,7 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
 
   private:
     void init();
-    int64_t fd = -1;
+    int64_t pmuEventIndex = -1;
 };
 
 } // namespace L0
@@ -10,11 +10,22 @@
 #include "sysman/events/events_imp.h"
 #include "sysman/linux/os_sysman_imp.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <linux/netlink.h>
+#include <thread>
+
 namespace L0 {
 
 const std::string LinuxEventsImp::varFs("/var/lib/libze_intel_gpu/");
 const std::string LinuxEventsImp::detachEvent("remove");
 const std::string LinuxEventsImp::attachEvent("add");
+// uevents are re-broadcast by udev to this netlink group after rules (e.g. 99-drm_ze_intel_gpu.rules) were run
+static constexpr uint32_t udevMonitorGroup = 2u;
+static constexpr size_t ueventBufferSize = 8192u;
+static constexpr uint64_t eventPollingInterval = 10u; // in milliseconds, used when uevent socket is not available
 
 bool LinuxEventsImp::isResetRequired(zes_event_type_flags_t &pEvent) {
     zes_device_state_t pState = {};
@@ -70,7 +81,7 @@ bool LinuxEventsImp::checkIfMemHealthChanged(zes_event_type_flags_t &pEvent) {
     return false;
 }
 
-bool LinuxEventsImp::eventListen(zes_event_type_flags_t &pEvent, uint64_t timeout) {
+bool LinuxEventsImp::checkRegisteredEvents(zes_event_type_flags_t &pEvent) {
     if (registeredEvents & ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED) {
         if (isResetRequired(pEvent)) {
             registeredEvents &= ~(ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED); //After receiving event unregister it
@@ -98,6 +109,73 @@ bool LinuxEventsImp::eventListen(zes_event_type_flags_t &pEvent, uint64_t timeou
     return false;
 }
 
+bool LinuxEventsImp::isDrmUevent(const char *buf, size_t size) {
+    // Both kernel and udev messages carry NUL separated KEY=VALUE properties
+    const char drmSubsystem[] = "SUBSYSTEM=drm";
+    size_t offset = 0;
+    while (offset < size) {
+        const char *property = buf + offset;
+        size_t length = strnlen(property, size - offset);
+        if (length == sizeof(drmSubsystem) - 1 && memcmp(property, drmSubsystem, length) == 0) {
+            return true;
+        }
+        offset += length + 1;
+    }
+    return false;
+}
+
+bool LinuxEventsImp::waitForDrmUevent(uint64_t timeout) {
+    if (ueventFd < 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(std::min(timeout, eventPollingInterval)));
+        return true;
+    }
+
+    struct pollfd pollFd = {};
+    pollFd.fd = ueventFd;
+    pollFd.events = POLLIN;
+    int pollTimeout = static_cast<int>(std::min(timeout, static_cast<uint64_t>(std::numeric_limits<int>::max())));
+    if (pollFunction(&pollFd, 1, pollTimeout) <= 0) {
+        return false;
+    }
+
+    // drain all pending messages, wait is finished when any of them is for drm subsystem
+    bool drmUeventReceived = false;
+    char buf[ueventBufferSize];
+    ssize_t length = 0;
+    while ((length = recvFunction(ueventFd, buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+        drmUeventReceived |= isDrmUevent(buf, static_cast<size_t>(length));
+    }
+    return drmUeventReceived;
+}
+
+bool LinuxEventsImp::eventListen(zes_event_type_flags_t &pEvent, uint64_t timeout) {
+    if (checkRegisteredEvents(pEvent)) {
+        return true;
+    }
+    if (registeredEvents == 0 || timeout == 0) {
+        return false;
+    }
+    if (!waitForDrmUevent(timeout)) {
+        return false;
+    }
+    return checkRegisteredEvents(pEvent);
+}
+
+void LinuxEventsImp::openUeventSocket() {
+    int fd = ::socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_KOBJECT_UEVENT);
+    if (fd < 0) {
+        return;
+    }
+    struct sockaddr_nl address = {};
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = udevMonitorGroup;
+    if (::bind(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) < 0) {
+        ::close(fd);
+        return;
+    }
+    ueventFd = fd;
+}
+
 ze_result_t LinuxEventsImp::eventRegister(zes_event_type_flags_t events) {
     if (0x7fff < events) {
         return ZE_RESULT_ERROR_INVALID_ENUMERATION;
@@ -134,6 +212,13 @@ LinuxEventsImp::LinuxEventsImp(OsSysman *pOsSysman) {
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
     pFsAccess = &pLinuxSysmanImp->getFsAccess();
     getPciIdPathTag();
+    openUeventSocket();
+}
+
+LinuxEventsImp::~LinuxEventsImp() {
+    if (ueventFd >= 0) {
+        ::close(ueventFd);
+    }
 }
 
 OsEvents *OsEvents::create(OsSysman *pOsSysman) {
@@ -9,6 +9,9 @@
 #include "level_zero/tools/source/sysman/events/os_events.h"
 #include "level_zero/tools/source/sysman/linux/os_sysman_imp.h"
 
+#include <poll.h>
+#include <sys/socket.h>
+
 namespace L0 {
 
 class LinuxEventsImp : public OsEvents, NEO::NonCopyableOrMovableClass {
@@ -17,7 +20,7 @@ class LinuxEventsImp : public OsEvents, NEO::NonCopyableOrMovableClass {
     ze_result_t eventRegister(zes_event_type_flags_t events) override;
     LinuxEventsImp() = default;
     LinuxEventsImp(OsSysman *pOsSysman);
-    ~LinuxEventsImp() override = default;
+    ~LinuxEventsImp() override;
 
   protected:
     LinuxSysmanImp *pLinuxSysmanImp = nullptr;
@@ -27,6 +30,15 @@ class LinuxEventsImp : public OsEvents, NEO::NonCopyableOrMovableClass {
     bool checkDeviceDetachEvent(zes_event_type_flags_t &pEvent);
     bool checkDeviceAttachEvent(zes_event_type_flags_t &pEvent);
     bool checkIfMemHealthChanged(zes_event_type_flags_t &pEvent);
+    bool checkRegisteredEvents(zes_event_type_flags_t &pEvent);
+    void openUeventSocket();
+    bool waitForDrmUevent(uint64_t timeout);
+    static bool isDrmUevent(const char *buf, size_t size);
+    // Registered events change only together with uevent of drm device, so listening blocks on
+    // udev netlink socket instead of reading sysfs in a loop
+    int ueventFd = -1;
+    decltype(&::poll) pollFunction = ::poll;
+    decltype(&::recv) recvFunction = ::recv;
     std::string pciIdPathTag;
     zes_mem_health_t memHealthAtEventRegister = ZES_MEM_HEALTH_UNKNOWN;
 
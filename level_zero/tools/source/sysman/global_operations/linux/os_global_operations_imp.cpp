@@ -14,6 +14,7 @@
 #include <level_zero/zet_api.h>
 
 #include <chrono>
+#include <set>
 #include <time.h>
 
 namespace L0 {
@@ -249,6 +250,43 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
 // accumulated nanoseconds each client spent on engines.
 // Thus we traverse each file in busy dir for non-zero time and if we find that file say 0,then we could say that
 // this engine 0 is used by process.
+ze_result_t LinuxGlobalOperationsImp::readClientState(const std::string &clientId, ClientState &clientState) {
+    // realClientPidPath will be something like: clients/<clientId>/pid
+    std::string realClientPidPath = clientsDir + "/" + clientId + "/" + "pid";
+    uint64_t pid;
+    ze_result_t result = pSysfsAccess->read(realClientPidPath, pid);
+
+    if (ZE_RESULT_SUCCESS != result) {
+        std::string bPidString;
+        result = pSysfsAccess->read(realClientPidPath, bPidString);
+        if (result == ZE_RESULT_SUCCESS) {
+            size_t start = bPidString.find("<");
+            size_t end = bPidString.find(">");
+            std::string bPid = bPidString.substr(start + 1, end - start - 1);
+            pid = std::stoull(bPid, nullptr, 10);
+        }
+    }
+
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    clientState.pid = pid;
+
+    // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
+    std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
+    result = pSysfsAccess->scanDirEntries(busyDirForEngines, clientState.unusedEngines);
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+            //Here its seen when the last element of clientIds returns ZE_RESULT_ERROR_NOT_AVAILABLE for some reason.
+            clientState.unusedEngines.clear();
+            clientState.engineType = ZES_ENGINE_TYPE_FLAG_OTHER; // When busy node is absent assign engine type with ZES_ENGINE_TYPE_FLAG_OTHER
+        } else {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process_state_t> &pProcessList) {
     std::vector<std::string> clientIds;
     struct deviceMemStruct {
@@ -265,67 +303,47 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    std::lock_guard<std::mutex> lock(clientsMutex);
     // Create a map with unique pid as key and engineType as value
     std::map<uint64_t, engineMemoryPairType> pidClientMap;
     for (const auto &clientId : clientIds) {
-        // realClientPidPath will be something like: clients/<clientId>/pid
-        std::string realClientPidPath = clientsDir + "/" + clientId + "/" + "pid";
-        uint64_t pid;
-        result = pSysfsAccess->read(realClientPidPath, pid);
-
-        if (ZE_RESULT_SUCCESS != result) {
-            std::string bPidString;
-            result = pSysfsAccess->read(realClientPidPath, bPidString);
-            if (result == ZE_RESULT_SUCCESS) {
-                size_t start = bPidString.find("<");
-                size_t end = bPidString.find(">");
-                std::string bPid = bPidString.substr(start + 1, end - start - 1);
-                pid = std::stoull(bPid, nullptr, 10);
+        // pid and list of engines of client never change, so they are read only for new clients
+        auto cachedClient = cachedClients.find(clientId);
+        if (cachedClient == cachedClients.end()) {
+            ClientState clientState;
+            result = readClientState(clientId, clientState);
+            if (ZE_RESULT_SUCCESS != result) {
+                if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+                    //update the result as Success as ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
+                    //this condition(when encountered) must not prevent the information accumulated for other clientIds
+                    //this situation occurs when there is no call modifying result,
+                    result = ZE_RESULT_SUCCESS;
+                    continue;
+                } else {
+                    return result;
+                }
             }
+            cachedClient = cachedClients.emplace(clientId, std::move(clientState)).first;
         }
+        auto &clientState = cachedClient->second;
+        uint64_t pid = clientState.pid;
 
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                //update the result as Success as ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
-                //this condition(when encountered) must not prevent the information accumulated for other clientIds
-                //this situation occurs when there is no call modifying result,
-                result = ZE_RESULT_SUCCESS;
-                continue;
-            } else {
-                return result;
-            }
-        }
-        // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
-        std::vector<std::string> engineNums = {};
-        int64_t engineType = 0;
+        // Busy time of engine only grows, so engine used once by client is not read again
         std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
-        result = pSysfsAccess->scanDirEntries(busyDirForEngines, engineNums);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                //update the result as Success as ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
-                //this condition(when encountered) must not prevent the information accumulated for other clientIds
-                //this situation occurs when there is no call modifying result,
-                //Here its seen when the last element of clientIds returns ZE_RESULT_ERROR_NOT_AVAILABLE for some reason.
-                engineType = ZES_ENGINE_TYPE_FLAG_OTHER; // When busy node is absent assign engine type with ZES_ENGINE_TYPE_FLAG_OTHER
-            } else {
-                return result;
-            }
-        }
-        // Scan all engine files present in /sys/class/drm/card0/clients/<ClientId>/busy and check
-        // whether that engine is used by process
-        for (const auto &engineNum : engineNums) {
+        for (auto engineNum = clientState.unusedEngines.begin(); engineNum != clientState.unusedEngines.end();) {
             uint64_t timeSpent = 0;
-            std::string engine = busyDirForEngines + "/" + engineNum;
+            std::string engine = busyDirForEngines + "/" + *engineNum;
             result = pSysfsAccess->read(engine, timeSpent);
             if (ZE_RESULT_SUCCESS != result) {
                 if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+                    engineNum++;
                     continue;
                 } else {
                     return result;
                 }
             }
             if (timeSpent > 0) {
-                int i915EnginNumber = stoi(engineNum);
+                int i915EnginNumber = stoi(*engineNum);
                 auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
                 zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
                 if (i915MapToL0EngineType != engineMap.end()) {
@@ -333,9 +351,13 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
                     val = i915MapToL0EngineType->second;
                 }
                 // In this for loop we want to retrieve the overall engines used by process
-                engineType = engineType | val;
+                clientState.engineType = clientState.engineType | val;
+                engineNum = clientState.unusedEngines.erase(engineNum);
+            } else {
+                engineNum++;
             }
         }
+        int64_t engineType = clientState.engineType;
 
         uint64_t memSize = 0;
         std::string realClientTotalMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "created_bytes";
@@ -373,6 +395,16 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
         result = ZE_RESULT_SUCCESS;
     }
 
+    // clients which are gone are removed from cache
+    std::set<std::string> clientIdsSet(clientIds.begin(), clientIds.end());
+    for (auto cachedClient = cachedClients.begin(); cachedClient != cachedClients.end();) {
+        if (clientIdsSet.find(cachedClient->first) == clientIdsSet.end()) {
+            cachedClient = cachedClients.erase(cachedClient);
+        } else {
+            cachedClient++;
+        }
+    }
+
     // iterate through all elements of pidClientMap
     for (auto itr = pidClientMap.begin(); itr != pidClientMap.end(); ++itr) {
         zes_process_state_t process;
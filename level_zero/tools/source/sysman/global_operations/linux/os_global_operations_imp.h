@@ -9,6 +9,9 @@
 #include "level_zero/tools/source/sysman/global_operations/os_global_operations.h"
 #include "level_zero/tools/source/sysman/linux/os_sysman_imp.h"
 
+#include <map>
+#include <mutex>
+
 namespace L0 {
 class SysfsAccess;
 struct Device;
@@ -41,6 +44,17 @@ class LinuxGlobalOperationsImp : public OsGlobalOperations, NEO::NonCopyableOrMo
 
     int resetTimeout = 10000; // in milliseconds
 
+    struct ClientState {
+        uint64_t pid = 0;
+        std::vector<std::string> unusedEngines;
+        int64_t engineType = 0;
+    };
+    ze_result_t readClientState(const std::string &clientId, ClientState &clientState);
+
+    // client entries in sysfs are kept between calls, only engines not used yet and memory are read again
+    std::map<std::string, ClientState> cachedClients;
+    std::mutex clientsMutex;
+
   private:
     static const std::string deviceDir;
     static const std::string subsystemVendorFile;
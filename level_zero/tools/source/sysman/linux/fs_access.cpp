@@ -10,15 +10,21 @@
 #include <climits>
 
 #include <array>
+#include <cctype>
 #include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
+#include <limits>
 #include <unistd.h>
 
 namespace L0 {
 
+static constexpr size_t attributeNumberSize = 64;
+static constexpr size_t attributeStringSize = 4096;
+
 static ze_result_t getResult(int err) {
     if ((EPERM == err) || (EACCES == err)) {
         return ZE_RESULT_ERROR_INSUFFICIENT_PERMISSIONS;
@@ -29,100 +35,179 @@ static ze_result_t getResult(int err) {
     }
 }
 
+static bool parseUnsigned(const char *&str, uint64_t maxVal, uint64_t &val) {
+    while (isspace(static_cast<unsigned char>(*str))) {
+        str++;
+    }
+    if (*str == '+') {
+        str++;
+    }
+    if (!isdigit(static_cast<unsigned char>(*str))) {
+        return false;
+    }
+    uint64_t result = 0;
+    while (isdigit(static_cast<unsigned char>(*str))) {
+        uint64_t digit = static_cast<uint64_t>(*str - '0');
+        if (result > (maxVal - digit) / 10) {
+            return false;
+        }
+        result = result * 10 + digit;
+        str++;
+    }
+    val = result;
+    return true;
+}
+
+static bool parseSigned(const char *str, int32_t minVal, int32_t maxVal, int64_t &val) {
+    while (isspace(static_cast<unsigned char>(*str))) {
+        str++;
+    }
+    bool negative = (*str == '-');
+    if (negative) {
+        str++;
+    }
+    uint64_t magnitude = 0;
+    uint64_t maxMagnitude = negative ? static_cast<uint64_t>(-static_cast<int64_t>(minVal)) : static_cast<uint64_t>(maxVal);
+    if (!parseUnsigned(str, maxMagnitude, magnitude)) {
+        return false;
+    }
+    val = negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+    return true;
+}
+
 // Generic Filesystem Access
 FsAccess::FsAccess() {
 }
 
+FsAccess::~FsAccess() {
+    for (auto &cachedFd : cachedFds) {
+        ::close(cachedFd.second);
+    }
+}
+
 FsAccess *FsAccess::create() {
     return new FsAccess();
 }
 
-ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+ze_result_t FsAccess::readAttribute(const std::string &file, char *buf, size_t bufSize, size_t &bytesRead) {
+    std::lock_guard<std::mutex> lock(cachedFdsMutex);
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    auto cachedFd = cachedFds.find(file);
+    bool reopened = false;
+    if (cachedFd == cachedFds.end()) {
+        int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+        cachedFd = cachedFds.emplace(file, fd).first;
+        reopened = true;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+
+    ssize_t len = ::pread(cachedFd->second, buf, bufSize - 1, 0);
+    if (len < 0 && !reopened) {
+        // attribute could be removed and created again, stale descriptor is replaced once
+        ::close(cachedFd->second);
+        cachedFds.erase(cachedFd);
+        int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+        cachedFd = cachedFds.emplace(file, fd).first;
+        len = ::pread(cachedFd->second, buf, bufSize - 1, 0);
     }
-    fs.close();
+    if (len < 0) {
+        int err = errno;
+        ::close(cachedFd->second);
+        cachedFds.erase(cachedFd);
+        return getResult(err);
+    }
+    buf[len] = '\0';
+    bytesRead = static_cast<size_t>(len);
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t FsAccess::read(const std::string file, double &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
+    char buf[attributeNumberSize];
+    size_t bytesRead = 0;
+    ze_result_t result = readAttribute(file, buf, sizeof(buf), bytesRead);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    const char *str = buf;
+    if (!parseUnsigned(str, std::numeric_limits<uint64_t>::max(), val)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    return ZE_RESULT_SUCCESS;
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+ze_result_t FsAccess::read(const std::string file, double &val) {
+    char buf[attributeNumberSize];
+    size_t bytesRead = 0;
+    ze_result_t result = readAttribute(file, buf, sizeof(buf), bytesRead);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    char *end = nullptr;
+    double parsed = std::strtod(buf, &end);
+    if (end == buf) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
+    val = parsed;
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t FsAccess::read(const std::string file, int32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    char buf[attributeNumberSize];
+    size_t bytesRead = 0;
+    ze_result_t result = readAttribute(file, buf, sizeof(buf), bytesRead);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    int64_t parsed = 0;
+    if (!parseSigned(buf, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), parsed)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
+    val = static_cast<int32_t>(parsed);
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    char buf[attributeNumberSize];
+    size_t bytesRead = 0;
+    ze_result_t result = readAttribute(file, buf, sizeof(buf), bytesRead);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    const char *str = buf;
+    uint64_t parsed = 0;
+    if (!parseUnsigned(str, std::numeric_limits<uint32_t>::max(), parsed)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
+    val = static_cast<uint32_t>(parsed);
     return ZE_RESULT_SUCCESS;
 }
+
 ze_result_t FsAccess::read(const std::string file, std::string &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+    // Read first word of text file, without trailing newline
+    char buf[attributeStringSize];
+    size_t bytesRead = 0;
     val.clear();
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    ze_result_t result = readAttribute(file, buf, sizeof(buf), bytesRead);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    const char *begin = buf;
+    while (isspace(static_cast<unsigned char>(*begin))) {
+        begin++;
     }
-    fs.close();
-    // Strip trailing newline
-    if (val.back() == '\n') {
-        val.pop_back();
+    const char *end = begin;
+    while (*end != '\0' && !isspace(static_cast<unsigned char>(*end))) {
+        end++;
     }
+    if (begin == end) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    val.assign(begin, end);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -415,75 +500,23 @@ ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
 }
 
 ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, double &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &val) {
@@ -13,12 +13,14 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 namespace L0 {
@@ -26,7 +28,7 @@ namespace L0 {
 class FsAccess {
   public:
     static FsAccess *create();
-    virtual ~FsAccess() = default;
+    virtual ~FsAccess();
 
     virtual ze_result_t canRead(const std::string file);
     virtual ze_result_t canWrite(const std::string file);
@@ -51,6 +53,13 @@ class FsAccess {
 
   protected:
     FsAccess();
+
+    // Attribute files stay open after first read and are re-read with pread at offset 0,
+    // descriptor is reopened once when read fails (e.g. attribute was recreated)
+    ze_result_t readAttribute(const std::string &file, char *buf, size_t bufSize, size_t &bytesRead);
+
+    std::mutex cachedFdsMutex;
+    std::unordered_map<std::string, int> cachedFds;
 };
 
 class ProcfsAccess : private FsAccess {
@@ -7,6 +7,7 @@
 
 #pragma once
 #include <cstdint>
+#include <vector>
 
 namespace L0 {
 class LinuxSysmanImp;
@@ -15,6 +16,8 @@ class PmuInterface {
     virtual ~PmuInterface() = default;
     virtual int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) = 0;
     virtual int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) = 0;
+    virtual int64_t pmuGroupAddEvent(uint64_t config) = 0;
+    virtual int pmuGroupRead(std::vector<uint64_t> &eventValues, uint64_t &timestamp) = 0;
     static PmuInterface *create(LinuxSysmanImp *pLinuxSysmanImp);
 };
 
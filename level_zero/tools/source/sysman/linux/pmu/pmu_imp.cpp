@@ -85,6 +85,42 @@ int PmuInterfaceImp::pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) {
     return 0;
 }
 
+int64_t PmuInterfaceImp::pmuGroupAddEvent(uint64_t config) {
+    std::lock_guard<std::mutex> lock(groupMutex);
+    int group = groupFds.empty() ? -1 : static_cast<int>(groupFds[0]);
+    int64_t fd = pmuInterfaceOpen(config, group, PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_GROUP);
+    if (fd < 0) {
+        return fd;
+    }
+    groupFds.push_back(fd);
+    return static_cast<int64_t>(groupFds.size() - 1);
+}
+
+int PmuInterfaceImp::pmuGroupRead(std::vector<uint64_t> &eventValues, uint64_t &timestamp) {
+    std::lock_guard<std::mutex> lock(groupMutex);
+    if (groupFds.empty()) {
+        return -1;
+    }
+    // PERF_FORMAT_GROUP layout: number of events, time enabled, value of each event in order of opening
+    std::vector<uint64_t> data(groupFds.size() + 2);
+    if (pmuRead(static_cast<int>(groupFds[0]), data.data(), static_cast<ssize_t>(data.size() * sizeof(uint64_t))) < 0) {
+        return -1;
+    }
+    if (data[0] != groupFds.size()) {
+        return -1;
+    }
+    timestamp = data[1];
+    eventValues.assign(data.begin() + 2, data.end());
+    return 0;
+}
+
+PmuInterfaceImp::~PmuInterfaceImp() {
+    // group members are closed before leader
+    for (auto fd = groupFds.rbegin(); fd != groupFds.rend(); fd++) {
+        this->closeFunction(static_cast<int>(*fd));
+    }
+}
+
 PmuInterfaceImp::PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) {
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
     pFsAccess = &pLinuxSysmanImp->getFsAccess();
@@ -10,6 +10,7 @@
 #include "level_zero/tools/source/sysman/linux/pmu/pmu.h"
 
 #include <linux/perf_event.h>
+#include <mutex>
 #include <string>
 #include <sys/sysinfo.h>
 
@@ -19,15 +20,22 @@ class PmuInterfaceImp : public PmuInterface, NEO::NonCopyableOrMovableClass {
   public:
     PmuInterfaceImp() = delete;
     PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp);
-    ~PmuInterfaceImp() override = default;
+    ~PmuInterfaceImp() override;
     int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) override;
     MOCKABLE_VIRTUAL int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override;
+    int64_t pmuGroupAddEvent(uint64_t config) override;
+    int pmuGroupRead(std::vector<uint64_t> &eventValues, uint64_t &timestamp) override;
 
   protected:
     MOCKABLE_VIRTUAL int getErrorNo();
     MOCKABLE_VIRTUAL int64_t perfEventOpen(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags);
     decltype(&read) readFunction = read;
     decltype(&syscall) syscallFunction = syscall;
+    decltype(&close) closeFunction = close;
+
+    // first event is group leader, all events of device are read with single read on its fd
+    std::vector<int64_t> groupFds;
+    std::mutex groupMutex;
 
   private:
     uint32_t getEventType();
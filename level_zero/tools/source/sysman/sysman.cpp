@@ -35,6 +35,16 @@ SysmanDevice *DeviceImp::getSysmanHandle() {
     return pSysmanDevice;
 }
 
+// devices block in event listen until event can be received, so each of them waits only for time left till timeout
+template <typename TimePoint>
+static uint64_t getRemainingTimeout(const TimePoint &timeToExitLoop) {
+    auto now = L0::steadyClock::now();
+    if (now >= timeToExitLoop) {
+        return 0;
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(timeToExitLoop - now).count());
+}
+
 ze_result_t DriverHandleImp::sysmanEventsListen(
     uint32_t timeout,
     uint32_t count,
@@ -46,7 +56,7 @@ ze_result_t DriverHandleImp::sysmanEventsListen(
     auto timeToExitLoop = L0::steadyClock::now() + std::chrono::milliseconds(timeout);
     do {
         for (uint32_t devIndex = 0; devIndex < count; devIndex++) {
-            gotSysmanEvent = L0::SysmanDevice::fromHandle(phDevices[devIndex])->deviceEventListen(pEvents[devIndex], timeout);
+            gotSysmanEvent = L0::SysmanDevice::fromHandle(phDevices[devIndex])->deviceEventListen(pEvents[devIndex], getRemainingTimeout(timeToExitLoop));
             if (gotSysmanEvent) {
                 *pNumDeviceEvents = 1;
                 break;
@@ -72,7 +82,7 @@ ze_result_t DriverHandleImp::sysmanEventsListenEx(
     auto timeToExitLoop = L0::steadyClock::now() + std::chrono::duration<uint64_t, std::milli>(timeout);
     do {
         for (uint32_t devIndex = 0; devIndex < count; devIndex++) {
-            gotSysmanEvent = L0::SysmanDevice::fromHandle(phDevices[devIndex])->deviceEventListen(pEvents[devIndex], timeout);
+            gotSysmanEvent = L0::SysmanDevice::fromHandle(phDevices[devIndex])->deviceEventListen(pEvents[devIndex], getRemainingTimeout(timeToExitLoop));
             if (gotSysmanEvent) {
                 *pNumDeviceEvents = 1;
                 break;
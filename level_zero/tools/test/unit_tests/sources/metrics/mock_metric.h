@@ -130,6 +130,7 @@ struct Mock<MetricQueryPool> : public MetricQueryPool {
 
     MOCK_METHOD(ze_result_t, createMetricQuery, (uint32_t, zet_metric_query_handle_t *), (override));
     MOCK_METHOD(ze_result_t, destroy, (), (override));
+    MOCK_METHOD(ze_result_t, getData, (uint32_t, zet_metric_query_handle_t *, size_t *, uint8_t *), (override));
 };
 
 template <>
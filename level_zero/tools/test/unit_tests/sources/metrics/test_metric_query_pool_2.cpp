@@ -630,6 +630,109 @@ TEST_F(MetricQueryPoolTest, givenCorrectArgumentsWhenZetMetricQueryGetDataIsCall
     EXPECT_EQ(zetMetricQueryPoolDestroy(poolHandle), ZE_RESULT_SUCCESS);
 }
 
+TEST_F(MetricQueryPoolTest, givenQueriesFromPoolWhenZetMetricQueryPoolGetDataExpIsCalledThenConsecutiveSlotsAreResolvedTogether) {
+
+    zet_device_handle_t metricDevice = device->toHandle();
+
+    Mock<MetricGroup> metricGroup;
+    zet_metric_group_properties_t metricGroupProperties = {};
+    metricGroupProperties.samplingType = ZET_METRIC_GROUP_SAMPLING_TYPE_FLAG_EVENT_BASED;
+
+    zet_metric_query_handle_t queryHandles[3] = {};
+    zet_metric_query_pool_handle_t poolHandle = {};
+    zet_metric_query_pool_desc_t poolDesc = {};
+    poolDesc.stype = ZET_STRUCTURE_TYPE_METRIC_QUERY_POOL_DESC;
+    poolDesc.count = 3;
+    poolDesc.type = ZET_METRIC_QUERY_POOL_TYPE_PERFORMANCE;
+
+    TypedValue_1_0 value = {};
+    value.Type = ValueType::Uint32;
+    value.ValueUInt32 = 64;
+
+    size_t reportSize = 256;
+
+    QueryHandle_1_0 metricsLibraryQueryHandle = {&value};
+    ContextHandle_1_0 metricsLibraryContextHandle = {&value};
+
+    EXPECT_CALL(*mockMetricEnumeration, isInitialized())
+        .Times(1)
+        .WillOnce(Return(true));
+
+    EXPECT_CALL(*mockMetricsLibrary, getContextData(_, _))
+        .Times(1)
+        .WillOnce(Return(true));
+
+    EXPECT_CALL(*mockMetricsLibrary, load())
+        .Times(0);
+
+    EXPECT_CALL(metricGroup, getProperties(_))
+        .Times(1)
+        .WillOnce(DoAll(::testing::SetArgPointee<0>(metricGroupProperties), Return(ZE_RESULT_SUCCESS)));
+
+    EXPECT_CALL(*mockMetricsLibrary->g_mockApi, MockQueryCreate(_, _))
+        .Times(1)
+        .WillOnce(DoAll(::testing::SetArgPointee<1>(metricsLibraryQueryHandle), Return(StatusCode::Success)));
+
+    EXPECT_CALL(*mockMetricsLibrary->g_mockApi, MockQueryDelete(_))
+        .Times(1)
+        .WillOnce(Return(StatusCode::Success));
+
+    EXPECT_CALL(*mockMetricsLibrary->g_mockApi, MockContextCreate(_, _, _))
+        .Times(1)
+        .WillOnce(DoAll(::testing::SetArgPointee<2>(metricsLibraryContextHandle), Return(StatusCode::Success)));
+
+    EXPECT_CALL(*mockMetricsLibrary, getMetricQueryReportSize(_))
+        .Times(1)
+        .WillOnce(DoAll(::testing::SetArgReferee<0>(reportSize), Return(true)));
+
+    std::vector<GetReportQuery_1_0> reportQueries;
+    EXPECT_CALL(*mockMetricsLibrary->g_mockApi, MockGetData(_))
+        .Times(2)
+        .WillRepeatedly(::testing::Invoke([&](GetReportData_1_0 *data) {
+            reportQueries.push_back(data->Query);
+            return StatusCode::Success;
+        }));
+
+    EXPECT_CALL(*mockMetricsLibrary->g_mockApi, MockContextDelete(_))
+        .Times(1)
+        .WillOnce(Return(StatusCode::Success));
+
+    // Create metric query pool and queries.
+    EXPECT_EQ(zetMetricQueryPoolCreate(context->toHandle(), metricDevice, metricGroup.toHandle(), &poolDesc, &poolHandle), ZE_RESULT_SUCCESS);
+    EXPECT_NE(poolHandle, nullptr);
+    for (uint32_t i = 0; i < poolDesc.count; ++i) {
+        EXPECT_EQ(zetMetricQueryCreate(poolHandle, i, &queryHandles[i]), ZE_RESULT_SUCCESS);
+    }
+
+    // Get desired raw data size, queries order does not need to match slots order.
+    zet_metric_query_handle_t requestedQueries[3] = {queryHandles[1], queryHandles[2], queryHandles[0]};
+    size_t rawSize = 0;
+    EXPECT_EQ(zetMetricQueryPoolGetDataExp(poolHandle, 3, requestedQueries, &rawSize, nullptr), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(rawSize, 3 * reportSize);
+
+    // Query from other pool is rejected.
+    std::vector<uint8_t> rawData(rawSize);
+    zet_metric_query_handle_t invalidQuery = reinterpret_cast<zet_metric_query_handle_t>(&value);
+    EXPECT_EQ(zetMetricQueryPoolGetDataExp(poolHandle, 1, &invalidQuery, &rawSize, rawData.data()), ZE_RESULT_ERROR_INVALID_ARGUMENT);
+
+    // Get data, slots 1 and 2 are resolved with single call.
+    EXPECT_EQ(zetMetricQueryPoolGetDataExp(poolHandle, 3, requestedQueries, &rawSize, rawData.data()), ZE_RESULT_SUCCESS);
+    ASSERT_EQ(reportQueries.size(), 2u);
+    EXPECT_EQ(reportQueries[0].Slot, 1u);
+    EXPECT_EQ(reportQueries[0].SlotsCount, 2u);
+    EXPECT_EQ(reportQueries[0].DataSize, 2 * reportSize);
+    EXPECT_EQ(reportQueries[0].Data, rawData.data());
+    EXPECT_EQ(reportQueries[1].Slot, 0u);
+    EXPECT_EQ(reportQueries[1].SlotsCount, 1u);
+    EXPECT_EQ(reportQueries[1].Data, rawData.data() + 2 * reportSize);
+
+    // Destroy queries and their pool.
+    for (uint32_t i = 0; i < poolDesc.count; ++i) {
+        EXPECT_EQ(zetMetricQueryDestroy(queryHandles[i]), ZE_RESULT_SUCCESS);
+    }
+    EXPECT_EQ(zetMetricQueryPoolDestroy(poolHandle), ZE_RESULT_SUCCESS);
+}
+
 TEST_F(MetricQueryPoolTest, givenExecutionQueryTypeWhenZetMetricQueryPoolCreateIsCalledThenQueryPoolIsObtained) {
 
     zet_device_handle_t metricDevice = device->toHandle();
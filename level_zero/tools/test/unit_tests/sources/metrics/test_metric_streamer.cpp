@@ -548,6 +548,156 @@ TEST_F(MetricStreamerTest, givenValidArgumentsWhenZetMetricStreamerReadDataIsCal
     EXPECT_EQ(zetMetricStreamerClose(streamerHandle), ZE_RESULT_SUCCESS);
 }
 
+TEST_F(MetricStreamerTest, givenReportRingWhenAcquiringAndReleasingReportsThenReportsAreReadInPlaceAndOverflowIsCounted) {
+
+    // One api: device handle.
+    zet_device_handle_t metricDeviceHandle = device->toHandle();
+
+    // One api: event handle.
+    ze_event_handle_t eventHandle = {};
+
+    // One api: streamer handle.
+    zet_metric_streamer_handle_t streamerHandle = {};
+    zet_metric_streamer_desc_t streamerDesc = {};
+
+    streamerDesc.stype = ZET_STRUCTURE_TYPE_METRIC_STREAMER_DESC;
+    streamerDesc.notifyEveryNReports = 2;
+    streamerDesc.samplingPeriod = 1000;
+
+    // One api: metric group handle.
+    Mock<MetricGroup> metricGroup;
+    zet_metric_group_handle_t metricGroupHandle = metricGroup.toHandle();
+    zet_metric_group_properties_t metricGroupProperties = {};
+
+    // Metrics Discovery device.
+    metricsDeviceParams.ConcurrentGroupsCount = 1;
+
+    // Metrics Discovery concurrent group.
+    Mock<IConcurrentGroup_1_5> metricsConcurrentGroup;
+    TConcurrentGroupParams_1_0 metricsConcurrentGroupParams = {};
+    metricsConcurrentGroupParams.MetricSetsCount = 1;
+    metricsConcurrentGroupParams.SymbolName = "OA";
+    metricsConcurrentGroupParams.Description = "OA description";
+
+    // Metrics Discovery metric set.
+    Mock<MetricsDiscovery::IMetricSet_1_5> metricsSet;
+    MetricsDiscovery::TMetricSetParams_1_4 metricsSetParams = {};
+    metricsSetParams.ApiMask = MetricsDiscovery::API_TYPE_IOSTREAM;
+    metricsSetParams.MetricsCount = 0;
+    metricsSetParams.SymbolName = "Metric set name";
+    metricsSetParams.ShortName = "Metric set description";
+    metricsSetParams.RawReportSize = 256;
+
+    openMetricsAdapter();
+
+    EXPECT_CALL(metricsDevice, GetParams())
+        .WillRepeatedly(Return(&metricsDeviceParams));
+
+    EXPECT_CALL(metricsDevice, GetConcurrentGroup(_))
+        .Times(1)
+        .WillOnce(Return(&metricsConcurrentGroup));
+
+    EXPECT_CALL(metricsConcurrentGroup, GetParams())
+        .Times(1)
+        .WillRepeatedly(Return(&metricsConcurrentGroupParams));
+
+    EXPECT_CALL(metricsConcurrentGroup, GetMetricSet(_))
+        .WillRepeatedly(Return(&metricsSet));
+
+    EXPECT_CALL(metricsSet, GetParams())
+        .WillRepeatedly(Return(&metricsSetParams));
+
+    EXPECT_CALL(metricsSet, SetApiFiltering(_))
+        .WillRepeatedly(Return(TCompletionCode::CC_OK));
+
+    EXPECT_CALL(metricsConcurrentGroup, OpenIoStream(_, _, _, _))
+        .Times(1)
+        .WillOnce(Return(TCompletionCode::CC_OK));
+
+    std::vector<std::pair<char *, uint32_t>> readIoStreamCalls;
+    std::vector<uint32_t> readIoStreamReports = {3, 1, 2, 5};
+    EXPECT_CALL(metricsConcurrentGroup, ReadIoStream(_, _, _))
+        .Times(4)
+        .WillRepeatedly(::testing::Invoke([&](uint32_t *reportsCount, char *reportData, uint32_t readFlags) {
+            readIoStreamCalls.push_back({reportData, *reportsCount});
+            *reportsCount = readIoStreamReports[readIoStreamCalls.size() - 1];
+            return TCompletionCode::CC_OK;
+        }));
+
+    EXPECT_CALL(metricsConcurrentGroup, CloseIoStream())
+        .Times(1)
+        .WillOnce(Return(TCompletionCode::CC_OK));
+
+    // Metric group count.
+    uint32_t metricGroupCount = 0;
+    EXPECT_EQ(zetMetricGroupGet(metricDeviceHandle, &metricGroupCount, nullptr), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(metricGroupCount, 1u);
+
+    // Metric group handle.
+    EXPECT_EQ(zetMetricGroupGet(metricDeviceHandle, &metricGroupCount, &metricGroupHandle), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(metricGroupCount, 1u);
+    EXPECT_NE(metricGroupHandle, nullptr);
+
+    // Metric group properties.
+    EXPECT_EQ(zetMetricGroupGetProperties(metricGroupHandle, &metricGroupProperties), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(metricGroupProperties.domain, 0u);
+    EXPECT_EQ(metricGroupProperties.samplingType, ZET_METRIC_GROUP_SAMPLING_TYPE_FLAG_TIME_BASED);
+    EXPECT_EQ(metricGroupProperties.metricCount, metricsSetParams.MetricsCount);
+    EXPECT_EQ(strcmp(metricGroupProperties.description, metricsSetParams.ShortName), 0);
+    EXPECT_EQ(strcmp(metricGroupProperties.name, metricsSetParams.SymbolName), 0);
+
+    // Metric group activation.
+    EXPECT_EQ(zetContextActivateMetricGroups(context->toHandle(), metricDeviceHandle, 1, &metricGroupHandle), ZE_RESULT_SUCCESS);
+
+    // Metric streamer open.
+    EXPECT_EQ(zetMetricStreamerOpen(context->toHandle(), metricDeviceHandle, metricGroupHandle, &streamerDesc, eventHandle, &streamerHandle), ZE_RESULT_SUCCESS);
+    EXPECT_NE(streamerHandle, nullptr);
+
+    // Metric streamer: report ring of oa buffer size.
+    zet_metric_streamer_report_ring_exp_t ring = {};
+    EXPECT_EQ(zetMetricStreamerGetReportRingExp(streamerHandle, &ring), ZE_RESULT_SUCCESS);
+    ASSERT_NE(ring.pData, nullptr);
+    EXPECT_EQ(ring.reportSize, 256u);
+    EXPECT_EQ(ring.ringSize, 4 * ring.reportSize);
+    auto ringData = reinterpret_cast<char *>(const_cast<uint8_t *>(ring.pData));
+
+    // Metric streamer: copying api is not used together with report ring.
+    size_t rawSize = ring.reportSize;
+    std::vector<uint8_t> rawData(rawSize);
+    EXPECT_EQ(zetMetricStreamerReadData(streamerHandle, 1, &rawSize, rawData.data()), ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE);
+
+    // Metric streamer: reports are read directly into the ring.
+    uint64_t head = 0;
+    uint64_t tail = 0;
+    uint64_t overflowReportCount = 0;
+    EXPECT_EQ(zetMetricStreamerAcquireReportsExp(streamerHandle, &head, &tail, &overflowReportCount), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(head, 0u);
+    EXPECT_EQ(tail, 3 * ring.reportSize);
+    EXPECT_EQ(overflowReportCount, 0u);
+    ASSERT_EQ(readIoStreamCalls.size(), 1u);
+    EXPECT_EQ(readIoStreamCalls[0].first, ringData);
+    EXPECT_EQ(readIoStreamCalls[0].second, 4u);
+
+    EXPECT_EQ(zetMetricStreamerReleaseReportsExp(streamerHandle, ring.reportSize / 2), ZE_RESULT_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(zetMetricStreamerReleaseReportsExp(streamerHandle, tail + ring.reportSize), ZE_RESULT_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(zetMetricStreamerReleaseReportsExp(streamerHandle, 2 * ring.reportSize), ZE_RESULT_SUCCESS);
+
+    // Metric streamer: free space wrapping around ring end is filled, then full ring drops reports.
+    EXPECT_EQ(zetMetricStreamerAcquireReportsExp(streamerHandle, &head, &tail, &overflowReportCount), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(head, 2 * ring.reportSize);
+    EXPECT_EQ(tail, 6 * ring.reportSize);
+    EXPECT_EQ(overflowReportCount, 5u);
+    ASSERT_EQ(readIoStreamCalls.size(), 4u);
+    EXPECT_EQ(readIoStreamCalls[1].first, ringData + 3 * ring.reportSize);
+    EXPECT_EQ(readIoStreamCalls[1].second, 1u);
+    EXPECT_EQ(readIoStreamCalls[2].first, ringData);
+    EXPECT_EQ(readIoStreamCalls[2].second, 2u);
+    EXPECT_EQ(readIoStreamCalls[3].second, 4u);
+
+    // Metric streamer close.
+    EXPECT_EQ(zetMetricStreamerClose(streamerHandle), ZE_RESULT_SUCCESS);
+}
+
 TEST_F(MetricStreamerTest, givenInvalidArgumentsWhenZetCommandListAppendMetricStreamerMarkerIsCalledThenReturnsFail) {
 
     // One api: device handle.
@@ -61,10 +61,16 @@ struct Mock<EngineNeoDrm> : public EngineNeoDrm {
     MOCK_METHOD(bool, queryEngineInfo, (), (override));
 };
 
+inline static int mockPmuClose(int fd) {
+    return 0;
+}
 class MockPmuInterfaceImp : public PmuInterfaceImp {
   public:
+    using PmuInterfaceImp::closeFunction;
     using PmuInterfaceImp::perfEventOpen;
-    MockPmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) : PmuInterfaceImp(pLinuxSysmanImp) {}
+    MockPmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) : PmuInterfaceImp(pLinuxSysmanImp) {
+        closeFunction = mockPmuClose;
+    }
 };
 template <>
 struct Mock<MockPmuInterfaceImp> : public MockPmuInterfaceImp {
@@ -76,8 +82,12 @@ struct Mock<MockPmuInterfaceImp> : public MockPmuInterfaceImp {
         return -1;
     }
     int mockedPmuReadAndSuccessReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
-        data[0] = mockActiveTime;
+        auto eventCount = sizeOfdata / sizeof(uint64_t) - 2;
+        data[0] = eventCount;
         data[1] = mockTimestamp;
+        for (size_t i = 0; i < eventCount; i++) {
+            data[2 + i] = mockActiveTime;
+        }
         return 0;
     }
     int mockedPmuReadAndFailureReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
@@ -199,6 +199,27 @@ TEST_F(ZesEngineFixture, GivenValidEngineHandleWhenCallingZesEngineGetActivityAn
     EXPECT_EQ(-1, pPmuInterface->pmuInterfaceOpen(0, -1, 0));
 }
 
+TEST_F(ZesEngineFixture, GivenValidEngineHandlesWhenCallingZesEngineGetActivityThenAllEnginesAreReadFromSinglePmuGroup) {
+    auto handles = getEngineHandles(handleComponentCount);
+    EXPECT_EQ(handleComponentCount, handles.size());
+
+    EXPECT_CALL(*pPmuInterface.get(), pmuRead(static_cast<int>(mockPmuFd), _, static_cast<ssize_t>((handleComponentCount + 2) * sizeof(uint64_t))))
+        .Times(1)
+        .WillOnce(::testing::Invoke([](int fd, uint64_t *data, ssize_t sizeOfdata) {
+            data[0] = handleComponentCount;
+            data[1] = mockTimestamp;
+            for (uint32_t i = 0; i < handleComponentCount; i++) {
+                data[2 + i] = (i + 1) * mockActiveTime;
+            }
+            return 0;
+        }));
+
+    zes_engine_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[2], &stats));
+    EXPECT_EQ(3 * mockActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+    EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+}
+
 TEST_F(ZesEngineFixture, GivenValidOsSysmanPointerWhenRetrievingEngineTypeAndInstancesAndIfEngineInfoQueryFailsThenErrorIsReturned) {
     std::multimap<zes_engine_group_t, uint32_t> engineGroupInstance;
     ON_CALL(*pDrm.get(), queryEngineInfo())
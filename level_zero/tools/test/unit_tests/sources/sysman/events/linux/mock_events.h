@@ -84,8 +84,13 @@ class PublicLinuxEventsImp : public L0::LinuxEventsImp {
   public:
     PublicLinuxEventsImp(OsSysman *pOsSysman) : LinuxEventsImp(pOsSysman) {}
     using LinuxEventsImp::getPciIdPathTag;
+    using LinuxEventsImp::isDrmUevent;
     using LinuxEventsImp::memHealthAtEventRegister;
     using LinuxEventsImp::pciIdPathTag;
+    using LinuxEventsImp::pollFunction;
+    using LinuxEventsImp::recvFunction;
+    using LinuxEventsImp::ueventFd;
+    using LinuxEventsImp::waitForDrmUevent;
 };
 
 } // namespace ult
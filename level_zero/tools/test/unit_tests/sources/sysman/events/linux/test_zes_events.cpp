@@ -275,5 +275,79 @@ TEST_F(SysmanEventsFixture, GivenValidDeviceHandleWhenListeningForResetRequiredE
     delete[] pDeviceEvents;
 }
 
+static const char drmUevent[] = "change@/devices/pci0000:00/0000:00:02.0/drm/card0\0ACTION=change\0SUBSYSTEM=drm\0RESET_FAILED=1";
+static const char otherUevent[] = "add@/devices/virtual/net/lo\0ACTION=add\0SUBSYSTEM=net";
+static const char *pendingUevent = nullptr;
+static size_t pendingUeventSize = 0u;
+static uint32_t pollCalled = 0u;
+
+static int pollReturnReady(struct pollfd *fds, nfds_t nfds, int timeout) {
+    pollCalled++;
+    fds[0].revents = POLLIN;
+    return 1;
+}
+
+static int pollReturnTimeout(struct pollfd *fds, nfds_t nfds, int timeout) {
+    pollCalled++;
+    return 0;
+}
+
+static ssize_t recvPendingUevent(int fd, void *buf, size_t size, int flags) {
+    if (pendingUevent == nullptr) {
+        return -1;
+    }
+    auto length = std::min(size, pendingUeventSize);
+    memcpy(buf, pendingUevent, length);
+    pendingUevent = nullptr;
+    return static_cast<ssize_t>(length);
+}
+
+TEST_F(SysmanEventsFixture, GivenUeventsWhenCheckingSubsystemThenOnlyDrmUeventIsRecognized) {
+    EXPECT_TRUE(PublicLinuxEventsImp::isDrmUevent(drmUevent, sizeof(drmUevent)));
+    EXPECT_FALSE(PublicLinuxEventsImp::isDrmUevent(otherUevent, sizeof(otherUevent)));
+}
+
+TEST_F(SysmanEventsFixture, GivenUeventSocketWhenWaitingForDrmUeventThenWaitFinishesOnlyAfterDrmUeventIsReceived) {
+    PublicLinuxEventsImp linuxEventImp(pOsSysman);
+    auto ueventFdOriginal = linuxEventImp.ueventFd;
+    linuxEventImp.ueventFd = 0x7fff;
+    linuxEventImp.pollFunction = pollReturnReady;
+    linuxEventImp.recvFunction = recvPendingUevent;
+
+    pendingUevent = otherUevent;
+    pendingUeventSize = sizeof(otherUevent);
+    EXPECT_FALSE(linuxEventImp.waitForDrmUevent(100u));
+
+    pendingUevent = drmUevent;
+    pendingUeventSize = sizeof(drmUevent);
+    EXPECT_TRUE(linuxEventImp.waitForDrmUevent(100u));
+
+    linuxEventImp.pollFunction = pollReturnTimeout;
+    EXPECT_FALSE(linuxEventImp.waitForDrmUevent(100u));
+    linuxEventImp.ueventFd = ueventFdOriginal;
+}
+
+TEST_F(SysmanEventsFixture, GivenNoRegisteredEventsOrZeroTimeoutWhenListeningForEventsThenUeventSocketIsNotPolled) {
+    PublicLinuxEventsImp linuxEventImp(pOsSysman);
+    auto ueventFdOriginal = linuxEventImp.ueventFd;
+    linuxEventImp.ueventFd = 0x7fff;
+    linuxEventImp.pollFunction = pollReturnTimeout;
+    pollCalled = 0u;
+
+    zes_event_type_flags_t events = 0;
+    EXPECT_FALSE(linuxEventImp.eventListen(events, 100u));
+    EXPECT_EQ(0u, pollCalled);
+
+    ON_CALL(*pFsAccess.get(), read(_, Matcher<uint32_t &>(_)))
+        .WillByDefault(::testing::Invoke(pFsAccess.get(), &Mock<EventsFsAccess>::getValReturnValAsZero));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, linuxEventImp.eventRegister(ZES_EVENT_TYPE_FLAG_DEVICE_DETACH));
+    EXPECT_FALSE(linuxEventImp.eventListen(events, 0u));
+    EXPECT_EQ(0u, pollCalled);
+
+    EXPECT_FALSE(linuxEventImp.eventListen(events, 100u));
+    EXPECT_EQ(1u, pollCalled);
+    linuxEventImp.ueventFd = ueventFdOriginal;
+}
+
 } // namespace ult
 } // namespace L0
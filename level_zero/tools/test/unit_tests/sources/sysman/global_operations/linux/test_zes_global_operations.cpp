@@ -228,6 +228,25 @@ TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInfor
     EXPECT_EQ(processes[2].sharedSize, sharedMemSize4);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenProcessStatesRetrievedOnceWhenRetrievingProcessStatesAgainThenPidAndEngineListOfKnownClientsAreNotReadAgain) {
+    EXPECT_CALL(*pSysfsAccess.get(), scanDirEntries(std::string("clients/4/busy"), _))
+        .Times(1)
+        .WillOnce(::testing::Invoke(pSysfsAccess.get(), &Mock<GlobalOperationsSysfsAccess>::getScannedDirEntries));
+    EXPECT_CALL(*pSysfsAccess.get(), read(std::string("clients/4/pid"), Matcher<uint64_t &>(_)))
+        .Times(1)
+        .WillOnce(::testing::Invoke(pSysfsAccess.get(), &Mock<GlobalOperationsSysfsAccess>::getValUnsignedLong));
+
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, totalProcessStates);
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    EXPECT_EQ(processes[0].processId, pid1);
+    EXPECT_EQ(processes[0].engines, engines1);
+    EXPECT_EQ(processes[0].memSize, memSize1);
+    EXPECT_EQ(processes[0].sharedSize, sharedMemSize1);
+}
+
 TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInformationAboutHostProcessesUsingFaultyClientFileThenFailureIsReturned) {
     uint32_t count = 0;
     ON_CALL(*pSysfsAccess.get(), scanDirEntries(_, _))
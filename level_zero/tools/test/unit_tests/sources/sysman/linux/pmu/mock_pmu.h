@@ -19,13 +19,20 @@ constexpr int64_t mockPmuFd = 5;
 constexpr uint64_t mockEventCount = 2u;
 constexpr uint64_t mockEvent1Val = 100u;
 constexpr uint64_t mockEvent2Val = 150u;
+inline static int mockPmuCloseForSysman(int fd) {
+    return 0;
+}
 class MockPmuInterfaceImpForSysman : public PmuInterfaceImp {
   public:
+    using PmuInterfaceImp::closeFunction;
     using PmuInterfaceImp::getErrorNo;
     using PmuInterfaceImp::perfEventOpen;
     using PmuInterfaceImp::readFunction;
+    using PmuInterfaceImp::groupFds;
     using PmuInterfaceImp::syscallFunction;
-    MockPmuInterfaceImpForSysman(LinuxSysmanImp *pLinuxSysmanImp) : PmuInterfaceImp(pLinuxSysmanImp) {}
+    MockPmuInterfaceImpForSysman(LinuxSysmanImp *pLinuxSysmanImp) : PmuInterfaceImp(pLinuxSysmanImp) {
+        closeFunction = mockPmuCloseForSysman;
+    }
 };
 template <>
 struct Mock<MockPmuInterfaceImpForSysman> : public MockPmuInterfaceImpForSysman {
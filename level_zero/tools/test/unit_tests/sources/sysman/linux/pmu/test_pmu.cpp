@@ -106,6 +106,39 @@ TEST_F(SysmanPmuFixture, GivenValidPmuHandleWhenReadingGroupOfEventsUsingGroupFd
     EXPECT_EQ(mockEvent2Val, data[3]);
 }
 
+TEST_F(SysmanPmuFixture, GivenEventsAddedToPmuGroupWhenReadingGroupThenFirstEventIsLeaderAndAllValuesAreReturnedWithSingleRead) {
+    EXPECT_CALL(*pPmuInterface.get(), perfEventOpen(_, _, _, -1, _))
+        .Times(1)
+        .WillOnce(Return(mockPmuFd));
+    EXPECT_CALL(*pPmuInterface.get(), perfEventOpen(_, _, _, static_cast<int>(mockPmuFd), _))
+        .Times(1)
+        .WillOnce(Return(mockPmuFd + 1));
+    EXPECT_EQ(0, pPmuInterface->pmuGroupAddEvent(10));
+    EXPECT_EQ(1, pPmuInterface->pmuGroupAddEvent(15));
+
+    EXPECT_CALL(*pPmuInterface.get(), pmuRead(static_cast<int>(mockPmuFd), _, static_cast<ssize_t>(4 * sizeof(uint64_t))))
+        .Times(1)
+        .WillOnce(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImpForSysman>::mockedReadCountersForGroupSuccess));
+    std::vector<uint64_t> eventValues;
+    uint64_t timestamp = 0;
+    EXPECT_EQ(0, pPmuInterface->pmuGroupRead(eventValues, timestamp));
+    ASSERT_EQ(2u, eventValues.size());
+    EXPECT_EQ(mockTimeStamp, timestamp);
+    EXPECT_EQ(mockEvent1Val, eventValues[0]);
+    EXPECT_EQ(mockEvent2Val, eventValues[1]);
+}
+
+TEST_F(SysmanPmuFixture, GivenEmptyPmuGroupOrFailingGroupLeaderOpenWhenUsingPmuGroupThenFailureIsReturned) {
+    std::vector<uint64_t> eventValues;
+    uint64_t timestamp = 0;
+    EXPECT_EQ(-1, pPmuInterface->pmuGroupRead(eventValues, timestamp));
+
+    ON_CALL(*pPmuInterface.get(), perfEventOpen(_, _, _, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImpForSysman>::mockedPerfEventOpenAndFailureReturn));
+    EXPECT_GT(0, pPmuInterface->pmuGroupAddEvent(10));
+    EXPECT_TRUE(pPmuInterface->groupFds.empty());
+}
+
 TEST_F(SysmanPmuFixture, GivenValidPmuHandleWhenCallingPmuInterfaceOpenAndPerfEventOpenFailsThenFailureIsReturned) {
     ON_CALL(*pPmuInterface.get(), perfEventOpen(_, _, _, _, _))
         .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImpForSysman>::mockedPerfEventOpenAndFailureReturn));
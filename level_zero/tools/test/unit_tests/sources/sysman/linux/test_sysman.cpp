@@ -42,7 +42,7 @@ TEST_F(SysmanDeviceFixture, GivenCreateFsAccessHandleWhenCallinggetFsAccessThenC
 }
 
 TEST_F(SysmanDeviceFixture, GivenValidPathnameWhenCallingFsAccessExistsThenSuccessIsReturned) {
-    auto FsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &FsAccess = pLinuxSysmanImp->getFsAccess();
 
     char cwd[PATH_MAX];
     std::string path = getcwd(cwd, PATH_MAX);
@@ -50,12 +50,50 @@ TEST_F(SysmanDeviceFixture, GivenValidPathnameWhenCallingFsAccessExistsThenSucce
 }
 
 TEST_F(SysmanDeviceFixture, GivenInvalidPathnameWhenCallingFsAccessExistsThenErrorIsReturned) {
-    auto FsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &FsAccess = pLinuxSysmanImp->getFsAccess();
 
     std::string path = "noSuchFileOrDirectory";
     EXPECT_FALSE(FsAccess.fileExists(path));
 }
 
+TEST_F(SysmanDeviceFixture, GivenAttributeFileRewrittenWhenCallingFsAccessReadAgainThenUpdatedValueIsReturned) {
+    std::unique_ptr<FsAccess> pFsAccess(FsAccess::create());
+    const std::string file = "fsAccessReadTestFile";
+
+    std::ofstream(file) << "1234\n";
+    uint64_t val64 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(file, val64));
+    EXPECT_EQ(1234u, val64);
+
+    std::ofstream(file) << "-56\n";
+    int32_t val32 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(file, val32));
+    EXPECT_EQ(-56, val32);
+
+    std::ofstream(file) << "card0 extra\n";
+    std::string valString;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(file, valString));
+    EXPECT_EQ("card0", valString);
+
+    std::remove(file.c_str());
+}
+
+TEST_F(SysmanDeviceFixture, GivenAttributeFileWithInvalidContentWhenCallingFsAccessReadThenErrorIsReturned) {
+    std::unique_ptr<FsAccess> pFsAccess(FsAccess::create());
+    const std::string file = "fsAccessReadTestFile";
+
+    std::ofstream(file) << "noNumber\n";
+    uint64_t val64 = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pFsAccess->read(file, val64));
+
+    std::ofstream(file) << "4294967296\n";
+    uint32_t val32 = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pFsAccess->read(file, val32));
+
+    std::remove(file.c_str());
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, pFsAccess->read("noSuchFileOrDirectory", val64));
+}
+
 TEST_F(SysmanDeviceFixture, GivenCreateSysfsAccessHandleWhenCallinggetSysfsAccessThenCreatedSysfsAccessHandleHandleWillBeRetrieved) {
     if (pLinuxSysmanImp->pSysfsAccess != nullptr) {
         //delete previously allocated pSysfsAccess
@@ -77,13 +115,13 @@ TEST_F(SysmanDeviceFixture, GivenCreateProcfsAccessHandleWhenCallinggetProcfsAcc
 }
 
 TEST_F(SysmanDeviceFixture, GivenValidPidWhenCallingProcfsAccessIsAliveThenSuccessIsReturned) {
-    auto ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
+    auto &ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
 
     EXPECT_TRUE(ProcfsAccess.isAlive(getpid()));
 }
 
 TEST_F(SysmanDeviceFixture, GivenInvalidPidWhenCallingProcfsAccessIsAliveThenErrorIsReturned) {
-    auto ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
+    auto &ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
 
     EXPECT_FALSE(ProcfsAccess.isAlive(reinterpret_cast<::pid_t>(-1)));
 }
@@ -127,7 +165,7 @@ TEST_F(SysmanMultiDeviceFixture, GivenValidDeviceHandleHavingSubdevicesWhenValid
 
 TEST_F(SysmanMultiDeviceFixture, GivenValidEffectiveUserIdCheckWhetherPermissionsReturnedByIsRootUserAreCorrect) {
     int euid = geteuid();
-    auto pFsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &pFsAccess = pLinuxSysmanImp->getFsAccess();
     if (euid == 0) {
         EXPECT_EQ(true, pFsAccess.isRootUser());
     } else {
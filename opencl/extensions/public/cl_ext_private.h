@@ -77,6 +77,11 @@ using cl_unified_shared_memory_capabilities_intel = cl_bitfield;
 #define CL_MEM_ALLOCATION_HANDLE_INTEL 0x10050
 #define CL_MEM_USES_COMPRESSION_INTEL 0x10051
 
+/* cl_mem_properties_intel, places allocation in L3 region protected from streaming traffic */
+#define CL_MEM_CACHE_REGION_INTEL 0x10052
+#define CL_MEM_CACHE_REGION_DEFAULT_INTEL 0
+#define CL_MEM_CACHE_REGION_RESERVED_INTEL 1
+
 //Used with createBuffer
 #define CL_MEM_ALLOW_UNRESTRICTED_SIZE_INTEL (1 << 23)
 
@@ -193,6 +198,49 @@ typedef struct _cl_queue_family_properties_intel {
     char name[CL_QUEUE_FAMILY_MAX_NAME_SIZE_INTEL];
 } cl_queue_family_properties_intel;
 
+/******************************
+*   QUEUE PLACEMENT POLICY    *
+*******************************/
+
+/* cl_context_properties */
+#define CL_CONTEXT_QUEUE_PLACEMENT_POLICY_INTEL 0x10060
+
+/* queue placement policies */
+#define CL_QUEUE_PLACEMENT_DEFAULT_INTEL 0u
+#define CL_QUEUE_PLACEMENT_ROUND_ROBIN_INTEL 1u
+#define CL_QUEUE_PLACEMENT_LEAST_BUSY_INTEL 2u
+
+/******************************
+*       QUEUE PRIORITY        *
+*******************************/
+
+/* cl_command_queue_info, CL_FALSE when KMD did not apply CL_QUEUE_PRIORITY_KHR requested for queue */
+#define CL_QUEUE_PRIORITY_HONORED_INTEL 0x10061
+
+/******************************
+*  MEMORY USAGE STATISTICS    *
+*******************************/
+
+/* cl_device_info */
+#define CL_DEVICE_MEMORY_USAGE_STATISTICS_INTEL 0x10026
+
+typedef struct _cl_memory_usage_statistics_intel {
+    cl_uint allocationType;
+    cl_uint memoryPool;
+    cl_ulong currentSize;
+    cl_ulong peakSize;
+    cl_ulong currentCount;
+    cl_ulong allocationsCount;
+    cl_ulong freesCount;
+} cl_memory_usage_statistics_intel;
+
+/******************************
+*  MULTI ROOT DEVICE NDRANGE  *
+*******************************/
+
+/* cl_kernel_exec_info */
+#define CL_KERNEL_EXEC_INFO_SPLIT_ACROSS_ROOT_DEVICES_INTEL 0x10070
+
 /******************************
 *   DEVICE ATTRIBUTE QUERY    *
 *******************************/
@@ -482,6 +482,9 @@ cl_int CL_API_CALL clReleaseContext(cl_context context) {
     DBG_LOG_INPUTS("context", context);
     Context *pContext = castToObject<Context>(context);
     if (pContext) {
+        if (pContext->getReference() == 1) {
+            gtpinNotifyContextRelease(context);
+        }
         pContext->release();
         TRACING_EXIT(clReleaseContext, &retVal);
         return retVal;
@@ -1526,7 +1529,7 @@ cl_int CL_API_CALL clBuildProgram(cl_program program,
     retVal = validateObjects(WithCastToInternal(program, &pProgram), Program::isValidCallback(funcNotify, userData));
 
     if (CL_SUCCESS == retVal) {
-        if (pProgram->isLocked()) {
+        if (pProgram->isLocked() || pProgram->isAsyncBuildPending()) {
             retVal = CL_INVALID_OPERATION;
         }
     }
@@ -1538,8 +1541,12 @@ cl_int CL_API_CALL clBuildProgram(cl_program program,
         retVal = Program::processInputDevices(deviceVectorPtr, numDevices, deviceList, pProgram->getDevices());
     }
     if (CL_SUCCESS == retVal) {
-        retVal = pProgram->build(*deviceVectorPtr, options, clCacheEnabled);
-        pProgram->invokeCallback(funcNotify, userData);
+        if (funcNotify && DebugManager.flags.EnableAsyncProgramBuild.get() == 1) {
+            retVal = pProgram->buildAsync(*deviceVectorPtr, options, clCacheEnabled, funcNotify, userData);
+        } else {
+            retVal = pProgram->build(*deviceVectorPtr, options, clCacheEnabled);
+            pProgram->invokeCallback(funcNotify, userData);
+        }
     }
 
     TRACING_EXIT(clBuildProgram, &retVal);
@@ -1565,7 +1572,7 @@ cl_int CL_API_CALL clCompileProgram(cl_program program,
     retVal = validateObjects(WithCastToInternal(program, &pProgram), Program::isValidCallback(funcNotify, userData));
 
     if (CL_SUCCESS == retVal) {
-        if (pProgram->isLocked()) {
+        if (pProgram->isLocked() || pProgram->isAsyncBuildPending()) {
             retVal = CL_INVALID_OPERATION;
         }
     }
@@ -1722,6 +1729,7 @@ cl_kernel CL_API_CALL clCreateKernel(cl_program clProgram,
             break;
         }
 
+        pProgram->waitForAsyncBuild();
         if (!pProgram->isBuilt()) {
             retVal = CL_INVALID_PROGRAM_EXECUTABLE;
             break;
@@ -1774,6 +1782,7 @@ cl_int CL_API_CALL clCreateKernelsInProgram(cl_program clProgram,
                    "numKernelsRet", numKernelsRet);
     auto pProgram = castToObject<Program>(clProgram);
     if (pProgram) {
+        pProgram->waitForAsyncBuild();
         auto numKernelsInProgram = pProgram->getNumKernels();
 
         if (kernels) {
@@ -2033,7 +2042,8 @@ cl_int CL_API_CALL clGetEventInfo(cl_event event,
             TRACING_EXIT(clGetEventInfo, &retVal);
             return retVal;
         }
-        retVal = changeGetInfoStatusToCLResultType(info.set<cl_command_queue>(neoEvent->getCommandQueue()));
+        auto commandQueue = neoEvent->getCommandQueue();
+        retVal = changeGetInfoStatusToCLResultType(info.set<cl_command_queue>(commandQueue ? commandQueue->getApiCommandQueue() : nullptr));
         TRACING_EXIT(clGetEventInfo, &retVal);
         return retVal;
     }
@@ -3483,15 +3493,27 @@ cl_int CL_API_CALL clEnqueueNDRangeKernel(cl_command_queue commandQueue,
         gtpinNotifyKernelSubmit(kernel, pCommandQueue);
     }
 
-    retVal = pCommandQueue->enqueueKernel(
-        pKernel,
-        workDim,
-        globalWorkOffset,
-        globalWorkSize,
-        localWorkSize,
-        numEventsInWaitList,
-        eventWaitList,
-        event);
+    if (pMultiDeviceKernel->canSplitAcrossRootDevices(*pCommandQueue, workDim, globalWorkSize)) {
+        retVal = pMultiDeviceKernel->enqueueAcrossRootDevices(
+            *pCommandQueue,
+            workDim,
+            globalWorkOffset,
+            globalWorkSize,
+            localWorkSize,
+            numEventsInWaitList,
+            eventWaitList,
+            event);
+    } else {
+        retVal = pCommandQueue->enqueueKernel(
+            pKernel,
+            workDim,
+            globalWorkOffset,
+            globalWorkSize,
+            localWorkSize,
+            numEventsInWaitList,
+            eventWaitList,
+            event);
+    }
 
     DBG_LOG_INPUTS("event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
     TRACING_EXIT(clEnqueueNDRangeKernel, &retVal);
@@ -3863,6 +3885,8 @@ void *clDeviceMemAllocINTEL(
     }
 
     unifiedMemoryProperties.device = &neoDevice->getDevice();
+    unifiedMemoryProperties.preferRenderCompression = HwHelper::renderCompressedBuffersSupported(neoDevice->getHardwareInfo()) &&
+                                                      MemObjHelper::isSuitableForHeuristicCompression(unifiedMemoryProperties.allocationFlags, size);
 
     return neoContext->getSVMAllocsManager()->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
 }
@@ -3999,7 +4023,7 @@ cl_int clGetMemAllocInfoINTEL(
         if (!unifiedMemoryAllocation) {
             return changeGetInfoStatusToCLResultType(info.set<void *>(nullptr));
         }
-        return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+        return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->getBaseGpuAddress()));
     }
     case CL_MEM_ALLOC_SIZE_INTEL: {
         if (!unifiedMemoryAllocation) {
@@ -4375,6 +4399,7 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelMaxConcurrentWorkGroupCountINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelSuggestedLocalWorkSizeINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueNDCountKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clSetKernelArgsINTEL);
 
     void *ret = sharingFactory.getExtensionFunctionAddress(funcName);
     if (ret != nullptr) {
@@ -4952,6 +4977,17 @@ cl_int CL_API_CALL clSetKernelExecInfo(cl_kernel kernel,
         TRACING_EXIT(clSetKernelExecInfo, &retVal);
         return retVal;
     }
+    case CL_KERNEL_EXEC_INFO_SPLIT_ACROSS_ROOT_DEVICES_INTEL: {
+        if (paramValueSize != sizeof(cl_bool) ||
+            paramValue == nullptr) {
+            retVal = CL_INVALID_VALUE;
+            TRACING_EXIT(clSetKernelExecInfo, &retVal);
+            return retVal;
+        }
+        pMultiDeviceKernel->setSplitAcrossRootDevices(*static_cast<const cl_bool *>(paramValue) == CL_TRUE);
+        TRACING_EXIT(clSetKernelExecInfo, &retVal);
+        return retVal;
+    }
     case CL_KERNEL_EXEC_INFO_KERNEL_TYPE_INTEL: {
         if (paramValueSize != sizeof(cl_execution_info_kernel_type_intel) ||
             paramValue == nullptr) {
@@ -5968,6 +6004,31 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(cl_command_queue commandQueue,
     return retVal;
 }
 
+cl_int CL_API_CALL clSetKernelArgsINTEL(cl_kernel kernel,
+                                        cl_uint numArgs,
+                                        const cl_uint *argIndices,
+                                        const size_t *argSizes,
+                                        const void *const *argValues) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("kernel", kernel, "numArgs", numArgs,
+                   "argIndices", argIndices, "argSizes", argSizes, "argValues", argValues);
+
+    MultiDeviceKernel *pMultiDeviceKernel = nullptr;
+    retVal = validateObjects(WithCastToInternal(kernel, &pMultiDeviceKernel));
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if (numArgs == 0 || !argIndices || !argSizes || !argValues) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pMultiDeviceKernel->setArguments(numArgs, argIndices, argSizes, argValues);
+    return retVal;
+}
+
 cl_int CL_API_CALL clSetContextDestructorCallback(cl_context context,
                                                   void(CL_CALLBACK *pfnNotify)(cl_context /* context */, void * /* user_data */),
                                                   void *userData) {
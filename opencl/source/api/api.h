@@ -1059,6 +1059,13 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(
     const cl_event *eventWaitList,
     cl_event *event);
 
+cl_int CL_API_CALL clSetKernelArgsINTEL(
+    cl_kernel kernel,
+    cl_uint numArgs,
+    const cl_uint *argIndices,
+    const size_t *argSizes,
+    const void *const *argValues);
+
 // OpenCL 2.2
 
 cl_int CL_API_CALL clSetProgramReleaseCallback(
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,10 @@
 
 #include "opencl/source/utilities/logger.h"
 
-#define API_ENTER(retValPointer) \
-    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                                           \
+    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    static const uint32_t apiLatencyProfilerId = NEO::ApiLatencyProfiler::registerApi(__FUNCTION__);                                       \
+    NEO::ApiLatencyProfilerWrapper apiLatencyProfilerWrapperForSingleCall(apiLatencyProfilerId)
 
 #if KMD_PROFILING == 1
 #undef API_ENTER
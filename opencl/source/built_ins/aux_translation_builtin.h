@@ -27,8 +27,15 @@ class BuiltInOp<EBuiltInOps::AuxTranslation> : public BuiltinDispatchInfoBuilder
     template <typename GfxFamily>
     bool buildDispatchInfosForAuxTranslation(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
         size_t kernelInstanceNumber = 0;
+        // instances used by translation in same direction already dispatched keep their arguments
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            if (dispatchInfo.getKernel() && dispatchInfo.getKernel()->getAuxTranslationDirection() == operationParams.auxTranslationDirection) {
+                kernelInstanceNumber++;
+            }
+        }
+        const size_t firstKernelInstanceNumber = kernelInstanceNumber;
         size_t numKernelObjectsToTranslate = multiDispatchInfo.getKernelObjsForAuxTranslation()->size();
-        resizeKernelInstances(numKernelObjectsToTranslate);
+        resizeKernelInstances(firstKernelInstanceNumber + numKernelObjectsToTranslate);
         multiDispatchInfo.setBuiltinOpParams(operationParams);
 
         for (auto &kernelObj : *multiDispatchInfo.getKernelObjsForAuxTranslation()) {
@@ -36,11 +43,11 @@ class BuiltInOp<EBuiltInOps::AuxTranslation> : public BuiltinDispatchInfoBuilder
 
             UNRECOVERABLE_IF(builder.getMaxNumDispatches() != 1);
 
-            if (kernelInstanceNumber == 0) {
+            if (kernelInstanceNumber == firstKernelInstanceNumber) {
                 // Before Kernel
                 registerPipeControlProgramming<GfxFamily>(builder.getDispatchInfo(0).dispatchInitCommands, true);
             }
-            if (kernelInstanceNumber == numKernelObjectsToTranslate - 1) {
+            if (kernelInstanceNumber == firstKernelInstanceNumber + numKernelObjectsToTranslate - 1) {
                 // After Kernel
                 registerPipeControlProgramming<GfxFamily>(builder.getDispatchInfo(0).dispatchEpilogueCommands, false);
             }
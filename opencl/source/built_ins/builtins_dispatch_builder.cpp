@@ -53,6 +53,14 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
 
         uintptr_t middleSizeBytes = operationParams.size.x - leftSize - rightSize; // calc middle size
 
+        // small copy split into leftovers and middle region is dominated by walker overhead, copy it with single byte kernel
+        auto regionsCount = (leftSize > 0 ? 1 : 0) + (middleSizeBytes > 0 ? 1 : 0) + (rightSize > 0 ? 1 : 0);
+        if (operationParams.size.x < smallCopySizeThreshold && regionsCount > 1) {
+            leftSize = operationParams.size.x;
+            rightSize = 0;
+            middleSizeBytes = 0;
+        }
+
         // corner case - fully optimized kernel requires DWORD alignment. If we don't have it, run slower, misaligned kernel
         const auto srcMiddleStart = reinterpret_cast<uintptr_t>(operationParams.srcPtr) + operationParams.srcOffset.x + leftSize;
         const auto srcMisalignment = srcMiddleStart % sizeof(uint32_t);
@@ -115,6 +123,8 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
         return buildDispatchInfosTyped<uint32_t>(multiDispatchInfo);
     }
 
+    static constexpr size_t smallCopySizeThreshold = 2 * MemoryConstants::cacheLineSize;
+
   protected:
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
@@ -288,7 +298,9 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
         uintptr_t start = reinterpret_cast<uintptr_t>(operationParams.dstPtr) + operationParams.dstOffset.x;
 
         size_t middleAlignment = MemoryConstants::cacheLineSize;
-        size_t middleElSize = sizeof(uint32_t);
+        // middle region is cache line aligned, patterns of 16 bytes multiple can be stored with 16 byte writes
+        bool useWideMiddle = (operationParams.srcMemObj->getSize() % wideMiddleElSize) == 0;
+        size_t middleElSize = useWideMiddle ? wideMiddleElSize : sizeof(uint32_t);
 
         uintptr_t leftSize = start % middleAlignment;
         leftSize = (leftSize > 0) ? (middleAlignment - leftSize) : 0; // calc left leftover size
@@ -303,7 +315,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover->getKernel(clDevice.getRootDeviceIndex()));
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle->getKernel(clDevice.getRootDeviceIndex()));
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, (useWideMiddle ? kernMiddleWide : kernMiddle)->getKernel(clDevice.getRootDeviceIndex()));
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover->getKernel(clDevice.getRootDeviceIndex()));
 
         DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
@@ -344,9 +356,12 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
         return buildDispatchInfosTyped<uint32_t>(multiDispatchInfo);
     }
 
+    static constexpr size_t wideMiddleElSize = sizeof(uint32_t) * 4;
+
   protected:
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
+    MultiDeviceKernel *kernMiddleWide = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
 
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
@@ -356,6 +371,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
                      "",
                      "FillBufferLeftLeftover", kernLeftLeftover,
                      "FillBufferMiddle", kernMiddle,
+                     "FillBufferMiddleWide", kernMiddleWide,
                      "FillBufferRightLeftover", kernRightLeftover);
         }
     }
@@ -369,6 +385,7 @@ class BuiltInOp<EBuiltInOps::FillBufferStateless> : public BuiltInOp<EBuiltInOps
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferMiddleWide", kernMiddleWide,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfos) const override {
@@ -7,6 +7,7 @@
 
 #include "opencl/source/cl_device/cl_device.h"
 
+#include "shared/source/built_ins/sip.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device/sub_device.h"
@@ -18,8 +19,10 @@
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 
 #include "opencl/source/helpers/cl_hw_helper.h"
+#include "opencl/source/kernel/kernel_tuning_database.h"
 #include "opencl/source/platform/extensions.h"
 #include "opencl/source/platform/platform.h"
+#include "opencl/source/program/async_printf_processor.h"
 
 namespace NEO {
 
@@ -35,6 +38,13 @@ ClDevice::ClDevice(Device &device, Platform *platform) : device(device), platfor
     compilerExtensions = convertEnabledExtensionsToCompilerInternalOptions(deviceInfo.deviceExtensions, emptyOpenClCFeatures);
     compilerExtensionsWithFeatures = convertEnabledExtensionsToCompilerInternalOptions(deviceInfo.deviceExtensions, deviceInfo.openclCFeatures);
 
+    if (DebugManager.flags.KernelTuningDatabaseDir.get() != "unk") {
+        kernelTuningDatabase = std::make_unique<KernelTuningDatabase>(DebugManager.flags.KernelTuningDatabaseDir.get(), getHardwareInfo(), device.getNumAvailableDevices());
+    }
+    if (AsyncPrintfProcessor::isEnabled()) {
+        asyncPrintfProcessor = std::make_unique<AsyncPrintfProcessor>(*this);
+    }
+
     auto numAvailableDevices = device.getNumAvailableDevices();
     if (numAvailableDevices > 1) {
         for (uint32_t i = 0; i < numAvailableDevices; i++) {
@@ -62,6 +72,7 @@ ClDevice::ClDevice(Device &device, Platform *platform) : device(device), platfor
 }
 
 ClDevice::~ClDevice() {
+    asyncPrintfProcessor.reset();
 
     if (getSharedDeviceInfo().debuggerActive && getSourceLevelDebugger()) {
         getSourceLevelDebugger()->notifyDeviceDestruction();
@@ -143,6 +154,21 @@ GFXCORE_FAMILY ClDevice::getRenderCoreFamily() const { return device.getRenderCo
 PerformanceCounters *ClDevice::getPerformanceCounters() { return device.getPerformanceCounters(); }
 PreemptionMode ClDevice::getPreemptionMode() const { return device.getPreemptionMode(); }
 bool ClDevice::isDebuggerActive() const { return device.isDebuggerActive(); }
+
+bool ClDevice::ensureInitialized() {
+    auto rootClDevice = device.getRootDevice()->getSpecializedDevice<ClDevice>();
+    if (rootClDevice != this) {
+        return rootClDevice->ensureInitialized();
+    }
+    std::call_once(ensureInitializedOnce, [this] {
+        initialized = device.ensureDefaultEnginesInitialized();
+        // with deferred engines platform leaves SIP kernel creation to first context on device
+        if (initialized && Device::isEngineInitializationDeferred() && (getPreemptionMode() == PreemptionMode::MidThread || isDebuggerActive())) {
+            initialized = SipKernel::initSipKernel(SipKernel::getSipKernelType(device), device);
+        }
+    });
+    return initialized;
+}
 Debugger *ClDevice::getDebugger() { return device.getDebugger(); }
 SourceLevelDebugger *ClDevice::getSourceLevelDebugger() { return device.getSourceLevelDebugger(); }
 ExecutionEnvironment *ClDevice::getExecutionEnvironment() const { return device.getExecutionEnvironment(); }
@@ -21,12 +21,14 @@
 #include <vector>
 
 namespace NEO {
+class AsyncPrintfProcessor;
 class Debugger;
 class Device;
 class DriverInfo;
 class ExecutionEnvironment;
 class GmmHelper;
 class GmmClientContext;
+class KernelTuningDatabase;
 class MemoryManager;
 class PerformanceCounters;
 class Platform;
@@ -70,6 +72,7 @@ class ClDevice : public BaseObject<_cl_device_id> {
     EngineControl &getInternalEngine();
     EngineControl *getInternalCopyEngine();
     std::atomic<uint32_t> &getSelectorCopyEngine();
+    std::atomic<uint32_t> &getQueuePlacementCounter(EngineGroupType engineGroupType) { return queuePlacementCounters[static_cast<uint32_t>(engineGroupType)]; }
     MemoryManager *getMemoryManager() const;
     GmmHelper *getGmmHelper() const;
     GmmClientContext *getGmmClientContext() const;
@@ -80,6 +83,7 @@ class ClDevice : public BaseObject<_cl_device_id> {
     PerformanceCounters *getPerformanceCounters();
     PreemptionMode getPreemptionMode() const;
     bool isDebuggerActive() const;
+    bool ensureInitialized();
     Debugger *getDebugger();
     SourceLevelDebugger *getSourceLevelDebugger();
     ExecutionEnvironment *getExecutionEnvironment() const;
@@ -100,6 +104,7 @@ class ClDevice : public BaseObject<_cl_device_id> {
                                const void *&src,
                                size_t &srcSize,
                                size_t &retSize);
+    std::vector<cl_memory_usage_statistics_intel> getMemoryUsageStatistics() const;
 
     // This helper template is meant to simplify getDeviceInfo
     template <cl_device_info Param>
@@ -126,6 +131,8 @@ class ClDevice : public BaseObject<_cl_device_id> {
     MOCKABLE_VIRTUAL cl_command_queue_capabilities_intel getQueueFamilyCapabilities(EngineGroupType type);
     void getQueueFamilyName(char *outputName, size_t maxOutputNameLength, EngineGroupType type);
     Platform *getPlatform() const;
+    KernelTuningDatabase *getKernelTuningDatabase() const { return kernelTuningDatabase.get(); }
+    AsyncPrintfProcessor *getAsyncPrintfProcessor() const { return asyncPrintfProcessor.get(); }
 
   protected:
     void initializeCaps();
@@ -141,6 +148,8 @@ class ClDevice : public BaseObject<_cl_device_id> {
 
     std::string name;
     std::unique_ptr<DriverInfo> driverInfo;
+    std::unique_ptr<KernelTuningDatabase> kernelTuningDatabase;
+    std::unique_ptr<AsyncPrintfProcessor> asyncPrintfProcessor;
     unsigned int enabledClVersion = 0u;
     bool ocl21FeaturesEnabled = false;
     std::string deviceExtensions;
@@ -148,10 +157,14 @@ class ClDevice : public BaseObject<_cl_device_id> {
 
     ClDeviceInfo deviceInfo = {};
     std::once_flag initializeExtensionsWithVersionOnce;
+    std::once_flag ensureInitializedOnce;
+    bool initialized = false;
 
     std::vector<unsigned int> simultaneousInterops = {0};
     std::string compilerExtensions;
     std::string compilerExtensionsWithFeatures;
+
+    std::atomic<uint32_t> queuePlacementCounters[static_cast<uint32_t>(EngineGroupType::MaxEngineGroups)] = {};
 };
 
 } // namespace NEO
@@ -11,6 +11,7 @@
 #include "shared/source/device/device_info.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_time.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -68,6 +69,7 @@ cl_int ClDevice::getDeviceInfo(cl_device_info paramName,
     size_t value = 0u;
     ClDeviceInfoParam param{};
     const void *src = nullptr;
+    std::vector<cl_memory_usage_statistics_intel> memoryUsageStatistics;
 
     // clang-format off
     // please keep alphabetical order
@@ -286,6 +288,11 @@ cl_int ClDevice::getDeviceInfo(cl_device_info paramName,
         retSize = srcSize = sizeof(cl_device_feature_capabilities_intel);
         break;
     }
+    case CL_DEVICE_MEMORY_USAGE_STATISTICS_INTEL:
+        memoryUsageStatistics = getMemoryUsageStatistics();
+        src = memoryUsageStatistics.data();
+        retSize = srcSize = memoryUsageStatistics.size() * sizeof(cl_memory_usage_statistics_intel);
+        break;
     default:
         if (getDeviceInfoForImage(paramName, src, srcSize, retSize) && !getSharedDeviceInfo().imageSupport) {
             src = &value;
@@ -302,6 +309,22 @@ cl_int ClDevice::getDeviceInfo(cl_device_info paramName,
     return retVal;
 }
 
+std::vector<cl_memory_usage_statistics_intel> ClDevice::getMemoryUsageStatistics() const {
+    std::vector<cl_memory_usage_statistics_intel> memoryUsageStatistics;
+    auto &statistics = getMemoryManager()->getMemoryUsageStatistics(getRootDeviceIndex());
+    for (uint32_t typeIndex = 0u; typeIndex < MemoryUsageStatistics::allocationTypesCount; typeIndex++) {
+        for (uint32_t poolIndex = 0u; poolIndex < MemoryUsageStatistics::memoryPoolsCount; poolIndex++) {
+            auto counters = statistics.getCounters(static_cast<GraphicsAllocation::AllocationType>(typeIndex), poolIndex);
+            if (counters.allocationsCount == 0u) {
+                continue;
+            }
+            memoryUsageStatistics.push_back({typeIndex, poolIndex, counters.currentSize, counters.peakSize,
+                                             counters.currentCount, counters.allocationsCount, counters.freesCount});
+        }
+    }
+    return memoryUsageStatistics;
+}
+
 bool ClDevice::getDeviceInfoForImage(cl_device_info paramName,
                                      const void *&src,
                                      size_t &srcSize,
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/command_graph.h"
+
+#include "opencl/source/kernel/kernel.h"
+#include "opencl/source/program/kernel_info.h"
+
+namespace NEO {
+
+CommandGraph::~CommandGraph() {
+    // recorded command buffers and heaps go back to CSR storage before kernels are released
+    segments.clear();
+
+    for (auto &node : nodes) {
+        node.kernel->decRefInternal();
+    }
+}
+
+bool CommandGraph::isKernelSupported(Kernel &kernel) {
+    // kernels requiring per enqueue host side processing cannot be replayed from recorded commands
+    if (kernel.isParentKernel || kernel.hasPrintfOutput() || kernel.usesSyncBuffer() || kernel.isKernelDebugEnabled()) {
+        return false;
+    }
+    if (kernel.getKernelInfo().builtinDispatchBuilder != nullptr) {
+        return false;
+    }
+
+    kernel.updateAuxTranslationRequired();
+    return !kernel.isAuxTranslationRequired();
+}
+
+size_t CommandGraph::addNode(const Node &node) {
+    node.kernel->incRefInternal();
+    nodes.push_back(node);
+    return nodes.size() - 1;
+}
+
+CommandGraph::Segment &CommandGraph::addSegment(std::unique_ptr<Segment> &&segment) {
+    segments.push_back(std::move(segment));
+    return *segments.back();
+}
+
+CommandGraph::Segment *CommandGraph::getOpenSegment() {
+    if (segments.empty() || segments.back()->closed) {
+        return nullptr;
+    }
+    return segments.back().get();
+}
+
+bool CommandGraph::containsKernel(const Segment &segment, const Kernel &kernel) const {
+    for (auto nodeIndex : segment.nodeIndices) {
+        if (nodes[nodeIndex].kernel == &kernel) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace NEO
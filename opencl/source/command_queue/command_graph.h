@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "opencl/source/helpers/task_information.h"
+
+#include <memory>
+#include <vector>
+
+namespace NEO {
+class Kernel;
+
+// Kernels captured from in-order queue between begin and end of capture.
+// Commands and indirect heaps are programmed once into segments, replay submits each segment
+// as second level batch buffer, so dispatch is not rebuilt for every enqueue.
+class CommandGraph : NonCopyableOrMovableClass {
+  public:
+    struct Node {
+        Kernel *kernel = nullptr;
+        uint32_t workDim = 0;
+        size_t globalWorkOffset[3] = {};
+        size_t globalWorkSize[3] = {};
+        size_t localWorkSize[3] = {};
+        size_t enqueuedLocalWorkSize[3] = {};
+    };
+
+    struct Segment {
+        std::unique_ptr<KernelOperation> operation;
+        // heap space reserved by CSR (e.g. scratch surface state) has to be kept when segment is programmed again
+        size_t reservedDshSize = 0;
+        size_t reservedIohSize = 0;
+        size_t reservedSshSize = 0;
+        std::vector<size_t> nodeIndices;
+        PreemptionMode preemptionMode = PreemptionMode::Initial;
+        uint32_t numGrfRequired = 0;
+        bool specialPipelineSelectMode = false;
+        bool mediaSamplerRequired = false;
+        bool closed = false;
+    };
+
+    CommandGraph() = default;
+    ~CommandGraph();
+
+    static bool isKernelSupported(Kernel &kernel);
+
+    size_t addNode(const Node &node);
+    const Node &getNode(size_t nodeIndex) const { return nodes[nodeIndex]; }
+    size_t getNodesCount() const { return nodes.size(); }
+
+    Segment &addSegment(std::unique_ptr<Segment> &&segment);
+    Segment *getOpenSegment();
+    std::vector<std::unique_ptr<Segment>> &getSegments() { return segments; }
+
+    bool containsKernel(const Segment &segment, const Kernel &kernel) const;
+
+    uint32_t getLastReplayTaskCount() const { return lastReplayTaskCount; }
+    void setLastReplayTaskCount(uint32_t taskCount) { lastReplayTaskCount = taskCount; }
+
+  protected:
+    std::vector<Node> nodes;
+    std::vector<std::unique_ptr<Segment>> segments;
+    uint32_t lastReplayTaskCount = 0;
+};
+} // namespace NEO
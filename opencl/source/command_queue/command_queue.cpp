@@ -16,6 +16,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/memory_pool.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/api_intercept.h"
 #include "shared/source/utilities/tag_allocator.h"
@@ -32,8 +33,10 @@
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/mipmap.h"
 #include "opencl/source/helpers/queue_helpers.h"
+#include "opencl/source/kernel/kernel.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
+#include "opencl/source/program/async_printf_processor.h"
 #include "opencl/source/program/printf_handler.h"
 
 #include "CL/cl_ext.h"
@@ -75,6 +78,17 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
         gpgpuEngine = &device->getDefaultEngine();
         UNRECOVERABLE_IF(gpgpuEngine->getEngineType() >= aub_stream::EngineType::NUM_ENGINES);
 
+        cl_uint placementPolicy = context ? context->getQueuePlacementPolicy() : CL_QUEUE_PLACEMENT_DEFAULT_INTEL;
+        if (DebugManager.flags.OverrideQueuePlacementPolicy.get() != -1) {
+            placementPolicy = static_cast<cl_uint>(DebugManager.flags.OverrideQueuePlacementPolicy.get());
+        }
+        if (device->getNumAvailableDevices() > 1) {
+            placementPolicy = CL_QUEUE_PLACEMENT_DEFAULT_INTEL;
+        }
+        if (placementPolicy != CL_QUEUE_PLACEMENT_DEFAULT_INTEL) {
+            gpgpuEngine = selectEngineForPlacement(hwHelper.getEngineGroupType(gpgpuEngine->getEngineType(), hwInfo), gpgpuEngine, placementPolicy);
+        }
+
         bool bcsAllowed = hwInfo.capabilityTable.blitterOperationsSupported &&
                           hwHelper.isSubDeviceEngineSupported(hwInfo, device->getDeviceBitfield(), aub_stream::EngineType::ENGINE_BCS);
 
@@ -84,6 +98,9 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
         if (bcsAllowed) {
             auto &selectorCopyEngine = device->getDeviceById(0)->getSelectorCopyEngine();
             bcsEngine = &device->getDeviceById(0)->getEngine(EngineHelpers::getBcsEngineType(hwInfo, selectorCopyEngine), EngineUsage::Regular);
+            if (placementPolicy != CL_QUEUE_PLACEMENT_DEFAULT_INTEL) {
+                bcsEngine = selectEngineForPlacement(EngineGroupType::Copy, bcsEngine, placementPolicy);
+            }
         }
     }
 
@@ -92,6 +109,19 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
 }
 
 CommandQueue::~CommandQueue() {
+    for (auto &engineLane : engineLanes) {
+        if (engineLane.lastEvent) {
+            engineLane.lastEvent->decRefInternal();
+        }
+        engineLane.commandQueue->release();
+    }
+    if (engineLanesBarrierEvent) {
+        engineLanesBarrierEvent->decRefInternal();
+    }
+    for (auto &decompressedAuxObject : decompressedAuxObjects) {
+        static_cast<MemObj *>(decompressedAuxObject.object)->decRefInternal();
+    }
+
     if (virtualEvent) {
         UNRECOVERABLE_IF(this->virtualEvent->getCommandQueue() != this && this->virtualEvent->getCommandQueue() != nullptr);
         virtualEvent->decRefInternal();
@@ -166,16 +196,26 @@ bool CommandQueue::isCompleted(uint32_t gpgpuTaskCount, uint32_t bcsTaskCount) c
     return false;
 }
 
+QueueThrottlePolicy CommandQueue::getThrottlePolicy() const {
+    if (DebugManager.flags.EnableQueueThrottlePolicy.get() != 1) {
+        return {false, false, throttle == QueueThrottle::LOW};
+    }
+    return QueueThrottlePolicy::get(throttle);
+}
+
 void CommandQueue::waitUntilComplete(uint32_t gpgpuTaskCountToWait, uint32_t bcsTaskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) {
     WAIT_ENTER()
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Waiting for taskCount:", gpgpuTaskCountToWait);
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "Current taskCount:", getHwTag());
 
-    bool forcePowerSavingMode = this->throttle == QueueThrottle::LOW;
-
-    getGpgpuCommandStreamReceiver().waitForTaskCountWithKmdNotifyFallback(gpgpuTaskCountToWait, flushStampToWait,
-                                                                          useQuickKmdSleep, forcePowerSavingMode);
+    auto throttlePolicy = getThrottlePolicy();
+    if (throttlePolicy.pollingWait) {
+        getGpgpuCommandStreamReceiver().waitForCompletionWithTimeout(false, 0, gpgpuTaskCountToWait);
+    } else {
+        getGpgpuCommandStreamReceiver().waitForTaskCountWithKmdNotifyFallback(gpgpuTaskCountToWait, flushStampToWait,
+                                                                              useQuickKmdSleep, throttlePolicy.powerSavingWait);
+    }
     DEBUG_BREAK_IF(getHwTag() < gpgpuTaskCountToWait);
 
     if (gtpinIsGTPinInitialized()) {
@@ -258,6 +298,14 @@ LinearStream &CommandQueue::getCS(size_t minRequiredSize) {
     return *commandStream;
 }
 
+cl_int CommandQueue::beginCommandGraphCapture() {
+    if (isCommandGraphCaptureActive() || isOOQEnabled() || isCopyOnly || isProfilingEnabled()) {
+        return CL_INVALID_OPERATION;
+    }
+    commandGraphCapture = std::make_unique<CommandGraph>();
+    return CL_SUCCESS;
+}
+
 cl_int CommandQueue::enqueueAcquireSharedObjects(cl_uint numObjects, const cl_mem *memObjects, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *oclEvent, cl_uint cmdType) {
     if ((memObjects == nullptr && numObjects != 0) || (memObjects != nullptr && numObjects == 0)) {
         return CL_INVALID_VALUE;
@@ -402,7 +450,13 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
         return nullptr;
     }
 
-    if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
+    if (transferProperties.mapFlags == CL_MAP_WRITE_INVALIDATE_REGION) {
+        // mapped region is going to be overwritten, staging read of its current content is not needed
+        errcodeRet = enqueueMarkerWithWaitList(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+        if (errcodeRet == CL_SUCCESS && transferProperties.blocking) {
+            errcodeRet = finish();
+        }
+    } else if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
         auto buffer = castToObject<Buffer>(transferProperties.memObj);
         errcodeRet = enqueueReadBuffer(buffer, transferProperties.blocking, transferProperties.offset[0], transferProperties.size[0],
                                        returnPtr, transferProperties.memObj->getMapAllocation(getDevice().getRootDeviceIndex()), eventsRequest.numEventsInWaitList,
@@ -609,6 +663,29 @@ void CommandQueue::releaseIndirectHeap(IndirectHeap::Type heapType) {
     getGpgpuCommandStreamReceiver().releaseIndirectHeap(heapType);
 }
 
+std::unique_ptr<KernelOperation> CommandQueue::obtainBlockedCommandsData() {
+    auto allocationStorage = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
+    {
+        std::lock_guard<std::mutex> lock(blockedCommandsDataPoolMutex);
+        while (!blockedCommandsDataPool.empty()) {
+            auto blockedCommandsData = std::move(blockedCommandsDataPool.back());
+            blockedCommandsDataPool.pop_back();
+            if (blockedCommandsData->getAllocationStorage() == allocationStorage) {
+                return blockedCommandsData;
+            }
+        }
+    }
+    return std::make_unique<KernelOperation>(new LinearStream(), *allocationStorage);
+}
+
+void CommandQueue::releaseBlockedCommandsData(std::unique_ptr<KernelOperation> &&blockedCommandsData) {
+    blockedCommandsData->resetForReuse();
+    std::lock_guard<std::mutex> lock(blockedCommandsDataPoolMutex);
+    if (blockedCommandsDataPool.size() < maxPooledBlockedCommandsData) {
+        blockedCommandsDataPool.push_back(std::move(blockedCommandsData));
+    }
+}
+
 void CommandQueue::obtainNewTimestampPacketNodes(size_t numberOfNodes, TimestampPacketContainer &previousNodes, bool clearAllDependencies, bool blitEnqueue) {
     auto allocator = blitEnqueue ? getBcsCommandStreamReceiver()->getTimestampPacketAllocator()
                                  : getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
@@ -637,6 +714,14 @@ size_t CommandQueue::estimateTimestampPacketNodesCount(const MultiDispatchInfo &
     return nodesCount;
 }
 
+bool CommandQueue::hostPtrTransferInChunksAllowed(size_t size, GraphicsAllocation *mapAllocation, bool blitAllowed, cl_uint numEventsInWaitList) {
+    // transfers larger than staging buffer are streamed through staging buffers ring instead of pinning whole host range,
+    // chunks are ordered only by in-order queue so event of last chunk completes whole transfer
+    auto stagingBufferSize = DebugManager.flags.HostPtrStagingBufferSize.get();
+    return stagingBufferSize > 0 && size > static_cast<size_t>(stagingBufferSize) &&
+           !mapAllocation && !blitAllowed && numEventsInWaitList == 0 && !isOOQEnabled() && !isQueueBlocked();
+}
+
 bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                                         cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
 
@@ -665,6 +750,10 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
         return false;
     }
 
+    if (CL_COMMAND_READ_BUFFER == commandType && !debugVariableSet && isBlitterStagingPreferred(buffer, size)) {
+        return false;
+    }
+
     if (buffer->getMemoryManager() && buffer->getMemoryManager()->isCpuCopyRequired(ptr)) {
         return true;
     }
@@ -692,10 +781,86 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::isBlitterStagingPreferred(Buffer *buffer, size_t size) const {
+    if (DebugManager.flags.EnableBlitterStagingForLocalMemoryReads.get() == 0) {
+        return false;
+    }
+    // CPU reads through uncached local memory mapping are much slower than blitter copy into system memory
+    auto graphicsAllocation = buffer->getGraphicsAllocation(getDevice().getRootDeviceIndex());
+    return !MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool()) &&
+           blitEnqueueAllowed(CL_COMMAND_READ_BUFFER, size);
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || DebugManager.flags.OmitTimestampPacketDependencies.get();
 }
 
+CommandQueue::EngineLane *CommandQueue::obtainEngineLane(const Kernel &kernel, bool blocking) {
+    if (engineLanes.empty() || implicitScalingEnabled || blocking || kernel.isParentKernel) {
+        return nullptr;
+    }
+
+    // this queue serves as first lane
+    auto laneIndex = nextEngineLane++ % (engineLanes.size() + 1);
+    if (laneIndex == 0) {
+        return nullptr;
+    }
+    return &engineLanes[laneIndex - 1];
+}
+
+void CommandQueue::appendEngineLanesEvents(EngineLanesWaitList &waitList) const {
+    for (auto &engineLane : engineLanes) {
+        if (engineLane.lastEvent && !engineLane.lastEvent->updateStatusAndCheckCompletion()) {
+            waitList.push_back(engineLane.lastEvent);
+        }
+    }
+}
+
+void CommandQueue::storeEngineLaneEvent(Event *&trackedEvent, cl_event laneEvent, cl_event *outEvent) {
+    auto event = castToObjectOrAbort<Event>(laneEvent);
+    event->incRefInternal();
+    if (trackedEvent) {
+        trackedEvent->decRefInternal();
+    }
+    trackedEvent = event;
+
+    if (outEvent) {
+        *outEvent = laneEvent;
+    } else {
+        event->release();
+    }
+}
+
+bool CommandQueue::implicitScalingAllowed(Kernel &kernel, const MultiDispatchInfo &multiDispatchInfo, bool blocking) const {
+    if (!implicitScalingEnabled || blocking || multiDispatchInfo.size() != 1) {
+        return false;
+    }
+    // kernels requiring per enqueue host side processing are not split
+    if (kernel.isParentKernel || kernel.hasPrintfOutput() || kernel.usesSyncBuffer() || kernel.isKernelDebugEnabled()) {
+        return false;
+    }
+    return kernel.getKernelInfo().builtinDispatchBuilder == nullptr && !kernel.isAuxTranslationRequired();
+}
+
+bool CommandQueue::isAsyncPrintfAllowed(const MultiDispatchInfo &multiDispatchInfo) const {
+    // output of parent kernel includes blocks enqueued on device, it is printed after scheduler finishes
+    return device->getAsyncPrintfProcessor() != nullptr && multiDispatchInfo.peekParentKernel() == nullptr;
+}
+
+bool CommandQueue::sameCsrDependencyElisionAllowed(bool blockedQueue) const {
+    // blocked commands are flushed later, stall requested now would not precede them
+    return DebugManager.flags.EnableInOrderDependencyElision.get() == 1 && !isOOQEnabled() && !blockedQueue;
+}
+
+void CommandQueue::elideSameCsrDependencies(const TimestampPacketContainer &timestampPacketDependencies) {
+    if (timestampPacketDependencies.peekNodes().empty()) {
+        return;
+    }
+    // work submitted earlier to the same CSR is ordered on the ring, stalling once at next flush replaces per node semaphores
+    elidedTimestampPacketDependencies += timestampPacketDependencies.peekNodes().size();
+    getGpgpuCommandStreamReceiver().requestStallingPipeControlOnNextFlush();
+}
+
 bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
     auto blitterSupported = (getBcsCommandStreamReceiver() != nullptr);
 
@@ -720,6 +885,27 @@ bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
     }
 }
 
+bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType, size_t transferSize) const {
+    const auto sizeThreshold = DebugManager.flags.BlitterEnqueueSizeThreshold.get();
+    if (sizeThreshold == -1 || this->isCopyOnly || getBcsCommandStreamReceiver() == nullptr ||
+        DebugManager.flags.EnableBlitterForEnqueueOperations.get() == 0) {
+        return blitEnqueueAllowed(cmdType);
+    }
+
+    switch (cmdType) {
+    case CL_COMMAND_READ_BUFFER:
+    case CL_COMMAND_WRITE_BUFFER:
+    case CL_COMMAND_COPY_BUFFER:
+    case CL_COMMAND_READ_BUFFER_RECT:
+    case CL_COMMAND_WRITE_BUFFER_RECT:
+    case CL_COMMAND_COPY_BUFFER_RECT:
+    case CL_COMMAND_SVM_MEMCPY:
+        return transferSize >= static_cast<size_t>(sizeThreshold);
+    default:
+        return blitEnqueueAllowed(cmdType);
+    }
+}
+
 bool CommandQueue::blitEnqueuePreferred(cl_command_type cmdType, const BuiltinOpParams &builtinOpParams) const {
     bool isLocalToLocal = false;
 
@@ -841,6 +1027,36 @@ void CommandQueue::overrideEngine(aub_stream::EngineType engineType) {
     }
 }
 
+EngineControl *CommandQueue::selectEngineForPlacement(EngineGroupType engineGroupType, EngineControl *defaultEngine, cl_uint placementPolicy) {
+    auto &engineGroup = device->getDevice().getEngineGroups()[static_cast<uint32_t>(engineGroupType)];
+    const auto engineCount = static_cast<uint32_t>(engineGroup.size());
+    if (engineCount < 2) {
+        return defaultEngine;
+    }
+
+    auto selectedIndex = device->getQueuePlacementCounter(engineGroupType)++ % engineCount;
+    if (placementPolicy == CL_QUEUE_PLACEMENT_LEAST_BUSY_INTEL) {
+        // scan from the round-robin position, so queues created on idle engines are still spread
+        const auto startIndex = selectedIndex;
+        auto minTasksInFlight = std::numeric_limits<uint32_t>::max();
+        for (auto i = 0u; i < engineCount; i++) {
+            const auto engineIndex = (startIndex + i) % engineCount;
+            const auto csr = engineGroup[engineIndex].commandStreamReceiver;
+            const auto taskCount = csr->peekTaskCount();
+            // engine with deferred initialization has no tag yet and was never used
+            const auto completedTaskCount = csr->getTagAddress() ? *csr->getTagAddress() : taskCount;
+            const auto tasksInFlight = taskCount > completedTaskCount ? taskCount - completedTaskCount : 0u;
+            if (tasksInFlight < minTasksInFlight) {
+                minTasksInFlight = tasksInFlight;
+                selectedIndex = engineIndex;
+            }
+        }
+    }
+
+    UNRECOVERABLE_IF(!device->getDevice().ensureEngineInitialized(engineGroup[selectedIndex]));
+    return &engineGroup[selectedIndex];
+}
+
 void CommandQueue::aubCaptureHook(bool &blocking, bool &clearAllDependencies, const MultiDispatchInfo &multiDispatchInfo) {
     if (DebugManager.flags.AUBDumpSubCaptureMode.get()) {
         auto status = getGpgpuCommandStreamReceiver().checkAndActivateAubSubCapture(multiDispatchInfo);
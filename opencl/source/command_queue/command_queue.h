@@ -7,7 +7,9 @@
 
 #pragma once
 #include "shared/source/helpers/engine_control.h"
+#include "shared/source/utilities/stackvec.h"
 
+#include "opencl/source/command_queue/command_graph.h"
 #include "opencl/source/event/event.h"
 #include "opencl/source/helpers/base_object.h"
 #include "opencl/source/helpers/dispatch_info.h"
@@ -16,6 +18,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
 
 namespace NEO {
 class BarrierCommand;
@@ -90,6 +93,12 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     virtual cl_int enqueueBarrierWithWaitList(cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) = 0;
 
+    cl_int beginCommandGraphCapture();
+    bool isCommandGraphCaptureActive() const { return commandGraphCapture != nullptr; }
+    virtual std::unique_ptr<CommandGraph> endCommandGraphCapture() { return std::move(commandGraphCapture); }
+    virtual cl_int enqueueCommandGraph(CommandGraph &commandGraph, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) { return CL_INVALID_OPERATION; }
+    virtual cl_int updateCommandGraphKernel(CommandGraph &commandGraph, Kernel &kernel) { return CL_INVALID_OPERATION; }
+
     MOCKABLE_VIRTUAL void *enqueueMapBuffer(Buffer *buffer, cl_bool blockingMap,
                                             cl_map_flags mapFlags, size_t offset,
                                             size_t size, cl_uint numEventsInWaitList,
@@ -231,6 +240,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     Context *getContextPtr() const { return context; }
     EngineControl &getGpgpuEngine() const { return *gpgpuEngine; }
 
+    // queue exposed through API for events of commands dispatched to engine lanes
+    CommandQueue *getApiCommandQueue() { return laneOwner ? laneOwner : this; }
+    size_t getEngineLanesCount() const { return engineLanes.size(); }
+
     MOCKABLE_VIRTUAL LinearStream &getCS(size_t minRequiredSize);
     IndirectHeap &getIndirectHeap(IndirectHeap::Type heapType,
                                   size_t minRequiredSize);
@@ -240,6 +253,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     MOCKABLE_VIRTUAL void releaseIndirectHeap(IndirectHeap::Type heapType);
 
+    std::unique_ptr<KernelOperation> obtainBlockedCommandsData();
+    void releaseBlockedCommandsData(std::unique_ptr<KernelOperation> &&blockedCommandsData);
+
     void releaseVirtualEvent() {
         if (this->virtualEvent != nullptr) {
             this->virtualEvent->decRefInternal();
@@ -282,6 +298,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     QueueThrottle getThrottle() const {
         return throttle;
     }
+    QueueThrottlePolicy getThrottlePolicy() const;
 
     const TimestampPacketContainer *getTimestampPacketContainer() const {
         return timestampPacketContainer.get();
@@ -316,6 +333,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     void updateLatestSentEnqueueType(EnqueueProperties::Operation newEnqueueType) { this->latestSentEnqueueType = newEnqueueType; }
 
+    size_t peekElidedTimestampPacketDependencies() const { return elidedTimestampPacketDependencies; }
+
     // taskCount of last task
     uint32_t taskCount = 0;
 
@@ -348,11 +367,17 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void processProperties(const cl_queue_properties *properties);
     void processPropertiesExtra(const cl_queue_properties *properties);
     void overrideEngine(aub_stream::EngineType engineType);
+    EngineControl *selectEngineForPlacement(EngineGroupType engineGroupType, EngineControl *defaultEngine, cl_uint placementPolicy);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool isBlitterStagingPreferred(Buffer *buffer, size_t size) const;
+    bool hostPtrTransferInChunksAllowed(size_t size, GraphicsAllocation *mapAllocation, bool blitAllowed, cl_uint numEventsInWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
+    bool sameCsrDependencyElisionAllowed(bool blockedQueue) const;
+    void elideSameCsrDependencies(const TimestampPacketContainer &timestampPacketDependencies);
     bool blitEnqueueAllowed(cl_command_type cmdType) const;
+    bool blitEnqueueAllowed(cl_command_type cmdType, size_t transferSize) const;
     bool blitEnqueuePreferred(cl_command_type cmdType, const BuiltinOpParams &builtinOpParams) const;
     MOCKABLE_VIRTUAL bool blitEnqueueImageAllowed(const size_t *origin, const size_t *region);
     void aubCaptureHook(bool &blocking, bool &clearAllDependencies, const MultiDispatchInfo &multiDispatchInfo);
@@ -376,6 +401,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     EnqueueProperties::Operation latestSentEnqueueType = EnqueueProperties::Operation::None;
     uint64_t sliceCount = QueueSliceCount::defaultSliceCount;
     uint32_t bcsTaskCount = 0;
+    size_t elidedTimestampPacketDependencies = 0;
 
     bool perfCountersEnabled = false;
 
@@ -387,6 +413,35 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool requiresCacheFlushAfterWalker = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+    std::unique_ptr<CommandGraph> commandGraphCapture;
+
+    // operations of user event gated enqueues are recycled, their command stream allocations go back to CSR reuse list
+    static constexpr size_t maxPooledBlockedCommandsData = 8;
+    std::vector<std::unique_ptr<KernelOperation>> blockedCommandsDataPool;
+    std::mutex blockedCommandsDataPoolMutex;
+
+    // Out-of-order queue may dispatch independent kernels to internal in-order queues created on other engines
+    // of its engine group. Last event of each lane is kept to join lanes on barrier and marker without wait list.
+    struct EngineLane {
+        CommandQueue *commandQueue = nullptr;
+        Event *lastEvent = nullptr;
+    };
+    using EngineLanesWaitList = StackVec<cl_event, 16>;
+
+    EngineLane *obtainEngineLane(const Kernel &kernel, bool blocking);
+    void appendEngineLanesEvents(EngineLanesWaitList &waitList) const;
+    void storeEngineLaneEvent(Event *&trackedEvent, cl_event laneEvent, cl_event *outEvent);
+    bool implicitScalingAllowed(Kernel &kernel, const MultiDispatchInfo &multiDispatchInfo, bool blocking) const;
+    bool isAsyncPrintfAllowed(const MultiDispatchInfo &multiDispatchInfo) const;
+
+    std::vector<EngineLane> engineLanes;
+    Event *engineLanesBarrierEvent = nullptr;
+    CommandQueue *laneOwner = nullptr;
+    uint32_t nextEngineLane = 0;
+    // root device queue splitting single kernel across sub-devices uses engine lanes created on them
+    bool implicitScalingEnabled = false;
+    // buffers left decompressed by builtin aux translation, translated back once other operation needs them compressed
+    KernelObjsForAuxTranslation decompressedAuxObjects;
 };
 
 using CommandQueueCreateFunc = CommandQueue *(*)(Context *context, ClDevice *device, const cl_queue_properties *properties, bool internalUsage);
@@ -47,6 +47,9 @@ class CommandQueueHw : public CommandQueue {
             priority = QueuePriority::MEDIUM;
         } else if (clPriority & static_cast<cl_queue_priority_khr>(CL_QUEUE_PRIORITY_HIGH_KHR)) {
             priority = QueuePriority::HIGH;
+            if (Device::isHighPriorityEngineEnabled()) {
+                this->gpgpuEngine = &device->getDeviceById(0)->getEngine(getChosenEngineType(device->getHardwareInfo()), EngineUsage::HighPriority);
+            }
         }
 
         auto clThrottle = getCmdQueueProperties<cl_queue_throttle_khr>(properties, CL_QUEUE_THROTTLE_KHR);
@@ -84,6 +87,13 @@ class CommandQueueHw : public CommandQueue {
         if (bcsEngine) {
             bcsEngine->osContext->ensureContextInitialized();
         }
+
+        if (isOOQEnabled() && !internalUsage && DebugManager.flags.EnableOoqMultiEngineDispatch.get() == 1) {
+            createEngineLanes();
+        }
+        if (!internalUsage && DebugManager.flags.EnableImplicitScaling.get() == 1) {
+            createImplicitScalingLanes();
+        }
     }
 
     static CommandQueue *create(Context *context,
@@ -101,6 +111,13 @@ class CommandQueueHw : public CommandQueue {
                                       const cl_event *eventWaitList,
                                       cl_event *event) override;
 
+    std::unique_ptr<CommandGraph> endCommandGraphCapture() override;
+    cl_int enqueueCommandGraph(CommandGraph &commandGraph,
+                               cl_uint numEventsInWaitList,
+                               const cl_event *eventWaitList,
+                               cl_event *event) override;
+    cl_int updateCommandGraphKernel(CommandGraph &commandGraph, Kernel &kernel) override;
+
     cl_int enqueueCopyBuffer(Buffer *srcBuffer,
                              Buffer *dstBuffer,
                              size_t srcOffset,
@@ -424,9 +441,30 @@ class CommandQueueHw : public CommandQueue {
                                                             const cl_event *eventWaitList, cl_event *event);
     cl_int enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                               const cl_event *eventWaitList, cl_event *event);
+    cl_int enqueueReadWriteBufferInChunks(cl_command_type commandType, Buffer *buffer, cl_bool blocking,
+                                          size_t offset, size_t size, void *ptr, cl_event *event);
 
     MOCKABLE_VIRTUAL void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection);
+    bool isLazyAuxTranslationAllowed() const;
+    void splitKernelObjsForLazyAuxTranslation(const Kernel &kernel, const KernelObjsForAuxTranslation &kernelObjsForAuxTranslation,
+                                              KernelObjsForAuxTranslation &kernelObjsToDecompress, KernelObjsForAuxTranslation &kernelObjsToCompress);
+    void compressDecompressedAuxObjects();
     void setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo);
+    void createEngineLanes();
+
+    using ImplicitScalingChunks = StackVec<DispatchInfo, 4>;
+    void createImplicitScalingLanes();
+    static size_t splitForImplicitScaling(const DispatchInfo &dispatchInfo, size_t maxChunks, ImplicitScalingChunks &chunks);
+    template <uint32_t commandType, size_t surfaceCount>
+    bool dispatchWithImplicitScaling(Surface *(&surfaces)[surfaceCount], const MultiDispatchInfo &multiDispatchInfo,
+                                     cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+
+    cl_int captureKernelInCommandGraph(Kernel &kernel, uint32_t workDim, const size_t globalWorkOffset[3], const size_t globalWorkSize[3],
+                                       const size_t *localWorkSize, const size_t enqueuedLocalWorkSize[3]);
+    void buildCommandGraphDispatchInfo(const CommandGraph::Node &node, MultiDispatchInfo &multiDispatchInfo);
+    CommandGraph::Segment &obtainCommandGraphSegment(CommandGraph &commandGraph, const MultiDispatchInfo &multiDispatchInfo);
+    void dispatchCommandGraphNode(CommandGraph::Segment &segment, const MultiDispatchInfo &multiDispatchInfo);
+    void closeCommandGraphSegment(CommandGraph::Segment &segment);
 
     MOCKABLE_VIRTUAL bool forceStateless(size_t size);
 
@@ -443,12 +481,10 @@ class CommandQueueHw : public CommandQueue {
         if (isBlockedCommandStreamRequired(commandType, eventsRequest, blockedQueue)) {
             constexpr size_t additionalAllocationSize = CSRequirements::csOverfetchSize;
             constexpr size_t allocationSize = MemoryConstants::pageSize64k - CSRequirements::csOverfetchSize;
-            commandStream = new LinearStream();
-
-            auto &gpgpuCsr = getGpgpuCommandStreamReceiver();
-            gpgpuCsr.ensureCommandBufferAllocation(*commandStream, allocationSize, additionalAllocationSize);
+            blockedCommandsData = obtainBlockedCommandsData();
+            commandStream = blockedCommandsData->commandStream.get();
 
-            blockedCommandsData = std::make_unique<KernelOperation>(commandStream, *gpgpuCsr.getInternalAllocationStorage());
+            getGpgpuCommandStreamReceiver().ensureCommandBufferAllocation(*commandStream, allocationSize, additionalAllocationSize);
         } else {
             commandStream = &getCommandStream<GfxFamily, commandType>(*this, csrDependencies, profilingRequired, perfCountersRequired,
                                                                       blitEnqueue, multiDispatchInfo, surfaces, numSurfaces);
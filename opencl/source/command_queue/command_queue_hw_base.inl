@@ -9,6 +9,7 @@
 
 #include "opencl/source/built_ins/aux_translation_builtin.h"
 #include "opencl/source/command_queue/enqueue_barrier.h"
+#include "opencl/source/command_queue/enqueue_command_graph.h"
 #include "opencl/source/command_queue/enqueue_copy_buffer.h"
 #include "opencl/source/command_queue/enqueue_copy_buffer_rect.h"
 #include "opencl/source/command_queue/enqueue_copy_buffer_to_image.h"
@@ -16,6 +17,7 @@
 #include "opencl/source/command_queue/enqueue_copy_image_to_buffer.h"
 #include "opencl/source/command_queue/enqueue_fill_buffer.h"
 #include "opencl/source/command_queue/enqueue_fill_image.h"
+#include "opencl/source/command_queue/enqueue_implicit_scaling.h"
 #include "opencl/source/command_queue/enqueue_kernel.h"
 #include "opencl/source/command_queue/enqueue_marker.h"
 #include "opencl/source/command_queue/enqueue_migrate_mem_objects.h"
@@ -30,6 +32,8 @@
 #include "opencl/source/command_queue/flush.h"
 #include "opencl/source/command_queue/gpgpu_walker.h"
 
+#include <deque>
+
 namespace NEO {
 template <typename Family>
 void CommandQueueHw<Family>::notifyEnqueueReadBuffer(Buffer *buffer, bool blockingRead, bool notifyBcsCsr) {
@@ -84,6 +88,63 @@ cl_int CommandQueueHw<Family>::enqueueReadWriteBufferOnCpuWithoutMemoryTransfer(
     return retVal;
 }
 
+template <typename Family>
+cl_int CommandQueueHw<Family>::enqueueReadWriteBufferInChunks(cl_command_type commandType, Buffer *buffer, cl_bool blocking,
+                                                              size_t offset, size_t size, void *ptr, cl_event *event) {
+    struct PendingRead {
+        GraphicsAllocation *stagingBuffer;
+        size_t chunkOffset;
+        size_t chunkSize;
+        uint32_t taskCount;
+        FlushStamp flushStamp;
+    };
+    std::deque<PendingRead> pendingReads;
+    auto completeOldestRead = [&]() {
+        auto &read = pendingReads.front();
+        waitUntilComplete(read.taskCount, peekBcsTaskCount(), read.flushStamp, false);
+        memcpy_s(ptrOffset(ptr, read.chunkOffset), read.chunkSize, read.stagingBuffer->getUnderlyingBuffer(), read.chunkSize);
+        pendingReads.pop_front();
+    };
+
+    auto &csr = getGpgpuCommandStreamReceiver();
+    auto stagingBuffersLock = csr.obtainUniqueOwnership();
+    auto chunkSize = static_cast<size_t>(DebugManager.flags.HostPtrStagingBufferSize.get());
+
+    cl_int retVal = CL_SUCCESS;
+    for (size_t chunkOffset = 0; chunkOffset < size && retVal == CL_SUCCESS; chunkOffset += chunkSize) {
+        auto currentChunkSize = std::min(chunkSize, size - chunkOffset);
+        auto lastChunk = (chunkOffset + currentChunkSize == size);
+
+        // staging buffers are returned round robin, GPU copy of current chunk overlaps CPU copy of previous ones
+        auto stagingBuffer = csr.obtainStagingBuffer(currentChunkSize);
+        if (!stagingBuffer) {
+            retVal = CL_OUT_OF_RESOURCES;
+            break;
+        }
+        while (!pendingReads.empty() && pendingReads.front().stagingBuffer == stagingBuffer) {
+            completeOldestRead();
+        }
+        auto stagingPtr = stagingBuffer->getUnderlyingBuffer();
+
+        if (commandType == CL_COMMAND_WRITE_BUFFER) {
+            memcpy_s(stagingPtr, stagingBuffer->getUnderlyingBufferSize(), ptrOffset(ptr, chunkOffset), currentChunkSize);
+            retVal = enqueueWriteBuffer(buffer, lastChunk ? blocking : CL_FALSE, offset + chunkOffset, currentChunkSize, stagingPtr,
+                                        stagingBuffer, 0, nullptr, lastChunk ? event : nullptr);
+        } else {
+            retVal = enqueueReadBuffer(buffer, CL_FALSE, offset + chunkOffset, currentChunkSize, stagingPtr,
+                                       stagingBuffer, 0, nullptr, lastChunk ? event : nullptr);
+            pendingReads.push_back({stagingBuffer, chunkOffset, currentChunkSize, taskCount, flushStamp->peekStamp()});
+        }
+    }
+
+    if (retVal == CL_SUCCESS) {
+        while (!pendingReads.empty()) {
+            completeOldestRead();
+        }
+    }
+    return retVal;
+}
+
 template <typename Family>
 cl_int CommandQueueHw<Family>::enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                                                   const cl_event *eventWaitList, cl_event *event) {
@@ -121,6 +182,59 @@ void CommandQueueHw<Family>::dispatchAuxTranslationBuiltin(MultiDispatchInfo &mu
     auxTranslationBuilder.buildDispatchInfosForAuxTranslation<Family>(multiDispatchInfo, dispatchParams);
 }
 
+template <typename Family>
+bool CommandQueueHw<Family>::isLazyAuxTranslationAllowed() const {
+    // decompressed state is tracked per queue, so commands have to execute in submission order on single engine
+    return DebugManager.flags.EnableLazyAuxTranslation.get() == 1 && !isOOQEnabled() && engineLanes.empty() && laneOwner == nullptr &&
+           AuxTranslationMode::Builtin == HwHelperHw<Family>::getAuxTranslationMode(device->getHardwareInfo());
+}
+
+template <typename Family>
+void CommandQueueHw<Family>::splitKernelObjsForLazyAuxTranslation(const Kernel &kernel, const KernelObjsForAuxTranslation &kernelObjsForAuxTranslation,
+                                                                  KernelObjsForAuxTranslation &kernelObjsToDecompress, KernelObjsForAuxTranslation &kernelObjsToCompress) {
+    for (auto &kernelObj : kernelObjsForAuxTranslation) {
+        if (decompressedAuxObjects.find(kernelObj) == decompressedAuxObjects.end()) {
+            kernelObjsToDecompress.insert(kernelObj);
+        }
+    }
+
+    // buffers accessed statefully through aux surface have to be compressed again
+    for (uint32_t i = 0; i < kernel.getKernelArgsNumber(); i++) {
+        if (BUFFER_OBJ != kernel.getKernelArguments().at(i).type || kernel.getKernelArg(i) == nullptr) {
+            continue;
+        }
+        KernelObjForAuxTranslation kernelObj(KernelObjForAuxTranslation::Type::MEM_OBJ, castToObject<Buffer>(kernel.getKernelArg(i)));
+        if (kernelObjsForAuxTranslation.find(kernelObj) == kernelObjsForAuxTranslation.end() &&
+            decompressedAuxObjects.erase(kernelObj) != 0) {
+            kernelObjsToCompress.insert(kernelObj);
+        }
+    }
+}
+
+template <typename Family>
+void CommandQueueHw<Family>::compressDecompressedAuxObjects() {
+    if (decompressedAuxObjects.empty()) {
+        return;
+    }
+    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getClDevice());
+    BuiltInOwnershipWrapper builtInLock(builder, this->context);
+
+    KernelObjsForAuxTranslation kernelObjsToCompress;
+    kernelObjsToCompress.swap(decompressedAuxObjects);
+    if (kernelObjsToCompress.empty()) {
+        return;
+    }
+
+    MultiDispatchInfo multiDispatchInfo;
+    multiDispatchInfo.setKernelObjsForAuxTranslation(kernelObjsToCompress);
+    dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
+    enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(nullptr, 0, false, multiDispatchInfo, 0, nullptr, nullptr);
+
+    for (auto &kernelObj : kernelObjsToCompress) {
+        static_cast<MemObj *>(kernelObj.object)->decRefInternal();
+    }
+}
+
 template <typename Family>
 bool CommandQueueHw<Family>::forceStateless(size_t size) {
     return size >= 4ull * MemoryConstants::gigaByte;
@@ -169,6 +283,34 @@ bool CommandQueueHw<Family>::isGpgpuSubmissionForBcsRequired(bool queueBlocked)
     return required;
 }
 
+template <typename Family>
+void CommandQueueHw<Family>::createEngineLanes() {
+    auto &hwInfo = device->getHardwareInfo();
+    // lanes rely on timestamp packets to resolve dependencies between engines
+    if (!getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled() || priority == QueuePriority::LOW ||
+        device->getNumAvailableDevices() > 1 || device->getDevice().getDebugger()) {
+        return;
+    }
+
+    auto engineGroupType = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getEngineGroupType(gpgpuEngine->getEngineType(), hwInfo);
+    auto &engineGroup = device->getDevice().getEngineGroups()[static_cast<uint32_t>(engineGroupType)];
+
+    for (auto &engine : engineGroup) {
+        if (engine.commandStreamReceiver == gpgpuEngine->commandStreamReceiver) {
+            continue;
+        }
+        UNRECOVERABLE_IF(!device->getDevice().ensureEngineInitialized(engine));
+        auto laneQueue = new CommandQueueHw<Family>(context, device, nullptr, false);
+        laneQueue->gpgpuEngine = &engine;
+        laneQueue->laneOwner = this;
+        engine.osContext->ensureContextInitialized();
+
+        EngineLane engineLane;
+        engineLane.commandQueue = laneQueue;
+        engineLanes.push_back(engineLane);
+    }
+}
+
 template <typename Family>
 void CommandQueueHw<Family>::setupEvent(EventBuilder &eventBuilder, cl_event *outEvent, uint32_t cmdType) {
     if (outEvent) {
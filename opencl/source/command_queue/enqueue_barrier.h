@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,30 @@ cl_int CommandQueueHw<GfxFamily>::enqueueBarrierWithWaitList(
     cl_event *event) {
     NullSurface s;
     Surface *surfaces[] = {&s};
+
+    if (!engineLanes.empty()) {
+        auto commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+        TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+        // barrier without wait list covers commands dispatched to engine lanes too
+        EngineLanesWaitList barrierWaitList;
+        for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+            barrierWaitList.push_back(eventWaitList[i]);
+        }
+        if (numEventsInWaitList == 0) {
+            appendEngineLanesEvents(barrierWaitList);
+        }
+
+        cl_event barrierEvent = nullptr;
+        enqueueHandler<CL_COMMAND_BARRIER>(surfaces,
+                                           false,
+                                           MultiDispatchInfo(),
+                                           static_cast<cl_uint>(barrierWaitList.size()),
+                                           barrierWaitList.empty() ? nullptr : &barrierWaitList[0],
+                                           &barrierEvent);
+        storeEngineLaneEvent(engineLanesBarrierEvent, barrierEvent, event);
+        return CL_SUCCESS;
+    }
+
     enqueueHandler<CL_COMMAND_BARRIER>(surfaces,
                                        false,
                                        MultiDispatchInfo(),
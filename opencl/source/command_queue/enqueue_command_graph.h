@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_container/command_encoder.h"
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
+
+#include "opencl/source/command_queue/command_queue_hw.h"
+#include "opencl/source/command_queue/gpgpu_walker.h"
+#include "opencl/source/command_queue/hardware_interface.h"
+#include "opencl/source/event/event_builder.h"
+#include "opencl/source/helpers/dispatch_info_builder.h"
+#include "opencl/source/helpers/hardware_commands_helper.h"
+#include "opencl/source/helpers/task_information.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::captureKernelInCommandGraph(Kernel &kernel, uint32_t workDim, const size_t globalWorkOffset[3], const size_t globalWorkSize[3],
+                                                             const size_t *localWorkSize, const size_t enqueuedLocalWorkSize[3]) {
+    CommandGraph::Node node;
+    node.kernel = &kernel;
+    node.workDim = workDim;
+    for (auto dim = 0u; dim < 3; dim++) {
+        node.globalWorkOffset[dim] = globalWorkOffset[dim];
+        node.globalWorkSize[dim] = globalWorkSize[dim];
+        node.localWorkSize[dim] = localWorkSize ? localWorkSize[dim] : 0u;
+        node.enqueuedLocalWorkSize[dim] = enqueuedLocalWorkSize[dim];
+    }
+
+    MultiDispatchInfo multiDispatchInfo(&kernel);
+    buildCommandGraphDispatchInfo(node, multiDispatchInfo);
+    if (multiDispatchInfo.empty()) {
+        return CL_SUCCESS;
+    }
+
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    auto &segment = obtainCommandGraphSegment(*commandGraphCapture, multiDispatchInfo);
+    segment.nodeIndices.push_back(commandGraphCapture->addNode(node));
+    dispatchCommandGraphNode(segment, multiDispatchInfo);
+
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::buildCommandGraphDispatchInfo(const CommandGraph::Node &node, MultiDispatchInfo &multiDispatchInfo) {
+    DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder(getClDevice());
+    builder.setDispatchGeometry(node.workDim, node.globalWorkSize, node.enqueuedLocalWorkSize, node.globalWorkOffset, Vec3<size_t>{0, 0, 0}, node.localWorkSize);
+    builder.setKernel(node.kernel);
+    builder.bake(multiDispatchInfo);
+}
+
+template <typename GfxFamily>
+CommandGraph::Segment &CommandQueueHw<GfxFamily>::obtainCommandGraphSegment(CommandGraph &commandGraph, const MultiDispatchInfo &multiDispatchInfo) {
+    auto &kernel = *multiDispatchInfo.peekMainKernel();
+    auto numGrfRequired = static_cast<uint32_t>(kernel.getKernelInfo().kernelDescriptor.kernelAttributes.numGrfRequired);
+    auto specialPipelineSelectMode = kernel.requiresSpecialPipelineSelectMode();
+    auto mediaSamplerRequired = kernel.isVmeKernel();
+    auto preemptionMode = PreemptionHelper::taskPreemptionMode(getDevice(), multiDispatchInfo);
+
+    auto csSize = EnqueueOperation<GfxFamily>::getTotalSizeRequiredCS(CL_COMMAND_NDRANGE_KERNEL, CsrDependencies(), false, false, false, *this, multiDispatchInfo) +
+                  MemorySynchronizationCommands<GfxFamily>::getSizeForSinglePipeControl() +
+                  sizeof(typename GfxFamily::MI_BATCH_BUFFER_END);
+    auto dshSize = HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredDSH(multiDispatchInfo) + MemoryConstants::cacheLineSize;
+    auto iohSize = HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredIOH(multiDispatchInfo) + MemoryConstants::cacheLineSize;
+    auto sshSize = HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredSSH(multiDispatchInfo) + MemoryConstants::cacheLineSize;
+
+    auto segment = commandGraph.getOpenSegment();
+    if (segment) {
+        auto &operation = *segment->operation;
+        bool stateMatches = segment->numGrfRequired == numGrfRequired &&
+                            segment->specialPipelineSelectMode == specialPipelineSelectMode &&
+                            segment->mediaSamplerRequired == mediaSamplerRequired &&
+                            segment->preemptionMode == preemptionMode;
+        bool spaceAvailable = operation.commandStream->getAvailableSpace() >= csSize &&
+                              operation.dsh->getAvailableSpace() >= dshSize &&
+                              operation.ioh->getAvailableSpace() >= iohSize &&
+                              operation.ssh->getAvailableSpace() >= sshSize;
+        if (stateMatches && spaceAvailable) {
+            return *segment;
+        }
+        closeCommandGraphSegment(*segment);
+    }
+
+    auto &gpgpuCsr = getGpgpuCommandStreamReceiver();
+    auto commandStream = new LinearStream();
+    constexpr size_t additionalAllocationSize = CSRequirements::csOverfetchSize;
+    auto allocationSize = std::max(csSize, MemoryConstants::pageSize64k - CSRequirements::csOverfetchSize);
+    gpgpuCsr.ensureCommandBufferAllocation(*commandStream, allocationSize, additionalAllocationSize);
+
+    auto newSegment = std::make_unique<CommandGraph::Segment>();
+    newSegment->operation = std::make_unique<KernelOperation>(commandStream, *gpgpuCsr.getInternalAllocationStorage());
+
+    IndirectHeap *dsh = nullptr, *ioh = nullptr, *ssh = nullptr;
+    allocateHeapMemory(IndirectHeap::DYNAMIC_STATE, dshSize, dsh);
+    allocateHeapMemory(IndirectHeap::INDIRECT_OBJECT, iohSize, ioh);
+    allocateHeapMemory(IndirectHeap::SURFACE_STATE, sshSize, ssh);
+    newSegment->operation->setHeaps(dsh, ioh, ssh);
+
+    newSegment->reservedDshSize = dsh->getUsed();
+    newSegment->reservedIohSize = ioh->getUsed();
+    newSegment->reservedSshSize = ssh->getUsed();
+    newSegment->numGrfRequired = numGrfRequired;
+    newSegment->specialPipelineSelectMode = specialPipelineSelectMode;
+    newSegment->mediaSamplerRequired = mediaSamplerRequired;
+    newSegment->preemptionMode = preemptionMode;
+
+    return commandGraph.addSegment(std::move(newSegment));
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::dispatchCommandGraphNode(CommandGraph::Segment &segment, const MultiDispatchInfo &multiDispatchInfo) {
+    HardwareInterface<GfxFamily>::dispatchWalker(
+        *this,
+        multiDispatchInfo,
+        CsrDependencies(),
+        segment.operation.get(),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        CL_COMMAND_NDRANGE_KERNEL);
+
+    // nodes are not tracked with timestamp packets, in-order execution is kept with stall after each walker
+    MemorySynchronizationCommands<GfxFamily>::addPipeControlWithCSStallOnly(*segment.operation->commandStream);
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::closeCommandGraphSegment(CommandGraph::Segment &segment) {
+    auto bbEnd = segment.operation->commandStream->getSpaceForCmd<typename GfxFamily::MI_BATCH_BUFFER_END>();
+    *bbEnd = GfxFamily::cmdInitBatchBufferEnd;
+    segment.closed = true;
+}
+
+template <typename GfxFamily>
+std::unique_ptr<CommandGraph> CommandQueueHw<GfxFamily>::endCommandGraphCapture() {
+    if (commandGraphCapture) {
+        auto segment = commandGraphCapture->getOpenSegment();
+        if (segment) {
+            closeCommandGraphSegment(*segment);
+        }
+    }
+    return std::move(commandGraphCapture);
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueCommandGraph(CommandGraph &commandGraph,
+                                                      cl_uint numEventsInWaitList,
+                                                      const cl_event *eventWaitList,
+                                                      cl_event *event) {
+    if (isCommandGraphCaptureActive()) {
+        return CL_INVALID_OPERATION;
+    }
+    // recorded commands cannot be stored as blocked command, dependencies have to be resolvable at submission
+    if (isQueueBlocked() || getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList) == CompletionStamp::notReady) {
+        return CL_INVALID_OPERATION;
+    }
+
+    auto &gpgpuCsr = getGpgpuCommandStreamReceiver();
+    auto commandStreamReceiverOwnership = gpgpuCsr.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    EventBuilder eventBuilder;
+    setupEvent(eventBuilder, event, CL_COMMAND_NDRANGE_KERNEL);
+
+    auto blockQueue = false;
+    auto taskLevel = 0u;
+    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_NDRANGE_KERNEL);
+
+    EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+    TimestampPacketContainer barrierNodes;
+    CompletionStamp completionStamp = {CompletionStamp::notReady, taskLevel, 0};
+    bool firstSegment = true;
+
+    for (auto &segment : commandGraph.getSegments()) {
+        auto &operation = *segment->operation;
+        size_t csSize = sizeof(typename GfxFamily::MI_BATCH_BUFFER_START);
+        if (firstSegment) {
+            csSize += MemorySynchronizationCommands<GfxFamily>::getSizeForSinglePipeControl();
+        }
+        auto &commandStream = getCS(csSize);
+        auto commandStreamStart = commandStream.getUsed();
+
+        if (firstSegment) {
+            // previous enqueues are not waited for with timestamp packets
+            MemorySynchronizationCommands<GfxFamily>::addPipeControlWithCSStallOnly(commandStream);
+        }
+        EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferStart(&commandStream, operation.commandStream->getGraphicsAllocation()->getGpuAddress(), true);
+        gpgpuCsr.makeResident(*operation.commandStream->getGraphicsAllocation());
+
+        auto requiresCoherency = false;
+        auto anyUncacheableArgs = false;
+        auto usesSlm = false;
+        auto usePerDssBackedBuffer = false;
+        auto auxTranslationRequired = false;
+        auto useGlobalAtomics = false;
+        auto statelessWritesUsed = false;
+        uint32_t scratchSize = 0u;
+        uint32_t privateScratchSize = 0u;
+        Kernel *kernel = nullptr;
+
+        for (auto nodeIndex : segment->nodeIndices) {
+            if (kernel == commandGraph.getNode(nodeIndex).kernel) {
+                continue;
+            }
+            kernel = commandGraph.getNode(nodeIndex).kernel;
+            kernel->makeResident(gpgpuCsr);
+            requiresCoherency |= kernel->requiresCoherency();
+            anyUncacheableArgs |= kernel->hasUncacheableStatelessArgs();
+            usesSlm |= kernel->getSlmTotalSize() > 0;
+            usePerDssBackedBuffer |= kernel->requiresPerDssBackedBuffer();
+            auxTranslationRequired |= kernel->isAuxTranslationRequired();
+            useGlobalAtomics |= kernel->getKernelInfo().kernelDescriptor.kernelAttributes.flags.useGlobalAtomics;
+            statelessWritesUsed |= kernel->areStatelessWritesUsed();
+            scratchSize = std::max(scratchSize, kernel->getScratchSize());
+            privateScratchSize = std::max(privateScratchSize, kernel->getPrivateScratchSize());
+        }
+        gpgpuCsr.setRequiredScratchSizes(scratchSize, privateScratchSize);
+
+        auto allocNeedsFlushDC = false;
+        if (!device->isFullRangeSvm()) {
+            if (std::any_of(gpgpuCsr.getResidencyAllocations().begin(), gpgpuCsr.getResidencyAllocations().end(), [](const auto allocation) { return allocation->isFlushL3Required(); })) {
+                allocNeedsFlushDC = true;
+            }
+        }
+
+        DispatchFlags dispatchFlags(
+            {},                                                                 //csrDependencies
+            &barrierNodes,                                                      //barrierTimestampPacketNodes
+            {},                                                                 //pipelineSelectArgs
+            this->flushStamp->getStampReference(),                              //flushStampReference
+            getThrottle(),                                                      //throttle
+            segment->preemptionMode,                                            //preemptionMode
+            segment->numGrfRequired,                                            //numGrfRequired
+            L3CachingSettings::l3CacheOn,                                       //l3CacheSettings
+            kernel->getThreadArbitrationPolicy(),                               //threadArbitrationPolicy
+            kernel->getAdditionalKernelExecInfo(),                              //additionalKernelExecInfo
+            kernel->getExecutionType(),                                         //kernelExecutionType
+            gpgpuCsr.getMemoryCompressionState(auxTranslationRequired),         //memoryCompressionState
+            getSliceCount(),                                                    //sliceCount
+            false,                                                              //blocking
+            shouldFlushDC(CL_COMMAND_NDRANGE_KERNEL, nullptr) || allocNeedsFlushDC, //dcFlush
+            usesSlm,                                                            //useSLM
+            true,                                                               //guardCommandBufferWithPipeControl
+            true,                                                               //GSBA32BitRequired
+            requiresCoherency,                                                  //requiresCoherency
+            (QueuePriority::LOW == priority),                                   //lowPriority
+            false,                                                              //implicitFlush
+            !eventBuilder.getEvent() || gpgpuCsr.isNTo1SubmissionModelEnabled(), //outOfOrderExecutionAllowed
+            false,                                                              //epilogueRequired
+            usePerDssBackedBuffer,                                              //usePerDssBackedBuffer
+            kernel->isSingleSubdevicePreferred(),                               //useSingleSubdevice
+            useGlobalAtomics,                                                   //useGlobalAtomics
+            kernel->areMultipleSubDevicesInContext()                            //areMultipleSubDevicesInContext
+        );
+
+        dispatchFlags.pipelineSelectArgs.mediaSamplerRequired = segment->mediaSamplerRequired;
+        dispatchFlags.pipelineSelectArgs.specialPipelineSelectMode = segment->specialPipelineSelectMode;
+
+        if (firstSegment && gpgpuCsr.peekTimestampPacketWriteEnabled()) {
+            eventsRequest.fillCsrDependenciesForTimestampPacketContainer(dispatchFlags.csrDependencies, gpgpuCsr, CsrDependencies::DependenciesType::All);
+            dispatchFlags.csrDependencies.makeResident(gpgpuCsr);
+        }
+
+        if (anyUncacheableArgs) {
+            dispatchFlags.l3CacheSettings = L3CachingSettings::l3CacheOff;
+        } else if (!statelessWritesUsed) {
+            dispatchFlags.l3CacheSettings = L3CachingSettings::l3AndL1On;
+        }
+
+        if (this->dispatchHints != 0) {
+            dispatchFlags.engineHints = this->dispatchHints;
+            dispatchFlags.epilogueRequired = true;
+        }
+
+        completionStamp = gpgpuCsr.flushTask(
+            commandStream,
+            commandStreamStart,
+            *operation.dsh,
+            *operation.ioh,
+            *operation.ssh,
+            taskLevel,
+            dispatchFlags,
+            getDevice());
+        firstSegment = false;
+    }
+
+    if (!firstSegment) {
+        if (eventBuilder.getEvent()) {
+            eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+        }
+        this->latestSentEnqueueType = EnqueueProperties::Operation::GpuKernel;
+    } else {
+        completionStamp.taskCount = this->taskCount;
+        completionStamp.flushStamp = this->flushStamp->peekStamp();
+    }
+    updateFromCompletionStamp(completionStamp, eventBuilder.getEvent());
+    commandGraph.setLastReplayTaskCount(this->taskCount);
+
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::updateCommandGraphKernel(CommandGraph &commandGraph, Kernel &kernel) {
+    if (!CommandGraph::isKernelSupported(kernel)) {
+        return CL_INVALID_KERNEL;
+    }
+
+    // recorded commands may still be executed by previous replay
+    waitUntilComplete(commandGraph.getLastReplayTaskCount(), bcsTaskCount, this->flushStamp->peekStamp(), false);
+
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    for (auto &segment : commandGraph.getSegments()) {
+        if (!commandGraph.containsKernel(*segment, kernel)) {
+            continue;
+        }
+        auto &operation = *segment->operation;
+        operation.commandStream->replaceBuffer(operation.commandStream->getCpuBase(), operation.commandStream->getMaxAvailableSpace());
+
+        auto resetHeap = [](IndirectHeap &heap, size_t reservedSize) {
+            heap.replaceBuffer(heap.getCpuBase(), heap.getMaxAvailableSpace());
+            heap.getSpace(reservedSize);
+        };
+        resetHeap(*operation.dsh, segment->reservedDshSize);
+        resetHeap(*operation.ioh, segment->reservedIohSize);
+        resetHeap(*operation.ssh, segment->reservedSshSize);
+
+        for (auto nodeIndex : segment->nodeIndices) {
+            auto &node = commandGraph.getNode(nodeIndex);
+            MultiDispatchInfo multiDispatchInfo(node.kernel);
+            buildCommandGraphDispatchInfo(node, multiDispatchInfo);
+            dispatchCommandGraphNode(*segment, multiDispatchInfo);
+        }
+        closeCommandGraphSegment(*segment);
+    }
+
+    return CL_SUCCESS;
+}
+} // namespace NEO
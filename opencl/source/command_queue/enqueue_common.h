@@ -17,6 +17,7 @@
 #include "shared/source/program/sync_buffer_handler.h"
 #include "shared/source/program/sync_buffer_handler.inl"
 #include "shared/source/utilities/range.h"
+#include "shared/source/utilities/runtime_tracer.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
@@ -35,6 +36,7 @@
 #include "opencl/source/helpers/task_information.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
+#include "opencl/source/program/async_printf_processor.h"
 #include "opencl/source/program/block_kernel_manager.h"
 #include "opencl/source/program/printf_handler.h"
 
@@ -42,6 +44,7 @@
 
 #include <algorithm>
 #include <new>
+#include <string>
 
 namespace NEO {
 
@@ -58,11 +61,38 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
                                                cl_uint numEventsInWaitList,
                                                const cl_event *eventWaitList,
                                                cl_event *event) {
+    if (CL_COMMAND_NDRANGE_KERNEL == commandType) {
+        TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+        auto engineLane = obtainEngineLane(*kernel, blocking);
+        if (engineLane) {
+            // commands following barrier dispatched to other engines have to wait for it explicitly
+            EngineLanesWaitList laneWaitList;
+            for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+                laneWaitList.push_back(eventWaitList[i]);
+            }
+            if (engineLanesBarrierEvent) {
+                laneWaitList.push_back(engineLanesBarrierEvent);
+            }
+
+            cl_event laneEvent = nullptr;
+            auto laneQueue = static_cast<CommandQueueHw<GfxFamily> *>(engineLane->commandQueue);
+            laneQueue->template enqueueHandler<commandType>(surfaces, blocking, kernel, workDim, globalOffsets, workItems, localWorkSizesIn, enqueuedWorkSizes,
+                                                            static_cast<cl_uint>(laneWaitList.size()), laneWaitList.empty() ? nullptr : &laneWaitList[0], &laneEvent);
+            // lane engine may be in batched mode, other engines would wait for commands not submitted yet
+            laneQueue->flush();
+            storeEngineLaneEvent(engineLane->lastEvent, laneEvent, event);
+            return;
+        }
+    }
+
     BuiltInOwnershipWrapper builtInLock;
     KernelObjsForAuxTranslation kernelObjsForAuxTranslation;
+    KernelObjsForAuxTranslation kernelObjsToDecompress;
+    KernelObjsForAuxTranslation kernelObjsToCompress;
     MultiDispatchInfo multiDispatchInfo(kernel);
 
     auto auxTranslationMode = AuxTranslationMode::None;
+    auto lazyAuxTranslation = false;
 
     if (DebugManager.flags.ForceDispatchScheduler.get()) {
         forceDispatchScheduler(multiDispatchInfo);
@@ -78,7 +108,23 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
             }
         }
 
-        if (AuxTranslationMode::Builtin == auxTranslationMode) {
+        lazyAuxTranslation = (AuxTranslationMode::Builtin == auxTranslationMode || !decompressedAuxObjects.empty()) && isLazyAuxTranslationAllowed();
+
+        if (lazyAuxTranslation) {
+            auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getClDevice());
+            builtInLock.takeOwnership(builder, this->context);
+
+            // buffers left decompressed by previous kernels are not translated again
+            splitKernelObjsForLazyAuxTranslation(*kernel, kernelObjsForAuxTranslation, kernelObjsToDecompress, kernelObjsToCompress);
+            if (!kernelObjsToCompress.empty()) {
+                multiDispatchInfo.setKernelObjsForAuxTranslation(kernelObjsToCompress);
+                dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
+            }
+            if (!kernelObjsToDecompress.empty()) {
+                multiDispatchInfo.setKernelObjsForAuxTranslation(kernelObjsToDecompress);
+                dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::AuxToNonAux);
+            }
+        } else if (AuxTranslationMode::Builtin == auxTranslationMode) {
             auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getClDevice());
             builtInLock.takeOwnership(builder, this->context);
 
@@ -95,11 +141,35 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
             builder->buildDispatchInfos(multiDispatchInfo, kernel, workDim, workItems, enqueuedWorkSizes, globalOffsets);
 
             if (multiDispatchInfo.size() == 0) {
+                for (auto &kernelObj : kernelObjsToCompress) {
+                    static_cast<MemObj *>(kernelObj.object)->decRefInternal();
+                }
                 return;
             }
         }
 
-        if (AuxTranslationMode::Builtin == auxTranslationMode) {
+        if (lazyAuxTranslation) {
+            UNRECOVERABLE_IF(kernel->isParentKernel);
+            // buffers stay decompressed, unless returned event may be used to synchronize other queue with this kernel
+            KernelObjsForAuxTranslation kernelObjsToCompressAfterKernel;
+            for (auto &kernelObj : kernelObjsForAuxTranslation) {
+                if (kernelObj.type == KernelObjForAuxTranslation::Type::MEM_OBJ && event == nullptr) {
+                    if (decompressedAuxObjects.insert(kernelObj).second) {
+                        static_cast<MemObj *>(kernelObj.object)->incRefInternal();
+                    }
+                } else {
+                    kernelObjsToCompressAfterKernel.insert(kernelObj);
+                    if (decompressedAuxObjects.erase(kernelObj) != 0) {
+                        kernelObjsToCompress.insert(kernelObj);
+                    }
+                }
+            }
+            if (!kernelObjsToCompressAfterKernel.empty()) {
+                multiDispatchInfo.setKernelObjsForAuxTranslation(kernelObjsToCompressAfterKernel);
+                dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
+            }
+            multiDispatchInfo.setKernelObjsForAuxTranslation(kernelObjsForAuxTranslation);
+        } else if (AuxTranslationMode::Builtin == auxTranslationMode) {
             UNRECOVERABLE_IF(kernel->isParentKernel);
             dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
         }
@@ -109,7 +179,17 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
         setupBlitAuxTranslation(multiDispatchInfo);
     }
 
+    if (CL_COMMAND_NDRANGE_KERNEL == commandType && implicitScalingAllowed(*kernel, multiDispatchInfo, blocking)) {
+        if (dispatchWithImplicitScaling<commandType>(surfaces, multiDispatchInfo, numEventsInWaitList, eventWaitList, event)) {
+            return;
+        }
+    }
+
     enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
+
+    for (auto &kernelObj : kernelObjsToCompress) {
+        static_cast<MemObj *>(kernelObj.object)->decRefInternal();
+    }
 }
 
 template <typename GfxFamily>
@@ -150,6 +230,10 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                                                cl_uint numEventsInWaitList,
                                                const cl_event *eventWaitList,
                                                cl_event *event) {
+    RUNTIME_TRACE_SCOPE("enqueueHandler");
+    if (CL_COMMAND_NDRANGE_KERNEL != commandType) {
+        compressDecompressedAuxObjects();
+    }
     if (multiDispatchInfo.empty() && !isCommandWithoutKernel(commandType)) {
         enqueueHandler<CL_COMMAND_MARKER>(surfacesForResidency, numSurfaceForResidency, blocking, multiDispatchInfo,
                                           numEventsInWaitList, eventWaitList, event);
@@ -186,6 +270,16 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     enqueueHandlerHook(commandType, multiDispatchInfo);
 
+    if (getGpgpuCommandStreamReceiver().isGpuProgressWatchdogEnabled()) {
+        std::string description = "queue " + std::to_string(reinterpret_cast<uintptr_t>(this)) + " command " + std::to_string(commandType);
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            if (dispatchInfo.getKernel()) {
+                description += " " + dispatchInfo.getKernel()->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName;
+            }
+        }
+        getGpgpuCommandStreamReceiver().addSubmissionDescription(description);
+    }
+
     aubCaptureHook(blocking, clearAllDependencies, multiDispatchInfo);
 
     if (DebugManager.flags.MakeEachEnqueueBlocking.get()) {
@@ -204,7 +298,17 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     bool enqueueWithBlitAuxTranslation = isBlitAuxTranslationRequired(multiDispatchInfo);
 
     if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
-        eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
+        bool skipSameCsrSemaphores = sameCsrDependencyElisionAllowed(blockQueue) && !parentKernel && !enqueueWithBlitAuxTranslation;
+
+        if (skipSameCsrSemaphores) {
+            CsrDependencies sameCsrDeps;
+            eventsRequest.fillCsrDependenciesForTimestampPacketContainer(sameCsrDeps, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
+            for (auto timestampPacketDependency : sameCsrDeps.timestampPacketContainer) {
+                elideSameCsrDependencies(*timestampPacketDependency);
+            }
+        } else {
+            eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
+        }
         auto allocator = getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
 
         size_t nodesCount = 0u;
@@ -220,8 +324,16 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         }
 
         if (nodesCount > 0) {
-            obtainNewTimestampPacketNodes(nodesCount, timestampPacketDependencies.previousEnqueueNodes, clearAllDependencies, false);
-            csrDeps.timestampPacketContainer.push_back(&timestampPacketDependencies.previousEnqueueNodes);
+            auto &previousEnqueueNodes = timestampPacketDependencies.previousEnqueueNodes;
+            obtainNewTimestampPacketNodes(nodesCount, previousEnqueueNodes, clearAllDependencies, false);
+
+            // nodes of previous blit enqueue come from BCS allocator, wait for them is cross engine
+            bool previousEnqueueOnSameCsr = previousEnqueueNodes.peekNodes().empty() || previousEnqueueNodes.peekNodes()[0]->getAllocator() == allocator;
+            if (skipSameCsrSemaphores && previousEnqueueOnSameCsr) {
+                elideSameCsrDependencies(previousEnqueueNodes);
+            } else {
+                csrDeps.timestampPacketContainer.push_back(&previousEnqueueNodes);
+            }
         }
     }
 
@@ -255,6 +367,15 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     } else if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         if (CL_COMMAND_BARRIER == commandType) {
             getGpgpuCommandStreamReceiver().requestStallingPipeControlOnNextFlush();
+
+            if (!engineLanes.empty() && !blockQueue) {
+                // node written after stalling pipe control lets engine lanes wait for work done on this engine
+                timestampPacketDependencies.barrierNodes.add(getGpgpuCommandStreamReceiver().getTimestampPacketAllocator()->getTag());
+                if (eventBuilder.getEvent()) {
+                    eventBuilder.getEvent()->addTimestampPacketNodes(timestampPacketDependencies.barrierNodes);
+                }
+                flushDependenciesForNonKernelCommand = true;
+            }
         }
 
         for (size_t i = 0; i < eventsRequest.numEventsInWaitList; i++) {
@@ -341,7 +462,7 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
             if (eventBuilder.getEvent() && isProfilingEnabled()) {
                 TimeStampData submitTimeStamp;
-                this->getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
+                this->getDevice().getOSTime()->getCpuGpuTimeFromCorrelation(&submitTimeStamp, this->getDevice().getDeviceInfo().profilingTimerResolution);
                 eventBuilder.getEvent()->setSubmitTimeStamp(&submitTimeStamp);
                 eventBuilder.getEvent()->setSubmitTimeStamp();
                 eventBuilder.getEvent()->setStartTimeStamp();
@@ -378,6 +499,8 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     if (blocking) {
         waitUntilComplete(blockQueue, printfHandler.get());
+    } else if (printfHandler) {
+        device->getAsyncPrintfProcessor()->submit(std::move(printfHandler), getGpgpuCommandStreamReceiver(), completionStamp.taskCount);
     }
 }
 
@@ -470,13 +593,16 @@ BlitProperties CommandQueueHw<GfxFamily>::processDispatchForBlitEnqueue(const Mu
     if (!queueBlocked) {
         eventsRequest.fillCsrDependenciesForTimestampPacketContainer(blitProperties.csrDependencies, *blitCommandStreamReceiver,
                                                                      CsrDependencies::DependenciesType::All);
+        if (this->context->getRootDeviceIndices().size() > 1) {
+            eventsRequest.fillCsrDependenciesForTaskCountContainer(blitProperties.csrDependencies, *blitCommandStreamReceiver);
+        }
 
         blitProperties.csrDependencies.timestampPacketContainer.push_back(&timestampPacketDependencies.cacheFlushNodes);
         blitProperties.csrDependencies.timestampPacketContainer.push_back(&timestampPacketDependencies.previousEnqueueNodes);
         blitProperties.csrDependencies.timestampPacketContainer.push_back(&timestampPacketDependencies.barrierNodes);
     }
 
-    auto currentTimestampPacketNode = timestampPacketContainer->peekNodes().at(0);
+    auto currentTimestampPacketNode = timestampPacketContainer->peekNodes()[0];
     blitProperties.outputTimestampPacket = currentTimestampPacketNode;
 
     if (commandStream) {
@@ -558,7 +684,7 @@ void CommandQueueHw<GfxFamily>::processDispatchForCacheFlush(Surface **surfaces,
 
     uint64_t postSyncAddress = 0;
     if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
-        auto timestampPacketNodeForPostSync = timestampPacketContainer->peekNodes().at(0);
+        auto timestampPacketNodeForPostSync = timestampPacketContainer->peekNodes()[0];
         timestampPacketNodeForPostSync->setProfilingCapable(false);
         postSyncAddress = TimestampPacketHelper::getContextEndGpuAddress(*timestampPacketNodeForPostSync);
     }
@@ -679,10 +805,15 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
 
     UNRECOVERABLE_IF(multiDispatchInfo.empty());
 
-    auto implicitFlush = false;
+    auto implicitFlush = getThrottlePolicy().flushEverySubmission;
 
     if (printfHandler) {
-        blocking = true;
+        // output of async printf is printed after completion, enqueue is only flushed so it completes without further submissions
+        if (isAsyncPrintfAllowed(multiDispatchInfo)) {
+            implicitFlush = true;
+        } else {
+            blocking = true;
+        }
         printfHandler->makeResident(getGpgpuCommandStreamReceiver());
     }
 
@@ -986,7 +1117,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueCommandWithoutKernel(
     if (eventBuilder.getEvent() && isProfilingEnabled()) {
         TimeStampData submitTimeStamp;
 
-        getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
+        getDevice().getOSTime()->getCpuGpuTimeFromCorrelation(&submitTimeStamp, getDevice().getDeviceInfo().profilingTimerResolution);
         eventBuilder.getEvent()->setSubmitTimeStamp(&submitTimeStamp);
     }
 
@@ -1001,6 +1132,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueCommandWithoutKernel(
             surface->makeResident(getGpgpuCommandStreamReceiver());
         }
 
+        auto implicitFlush = (enqueueProperties.operation == EnqueueProperties::Operation::Blit) || getThrottlePolicy().flushEverySubmission;
         DispatchFlags dispatchFlags(
             {},                                                                  //csrDependencies
             &timestampPacketDependencies.barrierNodes,                           //barrierTimestampPacketNodes
@@ -1022,7 +1154,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueCommandWithoutKernel(
             false,                                                               //GSBA32BitRequired
             false,                                                               //requiresCoherency
             false,                                                               //lowPriority
-            (enqueueProperties.operation == EnqueueProperties::Operation::Blit), //implicitFlush
+            implicitFlush,                                                       //implicitFlush
             getGpgpuCommandStreamReceiver().isNTo1SubmissionModelEnabled(),      //outOfOrderExecutionAllowed
             false,                                                               //epilogueRequired
             false,                                                               //usePerDssBackedBuffer
@@ -1084,6 +1216,8 @@ size_t CommandQueueHw<GfxFamily>::calculateHostPtrSizeForImage(const size_t *reg
 template <typename GfxFamily>
 template <uint32_t cmdType>
 void CommandQueueHw<GfxFamily>::enqueueBlit(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking) {
+    compressDecompressedAuxObjects();
+
     auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
 
     EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
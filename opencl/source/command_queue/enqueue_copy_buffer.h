@@ -47,7 +47,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
     MemObjSurface s1(srcBuffer);
     MemObjSurface s2(dstBuffer);
     Surface *surfaces[] = {&s1, &s2};
-    auto blitAllowed = blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER);
+    auto blitAllowed = blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER, size);
     dispatchBcsOrGpgpuEnqueue<CL_COMMAND_COPY_BUFFER>(dispatchInfo, surfaces, eBuiltInOpsType, numEventsInWaitList, eventWaitList, event, false, blitAllowed);
 
     return CL_SUCCESS;
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
@@ -16,6 +17,7 @@
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/memory_manager/mem_obj_surface.h"
 
+#include <algorithm>
 #include <new>
 
 namespace NEO {
@@ -36,21 +38,18 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     auto commandStreamReceieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
     auto storageWithAllocations = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
     auto allocationType = GraphicsAllocation::AllocationType::FILL_PATTERN;
-    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(patternSize, allocationType).release();
+    constexpr size_t wideFillPatternSize = 4 * sizeof(uint32_t);
+    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(std::max(patternSize, wideFillPatternSize), allocationType).release();
     commandStreamReceieverOwnership.unlock();
 
     if (!patternAllocation) {
         patternAllocation = memoryManager->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), alignUp(patternSize, MemoryConstants::cacheLineSize), GraphicsAllocation::AllocationType::FILL_PATTERN, getDevice().getDeviceBitfield()});
     }
 
-    if (patternSize == 1) {
-        int patternInt = (uint32_t)((*(uint8_t *)pattern << 24) | (*(uint8_t *)pattern << 16) | (*(uint8_t *)pattern << 8) | *(uint8_t *)pattern);
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(int), &patternInt, sizeof(int));
-    } else if (patternSize == 2) {
-        int patternInt = (uint32_t)((*(uint16_t *)pattern << 16) | *(uint16_t *)pattern);
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(int), &patternInt, sizeof(int));
-    } else {
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), patternSize, pattern, patternSize);
+    // narrow patterns are replicated to 16 bytes, so middle region is filled with wide stores
+    auto patternSizeForFill = std::max(patternSize, wideFillPatternSize);
+    for (size_t patternOffset = 0; patternOffset < patternSizeForFill; patternOffset += patternSize) {
+        memcpy_s(ptrOffset(patternAllocation->getUnderlyingBuffer(), patternOffset), patternSize, pattern, patternSize);
     }
 
     auto eBuiltInOps = EBuiltInOps::FillBuffer;
@@ -67,7 +66,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     auto multiGraphicsAllocation = MultiGraphicsAllocation(getDevice().getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(patternAllocation);
 
-    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
+    MemObj patternMemObj(this->context, 0, {}, 0, 0, patternSizeForFill, patternAllocation->getUnderlyingBuffer(),
                          patternAllocation->getUnderlyingBuffer(), std::move(multiGraphicsAllocation), false, false, true);
     dc.srcMemObj = &patternMemObj;
     dc.dstMemObj = buffer;
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/timestamp_packet.h"
+
+#include "opencl/source/command_queue/command_queue_hw.h"
+#include "opencl/source/event/event.h"
+#include "opencl/source/helpers/dispatch_info.h"
+#include "opencl/source/memory_manager/mem_obj_surface.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::createImplicitScalingLanes() {
+    // chunks dispatched to sub-devices are joined with timestamp packets
+    if (!getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled() || isProfilingEnabled() ||
+        device->getNumAvailableDevices() < 2 || device->getDevice().getDebugger()) {
+        return;
+    }
+
+    for (uint32_t deviceId = 0; deviceId < device->getNumAvailableDevices(); deviceId++) {
+        auto laneQueue = new CommandQueueHw<GfxFamily>(context, device->getDeviceById(deviceId), nullptr, false);
+        laneQueue->laneOwner = this;
+
+        EngineLane engineLane;
+        engineLane.commandQueue = laneQueue;
+        engineLanes.push_back(engineLane);
+    }
+    implicitScalingEnabled = true;
+}
+
+template <typename GfxFamily>
+size_t CommandQueueHw<GfxFamily>::splitForImplicitScaling(const DispatchInfo &dispatchInfo, size_t maxChunks, ImplicitScalingChunks &chunks) {
+    size_t startOfWorkgroups[3] = {dispatchInfo.getStartOfWorkgroups().x, dispatchInfo.getStartOfWorkgroups().y, dispatchInfo.getStartOfWorkgroups().z};
+    size_t endOfWorkgroups[3] = {dispatchInfo.getNumberOfWorkgroups().x, dispatchInfo.getNumberOfWorkgroups().y, dispatchInfo.getNumberOfWorkgroups().z};
+
+    // outermost dimension gives each sub-device contiguous part of the range
+    int splitDim = static_cast<int>(dispatchInfo.getDim()) - 1;
+    while (splitDim >= 0 && endOfWorkgroups[splitDim] - startOfWorkgroups[splitDim] < 2) {
+        splitDim--;
+    }
+    if (splitDim < 0) {
+        return 0;
+    }
+
+    auto workgroupsInDim = endOfWorkgroups[splitDim] - startOfWorkgroups[splitDim];
+    auto chunksCount = std::min(maxChunks, workgroupsInDim);
+    auto chunkStart = startOfWorkgroups[splitDim];
+    for (size_t chunkId = 0; chunkId < chunksCount; chunkId++) {
+        auto chunkSize = workgroupsInDim / chunksCount + (chunkId < workgroupsInDim % chunksCount ? 1 : 0);
+
+        DispatchInfo chunk = dispatchInfo;
+        startOfWorkgroups[splitDim] = chunkStart;
+        endOfWorkgroups[splitDim] = chunkStart + chunkSize;
+        chunk.setStartOfWorkgroups(Vec3<size_t>(startOfWorkgroups));
+        chunk.setNumberOfWorkgroups(Vec3<size_t>(endOfWorkgroups));
+        chunks.push_back(chunk);
+
+        chunkStart += chunkSize;
+    }
+    return chunksCount;
+}
+
+template <typename GfxFamily>
+template <uint32_t commandType, size_t surfaceCount>
+bool CommandQueueHw<GfxFamily>::dispatchWithImplicitScaling(Surface *(&surfaces)[surfaceCount], const MultiDispatchInfo &multiDispatchInfo,
+                                                            cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    ImplicitScalingChunks chunks;
+    if (splitForImplicitScaling(*multiDispatchInfo.begin(), engineLanes.size(), chunks) < 2) {
+        return false;
+    }
+
+    NullSurface nullSurface;
+    Surface *markerSurfaces[] = {&nullSurface};
+
+    auto commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    EngineLanesWaitList chunkWaitList;
+    cl_event startEvent = nullptr;
+    if (isOOQEnabled()) {
+        for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+            chunkWaitList.push_back(eventWaitList[i]);
+        }
+        if (engineLanesBarrierEvent) {
+            chunkWaitList.push_back(engineLanesBarrierEvent);
+        }
+    } else {
+        // marker carries timestamp packets of previous enqueue, so every chunk keeps in-order semantics
+        enqueueHandler<CL_COMMAND_MARKER>(markerSurfaces, false, MultiDispatchInfo(), numEventsInWaitList, eventWaitList, &startEvent);
+        chunkWaitList.push_back(startEvent);
+    }
+
+    EngineLanesWaitList chunkEvents;
+    for (size_t chunkId = 0; chunkId < chunks.size(); chunkId++) {
+        MultiDispatchInfo chunkDispatchInfo(multiDispatchInfo.peekMainKernel());
+        chunkDispatchInfo.push(chunks[chunkId]);
+
+        cl_event chunkEvent = nullptr;
+        auto laneQueue = static_cast<CommandQueueHw<GfxFamily> *>(engineLanes[chunkId].commandQueue);
+        laneQueue->template enqueueHandler<commandType>(surfaces, surfaceCount, false, chunkDispatchInfo,
+                                                        static_cast<cl_uint>(chunkWaitList.size()), &chunkWaitList[0], &chunkEvent);
+        // chunks have to run concurrently, batched sub-device submission would serialize them on join
+        laneQueue->flush();
+        chunkEvents.push_back(chunkEvent);
+    }
+
+    if (event) {
+        // marker waits for all chunks on this engine, so the event completes once whole range is done
+        enqueueHandler<CL_COMMAND_MARKER>(markerSurfaces, false, MultiDispatchInfo(), static_cast<cl_uint>(chunkEvents.size()), &chunkEvents[0], event);
+        castToObjectOrAbort<Event>(*event)->setCmdType(commandType);
+    }
+
+    if (!isOOQEnabled()) {
+        TimestampPacketContainer previousNodes;
+        previousNodes.swapNodes(*timestampPacketContainer);
+        for (auto chunkEvent : chunkEvents) {
+            timestampPacketContainer->assignAndIncrementNodesRefCounts(*castToObjectOrAbort<Event>(chunkEvent)->getTimestampPacketNodes());
+        }
+        castToObjectOrAbort<Event>(startEvent)->release();
+    }
+
+    for (size_t chunkId = 0; chunkId < chunkEvents.size(); chunkId++) {
+        storeEngineLaneEvent(engineLanes[chunkId].lastEvent, chunkEvents[chunkId], nullptr);
+    }
+    return true;
+}
+} // namespace NEO
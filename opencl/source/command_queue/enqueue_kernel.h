@@ -135,6 +135,13 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         return CL_INVALID_WORK_GROUP_SIZE;
     }
 
+    if (isCommandGraphCaptureActive()) {
+        if (event || numEventsInWaitList > 0 || !CommandGraph::isKernelSupported(kernel)) {
+            return CL_INVALID_OPERATION;
+        }
+        return captureKernelInCommandGraph(kernel, workDim, globalWorkOffset, region, localWkgSizeToPass, enqueuedLocalWorkSize);
+    }
+
     enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(
         surfaces,
         false,
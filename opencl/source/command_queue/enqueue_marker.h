@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,22 @@ cl_int CommandQueueHw<GfxFamily>::enqueueMarkerWithWaitList(
 
     NullSurface s;
     Surface *surfaces[] = {&s};
+
+    if (numEventsInWaitList == 0 && !engineLanes.empty()) {
+        // marker without wait list waits for commands dispatched to engine lanes too
+        EngineLanesWaitList markerWaitList;
+        appendEngineLanesEvents(markerWaitList);
+        if (!markerWaitList.empty()) {
+            enqueueHandler<CL_COMMAND_MARKER>(surfaces,
+                                              false,
+                                              MultiDispatchInfo(),
+                                              static_cast<cl_uint>(markerWaitList.size()),
+                                              &markerWaitList[0],
+                                              event);
+            return CL_SUCCESS;
+        }
+    }
+
     enqueueHandler<CL_COMMAND_MARKER>(surfaces,
                                       false,
                                       MultiDispatchInfo(),
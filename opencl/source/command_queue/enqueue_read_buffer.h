@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/helpers/engine_node_helper.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -36,7 +37,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     cl_event *event) {
 
     const cl_command_type cmdType = CL_COMMAND_READ_BUFFER;
-    auto blitAllowed = blitEnqueueAllowed(cmdType);
+    auto blitAllowed = blitEnqueueAllowed(cmdType, size);
     auto &csr = getCommandStreamReceiver(blitAllowed);
 
     if (nullptr == mapAllocation) {
@@ -79,6 +80,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    // staged read copies data out of staging buffers on CPU, so it has to wait for GPU anyway
+    if (blockingRead && hostPtrTransferInChunksAllowed(size, mapAllocation, blitAllowed, numEventsInWaitList)) {
+        return enqueueReadWriteBufferInChunks(cmdType, buffer, blockingRead, offset, size, ptr, event);
+    }
+
     auto eBuiltInOps = EBuiltInOps::CopyBufferToBuffer;
     if (forceStateless(buffer->getSize())) {
         eBuiltInOps = EBuiltInOps::CopyBufferToBufferStateless;
@@ -91,7 +97,21 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     GeneralSurface mapSurface;
     Surface *surfaces[] = {&bufferSurf, nullptr};
 
-    if (mapAllocation) {
+    std::unique_lock<CommandStreamReceiver::MutexType> stagingBufferLock;
+    GraphicsAllocation *stagingBuffer = nullptr;
+    if (!mapAllocation && !blitAllowed && blockingRead && size != 0 && numEventsInWaitList == 0 && !isQueueBlocked()) {
+        stagingBufferLock = csr.obtainUniqueOwnership();
+        stagingBuffer = csr.obtainStagingBuffer(size);
+        if (!stagingBuffer) {
+            stagingBufferLock.unlock();
+        }
+    }
+
+    if (stagingBuffer) {
+        surfaces[1] = &mapSurface;
+        mapSurface.setGraphicsAllocation(stagingBuffer);
+        dstPtr = reinterpret_cast<void *>(stagingBuffer->getGpuAddress());
+    } else if (mapAllocation) {
         surfaces[1] = &mapSurface;
         mapSurface.setGraphicsAllocation(mapAllocation);
         //get offset between base cpu ptr of map allocation and dst ptr
@@ -118,7 +138,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     dc.srcMemObj = buffer;
     dc.srcOffset = {offset, 0, 0};
     dc.size = {size, 0, 0};
-    dc.transferAllocation = mapAllocation ? mapAllocation : hostPtrSurf.getAllocation();
+    if (stagingBuffer) {
+        dc.transferAllocation = stagingBuffer;
+    } else {
+        dc.transferAllocation = mapAllocation ? mapAllocation : hostPtrSurf.getAllocation();
+    }
 
     MultiDispatchInfo dispatchInfo(dc);
 
@@ -130,6 +154,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     }
     dispatchBcsOrGpgpuEnqueue<CL_COMMAND_READ_BUFFER>(dispatchInfo, surfaces, eBuiltInOps, numEventsInWaitList, eventWaitList, event, blockingRead, blitAllowed);
 
+    if (stagingBuffer) {
+        memcpy_s(ptr, size, stagingBuffer->getUnderlyingBuffer(), size);
+    }
+
     return CL_SUCCESS;
 }
 } // namespace NEO
@@ -59,7 +59,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBufferRect(
     MemObjSurface bufferSurf(buffer);
     HostPtrSurface hostPtrSurf(dstPtr, hostPtrSize);
     Surface *surfaces[] = {&bufferSurf, &hostPtrSurf};
-    auto blitAllowed = blitEnqueueAllowed(cmdType);
+    auto blitAllowed = blitEnqueueAllowed(cmdType, region[0] * region[1] * region[2]);
 
     if (region[0] != 0 &&
         region[1] != 0 &&
@@ -331,7 +331,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
         GeneralSurface srcSvmSurf(srcSvmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex));
         HostPtrSurface dstHostPtrSurf(dstPtr, size);
         cmdType = CL_COMMAND_READ_BUFFER;
-        auto blitAllowed = blitEnqueueAllowed(cmdType);
+        auto blitAllowed = blitEnqueueAllowed(cmdType, size);
         if (size != 0) {
             auto &csr = getCommandStreamReceiver(blitAllowed);
             bool status = csr.createAllocationForHostSurface(dstHostPtrSurf, true);
@@ -352,7 +352,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
         HostPtrSurface srcHostPtrSurf(const_cast<void *>(srcPtr), size);
         GeneralSurface dstSvmSurf(dstSvmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex));
         cmdType = CL_COMMAND_WRITE_BUFFER;
-        auto blitAllowed = blitEnqueueAllowed(cmdType);
+        auto blitAllowed = blitEnqueueAllowed(cmdType, size);
         if (size != 0) {
             auto &csr = getCommandStreamReceiver(blitAllowed);
             bool status = csr.createAllocationForHostSurface(srcHostPtrSurf, false);
@@ -378,14 +378,14 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
         surfaces[1] = &dstSvmSurf;
 
         dispatchInfo.setBuiltinOpParams(operationParams);
-        auto blitAllowed = blitEnqueueAllowed(CL_COMMAND_SVM_MEMCPY);
+        auto blitAllowed = blitEnqueueAllowed(CL_COMMAND_SVM_MEMCPY, size);
         dispatchBcsOrGpgpuEnqueue<CL_COMMAND_SVM_MEMCPY>(dispatchInfo, surfaces, builtInType, numEventsInWaitList, eventWaitList, event, blockingCopy, blitAllowed);
 
     } else {
         HostPtrSurface srcHostPtrSurf(const_cast<void *>(srcPtr), size);
         HostPtrSurface dstHostPtrSurf(dstPtr, size);
         cmdType = CL_COMMAND_WRITE_BUFFER;
-        auto blitAllowed = blitEnqueueAllowed(cmdType);
+        auto blitAllowed = blitEnqueueAllowed(cmdType, size);
         if (size != 0) {
             auto &csr = getCommandStreamReceiver(blitAllowed);
             bool status = csr.createAllocationForHostSurface(srcHostPtrSurf, false);
@@ -507,6 +507,17 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMigrateMem(cl_uint numSvmPointers,
                                                        cl_uint numEventsInWaitList,
                                                        const cl_event *eventWaitList,
                                                        cl_event *event) {
+    auto pageFaultManager = context->getMemoryManager()->getPageFaultManager();
+    if (pageFaultManager && !isValueSet(flags, CL_MIGRATE_MEM_OBJECT_HOST)) {
+        auto rootDeviceIndex = getDevice().getRootDeviceIndex();
+        for (cl_uint i = 0; i < numSvmPointers; i++) {
+            auto svmData = context->getSVMAllocsManager()->getSVMAlloc(svmPointers[i]);
+            if (svmData && svmData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(svmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex)->getGpuAddress()));
+            }
+        }
+    }
+
     NullSurface s;
     Surface *surfaces[] = {&s};
 
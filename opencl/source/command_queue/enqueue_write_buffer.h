@@ -71,6 +71,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    auto blitAllowed = blitEnqueueAllowed(cmdType, size);
+    if (hostPtrTransferInChunksAllowed(size, mapAllocation, blitAllowed, numEventsInWaitList)) {
+        return enqueueReadWriteBufferInChunks(cmdType, buffer, blockingWrite, offset, size, const_cast<void *>(ptr), event);
+    }
+
     auto eBuiltInOps = EBuiltInOps::CopyBufferToBuffer;
     if (forceStateless(buffer->getSize())) {
         eBuiltInOps = EBuiltInOps::CopyBufferToBufferStateless;
@@ -82,9 +87,24 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
     MemObjSurface bufferSurf(buffer);
     GeneralSurface mapSurface;
     Surface *surfaces[] = {&bufferSurf, nullptr};
-    auto blitAllowed = blitEnqueueAllowed(cmdType);
 
-    if (mapAllocation) {
+    std::unique_lock<CommandStreamReceiver::MutexType> stagingBufferLock;
+    GraphicsAllocation *stagingBuffer = nullptr;
+    if (!mapAllocation && !blitAllowed && size != 0 && numEventsInWaitList == 0 && !isQueueBlocked()) {
+        stagingBufferLock = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+        stagingBuffer = getGpgpuCommandStreamReceiver().obtainStagingBuffer(size);
+        if (stagingBuffer) {
+            memcpy_s(stagingBuffer->getUnderlyingBuffer(), stagingBuffer->getUnderlyingBufferSize(), ptr, size);
+        } else {
+            stagingBufferLock.unlock();
+        }
+    }
+
+    if (stagingBuffer) {
+        surfaces[1] = &mapSurface;
+        mapSurface.setGraphicsAllocation(stagingBuffer);
+        srcPtr = reinterpret_cast<void *>(stagingBuffer->getGpuAddress());
+    } else if (mapAllocation) {
         surfaces[1] = &mapSurface;
         mapSurface.setGraphicsAllocation(mapAllocation);
         //get offset between base cpu ptr of map allocation and dst ptr
@@ -113,7 +133,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
     dc.dstMemObj = buffer;
     dc.dstOffset = {offset, 0, 0};
     dc.size = {size, 0, 0};
-    dc.transferAllocation = mapAllocation ? mapAllocation : hostPtrSurf.getAllocation();
+    if (stagingBuffer) {
+        dc.transferAllocation = stagingBuffer;
+    } else {
+        dc.transferAllocation = mapAllocation ? mapAllocation : hostPtrSurf.getAllocation();
+    }
 
     MultiDispatchInfo dispatchInfo(dc);
     dispatchBcsOrGpgpuEnqueue<CL_COMMAND_WRITE_BUFFER>(dispatchInfo, surfaces, eBuiltInOps, numEventsInWaitList, eventWaitList, event, blockingWrite, blitAllowed);
@@ -58,7 +58,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBufferRect(
     MemObjSurface dstBufferSurf(buffer);
     HostPtrSurface hostPtrSurf(srcPtr, hostPtrSize, true);
     Surface *surfaces[] = {&dstBufferSurf, &hostPtrSurf};
-    auto blitAllowed = blitEnqueueAllowed(cmdType);
+    auto blitAllowed = blitEnqueueAllowed(cmdType, region[0] * region[1] * region[2]);
 
     if (region[0] != 0 &&
         region[1] != 0 &&
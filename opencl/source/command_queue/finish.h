@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,11 +9,13 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
+#include "opencl/source/program/async_printf_processor.h"
 
 namespace NEO {
 
 template <typename GfxFamily>
 cl_int CommandQueueHw<GfxFamily>::finish() {
+    compressDecompressedAuxObjects();
     auto result = getGpgpuCommandStreamReceiver().flushBatchedSubmissions();
     if (!result) {
         return CL_OUT_OF_RESOURCES;
@@ -29,6 +31,19 @@ cl_int CommandQueueHw<GfxFamily>::finish() {
     // Stall until HW reaches CQ taskCount
     waitUntilComplete(taskCountToWaitFor, this->bcsTaskCount, flushStampToWaitFor, false);
 
+    for (auto &engineLane : engineLanes) {
+        auto laneResult = engineLane.commandQueue->finish();
+        if (laneResult != CL_SUCCESS) {
+            return laneResult;
+        }
+    }
+
+    // output of printf kernels completed by this finish is printed before returning to application
+    auto asyncPrintfProcessor = getClDevice().getAsyncPrintfProcessor();
+    if (asyncPrintfProcessor) {
+        asyncPrintfProcessor->printCompletedOutputs();
+    }
+
     return CL_SUCCESS;
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,12 @@
 namespace NEO {
 template <typename GfxFamily>
 cl_int CommandQueueHw<GfxFamily>::flush() {
+    compressDecompressedAuxObjects();
+    for (auto &engineLane : engineLanes) {
+        if (engineLane.commandQueue->flush() != CL_SUCCESS) {
+            return CL_OUT_OF_RESOURCES;
+        }
+    }
     return getGpgpuCommandStreamReceiver().flushBatchedSubmissions() ? CL_SUCCESS : CL_OUT_OF_RESOURCES;
 }
 } // namespace NEO
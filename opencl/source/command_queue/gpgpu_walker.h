@@ -67,6 +67,13 @@ Vec3<size_t> computeWorkgroupSize(
 Vec3<size_t> generateWorkgroupSize(
     const DispatchInfo &dispatchInfo);
 
+void computeWorkgroupSizeCandidates(
+    const Vec3<size_t> &gws,
+    const Vec3<size_t> &lws,
+    size_t maxWorkGroupSize,
+    size_t simdSize,
+    std::vector<Vec3<size_t>> &candidates);
+
 Vec3<size_t> computeWorkgroupsNumber(
     const Vec3<size_t> gws,
     const Vec3<size_t> lws);
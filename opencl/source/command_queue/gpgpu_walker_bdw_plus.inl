@@ -226,7 +226,7 @@ void GpgpuWalkerHelper<GfxFamily>::dispatchProfilingCommandsStart(
         hwInfo,
         args);
 
-    if (!HwHelper::get(hwInfo.platform.eRenderCoreFamily).useOnlyGlobalTimestamps()) {
+    if (!HwHelperHw<GfxFamily>::get().useOnlyGlobalTimestamps()) {
         //MI_STORE_REGISTER_MEM for context local timestamp
         timeStampAddress = hwTimeStamps.getGpuAddress() + offsetof(HwTimeStamps, ContextStartTS);
 
@@ -258,7 +258,7 @@ void GpgpuWalkerHelper<GfxFamily>::dispatchProfilingCommandsEnd(
         hwInfo,
         args);
 
-    if (!HwHelper::get(hwInfo.platform.eRenderCoreFamily).useOnlyGlobalTimestamps()) {
+    if (!HwHelperHw<GfxFamily>::get().useOnlyGlobalTimestamps()) {
         //MI_STORE_REGISTER_MEM for context local timestamp
         uint64_t timeStampAddress = hwTimeStamps.getGpuAddress() + offsetof(HwTimeStamps, ContextEndTS);
 
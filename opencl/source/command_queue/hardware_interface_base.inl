@@ -88,11 +88,18 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
     // Allocate command stream and indirect heaps
     bool blockedQueue = (blockedCommandsData != nullptr);
-    obtainIndirectHeaps(commandQueue, multiDispatchInfo, blockedQueue, dsh, ioh, ssh);
-    if (blockedQueue) {
+    if (blockedQueue && blockedCommandsData->dsh) {
+        // heaps already owned by recorded operation (command graph segment) are appended to
+        dsh = blockedCommandsData->dsh.get();
+        ioh = blockedCommandsData->ioh.get();
+        ssh = blockedCommandsData->ssh.get();
+        commandStream = blockedCommandsData->commandStream.get();
+    } else if (blockedQueue) {
+        obtainIndirectHeaps(commandQueue, multiDispatchInfo, blockedQueue, dsh, ioh, ssh);
         blockedCommandsData->setHeaps(dsh, ioh, ssh);
         commandStream = blockedCommandsData->commandStream.get();
     } else {
+        obtainIndirectHeaps(commandQueue, multiDispatchInfo, blockedQueue, dsh, ioh, ssh);
         commandStream = &commandQueue.getCS(0);
     }
 
@@ -138,6 +145,12 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
                                     multiDispatchInfo.begin()->getActualWorkgroupSize(),
                                     multiDispatchInfo.begin()->getOffset(),
                                     currentTimestampPacketNodes);
+    if (DebugManager.flags.EnableLocalWorkSizeTuning.get() == 1 && multiDispatchInfo.size() == 1 &&
+        multiDispatchInfo.begin()->getEnqueuedWorkgroupSize().x == 0) {
+        mainKernel->performLocalWorkSizeTuning(multiDispatchInfo.begin()->getGWS(),
+                                               multiDispatchInfo.begin()->getLocalWorkgroupSize(),
+                                               currentTimestampPacketNodes);
+    }
 
     size_t currentDispatchIndex = 0;
     for (auto &dispatchInfo : multiDispatchInfo) {
@@ -154,8 +167,8 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
     if (mainKernel->requiresCacheFlushCommand(commandQueue)) {
         uint64_t postSyncAddress = 0;
-        if (commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
-            auto timestampPacketNodeForPostSync = currentTimestampPacketNodes->peekNodes().at(currentDispatchIndex);
+        if (currentTimestampPacketNodes && commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+            auto timestampPacketNodeForPostSync = currentTimestampPacketNodes->peekNodes()[currentDispatchIndex];
             timestampPacketNodeForPostSync->setProfilingCapable(false);
             postSyncAddress = TimestampPacketHelper::getContextEndGpuAddress(*timestampPacketNodeForPostSync);
         }
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/basic_math.h"
@@ -444,7 +445,44 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
 }
 
 Vec3<size_t> generateWorkgroupSize(const DispatchInfo &dispatchInfo) {
-    return (dispatchInfo.getEnqueuedWorkgroupSize().x == 0) ? computeWorkgroupSize(dispatchInfo) : dispatchInfo.getEnqueuedWorkgroupSize();
+    if (dispatchInfo.getEnqueuedWorkgroupSize().x != 0) {
+        return dispatchInfo.getEnqueuedWorkgroupSize();
+    }
+
+    auto lws = computeWorkgroupSize(dispatchInfo);
+    auto kernel = dispatchInfo.getKernel();
+    if (kernel != nullptr && DebugManager.flags.EnableLocalWorkSizeTuning.get() == 1 && kernel->isLocalWorkSizeTuningAllowed()) {
+        lws = kernel->getTunedLocalWorkSize(dispatchInfo.getGWS(), lws);
+    }
+    return lws;
+}
+
+void computeWorkgroupSizeCandidates(const Vec3<size_t> &gws, const Vec3<size_t> &lws, size_t maxWorkGroupSize, size_t simdSize, std::vector<Vec3<size_t>> &candidates) {
+    auto addCandidate = [&](const Vec3<size_t> &candidate) {
+        if (candidate.x * candidate.y * candidate.z > maxWorkGroupSize ||
+            gws.x % candidate.x != 0 || gws.y % candidate.y != 0 || gws.z % candidate.z != 0) {
+            return;
+        }
+        if (std::find(candidates.begin(), candidates.end(), candidate) == candidates.end()) {
+            candidates.push_back(candidate);
+        }
+    };
+
+    // heuristic choice goes first, neighbours differ by factor of two in one or two dimensions
+    candidates.push_back(lws);
+    auto totalSize = lws.x * lws.y * lws.z;
+    addCandidate({lws.x * 2, lws.y, lws.z});
+    if (lws.x % 2 == 0) {
+        if (totalSize / 2 >= simdSize) {
+            addCandidate({lws.x / 2, lws.y, lws.z});
+        }
+        if (gws.y > 1) {
+            addCandidate({lws.x / 2, lws.y * 2, lws.z});
+        }
+    }
+    if (lws.y % 2 == 0) {
+        addCandidate({lws.x * 2, lws.y / 2, lws.z});
+    }
 }
 
 Vec3<size_t> computeWorkgroupsNumber(const Vec3<size_t> gws, const Vec3<size_t> lws) {
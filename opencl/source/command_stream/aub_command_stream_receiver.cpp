@@ -14,6 +14,7 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
+#include "shared/source/os_interface/os_thread.h"
 
 #include "opencl/source/os_interface/os_inc_base.h"
 
@@ -83,24 +84,99 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+AubFileStream::AubFileStream() = default;
+
+AubFileStream::~AubFileStream() {
+    if (writerThread) {
+        close();
+    }
+}
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    // capture is produced on submitting thread, file I/O is moved to writer thread
+    if (NEO::DebugManager.flags.AUBDumpAsyncWrite.get() == 1 && !writerThread) {
+        pendingData.reserve(asyncWriteChunkSize);
+        keepWriting = true;
+        writerThread = NEO::Thread::create(writeChunks, reinterpret_cast<void *>(this));
+    }
 }
 
 void AubFileStream::close() {
+    if (writerThread) {
+        flush();
+        std::unique_lock<std::mutex> lock(writeQueueMutex);
+        keepWriting = false;
+        lock.unlock();
+        writeQueueCondition.notify_all();
+        writerThread->join();
+        writerThread.reset();
+    }
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
-    fileHandle.write(data, size);
+    if (!writerThread) {
+        fileHandle.write(data, size);
+        return;
+    }
+    pendingData.insert(pendingData.end(), data, data + size);
+    if (pendingData.size() >= asyncWriteChunkSize) {
+        submitPendingData();
+    }
 }
 
 void AubFileStream::flush() {
+    if (!writerThread) {
+        fileHandle.flush();
+        return;
+    }
+    submitPendingData();
+    // flush is used before file is read or closed, so it has to wait for all chunks written so far
+    std::unique_lock<std::mutex> lock(writeQueueMutex);
+    writeQueueCondition.wait(lock, [this]() { return writeQueue.empty() && !writingChunk; });
     fileHandle.flush();
 }
 
+void AubFileStream::submitPendingData() {
+    if (pendingData.empty()) {
+        return;
+    }
+    std::vector<char> chunk;
+    chunk.reserve(asyncWriteChunkSize);
+    chunk.swap(pendingData);
+
+    std::unique_lock<std::mutex> lock(writeQueueMutex);
+    writeQueue.push_back(std::move(chunk));
+    lock.unlock();
+    writeQueueCondition.notify_all();
+}
+
+void *AubFileStream::writeChunks(void *self) {
+    auto stream = reinterpret_cast<AubFileStream *>(self);
+    std::unique_lock<std::mutex> lock(stream->writeQueueMutex);
+    while (true) {
+        stream->writeQueueCondition.wait(lock, [stream]() { return !stream->writeQueue.empty() || !stream->keepWriting; });
+        if (stream->writeQueue.empty()) {
+            break;
+        }
+        auto chunk = std::move(stream->writeQueue.front());
+        stream->writeQueue.pop_front();
+        stream->writingChunk = true;
+        lock.unlock();
+
+        stream->fileHandle.write(chunk.data(), chunk.size());
+
+        lock.lock();
+        stream->writingChunk = false;
+        stream->writeQueueCondition.notify_all();
+    }
+    return nullptr;
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
@@ -18,6 +18,9 @@
 #include "aub_mapper.h"
 #include "command_stream_receiver_simulated_hw.h"
 
+#include <unordered_map>
+#include <utility>
+
 namespace NEO {
 
 class AubSubCaptureManager;
@@ -117,6 +120,8 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
     bool dumpAubNonWritable = false;
     ExternalAllocationsContainer externalAllocations;
+    // size and content hash of last memory write per GPU address
+    std::unordered_map<uint64_t, std::pair<size_t, uint64_t>> writtenAllocationsContent;
 
     uint32_t pollForCompletionTaskCount = 0u;
     SpinLock pollForCompletionLock;
@@ -650,16 +650,25 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         return false;
     }
 
-    auto streamLocked = getAubStream()->lockStream();
-
-    if (aubManager) {
-        this->writeMemoryWithAubManager(gfxAllocation);
-    } else {
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+    bool contentWritten = false;
+    if (DebugManager.flags.AUBDumpSkipUnchangedAllocations.get() == 1) {
+        // same content at same address is already in captured memory, writing pages again only grows the file
+        auto contentHash = Hash::hash(reinterpret_cast<const char *>(cpuAddress), size);
+        auto &writtenContent = writtenAllocationsContent[gpuAddress];
+        contentWritten = writtenContent.first == size && writtenContent.second == contentHash;
+        writtenContent = {size, contentHash};
+    }
+
+    if (!contentWritten) {
+        auto streamLocked = getAubStream()->lockStream();
+
+        if (aubManager) {
+            this->writeMemoryWithAubManager(gfxAllocation);
+        } else {
+            writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        }
     }
 
-    streamLocked.unlock();
-
     if (gfxAllocation.isLocked() && ownsLock) {
         this->getMemoryManager()->unlockResource(&gfxAllocation);
     }
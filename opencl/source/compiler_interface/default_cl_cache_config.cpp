@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,20 @@ CompilerCacheConfig getDefaultClCompilerCacheConfig() {
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(CL_CACHE_LOCATION));
 
+    std::string sizeKeyName = oclRegPath;
+    sizeKeyName += "cl_cache_size";
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(sizeKeyName), static_cast<int64_t>(defaultCompilerCacheSize)));
+
     ret.cacheFileExtension = ".cl_cache";
+    ret.memoryCacheEnabled = true;
+
+    std::string sharedDirKeyName = oclRegPath;
+    sharedDirKeyName += "cl_cache_shared_dir";
+    ret.sharedCacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(sharedDirKeyName), std::string(""));
+
+    std::string sharedSizeKeyName = oclRegPath;
+    sharedSizeKeyName += "cl_cache_shared_size";
+    ret.sharedCacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(sharedSizeKeyName), static_cast<int64_t>(defaultCompilerSharedCacheSize)));
 
     return ret;
 }
@@ -123,6 +123,7 @@ bool Context::createImpl(const cl_context_properties *properties,
 
     auto propertiesCurrent = properties;
     bool interopUserSync = false;
+    cl_uint queuePlacementPolicy = CL_QUEUE_PLACEMENT_DEFAULT_INTEL;
     int32_t driverDiagnosticsUsed = -1;
     auto sharingBuilder = sharingFactory.build();
 
@@ -143,6 +144,15 @@ bool Context::createImpl(const cl_context_properties *properties,
         case CL_CONTEXT_INTEROP_USER_SYNC:
             interopUserSync = propertyValue > 0;
             break;
+        case CL_CONTEXT_QUEUE_PLACEMENT_POLICY_INTEL:
+            if (propertyValue != CL_QUEUE_PLACEMENT_DEFAULT_INTEL &&
+                propertyValue != CL_QUEUE_PLACEMENT_ROUND_ROBIN_INTEL &&
+                propertyValue != CL_QUEUE_PLACEMENT_LEAST_BUSY_INTEL) {
+                errcodeRet = CL_INVALID_PROPERTY;
+                return false;
+            }
+            queuePlacementPolicy = static_cast<cl_uint>(propertyValue);
+            break;
         default:
             if (!sharingBuilder->processProperties(propertyType, propertyValue)) {
                 errcodeRet = CL_INVALID_PROPERTY;
@@ -173,6 +183,7 @@ bool Context::createImpl(const cl_context_properties *properties,
     this->numProperties = numProperties;
     this->properties = propertiesNew;
     this->setInteropUserSyncEnabled(interopUserSync);
+    this->setQueuePlacementPolicy(queuePlacementPolicy);
 
     if (!sharingBuilder->finalizeProperties(*this, errcodeRet)) {
         return false;
@@ -191,6 +202,13 @@ bool Context::createImpl(const cl_context_properties *properties,
         return false;
     }
 
+    for (const auto &device : inputDevices) {
+        if (!device->ensureInitialized()) {
+            errcodeRet = CL_OUT_OF_HOST_MEMORY;
+            return false;
+        }
+    }
+
     devices = inputDevices;
     for (auto &rootDeviceIndex : rootDeviceIndices) {
         DeviceBitfield deviceBitfield{};
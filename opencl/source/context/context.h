@@ -10,6 +10,7 @@
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/helpers/vec.h"
 
+#include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/cl_device/cl_device_vector.h"
 #include "opencl/source/context/context_type.h"
 #include "opencl/source/context/driver_diagnostics.h"
@@ -141,6 +142,8 @@ class Context : public BaseObject<_cl_context> {
 
     bool getInteropUserSyncEnabled() { return interopUserSync; }
     void setInteropUserSyncEnabled(bool enabled) { interopUserSync = enabled; }
+    cl_uint getQueuePlacementPolicy() const { return queuePlacementPolicy; }
+    void setQueuePlacementPolicy(cl_uint policy) { queuePlacementPolicy = policy; }
     bool areMultiStorageAllocationsPreferred();
 
     ContextType peekContextType() const { return contextType; }
@@ -205,6 +208,7 @@ class Context : public BaseObject<_cl_context> {
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     cl_bool preferD3dSharedResources = 0u;
     ContextType contextType = ContextType::CONTEXT_TYPE_DEFAULT;
+    cl_uint queuePlacementPolicy = CL_QUEUE_PLACEMENT_DEFAULT_INTEL;
 
     bool interopUserSync = false;
     bool resolvesRequiredInKernels = false;
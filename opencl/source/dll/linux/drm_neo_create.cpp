@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <mutex>
 
 namespace NEO {
 const DeviceDescriptor deviceDescriptorTable[] = {
@@ -65,6 +66,9 @@ Drm *Drm::create(std::unique_ptr<HwDeviceId> hwDeviceId, RootDeviceEnvironment &
         }
     }
     if (device) {
+        // descriptor hw info is shared by devices of the same type and root devices may be created in parallel
+        static std::mutex deviceDescriptorMutex;
+        std::lock_guard<std::mutex> lock(deviceDescriptorMutex);
         ret = drmObject->setupHardwareInfo(const_cast<DeviceDescriptor *>(device), true);
         if (ret != 0) {
             return nullptr;
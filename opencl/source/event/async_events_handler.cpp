@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,15 +7,22 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/worker_pool.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
 #include <iterator>
 
 namespace NEO {
-AsyncEventsHandler::AsyncEventsHandler() {
+AsyncEventsHandler::AsyncEventsHandler() : AsyncEventsHandler(nullptr) {
+}
+
+AsyncEventsHandler::AsyncEventsHandler(ExecutionEnvironment *executionEnvironment) : executionEnvironment(executionEnvironment) {
     allowAsyncProcess = false;
     registerList.reserve(64);
     list.reserve(64);
@@ -24,6 +31,12 @@ AsyncEventsHandler::AsyncEventsHandler() {
 
 AsyncEventsHandler::~AsyncEventsHandler() {
     closeThread();
+    // waits for callbacks already dispatched to workers
+    auto driverWorkerPool = executionEnvironment ? executionEnvironment->peekDriverWorkerPool() : nullptr;
+    if (driverWorkerPool) {
+        driverWorkerPool->waitForClientTasks(WorkerPoolClient::EventCallbacks);
+    }
+    ownCallbackWorkers.reset();
 }
 
 void AsyncEventsHandler::registerEvent(Event *event) {
@@ -36,26 +49,95 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+bool AsyncEventsHandler::isSubmittedToGpu(Event &event) {
+    return event.getCommandQueue() != nullptr && !event.isExternallySynchronized() &&
+           event.peekExecutionStatus() == CL_SUBMITTED && event.peekTaskCount() != CompletionStamp::notReady;
+}
+
+bool AsyncEventsHandler::isPending(Event &event) {
+    return event.peekHasCallbacks() || (event.isExternallySynchronized() && (event.peekExecutionStatus() > CL_COMPLETE));
+}
+
+AsyncEventsHandler::CsrProgress &AsyncEventsHandler::getCsrProgress(Event &event) {
+    auto csr = &event.getCommandQueue()->getGpgpuCommandStreamReceiver();
+    for (auto &csrProgress : csrsProgress) {
+        if (csrProgress.csr == csr) {
+            return csrProgress;
+        }
+    }
+    csrsProgress.push_back({csr, *csr->getTagAddress(), nullptr});
+    return csrsProgress.back();
+}
+
 Event *AsyncEventsHandler::processList() {
-    uint32_t lowestTaskCount = CompletionStamp::notReady;
-    Event *sleepCandidate = nullptr;
     pendingList.clear();
+    csrsProgress.clear();
 
     for (auto event : list) {
-        event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
-            pendingList.push_back(event);
-            if (event->peekTaskCount() < lowestTaskCount) {
-                sleepCandidate = event;
-                lowestTaskCount = event->peekTaskCount();
-            }
-        } else {
+        if (!isSubmittedToGpu(*event)) {
+            event->updateExecutionStatus();
+        } else if (event->peekTaskCount() <= getCsrProgress(*event).completedTaskCount) {
+            dispatchCompletedEvent(event);
+            continue;
+        }
+
+        if (!isPending(*event)) {
             event->decRefInternal();
+            continue;
+        }
+        pendingList.push_back(event);
+
+        if (isSubmittedToGpu(*event)) {
+            auto &csrProgress = getCsrProgress(*event);
+            if (!csrProgress.sleepCandidate || event->peekTaskCount() < csrProgress.sleepCandidate->peekTaskCount()) {
+                csrProgress.sleepCandidate = event;
+            }
         }
     }
 
     list.swap(pendingList);
-    return sleepCandidate;
+
+    if (csrsProgress.empty()) {
+        return nullptr;
+    }
+    // task counts of different CSRs are not comparable, wait is done on each CSR in turn
+    sleepCsrIndex = (sleepCsrIndex + 1) % csrsProgress.size();
+    for (size_t i = 0; i < csrsProgress.size(); i++) {
+        auto sleepCandidate = csrsProgress[(sleepCsrIndex + i) % csrsProgress.size()].sleepCandidate;
+        if (sleepCandidate) {
+            return sleepCandidate;
+        }
+    }
+    return nullptr;
+}
+
+void AsyncEventsHandler::dispatchCompletedEvent(Event *event) {
+    WorkerPool *callbackWorkers = nullptr;
+    if (executionEnvironment) {
+        callbackWorkers = executionEnvironment->getDriverWorkerPool();
+    } else {
+        if (!ownCallbackWorkers) {
+            ownCallbackWorkers = std::make_unique<WorkerPool>(maxCallbackWorkers);
+        }
+        callbackWorkers = ownCallbackWorkers.get();
+    }
+    // reference held by handler is passed to worker
+    callbackWorkers->enqueue(WorkerPoolClient::EventCallbacks, [this, event]() {
+        event->updateExecutionStatus();
+        returnEvent(event);
+    });
+}
+
+void AsyncEventsHandler::returnEvent(Event *event) {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+    // event not finished yet (e.g. waiting for blitter) goes back to handler while it is processing
+    if (allowAsyncProcess && isPending(*event)) {
+        registerList.push_back(event);
+        asyncCond.notify_one();
+        return;
+    }
+    lock.unlock();
+    event->decRefInternal();
 }
 
 void *AsyncEventsHandler::asyncProcess(void *arg) {
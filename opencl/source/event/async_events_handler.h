@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,30 +8,56 @@
 #pragma once
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
+class ExecutionEnvironment;
 class Thread;
+class WorkerPool;
 
+// Events submitted to GPU are checked against tag of their CSR, read once per pass, so status of events
+// GPU has not reached yet is not queried. Events completed by GPU are finished with callbacks on worker pool,
+// single slow callback does not delay callbacks of other events.
+// Callbacks run on driver worker pool of execution environment, handler without execution environment uses its own pool.
 class AsyncEventsHandler {
   public:
+    static constexpr size_t maxCallbackWorkers = 4;
+
     AsyncEventsHandler();
+    AsyncEventsHandler(ExecutionEnvironment *executionEnvironment);
     virtual ~AsyncEventsHandler();
     void registerEvent(Event *event);
     void closeThread();
 
   protected:
+    struct CsrProgress {
+        CommandStreamReceiver *csr;
+        uint32_t completedTaskCount;
+        Event *sleepCandidate;
+    };
+
     Event *processList();
     static void *asyncProcess(void *arg);
     void releaseEvents();
+    static bool isSubmittedToGpu(Event &event);
+    static bool isPending(Event &event);
+    CsrProgress &getCsrProgress(Event &event);
+    MOCKABLE_VIRTUAL void dispatchCompletedEvent(Event *event);
+    void returnEvent(Event *event);
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::vector<CsrProgress> csrsProgress;
+    size_t sleepCsrIndex = 0;
+    ExecutionEnvironment *executionEnvironment = nullptr;
+    std::unique_ptr<WorkerPool> ownCallbackWorkers;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
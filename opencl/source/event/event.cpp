@@ -8,12 +8,14 @@
 #include "opencl/source/event/event.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/submission_latency_counters.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/utilities/range.h"
+#include "shared/source/utilities/runtime_tracer.h"
 #include "shared/source/utilities/stackvec.h"
 #include "shared/source/utilities/tag_allocator.h"
 
@@ -252,7 +254,7 @@ cl_ulong Event::getDelta(cl_ulong startTime,
 bool Event::calcProfilingData() {
     if (!dataCalculated && !profilingCpuPath) {
         if (timestampPacketContainer && timestampPacketContainer->peekNodes().size() > 0) {
-            const auto timestamps = timestampPacketContainer->peekNodes();
+            const auto &timestamps = timestampPacketContainer->peekNodes();
 
             if (DebugManager.flags.PrintTimestampPacketContents.get()) {
                 for (auto i = 0u; i < timestamps.size(); i++) {
@@ -334,17 +336,29 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     endTimeStamp = startTimeStamp + cpuDuration;
     completeTimeStamp = startTimeStamp + cpuCompleteDuration;
 
+    auto submissionLatencyCounters = cmdQueue->getGpgpuCommandStreamReceiver().getSubmissionLatencyCounters();
+    if (submissionLatencyCounters && submitTimeStamp.CPUTimeinNS != 0 && startTimeStamp > submitTimeStamp.CPUTimeinNS) {
+        submissionLatencyCounters->record(SubmissionLatencyCounters::GpuStart, startTimeStamp - submitTimeStamp.CPUTimeinNS);
+    }
+
     if (DebugManager.flags.ReturnRawGpuTimestamps.get()) {
         startTimeStamp = contextStartTS;
         endTimeStamp = contextEndTS;
         completeTimeStamp = *contextCompleteTS;
+    } else if (RuntimeTracer::isEnabled()) {
+        // profiling timestamps are in OS CPU time domain, trace uses its own host clock
+        uint64_t cpuTimeInNs = 0;
+        cmdQueue->getDevice().getOSTime()->getCpuTime(&cpuTimeInNs);
+        auto traceStartTimeStamp = startTimeStamp + RuntimeTracer::getTimestampInNs() - cpuTimeInNs;
+        RuntimeTracer::addGpuInterval("gpuExecution", traceStartTimeStamp, endTimeStamp - startTimeStamp,
+                                      cmdQueue->getGpgpuCommandStreamReceiver().getOsContext().getContextId(), cmdType);
     }
 
     dataCalculated = true;
 }
 
 void Event::getBoundaryTimestampValues(TimestampPacketContainer *timestampContainer, uint64_t &globalStartTS, uint64_t &globalEndTS) {
-    const auto timestamps = timestampContainer->peekNodes();
+    const auto &timestamps = timestampContainer->peekNodes();
 
     globalStartTS = timestamps[0]->getGlobalStartValue(0);
     globalEndTS = timestamps[0]->getGlobalEndValue(0);
@@ -410,6 +424,9 @@ void Event::updateExecutionStatus() {
 
     if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp(), this->bcsTaskCount))) {
         transitionExecutionStatus(CL_COMPLETE);
+        if ((RuntimeTracer::isEnabled() || SubmissionLatencyCounters::isEnabled()) && isProfilingEnabled()) {
+            calcProfilingData();
+        }
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
@@ -522,7 +539,7 @@ void Event::submitCommand(bool abortTasks) {
                 setSubmitTimeStamp();
                 setStartTimeStamp();
             } else {
-                this->cmdQueue->getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
+                this->cmdQueue->getDevice().getOSTime()->getCpuGpuTimeFromCorrelation(&submitTimeStamp, this->cmdQueue->getDevice().getDeviceInfo().profilingTimerResolution);
             }
             if (perfCountersEnabled && perfCounterNode) {
                 this->cmdQueue->getGpgpuCommandStreamReceiver().makeResident(*perfCounterNode->getBaseGraphicsAllocation());
@@ -568,6 +585,37 @@ cl_int Event::waitForEvents(cl_uint numEvents,
         }
     }
 
+    // events from one queue complete in task count order, so wait once per queue for its highest task count
+    // instead of running a separate wait for every event in the list
+    struct QueueWait {
+        CommandQueue *cmdQueue;
+        uint32_t taskCount;
+        uint32_t bcsTaskCount;
+        FlushStamp flushStamp;
+    };
+    StackVec<QueueWait, 8> queueWaits;
+    for (const cl_event *it = eventList, *end = eventList + numEvents; it != end; ++it) {
+        Event *event = castToObjectOrAbort<Event>(*it);
+        if (event->cmdQueue == nullptr || event->taskCount == CompletionStamp::notReady || event->isUserEvent()) {
+            continue;
+        }
+        auto queueWait = std::find_if(queueWaits.begin(), queueWaits.end(), [&](const QueueWait &entry) { return entry.cmdQueue == event->cmdQueue; });
+        if (queueWait == queueWaits.end()) {
+            queueWaits.push_back({event->cmdQueue, event->taskCount.load(), event->bcsTaskCount, event->flushStamp->peekStamp()});
+            continue;
+        }
+        if (event->taskCount > queueWait->taskCount) {
+            queueWait->taskCount = event->taskCount;
+            queueWait->flushStamp = event->flushStamp->peekStamp();
+        }
+        queueWait->bcsTaskCount = std::max(queueWait->bcsTaskCount, event->bcsTaskCount);
+    }
+    if (queueWaits.size() > 0 && queueWaits.size() < numEvents) {
+        for (auto &queueWait : queueWaits) {
+            queueWait.cmdQueue->waitUntilComplete(queueWait.taskCount, queueWait.bcsTaskCount, queueWait.flushStamp, false);
+        }
+    }
+
     using WorkerListT = StackVec<cl_event, 64>;
     WorkerListT workerList1(eventList, eventList + numEvents);
     WorkerListT workerList2;
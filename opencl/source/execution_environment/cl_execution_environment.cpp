@@ -12,7 +12,7 @@
 namespace NEO {
 
 ClExecutionEnvironment::ClExecutionEnvironment() : ExecutionEnvironment() {
-    asyncEventsHandler.reset(new AsyncEventsHandler());
+    asyncEventsHandler.reset(new AsyncEventsHandler(this));
 }
 
 AsyncEventsHandler *ClExecutionEnvironment::getAsyncEventsHandler() const {
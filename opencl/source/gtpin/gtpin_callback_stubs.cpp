@@ -18,6 +18,9 @@ void gtpinNotifyContextCreate(cl_context context) {
 void gtpinNotifyContextDestroy(cl_context context) {
 }
 
+void gtpinNotifyContextRelease(cl_context context) {
+}
+
 void gtpinNotifyKernelCreate(cl_kernel kernel) {
 }
 
@@ -13,6 +13,7 @@
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/gtpin/gtpin_defs.h"
+#include "opencl/source/gtpin/gtpin_helpers.h"
 #include "opencl/source/gtpin/gtpin_hw_helper.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/kernel/kernel.h"
@@ -60,6 +61,13 @@ void gtpinNotifyContextDestroy(cl_context context) {
     }
 }
 
+void gtpinNotifyContextRelease(cl_context context) {
+    if (isGTPinInitialized) {
+        // Pooled GT-Pin buffers keep context alive, release them with last API reference
+        gtpinReleasePooledBuffers((context_handle_t)context);
+    }
+}
+
 void gtpinNotifyKernelCreate(cl_kernel kernel) {
     if (nullptr == kernel) {
         return;
@@ -184,18 +192,20 @@ void gtpinNotifyFlushTask(uint32_t flushedTaskCount) {
 void gtpinNotifyTaskCompletion(uint32_t completedTaskCount) {
     if (isGTPinInitialized) {
         std::unique_lock<GTPinLockType> lock{kernelExecQueueLock};
-        size_t numElems = kernelExecQueue.size();
-        for (size_t n = 0; n < numElems;) {
-            if (kernelExecQueue[n].isTaskCountValid && (kernelExecQueue[n].taskCount <= completedTaskCount)) {
+        // Remove completed records in single pass, keeping order of remaining ones
+        auto remaining = kernelExecQueue.begin();
+        for (auto it = kernelExecQueue.begin(); it != kernelExecQueue.end(); it++) {
+            if (it->isTaskCountValid && (it->taskCount <= completedTaskCount)) {
                 // Notify GT-Pin that execution of "command buffer" was completed
-                (*GTPinCallbacks.onCommandBufferComplete)(kernelExecQueue[n].commandBuffer);
-                // Remove kernel's record from Kernel Execution Queue
-                kernelExecQueue.erase(kernelExecQueue.begin() + n);
-                numElems--;
+                (*GTPinCallbacks.onCommandBufferComplete)(it->commandBuffer);
             } else {
-                n++;
+                if (remaining != it) {
+                    *remaining = *it;
+                }
+                remaining++;
             }
         }
+        kernelExecQueue.erase(remaining, kernelExecQueue.end());
     }
 }
 
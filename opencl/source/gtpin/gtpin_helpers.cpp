@@ -7,8 +7,11 @@
 
 #include "gtpin_helpers.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 #include "opencl/source/api/api.h"
 #include "opencl/source/cl_device/cl_device.h"
@@ -20,10 +23,88 @@
 #include "CL/cl.h"
 #include "ocl_igc_shared/gtpin/gtpin_ocl_interface.h"
 
+#include <mutex>
+#include <vector>
+
 using namespace gtpin;
 
 namespace NEO {
 
+struct GTPinPooledBuffer {
+    Context *context;
+    size_t size;
+    resource_handle_t resource;
+};
+
+std::vector<GTPinPooledBuffer> gtpinBufferPool;
+std::mutex gtpinBufferPoolMutex;
+constexpr size_t maxPooledGTPinBuffers = 64u;
+
+bool isGTPinBufferPoolingEnabled() {
+    return DebugManager.flags.GTPinPoolBuffers.get() == 1;
+}
+
+GraphicsAllocation *getGTPinBufferAllocation(Context *pContext, resource_handle_t resource, size_t &size) {
+    auto rootDeviceIndex = pContext->getDevice(0)->getRootDeviceIndex();
+    GTPinHwHelper &gtpinHelper = GTPinHwHelper::get(pContext->getDevice(0)->getHardwareInfo().platform.eRenderCoreFamily);
+    if (gtpinHelper.canUseSharedAllocation(pContext->getDevice(0)->getHardwareInfo())) {
+        auto allocData = reinterpret_cast<SvmAllocationData *>(resource);
+        size = allocData->size;
+        return allocData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
+    }
+    auto pMemObj = castToObject<MemObj>(resource);
+    if (pMemObj == nullptr) {
+        return nullptr;
+    }
+    size = pMemObj->getSize();
+    return pMemObj->getGraphicsAllocation(rootDeviceIndex);
+}
+
+bool isGTPinBufferInUse(Context *pContext, GraphicsAllocation &allocation) {
+    for (auto &engine : pContext->getMemoryManager()->getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (allocation.isUsedByOsContext(contextId) &&
+            allocation.getTaskCount(contextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+GTPIN_DI_STATUS releaseGTPinBuffer(Context *pContext, resource_handle_t resource) {
+    if (pContext->getMemoryManager()->isLocalMemorySupported(pContext->getDevice(0)->getRootDeviceIndex())) {
+        auto allocData = reinterpret_cast<SvmAllocationData *>(resource);
+        clMemFreeINTEL(pContext, allocData->cpuAllocation->getUnderlyingBuffer());
+    } else {
+        auto pMemObj = castToObject<MemObj>(resource);
+        if (pMemObj == nullptr) {
+            return GTPIN_DI_ERROR_INVALID_ARGUMENT;
+        }
+        alignedFree(pMemObj->getHostPtr());
+        pMemObj->release();
+    }
+    return GTPIN_DI_SUCCESS;
+}
+
+bool obtainPooledGTPinBuffer(Context *pContext, size_t size, resource_handle_t *pResource) {
+    std::lock_guard<std::mutex> lock(gtpinBufferPoolMutex);
+    for (auto it = gtpinBufferPool.begin(); it != gtpinBufferPool.end(); it++) {
+        if (it->context != pContext || it->size != size) {
+            continue;
+        }
+        size_t pooledSize = 0u;
+        auto allocation = getGTPinBufferAllocation(pContext, it->resource, pooledSize);
+        if (allocation && isGTPinBufferInUse(pContext, *allocation)) {
+            continue;
+        }
+        *pResource = it->resource;
+        *it = gtpinBufferPool.back();
+        gtpinBufferPool.pop_back();
+        return true;
+    }
+    return false;
+}
+
 GTPIN_DI_STATUS GTPIN_DRIVER_CALLCONV gtpinCreateBuffer(context_handle_t context, uint32_t reqSize, resource_handle_t *pResource) {
     cl_int diag = CL_SUCCESS;
     Context *pContext = castToObject<Context>((cl_context)context);
@@ -31,6 +112,9 @@ GTPIN_DI_STATUS GTPIN_DRIVER_CALLCONV gtpinCreateBuffer(context_handle_t context
         return GTPIN_DI_ERROR_INVALID_ARGUMENT;
     }
     size_t size = alignUp(reqSize, MemoryConstants::cacheLineSize);
+    if (isGTPinBufferPoolingEnabled() && obtainPooledGTPinBuffer(pContext, size, pResource)) {
+        return GTPIN_DI_SUCCESS;
+    }
     GTPinHwHelper &gtpinHelper = GTPinHwHelper::get(pContext->getDevice(0)->getHardwareInfo().platform.eRenderCoreFamily);
     if (gtpinHelper.canUseSharedAllocation(pContext->getDevice(0)->getHardwareInfo())) {
         void *unfiedMemorySharedAllocation = clSharedMemAllocINTEL(pContext, pContext->getDevice(0), 0, size, 0, &diag);
@@ -53,18 +137,41 @@ GTPIN_DI_STATUS GTPIN_DRIVER_CALLCONV gtpinFreeBuffer(context_handle_t context,
     if ((pContext == nullptr) || (resource == nullptr)) {
         return GTPIN_DI_ERROR_INVALID_ARGUMENT;
     }
-    if (pContext->getMemoryManager()->isLocalMemorySupported(pContext->getDevice(0)->getRootDeviceIndex())) {
-        auto allocData = reinterpret_cast<SvmAllocationData *>(resource);
-        clMemFreeINTEL(pContext, allocData->cpuAllocation->getUnderlyingBuffer());
-    } else {
-        auto pMemObj = castToObject<MemObj>(resource);
-        if (pMemObj == nullptr) {
+    if (isGTPinBufferPoolingEnabled()) {
+        size_t size = 0u;
+        if (getGTPinBufferAllocation(pContext, resource, size) == nullptr) {
             return GTPIN_DI_ERROR_INVALID_ARGUMENT;
         }
-        alignedFree(pMemObj->getHostPtr());
-        pMemObj->release();
+        std::lock_guard<std::mutex> lock(gtpinBufferPoolMutex);
+        if (gtpinBufferPool.size() < maxPooledGTPinBuffers) {
+            // buffer is recycled by gtpinCreateBuffer once GPU reaches its task count
+            gtpinBufferPool.push_back({pContext, size, resource});
+            return GTPIN_DI_SUCCESS;
+        }
+    }
+    return releaseGTPinBuffer(pContext, resource);
+}
+
+void gtpinReleasePooledBuffers(context_handle_t context) {
+    Context *pContext = castToObject<Context>((cl_context)context);
+    if (pContext == nullptr) {
+        return;
+    }
+    std::vector<resource_handle_t> resourcesToRelease;
+    {
+        std::lock_guard<std::mutex> lock(gtpinBufferPoolMutex);
+        for (auto it = gtpinBufferPool.begin(); it != gtpinBufferPool.end();) {
+            if (it->context == pContext) {
+                resourcesToRelease.push_back(it->resource);
+                it = gtpinBufferPool.erase(it);
+            } else {
+                it++;
+            }
+        }
+    }
+    for (auto resource : resourcesToRelease) {
+        releaseGTPinBuffer(pContext, resource);
     }
-    return GTPIN_DI_SUCCESS;
 }
 
 GTPIN_DI_STATUS GTPIN_DRIVER_CALLCONV gtpinMapBuffer(context_handle_t context, resource_handle_t resource, uint8_t **pAddress) {
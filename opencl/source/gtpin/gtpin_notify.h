@@ -16,6 +16,7 @@ extern bool isGTPinInitialized;
 
 void gtpinNotifyContextCreate(cl_context context);
 void gtpinNotifyContextDestroy(cl_context context);
+void gtpinNotifyContextRelease(cl_context context);
 void gtpinNotifyKernelCreate(cl_kernel kernel);
 void gtpinNotifyKernelSubmit(cl_kernel kernel, void *pCmdQueue);
 void gtpinNotifyPreFlushTask(void *pCmdQueue);
@@ -249,24 +249,32 @@ size_t HardwareCommandsHelper<GfxFamily>::sendIndirectState(
 
     uint32_t sizeCrossThreadData = kernel.getCrossThreadDataSize();
 
-    size_t offsetCrossThreadData = HardwareCommandsHelper<GfxFamily>::sendCrossThreadData(
-        ioh, kernel, inlineDataProgrammingRequired,
-        walkerCmd, sizeCrossThreadData);
-
+    size_t offsetCrossThreadData = 0;
     size_t sizePerThreadDataTotal = 0;
     size_t sizePerThreadData = 0;
 
-    HardwareCommandsHelper<GfxFamily>::programPerThreadData(
-        sizePerThreadData,
-        localIdsGenerationByRuntime,
-        ioh,
-        simd,
-        numChannels,
-        localWorkSize,
-        kernel,
-        sizePerThreadDataTotal,
-        localWorkItems,
-        rootDeviceIndex);
+    if (kernel.findReusableIndirectData(ioh, localWorkSize, offsetCrossThreadData)) {
+        // indirect data of previous launch is still in this heap, only sizes are needed
+        HardwareCommandsHelper<GfxFamily>::updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
+    } else {
+        offsetCrossThreadData = HardwareCommandsHelper<GfxFamily>::sendCrossThreadData(
+            ioh, kernel, inlineDataProgrammingRequired,
+            walkerCmd, sizeCrossThreadData);
+
+        HardwareCommandsHelper<GfxFamily>::programPerThreadData(
+            sizePerThreadData,
+            localIdsGenerationByRuntime,
+            ioh,
+            simd,
+            numChannels,
+            localWorkSize,
+            kernel,
+            sizePerThreadDataTotal,
+            localWorkItems,
+            rootDeviceIndex);
+
+        kernel.storeIndirectDataUpload(ioh, localWorkSize, offsetCrossThreadData);
+    }
 
     uint64_t offsetInterfaceDescriptor = offsetInterfaceDescriptorTable + interfaceDescriptorIndex * sizeof(INTERFACE_DESCRIPTOR_DATA);
 
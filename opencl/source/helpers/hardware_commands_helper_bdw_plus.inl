@@ -115,7 +115,8 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
         std::array<uint8_t, 3>{{kernel.getKernelInfo().kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[0],
                                 kernel.getKernelInfo().kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[1],
                                 kernel.getKernelInfo().kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[2]}},
-        kernel.usesOnlyImages());
+        kernel.usesOnlyImages(),
+        &kernel.getDevice().getDevice().getLocalIdsCache());
 
     updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
 }
@@ -127,6 +128,7 @@ size_t HardwareCommandsHelper<GfxFamily>::sendCrossThreadData(
     bool inlineDataProgrammingRequired,
     WALKER_TYPE<GfxFamily> *walkerCmd,
     uint32_t &sizeCrossThreadData) {
+    // GPGPU_WALKER cannot carry inline data, so first GRF of cross thread data stays in indirect object heap
     indirectHeap.align(WALKER_TYPE<GfxFamily>::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
 
     auto offsetCrossThreadData = indirectHeap.getUsed();
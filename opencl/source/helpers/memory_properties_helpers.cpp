@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/helpers/hw_helper.h"
+
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/helpers/memory_properties_helpers_base.inl"
@@ -25,6 +27,7 @@ bool MemoryPropertiesHelper::parseMemoryProperties(const cl_mem_properties_intel
                                                    cl_mem_flags &flags, cl_mem_flags_intel &flagsIntel,
                                                    cl_mem_alloc_flags_intel &allocflags, ObjType objectType, Context &context) {
     Device *pDevice = &context.getDevice(0)->getDevice();
+    uint32_t cacheRegion = CL_MEM_CACHE_REGION_DEFAULT_INTEL;
 
     if (properties != nullptr) {
         for (int i = 0; properties[i] != 0; i += 2) {
@@ -38,6 +41,13 @@ bool MemoryPropertiesHelper::parseMemoryProperties(const cl_mem_properties_intel
             case CL_MEM_ALLOC_FLAGS_INTEL:
                 allocflags |= static_cast<cl_mem_alloc_flags_intel>(properties[i + 1]);
                 break;
+            case CL_MEM_CACHE_REGION_INTEL:
+                if (properties[i + 1] > CL_MEM_CACHE_REGION_RESERVED_INTEL ||
+                    (properties[i + 1] == CL_MEM_CACHE_REGION_RESERVED_INTEL && !isCacheRegionSupported(pDevice->getHardwareInfo()))) {
+                    return false;
+                }
+                cacheRegion = static_cast<uint32_t>(properties[i + 1]);
+                break;
             default:
                 return false;
             }
@@ -45,6 +55,7 @@ bool MemoryPropertiesHelper::parseMemoryProperties(const cl_mem_properties_intel
     }
 
     memoryProperties = MemoryPropertiesHelper::createMemoryProperties(flags, flagsIntel, allocflags, pDevice);
+    memoryProperties.cacheRegion = cacheRegion;
 
     switch (objectType) {
     case MemoryPropertiesHelper::ObjType::BUFFER:
@@ -64,11 +75,16 @@ void MemoryPropertiesHelper::fillPoliciesInProperties(AllocationProperties &allo
                                 memoryProperties.flags.locallyUncachedResource,
                                 memoryProperties.flags.readOnly,
                                 false,
-                                0);
+                                getCacheRegion(memoryProperties));
 }
 
 uint32_t MemoryPropertiesHelper::getCacheRegion(const MemoryProperties &memoryProperties) {
-    return 0;
+    return memoryProperties.cacheRegion;
+}
+
+bool MemoryPropertiesHelper::isCacheRegionSupported(const HardwareInfo &hwInfo) {
+    // region 0 is default one, so at least one more region is needed for reservation
+    return HwHelper::get(hwInfo.platform.eRenderCoreFamily).getNumCacheRegions(hwInfo) > 1;
 }
 
 } // namespace NEO
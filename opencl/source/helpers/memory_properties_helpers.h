@@ -49,5 +49,6 @@ class MemoryPropertiesHelper {
                                             bool deviceOnlyVisibilty, uint32_t cacheRegion);
 
     static uint32_t getCacheRegion(const MemoryProperties &memoryProperties);
+    static bool isCacheRegionSupported(const HardwareInfo &hwInfo);
 };
 } // namespace NEO
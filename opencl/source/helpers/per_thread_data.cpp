@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/local_ids_cache.h"
 
 #include <array>
 
@@ -21,7 +22,8 @@ size_t PerThreadDataHelper::sendPerThreadData(
     uint32_t numChannels,
     const std::array<uint16_t, 3> &localWorkSizes,
     const std::array<uint8_t, 3> &workgroupWalkOrder,
-    bool hasKernelOnlyImages) {
+    bool hasKernelOnlyImages,
+    LocalIdsCache *localIdsCache) {
     auto offsetPerThreadData = indirectHeap.getUsed();
     if (numChannels) {
         size_t localWorkSize = static_cast<size_t>(localWorkSizes[0]) * static_cast<size_t>(localWorkSizes[1]) * static_cast<size_t>(localWorkSizes[2]);
@@ -30,7 +32,11 @@ size_t PerThreadDataHelper::sendPerThreadData(
 
         // Generate local IDs
         DEBUG_BREAK_IF(numChannels != 3);
-        generateLocalIDs(pDest, static_cast<uint16_t>(simd), localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages, grfSize);
+        if (localIdsCache) {
+            localIdsCache->generateLocalIds(pDest, sizePerThreadDataTotal, static_cast<uint16_t>(simd), localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages, grfSize);
+        } else {
+            generateLocalIDs(pDest, static_cast<uint16_t>(simd), localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages, grfSize);
+        }
     }
     return offsetPerThreadData;
 }
@@ -17,6 +17,7 @@
 
 namespace NEO {
 class LinearStream;
+class LocalIdsCache;
 
 struct PerThreadDataHelper {
     static inline uint32_t getLocalIdSizePerThread(
@@ -41,7 +42,8 @@ struct PerThreadDataHelper {
         uint32_t numChannels,
         const std::array<uint16_t, 3> &localWorkSizes,
         const std::array<uint8_t, 3> &workgroupWalkOrder,
-        bool hasKernelOnlyImages);
+        bool hasKernelOnlyImages,
+        LocalIdsCache *localIdsCache = nullptr);
 
     static uint32_t getThreadPayloadSize(const KernelDescriptor &kernelDescriptor, uint32_t grfSize);
 };
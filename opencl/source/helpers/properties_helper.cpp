@@ -7,6 +7,7 @@
 
 #include "opencl/source/helpers/properties_helper.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
@@ -15,9 +16,22 @@
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/mem_obj/mem_obj.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 void EventsRequest::fillCsrDependenciesForTimestampPacketContainer(CsrDependencies &csrDeps, CommandStreamReceiver &currentCsr, CsrDependencies::DependenciesType depsType) const {
+    struct LatestDependency {
+        const CommandQueue *commandQueue;
+        const TagAllocatorBase *allocator;
+        uint32_t taskCount;
+        size_t position;
+    };
+    StackVec<LatestDependency, 8> latestInOrderDependencies;
+    // each enqueue on in-order queue waits for previous one, so latest event of queue on given CSR covers earlier ones,
+    // aub subcapture drops dependencies upon activation, so chain is not guaranteed there
+    const bool pruneInOrderDependencies = !DebugManager.flags.AUBDumpSubCaptureMode.get();
+
     for (cl_uint i = 0; i < this->numEventsInWaitList; i++) {
         auto event = castToObjectOrAbort<Event>(this->eventWaitList[i]);
         if (event->isUserEvent()) {
@@ -39,9 +53,32 @@ void EventsRequest::fillCsrDependenciesForTimestampPacketContainer(CsrDependenci
                               (CsrDependencies::DependenciesType::OutOfCsr == depsType && !sameCsr) ||
                               (CsrDependencies::DependenciesType::All == depsType);
 
-        if (pushDependency) {
-            csrDeps.timestampPacketContainer.push_back(timestampPacketContainer);
+        if (!pushDependency) {
+            continue;
         }
+
+        auto commandQueue = event->getCommandQueue();
+        auto taskCount = event->peekTaskCount();
+        if (pruneInOrderDependencies && !commandQueue->isOOQEnabled() && taskCount != CompletionStamp::notReady) {
+            auto allocator = timestampPacketContainer->peekNodes()[0]->getAllocator();
+            auto latestDependency = std::find_if(latestInOrderDependencies.begin(), latestInOrderDependencies.end(), [&](const LatestDependency &dependency) {
+                return dependency.commandQueue == commandQueue && dependency.allocator == allocator;
+            });
+            if (latestDependency != latestInOrderDependencies.end()) {
+                if (taskCount < latestDependency->taskCount) {
+                    continue;
+                }
+                if (taskCount > latestDependency->taskCount) {
+                    csrDeps.timestampPacketContainer[latestDependency->position] = timestampPacketContainer;
+                    latestDependency->taskCount = taskCount;
+                    continue;
+                }
+            } else {
+                latestInOrderDependencies.push_back({commandQueue, allocator, taskCount, csrDeps.timestampPacketContainer.size()});
+            }
+        }
+
+        csrDeps.timestampPacketContainer.push_back(timestampPacketContainer);
     }
 }
 
@@ -54,11 +91,11 @@ void EventsRequest::fillCsrDependenciesForTaskCountContainer(CsrDependencies &cs
 
         if (event->getCommandQueue() && event->getCommandQueue()->getDevice().getRootDeviceIndex() != currentCsr.getRootDeviceIndex()) {
             auto taskCountPreviousRootDevice = event->peekTaskCount();
-            auto tagAddressPreviousRootDevice = event->getCommandQueue()->getCommandStreamReceiver(false).getTagAddress();
+            // tag allocation shares system memory between root devices, semaphore has to use its address mapped on current root device
+            auto graphicsAllocation = event->getCommandQueue()->getCommandStreamReceiver(false).getTagsMultiAllocation()->getGraphicsAllocation(currentCsr.getRootDeviceIndex());
 
-            csrDeps.taskCountContainer.push_back({taskCountPreviousRootDevice, reinterpret_cast<uint64_t>(tagAddressPreviousRootDevice)});
+            csrDeps.taskCountContainer.push_back({taskCountPreviousRootDevice, graphicsAllocation->getGpuAddress()});
 
-            auto graphicsAllocation = event->getCommandQueue()->getCommandStreamReceiver(false).getTagsMultiAllocation()->getGraphicsAllocation(currentCsr.getRootDeviceIndex());
             currentCsr.getResidencyAllocations().push_back(graphicsAllocation);
         }
     }
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/os_interface/os_context.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/command_queue/command_queue.h"
@@ -70,6 +71,12 @@ inline void getHostQueueInfo(CommandQueue *queue, cl_command_queue_info paramNam
     case CL_QUEUE_INDEX_INTEL:
         retVal = changeGetInfoStatusToCLResultType(getInfoHelper.set<cl_uint>(queue->getQueueIndexWithinFamily()));
         break;
+    case CL_QUEUE_PRIORITY_HONORED_INTEL: {
+        auto osContext = queue->getGpgpuEngine().osContext;
+        osContext->ensureContextInitialized();
+        retVal = changeGetInfoStatusToCLResultType(getInfoHelper.set<cl_bool>(osContext->isPriorityHonored() ? CL_TRUE : CL_FALSE));
+        break;
+    }
     default:
         getIntelQueueInfo(queue, paramName, getInfoHelper, retVal);
         break;
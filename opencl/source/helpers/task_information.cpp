@@ -31,6 +31,26 @@ namespace NEO {
 template void KernelOperation::ResourceCleaner::operator()<LinearStream>(LinearStream *);
 template void KernelOperation::ResourceCleaner::operator()<IndirectHeap>(IndirectHeap *);
 
+void KernelOperation::resetForReuse() {
+    if (ioh.get() == dsh.get()) {
+        ioh.release();
+    }
+    dsh.reset();
+    ioh.reset();
+    ssh.reset();
+
+    if (commandStream->getGraphicsAllocation()) {
+        resourceCleaner.storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(commandStream->getGraphicsAllocation()),
+                                                               REUSABLE_ALLOCATION);
+        commandStream->replaceGraphicsAllocation(nullptr);
+        commandStream->replaceBuffer(nullptr, 0);
+    }
+
+    blitPropertiesContainer.clear();
+    blitEnqueue = false;
+    surfaceStateHeapSizeEM = 0;
+}
+
 CommandMapUnmap::CommandMapUnmap(MapOperationType operationType, MemObj &memObj, MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset, bool readOnly,
                                  CommandQueue &commandQueue)
     : Command(commandQueue), memObj(memObj), copySize(copySize), copyOffset(copyOffset), readOnly(readOnly), operationType(operationType) {
@@ -304,6 +324,9 @@ void CommandWithoutKernel::dispatchBlitOperation() {
     UNRECOVERABLE_IF(kernelOperation->blitPropertiesContainer.size() != 1);
     auto &blitProperties = *kernelOperation->blitPropertiesContainer.begin();
     eventsRequest.fillCsrDependenciesForTimestampPacketContainer(blitProperties.csrDependencies, *bcsCsr, CsrDependencies::DependenciesType::All);
+    if (commandQueue.getContext().getRootDeviceIndices().size() > 1) {
+        eventsRequest.fillCsrDependenciesForTaskCountContainer(blitProperties.csrDependencies, *bcsCsr);
+    }
     blitProperties.csrDependencies.timestampPacketContainer.push_back(&timestampPacketDependencies->cacheFlushNodes);
     blitProperties.csrDependencies.timestampPacketContainer.push_back(&timestampPacketDependencies->previousEnqueueNodes);
     blitProperties.csrDependencies.timestampPacketContainer.push_back(&timestampPacketDependencies->barrierNodes);
@@ -414,6 +437,9 @@ void Command::setTimestampPacketNode(TimestampPacketContainer &current, Timestam
 }
 
 Command::~Command() {
+    if (kernelOperation) {
+        commandQueue.releaseBlockedCommandsData(std::move(kernelOperation));
+    }
     auto &commandStreamReceiver = commandQueue.getGpgpuCommandStreamReceiver();
     if (commandStreamReceiver.peekTimestampPacketWriteEnabled()) {
         for (cl_event &eventFromWaitList : eventsWaitlist) {
@@ -71,6 +71,11 @@ struct KernelOperation {
         }
     }
 
+    InternalAllocationStorage *getAllocationStorage() const { return resourceCleaner.storageForAllocations; }
+
+    // returns allocations to reuse list and drops heaps, command stream object is kept for next blocked enqueue
+    void resetForReuse();
+
     LinearStreamUniquePtrT commandStream{nullptr, resourceCleaner};
     IndirectHeapUniquePtrT dsh{nullptr, resourceCleaner};
     IndirectHeapUniquePtrT ioh{nullptr, resourceCleaner};
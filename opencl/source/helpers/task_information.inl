@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,10 @@
 namespace NEO {
 template <typename ObjectT>
 void KernelOperation::ResourceCleaner::operator()(ObjectT *object) {
-    storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(object->getGraphicsAllocation()),
-                                           REUSABLE_ALLOCATION);
+    if (object->getGraphicsAllocation()) {
+        storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(object->getGraphicsAllocation()),
+                                               REUSABLE_ALLOCATION);
+    }
     delete object;
 }
 } // namespace NEO
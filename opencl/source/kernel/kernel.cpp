@@ -17,6 +17,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -44,6 +45,7 @@
 #include "opencl/source/kernel/image_transformer.h"
 #include "opencl/source/kernel/kernel.inl"
 #include "opencl/source/kernel/kernel_info_cl.h"
+#include "opencl/source/kernel/kernel_tuning_database.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/mem_obj/pipe.h"
@@ -738,7 +740,12 @@ void Kernel::substituteKernelHeap(void *newKernelHeap, size_t newKernelHeapSize)
     const auto &hwInfo = clDevice.getHardwareInfo();
     auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
     size_t isaPadding = hwHelper.getPaddingForISAAllocation();
-    if (currentAllocationSize >= newKernelHeapSize + isaPadding) {
+    // ISA shared with other kernels is never overwritten, substituted heap gets its own allocation
+    bool isaShared = false == memoryManager->getKernelIsaCache().releaseAllocation(pKernelInfo->kernelAllocation);
+    if (isaShared) {
+        pKernelInfo->kernelAllocation = nullptr;
+        status = pKernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn);
+    } else if (currentAllocationSize >= newKernelHeapSize + isaPadding) {
         auto &hwInfo = clDevice.getDevice().getHardwareInfo();
         auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
         status = MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *pKernelInfo->getGraphicsAllocation()),
@@ -799,6 +806,82 @@ void Kernel::resizeSurfaceStateHeap(void *pNewSsh, size_t newSshSize, size_t new
 }
 
 cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
+    auto retVal = setArgWithoutResolve(argIndex, argSize, argVal);
+    if (retVal == CL_SUCCESS) {
+        resolveArgs();
+    }
+    return retVal;
+}
+
+cl_int Kernel::setArguments(uint32_t numArgs, const uint32_t *argIndices, const size_t *argSizes, const void *const *argValues) {
+    for (uint32_t i = 0; i < numArgs; i++) {
+        auto argIndex = argIndices[i];
+        if (argIndex >= getKernelArgsNumber()) {
+            return CL_INVALID_ARG_INDEX;
+        }
+        auto retVal = checkCorrectImageAccessQualifier(argIndex, argSizes[i], argValues[i]);
+        if (retVal != CL_SUCCESS) {
+            unsetArg(argIndex);
+            return retVal;
+        }
+        retVal = setArgWithoutResolve(argIndex, argSizes[i], argValues[i]);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+    }
+    // image transformation depends on all arguments, so it is resolved once per batch
+    resolveArgs();
+    return CL_SUCCESS;
+}
+
+bool Kernel::findReusableIndirectData(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t &offsetIndirectData) {
+    if (DebugManager.flags.EnableIndirectDataReuse.get() != 1 || isSchedulerKernel || DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+        return false;
+    }
+    auto &upload = lastIndirectDataUpload;
+    std::unique_lock<std::mutex> lock(upload.mtx, std::try_to_lock);
+    if (!lock.owns_lock() || !ioh.getGraphicsAllocation() || upload.heapGeneration != ioh.getBufferGeneration()) {
+        return false;
+    }
+    // per thread data is fully determined by local work size, so matching cross thread data means identical indirect data
+    if (upload.crossThreadDataSize != crossThreadDataSize || upload.usesOnlyImages != usingImagesOnly ||
+        upload.localWorkSize[0] != localWorkSize[0] || upload.localWorkSize[1] != localWorkSize[1] || upload.localWorkSize[2] != localWorkSize[2] ||
+        memcmp(upload.crossThreadData.get(), crossThreadData, crossThreadDataSize) != 0) {
+        return false;
+    }
+    offsetIndirectData = upload.offset;
+    return true;
+}
+
+void Kernel::storeIndirectDataUpload(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t offsetIndirectData) {
+    if (DebugManager.flags.EnableIndirectDataReuse.get() != 1 || isSchedulerKernel || !ioh.getGraphicsAllocation()) {
+        return;
+    }
+    auto &upload = lastIndirectDataUpload;
+    std::unique_lock<std::mutex> lock(upload.mtx, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+    if (upload.crossThreadDataSize != crossThreadDataSize) {
+        upload.crossThreadData.reset(new char[crossThreadDataSize]);
+        upload.crossThreadDataSize = crossThreadDataSize;
+    }
+    memcpy_s(upload.crossThreadData.get(), upload.crossThreadDataSize, crossThreadData, crossThreadDataSize);
+    for (auto dim = 0u; dim < 3; dim++) {
+        upload.localWorkSize[dim] = localWorkSize[dim];
+    }
+    upload.heapGeneration = ioh.getBufferGeneration();
+    upload.offset = offsetIndirectData;
+    upload.usesOnlyImages = usingImagesOnly;
+}
+
+bool Kernel::isArgUnchanged(uint32_t argIndex, kernelArgType argType, const void *argObject, uint64_t objectGeneration) const {
+    const auto &argInfo = kernelArguments[argIndex];
+    return argInfo.isPatched && (argInfo.type == argType) && (argInfo.object == argObject) && (argInfo.objectGeneration == objectGeneration) &&
+           !DebugManager.flags.AddPatchInfoCommentsForAUBDump.get();
+}
+
+cl_int Kernel::setArgWithoutResolve(uint32_t argIndex, size_t argSize, const void *argVal) {
     cl_int retVal = CL_SUCCESS;
     bool updateExposedKernel = true;
     auto argWasUncacheable = false;
@@ -820,7 +903,6 @@ cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
         }
         auto argIsUncacheable = kernelArguments[argIndex].isStatelessUncacheable;
         statelessUncacheableArgsCount += (argIsUncacheable ? 1 : 0) - (argWasUncacheable ? 1 : 0);
-        resolveArgs();
     }
     return retVal;
 }
@@ -885,6 +967,11 @@ cl_int Kernel::setArgSvm(uint32_t argIndex, size_t svmAllocSize, void *svmPtr, G
 cl_int Kernel::setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocation *svmAlloc) {
     DBG_LOG_INPUTS("setArgBuffer svm_alloc", svmAlloc);
 
+    auto svmAllocGeneration = svmAlloc ? svmAlloc->getGpuAddress() : 0u;
+    if (isArgUnchanged(argIndex, SVM_ALLOC_OBJ, svmAlloc, svmAllocGeneration) && (kernelArguments[argIndex].value == svmPtr)) {
+        return CL_SUCCESS;
+    }
+
     const auto &argAsPtr = getKernelInfo().kernelDescriptor.payloadMappings.explicitArgs[argIndex].as<ArgDescPointer>();
 
     auto patchLocation = ptrOffset(getCrossThreadData(), argAsPtr.stateless);
@@ -906,6 +993,10 @@ cl_int Kernel::setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocatio
                clHwHelper.requiresNonAuxMode(argAsPtr)) {
         forceNonAuxMode = true;
     }
+    if (svmAlloc && svmAlloc->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED &&
+        !isAuxTranslationKernel && argAsPtr.isPureStateful()) {
+        svmAlloc->getCompressionStatistics().statefulAccesses++;
+    }
 
     void *ptrToPatch = patchBufferOffset(argAsPtr, svmPtr, svmAlloc);
     if (isValidOffset(argAsPtr.bindful)) {
@@ -922,6 +1013,7 @@ cl_int Kernel::setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocatio
     }
 
     storeKernelArg(argIndex, SVM_ALLOC_OBJ, svmAlloc, svmPtr, sizeof(uintptr_t));
+    kernelArguments[argIndex].objectGeneration = svmAllocGeneration;
     if (!kernelArguments[argIndex].isPatched) {
         patchedArgumentsNum++;
         kernelArguments[argIndex].isPatched = true;
@@ -1103,8 +1195,15 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
         KernelConfig config{gws, lws, offsets};
 
         auto submissionDataIt = this->kernelSubmissionMap.find(config);
+        auto tuningDatabase = this->clDevice.getKernelTuningDatabase();
         if (submissionDataIt == this->kernelSubmissionMap.end()) {
             KernelSubmissionData submissionData;
+            if (tuningDatabase && tuningDatabase->findSingleSubdevicePreference(this->getIsaHash(), gws, lws, offsets, submissionData.singleSubdevicePrefered)) {
+                submissionData.status = TunningStatus::TUNNING_DONE;
+                this->singleSubdevicePreferedInCurrentEnqueue = submissionData.singleSubdevicePrefered;
+                this->kernelSubmissionMap[config] = std::move(submissionData);
+                return;
+            }
             submissionData.kernelStandardTimestamps = std::make_unique<TimestampPacketContainer>();
             submissionData.kernelSubdeviceTimestamps = std::make_unique<TimestampPacketContainer>();
             submissionData.status = TunningStatus::STANDARD_TUNNING_IN_PROGRESS;
@@ -1126,6 +1225,9 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
                 submissionData.kernelStandardTimestamps.reset();
                 submissionData.kernelSubdeviceTimestamps.reset();
                 this->singleSubdevicePreferedInCurrentEnqueue = submissionData.singleSubdevicePrefered;
+                if (tuningDatabase) {
+                    tuningDatabase->storeSingleSubdevicePreference(this->getIsaHash(), gws, lws, offsets, submissionData.singleSubdevicePrefered);
+                }
             } else {
                 this->singleSubdevicePreferedInCurrentEnqueue = false;
             }
@@ -1139,6 +1241,13 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
     }
 }
 
+uint64_t Kernel::getIsaHash() {
+    if (this->isaHash == 0u) {
+        this->isaHash = Hash::hash(reinterpret_cast<const char *>(kernelInfo.heapInfo.pKernelHeap), kernelInfo.heapInfo.KernelHeapSize);
+    }
+    return this->isaHash;
+}
+
 bool Kernel::hasTunningFinished(KernelSubmissionData &submissionData) {
     if (!this->hasRunFinished(submissionData.kernelStandardTimestamps.get()) ||
         !this->hasRunFinished(submissionData.kernelSubdeviceTimestamps.get())) {
@@ -1159,6 +1268,98 @@ bool Kernel::hasTunningFinished(KernelSubmissionData &submissionData) {
     return true;
 }
 
+bool Kernel::isLocalWorkSizeTuningAllowed() const {
+    return !isBuiltIn && !isParentKernel && !requiresLimitedWorkgroupSize();
+}
+
+Vec3<size_t> Kernel::getTunedLocalWorkSize(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws) {
+    if (gws.x * gws.y * gws.z == 0 || defaultLws.x * defaultLws.y * defaultLws.z == 0) {
+        return defaultLws;
+    }
+
+    std::lock_guard<std::mutex> lock(localWorkSizeTuningMtx);
+    KernelConfig config{gws, {0, 0, 0}, {0, 0, 0}};
+    auto tuningDataIt = localWorkSizeTuningMap.find(config);
+    if (tuningDataIt == localWorkSizeTuningMap.end()) {
+        LocalWorkSizeTuningData tuningData;
+        auto tuningDatabase = clDevice.getKernelTuningDatabase();
+        if (tuningDatabase && tuningDatabase->findLocalWorkSize(getIsaHash(), gws, tuningData.tunedLws)) {
+            tuningData.tunningDone = true;
+        } else {
+            computeWorkgroupSizeCandidates(gws, defaultLws, getMaxKernelWorkGroupSize(), kernelInfo.getMaxSimdSize(), tuningData.candidates);
+            if (tuningData.candidates.size() < 2) {
+                tuningData.tunedLws = defaultLws;
+                tuningData.tunningDone = true;
+            }
+        }
+        tuningDataIt = localWorkSizeTuningMap.emplace(config, std::move(tuningData)).first;
+    }
+
+    auto &tuningData = tuningDataIt->second;
+    if (tuningData.tunningDone) {
+        return tuningData.tunedLws;
+    }
+    if (tuningData.timestamps.size() < tuningData.candidates.size()) {
+        return tuningData.candidates[tuningData.timestamps.size()];
+    }
+    if (hasLocalWorkSizeTunningFinished(tuningData)) {
+        auto tuningDatabase = clDevice.getKernelTuningDatabase();
+        if (tuningDatabase) {
+            tuningDatabase->storeLocalWorkSize(getIsaHash(), gws, tuningData.tunedLws);
+        }
+        return tuningData.tunedLws;
+    }
+    return tuningData.candidates[0];
+}
+
+void Kernel::performLocalWorkSizeTuning(const Vec3<size_t> &gws, const Vec3<size_t> &lws, TimestampPacketContainer *timestampContainer) {
+    std::lock_guard<std::mutex> lock(localWorkSizeTuningMtx);
+    auto tuningDataIt = localWorkSizeTuningMap.find(KernelConfig{gws, {0, 0, 0}, {0, 0, 0}});
+    if (tuningDataIt == localWorkSizeTuningMap.end() || tuningDataIt->second.tunningDone) {
+        return;
+    }
+
+    auto &tuningData = tuningDataIt->second;
+    auto launchedCandidates = tuningData.timestamps.size();
+    if (launchedCandidates == tuningData.candidates.size() || tuningData.candidates[launchedCandidates] != lws) {
+        return;
+    }
+    if (timestampContainer == nullptr) {
+        // without timestamps launches cannot be compared, heuristic choice is kept
+        tuningData.tunedLws = tuningData.candidates[0];
+        tuningData.tunningDone = true;
+        tuningData.timestamps.clear();
+        return;
+    }
+
+    auto timestamps = std::make_unique<TimestampPacketContainer>();
+    timestamps->assignAndIncrementNodesRefCounts(*timestampContainer);
+    tuningData.timestamps.push_back(std::move(timestamps));
+}
+
+bool Kernel::hasLocalWorkSizeTunningFinished(LocalWorkSizeTuningData &tuningData) {
+    for (auto &timestamps : tuningData.timestamps) {
+        if (!this->hasRunFinished(timestamps.get())) {
+            return false;
+        }
+    }
+
+    uint64_t fastestTSDiff = std::numeric_limits<uint64_t>::max();
+    for (size_t i = 0; i < tuningData.candidates.size(); i++) {
+        uint64_t globalStartTS = 0u;
+        uint64_t globalEndTS = 0u;
+        Event::getBoundaryTimestampValues(tuningData.timestamps[i].get(), globalStartTS, globalEndTS);
+        if (globalEndTS - globalStartTS < fastestTSDiff) {
+            fastestTSDiff = globalEndTS - globalStartTS;
+            tuningData.tunedLws = tuningData.candidates[i];
+        }
+    }
+
+    tuningData.tunningDone = true;
+    tuningData.timestamps.clear();
+    return true;
+}
+
 bool Kernel::hasRunFinished(TimestampPacketContainer *timestampContainer) {
     for (const auto &node : timestampContainer->peekNodes()) {
         if (!node->isCompleted()) {
@@ -1356,11 +1557,18 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
         auto clMemObj = *clMem;
         DBG_LOG_INPUTS("setArgBuffer cl_mem", clMemObj);
 
+        auto buffer = castToObject<Buffer>(clMemObj);
+        // patched surface state and address are still valid, shared objects are repatched after acquire
+        if (buffer && !buffer->peekSharingHandler() && isArgUnchanged(argIndex, BUFFER_OBJ, clMemObj, buffer->getGeneration())) {
+            kernelArguments[argIndex].value = argVal;
+            return CL_SUCCESS;
+        }
+
         storeKernelArg(argIndex, BUFFER_OBJ, clMemObj, argVal, argSize);
 
-        auto buffer = castToObject<Buffer>(clMemObj);
         if (!buffer)
             return CL_INVALID_MEM_OBJECT;
+        kernelArguments[argIndex].objectGeneration = buffer->getGeneration();
 
         if (buffer->peekSharingHandler()) {
             usingSharedObjArgs = true;
@@ -1397,6 +1605,10 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
                    clHwHelper.requiresNonAuxMode(argAsPtr)) {
             forceNonAuxMode = true;
         }
+        if (graphicsAllocation->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED &&
+            !isAuxTranslationKernel && argAsPtr.isPureStateful()) {
+            graphicsAllocation->getCompressionStatistics().statefulAccesses++;
+        }
 
         if (isValidOffset(argAsPtr.bindful)) {
             auto surfaceState = ptrOffset(getSurfaceStateHeap(), argAsPtr.bindful);
@@ -1510,7 +1722,16 @@ cl_int Kernel::setArgImageWithMipLevel(uint32_t argIndex,
 
         DBG_LOG_INPUTS("setArgImage cl_mem", clMemObj);
 
+        // surface state encoded for the same image and mip level is still valid, shared objects are repatched after acquire
+        if (!pImage->peekSharingHandler() && mipLevel == 0u && pImage->getImageDesc().image_type != CL_MEM_OBJECT_IMAGE3D &&
+            isArgUnchanged(argIndex, IMAGE_OBJ, clMemObj, pImage->getGeneration())) {
+            kernelArguments[argIndex].value = argVal;
+            return CL_SUCCESS;
+        }
+
         storeKernelArg(argIndex, IMAGE_OBJ, clMemObj, argVal, argSize);
+        // arguments set with non zero mip level are always encoded again
+        kernelArguments[argIndex].objectGeneration = (mipLevel == 0u) ? pImage->getGeneration() : 0u;
 
         DEBUG_BREAK_IF(isUndefinedOffset(argAsImg.bindful));
         auto surfaceState = ptrOffset(getSurfaceStateHeap(), argAsImg.bindful);
@@ -2431,6 +2652,7 @@ void Kernel::fillWithKernelObjsForAuxTranslation(KernelObjsForAuxTranslation &ke
             auto buffer = castToObject<Buffer>(getKernelArg(i));
             if (buffer && buffer->getMultiGraphicsAllocation().getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
                 kernelObjsForAuxTranslation.insert({KernelObjForAuxTranslation::Type::MEM_OBJ, buffer});
+                buffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex())->getCompressionStatistics().statelessAccesses++;
                 auto &context = this->program->getContext();
                 if (context.isProvidingPerformanceHints()) {
                     const auto &argExtMeta = kernelInfo.kernelDescriptor.explicitArgsExtendedMetadata[i];
@@ -2443,6 +2665,7 @@ void Kernel::fillWithKernelObjsForAuxTranslation(KernelObjsForAuxTranslation &ke
             auto svmAlloc = reinterpret_cast<GraphicsAllocation *>(const_cast<void *>(getKernelArg(i)));
             if (svmAlloc && svmAlloc->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
                 kernelObjsForAuxTranslation.insert({KernelObjForAuxTranslation::Type::GFX_ALLOC, svmAlloc});
+                svmAlloc->getCompressionStatistics().statelessAccesses++;
                 auto &context = this->program->getContext();
                 if (context.isProvidingPerformanceHints()) {
                     const auto &argExtMeta = kernelInfo.kernelDescriptor.explicitArgsExtendedMetadata[i];
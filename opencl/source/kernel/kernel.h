@@ -29,6 +29,7 @@
 
 #include "csr_properties_flags.h"
 
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -65,6 +66,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         size_t size;
         GraphicsAllocation *pSvmAlloc;
         cl_mem_flags svmFlags;
+        // generation of memory object or gpu address of svm allocation patched into argument
+        uint64_t objectGeneration = 0u;
         bool isPatched = false;
         bool isStatelessUncacheable = false;
     };
@@ -132,6 +135,9 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         return crossThreadDataSize;
     }
 
+    bool findReusableIndirectData(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t &offsetIndirectData);
+    void storeIndirectDataUpload(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t offsetIndirectData);
+
     cl_int initialize();
 
     MOCKABLE_VIRTUAL cl_int cloneKernel(Kernel *pSourceKernel);
@@ -141,6 +147,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     // API entry points
     cl_int setArgument(uint32_t argIndex, size_t argSize, const void *argVal) { return setArg(argIndex, argSize, argVal); }
+    cl_int setArguments(uint32_t numArgs, const uint32_t *argIndices, const size_t *argSizes, const void *const *argValues);
     cl_int setArgSvm(uint32_t argIndex, size_t svmAllocSize, void *svmPtr, GraphicsAllocation *svmAlloc, cl_mem_flags svmFlags);
     cl_int setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocation *svmAlloc);
 
@@ -296,6 +303,10 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     void performKernelTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer);
     MOCKABLE_VIRTUAL bool isSingleSubdevicePreferred() const;
 
+    bool isLocalWorkSizeTuningAllowed() const;
+    Vec3<size_t> getTunedLocalWorkSize(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws);
+    void performLocalWorkSizeTuning(const Vec3<size_t> &gws, const Vec3<size_t> &lws, TimestampPacketContainer *timestampContainer);
+
     //residency for kernel surfaces
     MOCKABLE_VIRTUAL void makeResident(CommandStreamReceiver &commandStreamReceiver);
     MOCKABLE_VIRTUAL void getResidency(std::vector<Surface *> &dst);
@@ -352,6 +363,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     void setAuxTranslationDirection(AuxTranslationDirection auxTranslationDirection) {
         this->auxTranslationDirection = auxTranslationDirection;
     }
+    AuxTranslationDirection getAuxTranslationDirection() const { return auxTranslationDirection; }
     void setUnifiedMemorySyncRequirement(bool isUnifiedMemorySyncRequired) {
         this->isUnifiedMemorySyncRequired = isUnifiedMemorySyncRequired;
     }
@@ -402,6 +414,9 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool areMultipleSubDevicesInContext() const;
 
   protected:
+    cl_int setArgWithoutResolve(uint32_t argIndex, size_t argSize, const void *argVal);
+    bool isArgUnchanged(uint32_t argIndex, kernelArgType argType, const void *argObject, uint64_t objectGeneration) const;
+
     struct ObjectCounts {
         uint32_t imageCount;
         uint32_t samplerCount;
@@ -574,6 +589,17 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     char *crossThreadData = nullptr;
     uint32_t crossThreadDataSize = 0u;
 
+    // cross thread and per thread data uploaded to indirect object heap by last launch
+    struct IndirectDataUpload {
+        std::mutex mtx;
+        std::unique_ptr<char[]> crossThreadData;
+        uint32_t crossThreadDataSize = 0u;
+        size_t localWorkSize[3] = {};
+        uint64_t heapGeneration = 0u;
+        size_t offset = 0u;
+        bool usesOnlyImages = false;
+    } lastIndirectDataUpload;
+
     GraphicsAllocation *privateSurface = nullptr;
     uint64_t privateSurfaceSize = 0u;
 
@@ -613,10 +639,25 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     };
 
     bool hasTunningFinished(KernelSubmissionData &submissionData);
+    uint64_t getIsaHash();
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
 
     std::unordered_map<KernelConfig, KernelSubmissionData, KernelConfigHash> kernelSubmissionMap;
+
+    // launches with NULL local size try few candidates one by one, the fastest one is used afterwards
+    struct LocalWorkSizeTuningData {
+        std::vector<Vec3<size_t>> candidates;
+        std::vector<std::unique_ptr<TimestampPacketContainer>> timestamps;
+        Vec3<size_t> tunedLws{0, 0, 0};
+        bool tunningDone = false;
+    };
+
+    bool hasLocalWorkSizeTunningFinished(LocalWorkSizeTuningData &tuningData);
+
+    std::unordered_map<KernelConfig, LocalWorkSizeTuningData, KernelConfigHash> localWorkSizeTuningMap;
+    std::mutex localWorkSizeTuningMtx;
     bool singleSubdevicePreferedInCurrentEnqueue = false;
+    uint64_t isaHash = 0u;
 
     bool kernelHasIndirectAccess = true;
     MultiDeviceKernel *pMultiDeviceKernel = nullptr;
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/kernel/kernel_tuning_database.h"
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hw_info.h"
+
+#include <sstream>
+
+namespace NEO {
+
+KernelTuningDatabase::KernelTuningDatabase(const std::string &directory, const HardwareInfo &hwInfo, uint32_t numSubDevices) {
+    std::stringstream stream;
+    stream << directory << "/kernel_tuning_" << std::hex << hwInfo.platform.usDeviceID << "_" << hwInfo.platform.usRevId
+           << "_" << std::dec << numSubDevices << ".db";
+    fileName = stream.str();
+}
+
+std::string KernelTuningDatabase::createKey(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, const Vec3<size_t> &offsets) {
+    std::stringstream stream;
+    stream << std::hex << isaHash << std::dec
+           << " " << gws.x << " " << gws.y << " " << gws.z
+           << " " << lws.x << " " << lws.y << " " << lws.z
+           << " " << offsets.x << " " << offsets.y << " " << offsets.z;
+    return stream.str();
+}
+
+void KernelTuningDatabase::loadEntries(std::unordered_map<std::string, std::string> &target) {
+    size_t fileSize = 0;
+    auto fileData = loadDataFromFile(fileName.c_str(), fileSize);
+    if (fileSize == 0) {
+        return;
+    }
+
+    // each line holds key followed by value made of digits and commas, malformed lines are skipped
+    std::stringstream stream(std::string(fileData.get(), fileSize));
+    std::string line;
+    while (std::getline(stream, line)) {
+        auto separator = line.find_last_of(' ');
+        if (separator == std::string::npos || separator + 1 == line.size()) {
+            continue;
+        }
+        auto value = line.substr(separator + 1);
+        if (value.find_first_not_of("0123456789,") != std::string::npos) {
+            continue;
+        }
+        target[line.substr(0, separator)] = value;
+    }
+}
+
+void KernelTuningDatabase::load() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (loaded) {
+        return;
+    }
+    loadEntries(entries);
+    loaded = true;
+}
+
+size_t KernelTuningDatabase::getEntriesCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+bool KernelTuningDatabase::findEntry(const std::string &key, std::string &value) {
+    load();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        return false;
+    }
+    value = entry->second;
+    return true;
+}
+
+void KernelTuningDatabase::storeEntry(const std::string &key, const std::string &value) {
+    load();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    entries[key] = value;
+
+    // entries stored in the meantime by other devices or processes are merged before file is rewritten
+    std::unordered_map<std::string, std::string> fileEntries;
+    loadEntries(fileEntries);
+    for (const auto &entry : entries) {
+        fileEntries[entry.first] = entry.second;
+    }
+    entries = fileEntries;
+
+    std::string fileContent;
+    for (const auto &entry : entries) {
+        fileContent += entry.first + " " + entry.second + "\n";
+    }
+    writeDataToFile(fileName.c_str(), fileContent.c_str(), fileContent.size());
+}
+
+bool KernelTuningDatabase::findSingleSubdevicePreference(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, const Vec3<size_t> &offsets, bool &singleSubdevicePrefered) {
+    std::string value;
+    if (!findEntry(createKey(isaHash, gws, lws, offsets), value) || (value != "0" && value != "1")) {
+        return false;
+    }
+    singleSubdevicePrefered = (value == "1");
+    return true;
+}
+
+void KernelTuningDatabase::storeSingleSubdevicePreference(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, const Vec3<size_t> &offsets, bool singleSubdevicePrefered) {
+    storeEntry(createKey(isaHash, gws, lws, offsets), singleSubdevicePrefered ? "1" : "0");
+}
+
+bool KernelTuningDatabase::findLocalWorkSize(uint64_t isaHash, const Vec3<size_t> &gws, Vec3<size_t> &lws) {
+    std::string value;
+    if (!findEntry("lws " + createKey(isaHash, gws, {0, 0, 0}, {0, 0, 0}), value)) {
+        return false;
+    }
+
+    Vec3<size_t> storedLws{0, 0, 0};
+    char separator0 = 0, separator1 = 0;
+    std::stringstream stream(value);
+    stream >> storedLws.x >> separator0 >> storedLws.y >> separator1 >> storedLws.z;
+    if (stream.fail() || separator0 != ',' || separator1 != ',' || storedLws.x * storedLws.y * storedLws.z == 0) {
+        return false;
+    }
+    lws = storedLws;
+    return true;
+}
+
+void KernelTuningDatabase::storeLocalWorkSize(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws) {
+    std::stringstream value;
+    value << lws.x << "," << lws.y << "," << lws.z;
+    storeEntry("lws " + createKey(isaHash, gws, {0, 0, 0}, {0, 0, 0}), value.str());
+}
+} // namespace NEO
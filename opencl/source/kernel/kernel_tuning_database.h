@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/vec.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+struct HardwareInfo;
+
+// Outcomes of full kernel tunning kept on disk, so next runs of application use tunned choices from first launch.
+// Entries are keyed by kernel ISA hash and dispatch config, each device configuration has its own database file.
+// Besides single sub-device preference, local work sizes selected by tunning of NULL local size launches are kept.
+class KernelTuningDatabase : NonCopyableOrMovableClass {
+  public:
+    KernelTuningDatabase(const std::string &directory, const HardwareInfo &hwInfo, uint32_t numSubDevices);
+
+    void load();
+
+    bool findSingleSubdevicePreference(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, const Vec3<size_t> &offsets, bool &singleSubdevicePrefered);
+    void storeSingleSubdevicePreference(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, const Vec3<size_t> &offsets, bool singleSubdevicePrefered);
+
+    bool findLocalWorkSize(uint64_t isaHash, const Vec3<size_t> &gws, Vec3<size_t> &lws);
+    void storeLocalWorkSize(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws);
+
+    const std::string &getFileName() const { return fileName; }
+    size_t getEntriesCount();
+
+    static std::string createKey(uint64_t isaHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, const Vec3<size_t> &offsets);
+
+  protected:
+    bool findEntry(const std::string &key, std::string &value);
+    void storeEntry(const std::string &key, const std::string &value);
+    void loadEntries(std::unordered_map<std::string, std::string> &target);
+
+    std::string fileName;
+    std::unordered_map<std::string, std::string> entries;
+    std::mutex mtx;
+    bool loaded = false;
+};
+} // namespace NEO
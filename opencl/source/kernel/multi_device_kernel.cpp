@@ -6,6 +6,18 @@
  */
 
 #include "opencl/source/kernel/multi_device_kernel.h"
+
+#include "shared/source/helpers/bit_helpers.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/context/context.h"
+#include "opencl/source/event/event.h"
+#include "opencl/source/mem_obj/mem_obj.h"
+
+#include <algorithm>
+
 namespace NEO {
 
 MultiDeviceKernel::~MultiDeviceKernel() {
@@ -48,6 +60,7 @@ bool MultiDeviceKernel::getHasIndirectAccess() const { return defaultKernel->get
 cl_int MultiDeviceKernel::checkCorrectImageAccessQualifier(cl_uint argIndex, size_t argSize, const void *argValue) const { return getResultFromEachKernel(&Kernel::checkCorrectImageAccessQualifier, argIndex, argSize, argValue); }
 void MultiDeviceKernel::unsetArg(uint32_t argIndex) { callOnEachKernel(&Kernel::unsetArg, argIndex); }
 cl_int MultiDeviceKernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) { return getResultFromEachKernel(&Kernel::setArgument, argIndex, argSize, argVal); }
+cl_int MultiDeviceKernel::setArguments(uint32_t numArgs, const uint32_t *argIndices, const size_t *argSizes, const void *const *argValues) { return getResultFromEachKernel(&Kernel::setArguments, numArgs, argIndices, argSizes, argValues); }
 void MultiDeviceKernel::setUnifiedMemoryProperty(cl_kernel_exec_info infoType, bool infoValue) { callOnEachKernel(&Kernel::setUnifiedMemoryProperty, infoType, infoValue); }
 void MultiDeviceKernel::clearSvmKernelExecInfo() { callOnEachKernel(&Kernel::clearSvmKernelExecInfo); }
 void MultiDeviceKernel::clearUnifiedMemoryExecInfo() { callOnEachKernel(&Kernel::clearUnifiedMemoryExecInfo); }
@@ -91,4 +104,167 @@ void MultiDeviceKernel::setUnifiedMemoryExecInfo(const MultiGraphicsAllocation &
         }
     }
 }
+
+bool MultiDeviceKernel::canSplitAcrossRootDevices(CommandQueue &commandQueue, cl_uint workDim, const size_t *globalWorkSize) const {
+    if (!splitAcrossRootDevices || globalWorkSize == nullptr || getHasIndirectAccess()) {
+        return false;
+    }
+    for (cl_uint dim = 0; dim < workDim; dim++) {
+        if (globalWorkSize[dim] == 0) {
+            return false;
+        }
+    }
+
+    auto &context = commandQueue.getContext();
+    size_t rootDevicesCount = 0;
+    for (auto rootDeviceIndex : context.getRootDeviceIndices()) {
+        if (kernels[rootDeviceIndex] && context.getSpecialQueue(rootDeviceIndex)) {
+            rootDevicesCount++;
+        }
+    }
+    if (rootDevicesCount < 2) {
+        return false;
+    }
+
+    // partitions run concurrently, so every argument has to be valid on each root device at the same time
+    auto svmAllocsManager = context.getSVMAllocsManager();
+    for (const auto &kernelArg : getKernelArguments()) {
+        switch (kernelArg.type) {
+        case Kernel::NONE_OBJ:
+        case Kernel::SLM_OBJ:
+        case Kernel::SAMPLER_OBJ:
+            break;
+        case Kernel::BUFFER_OBJ: {
+            // each root device works on its own copy of buffer, writes could not be merged
+            auto memObj = castToObject<MemObj>(static_cast<cl_mem>(kernelArg.object));
+            if (memObj && !isValueSet(memObj->getFlags(), CL_MEM_READ_ONLY)) {
+                return false;
+            }
+            break;
+        }
+        case Kernel::SVM_OBJ:
+        case Kernel::SVM_ALLOC_OBJ: {
+            if (kernelArg.value == nullptr) {
+                break;
+            }
+            // host allocation is the same memory mapped on every root device
+            auto svmData = svmAllocsManager ? svmAllocsManager->getSVMAlloc(kernelArg.value) : nullptr;
+            if (svmData == nullptr || svmData->memoryType != InternalMemoryType::HOST_UNIFIED_MEMORY) {
+                return false;
+            }
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+void MultiDeviceKernel::partitionRange(size_t range, size_t granularity, const StackVec<uint64_t, 4> &weights, StackVec<size_t, 4> &partitionSizes) {
+    partitionSizes.clear();
+    granularity = std::max(granularity, static_cast<size_t>(1u));
+
+    uint64_t totalWeight = 0;
+    for (auto weight : weights) {
+        totalWeight += weight;
+    }
+
+    uint64_t units = range / granularity;
+    size_t assigned = 0;
+    for (size_t i = 0; i < weights.size(); i++) {
+        size_t partitionSize = 0;
+        if (i + 1 == weights.size()) {
+            // last partition takes rounding leftovers and non-uniform tail
+            partitionSize = range - assigned;
+        } else {
+            auto partitionUnits = totalWeight ? units * weights[i] / totalWeight : units / weights.size();
+            partitionSize = static_cast<size_t>(partitionUnits) * granularity;
+        }
+        partitionSizes.push_back(partitionSize);
+        assigned += partitionSize;
+    }
+}
+
+cl_int MultiDeviceKernel::enqueueAcrossRootDevices(CommandQueue &commandQueue, cl_uint workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                                                   const size_t *localWorkSize, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    auto &context = commandQueue.getContext();
+    auto primaryRootDeviceIndex = commandQueue.getDevice().getRootDeviceIndex();
+
+    StackVec<CommandQueue *, 4> queues;
+    queues.push_back(&commandQueue);
+    for (auto rootDeviceIndex : context.getRootDeviceIndices()) {
+        if (rootDeviceIndex != primaryRootDeviceIndex && kernels[rootDeviceIndex] && context.getSpecialQueue(rootDeviceIndex)) {
+            queues.push_back(context.getSpecialQueue(rootDeviceIndex));
+        }
+    }
+
+    StackVec<uint64_t, 4> weights;
+    for (auto queue : queues) {
+        auto &clDevice = queue->getClDevice();
+        weights.push_back(static_cast<uint64_t>(clDevice.getDeviceInfo().maxComputUnits) * clDevice.getSharedDeviceInfo().maxClockFrequency);
+    }
+
+    uint32_t splitDim = 0;
+    size_t maxGroupsCount = 0;
+    for (uint32_t dim = 0; dim < workDim; dim++) {
+        auto groupsCount = globalWorkSize[dim] / (localWorkSize ? localWorkSize[dim] : 1u);
+        if (groupsCount > maxGroupsCount) {
+            maxGroupsCount = groupsCount;
+            splitDim = dim;
+        }
+    }
+
+    size_t granularity = 1u;
+    if (localWorkSize) {
+        granularity = localWorkSize[splitDim];
+    } else {
+        // keep partitions divisible by reasonable work group size chosen for each of them
+        while (granularity < 256u && globalWorkSize[splitDim] % (granularity * 2) == 0) {
+            granularity *= 2;
+        }
+    }
+
+    StackVec<size_t, 4> partitionSizes;
+    partitionRange(globalWorkSize[splitDim], granularity, weights, partitionSizes);
+
+    size_t partitionOffset[3] = {0, 0, 0};
+    size_t partitionSize[3] = {1, 1, 1};
+    for (uint32_t dim = 0; dim < workDim; dim++) {
+        partitionOffset[dim] = globalWorkOffset ? globalWorkOffset[dim] : 0u;
+        partitionSize[dim] = globalWorkSize[dim];
+    }
+
+    StackVec<cl_event, 4> partitionEvents;
+    cl_int retVal = CL_SUCCESS;
+    for (size_t i = 0; i < queues.size() && retVal == CL_SUCCESS; i++) {
+        if (partitionSizes[i] == 0) {
+            continue;
+        }
+        auto queue = queues[i];
+        partitionSize[splitDim] = partitionSizes[i];
+
+        cl_event partitionEvent = nullptr;
+        retVal = queue->enqueueKernel(kernels[queue->getDevice().getRootDeviceIndex()], workDim, partitionOffset, partitionSize, localWorkSize,
+                                      numEventsInWaitList, eventWaitList, &partitionEvent);
+        if (retVal == CL_SUCCESS) {
+            partitionEvents.push_back(partitionEvent);
+            // primary queue waits for this partition on GPU, so it has to be submitted
+            retVal = queue->flush();
+        }
+        partitionOffset[splitDim] += partitionSizes[i];
+    }
+
+    if (retVal == CL_SUCCESS) {
+        retVal = commandQueue.enqueueMarkerWithWaitList(static_cast<cl_uint>(partitionEvents.size()), &partitionEvents[0], event);
+        if (retVal == CL_SUCCESS && event) {
+            castToObjectOrAbort<Event>(*event)->setCmdType(CL_COMMAND_NDRANGE_KERNEL);
+        }
+    }
+
+    for (auto partitionEvent : partitionEvents) {
+        castToObjectOrAbort<Event>(partitionEvent)->release();
+    }
+    return retVal;
+}
 } // namespace NEO
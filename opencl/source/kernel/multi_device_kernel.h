@@ -9,6 +9,8 @@
 #include "opencl/source/kernel/kernel.h"
 
 namespace NEO {
+class CommandQueue;
+
 template <>
 struct OpenCLObjectMapper<_cl_kernel> {
     typedef class MultiDeviceKernel DerivedType;
@@ -49,6 +51,7 @@ class MultiDeviceKernel : public BaseObject<_cl_kernel> {
     cl_int checkCorrectImageAccessQualifier(cl_uint argIndex, size_t argSize, const void *argValue) const;
     void unsetArg(uint32_t argIndex);
     cl_int setArg(uint32_t argIndex, size_t argSize, const void *argVal);
+    cl_int setArguments(uint32_t numArgs, const uint32_t *argIndices, const size_t *argSizes, const void *const *argValues);
     cl_int getInfo(cl_kernel_info paramName, size_t paramValueSize, void *paramValue, size_t *paramValueSizeRet) const;
     cl_int getArgInfo(cl_uint argIndx, cl_kernel_arg_info paramName, size_t paramValueSize, void *paramValue, size_t *paramValueSizeRet) const;
     const ClDeviceVector &getDevices() const;
@@ -67,6 +70,15 @@ class MultiDeviceKernel : public BaseObject<_cl_kernel> {
     Program *getProgram() const { return program; }
     const KernelInfoContainer &getKernelInfos() const { return kernelInfos; }
 
+    // Splitting single NDRange across all root devices of context, enabled with CL_KERNEL_EXEC_INFO_SPLIT_ACROSS_ROOT_DEVICES_INTEL.
+    // Kernel must not depend on global size or group ids, as each device runs part of range with adjusted global offset.
+    void setSplitAcrossRootDevices(bool split) { splitAcrossRootDevices = split; }
+    bool isSplitAcrossRootDevicesEnabled() const { return splitAcrossRootDevices; }
+    bool canSplitAcrossRootDevices(CommandQueue &commandQueue, cl_uint workDim, const size_t *globalWorkSize) const;
+    cl_int enqueueAcrossRootDevices(CommandQueue &commandQueue, cl_uint workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                                    const size_t *localWorkSize, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+    static void partitionRange(size_t range, size_t granularity, const StackVec<uint64_t, 4> &weights, StackVec<size_t, 4> &partitionSizes);
+
   protected:
     template <typename FuncType, typename... Args>
     cl_int getResultFromEachKernel(FuncType function, Args &&...args) const {
@@ -95,6 +107,7 @@ class MultiDeviceKernel : public BaseObject<_cl_kernel> {
     Kernel *defaultKernel = nullptr;
     Program *program = nullptr;
     const KernelInfoContainer kernelInfos;
+    bool splitAcrossRootDevices = false;
 };
 
 } // namespace NEO
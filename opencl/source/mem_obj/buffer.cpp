@@ -23,6 +23,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/cpu_copy.h"
 #include "shared/source/utilities/debug_settings_reader_creator.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -190,7 +191,8 @@ Buffer *Buffer::create(Context *context,
             *context,
             HwHelper::renderCompressedBuffersSupported(*hwInfo),
             memoryManager->isLocalMemorySupported(rootDeviceIndex),
-            HwHelper::get(hwInfo->platform.eRenderCoreFamily).isBufferSizeSuitableForRenderCompression(size));
+            HwHelper::get(hwInfo->platform.eRenderCoreFamily).isBufferSizeSuitableForRenderCompression(size) ||
+                MemObjHelper::isSuitableForHeuristicCompression(memoryProperties, size));
 
         if (ptr) {
             if (!memoryProperties.flags.useHostPtr) {
@@ -463,8 +465,13 @@ void Buffer::checkMemory(MemoryProperties memoryProperties,
                 errcodeRet = CL_INVALID_HOST_PTR;
                 return;
             }
-            if (alignUp(hostPtr, MemoryConstants::cacheLineSize) != hostPtr ||
-                alignUp(size, MemoryConstants::cacheLineSize) != size ||
+            bool cacheLineAligned = alignUp(hostPtr, MemoryConstants::cacheLineSize) == hostPtr &&
+                                    alignUp(size, MemoryConstants::cacheLineSize) == size;
+            if (DebugManager.flags.AllowZeroCopyForMisalignedUseHostPtr.get()) {
+                // host ptr allocation covers whole pages and offsets gpu address into them, misaligned surfaces are programmed with L3 off
+                cacheLineAligned = true;
+            }
+            if (!cacheLineAligned ||
                 minAddress > reinterpret_cast<uintptr_t>(hostPtr)) {
                 alignementSatisfied = false;
                 copyMemoryFromHostPtr = true;
@@ -586,7 +593,7 @@ void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffs
     DBG_LOG(LogMemoryObject, __FUNCTION__, " hostPtr: ", hostPtr, ", size: ", copySize, ", offset: ", copyOffset, ", memoryStorage: ", memoryStorage);
     auto dstPtr = ptrOffset(dst, copyOffset);
     auto srcPtr = ptrOffset(src, copyOffset);
-    memcpy_s(dstPtr, copySize, srcPtr, copySize);
+    CpuCopy::copy(dstPtr, srcPtr, copySize);
 }
 
 void Buffer::transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
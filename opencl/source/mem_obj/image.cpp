@@ -19,6 +19,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/compiler_support.h"
+#include "shared/source/utilities/cpu_copy.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/cl_device/cl_device_get_cap.inl"
@@ -104,16 +105,12 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
     }
 
     for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
+        auto srcRowOffset = ptrOffset(src, srcSlicePitch * slice + srcRowPitch * copyOrigin[1]);
+        auto dstRowOffset = ptrOffset(dest, destSlicePitch * slice + destRowPitch * copyOrigin[1]);
 
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
-
-            memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
-                     ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
-        }
+        CpuCopy::copyRows(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), destRowPitch,
+                          ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), srcRowPitch,
+                          lineWidth, copyRegion[1]);
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,7 +25,8 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(ptr, mapInfo);
+    addCoverage(castToUint64(ptr), castToUint64(ptrOffset(ptr, ptrLength)));
     return true;
 }
 
@@ -33,42 +34,104 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
+    auto inputStartPtr = castToUint64(inputMapInfo.ptr);
+    auto inputEndPtr = castToUint64(ptrOffset(inputMapInfo.ptr, inputMapInfo.ptrLength));
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
-
-        // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
-            return true;
-        }
+    // Requested ptr starts before or inside existing ptr range and overlapping end.
+    // Covered ranges are disjoint, so the last one starting not after requested end reaches furthest.
+    auto coveredRange = coveredRanges.upper_bound(inputEndPtr);
+    if (coveredRange == coveredRanges.begin()) {
+        return false;
     }
-    return false;
+    coveredRange--;
+    return inputStartPtr < coveredRange->second.end;
 }
 
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto mapInfo = mappedPointers.find(mappedPtr);
+    if (mapInfo == mappedPointers.end()) {
+        return false;
     }
-    return false;
+    outMapInfo = mapInfo->second;
+    return true;
 }
 
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
+    auto mapInfo = mappedPointers.find(mappedPtr);
+    if (mapInfo == mappedPointers.end()) {
+        return;
+    }
+    removeCoverage(castToUint64(mappedPtr), castToUint64(ptrOffset(mappedPtr, mapInfo->second.ptrLength)));
+    mappedPointers.erase(mapInfo);
+}
+
+void MapOperationsHandler::splitCoveredRange(uint64_t address) {
+    auto coveredRange = coveredRanges.upper_bound(address);
+    if (coveredRange == coveredRanges.begin()) {
+        return;
+    }
+    coveredRange--;
+    if (coveredRange->first < address && address < coveredRange->second.end) {
+        coveredRanges[address] = {coveredRange->second.end, coveredRange->second.mappingsCount};
+        coveredRange->second.end = address;
+    }
+}
+
+void MapOperationsHandler::mergeCoveredRanges(uint64_t address) {
+    auto nextRange = coveredRanges.find(address);
+    if (nextRange == coveredRanges.end() || nextRange == coveredRanges.begin()) {
+        return;
+    }
+    auto previousRange = std::prev(nextRange);
+    if (previousRange->second.end == address && previousRange->second.mappingsCount == nextRange->second.mappingsCount) {
+        previousRange->second.end = nextRange->second.end;
+        coveredRanges.erase(nextRange);
+    }
+}
+
+void MapOperationsHandler::addCoverage(uint64_t start, uint64_t end) {
+    if (start == end) {
+        return;
+    }
+    splitCoveredRange(start);
+    splitCoveredRange(end);
+
+    auto address = start;
+    auto coveredRange = coveredRanges.lower_bound(start);
+    while (address < end) {
+        if (coveredRange == coveredRanges.end() || coveredRange->first >= end) {
+            coveredRanges[address] = {end, 1};
             break;
         }
+        if (coveredRange->first > address) {
+            coveredRanges[address] = {coveredRange->first, 1};
+        }
+        coveredRange->second.mappingsCount++;
+        address = coveredRange->second.end;
+        coveredRange++;
+    }
+}
+
+void MapOperationsHandler::removeCoverage(uint64_t start, uint64_t end) {
+    if (start == end) {
+        return;
+    }
+    splitCoveredRange(start);
+    splitCoveredRange(end);
+
+    auto coveredRange = coveredRanges.lower_bound(start);
+    while (coveredRange != coveredRanges.end() && coveredRange->first < end) {
+        if (--coveredRange->second.mappingsCount == 0) {
+            coveredRange = coveredRanges.erase(coveredRange);
+        } else {
+            coveredRange++;
+        }
     }
+    // boundaries introduced by removed mapping are not needed anymore
+    mergeCoveredRanges(start);
+    mergeCoveredRanges(end);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,8 @@
 #pragma once
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <map>
 #include <mutex>
-#include <vector>
 
 namespace NEO {
 
@@ -23,8 +23,22 @@ class MapOperationsHandler {
     size_t size() const;
 
   protected:
+    // disjoint address range covered by mapped pointers, mappingsCount tells how many of them cover it
+    struct CoveredRange {
+        uint64_t end;
+        uint32_t mappingsCount;
+    };
+    using CoveredRanges = std::map<uint64_t, CoveredRange>;
+
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    void addCoverage(uint64_t start, uint64_t end);
+    void removeCoverage(uint64_t start, uint64_t end);
+    void splitCoveredRange(uint64_t address);
+    void mergeCoveredRanges(uint64_t address);
+
+    // same pointer may be mapped multiple times, lookups return mapping added first
+    std::multimap<void *, MapInfo> mappedPointers;
+    CoveredRanges coveredRanges;
     mutable std::mutex mtx;
 };
 
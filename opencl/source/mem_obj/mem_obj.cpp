@@ -24,6 +24,7 @@
 #include "opencl/source/helpers/get_info_status_mapper.h"
 
 #include <algorithm>
+#include <atomic>
 
 namespace NEO {
 
@@ -270,12 +271,19 @@ void MemObj::resetGraphicsAllocation(GraphicsAllocation *newGraphicsAllocation)
     TakeOwnershipWrapper<MemObj> lock(*this);
     checkUsageAndReleaseOldAllocation(newGraphicsAllocation->getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(newGraphicsAllocation);
+    generation = obtainGeneration();
 }
 
 void MemObj::removeGraphicsAllocation(uint32_t rootDeviceIndex) {
     TakeOwnershipWrapper<MemObj> lock(*this);
     checkUsageAndReleaseOldAllocation(rootDeviceIndex);
     multiGraphicsAllocation.removeAllocation(rootDeviceIndex);
+    generation = obtainGeneration();
+}
+
+uint64_t MemObj::obtainGeneration() {
+    static std::atomic<uint64_t> generationsCount{0u};
+    return ++generationsCount;
 }
 
 bool MemObj::readMemObjFlagsInvalid() {
@@ -385,6 +393,13 @@ void *MemObj::getBasePtrForMap(uint32_t rootDeviceIndex) {
 bool MemObj::addMappedPtr(void *ptr, size_t ptrLength, cl_map_flags &mapFlags,
                           MemObjSizeArray &size, MemObjOffsetArray &offset,
                           uint32_t mipLevel) {
+    if (multiGraphicsAllocation.getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
+        for (auto &graphicsAllocation : multiGraphicsAllocation.getGraphicsAllocations()) {
+            if (graphicsAllocation) {
+                graphicsAllocation->getCompressionStatistics().cpuAccesses++;
+            }
+        }
+    }
     return mapOperationsHandler.add(ptr, ptrLength, mapFlags, size, offset,
                                     mipLevel);
 }
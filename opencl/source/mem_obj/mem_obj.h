@@ -85,6 +85,8 @@ class MemObj : public BaseObject<_cl_mem> {
     void *getHostPtr() const;
     bool getIsObjectRedescribed() const { return isObjectRedescribed; };
     size_t getSize() const;
+    // unique per object and changed whenever graphics allocation is replaced, kernels use it to detect unchanged arguments
+    uint64_t getGeneration() const { return generation; }
 
     bool addMappedPtr(void *ptr, size_t ptrLength, cl_map_flags &mapFlags, MemObjSizeArray &size, MemObjOffsetArray &offset, uint32_t mipLevel);
     bool findMappedPtr(void *mappedPtr, MapInfo &outMapInfo) { return mapOperationsHandler.find(mappedPtr, outMapInfo); }
@@ -183,5 +185,8 @@ class MemObj : public BaseObject<_cl_mem> {
     std::vector<uint64_t> propertiesVector;
 
     MemObjDestructorCallbacks destructorCallbacks;
+
+    static uint64_t obtainGeneration();
+    uint64_t generation = obtainGeneration();
 };
 } // namespace NEO
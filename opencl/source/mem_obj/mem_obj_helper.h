@@ -41,6 +41,7 @@ class MemObjHelper {
     static SVMAllocsManager::SvmAllocationProperties getSvmAllocationProperties(cl_mem_flags flags);
     static bool isSuitableForRenderCompression(bool renderCompressed, const MemoryProperties &properties, Context &context,
                                                bool preferCompression);
+    static bool isSuitableForHeuristicCompression(const MemoryProperties &properties, size_t size);
 
   protected:
     static bool validateExtraMemoryProperties(const MemoryProperties &memoryProperties, cl_mem_flags flags,
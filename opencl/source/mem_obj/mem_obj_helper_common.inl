@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
 namespace NEO {
@@ -95,6 +97,16 @@ SVMAllocsManager::SvmAllocationProperties MemObjHelper::getSvmAllocationProperti
     return svmProperties;
 }
 
+bool MemObjHelper::isSuitableForHeuristicCompression(const MemoryProperties &properties, size_t size) {
+    auto threshold = DebugManager.flags.BufferCompressionHeuristicThreshold.get();
+    if (threshold < 0 || size < static_cast<size_t>(threshold)) {
+        return false;
+    }
+    // host memory is accessed directly by CPU, so it cannot stay compressed
+    return !properties.flags.readOnly && !properties.flags.writeOnly &&
+           !properties.flags.useHostPtr && !properties.flags.allocHostPtr && !properties.flags.forceHostMemory;
+}
+
 const uint64_t MemObjHelper::commonFlags = extraFlags | CL_MEM_READ_WRITE | CL_MEM_WRITE_ONLY | CL_MEM_READ_ONLY |
                                            CL_MEM_ALLOC_HOST_PTR | CL_MEM_COPY_HOST_PTR | CL_MEM_USE_HOST_PTR |
                                            CL_MEM_HOST_WRITE_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_NO_ACCESS;
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
@@ -19,13 +20,40 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
-    memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(ptr, memoryData[ptr].size, ptr, 0, false);
+    memoryData.at(ptr).unifiedMemoryManager->insertSvmMapOperation(ptr, memoryData.at(ptr).size, ptr, 0, false);
     auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
     retVal = commandQueue->finish();
     UNRECOVERABLE_IF(retVal);
 
-    auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
+    auto allocData = memoryData.at(ptr).unifiedMemoryManager->getSVMAlloc(ptr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
+void PageFaultManager::transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto regionPtr = ptrOffset(ptr, offset);
+    auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, regionPtr, size, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    // map operation is recreated with the exact range migrated back to GPU
+    auto unifiedMemoryManager = memoryData.at(ptr).unifiedMemoryManager;
+    if (unifiedMemoryManager->getSvmMapOperation(regionPtr)) {
+        unifiedMemoryManager->removeSvmMapOperation(regionPtr);
+    }
+}
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto regionPtr = ptrOffset(ptr, offset);
+    auto unifiedMemoryManager = memoryData.at(ptr).unifiedMemoryManager;
+    if (unifiedMemoryManager->getSvmMapOperation(regionPtr)) {
+        unifiedMemoryManager->removeSvmMapOperation(regionPtr);
+    }
+    unifiedMemoryManager->insertSvmMapOperation(regionPtr, size, ptr, offset, false);
+    auto retVal = commandQueue->enqueueSVMUnmap(regionPtr, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    auto allocData = unifiedMemoryManager->getSVMAlloc(ptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
 } // namespace NEO
@@ -38,12 +38,15 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
                              uint32_t rootDeviceIndex,
                              const DeviceBitfield deviceBitfield,
                              gemCloseWorkerMode mode = gemCloseWorkerMode::gemCloseWorkerActive);
+    ~DrmCommandStreamReceiver() override;
 
     bool flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override;
     MOCKABLE_VIRTUAL void processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) override;
     void makeNonResident(GraphicsAllocation &gfxAllocation) override;
     bool waitForFlushStamp(FlushStamp &flushStampToWait) override;
     bool isAnyDirectSubmissionActive() override;
+    bool exportSubmissionSyncFile(int32_t &syncFileFd) override;
+    bool importSyncFileForNextSubmission(int32_t syncFileFd) override;
 
     DrmMemoryManager *getMemoryManager() const;
     GmmPageTableMngr *createPageTableManager() override;
@@ -62,8 +65,16 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     MOCKABLE_VIRTUAL void flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency);
     MOCKABLE_VIRTUAL void exec(const BatchBuffer &batchBuffer, uint32_t vmHandleId, uint32_t drmContextId);
 
+    size_t getFilledExecObjectsCount(uint32_t vmHandleId, uint32_t drmContextId) const;
+    bool isSyncFileInteropAvailable();
+
     std::vector<BufferObject *> residency;
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
+    std::vector<BufferObject *> execObjectsResidency;
+    uint32_t execObjectsVmHandleId = 0u;
+    std::vector<drm_i915_gem_exec_fence> execFences;
+    std::vector<uint32_t> syncObjectsToWait;
+    uint32_t submissionSyncObject = 0u;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
 };
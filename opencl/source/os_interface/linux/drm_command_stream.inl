@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/command_stream/submission_latency_counters.h"
 #include "shared/source/direct_submission/linux/drm_direct_submission.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
@@ -23,9 +24,11 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/source/utilities/runtime_tracer.h"
 
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -54,8 +57,19 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
     }
 }
 
+template <typename GfxFamily>
+DrmCommandStreamReceiver<GfxFamily>::~DrmCommandStreamReceiver() {
+    for (auto syncObject : syncObjectsToWait) {
+        drm->destroySyncObject(syncObject);
+    }
+    if (submissionSyncObject != 0u) {
+        drm->destroySyncObject(submissionSyncObject);
+    }
+}
+
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
+    RUNTIME_TRACE_SCOPE("flush");
     this->printDeviceIndex();
     DrmAllocation *alloc = static_cast<DrmAllocation *>(batchBuffer.commandBufferAllocation);
     DEBUG_BREAK_IF(!alloc);
@@ -84,16 +98,24 @@ bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, Reside
 
     if (this->directSubmission.get()) {
         memoryOperationsInterface->makeResidentWithinOsContext(this->osContext, ArrayRef<GraphicsAllocation *>(&batchBuffer.commandBufferAllocation, 1), true);
+        SubmissionLatencyScope submitLatency(this->submissionLatencyCounters.get(), SubmissionLatencyCounters::Submit);
         return this->directSubmission->dispatchCommandBuffer(batchBuffer, *this->flushStamp.get());
     }
     if (this->blitterDirectSubmission.get()) {
         memoryOperationsInterface->makeResidentWithinOsContext(this->osContext, ArrayRef<GraphicsAllocation *>(&batchBuffer.commandBufferAllocation, 1), true);
+        SubmissionLatencyScope submitLatency(this->submissionLatencyCounters.get(), SubmissionLatencyCounters::Submit);
         return this->blitterDirectSubmission->dispatchCommandBuffer(batchBuffer, *this->flushStamp.get());
     }
 
     this->flushStamp->setStamp(bb->peekHandle());
     this->flushInternal(batchBuffer, allocationsForResidency);
 
+    // waited fences are referenced by submitted request, imported sync objects are not needed anymore
+    for (auto syncObject : syncObjectsToWait) {
+        drm->destroySyncObject(syncObject);
+    }
+    syncObjectsToWait.clear();
+
     if (this->gemCloseWorkerOperationMode == gemCloseWorkerMode::gemCloseWorkerActive) {
         bb->reference();
         this->getMemoryManager()->peekGemCloseWorker()->push(bb);
@@ -126,6 +148,7 @@ void DrmCommandStreamReceiver<GfxFamily>::printBOsForSubmit(ResidencyContainer &
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, uint32_t vmHandleId, uint32_t drmContextId) {
+    SubmissionLatencyScope submitLatency(this->submissionLatencyCounters.get(), SubmissionLatencyCounters::Submit);
     DrmAllocation *alloc = static_cast<DrmAllocation *>(batchBuffer.commandBufferAllocation);
     DEBUG_BREAK_IF(!alloc);
     BufferObject *bb = alloc->getBO();
@@ -139,6 +162,16 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
         this->execObjectsStorage.resize(requiredSize);
     }
 
+    auto filledExecObjectsCount = getFilledExecObjectsCount(vmHandleId, drmContextId);
+
+    this->execFences.clear();
+    for (auto syncObject : syncObjectsToWait) {
+        this->execFences.push_back({syncObject, I915_EXEC_FENCE_WAIT});
+    }
+    if (submissionSyncObject != 0u) {
+        this->execFences.push_back({submissionSyncObject, I915_EXEC_FENCE_SIGNAL});
+    }
+
     int err = bb->exec(static_cast<uint32_t>(alignUp(batchBuffer.usedSize - batchBuffer.startOffset, 8)),
                        batchBuffer.startOffset, execFlags,
                        batchBuffer.requiresCoherency,
@@ -146,14 +179,40 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
                        vmHandleId,
                        drmContextId,
                        this->residency.data(), this->residency.size(),
-                       this->execObjectsStorage.data());
+                       this->execObjectsStorage.data(),
+                       filledExecObjectsCount,
+                       this->execFences.data(), static_cast<uint32_t>(this->execFences.size()));
     UNRECOVERABLE_IF(err != 0);
 
+    std::swap(this->execObjectsResidency, this->residency);
+    this->execObjectsVmHandleId = vmHandleId;
     this->residency.clear();
 }
 
+template <typename GfxFamily>
+size_t DrmCommandStreamReceiver<GfxFamily>::getFilledExecObjectsCount(uint32_t vmHandleId, uint32_t drmContextId) const {
+    // Exec objects are kept between submissions, the same buffer objects submitted
+    // in the same order as previously do not need to be filled again
+    if (DebugManager.flags.ReuseDrmExecObjects.get() == 0 || vmHandleId != this->execObjectsVmHandleId) {
+        return 0u;
+    }
+    auto count = std::min(this->residency.size(), this->execObjectsResidency.size());
+    size_t filledCount = 0u;
+    while (filledCount < count &&
+           this->residency[filledCount] == this->execObjectsResidency[filledCount] &&
+           this->residency[filledCount]->isExecObjectFilled(this->execObjectsStorage[filledCount], drmContextId)) {
+        filledCount++;
+    }
+    return filledCount;
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    RUNTIME_TRACE_SCOPE("processResidency");
+    SubmissionLatencyScope residencyLatency(this->submissionLatencyCounters.get(), SubmissionLatencyCounters::Residency);
+    if (auto residencyManager = getMemoryManager()->getLocalMemoryResidencyManager(this->rootDeviceIndex)) {
+        residencyManager->markUsed(inputAllocationsForResidency);
+    }
     for (auto &alloc : inputAllocationsForResidency) {
         auto drmAlloc = static_cast<DrmAllocation *>(alloc);
         drmAlloc->makeBOsResident(osContext, handleId, &this->residency, false);
@@ -204,4 +263,50 @@ bool DrmCommandStreamReceiver<GfxFamily>::isAnyDirectSubmissionActive() {
     return this->drm->isDirectSubmissionActive();
 }
 
+template <typename GfxFamily>
+bool DrmCommandStreamReceiver<GfxFamily>::isSyncFileInteropAvailable() {
+    // direct submission does not go through execbuffer, so there is no kernel fence to signal or wait on
+    if (this->directSubmission.get() || this->blitterDirectSubmission.get()) {
+        return false;
+    }
+    int execFenceArray = 0;
+    return drm->getExecFenceArray(execFenceArray) == 0 && execFenceArray != 0;
+}
+
+template <typename GfxFamily>
+bool DrmCommandStreamReceiver<GfxFamily>::exportSubmissionSyncFile(int32_t &syncFileFd) {
+    auto lock = this->obtainUniqueOwnership();
+    this->flushBatchedSubmissions();
+    if (submissionSyncObject == 0u) {
+        if (!isSyncFileInteropAvailable()) {
+            return false;
+        }
+        // submissions flushed so far did not signal sync object, it starts signaled once they are completed
+        this->waitForCompletionWithTimeout(false, 0, this->peekTaskCount());
+        if (drm->createSyncObject(submissionSyncObject, true) != 0) {
+            submissionSyncObject = 0u;
+            return false;
+        }
+    }
+    return drm->exportSyncObjectToSyncFile(submissionSyncObject, syncFileFd) == 0;
+}
+
+template <typename GfxFamily>
+bool DrmCommandStreamReceiver<GfxFamily>::importSyncFileForNextSubmission(int32_t syncFileFd) {
+    auto lock = this->obtainUniqueOwnership();
+    if (!isSyncFileInteropAvailable()) {
+        return false;
+    }
+    uint32_t syncObject = 0u;
+    if (drm->createSyncObject(syncObject, false) != 0) {
+        return false;
+    }
+    if (drm->importSyncFileToSyncObject(syncObject, syncFileFd) != 0) {
+        drm->destroySyncObject(syncObject);
+        return false;
+    }
+    syncObjectsToWait.push_back(syncObject);
+    return true;
+}
+
 } // namespace NEO
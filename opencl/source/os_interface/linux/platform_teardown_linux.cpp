@@ -12,6 +12,11 @@ void __attribute__((constructor)) platformsConstructor() {
     platformsImpl = new std::vector<std::unique_ptr<Platform>>;
 }
 void __attribute__((destructor)) platformsDestructor() {
+    if (prepareForFastExit(platformsImpl)) {
+        // GPU work is completed, kernel reclaims remaining resources at process exit
+        platformsImpl = nullptr;
+        return;
+    }
     delete platformsImpl;
     platformsImpl = nullptr;
 }
@@ -11,7 +11,11 @@ using namespace NEO;
 
 BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
-        delete platformsImpl;
+        // non-null lpvReserved means process is terminating
+        if (lpvReserved == nullptr || !prepareForFastExit(platformsImpl)) {
+            delete platformsImpl;
+        }
+        platformsImpl = nullptr;
     }
     if (fdwReason == DLL_PROCESS_ATTACH) {
         platformsImpl = new std::vector<std::unique_ptr<Platform>>;
@@ -39,6 +39,18 @@ namespace NEO {
 
 std::vector<std::unique_ptr<Platform>> *platformsImpl = nullptr;
 
+bool prepareForFastExit(std::vector<std::unique_ptr<Platform>> *platforms) {
+    if (platforms == nullptr) {
+        return false;
+    }
+    for (auto &platform : *platforms) {
+        if (!platform->peekExecutionEnvironment()->prepareForFastExit()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Platform::Platform(ExecutionEnvironment &executionEnvironmentIn) : executionEnvironment(executionEnvironmentIn) {
     clDevices.reserve(4);
     executionEnvironment.incRefInternal();
@@ -139,6 +151,10 @@ bool Platform::initialize(std::vector<std::unique_ptr<Device>> devices) {
         pClDevice = new ClDevice{*pDevice, this};
         this->clDevices.push_back(pClDevice);
 
+        if (Device::isEngineInitializationDeferred()) {
+            continue;
+        }
+
         if (pClDevice->getPreemptionMode() == PreemptionMode::MidThread || pClDevice->isDebuggerActive()) {
             bool ret = SipKernel::initSipKernel(SipKernel::getSipKernelType(*pDevice), *pDevice);
             UNRECOVERABLE_IF(!ret);
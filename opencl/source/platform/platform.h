@@ -74,4 +74,7 @@ class Platform : public BaseObject<_cl_platform_id> {
 };
 
 extern std::vector<std::unique_ptr<Platform>> *platformsImpl;
+
+// true when process exit may skip destruction of platforms, see ExecutionEnvironment::prepareForFastExit
+bool prepareForFastExit(std::vector<std::unique_ptr<Platform>> *platforms);
 } // namespace NEO
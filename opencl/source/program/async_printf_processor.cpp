@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/program/async_printf_processor.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/program/printf_handler.h"
+
+#include <chrono>
+
+namespace NEO {
+
+bool AsyncPrintfProcessor::isEnabled() {
+    return DebugManager.flags.EnableAsyncPrintf.get() == 1;
+}
+
+AsyncPrintfProcessor::AsyncPrintfProcessor(ClDevice &device) : device(device) {
+}
+
+AsyncPrintfProcessor::~AsyncPrintfProcessor() {
+    std::unique_lock<std::mutex> lock(pendingOutputsMutex);
+    keepProcessing = false;
+    lock.unlock();
+    condition.notify_all();
+    if (processingThread) {
+        processingThread->join();
+        processingThread.reset();
+    }
+
+    // output of kernels still running is not dropped
+    printOutputs(true);
+
+    for (auto surface : surfacesPool) {
+        device.getMemoryManager()->freeGraphicsMemory(surface);
+    }
+    surfacesPool.clear();
+}
+
+GraphicsAllocation *AsyncPrintfProcessor::obtainSurface(size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(surfacesPoolMutex);
+        for (auto it = surfacesPool.begin(); it != surfacesPool.end(); it++) {
+            if ((*it)->getUnderlyingBufferSize() >= size) {
+                auto surface = *it;
+                surfacesPool.erase(it);
+                return surface;
+            }
+        }
+    }
+    return device.getMemoryManager()->allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(), size, GraphicsAllocation::AllocationType::PRINTF_SURFACE, device.getDeviceBitfield()});
+}
+
+void AsyncPrintfProcessor::returnSurface(GraphicsAllocation *surface) {
+    if (surface == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(surfacesPoolMutex);
+        if (surfacesPool.size() < maxPooledSurfaces) {
+            surfacesPool.push_back(surface);
+            return;
+        }
+    }
+    device.getMemoryManager()->freeGraphicsMemory(surface);
+}
+
+void AsyncPrintfProcessor::submit(std::unique_ptr<PrintfHandler> &&printfHandler, CommandStreamReceiver &csr, uint32_t taskCount) {
+    if (printfHandler->getKernel() == nullptr) {
+        return;
+    }
+    // kernel may be released by application before its output is printed
+    printfHandler->getKernel()->incRefInternal();
+
+    std::unique_lock<std::mutex> lock(pendingOutputsMutex);
+    pendingOutputs.push_back({std::move(printfHandler), &csr, taskCount});
+    // processing thread is started with first output and lives until device destruction
+    if (!processingThread) {
+        keepProcessing = true;
+        processingThread = Thread::create(processOutputs, reinterpret_cast<void *>(this));
+    }
+    lock.unlock();
+    condition.notify_one();
+}
+
+void AsyncPrintfProcessor::printCompletedOutputs() {
+    printOutputs(false);
+}
+
+size_t AsyncPrintfProcessor::getPendingOutputsCount() {
+    std::lock_guard<std::mutex> lock(pendingOutputsMutex);
+    return pendingOutputs.size();
+}
+
+size_t AsyncPrintfProcessor::getPooledSurfacesCount() {
+    std::lock_guard<std::mutex> lock(surfacesPoolMutex);
+    return surfacesPool.size();
+}
+
+void *AsyncPrintfProcessor::processOutputs(void *self) {
+    auto processor = reinterpret_cast<AsyncPrintfProcessor *>(self);
+    std::unique_lock<std::mutex> lock(processor->pendingOutputsMutex);
+    while (processor->keepProcessing) {
+        // tag is polled only while some output is pending, idle thread sleeps until next submission
+        if (processor->pendingOutputs.empty()) {
+            processor->condition.wait(lock);
+        } else {
+            processor->condition.wait_for(lock, std::chrono::milliseconds(1));
+        }
+        if (!processor->keepProcessing) {
+            break;
+        }
+        lock.unlock();
+        processor->printOutputs(false);
+        lock.lock();
+    }
+    return nullptr;
+}
+
+void AsyncPrintfProcessor::printOutputs(bool waitForCompletion) {
+    // single printer at a time keeps output of consecutive kernels in submission order
+    std::lock_guard<std::mutex> printLock(printMutex);
+    while (true) {
+        PendingOutput output;
+        {
+            std::lock_guard<std::mutex> lock(pendingOutputsMutex);
+            if (pendingOutputs.empty()) {
+                return;
+            }
+            auto &nextOutput = pendingOutputs.front();
+            if (!waitForCompletion && nextOutput.csr->peekCompletedTaskCount() < nextOutput.taskCount) {
+                return;
+            }
+            output = std::move(nextOutput);
+            pendingOutputs.pop_front();
+        }
+
+        if (waitForCompletion) {
+            output.csr->waitForCompletionWithTimeout(false, 0, output.taskCount);
+        }
+        auto kernel = output.printfHandler->getKernel();
+        output.printfHandler->printEnqueueOutput();
+        output.printfHandler.reset();
+        kernel->decRefInternal();
+    }
+}
+} // namespace NEO
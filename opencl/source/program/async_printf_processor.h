@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class ClDevice;
+class CommandStreamReceiver;
+class GraphicsAllocation;
+class PrintfHandler;
+class Thread;
+
+// Prints output of printf kernels from background thread once their CSR tag passes task count of the enqueue,
+// in submission order. Printf surfaces are returned to pool after printing and reused by following enqueues.
+class AsyncPrintfProcessor {
+  public:
+    static constexpr size_t maxPooledSurfaces = 8;
+
+    static bool isEnabled();
+
+    AsyncPrintfProcessor(ClDevice &device);
+    virtual ~AsyncPrintfProcessor();
+
+    AsyncPrintfProcessor(const AsyncPrintfProcessor &) = delete;
+    AsyncPrintfProcessor &operator=(const AsyncPrintfProcessor &) = delete;
+
+    GraphicsAllocation *obtainSurface(size_t size);
+    void returnSurface(GraphicsAllocation *surface);
+
+    void submit(std::unique_ptr<PrintfHandler> &&printfHandler, CommandStreamReceiver &csr, uint32_t taskCount);
+    void printCompletedOutputs();
+
+    size_t getPendingOutputsCount();
+    size_t getPooledSurfacesCount();
+
+  protected:
+    struct PendingOutput {
+        std::unique_ptr<PrintfHandler> printfHandler;
+        CommandStreamReceiver *csr = nullptr;
+        uint32_t taskCount = 0;
+    };
+
+    static void *processOutputs(void *self);
+    MOCKABLE_VIRTUAL void printOutputs(bool waitForCompletion);
+
+    ClDevice &device;
+    std::deque<PendingOutput> pendingOutputs;
+    std::vector<GraphicsAllocation *> surfacesPool;
+    std::mutex pendingOutputsMutex;
+    std::mutex printMutex;
+    std::mutex surfacesPoolMutex;
+    std::condition_variable condition;
+
+    std::unique_ptr<Thread> processingThread;
+    std::atomic<bool> keepProcessing{false};
+};
+} // namespace NEO
@@ -10,12 +10,16 @@
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/compiler_options_parser.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
+#include "shared/source/utilities/parallel_tasks.h"
 #include "shared/source/utilities/time_measure_wrapper.h"
+#include "shared/source/utilities/worker_pool.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/helpers/validators.h"
+#include "opencl/source/kernel/kernel_tuning_database.h"
 #include "opencl/source/platform/platform.h"
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/program.h"
@@ -29,6 +33,15 @@
 
 namespace NEO {
 
+namespace {
+struct BuildTask {
+    ClDevice *clDevice = nullptr;
+    TranslationOutput output = {};
+    TranslationOutput::ErrorCode errorCode = TranslationOutput::ErrorCode::Success;
+    size_t binaryUsers = 0;
+};
+} // namespace
+
 cl_int Program::build(
     const ClDeviceVector &deviceVector,
     const char *buildOptions,
@@ -121,49 +134,94 @@ cl_int Program::build(
                     "Build Options", inputArgs.apiOptions.begin(),
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
             inputArgs.allowCaching = enableCaching;
-            NEO::TranslationOutput compilerOuput = {};
 
+            // devices sharing root device or hardware configuration get the same binary, so it is built only once for them
+            std::vector<BuildTask> buildTasks;
+            std::vector<ClDevice *> binaryDevices;
+            std::vector<size_t> binaryDeviceTaskIds;
             for (const auto &clDevice : deviceVector) {
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
-                retVal = asClError(compilerErr);
+                auto rootDeviceIndex = clDevice->getRootDeviceIndex();
+                if (BuildPhase::BinaryCreation == phaseReached[rootDeviceIndex]) {
+                    continue;
+                }
+                phaseReached[rootDeviceIndex] = BuildPhase::BinaryCreation;
+
+                auto taskId = std::find_if(buildTasks.begin(), buildTasks.end(), [&](const auto &task) {
+                                  return isSameHardwareInfo(task.clDevice->getHardwareInfo(), clDevice->getHardwareInfo());
+                              }) -
+                              buildTasks.begin();
+                if (static_cast<size_t>(taskId) == buildTasks.size()) {
+                    buildTasks.push_back(BuildTask{clDevice});
+                }
+                buildTasks[taskId].binaryUsers++;
+                binaryDevices.push_back(clDevice);
+                binaryDeviceTaskIds.push_back(taskId);
+            }
+
+            auto compileTask = [&](size_t taskId) {
+                auto &task = buildTasks[taskId];
+                task.errorCode = pCompilerInterface->build(task.clDevice->getDevice(), inputArgs, task.output);
+            };
+            runParallelTasks(buildTasks.size(), ExecutionEnvironment::getBuildWorkersCount(), compileTask);
+
+            for (size_t i = 0; i < binaryDevices.size(); i++) {
+                auto rootDeviceIndex = binaryDevices[i]->getRootDeviceIndex();
+                auto &task = buildTasks[binaryDeviceTaskIds[i]];
+                this->updateBuildLog(rootDeviceIndex, task.output.frontendCompilerLog.c_str(), task.output.frontendCompilerLog.size());
+                this->updateBuildLog(rootDeviceIndex, task.output.backendCompilerLog.c_str(), task.output.backendCompilerLog.size());
+                retVal = asClError(task.errorCode);
                 if (retVal != CL_SUCCESS) {
                     break;
                 }
-                if (inputArgs.srcType == IGC::CodeType::oclC) {
-                    this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
-                    this->irBinarySize = compilerOuput.intermediateRepresentation.size;
-                    this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
+                auto &deviceBinary = task.output.deviceBinary;
+                if (--task.binaryUsers == 0) {
+                    this->replaceDeviceBinary(std::move(deviceBinary.mem), deviceBinary.size, rootDeviceIndex);
+                } else {
+                    this->replaceDeviceBinary(makeCopy<char>(deviceBinary.mem.get(), deviceBinary.size), deviceBinary.size, rootDeviceIndex);
                 }
-                if (BuildPhase::BinaryCreation == phaseReached[clDevice->getRootDeviceIndex()]) {
-                    continue;
-                }
-                this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
-                phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryCreation;
+                buildInfos[rootDeviceIndex].trustedDeviceBinary = task.output.deviceBinaryLoadedFromCache && (DebugManager.flags.TrustCachedDeviceBinaries.get() == 1);
             }
             if (retVal != CL_SUCCESS) {
                 break;
             }
+
+            auto &compilerOuput = buildTasks.back().output;
+            if (inputArgs.srcType == IGC::CodeType::oclC) {
+                this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
+                this->irBinarySize = compilerOuput.intermediateRepresentation.size;
+                this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
+            }
             this->debugData = std::move(compilerOuput.debugData.mem);
             this->debugDataSize = compilerOuput.debugData.size;
         }
         updateNonUniformFlag();
 
+        std::vector<ClDevice *> processedDevices;
         for (auto &clDevice : deviceVector) {
             if (BuildPhase::BinaryProcessing == phaseReached[clDevice->getRootDeviceIndex()]) {
                 continue;
             }
+            phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryProcessing;
+            processedDevices.push_back(clDevice);
+        }
+
+        // each root device decodes, allocates and links its own build info
+        std::vector<cl_int> processingResults(processedDevices.size(), CL_SUCCESS);
+        auto processTask = [&](size_t taskId) {
+            auto &clDevice = *processedDevices[taskId];
             if (DebugManager.flags.PrintProgramBinaryProcessingTime.get()) {
-                retVal = TimeMeasureWrapper::functionExecution(*this, &Program::processGenBinary, *clDevice);
+                processingResults[taskId] = TimeMeasureWrapper::functionExecution(*this, &Program::processGenBinary, clDevice);
             } else {
-                retVal = processGenBinary(*clDevice);
+                processingResults[taskId] = processGenBinary(clDevice);
             }
+        };
+        runParallelTasks(processedDevices.size(), ExecutionEnvironment::getBuildWorkersCount(), processTask);
 
-            if (retVal != CL_SUCCESS) {
+        for (auto processingResult : processingResults) {
+            if (processingResult != CL_SUCCESS) {
+                retVal = processingResult;
                 break;
             }
-            phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryProcessing;
         }
 
         if (retVal != CL_SUCCESS) {
@@ -202,11 +260,60 @@ cl_int Program::build(
         }
     } else {
         setBuildStatusSuccess(deviceVector, CL_PROGRAM_BINARY_TYPE_EXECUTABLE);
+
+        // tunning outcomes of previous runs are read once built kernels can be enqueued
+        for (const auto &device : deviceVector) {
+            auto tuningDatabase = device->getKernelTuningDatabase();
+            if (tuningDatabase) {
+                tuningDatabase->load();
+            }
+        }
     }
 
     return retVal;
 }
 
+cl_int Program::buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
+                          void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData) {
+    {
+        std::lock_guard<std::mutex> lock(asyncBuildMutex);
+        if (asyncBuildPending) {
+            return CL_INVALID_OPERATION;
+        }
+        asyncBuildPending = true;
+    }
+
+    // build options and device list have to outlive clBuildProgram call
+    ClDeviceVector devicesToBuild = deviceVector;
+    std::string asyncBuildOptions = buildOptions ? buildOptions : "";
+    bool hasBuildOptions = buildOptions != nullptr;
+
+    // program is kept alive until notify callback returns, even if application releases it earlier
+    this->incRefInternal();
+    executionEnvironment.getDriverWorkerPool()->enqueue(WorkerPoolClient::Build, [this, devicesToBuild, asyncBuildOptions, hasBuildOptions, enableCaching, funcNotify, userData]() {
+        this->build(devicesToBuild, hasBuildOptions ? asyncBuildOptions.c_str() : nullptr, enableCaching);
+        {
+            std::lock_guard<std::mutex> lock(asyncBuildMutex);
+            asyncBuildPending = false;
+            asyncBuildCompleted.notify_all();
+        }
+        // callback may create kernels, so it is invoked once waiters are released
+        this->invokeCallback(funcNotify, userData);
+        this->decRefInternal();
+    });
+    return CL_SUCCESS;
+}
+
+bool Program::isAsyncBuildPending() const {
+    std::lock_guard<std::mutex> lock(asyncBuildMutex);
+    return asyncBuildPending;
+}
+
+void Program::waitForAsyncBuild() const {
+    std::unique_lock<std::mutex> lock(asyncBuildMutex);
+    asyncBuildCompleted.wait(lock, [this]() { return !asyncBuildPending; });
+}
+
 bool Program::appendKernelDebugOptions(ClDevice &clDevice, std::string &internalOptions) {
     CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::debugKernelEnable);
     CompilerOptions::concatenateAppend(options, CompilerOptions::generateDebugInfo);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,8 @@ namespace NEO {
 
 cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
                         void *paramValue, size_t *paramValueSizeRet) {
+    waitForAsyncBuild();
+
     cl_int retVal = CL_SUCCESS;
     const void *pSrc = nullptr;
     size_t srcSize = GetInfo::invalidSourceSize;
@@ -184,11 +186,17 @@ cl_int Program::getBuildInfo(cl_device_id device, cl_program_build_info paramNam
 
     auto pClDev = castToObject<ClDevice>(device);
     auto rootDeviceIndex = pClDev->getRootDeviceIndex();
+    cl_build_status asyncBuildStatus = CL_BUILD_IN_PROGRESS;
+
+    // build status can be polled while asynchronous build is running, other queries wait for its results
+    if (paramName != CL_PROGRAM_BUILD_STATUS) {
+        waitForAsyncBuild();
+    }
 
     switch (paramName) {
     case CL_PROGRAM_BUILD_STATUS:
         srcSize = retSize = sizeof(cl_build_status);
-        pSrc = &deviceBuildInfos.at(pClDev).buildStatus;
+        pSrc = isAsyncBuildPending() ? &asyncBuildStatus : &deviceBuildInfos.at(pClDev).buildStatus;
         break;
 
     case CL_PROGRAM_BUILD_OPTIONS:
@@ -216,10 +216,14 @@ int32_t KernelInfo::getArgNumByName(const char *name) const {
     return -1;
 }
 
-bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa) {
+bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa, bool shareIsa) {
     UNRECOVERABLE_IF(kernelAllocation);
     auto kernelIsaSize = heapInfo.KernelHeapSize;
     const auto allocType = internalIsa ? GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : GraphicsAllocation::AllocationType::KERNEL_ISA;
+    if (shareIsa) {
+        kernelAllocation = device.getMemoryManager()->getKernelIsaCache().obtainAllocation(device, heapInfo.pKernelHeap, static_cast<size_t>(kernelIsaSize), allocType);
+        return nullptr != kernelAllocation;
+    }
     kernelAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(), kernelIsaSize, allocType, device.getDeviceBitfield()});
     if (!kernelAllocation) {
         return false;
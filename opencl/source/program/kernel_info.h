@@ -116,7 +116,7 @@ struct KernelInfo {
     uint32_t getConstantBufferSize() const;
     int32_t getArgNumByName(const char *name) const;
 
-    bool createKernelAllocation(const Device &device, bool internalIsa);
+    bool createKernelAllocation(const Device &device, bool internalIsa, bool shareIsa = false);
     void apply(const DeviceInfoKernelPayloadConstants &constants);
 
     HeapInfo heapInfo = {};
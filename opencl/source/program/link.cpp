@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -100,6 +100,7 @@ cl_int Program::link(
                 retVal = CL_INVALID_PROGRAM;
                 break;
             }
+            pInputProgObj->waitForAsyncBuild();
             inputProgramsInternal.push_back(pInputProgObj);
             if ((pInputProgObj->irBinary == nullptr) || (pInputProgObj->irBinarySize == 0)) {
                 retVal = CL_INVALID_PROGRAM;
@@ -19,6 +19,7 @@
 #include "opencl/source/helpers/dispatch_info.h"
 #include "opencl/source/kernel/kernel.h"
 #include "opencl/source/mem_obj/buffer.h"
+#include "opencl/source/program/async_printf_processor.h"
 
 namespace NEO {
 
@@ -27,6 +28,10 @@ const uint32_t PrintfHandler::printfSurfaceInitialDataSize;
 PrintfHandler::PrintfHandler(ClDevice &deviceArg) : device(deviceArg) {}
 
 PrintfHandler::~PrintfHandler() {
+    if (asyncPrintfProcessor) {
+        asyncPrintfProcessor->returnSurface(printfSurface);
+        return;
+    }
     device.getMemoryManager()->freeGraphicsMemory(printfSurface);
 }
 
@@ -49,7 +54,12 @@ void PrintfHandler::prepareDispatch(const MultiDispatchInfo &multiDispatchInfo)
     }
     auto rootDeviceIndex = device.getRootDeviceIndex();
     kernel = multiDispatchInfo.peekMainKernel();
-    printfSurface = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, printfSurfaceSize, GraphicsAllocation::AllocationType::PRINTF_SURFACE, device.getDeviceBitfield()});
+    asyncPrintfProcessor = multiDispatchInfo.peekParentKernel() ? nullptr : device.getAsyncPrintfProcessor();
+    if (asyncPrintfProcessor) {
+        printfSurface = asyncPrintfProcessor->obtainSurface(printfSurfaceSize);
+    } else {
+        printfSurface = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, printfSurfaceSize, GraphicsAllocation::AllocationType::PRINTF_SURFACE, device.getDeviceBitfield()});
+    }
 
     auto &hwInfo = device.getHardwareInfo();
     auto &helper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
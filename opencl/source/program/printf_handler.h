@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 
 namespace NEO {
 
+class AsyncPrintfProcessor;
 class ClDevice;
 struct MultiDispatchInfo;
 
@@ -29,6 +30,7 @@ class PrintfHandler {
     GraphicsAllocation *getSurface() {
         return printfSurface;
     }
+    Kernel *getKernel() const { return kernel; }
 
   protected:
     PrintfHandler(ClDevice &device);
@@ -37,5 +39,6 @@ class PrintfHandler {
     ClDevice &device;
     Kernel *kernel = nullptr;
     GraphicsAllocation *printfSurface = nullptr;
+    AsyncPrintfProcessor *asyncPrintfProcessor = nullptr;
 };
 } // namespace NEO
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/kernel_isa_cache.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_info.h"
@@ -36,12 +37,9 @@ const KernelInfo *Program::getKernelInfo(
         return nullptr;
     }
 
-    auto &kernelInfoArray = buildInfos[rootDeviceIndex].kernelInfoArray;
-
-    auto it = std::find_if(kernelInfoArray.begin(), kernelInfoArray.end(),
-                           [=](const KernelInfo *kInfo) { return (0 == strcmp(kInfo->kernelDescriptor.kernelMetadata.kernelName.c_str(), kernelName)); });
-
-    return (it != kernelInfoArray.end()) ? *it : nullptr;
+    auto &kernelInfoIndex = buildInfos[rootDeviceIndex].kernelInfoIndex;
+    auto it = kernelInfoIndex.find(kernelName);
+    return (it != kernelInfoIndex.end()) ? it->second : nullptr;
 }
 
 size_t Program::getNumKernels() const {
@@ -146,6 +144,7 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
     auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.unpackedDeviceBinary.get()), buildInfo.unpackedDeviceBinarySize);
     SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
+    binary.trusted = buildInfo.trustedDeviceBinary;
     std::string decodeErrors;
     std::string decodeWarnings;
 
@@ -186,6 +185,7 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
     }
 
     kernelInfoArray = std::move(src.kernelInfos);
+    updateKernelInfoIndex(rootDeviceIndex);
     auto svmAllocsManager = context ? context->getSVMAllocsManager() : nullptr;
     if (src.globalConstants.size != 0) {
         buildInfos[rootDeviceIndex].constantSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalConstants.size, true, linkerInput, src.globalConstants.initData);
@@ -200,10 +200,13 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
         }
     }
 
+    // ISA patched in place by linker or registered by debugger is unique to this program
+    bool shareIsa = KernelIsaCache::isEnabled() && (nullptr == clDevice.getDevice().getDebugger()) &&
+                    ((nullptr == linkerInput) || (false == linkerInput->getTraits().requiresPatchingOfInstructionSegments));
     for (auto &kernelInfo : kernelInfoArray) {
         cl_int retVal = CL_SUCCESS;
         if (kernelInfo->heapInfo.KernelHeapSize) {
-            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn, shareIsa) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
         }
 
         if (retVal != CL_SUCCESS) {
@@ -339,6 +339,17 @@ void Program::separateBlockKernels(uint32_t rootDeviceIndex) {
         }
     }
     allKernelInfos.clear();
+    updateKernelInfoIndex(rootDeviceIndex);
+}
+
+void Program::updateKernelInfoIndex(uint32_t rootDeviceIndex) {
+    auto &buildInfo = buildInfos[rootDeviceIndex];
+    buildInfo.kernelInfoIndex.clear();
+    buildInfo.kernelInfoIndex.reserve(buildInfo.kernelInfoArray.size());
+    for (auto &kernelInfo : buildInfo.kernelInfoArray) {
+        // first kernel with given name is found, same as in linear search
+        buildInfo.kernelInfoIndex.emplace(kernelInfo->kernelDescriptor.kernelMetadata.kernelName, kernelInfo);
+    }
 }
 
 void Program::allocateBlockPrivateSurfaces(const ClDevice &clDevice) {
@@ -372,7 +383,7 @@ void Program::freeBlockResources() {
         }
         auto kernelInfo = blockKernelManager->getBlockKernelInfo(i);
         DEBUG_BREAK_IF(!kernelInfo->kernelAllocation);
-        if (kernelInfo->kernelAllocation) {
+        if (kernelInfo->kernelAllocation && this->executionEnvironment.memoryManager->getKernelIsaCache().releaseAllocation(kernelInfo->kernelAllocation)) {
             this->executionEnvironment.memoryManager->freeGraphicsMemory(kernelInfo->kernelAllocation);
         }
     }
@@ -381,7 +392,8 @@ void Program::freeBlockResources() {
 void Program::cleanCurrentKernelInfo(uint32_t rootDeviceIndex) {
     auto &buildInfo = buildInfos[rootDeviceIndex];
     for (auto &kernelInfo : buildInfo.kernelInfoArray) {
-        if (kernelInfo->kernelAllocation) {
+        // shared ISA stays resident until its last program is released
+        if (kernelInfo->kernelAllocation && this->executionEnvironment.memoryManager->getKernelIsaCache().releaseAllocation(kernelInfo->kernelAllocation)) {
             //register cache flush in all csrs where kernel allocation was used
             for (auto &engine : this->executionEnvironment.memoryManager->getRegisteredEngines()) {
                 auto contextId = engine.osContext->getContextId();
@@ -395,6 +407,7 @@ void Program::cleanCurrentKernelInfo(uint32_t rootDeviceIndex) {
         delete kernelInfo;
     }
     buildInfo.kernelInfoArray.clear();
+    buildInfo.kernelInfoIndex.clear();
 }
 
 void Program::updateNonUniformFlag() {
@@ -426,6 +439,7 @@ void Program::updateNonUniformFlag(const Program **inputPrograms, size_t numInpu
 }
 
 void Program::replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) {
+    this->buildInfos[rootDeviceIndex].trustedDeviceBinary = false;
     if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize))) {
         this->buildInfos[rootDeviceIndex].packedDeviceBinary = std::move(newBinary);
         this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = newBinarySize;
@@ -20,8 +20,10 @@
 #include "cif/builtins/memory/buffer/buffer.h"
 #include "patch_list.h"
 
+#include <condition_variable>
 #include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -252,6 +254,11 @@ class Program : public BaseObject<_cl_program> {
 
     MOCKABLE_VIRTUAL void replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newBinarySize, uint32_t rootDeviceIndex);
 
+    cl_int buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
+                      void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
+    bool isAsyncBuildPending() const;
+    void waitForAsyncBuild() const;
+
     static bool isValidCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
     void invokeCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
 
@@ -289,6 +296,7 @@ class Program : public BaseObject<_cl_program> {
     MOCKABLE_VIRTUAL cl_int linkBinary(Device *pDevice, const void *constantsInitData, const void *variablesInitData);
 
     void separateBlockKernels(uint32_t rootDeviceIndex);
+    void updateKernelInfoIndex(uint32_t rootDeviceIndex);
 
     void updateNonUniformFlag();
     void updateNonUniformFlag(const Program **inputProgram, size_t numInputPrograms);
@@ -333,6 +341,7 @@ class Program : public BaseObject<_cl_program> {
 
     struct BuildInfo : public NonCopyableClass {
         std::vector<KernelInfo *> kernelInfoArray;
+        std::unordered_map<std::string, KernelInfo *> kernelInfoIndex;
         std::vector<KernelInfo *> parentKernelInfoArray;
         std::vector<KernelInfo *> subgroupKernelInfoArray;
         GraphicsAllocation *constantSurface = nullptr;
@@ -348,6 +357,7 @@ class Program : public BaseObject<_cl_program> {
 
         std::unique_ptr<char[]> packedDeviceBinary;
         size_t packedDeviceBinarySize = 0U;
+        bool trustedDeviceBinary = false;
     };
 
     std::vector<BuildInfo> buildInfos;
@@ -367,6 +377,10 @@ class Program : public BaseObject<_cl_program> {
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     std::mutex lockMutex;
     uint32_t exposedKernels = 0;
+
+    mutable std::mutex asyncBuildMutex;
+    mutable std::condition_variable asyncBuildCompleted;
+    bool asyncBuildPending = false;
 };
 
 } // namespace NEO
@@ -275,9 +275,23 @@ cl_int CL_API_CALL clEnqueueReleaseGLObjects(cl_command_queue commandQueue, cl_u
             return retVal;
         }
 
-        pCommandQueue->finish();
+        auto sharing = pCommandQueue->getContext().getSharing<GLSharingFunctionsWindows>();
+        auto &csr = pCommandQueue->getGpgpuCommandStreamReceiver();
+        bool gpuSyncRelease = sharing->isGpuSyncReleaseSupported(csr);
+
+        if (!gpuSyncRelease) {
+            pCommandQueue->finish();
+        }
         retVal = pCommandQueue->enqueueReleaseSharedObjects(numObjects, memObjects, numEventsInWaitList, eventWaitList, event,
                                                             CL_COMMAND_RELEASE_GL_OBJECTS);
+        if (gpuSyncRelease && retVal == CL_SUCCESS) {
+            gpuSyncRelease = !pCommandQueue->isQueueBlocked() &&
+                             pCommandQueue->flush() == CL_SUCCESS &&
+                             sharing->insertGpuWaitForRelease(csr, pCommandQueue->taskCount);
+            if (!gpuSyncRelease) {
+                pCommandQueue->finish();
+            }
+        }
     }
 
     TRACING_EXIT(clEnqueueReleaseGLObjects, &retVal);
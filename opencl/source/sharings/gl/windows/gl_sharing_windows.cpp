@@ -7,6 +7,10 @@
 
 #include "opencl/source/sharings/gl/windows/gl_sharing_windows.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include "opencl/extensions/public/cl_gl_private_intel.h"
 #include "opencl/source/context/context.inl"
 #include "opencl/source/helpers/windows/gl_helper.h"
 #include "opencl/source/sharings/gl/gl_arb_sync_event.h"
@@ -19,6 +23,7 @@ GLSharingFunctionsWindows::GLSharingFunctionsWindows(GLType glhdcType, GLContext
     createBackupContext();
 }
 GLSharingFunctionsWindows::~GLSharingFunctionsWindows() {
+    cleanupReleaseSyncObjects(false);
     if (pfnWglDeleteContext) {
         pfnWglDeleteContext(GLHGLRCHandleBkpCtx);
     }
@@ -123,6 +128,49 @@ void GLSharingFunctionsWindows::removeGlArbSyncEventMapping(Event &baseEvent) {
     glArbEventMapping.erase(it);
 }
 
+bool GLSharingFunctionsWindows::isGpuSyncReleaseSupported(CommandStreamReceiver &csr) const {
+    if (DebugManager.flags.EnableGlGpuSyncRelease.get() == 0) {
+        return false;
+    }
+    // sync object is signaled by KMD, so it is ordered only with work submitted through KMD
+    return GLContextHandle != 0 && GLDeviceHandle != 0 &&
+           csr.getOSInterface() != nullptr &&
+           !csr.isDirectSubmissionEnabled();
+}
+
+bool GLSharingFunctionsWindows::insertGpuWaitForRelease(CommandStreamReceiver &csr, uint32_t taskCount) {
+    cleanupReleaseSyncObjects(true);
+
+    auto osInterface = csr.getOSInterface();
+    auto syncInfo = new CL_GL_SYNC_INFO{};
+    if (false == pfnGlArbSyncObjectSetup(*this, *osInterface, *syncInfo)) {
+        delete syncInfo;
+        return false;
+    }
+
+    // GL context is blocked on GPU until previously submitted CL work completes, host is not waiting
+    pfnGlArbSyncObjectSignal(csr.getOsContext(), *syncInfo);
+    pfnGlArbSyncObjectWaitServer(*osInterface, *syncInfo);
+
+    std::lock_guard<std::mutex> lock{releaseSyncObjectsMutex};
+    releaseSyncObjects.push_back({syncInfo, osInterface, &csr, taskCount});
+    return true;
+}
+
+void GLSharingFunctionsWindows::cleanupReleaseSyncObjects(bool completedOnly) {
+    std::lock_guard<std::mutex> lock{releaseSyncObjectsMutex};
+    auto it = releaseSyncObjects.begin();
+    while (it != releaseSyncObjects.end()) {
+        if (completedOnly && *it->csr->getTagAddress() < it->taskCount) {
+            it++;
+            continue;
+        }
+        pfnGlArbSyncObjectCleanup(*it->osInterface, it->syncInfo);
+        delete it->syncInfo;
+        it = releaseSyncObjects.erase(it);
+    }
+}
+
 GLboolean GLSharingFunctionsWindows::initGLFunctions() {
     glLibrary.reset(OsLibrary::load(Os::openglDllName));
 
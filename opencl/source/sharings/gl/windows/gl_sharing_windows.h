@@ -12,7 +12,11 @@
 #include "gl_types.h"
 #include <GL/gl.h>
 
+#include <vector>
+
 namespace NEO {
+class CommandStreamReceiver;
+
 //OpenGL API names
 typedef GLboolean(OSAPI *PFNOGLSetSharedOCLContextStateINTEL)(GLDisplay hdcHandle, GLContext contextHandle, GLboolean state, GLvoid *pContextInfo);
 typedef GLboolean(OSAPI *PFNOGLAcquireSharedBufferINTEL)(GLDisplay hdcHandle, GLContext contextHandle, GLContext backupContextHandle, GLvoid *pBufferInfo);
@@ -65,6 +69,11 @@ class GLSharingFunctionsWindows : public GLSharingFunctions {
     GlArbSyncEvent *getGlArbSyncEvent(Event &baseEvent);
     void removeGlArbSyncEventMapping(Event &baseEvent);
 
+    // GPU side wait of GL context for released objects
+    bool isGpuSyncReleaseSupported(CommandStreamReceiver &csr) const;
+    bool insertGpuWaitForRelease(CommandStreamReceiver &csr, uint32_t taskCount);
+    void cleanupReleaseSyncObjects(bool completedOnly);
+
     // Gl functions
     GLboolean acquireSharedBufferINTEL(GLvoid *pBufferInfo) {
         return GLAcquireSharedBuffer(GLHDCHandle, GLHGLRCHandle, GLHGLRCHandleBkpCtx, pBufferInfo);
@@ -178,6 +187,16 @@ class GLSharingFunctionsWindows : public GLSharingFunctions {
     // support for GL_ARB_cl_event
     std::mutex glArbEventMutex;
     std::unordered_map<Event *, GlArbSyncEvent *> glArbEventMapping;
+
+    // sync objects signaled after released objects were used, kept until CL work completes
+    struct ReleaseSyncObject {
+        CL_GL_SYNC_INFO *syncInfo;
+        OSInterface *osInterface;
+        CommandStreamReceiver *csr;
+        uint32_t taskCount;
+    };
+    std::mutex releaseSyncObjectsMutex;
+    std::vector<ReleaseSyncObject> releaseSyncObjects;
 };
 
 template <typename EventType>
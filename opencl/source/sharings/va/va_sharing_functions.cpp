@@ -8,6 +8,8 @@
 #include "va_sharing_functions.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
 
 #include "opencl/source/sharings/va/va_surface.h"
 
@@ -27,6 +29,11 @@ VASharingFunctions::VASharingFunctions(VADisplay vaDisplay) : vaDisplay(vaDispla
 };
 
 VASharingFunctions::~VASharingFunctions() {
+    for (auto &importedSurface : importedSurfaces) {
+        releaseImportedSurface(importedSurface);
+    }
+    importedSurfaces.clear();
+
     if (libHandle != nullptr) {
         fdlclose(libHandle);
         libHandle = nullptr;
@@ -42,6 +49,40 @@ bool VASharingFunctions::isVaLibraryAvailable() {
     return false;
 }
 
+bool VASharingFunctions::isSurfaceImportCacheEnabled() {
+    return DebugManager.flags.EnableVaSurfaceImportCache.get() == 1;
+}
+
+GraphicsAllocation *VASharingFunctions::findImportedSurface(VASurfaceID surfaceId, cl_uint plane, uint64_t bufferId, ImageInfo &imgInfo) {
+    for (auto it = importedSurfaces.begin(); it != importedSurfaces.end(); it++) {
+        if (it->surfaceId != surfaceId || it->plane != plane) {
+            continue;
+        }
+        if (it->bufferId != bufferId) {
+            // surface id was recycled by driver after destroying previous surface
+            releaseImportedSurface(*it);
+            importedSurfaces.erase(it);
+            return nullptr;
+        }
+        imgInfo = it->imgInfo;
+        return it->allocation;
+    }
+    return nullptr;
+}
+
+void VASharingFunctions::addImportedSurface(VASurfaceID surfaceId, cl_uint plane, uint64_t bufferId, GraphicsAllocation *allocation, const ImageInfo &imgInfo, MemoryManager *memoryManager) {
+    allocation->incReuseCount();
+    importedSurfacesMemoryManager = memoryManager;
+    importedSurfaces.push_back({surfaceId, plane, bufferId, allocation, imgInfo});
+}
+
+void VASharingFunctions::releaseImportedSurface(const ImportedSurface &importedSurface) {
+    importedSurface.allocation->decReuseCount();
+    if (importedSurface.allocation->peekReuseCount() == 0) {
+        importedSurfacesMemoryManager->checkGpuUsageAndDestroyGraphicsAllocations(importedSurface.allocation);
+    }
+}
+
 void VASharingFunctions::initFunctions() {
     bool enableVaLibCalls = true;
     if (DebugManager.flags.EnableVaLibCalls.get() != -1) {
@@ -6,6 +6,8 @@
  */
 
 #pragma once
+#include "shared/source/helpers/surface_format_info.h"
+
 #include "opencl/source/sharings/sharing.h"
 #include "opencl/source/sharings/va/va_sharing_defines.h"
 
@@ -14,6 +16,8 @@
 #include <vector>
 
 namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
 
 class VASharingFunctions : public SharingFunctions {
   public:
@@ -83,6 +87,10 @@ class VASharingFunctions : public SharingFunctions {
 
     static bool isVaLibraryAvailable();
 
+    static bool isSurfaceImportCacheEnabled();
+    GraphicsAllocation *findImportedSurface(VASurfaceID surfaceId, cl_uint plane, uint64_t bufferId, ImageInfo &imgInfo);
+    void addImportedSurface(VASurfaceID surfaceId, cl_uint plane, uint64_t bufferId, GraphicsAllocation *allocation, const ImageInfo &imgInfo, MemoryManager *memoryManager);
+
     std::mutex mutex;
 
   protected:
@@ -100,5 +108,19 @@ class VASharingFunctions : public SharingFunctions {
 
     std::vector<VAImageFormat> supported2PlaneFormats;
     std::vector<VAImageFormat> supported3PlaneFormats;
+
+    // Imported surface allocations kept for reuse, guarded by mutex.
+    // Each entry holds one reuse count of its allocation, every image created from it holds another one.
+    struct ImportedSurface {
+        VASurfaceID surfaceId;
+        cl_uint plane;
+        uint64_t bufferId;
+        GraphicsAllocation *allocation;
+        ImageInfo imgInfo;
+    };
+    void releaseImportedSurface(const ImportedSurface &importedSurface);
+
+    std::vector<ImportedSurface> importedSurfaces;
+    MemoryManager *importedSurfacesMemoryManager = nullptr;
 };
 } // namespace NEO
@@ -10,6 +10,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
@@ -41,6 +42,10 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
     size_t imageOffset = 0;
     size_t imagePitch = 0;
 
+    bool useImportCache = VASharingFunctions::isSurfaceImportCacheEnabled();
+    bool exportedHandle = false;
+    uint64_t bufferId = 0;
+
     std::unique_lock<std::mutex> lock(sharingFunctions->mutex);
 
     vaStatus = sharingFunctions->exportSurfaceHandle(*surface,
@@ -61,6 +66,13 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
         }
         imgInfo.linearStorage = DRM_FORMAT_MOD_LINEAR == vaDrmPrimeSurfaceDesc.objects[0].drm_format_modifier;
         sharedHandle = vaDrmPrimeSurfaceDesc.objects[0].fd;
+        exportedHandle = true;
+        if (useImportCache) {
+            // dma-buf inode stays the same for every export of the same buffer
+            struct stat bufferStat = {};
+            useImportCache = SysCalls::fstat(sharedHandle, &bufferStat) == 0;
+            bufferId = static_cast<uint64_t>(bufferStat.st_ino);
+        }
     } else {
         sharingFunctions->deriveImage(*surface, &vaImage);
         imageId = vaImage.image_id;
@@ -76,6 +88,7 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
         }
         imgInfo.linearStorage = false;
         sharingFunctions->extGetSurfaceHandle(surface, &sharedHandle);
+        bufferId = sharedHandle;
     }
 
     bool isRGBPFormat = DebugManager.flags.EnableExtendedVaFormats.get() && imageFourcc == VA_FOURCC_RGBP;
@@ -116,9 +129,27 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
                                     imgInfo, GraphicsAllocation::AllocationType::SHARED_IMAGE,
                                     context->getDeviceBitfieldForAllocation(context->getDevice(0)->getRootDeviceIndex()));
 
-    auto alloc = memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, properties, false);
+    GraphicsAllocation *alloc = nullptr;
+    if (useImportCache) {
+        alloc = sharingFunctions->findImportedSurface(*surface, plane, bufferId, imgInfo);
+    }
+    if (alloc) {
+        alloc->incReuseCount(); // decremented in releaseReusedGraphicsAllocation() called from MemObj destructor
+        if (exportedHandle) {
+            SysCalls::close(static_cast<int>(sharedHandle));
+        }
+    } else {
+        alloc = memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, properties, false);
+
+        memoryManager->closeSharedHandle(alloc);
 
-    memoryManager->closeSharedHandle(alloc);
+        if (useImportCache && alloc) {
+            sharingFunctions->addImportedSurface(*surface, plane, bufferId, alloc, imgInfo, memoryManager);
+            alloc->incReuseCount(); // decremented in releaseReusedGraphicsAllocation() called from MemObj destructor
+        } else {
+            useImportCache = false;
+        }
+    }
 
     lock.unlock();
 
@@ -145,6 +176,9 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
     }
 
     auto vaSurface = new VASurface(sharingFunctions, imageId, plane, surface, context->getInteropUserSyncEnabled());
+    if (useImportCache) {
+        vaSurface->reusedAllocation = alloc;
+    }
     auto multiGraphicsAllocation = MultiGraphicsAllocation(context->getDevice(0)->getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(alloc);
 
@@ -160,6 +194,13 @@ void VASurface::synchronizeObject(UpdateData &updateData) {
     updateData.synchronizationStatus = SynchronizeStatus::ACQUIRE_SUCCESFUL;
 }
 
+void VASurface::releaseReusedGraphicsAllocation() {
+    if (reusedAllocation) {
+        std::unique_lock<std::mutex> lock(sharingFunctions->mutex);
+        reusedAllocation->decReuseCount();
+    }
+}
+
 void VASurface::getMemObjectInfo(size_t &paramValueSize, void *&paramValue) {
     paramValueSize = sizeof(surfaceId);
     paramValue = &surfaceId;
@@ -21,6 +21,8 @@ class VASurface : VASharing {
 
     void synchronizeObject(UpdateData &updateData) override;
 
+    void releaseReusedGraphicsAllocation() override;
+
     void getMemObjectInfo(size_t &paramValueSize, void *&paramValue) override;
 
     static bool validate(cl_mem_flags flags, cl_uint plane);
@@ -36,5 +38,6 @@ class VASurface : VASharing {
     cl_uint plane;
     VASurfaceID *surfaceId;
     bool interopUserSync;
+    GraphicsAllocation *reusedAllocation = nullptr;
 };
 } // namespace NEO
@@ -10,59 +10,148 @@
 #include "opencl/source/tracing/tracing_handle.h"
 #include "opencl/source/tracing/tracing_notify.h"
 
+#include <mutex>
+
 namespace HostSideTracing {
 
-// [XYZZ..Z] - { X - enabled/disabled bit, Y - locked/unlocked bit, ZZ..Z - client count bits }
-std::atomic<uint32_t> tracingState(0);
-TracingHandle *tracingHandle[TRACING_MAX_HANDLE_COUNT] = {nullptr};
+std::atomic<TracingHandleList *> tracingHandleList(nullptr);
+std::atomic<uint64_t> tracingPointMask[(CL_FUNCTION_COUNT + 63) / 64] = {};
 std::atomic<uint32_t> tracingCorrelationId(0);
 
-bool addTracingClient() {
-    uint32_t state = tracingState.load(std::memory_order_acquire);
-    state = TRACING_SET_ENABLED_BIT(state);
-    state = TRACING_UNSET_LOCKED_BIT(state);
-    AtomicBackoff backoff;
-    while (!tracingState.compare_exchange_weak(state, state + 1, std::memory_order_release,
-                                               std::memory_order_acquire)) {
-        if (!TRACING_GET_ENABLED_BIT(state)) {
-            return false;
-        } else if (TRACING_GET_LOCKED_BIT(state)) {
-            DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(state) != 0);
-            state = TRACING_UNSET_LOCKED_BIT(state);
-            backoff.pause();
-        } else {
-            backoff.pause();
+namespace {
+// Odd epoch means owning thread is inside traced API call. Each reader sits in its own cache line,
+// so entering and leaving a call touches only memory of the calling thread.
+struct alignas(64) TracingReader {
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<bool> inUse{false};
+    uint32_t nesting = 0;
+};
+
+TracingReader tracingReaders[TRACING_MAX_READER_COUNT];
+// calls from threads that did not get own reader are counted here
+std::atomic<uint32_t> tracingOverflowReaders(0);
+std::mutex tracingWriterMutex;
+
+struct TracingReaderSlot {
+    ~TracingReaderSlot() {
+        if (reader != nullptr) {
+            reader->inUse.store(false, std::memory_order_release);
+        }
+    }
+
+    TracingReader *reader = nullptr;
+    uint32_t overflowNesting = 0;
+    bool acquired = false;
+};
+
+thread_local TracingReaderSlot tracingReaderSlot;
+
+TracingReader *getTracingReader() {
+    auto &slot = tracingReaderSlot;
+    if (!slot.acquired) {
+        slot.acquired = true;
+        for (auto &reader : tracingReaders) {
+            bool expected = false;
+            if (!reader.inUse.load(std::memory_order_relaxed) &&
+                reader.inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                DEBUG_BREAK_IF(reader.epoch.load(std::memory_order_relaxed) % 2 != 0);
+                slot.reader = &reader;
+                break;
+            }
         }
     }
-    return true;
+    return slot.reader;
 }
 
-void removeTracingClient() {
-    DEBUG_BREAK_IF(!TRACING_GET_ENABLED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) == 0);
-    tracingState.fetch_sub(1, std::memory_order_acq_rel);
+void enterReadSection() {
+    auto reader = getTracingReader();
+    if (reader == nullptr) {
+        if (tracingReaderSlot.overflowNesting++ == 0) {
+            tracingOverflowReaders.fetch_add(1, std::memory_order_seq_cst);
+        }
+        return;
+    }
+    if (reader->nesting++ == 0) {
+        reader->epoch.fetch_add(1, std::memory_order_seq_cst);
+    }
 }
 
-static void LockTracingState() {
-    uint32_t state = tracingState.load(std::memory_order_acquire);
-    state = TRACING_ZERO_CLIENT_COUNTER(state);
-    state = TRACING_UNSET_LOCKED_BIT(state);
+void leaveReadSection() {
+    auto reader = tracingReaderSlot.reader;
+    if (reader == nullptr) {
+        DEBUG_BREAK_IF(tracingReaderSlot.overflowNesting == 0);
+        if (--tracingReaderSlot.overflowNesting == 0) {
+            tracingOverflowReaders.fetch_sub(1, std::memory_order_release);
+        }
+        return;
+    }
+    DEBUG_BREAK_IF(reader->nesting == 0);
+    if (--reader->nesting == 0) {
+        reader->epoch.fetch_add(1, std::memory_order_release);
+    }
+}
+
+// Waits until every API call that might have observed previously published list is finished
+void waitForTracingReaders() {
+    for (auto &reader : tracingReaders) {
+        auto epoch = reader.epoch.load(std::memory_order_seq_cst);
+        if (epoch % 2 == 0) {
+            continue;
+        }
+        AtomicBackoff backoff;
+        while (reader.epoch.load(std::memory_order_acquire) == epoch) {
+            backoff.pause();
+        }
+    }
     AtomicBackoff backoff;
-    while (!tracingState.compare_exchange_weak(state, TRACING_SET_LOCKED_BIT(state),
-                                               std::memory_order_release, std::memory_order_acquire)) {
-        state = TRACING_ZERO_CLIENT_COUNTER(state);
-        state = TRACING_UNSET_LOCKED_BIT(state);
+    while (tracingOverflowReaders.load(std::memory_order_acquire) != 0) {
         backoff.pause();
     }
-    DEBUG_BREAK_IF(!TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) > 0);
 }
 
-static void UnlockTracingState() {
-    DEBUG_BREAK_IF(!TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) > 0);
-    tracingState.fetch_and(~TRACING_STATE_LOCKED_BIT, std::memory_order_acq_rel);
+void updateTracingPointMask(const TracingHandleList *list) {
+    for (uint32_t word = 0; word < (CL_FUNCTION_COUNT + 63) / 64; word++) {
+        uint64_t mask = 0;
+        for (uint32_t bit = 0; bit < 64 && word * 64 + bit < CL_FUNCTION_COUNT; bit++) {
+            auto fid = static_cast<cl_function_id>(word * 64 + bit);
+            for (size_t i = 0; list != nullptr && i < TRACING_MAX_HANDLE_COUNT && list->handles[i] != nullptr; ++i) {
+                if (list->handles[i]->getTracingPoint(fid)) {
+                    mask |= 1ull << bit;
+                    break;
+                }
+            }
+        }
+        tracingPointMask[word].store(mask, std::memory_order_relaxed);
+    }
+}
+
+size_t getHandlesCount(const TracingHandleList *list) {
+    size_t count = 0;
+    while (list != nullptr && count < TRACING_MAX_HANDLE_COUNT && list->handles[count] != nullptr) {
+        ++count;
+    }
+    return count;
+}
+
+void publishTracingHandleList(TracingHandleList *newList) {
+    auto oldList = tracingHandleList.exchange(newList, std::memory_order_seq_cst);
+    updateTracingPointMask(newList);
+    waitForTracingReaders();
+    delete oldList;
+}
+} // namespace
+
+const TracingHandleList *addTracingClient() {
+    enterReadSection();
+    auto list = tracingHandleList.load(std::memory_order_seq_cst);
+    if (list == nullptr) {
+        leaveReadSection();
+    }
+    return list;
+}
+
+void removeTracingClient() {
+    leaveReadSection();
 }
 
 } // namespace HostSideTracing
@@ -99,7 +188,9 @@ cl_int CL_API_CALL clSetTracingPointINTEL(cl_tracing_handle handle, cl_function_
         return CL_INVALID_VALUE;
     }
 
+    std::lock_guard<std::mutex> lock(tracingWriterMutex);
     handle->handle->setTracingPoint(fid, enable);
+    updateTracingPointMask(tracingHandleList.load(std::memory_order_acquire));
 
     return CL_SUCCESS;
 }
@@ -121,30 +212,29 @@ cl_int CL_API_CALL clEnableTracingINTEL(cl_tracing_handle handle) {
         return CL_INVALID_VALUE;
     }
 
-    LockTracingState();
+    std::lock_guard<std::mutex> lock(tracingWriterMutex);
+
+    auto currentList = tracingHandleList.load(std::memory_order_acquire);
+    auto size = getHandlesCount(currentList);
 
-    size_t i = 0;
     DEBUG_BREAK_IF(handle->handle == nullptr);
-    while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-        if (tracingHandle[i] == handle->handle) {
-            UnlockTracingState();
+    for (size_t i = 0; i < size; ++i) {
+        if (currentList->handles[i] == handle->handle) {
             return CL_INVALID_VALUE;
         }
-        ++i;
     }
 
-    if (i == TRACING_MAX_HANDLE_COUNT) {
-        UnlockTracingState();
+    if (size == TRACING_MAX_HANDLE_COUNT) {
         return CL_OUT_OF_RESOURCES;
     }
 
-    DEBUG_BREAK_IF(tracingHandle[i] != nullptr);
-    tracingHandle[i] = handle->handle;
-    if (i == 0) {
-        tracingState.fetch_or(TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
+    auto newList = new TracingHandleList;
+    for (size_t i = 0; i < size; ++i) {
+        newList->handles[i] = currentList->handles[i];
     }
+    newList->handles[size] = handle->handle;
+    publishTracingHandleList(newList);
 
-    UnlockTracingState();
     return CL_SUCCESS;
 }
 
@@ -153,32 +243,29 @@ cl_int CL_API_CALL clDisableTracingINTEL(cl_tracing_handle handle) {
         return CL_INVALID_VALUE;
     }
 
-    LockTracingState();
+    std::lock_guard<std::mutex> lock(tracingWriterMutex);
 
-    size_t size = 0;
-    while (size < TRACING_MAX_HANDLE_COUNT && tracingHandle[size] != nullptr) {
-        ++size;
-    }
+    auto currentList = tracingHandleList.load(std::memory_order_acquire);
+    auto size = getHandlesCount(currentList);
 
-    size_t i = 0;
     DEBUG_BREAK_IF(handle->handle == nullptr);
-    while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-        if (tracingHandle[i] == handle->handle) {
-            if (size == 1) {
-                DEBUG_BREAK_IF(i != 0);
-                tracingState.fetch_and(~TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
-                tracingHandle[i] = nullptr;
-            } else {
-                tracingHandle[i] = tracingHandle[size - 1];
-                tracingHandle[size - 1] = nullptr;
+    for (size_t i = 0; i < size; ++i) {
+        if (currentList->handles[i] == handle->handle) {
+            TracingHandleList *newList = nullptr;
+            if (size > 1) {
+                newList = new TracingHandleList;
+                for (size_t j = 0; j < size; ++j) {
+                    newList->handles[j] = currentList->handles[j];
+                }
+                newList->handles[i] = currentList->handles[size - 1];
+                newList->handles[size - 1] = nullptr;
             }
-            UnlockTracingState();
+            // after publishing returns no API call uses disabled handle, so it can be destroyed
+            publishTracingHandleList(newList);
             return CL_SUCCESS;
         }
-        ++i;
     }
 
-    UnlockTracingState();
     return CL_INVALID_VALUE;
 }
 
@@ -187,20 +274,20 @@ cl_int CL_API_CALL clGetTracingStateINTEL(cl_tracing_handle handle, cl_bool *ena
         return CL_INVALID_VALUE;
     }
 
-    LockTracingState();
+    std::lock_guard<std::mutex> lock(tracingWriterMutex);
 
     *enable = CL_FALSE;
 
-    size_t i = 0;
+    auto currentList = tracingHandleList.load(std::memory_order_acquire);
+    auto size = getHandlesCount(currentList);
+
     DEBUG_BREAK_IF(handle->handle == nullptr);
-    while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-        if (tracingHandle[i] == handle->handle) {
+    for (size_t i = 0; i < size; ++i) {
+        if (currentList->handles[i] == handle->handle) {
             *enable = CL_TRUE;
             break;
         }
-        ++i;
     }
 
-    UnlockTracingState();
     return CL_SUCCESS;
 }
@@ -17,25 +17,16 @@
 
 namespace HostSideTracing {
 
-#define TRACING_SET_ENABLED_BIT(state) ((state) | (HostSideTracing::TRACING_STATE_ENABLED_BIT))
-#define TRACING_UNSET_ENABLED_BIT(state) ((state) & (~HostSideTracing::TRACING_STATE_ENABLED_BIT))
-#define TRACING_GET_ENABLED_BIT(state) ((state) & (HostSideTracing::TRACING_STATE_ENABLED_BIT))
-
-#define TRACING_SET_LOCKED_BIT(state) ((state) | (HostSideTracing::TRACING_STATE_LOCKED_BIT))
-#define TRACING_UNSET_LOCKED_BIT(state) ((state) & (~HostSideTracing::TRACING_STATE_LOCKED_BIT))
-#define TRACING_GET_LOCKED_BIT(state) ((state) & (HostSideTracing::TRACING_STATE_LOCKED_BIT))
-
-#define TRACING_ZERO_CLIENT_COUNTER(state) ((state) & (HostSideTracing::TRACING_STATE_ENABLED_BIT | HostSideTracing::TRACING_STATE_LOCKED_BIT))
-#define TRACING_GET_CLIENT_COUNTER(state) ((state) & (~(HostSideTracing::TRACING_STATE_ENABLED_BIT | HostSideTracing::TRACING_STATE_LOCKED_BIT)))
-
-#define TRACING_ENTER(name, ...)                                                                  \
-    bool isHostSideTracingEnabled_##name = false;                                                 \
-    HostSideTracing::name##Tracer tracer_##name;                                                  \
-    if (TRACING_GET_ENABLED_BIT(HostSideTracing::tracingState.load(std::memory_order_acquire))) { \
-        isHostSideTracingEnabled_##name = HostSideTracing::addTracingClient();                    \
-        if (isHostSideTracingEnabled_##name) {                                                    \
-            tracer_##name.enter(__VA_ARGS__);                                                     \
-        }                                                                                         \
+#define TRACING_ENTER(name, ...)                                                 \
+    bool isHostSideTracingEnabled_##name = false;                                \
+    HostSideTracing::name##Tracer tracer_##name;                                 \
+    if (HostSideTracing::isTracingPointEnabled(CL_FUNCTION_##name)) {            \
+        auto tracingHandleList_##name = HostSideTracing::addTracingClient();     \
+        isHostSideTracingEnabled_##name = (tracingHandleList_##name != nullptr); \
+        if (isHostSideTracingEnabled_##name) {                                   \
+            tracer_##name.setHandleList(tracingHandleList_##name);               \
+            tracer_##name.enter(__VA_ARGS__);                                    \
+        }                                                                        \
     }
 
 #define TRACING_EXIT(name, ...)                 \
@@ -51,15 +42,24 @@ typedef enum _tracing_notify_state_t {
 } tracing_notify_state_t;
 
 constexpr size_t TRACING_MAX_HANDLE_COUNT = 16;
+constexpr size_t TRACING_MAX_READER_COUNT = 1024;
 
-constexpr uint32_t TRACING_STATE_ENABLED_BIT = 0x80000000u;
-constexpr uint32_t TRACING_STATE_LOCKED_BIT = 0x40000000u;
+// Immutable copy of enabled handles, replaced as a whole when tracing is enabled or disabled.
+// Old copy is released only after every thread that could have read it left its API call.
+struct TracingHandleList {
+    TracingHandle *handles[TRACING_MAX_HANDLE_COUNT] = {nullptr};
+};
 
-extern std::atomic<uint32_t> tracingState;
-extern TracingHandle *tracingHandle[TRACING_MAX_HANDLE_COUNT];
+extern std::atomic<TracingHandleList *> tracingHandleList;
+extern std::atomic<uint64_t> tracingPointMask[(CL_FUNCTION_COUNT + 63) / 64];
 extern std::atomic<uint32_t> tracingCorrelationId;
 
-bool addTracingClient();
+inline bool isTracingPointEnabled(cl_function_id fid) {
+    auto index = static_cast<uint32_t>(fid);
+    return (tracingPointMask[index / 64].load(std::memory_order_relaxed) & (1ull << (index % 64))) != 0;
+}
+
+const TracingHandleList *addTracingClient();
 void removeTracingClient();
 
 class AtomicBackoff {
@@ -86,6 +86,10 @@ class clBuildProgramTracer {
   public:
     clBuildProgramTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -108,9 +112,9 @@ class clBuildProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clBuildProgram)) {
                 data.correlationData = correlationData + i;
@@ -128,9 +132,9 @@ class clBuildProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clBuildProgram)) {
                 data.correlationData = correlationData + i;
@@ -150,6 +154,7 @@ class clBuildProgramTracer {
     cl_params_clBuildProgram params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -157,6 +162,10 @@ class clCloneKernelTracer {
   public:
     clCloneKernelTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *sourceKernel,
                cl_int **errcodeRet) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -171,9 +180,9 @@ class clCloneKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCloneKernel)) {
                 data.correlationData = correlationData + i;
@@ -191,9 +200,9 @@ class clCloneKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCloneKernel)) {
                 data.correlationData = correlationData + i;
@@ -213,6 +222,7 @@ class clCloneKernelTracer {
     cl_params_clCloneKernel params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -220,6 +230,10 @@ class clCompileProgramTracer {
   public:
     clCompileProgramTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -248,9 +262,9 @@ class clCompileProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCompileProgram)) {
                 data.correlationData = correlationData + i;
@@ -268,9 +282,9 @@ class clCompileProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCompileProgram)) {
                 data.correlationData = correlationData + i;
@@ -290,6 +304,7 @@ class clCompileProgramTracer {
     cl_params_clCompileProgram params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -297,6 +312,10 @@ class clCreateBufferTracer {
   public:
     clCreateBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                size_t *size,
@@ -317,9 +336,9 @@ class clCreateBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateBuffer)) {
                 data.correlationData = correlationData + i;
@@ -337,9 +356,9 @@ class clCreateBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateBuffer)) {
                 data.correlationData = correlationData + i;
@@ -359,6 +378,7 @@ class clCreateBufferTracer {
     cl_params_clCreateBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -366,6 +386,10 @@ class clCreateCommandQueueTracer {
   public:
     clCreateCommandQueueTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_device_id *device,
                cl_command_queue_properties *properties,
@@ -384,9 +408,9 @@ class clCreateCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -404,9 +428,9 @@ class clCreateCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -426,6 +450,7 @@ class clCreateCommandQueueTracer {
     cl_params_clCreateCommandQueue params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -433,6 +458,10 @@ class clCreateCommandQueueWithPropertiesTracer {
   public:
     clCreateCommandQueueWithPropertiesTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_device_id *device,
                const cl_queue_properties **properties,
@@ -451,9 +480,9 @@ class clCreateCommandQueueWithPropertiesTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueueWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -471,9 +500,9 @@ class clCreateCommandQueueWithPropertiesTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueueWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -493,6 +522,7 @@ class clCreateCommandQueueWithPropertiesTracer {
     cl_params_clCreateCommandQueueWithProperties params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -500,6 +530,10 @@ class clCreateContextTracer {
   public:
     clCreateContextTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(const cl_context_properties **properties,
                cl_uint *numDevices,
                const cl_device_id **devices,
@@ -522,9 +556,9 @@ class clCreateContextTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContext)) {
                 data.correlationData = correlationData + i;
@@ -542,9 +576,9 @@ class clCreateContextTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContext)) {
                 data.correlationData = correlationData + i;
@@ -564,6 +598,7 @@ class clCreateContextTracer {
     cl_params_clCreateContext params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -571,6 +606,10 @@ class clCreateContextFromTypeTracer {
   public:
     clCreateContextFromTypeTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(const cl_context_properties **properties,
                cl_device_type *deviceType,
                void(CL_CALLBACK **funcNotify)(const char *, const void *, size_t, void *),
@@ -591,9 +630,9 @@ class clCreateContextFromTypeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContextFromType)) {
                 data.correlationData = correlationData + i;
@@ -611,9 +650,9 @@ class clCreateContextFromTypeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContextFromType)) {
                 data.correlationData = correlationData + i;
@@ -633,6 +672,7 @@ class clCreateContextFromTypeTracer {
     cl_params_clCreateContextFromType params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -640,6 +680,10 @@ class clCreateImageTracer {
   public:
     clCreateImageTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                const cl_image_format **imageFormat,
@@ -662,9 +706,9 @@ class clCreateImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage)) {
                 data.correlationData = correlationData + i;
@@ -682,9 +726,9 @@ class clCreateImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage)) {
                 data.correlationData = correlationData + i;
@@ -704,6 +748,7 @@ class clCreateImageTracer {
     cl_params_clCreateImage params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -711,6 +756,10 @@ class clCreateImage2DTracer {
   public:
     clCreateImage2DTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                const cl_image_format **imageFormat,
@@ -737,9 +786,9 @@ class clCreateImage2DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage2D)) {
                 data.correlationData = correlationData + i;
@@ -757,9 +806,9 @@ class clCreateImage2DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage2D)) {
                 data.correlationData = correlationData + i;
@@ -779,6 +828,7 @@ class clCreateImage2DTracer {
     cl_params_clCreateImage2D params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -786,6 +836,10 @@ class clCreateImage3DTracer {
   public:
     clCreateImage3DTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                const cl_image_format **imageFormat,
@@ -816,9 +870,9 @@ class clCreateImage3DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage3D)) {
                 data.correlationData = correlationData + i;
@@ -836,9 +890,9 @@ class clCreateImage3DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage3D)) {
                 data.correlationData = correlationData + i;
@@ -858,6 +912,7 @@ class clCreateImage3DTracer {
     cl_params_clCreateImage3D params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -865,6 +920,10 @@ class clCreateKernelTracer {
   public:
     clCreateKernelTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program,
                const char **kernelName,
                cl_int **errcodeRet) {
@@ -881,9 +940,9 @@ class clCreateKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernel)) {
                 data.correlationData = correlationData + i;
@@ -901,9 +960,9 @@ class clCreateKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernel)) {
                 data.correlationData = correlationData + i;
@@ -923,6 +982,7 @@ class clCreateKernelTracer {
     cl_params_clCreateKernel params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -930,6 +990,10 @@ class clCreateKernelsInProgramTracer {
   public:
     clCreateKernelsInProgramTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program,
                cl_uint *numKernels,
                cl_kernel **kernels,
@@ -948,9 +1012,9 @@ class clCreateKernelsInProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernelsInProgram)) {
                 data.correlationData = correlationData + i;
@@ -968,9 +1032,9 @@ class clCreateKernelsInProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernelsInProgram)) {
                 data.correlationData = correlationData + i;
@@ -990,6 +1054,7 @@ class clCreateKernelsInProgramTracer {
     cl_params_clCreateKernelsInProgram params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -997,6 +1062,10 @@ class clCreatePipeTracer {
   public:
     clCreatePipeTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_uint *pipePacketSize,
@@ -1019,9 +1088,9 @@ class clCreatePipeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreatePipe)) {
                 data.correlationData = correlationData + i;
@@ -1039,9 +1108,9 @@ class clCreatePipeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreatePipe)) {
                 data.correlationData = correlationData + i;
@@ -1061,6 +1130,7 @@ class clCreatePipeTracer {
     cl_params_clCreatePipe params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1068,6 +1138,10 @@ class clCreateProgramWithBinaryTracer {
   public:
     clCreateProgramWithBinaryTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -1092,9 +1166,9 @@ class clCreateProgramWithBinaryTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBinary)) {
                 data.correlationData = correlationData + i;
@@ -1112,9 +1186,9 @@ class clCreateProgramWithBinaryTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBinary)) {
                 data.correlationData = correlationData + i;
@@ -1134,6 +1208,7 @@ class clCreateProgramWithBinaryTracer {
     cl_params_clCreateProgramWithBinary params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1141,6 +1216,10 @@ class clCreateProgramWithBuiltInKernelsTracer {
   public:
     clCreateProgramWithBuiltInKernelsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -1161,9 +1240,9 @@ class clCreateProgramWithBuiltInKernelsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBuiltInKernels)) {
                 data.correlationData = correlationData + i;
@@ -1181,9 +1260,9 @@ class clCreateProgramWithBuiltInKernelsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBuiltInKernels)) {
                 data.correlationData = correlationData + i;
@@ -1203,6 +1282,7 @@ class clCreateProgramWithBuiltInKernelsTracer {
     cl_params_clCreateProgramWithBuiltInKernels params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1210,6 +1290,10 @@ class clCreateProgramWithILTracer {
   public:
     clCreateProgramWithILTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                const void **il,
                size_t *length,
@@ -1228,9 +1312,9 @@ class clCreateProgramWithILTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithIL)) {
                 data.correlationData = correlationData + i;
@@ -1248,9 +1332,9 @@ class clCreateProgramWithILTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithIL)) {
                 data.correlationData = correlationData + i;
@@ -1270,6 +1354,7 @@ class clCreateProgramWithILTracer {
     cl_params_clCreateProgramWithIL params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1277,6 +1362,10 @@ class clCreateProgramWithSourceTracer {
   public:
     clCreateProgramWithSourceTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_uint *count,
                const char ***strings,
@@ -1297,9 +1386,9 @@ class clCreateProgramWithSourceTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithSource)) {
                 data.correlationData = correlationData + i;
@@ -1317,9 +1406,9 @@ class clCreateProgramWithSourceTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithSource)) {
                 data.correlationData = correlationData + i;
@@ -1339,6 +1428,7 @@ class clCreateProgramWithSourceTracer {
     cl_params_clCreateProgramWithSource params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1346,6 +1436,10 @@ class clCreateSamplerTracer {
   public:
     clCreateSamplerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_bool *normalizedCoords,
                cl_addressing_mode *addressingMode,
@@ -1366,9 +1460,9 @@ class clCreateSamplerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSampler)) {
                 data.correlationData = correlationData + i;
@@ -1386,9 +1480,9 @@ class clCreateSamplerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSampler)) {
                 data.correlationData = correlationData + i;
@@ -1408,6 +1502,7 @@ class clCreateSamplerTracer {
     cl_params_clCreateSampler params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1415,6 +1510,10 @@ class clCreateSamplerWithPropertiesTracer {
   public:
     clCreateSamplerWithPropertiesTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                const cl_sampler_properties **samplerProperties,
                cl_int **errcodeRet) {
@@ -1431,9 +1530,9 @@ class clCreateSamplerWithPropertiesTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSamplerWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -1451,9 +1550,9 @@ class clCreateSamplerWithPropertiesTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSamplerWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -1473,6 +1572,7 @@ class clCreateSamplerWithPropertiesTracer {
     cl_params_clCreateSamplerWithProperties params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1480,6 +1580,10 @@ class clCreateSubBufferTracer {
   public:
     clCreateSubBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *buffer,
                cl_mem_flags *flags,
                cl_buffer_create_type *bufferCreateType,
@@ -1500,9 +1604,9 @@ class clCreateSubBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSubBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1520,9 +1624,9 @@ class clCreateSubBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSubBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1542,6 +1646,7 @@ class clCreateSubBufferTracer {
     cl_params_clCreateSubBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1549,6 +1654,10 @@ class clCreateUserEventTracer {
   public:
     clCreateUserEventTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_int **errcodeRet) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -1563,9 +1672,9 @@ class clCreateUserEventTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateUserEvent)) {
                 data.correlationData = correlationData + i;
@@ -1583,9 +1692,9 @@ class clCreateUserEventTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateUserEvent)) {
                 data.correlationData = correlationData + i;
@@ -1605,6 +1714,7 @@ class clCreateUserEventTracer {
     cl_params_clCreateUserEvent params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1612,6 +1722,10 @@ class clEnqueueBarrierTracer {
   public:
     clEnqueueBarrierTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -1624,9 +1738,9 @@ class clEnqueueBarrierTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrier)) {
                 data.correlationData = correlationData + i;
@@ -1644,9 +1758,9 @@ class clEnqueueBarrierTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrier)) {
                 data.correlationData = correlationData + i;
@@ -1666,6 +1780,7 @@ class clEnqueueBarrierTracer {
     cl_params_clEnqueueBarrier params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1673,6 +1788,10 @@ class clEnqueueBarrierWithWaitListTracer {
   public:
     clEnqueueBarrierWithWaitListTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numEventsInWaitList,
                const cl_event **eventWaitList,
@@ -1691,9 +1810,9 @@ class clEnqueueBarrierWithWaitListTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrierWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -1711,9 +1830,9 @@ class clEnqueueBarrierWithWaitListTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrierWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -1733,6 +1852,7 @@ class clEnqueueBarrierWithWaitListTracer {
     cl_params_clEnqueueBarrierWithWaitList params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1740,6 +1860,10 @@ class clEnqueueCopyBufferTracer {
   public:
     clEnqueueCopyBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcBuffer,
                cl_mem *dstBuffer,
@@ -1768,9 +1892,9 @@ class clEnqueueCopyBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1788,9 +1912,9 @@ class clEnqueueCopyBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1810,6 +1934,7 @@ class clEnqueueCopyBufferTracer {
     cl_params_clEnqueueCopyBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1817,6 +1942,10 @@ class clEnqueueCopyBufferRectTracer {
   public:
     clEnqueueCopyBufferRectTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcBuffer,
                cl_mem *dstBuffer,
@@ -1853,9 +1982,9 @@ class clEnqueueCopyBufferRectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -1873,9 +2002,9 @@ class clEnqueueCopyBufferRectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -1895,6 +2024,7 @@ class clEnqueueCopyBufferRectTracer {
     cl_params_clEnqueueCopyBufferRect params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1902,6 +2032,10 @@ class clEnqueueCopyBufferToImageTracer {
   public:
     clEnqueueCopyBufferToImageTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcBuffer,
                cl_mem *dstImage,
@@ -1930,9 +2064,9 @@ class clEnqueueCopyBufferToImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferToImage)) {
                 data.correlationData = correlationData + i;
@@ -1950,9 +2084,9 @@ class clEnqueueCopyBufferToImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferToImage)) {
                 data.correlationData = correlationData + i;
@@ -1972,6 +2106,7 @@ class clEnqueueCopyBufferToImageTracer {
     cl_params_clEnqueueCopyBufferToImage params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -1979,6 +2114,10 @@ class clEnqueueCopyImageTracer {
   public:
     clEnqueueCopyImageTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcImage,
                cl_mem *dstImage,
@@ -2007,9 +2146,9 @@ class clEnqueueCopyImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImage)) {
                 data.correlationData = correlationData + i;
@@ -2027,9 +2166,9 @@ class clEnqueueCopyImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImage)) {
                 data.correlationData = correlationData + i;
@@ -2049,6 +2188,7 @@ class clEnqueueCopyImageTracer {
     cl_params_clEnqueueCopyImage params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2056,6 +2196,10 @@ class clEnqueueCopyImageToBufferTracer {
   public:
     clEnqueueCopyImageToBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcImage,
                cl_mem *dstBuffer,
@@ -2084,9 +2228,9 @@ class clEnqueueCopyImageToBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImageToBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2104,9 +2248,9 @@ class clEnqueueCopyImageToBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImageToBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2126,6 +2270,7 @@ class clEnqueueCopyImageToBufferTracer {
     cl_params_clEnqueueCopyImageToBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2133,6 +2278,10 @@ class clEnqueueFillBufferTracer {
   public:
     clEnqueueFillBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                const void **pattern,
@@ -2161,9 +2310,9 @@ class clEnqueueFillBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2181,9 +2330,9 @@ class clEnqueueFillBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2203,6 +2352,7 @@ class clEnqueueFillBufferTracer {
     cl_params_clEnqueueFillBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2210,6 +2360,10 @@ class clEnqueueFillImageTracer {
   public:
     clEnqueueFillImageTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                const void **fillColor,
@@ -2236,9 +2390,9 @@ class clEnqueueFillImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillImage)) {
                 data.correlationData = correlationData + i;
@@ -2256,9 +2410,9 @@ class clEnqueueFillImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillImage)) {
                 data.correlationData = correlationData + i;
@@ -2278,6 +2432,7 @@ class clEnqueueFillImageTracer {
     cl_params_clEnqueueFillImage params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2285,6 +2440,10 @@ class clEnqueueMapBufferTracer {
   public:
     clEnqueueMapBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingMap,
@@ -2315,9 +2474,9 @@ class clEnqueueMapBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2335,9 +2494,9 @@ class clEnqueueMapBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2357,6 +2516,7 @@ class clEnqueueMapBufferTracer {
     cl_params_clEnqueueMapBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2364,6 +2524,10 @@ class clEnqueueMapImageTracer {
   public:
     clEnqueueMapImageTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                cl_bool *blockingMap,
@@ -2398,9 +2562,9 @@ class clEnqueueMapImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapImage)) {
                 data.correlationData = correlationData + i;
@@ -2418,9 +2582,9 @@ class clEnqueueMapImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapImage)) {
                 data.correlationData = correlationData + i;
@@ -2440,6 +2604,7 @@ class clEnqueueMapImageTracer {
     cl_params_clEnqueueMapImage params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2447,6 +2612,10 @@ class clEnqueueMarkerTracer {
   public:
     clEnqueueMarkerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_event **event) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -2461,9 +2630,9 @@ class clEnqueueMarkerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarker)) {
                 data.correlationData = correlationData + i;
@@ -2481,9 +2650,9 @@ class clEnqueueMarkerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarker)) {
                 data.correlationData = correlationData + i;
@@ -2503,6 +2672,7 @@ class clEnqueueMarkerTracer {
     cl_params_clEnqueueMarker params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2510,6 +2680,10 @@ class clEnqueueMarkerWithWaitListTracer {
   public:
     clEnqueueMarkerWithWaitListTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numEventsInWaitList,
                const cl_event **eventWaitList,
@@ -2528,9 +2702,9 @@ class clEnqueueMarkerWithWaitListTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarkerWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -2548,9 +2722,9 @@ class clEnqueueMarkerWithWaitListTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarkerWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -2570,6 +2744,7 @@ class clEnqueueMarkerWithWaitListTracer {
     cl_params_clEnqueueMarkerWithWaitList params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2577,6 +2752,10 @@ class clEnqueueMigrateMemObjectsTracer {
   public:
     clEnqueueMigrateMemObjectsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numMemObjects,
                const cl_mem **memObjects,
@@ -2601,9 +2780,9 @@ class clEnqueueMigrateMemObjectsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMigrateMemObjects)) {
                 data.correlationData = correlationData + i;
@@ -2621,9 +2800,9 @@ class clEnqueueMigrateMemObjectsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMigrateMemObjects)) {
                 data.correlationData = correlationData + i;
@@ -2643,6 +2822,7 @@ class clEnqueueMigrateMemObjectsTracer {
     cl_params_clEnqueueMigrateMemObjects params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2650,6 +2830,10 @@ class clEnqueueNDRangeKernelTracer {
   public:
     clEnqueueNDRangeKernelTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_kernel *kernel,
                cl_uint *workDim,
@@ -2678,9 +2862,9 @@ class clEnqueueNDRangeKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNDRangeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2698,9 +2882,9 @@ class clEnqueueNDRangeKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNDRangeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2720,6 +2904,7 @@ class clEnqueueNDRangeKernelTracer {
     cl_params_clEnqueueNDRangeKernel params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2727,6 +2912,10 @@ class clEnqueueNativeKernelTracer {
   public:
     clEnqueueNativeKernelTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                void(CL_CALLBACK **userFunc)(void *),
                void **args,
@@ -2757,9 +2946,9 @@ class clEnqueueNativeKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNativeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2777,9 +2966,9 @@ class clEnqueueNativeKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNativeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2799,6 +2988,7 @@ class clEnqueueNativeKernelTracer {
     cl_params_clEnqueueNativeKernel params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2806,6 +2996,10 @@ class clEnqueueReadBufferTracer {
   public:
     clEnqueueReadBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingRead,
@@ -2834,9 +3028,9 @@ class clEnqueueReadBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2854,9 +3048,9 @@ class clEnqueueReadBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2876,6 +3070,7 @@ class clEnqueueReadBufferTracer {
     cl_params_clEnqueueReadBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2883,6 +3078,10 @@ class clEnqueueReadBufferRectTracer {
   public:
     clEnqueueReadBufferRectTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingRead,
@@ -2921,9 +3120,9 @@ class clEnqueueReadBufferRectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -2941,9 +3140,9 @@ class clEnqueueReadBufferRectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -2963,6 +3162,7 @@ class clEnqueueReadBufferRectTracer {
     cl_params_clEnqueueReadBufferRect params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -2970,6 +3170,10 @@ class clEnqueueReadImageTracer {
   public:
     clEnqueueReadImageTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                cl_bool *blockingRead,
@@ -3002,9 +3206,9 @@ class clEnqueueReadImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadImage)) {
                 data.correlationData = correlationData + i;
@@ -3022,9 +3226,9 @@ class clEnqueueReadImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadImage)) {
                 data.correlationData = correlationData + i;
@@ -3044,6 +3248,7 @@ class clEnqueueReadImageTracer {
     cl_params_clEnqueueReadImage params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3051,6 +3256,10 @@ class clEnqueueSVMFreeTracer {
   public:
     clEnqueueSVMFreeTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numSvmPointers,
                void ***svmPointers,
@@ -3077,9 +3286,9 @@ class clEnqueueSVMFreeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -3097,9 +3306,9 @@ class clEnqueueSVMFreeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -3119,6 +3328,7 @@ class clEnqueueSVMFreeTracer {
     cl_params_clEnqueueSVMFree params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3126,6 +3336,10 @@ class clEnqueueSVMMapTracer {
   public:
     clEnqueueSVMMapTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_bool *blockingMap,
                cl_map_flags *mapFlags,
@@ -3152,9 +3366,9 @@ class clEnqueueSVMMapTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMap)) {
                 data.correlationData = correlationData + i;
@@ -3172,9 +3386,9 @@ class clEnqueueSVMMapTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMap)) {
                 data.correlationData = correlationData + i;
@@ -3194,6 +3408,7 @@ class clEnqueueSVMMapTracer {
     cl_params_clEnqueueSVMMap params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3201,6 +3416,10 @@ class clEnqueueSVMMemFillTracer {
   public:
     clEnqueueSVMMemFillTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                void **svmPtr,
                const void **pattern,
@@ -3227,9 +3446,9 @@ class clEnqueueSVMMemFillTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemFill)) {
                 data.correlationData = correlationData + i;
@@ -3247,9 +3466,9 @@ class clEnqueueSVMMemFillTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemFill)) {
                 data.correlationData = correlationData + i;
@@ -3269,6 +3488,7 @@ class clEnqueueSVMMemFillTracer {
     cl_params_clEnqueueSVMMemFill params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3276,6 +3496,10 @@ class clEnqueueSVMMemcpyTracer {
   public:
     clEnqueueSVMMemcpyTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_bool *blockingCopy,
                void **dstPtr,
@@ -3302,9 +3526,9 @@ class clEnqueueSVMMemcpyTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemcpy)) {
                 data.correlationData = correlationData + i;
@@ -3322,9 +3546,9 @@ class clEnqueueSVMMemcpyTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemcpy)) {
                 data.correlationData = correlationData + i;
@@ -3344,6 +3568,7 @@ class clEnqueueSVMMemcpyTracer {
     cl_params_clEnqueueSVMMemcpy params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3351,6 +3576,10 @@ class clEnqueueSVMMigrateMemTracer {
   public:
     clEnqueueSVMMigrateMemTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numSvmPointers,
                const void ***svmPointers,
@@ -3377,9 +3606,9 @@ class clEnqueueSVMMigrateMemTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMigrateMem)) {
                 data.correlationData = correlationData + i;
@@ -3397,9 +3626,9 @@ class clEnqueueSVMMigrateMemTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMigrateMem)) {
                 data.correlationData = correlationData + i;
@@ -3419,6 +3648,7 @@ class clEnqueueSVMMigrateMemTracer {
     cl_params_clEnqueueSVMMigrateMem params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3426,6 +3656,10 @@ class clEnqueueSVMUnmapTracer {
   public:
     clEnqueueSVMUnmapTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                void **svmPtr,
                cl_uint *numEventsInWaitList,
@@ -3446,9 +3680,9 @@ class clEnqueueSVMUnmapTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMUnmap)) {
                 data.correlationData = correlationData + i;
@@ -3466,9 +3700,9 @@ class clEnqueueSVMUnmapTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMUnmap)) {
                 data.correlationData = correlationData + i;
@@ -3488,6 +3722,7 @@ class clEnqueueSVMUnmapTracer {
     cl_params_clEnqueueSVMUnmap params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3495,6 +3730,10 @@ class clEnqueueTaskTracer {
   public:
     clEnqueueTaskTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_kernel *kernel,
                cl_uint *numEventsInWaitList,
@@ -3515,9 +3754,9 @@ class clEnqueueTaskTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueTask)) {
                 data.correlationData = correlationData + i;
@@ -3535,9 +3774,9 @@ class clEnqueueTaskTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueTask)) {
                 data.correlationData = correlationData + i;
@@ -3557,6 +3796,7 @@ class clEnqueueTaskTracer {
     cl_params_clEnqueueTask params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3564,6 +3804,10 @@ class clEnqueueUnmapMemObjectTracer {
   public:
     clEnqueueUnmapMemObjectTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *memobj,
                void **mappedPtr,
@@ -3586,9 +3830,9 @@ class clEnqueueUnmapMemObjectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueUnmapMemObject)) {
                 data.correlationData = correlationData + i;
@@ -3606,9 +3850,9 @@ class clEnqueueUnmapMemObjectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueUnmapMemObject)) {
                 data.correlationData = correlationData + i;
@@ -3628,6 +3872,7 @@ class clEnqueueUnmapMemObjectTracer {
     cl_params_clEnqueueUnmapMemObject params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3635,6 +3880,10 @@ class clEnqueueWaitForEventsTracer {
   public:
     clEnqueueWaitForEventsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numEvents,
                const cl_event **eventList) {
@@ -3651,9 +3900,9 @@ class clEnqueueWaitForEventsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -3671,9 +3920,9 @@ class clEnqueueWaitForEventsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -3693,6 +3942,7 @@ class clEnqueueWaitForEventsTracer {
     cl_params_clEnqueueWaitForEvents params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3700,6 +3950,10 @@ class clEnqueueWriteBufferTracer {
   public:
     clEnqueueWriteBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingWrite,
@@ -3728,9 +3982,9 @@ class clEnqueueWriteBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBuffer)) {
                 data.correlationData = correlationData + i;
@@ -3748,9 +4002,9 @@ class clEnqueueWriteBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBuffer)) {
                 data.correlationData = correlationData + i;
@@ -3770,6 +4024,7 @@ class clEnqueueWriteBufferTracer {
     cl_params_clEnqueueWriteBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3777,6 +4032,10 @@ class clEnqueueWriteBufferRectTracer {
   public:
     clEnqueueWriteBufferRectTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingWrite,
@@ -3815,9 +4074,9 @@ class clEnqueueWriteBufferRectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -3835,9 +4094,9 @@ class clEnqueueWriteBufferRectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -3857,6 +4116,7 @@ class clEnqueueWriteBufferRectTracer {
     cl_params_clEnqueueWriteBufferRect params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3864,6 +4124,10 @@ class clEnqueueWriteImageTracer {
   public:
     clEnqueueWriteImageTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                cl_bool *blockingWrite,
@@ -3896,9 +4160,9 @@ class clEnqueueWriteImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteImage)) {
                 data.correlationData = correlationData + i;
@@ -3916,9 +4180,9 @@ class clEnqueueWriteImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteImage)) {
                 data.correlationData = correlationData + i;
@@ -3938,6 +4202,7 @@ class clEnqueueWriteImageTracer {
     cl_params_clEnqueueWriteImage params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -3945,6 +4210,10 @@ class clFinishTracer {
   public:
     clFinishTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -3957,9 +4226,9 @@ class clFinishTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFinish)) {
                 data.correlationData = correlationData + i;
@@ -3977,9 +4246,9 @@ class clFinishTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFinish)) {
                 data.correlationData = correlationData + i;
@@ -3999,6 +4268,7 @@ class clFinishTracer {
     cl_params_clFinish params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4006,6 +4276,10 @@ class clFlushTracer {
   public:
     clFlushTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -4018,9 +4292,9 @@ class clFlushTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFlush)) {
                 data.correlationData = correlationData + i;
@@ -4038,9 +4312,9 @@ class clFlushTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFlush)) {
                 data.correlationData = correlationData + i;
@@ -4060,6 +4334,7 @@ class clFlushTracer {
     cl_params_clFlush params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4067,6 +4342,10 @@ class clGetCommandQueueInfoTracer {
   public:
     clGetCommandQueueInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_command_queue_info *paramName,
                size_t *paramValueSize,
@@ -4087,9 +4366,9 @@ class clGetCommandQueueInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetCommandQueueInfo)) {
                 data.correlationData = correlationData + i;
@@ -4107,9 +4386,9 @@ class clGetCommandQueueInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetCommandQueueInfo)) {
                 data.correlationData = correlationData + i;
@@ -4129,6 +4408,7 @@ class clGetCommandQueueInfoTracer {
     cl_params_clGetCommandQueueInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4136,6 +4416,10 @@ class clGetContextInfoTracer {
   public:
     clGetContextInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_context_info *paramName,
                size_t *paramValueSize,
@@ -4156,9 +4440,9 @@ class clGetContextInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetContextInfo)) {
                 data.correlationData = correlationData + i;
@@ -4176,9 +4460,9 @@ class clGetContextInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetContextInfo)) {
                 data.correlationData = correlationData + i;
@@ -4198,6 +4482,7 @@ class clGetContextInfoTracer {
     cl_params_clGetContextInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4205,6 +4490,10 @@ class clGetDeviceAndHostTimerTracer {
   public:
     clGetDeviceAndHostTimerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_device_id *device,
                cl_ulong **deviceTimestamp,
                cl_ulong **hostTimestamp) {
@@ -4221,9 +4510,9 @@ class clGetDeviceAndHostTimerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceAndHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4241,9 +4530,9 @@ class clGetDeviceAndHostTimerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceAndHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4263,6 +4552,7 @@ class clGetDeviceAndHostTimerTracer {
     cl_params_clGetDeviceAndHostTimer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4270,6 +4560,10 @@ class clGetDeviceIDsTracer {
   public:
     clGetDeviceIDsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_platform_id *platform,
                cl_device_type *deviceType,
                cl_uint *numEntries,
@@ -4290,9 +4584,9 @@ class clGetDeviceIDsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceIDs)) {
                 data.correlationData = correlationData + i;
@@ -4310,9 +4604,9 @@ class clGetDeviceIDsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceIDs)) {
                 data.correlationData = correlationData + i;
@@ -4332,6 +4626,7 @@ class clGetDeviceIDsTracer {
     cl_params_clGetDeviceIDs params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4339,6 +4634,10 @@ class clGetDeviceInfoTracer {
   public:
     clGetDeviceInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_device_id *device,
                cl_device_info *paramName,
                size_t *paramValueSize,
@@ -4359,9 +4658,9 @@ class clGetDeviceInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceInfo)) {
                 data.correlationData = correlationData + i;
@@ -4379,9 +4678,9 @@ class clGetDeviceInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceInfo)) {
                 data.correlationData = correlationData + i;
@@ -4401,6 +4700,7 @@ class clGetDeviceInfoTracer {
     cl_params_clGetDeviceInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4408,6 +4708,10 @@ class clGetEventInfoTracer {
   public:
     clGetEventInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_event *event,
                cl_event_info *paramName,
                size_t *paramValueSize,
@@ -4428,9 +4732,9 @@ class clGetEventInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventInfo)) {
                 data.correlationData = correlationData + i;
@@ -4448,9 +4752,9 @@ class clGetEventInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventInfo)) {
                 data.correlationData = correlationData + i;
@@ -4470,6 +4774,7 @@ class clGetEventInfoTracer {
     cl_params_clGetEventInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4477,6 +4782,10 @@ class clGetEventProfilingInfoTracer {
   public:
     clGetEventProfilingInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_event *event,
                cl_profiling_info *paramName,
                size_t *paramValueSize,
@@ -4497,9 +4806,9 @@ class clGetEventProfilingInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventProfilingInfo)) {
                 data.correlationData = correlationData + i;
@@ -4517,9 +4826,9 @@ class clGetEventProfilingInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventProfilingInfo)) {
                 data.correlationData = correlationData + i;
@@ -4539,6 +4848,7 @@ class clGetEventProfilingInfoTracer {
     cl_params_clGetEventProfilingInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4546,6 +4856,10 @@ class clGetExtensionFunctionAddressTracer {
   public:
     clGetExtensionFunctionAddressTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(const char **funcName) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -4558,9 +4872,9 @@ class clGetExtensionFunctionAddressTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddress)) {
                 data.correlationData = correlationData + i;
@@ -4578,9 +4892,9 @@ class clGetExtensionFunctionAddressTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddress)) {
                 data.correlationData = correlationData + i;
@@ -4600,6 +4914,7 @@ class clGetExtensionFunctionAddressTracer {
     cl_params_clGetExtensionFunctionAddress params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4607,6 +4922,10 @@ class clGetExtensionFunctionAddressForPlatformTracer {
   public:
     clGetExtensionFunctionAddressForPlatformTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_platform_id *platform,
                const char **funcName) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -4621,9 +4940,9 @@ class clGetExtensionFunctionAddressForPlatformTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddressForPlatform)) {
                 data.correlationData = correlationData + i;
@@ -4641,9 +4960,9 @@ class clGetExtensionFunctionAddressForPlatformTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddressForPlatform)) {
                 data.correlationData = correlationData + i;
@@ -4663,6 +4982,7 @@ class clGetExtensionFunctionAddressForPlatformTracer {
     cl_params_clGetExtensionFunctionAddressForPlatform params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4670,6 +4990,10 @@ class clGetHostTimerTracer {
   public:
     clGetHostTimerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_device_id *device,
                cl_ulong **hostTimestamp) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -4684,9 +5008,9 @@ class clGetHostTimerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4704,9 +5028,9 @@ class clGetHostTimerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4726,6 +5050,7 @@ class clGetHostTimerTracer {
     cl_params_clGetHostTimer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4733,6 +5058,10 @@ class clGetImageInfoTracer {
   public:
     clGetImageInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *image,
                cl_image_info *paramName,
                size_t *paramValueSize,
@@ -4753,9 +5082,9 @@ class clGetImageInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetImageInfo)) {
                 data.correlationData = correlationData + i;
@@ -4773,9 +5102,9 @@ class clGetImageInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetImageInfo)) {
                 data.correlationData = correlationData + i;
@@ -4795,6 +5124,7 @@ class clGetImageInfoTracer {
     cl_params_clGetImageInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4802,6 +5132,10 @@ class clGetKernelArgInfoTracer {
   public:
     clGetKernelArgInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel,
                cl_uint *argIndx,
                cl_kernel_arg_info *paramName,
@@ -4824,9 +5158,9 @@ class clGetKernelArgInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelArgInfo)) {
                 data.correlationData = correlationData + i;
@@ -4844,9 +5178,9 @@ class clGetKernelArgInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelArgInfo)) {
                 data.correlationData = correlationData + i;
@@ -4866,6 +5200,7 @@ class clGetKernelArgInfoTracer {
     cl_params_clGetKernelArgInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4873,6 +5208,10 @@ class clGetKernelInfoTracer {
   public:
     clGetKernelInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel,
                cl_kernel_info *paramName,
                size_t *paramValueSize,
@@ -4893,9 +5232,9 @@ class clGetKernelInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelInfo)) {
                 data.correlationData = correlationData + i;
@@ -4913,9 +5252,9 @@ class clGetKernelInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelInfo)) {
                 data.correlationData = correlationData + i;
@@ -4935,6 +5274,7 @@ class clGetKernelInfoTracer {
     cl_params_clGetKernelInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -4942,6 +5282,10 @@ class clGetKernelSubGroupInfoTracer {
   public:
     clGetKernelSubGroupInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel,
                cl_device_id *device,
                cl_kernel_sub_group_info *paramName,
@@ -4968,9 +5312,9 @@ class clGetKernelSubGroupInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelSubGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -4988,9 +5332,9 @@ class clGetKernelSubGroupInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelSubGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -5010,6 +5354,7 @@ class clGetKernelSubGroupInfoTracer {
     cl_params_clGetKernelSubGroupInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5017,6 +5362,10 @@ class clGetKernelWorkGroupInfoTracer {
   public:
     clGetKernelWorkGroupInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel,
                cl_device_id *device,
                cl_kernel_work_group_info *paramName,
@@ -5039,9 +5388,9 @@ class clGetKernelWorkGroupInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelWorkGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -5059,9 +5408,9 @@ class clGetKernelWorkGroupInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelWorkGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -5081,6 +5430,7 @@ class clGetKernelWorkGroupInfoTracer {
     cl_params_clGetKernelWorkGroupInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5088,6 +5438,10 @@ class clGetMemObjectInfoTracer {
   public:
     clGetMemObjectInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *memobj,
                cl_mem_info *paramName,
                size_t *paramValueSize,
@@ -5108,9 +5462,9 @@ class clGetMemObjectInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetMemObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -5128,9 +5482,9 @@ class clGetMemObjectInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetMemObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -5150,6 +5504,7 @@ class clGetMemObjectInfoTracer {
     cl_params_clGetMemObjectInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5157,6 +5512,10 @@ class clGetPipeInfoTracer {
   public:
     clGetPipeInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *pipe,
                cl_pipe_info *paramName,
                size_t *paramValueSize,
@@ -5177,9 +5536,9 @@ class clGetPipeInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPipeInfo)) {
                 data.correlationData = correlationData + i;
@@ -5197,9 +5556,9 @@ class clGetPipeInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPipeInfo)) {
                 data.correlationData = correlationData + i;
@@ -5219,6 +5578,7 @@ class clGetPipeInfoTracer {
     cl_params_clGetPipeInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5226,6 +5586,10 @@ class clGetPlatformIDsTracer {
   public:
     clGetPlatformIDsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_uint *numEntries,
                cl_platform_id **platforms,
                cl_uint **numPlatforms) {
@@ -5242,9 +5606,9 @@ class clGetPlatformIDsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformIDs)) {
                 data.correlationData = correlationData + i;
@@ -5262,9 +5626,9 @@ class clGetPlatformIDsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformIDs)) {
                 data.correlationData = correlationData + i;
@@ -5284,6 +5648,7 @@ class clGetPlatformIDsTracer {
     cl_params_clGetPlatformIDs params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5291,6 +5656,10 @@ class clGetPlatformInfoTracer {
   public:
     clGetPlatformInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_platform_id *platform,
                cl_platform_info *paramName,
                size_t *paramValueSize,
@@ -5311,9 +5680,9 @@ class clGetPlatformInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformInfo)) {
                 data.correlationData = correlationData + i;
@@ -5331,9 +5700,9 @@ class clGetPlatformInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformInfo)) {
                 data.correlationData = correlationData + i;
@@ -5353,6 +5722,7 @@ class clGetPlatformInfoTracer {
     cl_params_clGetPlatformInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5360,6 +5730,10 @@ class clGetProgramBuildInfoTracer {
   public:
     clGetProgramBuildInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program,
                cl_device_id *device,
                cl_program_build_info *paramName,
@@ -5382,9 +5756,9 @@ class clGetProgramBuildInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramBuildInfo)) {
                 data.correlationData = correlationData + i;
@@ -5402,9 +5776,9 @@ class clGetProgramBuildInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramBuildInfo)) {
                 data.correlationData = correlationData + i;
@@ -5424,6 +5798,7 @@ class clGetProgramBuildInfoTracer {
     cl_params_clGetProgramBuildInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5431,6 +5806,10 @@ class clGetProgramInfoTracer {
   public:
     clGetProgramInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program,
                cl_program_info *paramName,
                size_t *paramValueSize,
@@ -5451,9 +5830,9 @@ class clGetProgramInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramInfo)) {
                 data.correlationData = correlationData + i;
@@ -5471,9 +5850,9 @@ class clGetProgramInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramInfo)) {
                 data.correlationData = correlationData + i;
@@ -5493,6 +5872,7 @@ class clGetProgramInfoTracer {
     cl_params_clGetProgramInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5500,6 +5880,10 @@ class clGetSamplerInfoTracer {
   public:
     clGetSamplerInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_sampler *sampler,
                cl_sampler_info *paramName,
                size_t *paramValueSize,
@@ -5520,9 +5904,9 @@ class clGetSamplerInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSamplerInfo)) {
                 data.correlationData = correlationData + i;
@@ -5540,9 +5924,9 @@ class clGetSamplerInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSamplerInfo)) {
                 data.correlationData = correlationData + i;
@@ -5562,6 +5946,7 @@ class clGetSamplerInfoTracer {
     cl_params_clGetSamplerInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5569,6 +5954,10 @@ class clGetSupportedImageFormatsTracer {
   public:
     clGetSupportedImageFormatsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_mem_object_type *imageType,
@@ -5591,9 +5980,9 @@ class clGetSupportedImageFormatsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSupportedImageFormats)) {
                 data.correlationData = correlationData + i;
@@ -5611,9 +6000,9 @@ class clGetSupportedImageFormatsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSupportedImageFormats)) {
                 data.correlationData = correlationData + i;
@@ -5633,6 +6022,7 @@ class clGetSupportedImageFormatsTracer {
     cl_params_clGetSupportedImageFormats params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5640,6 +6030,10 @@ class clLinkProgramTracer {
   public:
     clLinkProgramTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -5668,9 +6062,9 @@ class clLinkProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clLinkProgram)) {
                 data.correlationData = correlationData + i;
@@ -5688,9 +6082,9 @@ class clLinkProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clLinkProgram)) {
                 data.correlationData = correlationData + i;
@@ -5710,6 +6104,7 @@ class clLinkProgramTracer {
     cl_params_clLinkProgram params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5717,6 +6112,10 @@ class clReleaseCommandQueueTracer {
   public:
     clReleaseCommandQueueTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5729,9 +6128,9 @@ class clReleaseCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -5749,9 +6148,9 @@ class clReleaseCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -5771,6 +6170,7 @@ class clReleaseCommandQueueTracer {
     cl_params_clReleaseCommandQueue params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5778,6 +6178,10 @@ class clReleaseContextTracer {
   public:
     clReleaseContextTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5790,9 +6194,9 @@ class clReleaseContextTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseContext)) {
                 data.correlationData = correlationData + i;
@@ -5810,9 +6214,9 @@ class clReleaseContextTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseContext)) {
                 data.correlationData = correlationData + i;
@@ -5832,6 +6236,7 @@ class clReleaseContextTracer {
     cl_params_clReleaseContext params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5839,6 +6244,10 @@ class clReleaseDeviceTracer {
   public:
     clReleaseDeviceTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_device_id *device) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5851,9 +6260,9 @@ class clReleaseDeviceTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseDevice)) {
                 data.correlationData = correlationData + i;
@@ -5871,9 +6280,9 @@ class clReleaseDeviceTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseDevice)) {
                 data.correlationData = correlationData + i;
@@ -5893,6 +6302,7 @@ class clReleaseDeviceTracer {
     cl_params_clReleaseDevice params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5900,6 +6310,10 @@ class clReleaseEventTracer {
   public:
     clReleaseEventTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_event *event) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5912,9 +6326,9 @@ class clReleaseEventTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseEvent)) {
                 data.correlationData = correlationData + i;
@@ -5932,9 +6346,9 @@ class clReleaseEventTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseEvent)) {
                 data.correlationData = correlationData + i;
@@ -5954,6 +6368,7 @@ class clReleaseEventTracer {
     cl_params_clReleaseEvent params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -5961,6 +6376,10 @@ class clReleaseKernelTracer {
   public:
     clReleaseKernelTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5973,9 +6392,9 @@ class clReleaseKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseKernel)) {
                 data.correlationData = correlationData + i;
@@ -5993,9 +6412,9 @@ class clReleaseKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseKernel)) {
                 data.correlationData = correlationData + i;
@@ -6015,6 +6434,7 @@ class clReleaseKernelTracer {
     cl_params_clReleaseKernel params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6022,6 +6442,10 @@ class clReleaseMemObjectTracer {
   public:
     clReleaseMemObjectTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *memobj) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6034,9 +6458,9 @@ class clReleaseMemObjectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6054,9 +6478,9 @@ class clReleaseMemObjectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6076,6 +6500,7 @@ class clReleaseMemObjectTracer {
     cl_params_clReleaseMemObject params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6083,6 +6508,10 @@ class clReleaseProgramTracer {
   public:
     clReleaseProgramTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6095,9 +6524,9 @@ class clReleaseProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseProgram)) {
                 data.correlationData = correlationData + i;
@@ -6115,9 +6544,9 @@ class clReleaseProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseProgram)) {
                 data.correlationData = correlationData + i;
@@ -6137,6 +6566,7 @@ class clReleaseProgramTracer {
     cl_params_clReleaseProgram params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6144,6 +6574,10 @@ class clReleaseSamplerTracer {
   public:
     clReleaseSamplerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_sampler *sampler) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6156,9 +6590,9 @@ class clReleaseSamplerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseSampler)) {
                 data.correlationData = correlationData + i;
@@ -6176,9 +6610,9 @@ class clReleaseSamplerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseSampler)) {
                 data.correlationData = correlationData + i;
@@ -6198,6 +6632,7 @@ class clReleaseSamplerTracer {
     cl_params_clReleaseSampler params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6205,6 +6640,10 @@ class clRetainCommandQueueTracer {
   public:
     clRetainCommandQueueTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6217,9 +6656,9 @@ class clRetainCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6237,9 +6676,9 @@ class clRetainCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6259,6 +6698,7 @@ class clRetainCommandQueueTracer {
     cl_params_clRetainCommandQueue params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6266,6 +6706,10 @@ class clRetainContextTracer {
   public:
     clRetainContextTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6278,9 +6722,9 @@ class clRetainContextTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainContext)) {
                 data.correlationData = correlationData + i;
@@ -6298,9 +6742,9 @@ class clRetainContextTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainContext)) {
                 data.correlationData = correlationData + i;
@@ -6320,6 +6764,7 @@ class clRetainContextTracer {
     cl_params_clRetainContext params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6327,6 +6772,10 @@ class clRetainDeviceTracer {
   public:
     clRetainDeviceTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_device_id *device) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6339,9 +6788,9 @@ class clRetainDeviceTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainDevice)) {
                 data.correlationData = correlationData + i;
@@ -6359,9 +6808,9 @@ class clRetainDeviceTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainDevice)) {
                 data.correlationData = correlationData + i;
@@ -6381,6 +6830,7 @@ class clRetainDeviceTracer {
     cl_params_clRetainDevice params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6388,6 +6838,10 @@ class clRetainEventTracer {
   public:
     clRetainEventTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_event *event) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6400,9 +6854,9 @@ class clRetainEventTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainEvent)) {
                 data.correlationData = correlationData + i;
@@ -6420,9 +6874,9 @@ class clRetainEventTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainEvent)) {
                 data.correlationData = correlationData + i;
@@ -6442,6 +6896,7 @@ class clRetainEventTracer {
     cl_params_clRetainEvent params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6449,6 +6904,10 @@ class clRetainKernelTracer {
   public:
     clRetainKernelTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6461,9 +6920,9 @@ class clRetainKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainKernel)) {
                 data.correlationData = correlationData + i;
@@ -6481,9 +6940,9 @@ class clRetainKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainKernel)) {
                 data.correlationData = correlationData + i;
@@ -6503,6 +6962,7 @@ class clRetainKernelTracer {
     cl_params_clRetainKernel params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6510,6 +6970,10 @@ class clRetainMemObjectTracer {
   public:
     clRetainMemObjectTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *memobj) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6522,9 +6986,9 @@ class clRetainMemObjectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6542,9 +7006,9 @@ class clRetainMemObjectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6564,6 +7028,7 @@ class clRetainMemObjectTracer {
     cl_params_clRetainMemObject params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6571,6 +7036,10 @@ class clRetainProgramTracer {
   public:
     clRetainProgramTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_program *program) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6583,9 +7052,9 @@ class clRetainProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainProgram)) {
                 data.correlationData = correlationData + i;
@@ -6603,9 +7072,9 @@ class clRetainProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainProgram)) {
                 data.correlationData = correlationData + i;
@@ -6625,6 +7094,7 @@ class clRetainProgramTracer {
     cl_params_clRetainProgram params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6632,6 +7102,10 @@ class clRetainSamplerTracer {
   public:
     clRetainSamplerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_sampler *sampler) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6644,9 +7118,9 @@ class clRetainSamplerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainSampler)) {
                 data.correlationData = correlationData + i;
@@ -6664,9 +7138,9 @@ class clRetainSamplerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainSampler)) {
                 data.correlationData = correlationData + i;
@@ -6686,6 +7160,7 @@ class clRetainSamplerTracer {
     cl_params_clRetainSampler params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6693,6 +7168,10 @@ class clSVMAllocTracer {
   public:
     clSVMAllocTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_svm_mem_flags *flags,
                size_t *size,
@@ -6711,9 +7190,9 @@ class clSVMAllocTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMAlloc)) {
                 data.correlationData = correlationData + i;
@@ -6731,9 +7210,9 @@ class clSVMAllocTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMAlloc)) {
                 data.correlationData = correlationData + i;
@@ -6753,6 +7232,7 @@ class clSVMAllocTracer {
     cl_params_clSVMAlloc params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6760,6 +7240,10 @@ class clSVMFreeTracer {
   public:
     clSVMFreeTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                void **svmPointer) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -6774,9 +7258,9 @@ class clSVMFreeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -6794,9 +7278,9 @@ class clSVMFreeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -6816,6 +7300,7 @@ class clSVMFreeTracer {
     cl_params_clSVMFree params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6823,6 +7308,10 @@ class clSetCommandQueuePropertyTracer {
   public:
     clSetCommandQueuePropertyTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_command_queue_properties *properties,
                cl_bool *enable,
@@ -6841,9 +7330,9 @@ class clSetCommandQueuePropertyTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetCommandQueueProperty)) {
                 data.correlationData = correlationData + i;
@@ -6861,9 +7350,9 @@ class clSetCommandQueuePropertyTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetCommandQueueProperty)) {
                 data.correlationData = correlationData + i;
@@ -6883,6 +7372,7 @@ class clSetCommandQueuePropertyTracer {
     cl_params_clSetCommandQueueProperty params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6890,6 +7380,10 @@ class clSetDefaultDeviceCommandQueueTracer {
   public:
     clSetDefaultDeviceCommandQueueTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_device_id *device,
                cl_command_queue *commandQueue) {
@@ -6906,9 +7400,9 @@ class clSetDefaultDeviceCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetDefaultDeviceCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6926,9 +7420,9 @@ class clSetDefaultDeviceCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetDefaultDeviceCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6948,6 +7442,7 @@ class clSetDefaultDeviceCommandQueueTracer {
     cl_params_clSetDefaultDeviceCommandQueue params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -6955,6 +7450,10 @@ class clSetEventCallbackTracer {
   public:
     clSetEventCallbackTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_event *event,
                cl_int *commandExecCallbackType,
                void(CL_CALLBACK **funcNotify)(cl_event, cl_int, void *),
@@ -6973,9 +7472,9 @@ class clSetEventCallbackTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetEventCallback)) {
                 data.correlationData = correlationData + i;
@@ -6993,9 +7492,9 @@ class clSetEventCallbackTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetEventCallback)) {
                 data.correlationData = correlationData + i;
@@ -7015,6 +7514,7 @@ class clSetEventCallbackTracer {
     cl_params_clSetEventCallback params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7022,6 +7522,10 @@ class clSetKernelArgTracer {
   public:
     clSetKernelArgTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel,
                cl_uint *argIndex,
                size_t *argSize,
@@ -7040,9 +7544,9 @@ class clSetKernelArgTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArg)) {
                 data.correlationData = correlationData + i;
@@ -7060,9 +7564,9 @@ class clSetKernelArgTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArg)) {
                 data.correlationData = correlationData + i;
@@ -7082,6 +7586,7 @@ class clSetKernelArgTracer {
     cl_params_clSetKernelArg params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7089,6 +7594,10 @@ class clSetKernelArgSVMPointerTracer {
   public:
     clSetKernelArgSVMPointerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel,
                cl_uint *argIndex,
                const void **argValue) {
@@ -7105,9 +7614,9 @@ class clSetKernelArgSVMPointerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArgSVMPointer)) {
                 data.correlationData = correlationData + i;
@@ -7125,9 +7634,9 @@ class clSetKernelArgSVMPointerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArgSVMPointer)) {
                 data.correlationData = correlationData + i;
@@ -7147,6 +7656,7 @@ class clSetKernelArgSVMPointerTracer {
     cl_params_clSetKernelArgSVMPointer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7154,6 +7664,10 @@ class clSetKernelExecInfoTracer {
   public:
     clSetKernelExecInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_kernel *kernel,
                cl_kernel_exec_info *paramName,
                size_t *paramValueSize,
@@ -7172,9 +7686,9 @@ class clSetKernelExecInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelExecInfo)) {
                 data.correlationData = correlationData + i;
@@ -7192,9 +7706,9 @@ class clSetKernelExecInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelExecInfo)) {
                 data.correlationData = correlationData + i;
@@ -7214,6 +7728,7 @@ class clSetKernelExecInfoTracer {
     cl_params_clSetKernelExecInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7221,6 +7736,10 @@ class clSetMemObjectDestructorCallbackTracer {
   public:
     clSetMemObjectDestructorCallbackTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *memobj,
                void(CL_CALLBACK **funcNotify)(cl_mem, void *),
                void **userData) {
@@ -7237,9 +7756,9 @@ class clSetMemObjectDestructorCallbackTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetMemObjectDestructorCallback)) {
                 data.correlationData = correlationData + i;
@@ -7257,9 +7776,9 @@ class clSetMemObjectDestructorCallbackTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetMemObjectDestructorCallback)) {
                 data.correlationData = correlationData + i;
@@ -7279,6 +7798,7 @@ class clSetMemObjectDestructorCallbackTracer {
     cl_params_clSetMemObjectDestructorCallback params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7286,6 +7806,10 @@ class clSetUserEventStatusTracer {
   public:
     clSetUserEventStatusTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_event *event,
                cl_int *executionStatus) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -7300,9 +7824,9 @@ class clSetUserEventStatusTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetUserEventStatus)) {
                 data.correlationData = correlationData + i;
@@ -7320,9 +7844,9 @@ class clSetUserEventStatusTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetUserEventStatus)) {
                 data.correlationData = correlationData + i;
@@ -7342,6 +7866,7 @@ class clSetUserEventStatusTracer {
     cl_params_clSetUserEventStatus params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7349,6 +7874,10 @@ class clUnloadCompilerTracer {
   public:
     clUnloadCompilerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter() {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -7359,9 +7888,9 @@ class clUnloadCompilerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7379,9 +7908,9 @@ class clUnloadCompilerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7400,6 +7929,7 @@ class clUnloadCompilerTracer {
   private:
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7407,6 +7937,10 @@ class clUnloadPlatformCompilerTracer {
   public:
     clUnloadPlatformCompilerTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_platform_id *platform) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -7419,9 +7953,9 @@ class clUnloadPlatformCompilerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadPlatformCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7439,9 +7973,9 @@ class clUnloadPlatformCompilerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadPlatformCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7461,6 +7995,7 @@ class clUnloadPlatformCompilerTracer {
     cl_params_clUnloadPlatformCompiler params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7468,6 +8003,10 @@ class clWaitForEventsTracer {
   public:
     clWaitForEventsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_uint *numEvents,
                const cl_event **eventList) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -7482,9 +8021,9 @@ class clWaitForEventsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -7502,9 +8041,9 @@ class clWaitForEventsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -7524,6 +8063,7 @@ class clWaitForEventsTracer {
     cl_params_clWaitForEvents params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7533,6 +8073,10 @@ class clCreateFromGLBufferTracer {
   public:
     clCreateFromGLBufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLuint *bufobj,
@@ -7551,9 +8095,9 @@ class clCreateFromGLBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLBuffer)) {
                 data.correlationData = correlationData + i;
@@ -7571,9 +8115,9 @@ class clCreateFromGLBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLBuffer)) {
                 data.correlationData = correlationData + i;
@@ -7593,6 +8137,7 @@ class clCreateFromGLBufferTracer {
     cl_params_clCreateFromGLBuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7600,6 +8145,10 @@ class clCreateFromGLRenderbufferTracer {
   public:
     clCreateFromGLRenderbufferTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLuint *renderbuffer,
@@ -7618,9 +8167,9 @@ class clCreateFromGLRenderbufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLRenderbuffer)) {
                 data.correlationData = correlationData + i;
@@ -7638,9 +8187,9 @@ class clCreateFromGLRenderbufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLRenderbuffer)) {
                 data.correlationData = correlationData + i;
@@ -7660,6 +8209,7 @@ class clCreateFromGLRenderbufferTracer {
     cl_params_clCreateFromGLRenderbuffer params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7667,6 +8217,10 @@ class clCreateFromGLTextureTracer {
   public:
     clCreateFromGLTextureTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLenum *target,
@@ -7689,9 +8243,9 @@ class clCreateFromGLTextureTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture)) {
                 data.correlationData = correlationData + i;
@@ -7709,9 +8263,9 @@ class clCreateFromGLTextureTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture)) {
                 data.correlationData = correlationData + i;
@@ -7731,6 +8285,7 @@ class clCreateFromGLTextureTracer {
     cl_params_clCreateFromGLTexture params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7738,6 +8293,10 @@ class clCreateFromGLTexture2DTracer {
   public:
     clCreateFromGLTexture2DTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLenum *target,
@@ -7760,9 +8319,9 @@ class clCreateFromGLTexture2DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture2D)) {
                 data.correlationData = correlationData + i;
@@ -7780,9 +8339,9 @@ class clCreateFromGLTexture2DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture2D)) {
                 data.correlationData = correlationData + i;
@@ -7802,6 +8361,7 @@ class clCreateFromGLTexture2DTracer {
     cl_params_clCreateFromGLTexture2D params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7809,6 +8369,10 @@ class clCreateFromGLTexture3DTracer {
   public:
     clCreateFromGLTexture3DTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLenum *target,
@@ -7831,9 +8395,9 @@ class clCreateFromGLTexture3DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture3D)) {
                 data.correlationData = correlationData + i;
@@ -7851,9 +8415,9 @@ class clCreateFromGLTexture3DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture3D)) {
                 data.correlationData = correlationData + i;
@@ -7873,6 +8437,7 @@ class clCreateFromGLTexture3DTracer {
     cl_params_clCreateFromGLTexture3D params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7880,6 +8445,10 @@ class clEnqueueAcquireGLObjectsTracer {
   public:
     clEnqueueAcquireGLObjectsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numObjects,
                const cl_mem **memObjects,
@@ -7902,9 +8471,9 @@ class clEnqueueAcquireGLObjectsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueAcquireGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -7922,9 +8491,9 @@ class clEnqueueAcquireGLObjectsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueAcquireGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -7944,6 +8513,7 @@ class clEnqueueAcquireGLObjectsTracer {
     cl_params_clEnqueueAcquireGLObjects params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -7951,6 +8521,10 @@ class clEnqueueReleaseGLObjectsTracer {
   public:
     clEnqueueReleaseGLObjectsTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numObjects,
                const cl_mem **memObjects,
@@ -7973,9 +8547,9 @@ class clEnqueueReleaseGLObjectsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReleaseGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -7993,9 +8567,9 @@ class clEnqueueReleaseGLObjectsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReleaseGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -8015,6 +8589,7 @@ class clEnqueueReleaseGLObjectsTracer {
     cl_params_clEnqueueReleaseGLObjects params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -8022,6 +8597,10 @@ class clGetGLObjectInfoTracer {
   public:
     clGetGLObjectInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *memobj,
                cl_gl_object_type **glObjectType,
                cl_GLuint **glObjectName) {
@@ -8038,9 +8617,9 @@ class clGetGLObjectInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -8058,9 +8637,9 @@ class clGetGLObjectInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -8080,6 +8659,7 @@ class clGetGLObjectInfoTracer {
     cl_params_clGetGLObjectInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -8087,6 +8667,10 @@ class clGetGLTextureInfoTracer {
   public:
     clGetGLTextureInfoTracer() {}
 
+    void setHandleList(const TracingHandleList *list) {
+        handleList = list;
+    }
+
     void enter(cl_mem *memobj,
                cl_gl_texture_info *paramName,
                size_t *paramValueSize,
@@ -8107,9 +8691,9 @@ class clGetGLTextureInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLTextureInfo)) {
                 data.correlationData = correlationData + i;
@@ -8127,9 +8711,9 @@ class clGetGLTextureInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handleList->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && handleList->handles[i] != nullptr) {
+            TracingHandle *handle = handleList->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLTextureInfo)) {
                 data.correlationData = correlationData + i;
@@ -8149,6 +8733,7 @@ class clGetGLTextureInfoTracer {
     cl_params_clGetGLTextureInfo params{};
     cl_callback_data data{};
     uint64_t correlationData[TRACING_MAX_HANDLE_COUNT];
+    const TracingHandleList *handleList = nullptr;
     tracing_notify_state_t state = TRACING_NOTIFY_STATE_NOTHING_CALLED;
 };
 
@@ -0,0 +1,423 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "CL/cl.h"
+#include "CL/cl_ext.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#ifndef CL_QUEUE_FAMILY_INTEL
+#define CL_DEVICE_QUEUE_FAMILY_PROPERTIES_INTEL 0x418B
+#define CL_QUEUE_FAMILY_INTEL 0x418C
+#define CL_QUEUE_INDEX_INTEL 0x418D
+#define CL_QUEUE_CAPABILITY_TRANSFER_BUFFER_INTEL (1 << 8)
+#define CL_QUEUE_CAPABILITY_KERNEL_INTEL (1 << 26)
+#define CL_QUEUE_FAMILY_MAX_NAME_SIZE_INTEL 64
+typedef cl_bitfield cl_command_queue_capabilities_intel;
+typedef struct _cl_queue_family_properties_intel {
+    cl_command_queue_properties properties;
+    cl_command_queue_capabilities_intel capabilities;
+    cl_uint count;
+    char name[CL_QUEUE_FAMILY_MAX_NAME_SIZE_INTEL];
+} cl_queue_family_properties_intel;
+#endif
+
+typedef void *(CL_API_CALL *HostMemAllocFunc)(cl_context, const cl_bitfield *, size_t, cl_uint, cl_int *);
+typedef void *(CL_API_CALL *DeviceMemAllocFunc)(cl_context, cl_device_id, const cl_bitfield *, size_t, cl_uint, cl_int *);
+typedef cl_int(CL_API_CALL *MemFreeFunc)(cl_context, void *);
+
+#define CHECK(CALL)                                                                \
+    {                                                                              \
+        cl_int checkedRetVal = CALL;                                               \
+        if (checkedRetVal != CL_SUCCESS) {                                         \
+            cout << "Error " << checkedRetVal << " returned by " << #CALL << endl; \
+            abort();                                                               \
+        }                                                                          \
+    }
+
+const char *emptyKernelSrc = R"==(
+__kernel void empty() {
+}
+)==";
+
+using Clock = chrono::steady_clock;
+
+struct BenchmarkSettings {
+    cl_uint warmupIterations = 10;
+    cl_uint iterations = 100;
+    cl_uint threads = 4;
+    size_t maxCopySize = 256 * 1024 * 1024;
+};
+
+// Every benchmark takes warmup samples first, so lazy allocations and first submission costs
+// are excluded, then reports distribution of measured samples as single JSON object.
+struct Samples {
+    void add(Clock::duration duration) {
+        values.push_back(static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(duration).count()));
+    }
+
+    string toJson(const string &name, const string &params) const {
+        auto sorted = values;
+        sort(sorted.begin(), sorted.end());
+        auto mean = accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+
+        stringstream json;
+        json << "{\"name\": \"" << name << "\", " << params << (params.empty() ? "" : ", ")
+             << "\"samples\": " << sorted.size()
+             << ", \"minNs\": " << sorted.front()
+             << ", \"medianNs\": " << sorted[sorted.size() / 2]
+             << ", \"meanNs\": " << mean
+             << ", \"maxNs\": " << sorted.back() << "}";
+        return json.str();
+    }
+
+    double median() const {
+        auto sorted = values;
+        sort(sorted.begin(), sorted.end());
+        return sorted[sorted.size() / 2];
+    }
+
+    vector<double> values;
+};
+
+template <typename OperationT>
+Samples measure(const BenchmarkSettings &settings, OperationT &&operation) {
+    for (cl_uint i = 0; i < settings.warmupIterations; i++) {
+        operation();
+    }
+    Samples samples;
+    for (cl_uint i = 0; i < settings.iterations; i++) {
+        auto start = Clock::now();
+        operation();
+        samples.add(Clock::now() - start);
+    }
+    return samples;
+}
+
+const char *getParamValue(int argc, char **argv, const char *shortName, const char *longName) {
+    for (int i = 1; i < argc - 1; i++) {
+        if ((0 == strcmp(argv[i], shortName)) || (0 == strcmp(argv[i], longName))) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+cl_uint getParamValue(int argc, char **argv, const char *shortName, const char *longName, cl_uint defaultValue) {
+    auto value = getParamValue(argc, argv, shortName, longName);
+    return value ? static_cast<cl_uint>(stoul(value)) : defaultValue;
+}
+
+struct Benchmark {
+    cl_platform_id platform = nullptr;
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    cl_program program = nullptr;
+    cl_kernel kernel = nullptr;
+    BenchmarkSettings settings;
+    vector<string> results;
+
+    void addResult(const string &json) {
+        results.push_back(json);
+    }
+
+    cl_command_queue createQueue(cl_queue_properties properties, const cl_queue_properties *familyProperties = nullptr) {
+        cl_queue_properties queueProperties[7] = {CL_QUEUE_PROPERTIES, properties, 0, 0, 0, 0, 0};
+        if (familyProperties) {
+            queueProperties[2] = CL_QUEUE_FAMILY_INTEL;
+            queueProperties[3] = familyProperties[0];
+            queueProperties[4] = CL_QUEUE_INDEX_INTEL;
+            queueProperties[5] = familyProperties[1];
+        }
+        cl_int retVal = CL_SUCCESS;
+        auto queue = clCreateCommandQueueWithProperties(context, device, queueProperties, &retVal);
+        CHECK(retVal);
+        return queue;
+    }
+
+    cl_program buildProgram(const string &options) {
+        cl_int retVal = CL_SUCCESS;
+        auto newProgram = clCreateProgramWithSource(context, 1, &emptyKernelSrc, nullptr, &retVal);
+        CHECK(retVal);
+        CHECK(clBuildProgram(newProgram, 1, &device, options.c_str(), nullptr, nullptr));
+        return newProgram;
+    }
+
+    void enqueueEmptyKernel(cl_command_queue queue, cl_uint numEventsInWaitList = 0, const cl_event *eventWaitList = nullptr, cl_event *event = nullptr) {
+        size_t gws = 1;
+        size_t lws = 1;
+        CHECK(clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &gws, &lws, numEventsInWaitList, eventWaitList, event));
+    }
+
+    void benchmarkKernelLaunchLatency() {
+        for (auto outOfOrder : {false, true}) {
+            auto queue = createQueue(outOfOrder ? CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE : 0);
+            auto samples = measure(settings, [&]() {
+                enqueueEmptyKernel(queue);
+                CHECK(clFinish(queue));
+            });
+            addResult(samples.toJson("emptyKernelLaunchLatency", outOfOrder ? "\"queue\": \"outOfOrder\"" : "\"queue\": \"inOrder\""));
+            CHECK(clReleaseCommandQueue(queue));
+        }
+    }
+
+    void benchmarkSubmissionThroughput() {
+        for (cl_uint threadsCount = 1; threadsCount <= settings.threads; threadsCount *= 2) {
+            // clEnqueueNDRangeKernel is thread safe and kernel arguments are not modified
+            vector<cl_command_queue> queues(threadsCount);
+            for (auto &queue : queues) {
+                queue = createQueue(0);
+            }
+
+            auto submit = [&](cl_uint threadId, cl_uint submissions) {
+                for (cl_uint i = 0; i < submissions; i++) {
+                    enqueueEmptyKernel(queues[threadId]);
+                    CHECK(clFlush(queues[threadId]));
+                }
+                CHECK(clFinish(queues[threadId]));
+            };
+
+            for (cl_uint i = 0; i < threadsCount; i++) {
+                submit(i, settings.warmupIterations);
+            }
+
+            atomic<bool> start{false};
+            vector<thread> threads;
+            for (cl_uint i = 0; i < threadsCount; i++) {
+                threads.emplace_back([&, i]() {
+                    while (!start.load()) {
+                        this_thread::yield();
+                    }
+                    submit(i, settings.iterations);
+                });
+            }
+            auto startTime = Clock::now();
+            start = true;
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            auto elapsedNs = chrono::duration_cast<chrono::nanoseconds>(Clock::now() - startTime).count();
+
+            auto submissions = static_cast<uint64_t>(threadsCount) * settings.iterations;
+            stringstream json;
+            json << "{\"name\": \"submissionThroughput\", \"threads\": " << threadsCount
+                 << ", \"submissions\": " << submissions
+                 << ", \"totalNs\": " << elapsedNs
+                 << ", \"submissionsPerSecond\": " << (submissions * 1e9 / elapsedNs) << "}";
+            addResult(json.str());
+
+            for (auto &queue : queues) {
+                CHECK(clReleaseCommandQueue(queue));
+            }
+        }
+    }
+
+    void benchmarkEventLatency() {
+        auto queue = createQueue(0);
+
+        // kernel is already blocked on user event when measurement starts,
+        // so sample covers host signal, kernel submission and completion, and host wake up
+        auto roundTrip = [&]() {
+            cl_int retVal = CL_SUCCESS;
+            auto userEvent = clCreateUserEvent(context, &retVal);
+            CHECK(retVal);
+            cl_event kernelEvent = nullptr;
+            enqueueEmptyKernel(queue, 1, &userEvent, &kernelEvent);
+            CHECK(clFlush(queue));
+            this_thread::sleep_for(chrono::microseconds(100));
+
+            auto start = Clock::now();
+            CHECK(clSetUserEventStatus(userEvent, CL_COMPLETE));
+            CHECK(clWaitForEvents(1, &kernelEvent));
+            auto duration = Clock::now() - start;
+
+            CHECK(clReleaseEvent(kernelEvent));
+            CHECK(clReleaseEvent(userEvent));
+            return duration;
+        };
+
+        for (cl_uint i = 0; i < settings.warmupIterations; i++) {
+            roundTrip();
+        }
+        Samples samples;
+        for (cl_uint i = 0; i < settings.iterations; i++) {
+            samples.add(roundTrip());
+        }
+        addResult(samples.toJson("eventSignalToHostWakeLatency", ""));
+
+        CHECK(clReleaseCommandQueue(queue));
+    }
+
+    void benchmarkCopyBandwidth() {
+        size_t familiesSize = 0;
+        vector<cl_queue_family_properties_intel> families;
+        if (CL_SUCCESS == clGetDeviceInfo(device, CL_DEVICE_QUEUE_FAMILY_PROPERTIES_INTEL, 0, nullptr, &familiesSize)) {
+            families.resize(familiesSize / sizeof(cl_queue_family_properties_intel));
+            CHECK(clGetDeviceInfo(device, CL_DEVICE_QUEUE_FAMILY_PROPERTIES_INTEL, familiesSize, families.data(), nullptr));
+        }
+
+        cl_int retVal = CL_SUCCESS;
+        auto buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, settings.maxCopySize, nullptr, &retVal);
+        CHECK(retVal);
+        vector<char> hostMemory(settings.maxCopySize, 1);
+
+        // without queue families extension only default queue is measured
+        auto familiesCount = max<size_t>(families.size(), 1);
+        for (size_t family = 0; family < familiesCount; family++) {
+            string engine = "default";
+            cl_command_queue queue = nullptr;
+            if (families.empty()) {
+                queue = createQueue(0);
+            } else {
+                if (!(families[family].capabilities & CL_QUEUE_CAPABILITY_TRANSFER_BUFFER_INTEL)) {
+                    continue;
+                }
+                engine = families[family].name;
+                cl_queue_properties familyProperties[] = {static_cast<cl_queue_properties>(family), 0};
+                queue = createQueue(0, familyProperties);
+            }
+
+            for (size_t size = 4096; size <= settings.maxCopySize; size *= 4) {
+                for (auto hostToDevice : {true, false}) {
+                    auto samples = measure(settings, [&]() {
+                        if (hostToDevice) {
+                            CHECK(clEnqueueWriteBuffer(queue, buffer, CL_TRUE, 0, size, hostMemory.data(), 0, nullptr, nullptr));
+                        } else {
+                            CHECK(clEnqueueReadBuffer(queue, buffer, CL_TRUE, 0, size, hostMemory.data(), 0, nullptr, nullptr));
+                        }
+                    });
+
+                    stringstream params;
+                    params << "\"engine\": \"" << engine << "\", \"family\": " << family
+                           << ", \"direction\": \"" << (hostToDevice ? "hostToDevice" : "deviceToHost") << "\""
+                           << ", \"size\": " << size
+                           << ", \"medianGBps\": " << (size / samples.median());
+                    addResult(samples.toJson("copyBandwidth", params.str()));
+                }
+            }
+            CHECK(clReleaseCommandQueue(queue));
+        }
+        CHECK(clReleaseMemObject(buffer));
+    }
+
+    void benchmarkUsmAllocFree() {
+        auto hostMemAlloc = reinterpret_cast<HostMemAllocFunc>(clGetExtensionFunctionAddressForPlatform(platform, "clHostMemAllocINTEL"));
+        auto deviceMemAlloc = reinterpret_cast<DeviceMemAllocFunc>(clGetExtensionFunctionAddressForPlatform(platform, "clDeviceMemAllocINTEL"));
+        auto sharedMemAlloc = reinterpret_cast<DeviceMemAllocFunc>(clGetExtensionFunctionAddressForPlatform(platform, "clSharedMemAllocINTEL"));
+        auto memFree = reinterpret_cast<MemFreeFunc>(clGetExtensionFunctionAddressForPlatform(platform, "clMemBlockingFreeINTEL"));
+        if (!hostMemAlloc || !deviceMemAlloc || !sharedMemAlloc || !memFree) {
+            cerr << "Unified shared memory is not supported, skipping USM benchmark" << endl;
+            return;
+        }
+
+        const char *types[] = {"host", "device", "shared"};
+        for (cl_uint type = 0; type < 3; type++) {
+            for (size_t size : {size_t(4096), size_t(2 * 1024 * 1024), size_t(64 * 1024 * 1024)}) {
+                auto samples = measure(settings, [&]() {
+                    cl_int retVal = CL_SUCCESS;
+                    void *ptr = nullptr;
+                    if (type == 0) {
+                        ptr = hostMemAlloc(context, nullptr, size, 4096, &retVal);
+                    } else if (type == 1) {
+                        ptr = deviceMemAlloc(context, device, nullptr, size, 4096, &retVal);
+                    } else {
+                        ptr = sharedMemAlloc(context, device, nullptr, size, 4096, &retVal);
+                    }
+                    CHECK(retVal);
+                    CHECK(memFree(context, ptr));
+                });
+
+                stringstream params;
+                params << "\"type\": \"" << types[type] << "\", \"size\": " << size;
+                addResult(samples.toJson("usmAllocFreeLatency", params.str()));
+            }
+        }
+    }
+
+    void benchmarkProgramBuild() {
+        // unique build option changes cache key, so every sample misses compiler cache
+        cl_uint salt = 0;
+        auto uncachedSamples = measure(settings, [&]() {
+            auto newProgram = buildProgram("-DBENCHMARK_SALT=" + to_string(salt++));
+            CHECK(clReleaseProgram(newProgram));
+        });
+        addResult(uncachedSamples.toJson("programBuildTime", "\"cache\": \"miss\""));
+
+        auto cachedSamples = measure(settings, [&]() {
+            auto newProgram = buildProgram("");
+            CHECK(clReleaseProgram(newProgram));
+        });
+        addResult(cachedSamples.toJson("programBuildTime", "\"cache\": \"hit\""));
+    }
+
+    void dump(ostream &out) const {
+        char deviceName[256] = {};
+        clGetDeviceInfo(device, CL_DEVICE_NAME, sizeof(deviceName) - 1, deviceName, nullptr);
+        out << "{\n  \"api\": \"opencl\",\n  \"device\": \"" << deviceName << "\","
+            << "\n  \"warmupIterations\": " << settings.warmupIterations << ","
+            << "\n  \"iterations\": " << settings.iterations << ","
+            << "\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            out << (i == 0 ? "\n    " : ",\n    ") << results[i];
+        }
+        out << "\n  ]\n}\n";
+    }
+};
+
+int main(int argc, char **argv) {
+    Benchmark benchmark;
+    auto &settings = benchmark.settings;
+    settings.warmupIterations = getParamValue(argc, argv, "-w", "--warmup", settings.warmupIterations);
+    settings.iterations = max(1u, getParamValue(argc, argv, "-i", "--iterations", settings.iterations));
+    settings.threads = max(1u, getParamValue(argc, argv, "-t", "--threads", settings.threads));
+    settings.maxCopySize = static_cast<size_t>(getParamValue(argc, argv, "-m", "--max_copy_size_mb", static_cast<cl_uint>(settings.maxCopySize >> 20))) << 20;
+    auto outputFile = getParamValue(argc, argv, "-o", "--output");
+
+    cl_uint platformsCount = 0;
+    CHECK(clGetPlatformIDs(1, &benchmark.platform, &platformsCount));
+    CHECK(clGetDeviceIDs(benchmark.platform, CL_DEVICE_TYPE_GPU, 1, &benchmark.device, nullptr));
+
+    cl_int retVal = CL_SUCCESS;
+    benchmark.context = clCreateContext(nullptr, 1, &benchmark.device, nullptr, nullptr, &retVal);
+    CHECK(retVal);
+    benchmark.program = benchmark.buildProgram("");
+    benchmark.kernel = clCreateKernel(benchmark.program, "empty", &retVal);
+    CHECK(retVal);
+
+    benchmark.benchmarkKernelLaunchLatency();
+    benchmark.benchmarkSubmissionThroughput();
+    benchmark.benchmarkEventLatency();
+    benchmark.benchmarkCopyBandwidth();
+    benchmark.benchmarkUsmAllocFree();
+    benchmark.benchmarkProgramBuild();
+
+    CHECK(clReleaseKernel(benchmark.kernel));
+    CHECK(clReleaseProgram(benchmark.program));
+    CHECK(clReleaseContext(benchmark.context));
+
+    if (outputFile) {
+        ofstream out(outputFile);
+        benchmark.dump(out);
+    } else {
+        benchmark.dump(cout);
+    }
+    return 0;
+}
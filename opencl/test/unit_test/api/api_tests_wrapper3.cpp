@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "opencl/test/unit_test/api/cl_set_default_device_command_queue_tests.inl"
 #include "opencl/test/unit_test/api/cl_set_event_callback_tests.inl"
 #include "opencl/test/unit_test/api/cl_set_kernel_arg_svm_pointer_tests.inl"
+#include "opencl/test/unit_test/api/cl_set_kernel_args_intel_tests.inl"
 #include "opencl/test/unit_test/api/cl_set_kernel_exec_info_tests.inl"
 #include "opencl/test/unit_test/api/cl_set_mem_object_destructor_callback_tests.inl"
 #include "opencl/test/unit_test/api/cl_set_performance_configuration_tests.inl"
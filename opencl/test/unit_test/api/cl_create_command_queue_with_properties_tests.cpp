@@ -569,6 +569,34 @@ HWTEST_F(LowPriorityCommandQueueTest, GivenDeviceWithSubdevicesWhenCreatingLowPr
     clReleaseCommandQueue(cmdQ);
 }
 
+using HighPriorityCommandQueueTest = ::testing::Test;
+HWTEST_F(HighPriorityCommandQueueTest, GivenHighPriorityEngineEnabledWhenCreatingHighPriorityCommandQueueThenHighPriorityEngineWithCoarserPreemptionIsTaken) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHighPriorityEngine.set(1);
+    DebugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+    MockContext context;
+    cl_queue_properties properties[] = {CL_QUEUE_PRIORITY_KHR, CL_QUEUE_PRIORITY_HIGH_KHR, 0};
+    auto cmdQ = clCreateCommandQueueWithProperties(&context, context.getDevice(0), properties, nullptr);
+    ASSERT_NE(nullptr, cmdQ);
+
+    auto commandQueueObj = castToObject<CommandQueue>(cmdQ);
+    auto &osContext = commandQueueObj->getGpgpuCommandStreamReceiver().getOsContext();
+    EXPECT_TRUE(osContext.isHighPriority());
+    EXPECT_EQ(PreemptionHelper::contextPreemptionMode(context.getDevice(0)->getPreemptionMode(), EngineUsage::HighPriority), osContext.getPreemptionMode());
+
+    for (auto &engineGroup : context.getDevice(0)->getDevice().getEngineGroups()) {
+        for (auto &engine : engineGroup) {
+            EXPECT_FALSE(engine.osContext->isHighPriority());
+        }
+    }
+
+    cl_bool priorityHonored = CL_FALSE;
+    auto retVal = clGetCommandQueueInfo(cmdQ, CL_QUEUE_PRIORITY_HONORED_INTEL, sizeof(priorityHonored), &priorityHonored, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(static_cast<cl_bool>(osContext.isPriorityHonored()), priorityHonored);
+    clReleaseCommandQueue(cmdQ);
+}
+
 std::pair<uint32_t, QueuePriority> priorityParams[3]{
     std::make_pair(CL_QUEUE_PRIORITY_LOW_KHR, QueuePriority::LOW),
     std::make_pair(CL_QUEUE_PRIORITY_MED_KHR, QueuePriority::MEDIUM),
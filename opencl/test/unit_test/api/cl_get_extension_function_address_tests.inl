@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -183,6 +183,11 @@ TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueNDCountKernelINTELWhenG
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueNDCountKernelINTEL));
 }
 
+TEST_F(clGetExtensionFunctionAddressTests, GivenClSetKernelArgsINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clSetKernelArgsINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetKernelArgsINTEL));
+}
+
 TEST_F(clGetExtensionFunctionAddressTests, GivenCSlSetProgramSpecializationConstantWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
     auto retVal = clGetExtensionFunctionAddress("clSetProgramSpecializationConstant");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetProgramSpecializationConstant));
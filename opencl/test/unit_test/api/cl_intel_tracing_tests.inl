@@ -88,6 +88,58 @@ TEST_F(IntelTracingTest, GivenInactiveHandleWhenCallingTracingFunctionThenInvali
     EXPECT_EQ(CL_SUCCESS, status);
 }
 
+TEST_F(IntelTracingTest, GivenTracingPointSetOnEnabledHandleWhenTracingThenOnlyThisFunctionIsMarkedAsTraced) {
+    status = clCreateTracingHandleINTEL(testedClDevice, callback, this, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetDeviceInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_FALSE(HostSideTracing::isTracingPointEnabled(CL_FUNCTION_clGetDeviceInfo));
+
+    status = clEnableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_TRUE(HostSideTracing::isTracingPointEnabled(CL_FUNCTION_clGetDeviceInfo));
+    EXPECT_FALSE(HostSideTracing::isTracingPointEnabled(CL_FUNCTION_clGetPlatformInfo));
+
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetPlatformInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_TRUE(HostSideTracing::isTracingPointEnabled(CL_FUNCTION_clGetPlatformInfo));
+
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetDeviceInfo, CL_FALSE);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_FALSE(HostSideTracing::isTracingPointEnabled(CL_FUNCTION_clGetDeviceInfo));
+
+    status = clDisableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_FALSE(HostSideTracing::isTracingPointEnabled(CL_FUNCTION_clGetPlatformInfo));
+    EXPECT_EQ(nullptr, HostSideTracing::addTracingClient());
+
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+}
+
+TEST_F(IntelTracingTest, GivenEnabledHandleWhenAddingNestedTracingClientsThenSameHandleListIsReturned) {
+    status = clCreateTracingHandleINTEL(testedClDevice, callback, this, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clEnableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    auto outerList = HostSideTracing::addTracingClient();
+    ASSERT_NE(nullptr, outerList);
+    EXPECT_EQ(handle->handle, outerList->handles[0]);
+    EXPECT_EQ(nullptr, outerList->handles[1]);
+
+    auto innerList = HostSideTracing::addTracingClient();
+    EXPECT_EQ(outerList, innerList);
+    HostSideTracing::removeTracingClient();
+    HostSideTracing::removeTracingClient();
+
+    status = clDisableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+}
+
 TEST_F(IntelTracingTest, GivenTooManyHandlesWhenEnablingTracingFunctionThenOutOfResourcesErrorIsReturned) {
     cl_tracing_handle handle[HostSideTracing::TRACING_MAX_HANDLE_COUNT + 1] = {nullptr};
 
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/test/unit_test/mocks/mock_buffer.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "test.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+class KernelArgsIntelFixture : public ApiFixture<> {
+  protected:
+    void SetUp() override {
+        ApiFixture::SetUp();
+
+        pKernelInfo = std::make_unique<MockKernelInfo>();
+        pKernelInfo->kernelDescriptor.kernelAttributes.simdSize = 1;
+
+        pKernelInfo->heapInfo.SurfaceStateHeapSize = sizeof(pSshLocal);
+        pKernelInfo->heapInfo.pSsh = pSshLocal;
+
+        pKernelInfo->addArgBuffer(0, 0x10, sizeof(void *));
+        pKernelInfo->addArgBuffer(1, 0x18, sizeof(void *));
+
+        pMockMultiDeviceKernel = MultiDeviceKernel::create<MockKernel>(pProgram, MockKernel::toKernelInfoContainer(*pKernelInfo, testedRootDeviceIndex), nullptr);
+        pMockKernel = static_cast<MockKernel *>(pMockMultiDeviceKernel->getKernel(testedRootDeviceIndex));
+        ASSERT_NE(nullptr, pMockKernel);
+        pMockKernel->setCrossThreadData(pCrossThreadData, sizeof(pCrossThreadData));
+    }
+
+    void TearDown() override {
+        delete pMockMultiDeviceKernel;
+
+        ApiFixture::TearDown();
+    }
+
+    MockKernel *pMockKernel = nullptr;
+    MultiDeviceKernel *pMockMultiDeviceKernel = nullptr;
+    std::unique_ptr<MockKernelInfo> pKernelInfo;
+    char pSshLocal[64]{};
+    char pCrossThreadData[64]{};
+};
+
+using clSetKernelArgsINTELTests = Test<KernelArgsIntelFixture>;
+
+namespace ULT {
+
+TEST_F(clSetKernelArgsINTELTests, GivenNullKernelWhenSettingKernelArgsThenInvalidKernelErrorIsReturned) {
+    cl_uint argIndices[] = {0};
+    size_t argSizes[] = {sizeof(cl_mem)};
+    const void *argValues[] = {nullptr};
+
+    auto retVal = clSetKernelArgsINTEL(nullptr, 1, argIndices, argSizes, argValues);
+    EXPECT_EQ(CL_INVALID_KERNEL, retVal);
+}
+
+TEST_F(clSetKernelArgsINTELTests, GivenNullArgumentArraysWhenSettingKernelArgsThenInvalidValueErrorIsReturned) {
+    cl_uint argIndices[] = {0};
+    size_t argSizes[] = {sizeof(cl_mem)};
+    const void *argValues[] = {nullptr};
+
+    EXPECT_EQ(CL_INVALID_VALUE, clSetKernelArgsINTEL(pMockMultiDeviceKernel, 0, argIndices, argSizes, argValues));
+    EXPECT_EQ(CL_INVALID_VALUE, clSetKernelArgsINTEL(pMockMultiDeviceKernel, 1, nullptr, argSizes, argValues));
+    EXPECT_EQ(CL_INVALID_VALUE, clSetKernelArgsINTEL(pMockMultiDeviceKernel, 1, argIndices, nullptr, argValues));
+    EXPECT_EQ(CL_INVALID_VALUE, clSetKernelArgsINTEL(pMockMultiDeviceKernel, 1, argIndices, argSizes, nullptr));
+}
+
+TEST_F(clSetKernelArgsINTELTests, GivenInvalidArgIndexWhenSettingKernelArgsThenInvalidArgIndexErrorIsReturned) {
+    cl_mem memObj = nullptr;
+    cl_uint argIndices[] = {0, 2};
+    size_t argSizes[] = {sizeof(cl_mem), sizeof(cl_mem)};
+    const void *argValues[] = {&memObj, &memObj};
+
+    auto retVal = clSetKernelArgsINTEL(pMockMultiDeviceKernel, 2, argIndices, argSizes, argValues);
+    EXPECT_EQ(CL_INVALID_ARG_INDEX, retVal);
+}
+
+TEST_F(clSetKernelArgsINTELTests, GivenValidBuffersWhenSettingKernelArgsThenAllArgumentsArePatched) {
+    MockBuffer buffer0;
+    MockBuffer buffer1;
+    cl_mem memObj0 = &buffer0;
+    cl_mem memObj1 = &buffer1;
+    cl_uint argIndices[] = {1, 0};
+    size_t argSizes[] = {sizeof(cl_mem), sizeof(cl_mem)};
+    const void *argValues[] = {&memObj1, &memObj0};
+
+    auto retVal = clSetKernelArgsINTEL(pMockMultiDeviceKernel, 2, argIndices, argSizes, argValues);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(2u, pMockKernel->getPatchedArgumentsNum());
+    EXPECT_EQ(buffer0.getCpuAddress(), *reinterpret_cast<void **>(ptrOffset(pCrossThreadData, 0x10)));
+    EXPECT_EQ(buffer1.getCpuAddress(), *reinterpret_cast<void **>(ptrOffset(pCrossThreadData, 0x18)));
+}
+} // namespace ULT
@@ -413,6 +413,38 @@ HWTEST2_P(AuxBuiltInTests, givenInputBufferWhenBuildingAuxTranslationDispatchThe
     EXPECT_NE(builtinKernels[2], builtinKernels[5]);
 }
 
+HWTEST2_P(AuxBuiltInTests, givenTranslationInSameDirectionAlreadyDispatchedWhenBuildingAuxTranslationDispatchThenPickNotUsedKernels, AuxBuiltinsMatcher) {
+    BuiltinDispatchInfoBuilder &baseBuilder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, *pClDevice);
+    auto &builder = static_cast<BuiltInOp<EBuiltInOps::AuxTranslation> &>(baseBuilder);
+
+    KernelObjsForAuxTranslation kernelObjsForAuxTranslation;
+    std::vector<MockKernelObjForAuxTranslation> mockKernelObjForAuxTranslation;
+    for (int i = 0; i < 2; i++) {
+        mockKernelObjForAuxTranslation.push_back(MockKernelObjForAuxTranslation(kernelObjType));
+    }
+    for (auto &kernelObj : mockKernelObjForAuxTranslation) {
+        kernelObjsForAuxTranslation.insert(kernelObj);
+    }
+
+    MultiDispatchInfo multiDispatchInfo;
+    multiDispatchInfo.setKernelObjsForAuxTranslation(kernelObjsForAuxTranslation);
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.auxTranslationDirection = AuxTranslationDirection::NonAuxToAux;
+
+    EXPECT_TRUE(builder.buildDispatchInfosForAuxTranslation<FamilyType>(multiDispatchInfo, builtinOpsParams));
+    EXPECT_TRUE(builder.buildDispatchInfosForAuxTranslation<FamilyType>(multiDispatchInfo, builtinOpsParams));
+    ASSERT_EQ(4u, multiDispatchInfo.size());
+
+    std::vector<Kernel *> builtinKernels;
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        builtinKernels.push_back(dispatchInfo.getKernel());
+    }
+    EXPECT_NE(builtinKernels[0], builtinKernels[2]);
+    EXPECT_NE(builtinKernels[1], builtinKernels[2]);
+    EXPECT_NE(builtinKernels[0], builtinKernels[3]);
+    EXPECT_NE(builtinKernels[1], builtinKernels[3]);
+}
+
 HWTEST2_P(AuxBuiltInTests, givenInvalidAuxTranslationDirectionWhenBuildingDispatchInfosThenAbort, AuxBuiltinsMatcher) {
     BuiltinDispatchInfoBuilder &baseBuilder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, *pClDevice);
     auto &builder = static_cast<BuiltInOp<EBuiltInOps::AuxTranslation> &>(baseBuilder);
@@ -924,6 +956,32 @@ TEST_F(BuiltInTests, GivenUnalignedCopyBufferToBufferWhenDispatchInfoIsCreatedTh
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
 }
 
+TEST_F(BuiltInTests, GivenSmallCopyBufferToBufferSpanningCacheLinesWhenDispatchInfoIsCreatedThenSingleByteKernelIsUsed) {
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pClDevice);
+
+    AlignedBuffer srcMemObj;
+    auto size = 2 * MemoryConstants::cacheLineSize;
+    auto dstPtr = alignedMalloc(size, MemoryConstants::cacheLineSize);
+
+    BuiltinOpParams builtinOpsParams;
+
+    builtinOpsParams.srcMemObj = &srcMemObj;
+    builtinOpsParams.dstPtr = dstPtr;
+    builtinOpsParams.dstOffset.x = MemoryConstants::cacheLineSize / 2;
+    builtinOpsParams.size = {MemoryConstants::cacheLineSize, 0, 0};
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+
+    const DispatchInfo *dispatchInfo = multiDispatchInfo.begin();
+    EXPECT_EQ(dispatchInfo->getKernel()->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, "CopyBufferToBufferLeftLeftover");
+    EXPECT_EQ(Vec3<size_t>(MemoryConstants::cacheLineSize, 1, 1), dispatchInfo->getGWS());
+    EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
+    alignedFree(dstPtr);
+}
+
 TEST_F(BuiltInTests, GivenReadBufferAlignedWhenDispatchInfoIsCreatedThenParamsAreCorrect) {
     BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pClDevice);
 
@@ -2112,6 +2170,28 @@ TEST_F(BuiltInTests, WhenGettingSipKernelThenReturnProgramCreatedFromIsaAcquired
     mockCompilerInterface->releaseDummyGenBinary();
 }
 
+TEST_F(BuiltInTests, givenSipKernelCreatedForDeviceWhenGettingSipKernelForDeviceWithSameHardwareInfoThenCachedBinaryIsUsed) {
+    auto mockCompilerInterface = new MockCompilerInterface();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[rootDeviceIndex]->compilerInterface.reset(mockCompilerInterface);
+    auto builtins = new BuiltIns;
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[rootDeviceIndex]->builtins.reset(builtins);
+    mockCompilerInterface->sipKernelBinaryOverride = mockCompilerInterface->getDummyGenBinary();
+
+    const SipKernel &sipKernel = builtins->getSipKernel(SipKernelType::Csr, *pDevice);
+    EXPECT_EQ(SipKernelType::Csr, mockCompilerInterface->requestedSipKernel);
+
+    mockCompilerInterface->requestedSipKernel = SipKernelType::COUNT;
+    auto otherBuiltins = std::make_unique<BuiltIns>();
+    const SipKernel &otherSipKernel = otherBuiltins->getSipKernel(SipKernelType::Csr, *pDevice);
+    EXPECT_EQ(SipKernelType::COUNT, mockCompilerInterface->requestedSipKernel);
+
+    EXPECT_NE(sipKernel.getSipAllocation(), otherSipKernel.getSipAllocation());
+    EXPECT_EQ(0, memcmp(sipKernel.getSipAllocation()->getUnderlyingBuffer(), otherSipKernel.getSipAllocation()->getUnderlyingBuffer(), mockCompilerInterface->sipKernelBinaryOverride.size()));
+
+    otherBuiltins->freeSipKernels(pDevice->getMemoryManager());
+    mockCompilerInterface->releaseDummyGenBinary();
+}
+
 TEST_F(BuiltInTests, givenSipKernelWhenItIsCreatedThenItHasGraphicsAllocationForKernel) {
     const SipKernel &sipKern = pDevice->getBuiltIns()->getSipKernel(SipKernelType::Csr, pContext->getDevice(0)->getDevice());
     auto sipAllocation = sipKern.getSipAllocation();
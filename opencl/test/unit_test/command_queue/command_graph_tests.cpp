@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/command_queue/command_graph.h"
+#include "opencl/test/unit_test/fixtures/enqueue_handler_fixture.h"
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "test.h"
+
+using namespace NEO;
+
+using CommandGraphTest = EnqueueHandlerTest;
+
+HWTEST_F(CommandGraphTest, givenOutOfOrderQueueWhenBeginningCommandGraphCaptureThenInvalidOperationIsReturned) {
+    cl_queue_properties properties[3] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, properties);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, cmdQ.beginCommandGraphCapture());
+    EXPECT_FALSE(cmdQ.isCommandGraphCaptureActive());
+}
+
+HWTEST_F(CommandGraphTest, givenProfilingQueueWhenBeginningCommandGraphCaptureThenInvalidOperationIsReturned) {
+    cl_queue_properties properties[3] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, properties);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, cmdQ.beginCommandGraphCapture());
+}
+
+HWTEST_F(CommandGraphTest, givenActiveCaptureWhenBeginningCommandGraphCaptureAgainThenInvalidOperationIsReturned) {
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.beginCommandGraphCapture());
+    EXPECT_EQ(CL_INVALID_OPERATION, cmdQ.beginCommandGraphCapture());
+    EXPECT_NE(nullptr, cmdQ.endCommandGraphCapture());
+}
+
+HWTEST_F(CommandGraphTest, givenActiveCaptureWhenEnqueueingKernelWithEventThenInvalidOperationIsReturned) {
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pClDevice);
+    size_t gws[3] = {1, 1, 1};
+    cl_event event = nullptr;
+
+    cmdQ.beginCommandGraphCapture();
+    EXPECT_EQ(CL_INVALID_OPERATION, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event));
+    EXPECT_EQ(nullptr, event);
+
+    auto commandGraph = cmdQ.endCommandGraphCapture();
+    EXPECT_EQ(0u, commandGraph->getNodesCount());
+}
+
+HWTEST_F(CommandGraphTest, givenKernelWithPrintfWhenCheckingCommandGraphSupportThenKernelIsRejected) {
+    MockKernelWithInternals mockKernel(*pClDevice);
+    EXPECT_TRUE(CommandGraph::isKernelSupported(*mockKernel.mockKernel));
+
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.flags.usesPrintf = true;
+    EXPECT_FALSE(CommandGraph::isKernelSupported(*mockKernel.mockKernel));
+}
+
+HWTEST_F(CommandGraphTest, givenCapturedKernelsWhenEnqueueingCommandGraphThenKernelsAreSubmittedOnlyOnReplay) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pClDevice);
+    size_t gws[3] = {1, 1, 1};
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.beginCommandGraphCapture());
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    auto commandGraph = cmdQ.endCommandGraphCapture();
+
+    EXPECT_FALSE(cmdQ.isCommandGraphCaptureActive());
+    EXPECT_EQ(0u, csr.peekTaskCount());
+    ASSERT_NE(nullptr, commandGraph);
+    EXPECT_EQ(2u, commandGraph->getNodesCount());
+    ASSERT_EQ(1u, commandGraph->getSegments().size());
+    EXPECT_TRUE(commandGraph->getSegments()[0]->closed);
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandGraph(*commandGraph, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, csr.peekTaskCount());
+    EXPECT_EQ(1u, cmdQ.taskCount);
+    EXPECT_EQ(1u, commandGraph->getLastReplayTaskCount());
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandGraph(*commandGraph, 0, nullptr, nullptr));
+    EXPECT_EQ(2u, csr.peekTaskCount());
+}
+
+HWTEST_F(CommandGraphTest, givenReplayedCommandGraphWhenUpdatingCapturedKernelThenSegmentIsRecordedAgain) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pClDevice);
+    size_t gws[3] = {1, 1, 1};
+
+    cmdQ.beginCommandGraphCapture();
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    auto commandGraph = cmdQ.endCommandGraphCapture();
+    auto &segment = *commandGraph->getSegments()[0];
+    auto usedCommandStream = segment.operation->commandStream->getUsed();
+
+    cmdQ.enqueueCommandGraph(*commandGraph, 0, nullptr, nullptr);
+    *csr.getTagAddress() = csr.peekTaskCount();
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.updateCommandGraphKernel(*commandGraph, *mockKernel.mockKernel));
+    EXPECT_TRUE(segment.closed);
+    EXPECT_EQ(usedCommandStream, segment.operation->commandStream->getUsed());
+}
@@ -224,6 +224,205 @@ TEST(CommandQueue, givenDeviceWhenCreatingCommandQueueThenPickCsrFromDefaultEngi
     EXPECT_EQ(defaultCsr, &cmdQ.getGpgpuCommandStreamReceiver());
 }
 
+struct CommandQueuePlacementTests : public ::testing::Test {
+    void SetUp() override {
+        mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+        auto &defaultEngine = mockDevice->getDefaultEngine();
+        auto &hwInfo = mockDevice->getHardwareInfo();
+        auto engineGroupType = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getEngineGroupType(defaultEngine.getEngineType(), hwInfo);
+        auto &engineGroup = mockDevice->getDevice().getEngineGroups()[static_cast<uint32_t>(engineGroupType)];
+        engineGroup.clear();
+        for (auto i = 0u; i < numEngines; i++) {
+            csrs[i] = std::make_unique<MockCommandStreamReceiver>(*mockDevice->getDevice().getExecutionEnvironment(), 0, mockDevice->getDeviceBitfield());
+            csrs[i]->tagAddress = &tags[i];
+            engineGroup.push_back({csrs[i].get(), defaultEngine.osContext});
+        }
+    }
+
+    static constexpr uint32_t numEngines = 3u;
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockClDevice> mockDevice;
+    std::unique_ptr<MockCommandStreamReceiver> csrs[numEngines];
+    volatile uint32_t tags[numEngines] = {};
+};
+
+TEST_F(CommandQueuePlacementTests, givenDefaultPlacementPolicyWhenCreatingCommandQueuesThenDefaultEngineIsUsed) {
+    MockCommandQueue cmdQ0(nullptr, mockDevice.get(), 0);
+    MockCommandQueue cmdQ1(nullptr, mockDevice.get(), 0);
+
+    auto defaultCsr = mockDevice->getDefaultEngine().commandStreamReceiver;
+    EXPECT_EQ(defaultCsr, &cmdQ0.getGpgpuCommandStreamReceiver());
+    EXPECT_EQ(defaultCsr, &cmdQ1.getGpgpuCommandStreamReceiver());
+}
+
+TEST_F(CommandQueuePlacementTests, givenRoundRobinPlacementPolicyWhenCreatingCommandQueuesThenEnginesFromGroupAreUsedInTurn) {
+    DebugManager.flags.OverrideQueuePlacementPolicy.set(CL_QUEUE_PLACEMENT_ROUND_ROBIN_INTEL);
+
+    MockCommandQueue cmdQ0(nullptr, mockDevice.get(), 0);
+    MockCommandQueue cmdQ1(nullptr, mockDevice.get(), 0);
+    MockCommandQueue cmdQ2(nullptr, mockDevice.get(), 0);
+    MockCommandQueue cmdQ3(nullptr, mockDevice.get(), 0);
+
+    EXPECT_EQ(csrs[0].get(), &cmdQ0.getGpgpuCommandStreamReceiver());
+    EXPECT_EQ(csrs[1].get(), &cmdQ1.getGpgpuCommandStreamReceiver());
+    EXPECT_EQ(csrs[2].get(), &cmdQ2.getGpgpuCommandStreamReceiver());
+    EXPECT_EQ(csrs[0].get(), &cmdQ3.getGpgpuCommandStreamReceiver());
+}
+
+TEST_F(CommandQueuePlacementTests, givenLeastBusyPlacementPolicyInContextWhenCreatingCommandQueueThenEngineWithFewestTasksInFlightIsUsed) {
+    MockContext context(mockDevice.get());
+    context.setQueuePlacementPolicy(CL_QUEUE_PLACEMENT_LEAST_BUSY_INTEL);
+
+    csrs[0]->taskCount = 10u;
+    tags[0] = 2u;
+    csrs[1]->taskCount = 10u;
+    tags[1] = 9u;
+    csrs[2]->taskCount = 10u;
+    tags[2] = 5u;
+
+    MockCommandQueue cmdQ0(&context, mockDevice.get(), 0);
+    EXPECT_EQ(csrs[1].get(), &cmdQ0.getGpgpuCommandStreamReceiver());
+
+    tags[0] = 10u;
+    MockCommandQueue cmdQ1(&context, mockDevice.get(), 0);
+    EXPECT_EQ(csrs[0].get(), &cmdQ1.getGpgpuCommandStreamReceiver());
+}
+
+HWTEST_F(CommandQueuePlacementTests, givenOoqMultiEngineDispatchEnabledWhenCreatingOutOfOrderQueueThenLaneIsCreatedForEachOtherEngineInGroup) {
+    DebugManager.flags.EnableOoqMultiEngineDispatch.set(1);
+    mockDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MockCommandQueueHw<FamilyType> cmdQ(nullptr, mockDevice.get(), properties);
+
+    ASSERT_EQ(numEngines, cmdQ.getEngineLanesCount());
+    for (auto i = 0u; i < numEngines; i++) {
+        auto laneQueue = cmdQ.engineLanes[i].commandQueue;
+        EXPECT_EQ(csrs[i].get(), &laneQueue->getGpgpuCommandStreamReceiver());
+        EXPECT_FALSE(laneQueue->isOOQEnabled());
+        EXPECT_EQ(&cmdQ, laneQueue->getApiCommandQueue());
+    }
+    EXPECT_EQ(&cmdQ, cmdQ.getApiCommandQueue());
+}
+
+HWTEST_F(CommandQueuePlacementTests, givenOoqMultiEngineDispatchEnabledWhenCreatingInOrderQueueThenLanesAreNotCreated) {
+    DebugManager.flags.EnableOoqMultiEngineDispatch.set(1);
+    mockDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+
+    MockCommandQueueHw<FamilyType> cmdQ(nullptr, mockDevice.get(), nullptr);
+    EXPECT_EQ(0u, cmdQ.getEngineLanesCount());
+}
+
+HWTEST_F(CommandQueuePlacementTests, givenOoqMultiEngineDispatchEnabledAndTimestampPacketWriteDisabledWhenCreatingOutOfOrderQueueThenLanesAreNotCreated) {
+    DebugManager.flags.EnableOoqMultiEngineDispatch.set(1);
+    mockDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = false;
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MockCommandQueueHw<FamilyType> cmdQ(nullptr, mockDevice.get(), properties);
+    EXPECT_EQ(0u, cmdQ.getEngineLanesCount());
+}
+
+HWTEST_F(CommandQueuePlacementTests, givenImplicitScalingEnabledWhenCreatingQueueOnDeviceWithoutSubDevicesThenLanesAreNotCreated) {
+    DebugManager.flags.EnableImplicitScaling.set(1);
+    mockDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+
+    MockCommandQueueHw<FamilyType> cmdQ(nullptr, mockDevice.get(), nullptr);
+    EXPECT_EQ(0u, cmdQ.getEngineLanesCount());
+    EXPECT_FALSE(cmdQ.implicitScalingEnabled);
+}
+
+struct ImplicitScalingTests : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableTimestampPacket.set(1);
+        DebugManager.flags.EnableImplicitScaling.set(1);
+        deviceFactory = std::make_unique<UltClDeviceFactory>(1, 2);
+        context = std::make_unique<MockContext>(deviceFactory->rootDevices[0]);
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<UltClDeviceFactory> deviceFactory;
+    std::unique_ptr<MockContext> context;
+};
+
+HWTEST_F(ImplicitScalingTests, givenImplicitScalingEnabledWhenCreatingQueueOnRootDeviceThenLaneIsCreatedForEachSubDevice) {
+    MockCommandQueueHw<FamilyType> cmdQ(context.get(), deviceFactory->rootDevices[0], nullptr);
+
+    EXPECT_TRUE(cmdQ.implicitScalingEnabled);
+    ASSERT_EQ(2u, cmdQ.getEngineLanesCount());
+    for (auto i = 0u; i < 2u; i++) {
+        auto laneQueue = cmdQ.engineLanes[i].commandQueue;
+        EXPECT_EQ(deviceFactory->subDevices[i], &laneQueue->getClDevice());
+        EXPECT_EQ(&cmdQ, laneQueue->getApiCommandQueue());
+        EXPECT_EQ(0u, laneQueue->getEngineLanesCount());
+    }
+}
+
+HWTEST_F(ImplicitScalingTests, givenDispatchInfoWhenSplittingForImplicitScalingThenOutermostDimensionIsDividedBetweenChunks) {
+    using ImplicitScalingChunks = typename MockCommandQueueHw<FamilyType>::ImplicitScalingChunks;
+    MockKernelWithInternals mockKernel(*deviceFactory->rootDevices[0], context.get());
+    DispatchInfo dispatchInfo(deviceFactory->rootDevices[0], mockKernel.mockKernel, 2, {20, 5, 1}, {4, 1, 1}, {0, 0, 0});
+    dispatchInfo.setTotalNumberOfWorkgroups({5, 5, 1});
+    dispatchInfo.setNumberOfWorkgroups({5, 5, 1});
+    dispatchInfo.setStartOfWorkgroups({0, 0, 0});
+
+    ImplicitScalingChunks chunks;
+    EXPECT_EQ(2u, MockCommandQueueHw<FamilyType>::splitForImplicitScaling(dispatchInfo, 2, chunks));
+    ASSERT_EQ(2u, chunks.size());
+    EXPECT_EQ(Vec3<size_t>(0, 0, 0), chunks[0].getStartOfWorkgroups());
+    EXPECT_EQ(Vec3<size_t>(5, 3, 1), chunks[0].getNumberOfWorkgroups());
+    EXPECT_EQ(Vec3<size_t>(0, 3, 0), chunks[1].getStartOfWorkgroups());
+    EXPECT_EQ(Vec3<size_t>(5, 5, 1), chunks[1].getNumberOfWorkgroups());
+    EXPECT_EQ(Vec3<size_t>(5, 5, 1), chunks[1].getTotalNumberOfWorkgroups());
+}
+
+HWTEST_F(ImplicitScalingTests, givenSingleWorkgroupDispatchWhenSplittingForImplicitScalingThenNoChunksAreCreated) {
+    using ImplicitScalingChunks = typename MockCommandQueueHw<FamilyType>::ImplicitScalingChunks;
+    MockKernelWithInternals mockKernel(*deviceFactory->rootDevices[0], context.get());
+    DispatchInfo dispatchInfo(deviceFactory->rootDevices[0], mockKernel.mockKernel, 1, {4, 1, 1}, {4, 1, 1}, {0, 0, 0});
+    dispatchInfo.setTotalNumberOfWorkgroups({1, 1, 1});
+    dispatchInfo.setNumberOfWorkgroups({1, 1, 1});
+    dispatchInfo.setStartOfWorkgroups({0, 0, 0});
+
+    ImplicitScalingChunks chunks;
+    EXPECT_EQ(0u, MockCommandQueueHw<FamilyType>::splitForImplicitScaling(dispatchInfo, 2, chunks));
+    EXPECT_EQ(0u, chunks.size());
+}
+
+HWTEST_F(ImplicitScalingTests, givenImplicitScalingEnabledWhenEnqueueingKernelThenChunkIsSubmittedToEachSubDeviceAndEventCompletesOnRootEngine) {
+    MockCommandQueueHw<FamilyType> cmdQ(context.get(), deviceFactory->rootDevices[0], nullptr);
+    MockKernelWithInternals mockKernel(*deviceFactory->rootDevices[0], context.get());
+    size_t gws[3] = {4, 1, 1};
+    size_t lws[3] = {1, 1, 1};
+    cl_event event = nullptr;
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, lws, 0, nullptr, &event));
+
+    for (auto i = 0u; i < 2u; i++) {
+        auto &laneCsr = cmdQ.engineLanes[i].commandQueue->getGpgpuCommandStreamReceiver();
+        EXPECT_EQ(1u, laneCsr.peekTaskCount());
+        EXPECT_NE(nullptr, cmdQ.engineLanes[i].lastEvent);
+    }
+    EXPECT_EQ(2u, cmdQ.timestampPacketContainer->peekNodes().size());
+
+    auto eventObj = castToObject<Event>(event);
+    ASSERT_NE(nullptr, eventObj);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_NDRANGE_KERNEL), eventObj->getCommandType());
+    EXPECT_EQ(&cmdQ, eventObj->getCommandQueue());
+    eventObj->release();
+}
+
+HWTEST_F(ImplicitScalingTests, givenBlockingEnqueueOrKernelWithPrintfWhenCheckingImplicitScalingThenItIsNotAllowed) {
+    MockCommandQueueHw<FamilyType> cmdQ(context.get(), deviceFactory->rootDevices[0], nullptr);
+    MockKernelWithInternals mockKernel(*deviceFactory->rootDevices[0], context.get());
+    MockMultiDispatchInfo multiDispatchInfo(deviceFactory->rootDevices[0], mockKernel.mockKernel);
+
+    EXPECT_TRUE(cmdQ.implicitScalingAllowed(*mockKernel.mockKernel, multiDispatchInfo, false));
+    EXPECT_FALSE(cmdQ.implicitScalingAllowed(*mockKernel.mockKernel, multiDispatchInfo, true));
+
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.flags.usesPrintf = true;
+    EXPECT_FALSE(cmdQ.implicitScalingAllowed(*mockKernel.mockKernel, multiDispatchInfo, false));
+}
+
 struct CommandQueueWithBlitOperationsTests : public ::testing::TestWithParam<uint32_t> {};
 
 TEST_P(CommandQueueWithBlitOperationsTests, givenDeviceNotSupportingBlitOperationsWhenQueueIsCreatedThenDontRegisterBcsCsr) {
@@ -1189,6 +1388,38 @@ TEST(CommandQueue, givenClCommandWhenCallingBlitEnqueueAllowedThenReturnCorrectV
     EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_IMAGE));
 }
 
+TEST(CommandQueue, givenBlitterSizeThresholdWhenCallingBlitEnqueueAllowedWithTransferSizeThenBufferTransfersAreAllowedBySize) {
+    DebugManagerStateRestore restore{};
+    MockContext context{};
+
+    MockCommandQueue queue(&context, context.getDevice(0), 0);
+    if (!queue.bcsEngine) {
+        queue.bcsEngine = &context.getDevice(0)->getDefaultEngine();
+    }
+
+    bool supported = queue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled();
+    EXPECT_EQ(supported, queue.blitEnqueueAllowed(CL_COMMAND_READ_BUFFER, 1u));
+
+    DebugManager.flags.BlitterEnqueueSizeThreshold.set(static_cast<int32_t>(MemoryConstants::megaByte));
+    EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_READ_BUFFER, MemoryConstants::megaByte - 1));
+    EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_READ_BUFFER, MemoryConstants::megaByte));
+    EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_WRITE_BUFFER, MemoryConstants::megaByte));
+    EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER, MemoryConstants::megaByte));
+    EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_SVM_MEMCPY, MemoryConstants::megaByte));
+    EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_IMAGE, MemoryConstants::megaByte));
+    EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER_RECT, MemoryConstants::megaByte - 1));
+    EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER_RECT, MemoryConstants::megaByte));
+    EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_READ_BUFFER_RECT, MemoryConstants::megaByte));
+    EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_WRITE_BUFFER_RECT, MemoryConstants::megaByte));
+
+    DebugManager.flags.EnableBlitterForEnqueueOperations.set(0);
+    EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_READ_BUFFER, MemoryConstants::megaByte));
+
+    DebugManager.flags.EnableBlitterForEnqueueOperations.set(-1);
+    queue.bcsEngine = nullptr;
+    EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_READ_BUFFER, MemoryConstants::megaByte));
+}
+
 TEST(CommandQueue, givenRegularClCommandWhenCallingBlitEnqueuePreferredThenReturnCorrectValue) {
     MockContext context{};
     MockCommandQueue queue{context};
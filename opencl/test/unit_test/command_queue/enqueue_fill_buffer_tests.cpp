@@ -180,6 +180,35 @@ HWTEST_F(EnqueueFillBufferCmdTests, GivenMiddleWhenFillingBufferThenFillBufferMi
     context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
 }
 
+HWTEST_F(EnqueueFillBufferCmdTests, GivenPatternOfSixteenBytesWhenFillingBufferThenFillBufferMiddleWideKernelUsed) {
+    const size_t widePatternSize = 4 * sizeof(uint32_t);
+    auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{context.getDevice(0)->getRootDeviceIndex(), widePatternSize});
+
+    EnqueueFillBufferHelper<>::enqueueFillBuffer(pCmdQ, buffer);
+
+    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer,
+                                                                            pCmdQ->getClDevice());
+    ASSERT_NE(nullptr, &builder);
+
+    BuiltinOpParams dc;
+    MemObj patternMemObj(&this->context, 0, {}, 0, 0, widePatternSize, patternAllocation->getUnderlyingBuffer(),
+                         patternAllocation->getUnderlyingBuffer(), GraphicsAllocationHelper::toMultiGraphicsAllocation(patternAllocation), false, false, true);
+    dc.srcMemObj = &patternMemObj;
+    dc.dstMemObj = buffer;
+    dc.dstOffset = {0, 0, 0};
+    dc.size = {MemoryConstants::cacheLineSize, 0, 0};
+
+    MultiDispatchInfo mdi(dc);
+    builder.buildDispatchInfos(mdi);
+    EXPECT_EQ(1u, mdi.size());
+
+    auto kernel = mdi.begin()->getKernel();
+    EXPECT_STREQ("FillBufferMiddleWide", kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_EQ(Vec3<size_t>(MemoryConstants::cacheLineSize / widePatternSize, 1, 1), mdi.begin()->getGWS());
+
+    context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
+}
+
 HWTEST_F(EnqueueFillBufferCmdTests, GivenLeftLeftoverWhenFillingBufferThenFillBufferLeftLeftoverKernelUsed) {
     auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{context.getDevice(0)->getRootDeviceIndex(), EnqueueFillBufferTraits::patternSize});
 
@@ -493,6 +522,34 @@ HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternOfSizeTwoBytesSh
     EXPECT_EQ(0, memcmp(allocation->getUnderlyingBuffer(), output, size));
 }
 
+HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternOfSizeFourBytesShouldGetReplicatedForWideMiddleKernel) {
+    auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+
+    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
+    const uint8_t pattern[4] = {0x11, 0x22, 0x33, 0x44};
+    const size_t patternSize = sizeof(pattern);
+    const uint8_t output[16] = {0x11, 0x22, 0x33, 0x44, 0x11, 0x22, 0x33, 0x44,
+                                0x11, 0x22, 0x33, 0x44, 0x11, 0x22, 0x33, 0x44};
+
+    auto retVal = clEnqueueFillBuffer(
+        pCmdQ,
+        dstBuffer.get(),
+        pattern,
+        patternSize,
+        0,
+        patternSize,
+        0,
+        nullptr,
+        nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    GraphicsAllocation *allocation = csr.getAllocationsForReuse().peekHead();
+    ASSERT_NE(nullptr, allocation);
+
+    EXPECT_EQ(0, memcmp(allocation->getUnderlyingBuffer(), output, sizeof(output)));
+}
+
 HWTEST_F(EnqueueFillBufferCmdTests, givenEnqueueFillBufferWhenPatternAllocationIsObtainedThenItsTypeShouldBeSetToFillPattern) {
     auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
     ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
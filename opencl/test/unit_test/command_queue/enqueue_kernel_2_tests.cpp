@@ -885,6 +885,66 @@ HWTEST_F(EnqueueAuxKernelTests, givenKernelWithRequiredAuxTranslationWhenEnqueue
     EXPECT_TRUE(kernelAfter->isBuiltIn);
 }
 
+HWTEST_F(EnqueueAuxKernelTests, givenLazyAuxTranslationWhenKernelsUseSameBufferThenBufferIsTranslatedOnlyWhenItsStateChanges) {
+    DebugManager.flags.EnableLazyAuxTranslation.set(1);
+
+    MockKernelWithInternals mockKernel(*pClDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pClDevice);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+
+    buffer.getGraphicsAllocation(pClDevice->getRootDeviceIndex())->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelDescriptor.payloadMappings.explicitArgs.resize(1);
+    mockKernel.kernelInfo.kernelDescriptor.payloadMappings.explicitArgs[0].as<ArgDescPointer>(true).accessedUsingStatelessAddressingMode = true;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    ASSERT_EQ(1u, cmdQ.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, cmdQ.auxTranslationDirections[0]);
+
+    cmdQ.finish();
+    ASSERT_EQ(2u, cmdQ.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, cmdQ.auxTranslationDirections[1]);
+    EXPECT_EQ(&buffer, (*std::get<KernelObjsForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(1)).begin()).object);
+
+    cmdQ.finish();
+    EXPECT_EQ(2u, cmdQ.auxTranslationDirections.size());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenLazyAuxTranslationWhenEventIsReturnedThenBufferIsCompressedAfterKernel) {
+    DebugManager.flags.EnableLazyAuxTranslation.set(1);
+
+    MockKernelWithInternals mockKernel(*pClDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pClDevice);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+
+    buffer.getGraphicsAllocation(pClDevice->getRootDeviceIndex())->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelDescriptor.payloadMappings.explicitArgs.resize(1);
+    mockKernel.kernelInfo.kernelDescriptor.payloadMappings.explicitArgs[0].as<ArgDescPointer>(true).accessedUsingStatelessAddressingMode = true;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    ASSERT_EQ(1u, cmdQ.auxTranslationDirections.size());
+
+    cl_event event = nullptr;
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+    ASSERT_EQ(2u, cmdQ.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, cmdQ.auxTranslationDirections[1]);
+    EXPECT_EQ(&buffer, (*std::get<KernelObjsForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(1)).begin()).object);
+
+    cmdQ.finish();
+    EXPECT_EQ(2u, cmdQ.auxTranslationDirections.size());
+    clReleaseEvent(event);
+}
+
 HWTEST_F(EnqueueAuxKernelTests, givenDebugVariableDisablingBuiltinTranslationWhenDispatchingKernelWithRequiredAuxTranslationThenDontDispatch) {
     DebugManager.flags.ForceAuxTranslationMode.set(static_cast<int32_t>(AuxTranslationMode::Blit));
     pDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
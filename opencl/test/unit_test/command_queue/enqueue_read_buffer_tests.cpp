@@ -93,6 +93,67 @@ HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueReadBufferTypeTest, WhenReadingBufferThenGpgp
     }
 }
 
+HWTEST_F(EnqueueReadBufferTypeTest, givenHostPtrStagingBufferSizeWhenBlockingReadOfSmallBufferToHostPtrThenDataIsCopiedFromStagingBuffer) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostPtrStagingBufferSize.set(MemoryConstants::pageSize);
+    DebugManager.flags.HostPtrStagingBuffersCount.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    srcBuffer->forceDisallowCPUCopy = true;
+
+    char hostPtr[MemoryConstants::cacheLineSize] = {};
+    auto retVal = pCmdQ->enqueueReadBuffer(srcBuffer.get(), CL_TRUE, 0, sizeof(hostPtr), hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(1u, csr.stagingBuffers.size());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+
+    memset(csr.stagingBuffers[0]->getUnderlyingBuffer(), 0xCD, sizeof(hostPtr));
+    retVal = pCmdQ->enqueueReadBuffer(srcBuffer.get(), CL_TRUE, 0, sizeof(hostPtr), hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, csr.stagingBuffers.size());
+
+    char expectedData[sizeof(hostPtr)];
+    memset(expectedData, 0xCD, sizeof(expectedData));
+    EXPECT_EQ(0, memcmp(expectedData, hostPtr, sizeof(hostPtr)));
+}
+
+HWTEST_F(EnqueueReadBufferTypeTest, givenHostPtrStagingBufferSizeWhenBlockingReadOfBufferLargerThanStagingBufferThenEachChunkIsCopiedOutBeforeStagingBufferIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostPtrStagingBufferSize.set(MemoryConstants::cacheLineSize);
+    DebugManager.flags.HostPtrStagingBuffersCount.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    srcBuffer->forceDisallowCPUCopy = true;
+
+    char hostPtr[3 * MemoryConstants::cacheLineSize] = {};
+    auto retVal = pCmdQ->enqueueReadBuffer(srcBuffer.get(), CL_TRUE, 0, MemoryConstants::cacheLineSize, hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(1u, csr.stagingBuffers.size());
+    memset(csr.stagingBuffers[0]->getUnderlyingBuffer(), 0xCD, MemoryConstants::cacheLineSize);
+
+    auto taskCountBefore = pCmdQ->taskCount;
+    retVal = pCmdQ->enqueueReadBuffer(srcBuffer.get(), CL_TRUE, 0, sizeof(hostPtr), hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, csr.stagingBuffers.size());
+    EXPECT_EQ(taskCountBefore + 3, pCmdQ->taskCount);
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+
+    char expectedData[sizeof(hostPtr)];
+    memset(expectedData, 0xCD, sizeof(expectedData));
+    EXPECT_EQ(0, memcmp(expectedData, hostPtr, sizeof(hostPtr)));
+}
+
+HWTEST_F(EnqueueReadBufferTypeTest, givenHostPtrStagingBufferSizeWhenNonBlockingReadToHostPtrThenStagingBufferIsNotUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostPtrStagingBufferSize.set(MemoryConstants::pageSize);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    srcBuffer->forceDisallowCPUCopy = true;
+
+    char hostPtr[MemoryConstants::cacheLineSize] = {};
+    auto retVal = pCmdQ->enqueueReadBuffer(srcBuffer.get(), CL_FALSE, 0, sizeof(hostPtr), hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, csr.stagingBuffers.size());
+    EXPECT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
+}
+
 HWTEST_F(EnqueueReadBufferTypeTest, WhenReadingBufferThenTaskLevelIsIncremented) {
     auto taskLevelBefore = pCmdQ->taskLevel;
 
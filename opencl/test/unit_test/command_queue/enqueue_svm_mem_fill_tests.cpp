@@ -135,11 +135,12 @@ HWTEST_P(EnqueueSvmMemFillTest, givenEnqueueSVMMemFillWhenUsingFillBufferBuilder
     EXPECT_EQ(1u, mdi->size());
 
     auto di = mdi->begin();
-    size_t middleElSize = sizeof(uint32_t);
+    bool wideMiddle = (patternSize % (4 * sizeof(uint32_t))) == 0;
+    size_t middleElSize = wideMiddle ? 4 * sizeof(uint32_t) : sizeof(uint32_t);
     EXPECT_EQ(Vec3<size_t>(256 / middleElSize, 1, 1), di->getGWS());
 
     auto kernel = di->getKernel();
-    EXPECT_STREQ("FillBufferMiddle", kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_STREQ(wideMiddle ? "FillBufferMiddleWide" : "FillBufferMiddle", kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName.c_str());
 }
 
 INSTANTIATE_TEST_CASE_P(size_t,
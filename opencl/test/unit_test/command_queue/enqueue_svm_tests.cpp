@@ -1896,6 +1896,41 @@ TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueMemcpyThenAllocIsDecommit
     context->memoryManager = memoryManager;
 }
 
+TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueSvmMigrateMemForSharedAllocationThenAllocIsMovedToGpuDomain) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->pageFaultManager.reset(new MockPageFaultManager());
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    auto svmData = context->getSVMAllocsManager()->getSVMAlloc(ptrSVM);
+    svmData->memoryType = InternalMemoryType::SHARED_UNIFIED_MEMORY;
+    mockMemoryManager->getPageFaultManager()->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    const void *svmPtrs[] = {ptrSVM};
+
+    pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, CL_MIGRATE_MEM_OBJECT_HOST, 0, nullptr, nullptr);
+    EXPECT_EQ(static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager())->transferToGpuCalled, 0);
+
+    pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, 0, 0, nullptr, nullptr);
+    EXPECT_EQ(static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager())->protectMemoryCalled, 1);
+    EXPECT_EQ(static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager())->transferToGpuCalled, 1);
+
+    svmData->memoryType = InternalMemoryType::SVM;
+    context->memoryManager = memoryManager;
+}
+
+TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueSvmMigrateMemForNonSharedAllocationThenAllocIsNotMoved) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->pageFaultManager.reset(new MockPageFaultManager());
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    mockMemoryManager->getPageFaultManager()->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    const void *svmPtrs[] = {ptrSVM};
+
+    pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, 0, 0, nullptr, nullptr);
+    EXPECT_EQ(static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager())->transferToGpuCalled, 0);
+
+    context->memoryManager = memoryManager;
+}
+
 TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueMemFillThenAllocIsDecommitted) {
     char pattern[256];
     auto mockMemoryManager = std::make_unique<MockMemoryManager>();
@@ -489,6 +489,63 @@ HWTEST_F(EnqueueWriteBufferTypeTest, givenEnqueueWriteBufferCalledWhenLockedPtrI
     EXPECT_EQ(0u, memoryManager.unlockResourceCalled);
 }
 
+HWTEST_F(EnqueueWriteBufferTypeTest, givenHostPtrStagingBufferSizeWhenWritingSmallBufferFromHostPtrThenDataIsCopiedToStagingBuffer) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostPtrStagingBufferSize.set(MemoryConstants::pageSize);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    srcBuffer->forceDisallowCPUCopy = true;
+
+    char hostPtr[MemoryConstants::cacheLineSize];
+    memset(hostPtr, 0xAB, sizeof(hostPtr));
+    auto retVal = pCmdQ->enqueueWriteBuffer(srcBuffer.get(), CL_FALSE, 0, sizeof(hostPtr), hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, csr.stagingBuffers.size());
+    auto stagingBuffer = csr.stagingBuffers[0];
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, stagingBuffer->getAllocationType());
+    EXPECT_EQ(0, memcmp(hostPtr, stagingBuffer->getUnderlyingBuffer(), sizeof(hostPtr)));
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+    EXPECT_TRUE(stagingBuffer->isUsedByOsContext(csr.getOsContext().getContextId()));
+}
+
+HWTEST_F(EnqueueWriteBufferTypeTest, givenHostPtrStagingBufferSizeWhenWritingBufferLargerThanStagingBufferThenDataIsStreamedInChunksThroughStagingBuffers) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostPtrStagingBufferSize.set(MemoryConstants::cacheLineSize);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    srcBuffer->forceDisallowCPUCopy = true;
+
+    char hostPtr[2 * MemoryConstants::cacheLineSize];
+    memset(hostPtr, 0xAB, MemoryConstants::cacheLineSize);
+    memset(hostPtr + MemoryConstants::cacheLineSize, 0xCD, MemoryConstants::cacheLineSize);
+    auto retVal = pCmdQ->enqueueWriteBuffer(srcBuffer.get(), CL_FALSE, 0, sizeof(hostPtr), hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(2u, csr.stagingBuffers.size());
+    EXPECT_EQ(0, memcmp(hostPtr, csr.stagingBuffers[0]->getUnderlyingBuffer(), MemoryConstants::cacheLineSize));
+    EXPECT_EQ(0, memcmp(hostPtr + MemoryConstants::cacheLineSize, csr.stagingBuffers[1]->getUnderlyingBuffer(), MemoryConstants::cacheLineSize));
+    auto contextId = csr.getOsContext().getContextId();
+    EXPECT_LT(csr.stagingBuffers[0]->getTaskCount(contextId), csr.stagingBuffers[1]->getTaskCount(contextId));
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+}
+
+HWTEST_F(EnqueueWriteBufferTypeTest, givenAllStagingBuffersUsedWhenWritingBufferThenStagingBuffersAreReusedRoundRobin) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostPtrStagingBufferSize.set(MemoryConstants::pageSize);
+    DebugManager.flags.HostPtrStagingBuffersCount.set(2);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    srcBuffer->forceDisallowCPUCopy = true;
+
+    char hostPtr[MemoryConstants::cacheLineSize] = {};
+    for (uint32_t i = 0; i < 3; i++) {
+        auto retVal = pCmdQ->enqueueWriteBuffer(srcBuffer.get(), CL_TRUE, 0, sizeof(hostPtr), hostPtr, nullptr, 0, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    }
+
+    ASSERT_EQ(2u, csr.stagingBuffers.size());
+    EXPECT_EQ(csr.peekTaskCount(), csr.stagingBuffers[0]->getTaskCount(csr.getOsContext().getContextId()));
+    EXPECT_EQ(csr.peekTaskCount() - 1, csr.stagingBuffers[1]->getTaskCount(csr.getOsContext().getContextId()));
+}
+
 using NegativeFailAllocationTest = Test<NegativeFailAllocationCommandEnqueueBaseFixture>;
 
 HWTEST_F(NegativeFailAllocationTest, givenEnqueueWriteBufferWhenHostPtrAllocationCreationFailsThenReturnOutOfResource) {
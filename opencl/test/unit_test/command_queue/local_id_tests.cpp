@@ -8,9 +8,13 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/helpers/local_ids_cache.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/cpu_info.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 
+#include "opencl/source/helpers/per_thread_data.h"
+
 #include "test.h"
 
 #include <algorithm>
@@ -468,6 +472,65 @@ TEST_P(LocalIdsLayoutForImagesTest, givenLocalWorkgroupSizeCompatibleWithLayoutF
     validateGRF();
 }
 
+namespace NEO {
+struct uint16x8_t;
+struct uint16x32_t;
+} // namespace NEO
+
+TEST(LocalID, givenCpuWithAvx512WhenGeneratingSimd32LocalIdsThenAvx512GeneratorIsUsedAndMatchesSse4Generator) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512F | CpuInfo::featureAvX512Bw)) {
+        GTEST_SKIP();
+    }
+    auto avx512Generator = &generateLocalIDsSimd<uint16x32_t, 32>;
+    EXPECT_EQ(avx512Generator, LocalIDHelper::generateSimd32);
+
+    const size_t bufferSize = 32 * 3 * 32 * sizeof(uint16_t);
+    auto expectedLocalIds = allocateAlignedMemory(bufferSize, 64);
+    auto localIds = allocateAlignedMemory(bufferSize, 64);
+    for (auto dimensionsOrder : {std::array<uint8_t, 3>{{0, 1, 2}}, std::array<uint8_t, 3>{{2, 0, 1}}}) {
+        std::array<uint16_t, 3> localWorkgroupSize = {{7, 5, 3}};
+        auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(32, 7 * 5 * 3));
+        memset(expectedLocalIds.get(), 0, bufferSize);
+        memset(localIds.get(), 0, bufferSize);
+
+        generateLocalIDsSimd<uint16x8_t, 32>(expectedLocalIds.get(), localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, true);
+        LocalIDHelper::generateSimd32(localIds.get(), localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, true);
+        EXPECT_EQ(0, memcmp(expectedLocalIds.get(), localIds.get(), bufferSize));
+    }
+}
+
+TEST(LocalIdsCacheTest, givenSameDispatchShapeWhenGeneratingLocalIdsAgainThenCachedLocalIdsAreCopied) {
+    LocalIdsCache localIdsCache;
+    std::array<uint16_t, 3> localWorkgroupSize = {{16, 4, 1}};
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+    auto size = PerThreadDataHelper::getPerThreadDataSizeTotal(16, 32, 3, 64);
+
+    auto expectedLocalIds = allocateAlignedMemory(size, 32);
+    generateLocalIDs(expectedLocalIds.get(), 16, localWorkgroupSize, dimensionsOrder, false, 32);
+
+    for (auto i = 0u; i < 2; i++) {
+        auto localIds = allocateAlignedMemory(size, 32);
+        memset(localIds.get(), 0xff, size);
+        localIdsCache.generateLocalIds(localIds.get(), size, 16, localWorkgroupSize, dimensionsOrder, false, 32);
+        EXPECT_EQ(0, memcmp(expectedLocalIds.get(), localIds.get(), size));
+        EXPECT_EQ(1u, localIdsCache.getEntriesCount());
+    }
+}
+
+TEST(LocalIdsCacheTest, givenMoreDispatchShapesThanCacheCanHoldWhenGeneratingLocalIdsThenEntriesCountIsLimited) {
+    LocalIdsCache localIdsCache;
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+    auto maxSize = PerThreadDataHelper::getPerThreadDataSizeTotal(8, 32, 3, LocalIdsCache::maxEntriesCount + 1);
+    auto localIds = allocateAlignedMemory(maxSize, 32);
+
+    for (uint16_t i = 1; i <= LocalIdsCache::maxEntriesCount + 1; i++) {
+        std::array<uint16_t, 3> localWorkgroupSize = {{i, 1, 1}};
+        auto size = PerThreadDataHelper::getPerThreadDataSizeTotal(8, 32, 3, i);
+        localIdsCache.generateLocalIds(localIds.get(), size, 8, localWorkgroupSize, dimensionsOrder, false, 32);
+    }
+    EXPECT_EQ(LocalIdsCache::maxEntriesCount, localIdsCache.getEntriesCount());
+}
+
 #define SIMDParams ::testing::Values(8, 16, 32)
 #if HEAVY_DUTY_TESTING
 #define LWSXParams ::testing::Values(1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 128, 256)
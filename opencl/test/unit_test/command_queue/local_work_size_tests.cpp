@@ -712,3 +712,35 @@ TEST(localWorkSizeTest, givenMaxWorkgroupSizeEqualToSimdSizeWhenLwsIsCalculatedT
     EXPECT_EQ(workGroupSize[1], 1u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST(localWorkSizeTest, givenHeuristicLocalWorkSizeWhenComputingCandidatesThenNeighbouringSizesDividingGlobalSizeAreReturned) {
+    std::vector<Vec3<size_t>> candidates;
+    NEO::computeWorkgroupSizeCandidates({64, 64, 1}, {32, 1, 1}, 256, 16, candidates);
+
+    ASSERT_EQ(4u, candidates.size());
+    EXPECT_EQ(Vec3<size_t>(32, 1, 1), candidates[0]);
+    EXPECT_EQ(Vec3<size_t>(64, 1, 1), candidates[1]);
+    EXPECT_EQ(Vec3<size_t>(16, 1, 1), candidates[2]);
+    EXPECT_EQ(Vec3<size_t>(16, 2, 1), candidates[3]);
+}
+
+TEST(localWorkSizeTest, givenHeuristicLocalWorkSizeEqualToMaxWorkgroupSizeWhenComputingCandidatesThenBiggerSizesAreNotReturned) {
+    std::vector<Vec3<size_t>> candidates;
+    NEO::computeWorkgroupSizeCandidates({512, 1, 1}, {256, 1, 1}, 256, 16, candidates);
+
+    ASSERT_EQ(2u, candidates.size());
+    EXPECT_EQ(Vec3<size_t>(256, 1, 1), candidates[0]);
+    EXPECT_EQ(Vec3<size_t>(128, 1, 1), candidates[1]);
+}
+
+TEST(localWorkSizeTest, givenLocalWorkSizeTuningEnabledWhenGeneratingWorkgroupSizeForEnqueuedLocalSizeThenEnqueuedSizeIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalWorkSizeTuning.set(1);
+
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo{&device, kernel.mockKernel, 1, {256, 1, 1}, {16, 1, 1}, {0, 0, 0}};
+
+    EXPECT_EQ(Vec3<size_t>(16, 1, 1), generateWorkgroupSize(dispatchInfo));
+    EXPECT_TRUE(kernel.mockKernel->localWorkSizeTuningMap.empty());
+}
@@ -165,6 +165,27 @@ HWTEST_F(MultipleMapBufferTest, givenReadOnlyMapWhenUnmappedOnGpuThenEnqueueMark
     EXPECT_EQ(cmdQ->enqueueMarkerCalled, 1u);
 }
 
+HWTEST_F(MultipleMapBufferTest, givenWriteInvalidateMapWhenMappedOnGpuThenEnqueueMarkerInsteadOfReadAndWriteBackOnUnmap) {
+    auto buffer = createMockBuffer<FamilyType>(true);
+    auto cmdQ = createMockCmdQ<FamilyType>();
+    EXPECT_FALSE(buffer->mappingOnCpuAllowed());
+
+    size_t offset = 1;
+    size_t size = 3;
+    void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_TRUE, CL_MAP_WRITE_INVALIDATE_REGION, offset, size, 0, nullptr, nullptr, &retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, mappedPtr);
+    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, cmdQ->readBufferCalled);
+    EXPECT_EQ(1u, cmdQ->enqueueMarkerCalled);
+
+    retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, cmdQ->writeBufferCalled);
+    EXPECT_EQ(size, cmdQ->enqueueSize);
+    EXPECT_EQ(offset, cmdQ->enqueueOffset);
+}
+
 HWTEST_F(MultipleMapBufferTest, givenNotMappedPtrWhenUnmapedOnGpuThenReturnError) {
     auto buffer = createMockBuffer<FamilyType>(true);
     auto cmdQ = createMockCmdQ<FamilyType>();
@@ -22,6 +22,8 @@ class MockSyncBufferHandler : public SyncBufferHandler {
   public:
     using SyncBufferHandler::bufferSize;
     using SyncBufferHandler::graphicsAllocation;
+    using SyncBufferHandler::maxRetiredAllocationsCount;
+    using SyncBufferHandler::retiredAllocations;
     using SyncBufferHandler::usedBufferSize;
 };
 
@@ -170,6 +172,44 @@ HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSyncBufferFullWhenEnqueuingKernel
     EXPECT_EQ(workItemsCount, syncBufferHandler->usedBufferSize);
 }
 
+HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenFullSyncBufferCompletedByGpuWhenEnqueuingKernelThenBufferIsClearedAndReused) {
+    patchAllocateSyncBuffer();
+    enqueueNDCount();
+    auto syncBufferHandler = getSyncBufferHandler();
+    auto allocation = syncBufferHandler->graphicsAllocation;
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    *csr.getTagAddress() = allocation->getTaskCount(csr.getOsContext().getContextId());
+    static_cast<uint8_t *>(allocation->getUnderlyingBuffer())[0] = 1u;
+
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    enqueueNDCount();
+
+    EXPECT_EQ(allocation, syncBufferHandler->graphicsAllocation);
+    EXPECT_TRUE(syncBufferHandler->retiredAllocations.empty());
+    EXPECT_EQ(0u, static_cast<uint8_t *>(allocation->getUnderlyingBuffer())[0]);
+    EXPECT_EQ(workItemsCount, syncBufferHandler->usedBufferSize);
+}
+
+HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenFullSyncBuffersInUseByGpuWhenEnqueuingKernelThenNewBufferIsAllocatedAndRetiredBuffersAreLimited) {
+    patchAllocateSyncBuffer();
+    enqueueNDCount();
+    auto syncBufferHandler = getSyncBufferHandler();
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto contextId = csr.getOsContext().getContextId();
+
+    for (size_t i = 0; i <= MockSyncBufferHandler::maxRetiredAllocationsCount; i++) {
+        auto allocation = syncBufferHandler->graphicsAllocation;
+        allocation->updateTaskCount(*csr.getTagAddress() + 1, contextId);
+
+        syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+        enqueueNDCount();
+
+        EXPECT_NE(allocation, syncBufferHandler->graphicsAllocation);
+        EXPECT_EQ(allocation, syncBufferHandler->retiredAllocations.back());
+    }
+    EXPECT_EQ(MockSyncBufferHandler::maxRetiredAllocationsCount, syncBufferHandler->retiredAllocations.size());
+}
+
 HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSshRequiredWhenPatchingSyncBufferThenSshIsProperlyPatched) {
     using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
     kernelInternals->kernelInfo.setBufferAddressingMode(KernelDescriptor::BindfulAndStateless);
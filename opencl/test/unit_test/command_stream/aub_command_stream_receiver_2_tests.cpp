@@ -737,6 +737,44 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenWriteMe
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
 
+HWTEST_F(AubCommandStreamReceiverTests, givenSkipUnchangedAllocationsWhenWriteMemoryIsCalledAgainForSameContentThenPagesAreNotWalked) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AUBDumpSkipUnchangedAllocations.set(1);
+    pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    std::unique_ptr<MemoryManager> memoryManager(new OsAgnosticMemoryManager(*pDevice->executionEnvironment));
+
+    PhysicalAddressAllocator allocator;
+    struct PpgttMock : std::conditional<is64bit, PML4, PDPE>::type {
+        PpgttMock(PhysicalAddressAllocator *allocator) : std::conditional<is64bit, PML4, PDPE>::type(allocator) {}
+
+        void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) override {
+            pageWalkCalled++;
+        }
+        uint32_t pageWalkCalled = 0;
+    };
+    auto ppgttMock = new PpgttMock(&allocator);
+    aubCsr->ppgtt.reset(ppgttMock);
+
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), MemoryConstants::pageSize});
+    aubCsr->setAubWritable(true, *gfxAllocation);
+    memset(gfxAllocation->getUnderlyingBuffer(), 0, MemoryConstants::pageSize);
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(1u, ppgttMock->pageWalkCalled);
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(1u, ppgttMock->pageWalkCalled);
+
+    memset(gfxAllocation->getUnderlyingBuffer(), 1, MemoryConstants::pageSize);
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(2u, ppgttMock->pageWalkCalled);
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, whenAubCommandStreamReceiverIsCreatedThenPPGTTAndGGTTCreatedHavePhysicalAddressAllocatorSet) {
     auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
     ASSERT_NE(nullptr, aubCsr->ppgtt.get());
@@ -994,3 +994,32 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenCreateFullFilePath
     fullName = AUBCommandStreamReceiver::createFullFilePath(*defaultHwInfo, "aubfile");
     EXPECT_NE(std::string::npos, fullName.find("2tx"));
 }
+
+TEST(AubFileStreamAsyncTests, givenAsyncWriteEnabledWhenWritingToAubFileStreamThenDataIsInFileAfterFlushAndClose) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpAsyncWrite.set(1);
+
+    std::string fileName = "async_file_name.aub";
+    AubMemDump::AubFileStream aubFile;
+    aubFile.open(fileName.c_str());
+    ASSERT_TRUE(aubFile.isOpen());
+
+    uint64_t data = 0x1234;
+    aubFile.write(reinterpret_cast<const char *>(&data), sizeof(data));
+    aubFile.flush();
+    {
+        std::ifstream file(fileName, std::ifstream::binary | std::ifstream::ate);
+        EXPECT_EQ(static_cast<std::streamoff>(sizeof(data)), static_cast<std::streamoff>(file.tellg()));
+    }
+
+    std::vector<char> chunk(AubMemDump::AubFileStream::asyncWriteChunkSize, 1);
+    aubFile.write(chunk.data(), chunk.size());
+    aubFile.write(reinterpret_cast<const char *>(&data), sizeof(data));
+    aubFile.close();
+    EXPECT_FALSE(aubFile.isOpen());
+    {
+        std::ifstream file(fileName, std::ifstream::binary | std::ifstream::ate);
+        EXPECT_EQ(static_cast<std::streamoff>(2 * sizeof(data) + chunk.size()), static_cast<std::streamoff>(file.tellg()));
+    }
+    std::remove(fileName.c_str());
+}
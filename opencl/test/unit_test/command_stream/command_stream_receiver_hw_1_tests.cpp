@@ -69,6 +69,51 @@ HWCMDTEST_F(IGFX_GEN8_CORE, UltCommandStreamReceiverTest, givenNotSentStateSipWh
     }
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, UltCommandStreamReceiverTest, givenDeferredPreemptionAllocationCreationWhenFirstTaskIsFlushedWithMidThreadPreemptionThenPreemptionAllocationIsCreated) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DeferPreemptionAllocationCreation.set(1);
+
+    auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+
+    if (mockDevice->getPreemptionMode() == PreemptionMode::MidThread) {
+        auto &csr = mockDevice->getUltCommandStreamReceiver<FamilyType>();
+        csr.storeMakeResidentAllocations = true;
+        EXPECT_EQ(nullptr, csr.getPreemptionAllocation());
+
+        CommandQueueHw<FamilyType> commandQueue(nullptr, mockDevice.get(), 0, false);
+        auto &commandStream = commandQueue.getCS(4096u);
+
+        DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+        dispatchFlags.preemptionMode = PreemptionMode::MidThread;
+
+        MockGraphicsAllocation allocation(nullptr, 0);
+        IndirectHeap heap(&allocation);
+
+        csr.flushTask(commandStream,
+                      0,
+                      heap,
+                      heap,
+                      heap,
+                      0,
+                      dispatchFlags,
+                      mockDevice->getDevice());
+
+        auto preemptionAllocation = csr.getPreemptionAllocation();
+        ASSERT_NE(nullptr, preemptionAllocation);
+        EXPECT_TRUE(csr.isMadeResident(preemptionAllocation));
+
+        csr.flushTask(commandStream,
+                      0,
+                      heap,
+                      heap,
+                      heap,
+                      0,
+                      dispatchFlags,
+                      mockDevice->getDevice());
+        EXPECT_EQ(preemptionAllocation, csr.getPreemptionAllocation());
+    }
+}
+
 HWTEST_F(UltCommandStreamReceiverTest, givenCsrWhenProgramStateSipIsCalledThenIsStateSipCalledIsSetToTrue) {
     auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
 
@@ -94,6 +139,22 @@ HWTEST_F(UltCommandStreamReceiverTest, givenSentStateSipFlagSetWhenGetRequiredSt
     EXPECT_EQ(sizeForStateSip, sizeWithStateSipIsNotSent - sizeWhenSipIsSent);
 }
 
+HWTEST_F(UltCommandStreamReceiverTest, whenGettingRequiredCmdStreamSizeThenFixedCommandsSizeIsComputedOnceAndIncluded) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    EXPECT_EQ(0u, commandStreamReceiver.fixedCmdStreamSize);
+
+    auto requiredSize = commandStreamReceiver.getRequiredCmdStreamSize(dispatchFlags, *pDevice);
+    auto expectedFixedSize = commandStreamReceiver.getRequiredStateBaseAddressSize() + sizeof(PIPE_CONTROL) + sizeof(MI_BATCH_BUFFER_START);
+    EXPECT_EQ(expectedFixedSize, commandStreamReceiver.fixedCmdStreamSize);
+    EXPECT_LE(expectedFixedSize, requiredSize);
+
+    EXPECT_EQ(requiredSize, commandStreamReceiver.getRequiredCmdStreamSize(dispatchFlags, *pDevice));
+    EXPECT_EQ(expectedFixedSize, commandStreamReceiver.fixedCmdStreamSize);
+}
+
 HWTEST_F(UltCommandStreamReceiverTest, givenSentStateSipFlagSetAndSourceLevelDebuggerIsActiveWhenGetRequiredStateSipCmdSizeIsCalledThenStateSipCmdSizeIsIncluded) {
     auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
     DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
@@ -64,6 +64,22 @@ HWTEST_F(BcsTests, givenBltSizeWhenEstimatingCommandSizeThenAddAllRequiredComman
     EXPECT_FALSE(BlitCommandsHelper<FamilyType>::isCopyRegionPreferred(notAlignedCopySize, pClDevice->getRootDeviceEnvironment()));
 }
 
+HWTEST_F(BcsTests, givenTaskCountDependenciesWhenEstimatingCommandSizeThenAddSemaphoreForEachDependency) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    auto copySize = Vec3<size_t>{1, 1, 1};
+
+    auto baseEstimatedSize = BlitCommandsHelper<FamilyType>::estimateBlitCommandsSize(
+        copySize, csrDependencies, false, false, pClDevice->getRootDeviceEnvironment());
+
+    csrDependencies.taskCountContainer.push_back({1u, 0x1000u});
+    csrDependencies.taskCountContainer.push_back({2u, 0x2000u});
+
+    auto estimatedSize = BlitCommandsHelper<FamilyType>::estimateBlitCommandsSize(
+        copySize, csrDependencies, false, false, pClDevice->getRootDeviceEnvironment());
+
+    EXPECT_EQ(baseEstimatedSize + 2 * sizeof(MI_SEMAPHORE_WAIT), estimatedSize);
+}
+
 HWTEST_F(BcsTests, givenDebugCapabilityWhenEstimatingCommandSizeThenAddAllRequiredCommands) {
     constexpr auto max2DBlitSize = BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight;
     size_t cmdsSizePerBlit = sizeof(typename FamilyType::XY_COPY_BLT) + sizeof(typename FamilyType::MI_ARB_CHECK);
@@ -46,6 +46,8 @@
 #include "command_stream_receiver_simulated_hw.h"
 #include "gmock/gmock.h"
 
+#include <thread>
+
 using namespace NEO;
 
 struct CommandStreamReceiverTest : public ClDeviceFixture,
@@ -145,6 +147,65 @@ TEST_F(CommandStreamReceiverTest, WhenCommandStreamReceiverIsCreatedThenItHasATa
     EXPECT_NE(nullptr, const_cast<uint32_t *>(commandStreamReceiver->getTagAddress()));
 }
 
+TEST_F(CommandStreamReceiverTest, givenTaskCountAlreadyReachedWhenJoiningCompletionWaitThenWaitIsCompletedWithoutBecomingActiveWaiter) {
+    *commandStreamReceiver->getTagAddress() = 5u;
+    bool activeWaiter = true;
+    EXPECT_TRUE(commandStreamReceiver->joinCompletionWait(5u, activeWaiter));
+    EXPECT_FALSE(activeWaiter);
+}
+
+TEST_F(CommandStreamReceiverTest, givenActiveWaiterForLowerTaskCountWhenJoiningCompletionWaitThenCallerWaitsIndependently) {
+    *commandStreamReceiver->getTagAddress() = 0u;
+    bool activeWaiter = false;
+    EXPECT_FALSE(commandStreamReceiver->joinCompletionWait(2u, activeWaiter));
+    EXPECT_TRUE(activeWaiter);
+
+    bool secondActiveWaiter = true;
+    EXPECT_FALSE(commandStreamReceiver->joinCompletionWait(3u, secondActiveWaiter));
+    EXPECT_FALSE(secondActiveWaiter);
+
+    commandStreamReceiver->leaveCompletionWait();
+}
+
+TEST_F(CommandStreamReceiverTest, givenActiveWaiterCoveringTaskCountWhenJoiningCompletionWaitThenCallerSleepsUntilActiveWaiterLeaves) {
+    *commandStreamReceiver->getTagAddress() = 0u;
+    bool activeWaiter = false;
+    EXPECT_FALSE(commandStreamReceiver->joinCompletionWait(3u, activeWaiter));
+    EXPECT_TRUE(activeWaiter);
+
+    bool followerCompleted = false;
+    bool followerActiveWaiter = true;
+    std::thread follower([&]() {
+        followerCompleted = commandStreamReceiver->joinCompletionWait(2u, followerActiveWaiter);
+    });
+
+    *commandStreamReceiver->getTagAddress() = 3u;
+    commandStreamReceiver->leaveCompletionWait();
+    follower.join();
+
+    EXPECT_TRUE(followerCompleted);
+    EXPECT_FALSE(followerActiveWaiter);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenCoalesceCompletionWaitsEnabledWhenWaitForTaskCountCompletesThenActiveWaiterIsReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CoalesceCompletionWaits.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    *csr.getTagAddress() = 0u;
+    csr.latestFlushedTaskCount = 1u;
+
+    std::thread waiter([&]() {
+        csr.waitForTaskCountWithKmdNotifyFallback(1u, 0, false, false);
+    });
+    *csr.getTagAddress() = 1u;
+    waiter.join();
+
+    bool activeWaiter = false;
+    EXPECT_FALSE(csr.joinCompletionWait(2u, activeWaiter));
+    EXPECT_TRUE(activeWaiter);
+    csr.leaveCompletionWait();
+}
+
 TEST_F(CommandStreamReceiverTest, WhenGettingCommandStreamerThenValidPointerIsReturned) {
     auto &cs = commandStreamReceiver->getCS();
     EXPECT_NE(nullptr, &cs);
@@ -414,6 +475,26 @@ HWTEST_F(InitDirectSubmissionTest, whenDirectSubmissionEnabledOnRcsThenExpectFea
     csr.reset();
 }
 
+HWTEST_F(InitDirectSubmissionTest, givenCoalesceSubmissionsEnabledWhenDirectSubmissionEnabledOnRcsThenBatchedDispatchIsKept) {
+    DebugManager.flags.DirectSubmissionCoalesceSubmissions.set(1);
+    auto csr = std::make_unique<MockCsrHw2<FamilyType>>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
+    std::unique_ptr<OsContext> osContext(OsContext::create(device->getExecutionEnvironment()->rootDeviceEnvironments[0]->osInterface.get(),
+                                                           0, device->getDeviceBitfield(), EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::ThreadGroup,
+                                                           false));
+    osContext->ensureContextInitialized();
+    osContext->setDefaultContext(true);
+    auto hwInfo = device->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo->capabilityTable.directSubmissionEngines.data[aub_stream::ENGINE_RCS].engineSupported = true;
+    hwInfo->capabilityTable.directSubmissionEngines.data[aub_stream::ENGINE_RCS].submitOnInit = false;
+
+    bool ret = csr->initDirectSubmission(*device, *osContext.get());
+    EXPECT_TRUE(ret);
+    EXPECT_TRUE(csr->isDirectSubmissionEnabled());
+    EXPECT_EQ(DispatchMode::BatchedDispatch, csr->dispatchMode);
+
+    csr.reset();
+}
+
 HWTEST_F(InitDirectSubmissionTest, givenDirectSubmissionEnabledWhenPlatformNotSupportsRcsThenExpectFeatureNotAvailable) {
     auto csr = std::make_unique<CommandStreamReceiverHw<FamilyType>>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
     std::unique_ptr<OsContext> osContext(OsContext::create(device->getExecutionEnvironment()->rootDeviceEnvironments[0]->osInterface.get(),
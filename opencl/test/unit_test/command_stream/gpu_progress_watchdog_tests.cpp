@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/gpu_progress_watchdog.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_os_context.h"
+#include "test.h"
+
+using namespace NEO;
+
+struct GpuProgressWatchdogMock : public GpuProgressWatchdog {
+    using GpuProgressWatchdog::checkProgress;
+    using GpuProgressWatchdog::csrsMutex;
+    using GpuProgressWatchdog::csrsProgress;
+    using GpuProgressWatchdog::keepWatching;
+    using GpuProgressWatchdog::timeout;
+    using GpuProgressWatchdog::watchdogThread;
+};
+
+struct GpuProgressWatchdogTests : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.GpuProgressWatchdogTimeout.set(100000);
+
+        executionEnvironment.prepareRootDeviceEnvironments(1);
+        executionEnvironment.initializeMemoryManager();
+        csr = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, DeviceBitfield(1));
+        csr->tagAddress = &tag;
+        csr->setupContext(osContext);
+    }
+
+    DebugManagerStateRestore restore;
+    MockExecutionEnvironment executionEnvironment;
+    MockOsContext osContext{0, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false};
+    std::unique_ptr<MockCommandStreamReceiver> csr;
+    volatile uint32_t tag = 0;
+};
+
+TEST_F(GpuProgressWatchdogTests, givenWatchdogWhenRegisteringCsrThenWatchingThreadIsStartedAndCsrIsTracked) {
+    GpuProgressWatchdogMock watchdog;
+    EXPECT_EQ(100000, watchdog.timeout.count());
+    EXPECT_EQ(nullptr, watchdog.watchdogThread.get());
+
+    watchdog.registerCsr(csr.get());
+    EXPECT_NE(nullptr, watchdog.watchdogThread.get());
+    EXPECT_TRUE(watchdog.keepWatching);
+    {
+        std::lock_guard<std::mutex> lock(watchdog.csrsMutex);
+        EXPECT_EQ(1u, watchdog.csrsProgress.size());
+    }
+
+    watchdog.unregisterCsr(csr.get());
+    std::lock_guard<std::mutex> lock(watchdog.csrsMutex);
+    EXPECT_TRUE(watchdog.csrsProgress.empty());
+}
+
+TEST_F(GpuProgressWatchdogTests, givenTimeoutDisabledWhenRegisteringCsrThenWatchingThreadIsNotStarted) {
+    DebugManager.flags.GpuProgressWatchdogTimeout.set(-1);
+
+    GpuProgressWatchdogMock watchdog;
+    watchdog.registerCsr(csr.get());
+    EXPECT_EQ(nullptr, watchdog.watchdogThread.get());
+    EXPECT_TRUE(watchdog.csrsProgress.empty());
+}
+
+TEST_F(GpuProgressWatchdogTests, givenTagNotProgressingLongerThanTimeoutWhenCheckingProgressThenHangIsReportedOnce) {
+    GpuProgressWatchdogMock watchdog;
+    watchdog.registerCsr(csr.get());
+    csr->latestFlushedTaskCount = 2;
+    csr->addSubmissionDescription("kernel");
+
+    std::unique_lock<std::mutex> lock(watchdog.csrsMutex);
+    auto start = watchdog.csrsProgress[csr.get()].lastProgress;
+    watchdog.checkProgress(start + watchdog.timeout / 2);
+    watchdog.checkProgress(start + watchdog.timeout * 2);
+    watchdog.checkProgress(start + watchdog.timeout * 3);
+    lock.unlock();
+
+    auto reports = watchdog.getHangReports();
+    ASSERT_EQ(1u, reports.size());
+    EXPECT_NE(std::string::npos, reports[0].find("completed task count 0 of 2"));
+}
+
+TEST_F(GpuProgressWatchdogTests, givenTagProgressingWhenCheckingProgressThenHangIsNotReported) {
+    GpuProgressWatchdogMock watchdog;
+    watchdog.registerCsr(csr.get());
+    csr->latestFlushedTaskCount = 2;
+
+    std::unique_lock<std::mutex> lock(watchdog.csrsMutex);
+    auto start = watchdog.csrsProgress[csr.get()].lastProgress;
+    tag = 1;
+    watchdog.checkProgress(start + watchdog.timeout * 2);
+    tag = 2;
+    watchdog.checkProgress(start + watchdog.timeout * 4);
+    lock.unlock();
+
+    EXPECT_TRUE(watchdog.getHangReports().empty());
+}
+
+TEST(GpuProgressWatchdogExecutionEnvironmentTests, givenExecutionEnvironmentWhenGettingGpuProgressWatchdogThenSameWatchdogIsReturned) {
+    MockExecutionEnvironment executionEnvironment;
+    auto watchdog = executionEnvironment.getGpuProgressWatchdog();
+    EXPECT_NE(nullptr, watchdog);
+    EXPECT_EQ(watchdog, executionEnvironment.getGpuProgressWatchdog());
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/submission_gpu_timestamps.h"
+#include "shared/source/command_stream/submission_latency_counters.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+
+#include "opencl/test/unit_test/fixtures/ult_command_stream_receiver_fixture.h"
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_ostime.h"
+#include "test.h"
+
+#include <limits>
+#include <sstream>
+
+using namespace NEO;
+
+TEST(SubmissionLatencyCountersTests, givenLatencyWhenGettingBucketIndexThenLog2OfLatencyIsReturnedAndLimitedToLastBucket) {
+    EXPECT_EQ(0u, SubmissionLatencyCounters::getBucketIndex(0));
+    EXPECT_EQ(0u, SubmissionLatencyCounters::getBucketIndex(1));
+    EXPECT_EQ(10u, SubmissionLatencyCounters::getBucketIndex(1024));
+    EXPECT_EQ(10u, SubmissionLatencyCounters::getBucketIndex(2047));
+    EXPECT_EQ(SubmissionLatencyCounters::bucketsCount - 1, SubmissionLatencyCounters::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(SubmissionLatencyCountersTests, givenRecordedLatenciesWhenDumpingThenOnlyStagesWithSamplesArePrinted) {
+    SubmissionLatencyCounters counters;
+    counters.record(SubmissionLatencyCounters::Residency, 1024);
+    counters.record(SubmissionLatencyCounters::Residency, 1500);
+    counters.record(SubmissionLatencyCounters::Submit, 4);
+
+    EXPECT_EQ(2u, counters.getSamplesCount(SubmissionLatencyCounters::Residency));
+    EXPECT_EQ(2524u, counters.getTotalTime(SubmissionLatencyCounters::Residency));
+    EXPECT_EQ(2u, counters.getBucketCount(SubmissionLatencyCounters::Residency, 10));
+    EXPECT_EQ(1u, counters.getBucketCount(SubmissionLatencyCounters::Submit, 2));
+    EXPECT_EQ(0u, counters.getSamplesCount(SubmissionLatencyCounters::GpuStart));
+
+    std::stringstream out;
+    counters.dump(out);
+    auto dump = out.str();
+    EXPECT_EQ(0u, dump.find("stage,samples,totalNs,<2ns"));
+    EXPECT_NE(std::string::npos, dump.find("\nresidency,2,2524,"));
+    EXPECT_NE(std::string::npos, dump.find("\nsubmit,1,4,"));
+    EXPECT_EQ(std::string::npos, dump.find("stateProgramming"));
+    EXPECT_EQ(std::string::npos, dump.find("gpuStart"));
+}
+
+TEST(SubmissionLatencyCountersTests, givenScopeWithoutCountersWhenScopeEndsThenNothingIsRecorded) {
+    SubmissionLatencyCounters counters;
+    {
+        SubmissionLatencyScope scope(nullptr, SubmissionLatencyCounters::Submit);
+    }
+    {
+        SubmissionLatencyScope scope(&counters, SubmissionLatencyCounters::Residency);
+    }
+    EXPECT_EQ(0u, counters.getSamplesCount(SubmissionLatencyCounters::Submit));
+    EXPECT_EQ(1u, counters.getSamplesCount(SubmissionLatencyCounters::Residency));
+}
+
+TEST(SubmissionLatencyCountersTests, givenCountersFlagWhenCreatingCsrThenCountersAreCreatedOnlyWhenEnabled) {
+    DebugManagerStateRestore restore;
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+
+    MockCommandStreamReceiver csrWithoutCounters(executionEnvironment, 0, deviceBitfield);
+    EXPECT_EQ(nullptr, csrWithoutCounters.getSubmissionLatencyCounters());
+
+    DebugManager.flags.EnableSubmissionLatencyCounters.set(1);
+    MockCommandStreamReceiver csrWithCounters(executionEnvironment, 0, deviceBitfield);
+    EXPECT_NE(nullptr, csrWithCounters.getSubmissionLatencyCounters());
+}
+
+TEST(SubmissionLatencyCountersTests, givenCountersEnabledWhenObtainingCsrOwnershipThenEachAcquisitionIsRecorded) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableSubmissionLatencyCounters.set(1);
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    auto counters = csr.getSubmissionLatencyCounters();
+    ASSERT_NE(nullptr, counters);
+    {
+        auto lock = csr.obtainUniqueOwnership();
+        EXPECT_TRUE(lock.owns_lock());
+        auto nestedLock = csr.obtainUniqueOwnership();
+        EXPECT_TRUE(nestedLock.owns_lock());
+    }
+    EXPECT_EQ(2u, counters->getSamplesCount(SubmissionLatencyCounters::OwnershipWait));
+    EXPECT_EQ(2u, counters->getBucketCount(SubmissionLatencyCounters::OwnershipWait, 0));
+    EXPECT_EQ(0u, counters->getTotalTime(SubmissionLatencyCounters::OwnershipWait));
+    EXPECT_STREQ("ownershipWait", SubmissionLatencyCounters::getStageName(SubmissionLatencyCounters::OwnershipWait));
+}
+
+TEST(SubmissionGpuTimestampsTests, givenCompletedSubmissionWhenHarvestingThenGpuBusyAndQueueingDelayAreRecordedAndSlotIsReleased) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    auto &hwHelper = HwHelper::get(defaultHwInfo->platform.eRenderCoreFamily);
+    MockOSTime osTime;
+    SubmissionLatencyCounters counters;
+
+    SubmissionGpuTimestamps gpuTimestamps(device->getGpgpuCommandStreamReceiver(), hwHelper, 1.0);
+    ASSERT_NE(nullptr, gpuTimestamps.getAllocation());
+
+    // first slot takes CPU/GPU time sample, mock OS time keeps both clocks equal
+    auto slot = gpuTimestamps.acquireSlot(1u, osTime);
+    ASSERT_NE(nullptr, slot);
+    EXPECT_EQ(gpuTimestamps.getAllocation()->getGpuAddress(), gpuTimestamps.getGpuAddress(slot));
+    gpuTimestamps.setSubmitTime(1000000u);
+    slot->start = 1001000u;
+    slot->end = 1001200u;
+    EXPECT_EQ(1u, gpuTimestamps.getPendingCount());
+
+    gpuTimestamps.harvest(0u, counters);
+    EXPECT_EQ(1u, gpuTimestamps.getPendingCount());
+    EXPECT_EQ(0u, counters.getSamplesCount(SubmissionLatencyCounters::GpuBusy));
+
+    gpuTimestamps.harvest(1u, counters);
+    EXPECT_EQ(0u, gpuTimestamps.getPendingCount());
+    EXPECT_EQ(1u, counters.getSamplesCount(SubmissionLatencyCounters::GpuBusy));
+    EXPECT_EQ(200u, counters.getTotalTime(SubmissionLatencyCounters::GpuBusy));
+    EXPECT_EQ(1u, counters.getSamplesCount(SubmissionLatencyCounters::GpuQueueing));
+    EXPECT_EQ(1000u, counters.getTotalTime(SubmissionLatencyCounters::GpuQueueing));
+    EXPECT_STREQ("gpuBusy", SubmissionLatencyCounters::getStageName(SubmissionLatencyCounters::GpuBusy));
+    EXPECT_STREQ("gpuQueueing", SubmissionLatencyCounters::getStageName(SubmissionLatencyCounters::GpuQueueing));
+}
+
+TEST(SubmissionGpuTimestampsTests, givenAllSlotsPendingWhenAcquiringSlotThenSubmissionIsNotTimed) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    MockOSTime osTime;
+
+    SubmissionGpuTimestamps gpuTimestamps(device->getGpgpuCommandStreamReceiver(), HwHelper::get(defaultHwInfo->platform.eRenderCoreFamily), 1.0);
+    for (uint32_t i = 0; i < SubmissionGpuTimestamps::slotsCount; i++) {
+        EXPECT_NE(nullptr, gpuTimestamps.acquireSlot(i + 1, osTime));
+    }
+    EXPECT_EQ(nullptr, gpuTimestamps.acquireSlot(SubmissionGpuTimestamps::slotsCount + 1, osTime));
+
+    // slots without written timestamps are released without samples
+    SubmissionLatencyCounters counters;
+    gpuTimestamps.harvest(1u, counters);
+    EXPECT_EQ(SubmissionGpuTimestamps::slotsCount - 1, gpuTimestamps.getPendingCount());
+    EXPECT_EQ(0u, counters.getSamplesCount(SubmissionLatencyCounters::GpuBusy));
+    EXPECT_NE(nullptr, gpuTimestamps.acquireSlot(SubmissionGpuTimestamps::slotsCount + 1, osTime));
+}
+
+using SubmissionGpuTimestampsFlushTaskTests = UltCommandStreamReceiverTest;
+
+HWTEST_F(SubmissionGpuTimestampsFlushTaskTests, givenGpuTimestampsEnabledWhenFlushingBlockingTaskThenTimestampsAreWrittenAtStartAndEndOfBatchBuffer) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableSubmissionGpuTimestamps.set(1);
+
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::ImmediateDispatch;
+    commandStreamReceiver.submissionLatencyCounters = std::make_unique<SubmissionLatencyCounters>();
+
+    flushTask(commandStreamReceiver, true);
+
+    auto gpuTimestamps = commandStreamReceiver.submissionGpuTimestamps.get();
+    ASSERT_NE(nullptr, gpuTimestamps);
+    EXPECT_EQ(1u, gpuTimestamps->getPendingCount());
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(gpuTimestamps->getAllocation()));
+
+    auto findTimestampPipeControl = [](GenCmdList &cmdList, uint64_t address) {
+        for (auto &cmd : findAll<PIPE_CONTROL *>(cmdList.begin(), cmdList.end())) {
+            auto pipeControl = genCmdCast<PIPE_CONTROL *>(*cmd);
+            auto pipeControlAddress = (static_cast<uint64_t>(pipeControl->getAddressHigh()) << 32) | pipeControl->getAddress();
+            if (pipeControl->getPostSyncOperation() == PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_TIMESTAMP && pipeControlAddress == address) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto startAddress = gpuTimestamps->getAllocation()->getGpuAddress();
+    auto endAddress = startAddress + sizeof(uint64_t);
+
+    parseCommands<FamilyType>(commandStreamReceiver.commandStream, 0);
+    EXPECT_TRUE(findTimestampPipeControl(cmdList, startAddress));
+    EXPECT_FALSE(findTimestampPipeControl(cmdList, endAddress));
+
+    HardwareParse taskStreamParse;
+    taskStreamParse.parseCommands<FamilyType>(commandStream, 0);
+    EXPECT_TRUE(findTimestampPipeControl(taskStreamParse.cmdList, endAddress));
+    EXPECT_FALSE(findTimestampPipeControl(taskStreamParse.cmdList, startAddress));
+}
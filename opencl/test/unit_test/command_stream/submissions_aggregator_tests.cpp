@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/helpers/flush_stamp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 
@@ -45,6 +46,31 @@ TEST(SubmissionsAggregator, givenCommandBufferWhenItIsPassedToSubmissionsAggrega
     //idlist holds the ownership
 }
 
+TEST(SubmissionsAggregator, givenRecycledSurfacesWhenObtainingSurfacesThenEmptyContainerWithRetainedCapacityIsReturned) {
+    MockSubmissionAggregator submissionsAggregator;
+    MockGraphicsAllocation alloc(nullptr, 1);
+
+    ResidencyContainer surfaces;
+    submissionsAggregator.obtainSurfaces(surfaces);
+    EXPECT_EQ(0u, surfaces.capacity());
+
+    surfaces.reserve(64);
+    surfaces.push_back(&alloc);
+    auto storage = surfaces.data();
+    submissionsAggregator.recycleSurfaces(surfaces);
+    EXPECT_TRUE(surfaces.empty());
+
+    ResidencyContainer obtainedSurfaces;
+    submissionsAggregator.obtainSurfaces(obtainedSurfaces);
+    EXPECT_TRUE(obtainedSurfaces.empty());
+    EXPECT_EQ(storage, obtainedSurfaces.data());
+    EXPECT_LE(64u, obtainedSurfaces.capacity());
+
+    ResidencyContainer nextSurfaces;
+    submissionsAggregator.obtainSurfaces(nextSurfaces);
+    EXPECT_EQ(0u, nextSurfaces.capacity());
+}
+
 TEST(SubmissionsAggregator, givenTwoCommandBuffersWhenMergeResourcesIsCalledThenDuplicatesAreEliminated) {
     MockSubmissionAggregator submissionsAggregator;
 
@@ -574,6 +600,82 @@ TEST(SubmissionsAggregator, givenCommandBuffersRequiringDifferentSliceCountSetti
     EXPECT_EQ(1u, cmdBuffer->inspectionId);
 }
 
+TEST(SubmissionsAggregator, givenMaxPendingCommandBuffersSetWhenLimitIsReachedThenFlushIsRequiredAndStatisticsAreUpdatedOnFlush) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxCommandBuffers.set(2);
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto now = std::chrono::steady_clock::now();
+    EXPECT_FALSE(submissionsAggregator.isFlushRequired(now));
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_FALSE(submissionsAggregator.isFlushRequired(now));
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_TRUE(submissionsAggregator.isFlushRequired(now));
+
+    submissionsAggregator.registerFlush(std::chrono::steady_clock::now());
+    EXPECT_FALSE(submissionsAggregator.isFlushRequired(now));
+
+    auto &statistics = submissionsAggregator.getBatchingStatistics();
+    EXPECT_EQ(1u, statistics.batches);
+    EXPECT_EQ(2u, statistics.batchedCommandBuffers);
+    EXPECT_EQ(2u, statistics.getAverageBatchSize());
+
+    submissionsAggregator.registerFlush(std::chrono::steady_clock::now());
+    EXPECT_EQ(1u, statistics.batches);
+}
+
+TEST(SubmissionsAggregator, givenMaxPendingSurfacesSetWhenLimitIsReachedThenFlushIsRequired) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxSurfaces.set(2);
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockGraphicsAllocation alloc1(nullptr, 1);
+    MockGraphicsAllocation alloc2(nullptr, 2);
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+    cmdBuffer->surfaces.push_back(&alloc1);
+    cmdBuffer2->surfaces.push_back(&alloc2);
+
+    auto now = std::chrono::steady_clock::now();
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    EXPECT_FALSE(submissionsAggregator.isFlushRequired(now));
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+    EXPECT_TRUE(submissionsAggregator.isFlushRequired(now));
+}
+
+TEST(SubmissionsAggregator, givenFlushDeadlineSetWhenOldestCommandBufferWaitsLongerThenFlushIsRequired) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchFlushDeadline.set(50);
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto recordTime = std::chrono::steady_clock::now();
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+
+    EXPECT_FALSE(submissionsAggregator.isFlushRequired(recordTime));
+    auto flushTime = std::chrono::steady_clock::now() + std::chrono::microseconds(50);
+    EXPECT_TRUE(submissionsAggregator.isFlushRequired(flushTime));
+
+    submissionsAggregator.registerFlush(flushTime);
+    auto &statistics = submissionsAggregator.getBatchingStatistics();
+    EXPECT_EQ(1u, statistics.batches);
+    EXPECT_LE(50000u, statistics.getAverageAddedLatencyNs());
+}
+
+TEST(SubmissionsAggregator, givenDefaultSettingsWhenCommandBuffersAreRecordedThenFlushIsNotRequired) {
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    for (auto i = 0u; i < 16u; i++) {
+        submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    }
+    EXPECT_FALSE(submissionsAggregator.isFlushRequired(std::chrono::steady_clock::now() + std::chrono::hours(1)));
+}
+
 struct SubmissionsAggregatorTests : public ::testing::Test {
     void SetUp() override {
         device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
@@ -709,3 +811,25 @@ HWTEST_F(SubmissionsAggregatorTests, givenMultipleCmdBuffersWhenNotAggregatedDur
     castToObject<Event>(event1)->release();
     castToObject<Event>(event2)->release();
 }
+
+HWTEST_F(SubmissionsAggregatorTests, givenMaxPendingCommandBuffersSetWhenEnqueueingThenPendingCommandBuffersAreFlushedImplicitly) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxCommandBuffers.set(2);
+    MockKernelWithInternals kernel(*device.get());
+    CommandQueueHw<FamilyType> cmdQ1(context.get(), device.get(), 0, false);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
+    mockCsr->useNewResourceImplicitFlush = false;
+    mockCsr->useGpuIdleImplicitFlush = false;
+    size_t GWS = 1;
+
+    overrideCsr(mockCsr);
+
+    cmdQ1.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, nullptr);
+    EXPECT_FALSE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    cmdQ1.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, nullptr);
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+
+    auto &statistics = mockCsr->peekSubmissionAggregator()->getBatchingStatistics();
+    EXPECT_EQ(1u, statistics.batches);
+    EXPECT_EQ(2u, statistics.batchedCommandBuffers);
+}
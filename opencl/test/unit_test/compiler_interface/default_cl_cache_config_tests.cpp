@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,4 +13,6 @@ TEST(CompilerCache, GivenDefaultClCacheConfigThenValuesAreProperlyPopulated) {
     EXPECT_STREQ("cl_cache", cacheConfig.cacheDir.c_str());
     EXPECT_STREQ(".cl_cache", cacheConfig.cacheFileExtension.c_str());
     EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_TRUE(cacheConfig.memoryCacheEnabled);
+    EXPECT_EQ(NEO::defaultCompilerCacheSize, cacheConfig.cacheSize);
 }
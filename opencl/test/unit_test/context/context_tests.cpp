@@ -278,6 +278,27 @@ TEST_F(ContextTest, GivenInteropSyncParamWhenCreateContextThenSetContextParam) {
     delete context;
 }
 
+TEST_F(ContextTest, GivenQueuePlacementPolicyParamWhenCreateContextThenSetContextParam) {
+    cl_device_id deviceID = devices[0];
+    auto pPlatform = NEO::platform();
+    cl_platform_id pid[1];
+    pid[0] = pPlatform;
+
+    cl_context_properties properties[5] = {CL_CONTEXT_PLATFORM, (cl_context_properties)pid[0],
+                                           CL_CONTEXT_QUEUE_PLACEMENT_POLICY_INTEL, CL_QUEUE_PLACEMENT_ROUND_ROBIN_INTEL, 0};
+    cl_int retVal = CL_SUCCESS;
+    auto context = Context::create<Context>(properties, ClDeviceVector(&deviceID, 1), nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, context);
+    EXPECT_EQ(CL_QUEUE_PLACEMENT_ROUND_ROBIN_INTEL, context->getQueuePlacementPolicy());
+    delete context;
+
+    properties[3] = CL_QUEUE_PLACEMENT_LEAST_BUSY_INTEL + 1;
+    context = Context::create<Context>(properties, ClDeviceVector(&deviceID, 1), nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_INVALID_PROPERTY, retVal);
+    EXPECT_EQ(nullptr, context);
+}
+
 class MockSharingFunctions : public SharingFunctions {
   public:
     uint32_t getId() const override {
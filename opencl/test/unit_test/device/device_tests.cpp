@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/os_interface/os_context.h"
@@ -24,6 +25,7 @@
 #include "opencl/test/unit_test/mocks/mock_execution_environment.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "opencl/test/unit_test/mocks/mock_platform.h"
+#include "opencl/test/unit_test/mocks/ult_cl_device_factory.h"
 #include "test.h"
 
 #include <memory>
@@ -644,6 +646,75 @@ TEST(DeviceGenEngineTest, givenDeferredContextInitializationDisabledWhenCreating
     }
 }
 
+TEST(DeviceGenEngineTest, givenDeferredEngineInitializationEnabledWhenCreatingEnginesThenOnlyInternalEngineAllocationsAreCreatedUntilEngineIsLookedUp) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferDeviceEngineInitialization.set(1);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    auto &engines = device->getEngines();
+    EXPECT_NE(0u, engines.size());
+    for (const EngineControl &engine : engines) {
+        const bool isInternalEngine = engine.osContext->isInternalEngine();
+        EXPECT_EQ(isInternalEngine, nullptr != engine.commandStreamReceiver->getTagAllocation());
+        EXPECT_EQ(isInternalEngine, nullptr != engine.commandStreamReceiver->getGlobalFenceAllocation());
+    }
+
+    EXPECT_TRUE(device->ensureDefaultEnginesInitialized());
+    auto defaultCsr = device->getDefaultEngine().commandStreamReceiver;
+    EXPECT_NE(nullptr, defaultCsr->getTagAllocation());
+    for (const EngineControl &engine : engines) {
+        if (engine.commandStreamReceiver != defaultCsr && !engine.osContext->isInternalEngine()) {
+            EXPECT_EQ(nullptr, engine.commandStreamReceiver->getTagAllocation());
+        }
+    }
+
+    for (auto engineIndex = 0u; engineIndex < engines.size(); engineIndex++) {
+        auto &engine = device->getEngine(engineIndex);
+        EXPECT_NE(nullptr, engine.commandStreamReceiver->getTagAllocation());
+        EXPECT_NE(nullptr, engine.commandStreamReceiver->getGlobalFenceAllocation());
+    }
+    EXPECT_TRUE(device->ensureEngineInitialized(device->getDefaultEngine()));
+}
+
+TEST(DeviceGenEngineTest, givenDeferredEngineInitializationEnabledWhenCreatingContextOnSubDeviceThenDefaultEnginesOfWholeRootDeviceAreInitialized) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferDeviceEngineInitialization.set(1);
+
+    UltClDeviceFactory factory(1, 2);
+    auto &rootDevice = factory.rootDevices[0]->getDevice();
+    EXPECT_EQ(nullptr, rootDevice.getDeviceById(1)->getDefaultEngine().commandStreamReceiver->getTagAllocation());
+
+    cl_int retVal = CL_SUCCESS;
+    cl_device_id subDeviceId = factory.subDevices[0];
+    std::unique_ptr<Context> context(Context::create<Context>(nullptr, ClDeviceVector(&subDeviceId, 1), nullptr, nullptr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    for (auto subDeviceIndex = 0u; subDeviceIndex < 2u; subDeviceIndex++) {
+        EXPECT_NE(nullptr, rootDevice.getDeviceById(subDeviceIndex)->getDefaultEngine().commandStreamReceiver->getTagAllocation());
+    }
+}
+
+TEST(DeviceGenEngineTest, givenMinimalEngineSetEnabledWhenCreatingEnginesThenOnlyDefaultCopyAndInternalEnginesAreCreated) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.CreateMinimalEngineSet.set(1);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    auto defaultEngineType = getChosenEngineType(device->getHardwareInfo());
+    auto &engines = device->getEngines();
+    EXPECT_NE(0u, engines.size());
+    for (const EngineControl &engine : engines) {
+        auto engineType = engine.osContext->getEngineType();
+        if (engine.osContext->isInternalEngine() || EngineHelpers::isBcs(engineType)) {
+            continue;
+        }
+        EXPECT_EQ(defaultEngineType, engineType);
+        EXPECT_FALSE(engine.osContext->isLowPriority());
+    }
+
+    auto &lowPriorityEngine = device->getEngine(defaultEngineType, EngineUsage::LowPriority);
+    EXPECT_EQ(&device->getDefaultEngine(), &lowPriorityEngine);
+}
+
 using DeviceQueueFamiliesTests = ::testing::Test;
 
 HWTEST_F(DeviceQueueFamiliesTests, whenGettingQueueFamilyCapabilitiesAllThenReturnCorrectValue) {
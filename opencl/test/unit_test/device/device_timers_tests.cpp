@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
 #include "opencl/test/unit_test/fixtures/cl_device_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_ostime.h"
 
@@ -111,4 +113,61 @@ TEST(MockOSTime, GivenNullWhenSettingOsTimeThenResolutionIsZero) {
 
     delete mDev;
 }
+
+class CorrelationOSTime : public MockOSTime {
+  public:
+    bool getCpuGpuTime(TimeStampData *pGpuCpuTime) override {
+        getCpuGpuTimeCalled++;
+        pGpuCpuTime->GPUTimeStamp = gpuTime;
+        pGpuCpuTime->CPUTimeinNS = cpuTime;
+        return true;
+    }
+    bool getCpuTime(uint64_t *timeStamp) override {
+        *timeStamp = cpuTime;
+        return true;
+    }
+
+    uint64_t cpuTime = 1000u;
+    uint64_t gpuTime = 500u;
+    uint32_t getCpuGpuTimeCalled = 0u;
+};
+
+TEST(OSTimeCorrelation, givenCorrelationSampleWithinRefreshPeriodWhenGettingCpuGpuTimeThenGpuTimeIsDerivedFromCpuTime) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CpuGpuTimeCorrelationRefreshPeriodMs.set(1);
+    CorrelationOSTime osTime;
+    TimeStampData timeStamp = {};
+
+    EXPECT_TRUE(osTime.getCpuGpuTimeFromCorrelation(&timeStamp, 80.0));
+    EXPECT_EQ(1u, osTime.getCpuGpuTimeCalled);
+    EXPECT_EQ(1000u, timeStamp.CPUTimeinNS);
+    EXPECT_EQ(500u, timeStamp.GPUTimeStamp);
+
+    osTime.cpuTime += 800u;
+    EXPECT_TRUE(osTime.getCpuGpuTimeFromCorrelation(&timeStamp, 80.0));
+    EXPECT_EQ(1u, osTime.getCpuGpuTimeCalled);
+    EXPECT_EQ(1800u, timeStamp.CPUTimeinNS);
+    EXPECT_EQ(510u, timeStamp.GPUTimeStamp);
+
+    osTime.cpuTime = 1000u + 1000000u;
+    osTime.gpuTime = 20000u;
+    EXPECT_TRUE(osTime.getCpuGpuTimeFromCorrelation(&timeStamp, 80.0));
+    EXPECT_EQ(2u, osTime.getCpuGpuTimeCalled);
+    EXPECT_EQ(1001000u, timeStamp.CPUTimeinNS);
+    EXPECT_EQ(20000u, timeStamp.GPUTimeStamp);
+}
+
+TEST(OSTimeCorrelation, givenRefreshPeriodZeroWhenGettingCpuGpuTimeThenGpuTimeIsAlwaysRead) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CpuGpuTimeCorrelationRefreshPeriodMs.set(0);
+    CorrelationOSTime osTime;
+    TimeStampData timeStamp = {};
+
+    EXPECT_TRUE(osTime.getCpuGpuTimeFromCorrelation(&timeStamp, 80.0));
+    osTime.cpuTime += 800u;
+    osTime.gpuTime += 7u;
+    EXPECT_TRUE(osTime.getCpuGpuTimeFromCorrelation(&timeStamp, 80.0));
+    EXPECT_EQ(2u, osTime.getCpuGpuTimeCalled);
+    EXPECT_EQ(507u, timeStamp.GPUTimeStamp);
+}
 } // namespace ULT
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/memory_manager/memory_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/cl_device/cl_device_info_map.h"
@@ -994,6 +995,35 @@ TEST(GetDeviceInfoTest, givenDeviceWithSubDevicesWhenGettingNumberOfComputeUnits
     EXPECT_EQ(sizeof(numComputeUnits), retSize);
 }
 
+TEST(GetDeviceInfoTest, givenAllocationsOnDeviceWhenQueryingMemoryUsageStatisticsThenUsedCountersAreReturned) {
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto memoryManager = device->getMemoryManager();
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties({device->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, device->getDeviceBitfield()});
+    ASSERT_NE(nullptr, allocation);
+
+    size_t retSize = 0;
+    auto retVal = device->getDeviceInfo(CL_DEVICE_MEMORY_USAGE_STATISTICS_INTEL, 0, nullptr, &retSize);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(0u, retSize);
+    EXPECT_EQ(0u, retSize % sizeof(cl_memory_usage_statistics_intel));
+
+    std::vector<cl_memory_usage_statistics_intel> statistics(retSize / sizeof(cl_memory_usage_statistics_intel));
+    retVal = device->getDeviceInfo(CL_DEVICE_MEMORY_USAGE_STATISTICS_INTEL, retSize, statistics.data(), nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto bufferStatistics = std::find_if(statistics.begin(), statistics.end(), [&](const cl_memory_usage_statistics_intel &entry) {
+        return entry.allocationType == static_cast<cl_uint>(GraphicsAllocation::AllocationType::BUFFER) &&
+               entry.memoryPool == static_cast<cl_uint>(allocation->getMemoryPool());
+    });
+    ASSERT_NE(statistics.end(), bufferStatistics);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), bufferStatistics->currentSize);
+    EXPECT_EQ(1u, bufferStatistics->currentCount);
+    EXPECT_EQ(1u, bufferStatistics->allocationsCount);
+    EXPECT_EQ(0u, bufferStatistics->freesCount);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 struct DeviceAttributeQueryTest : public ::testing::TestWithParam<uint32_t /*cl_device_info*/> {
     void SetUp() override {
         param = GetParam();
@@ -337,6 +337,26 @@ TEST_F(AsyncEventsHandlerTests, givenEventWithoutCallbacksWhenProcessedThenDontR
     event2->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventReachedByCsrTagWhenListIsProcessedThenCallbackIsExecutedByWorkerAndEventIsUnregistered) {
+    event1->setTaskStamp(0, 1);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+
+    EXPECT_EQ(event1.get(), handler->process());
+    EXPECT_EQ(CL_SUBMITTED, event1->getExecutionStatus());
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 1;
+    EXPECT_EQ(nullptr, handler->process());
+    EXPECT_TRUE(handler->peekIsListEmpty());
+
+    // destruction waits for dispatched callbacks
+    handler.reset();
+    EXPECT_EQ(1, counter);
+    EXPECT_EQ(CL_COMPLETE, event1->getExecutionStatus());
+    EXPECT_EQ(1, event1->getRefInternalCount());
+}
+
 TEST_F(AsyncEventsHandlerTests, givenSleepCandidateWhenProcessedThenCallWaitWithQuickKmdSleepRequest) {
     event1->setTaskStamp(0, 1);
     event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
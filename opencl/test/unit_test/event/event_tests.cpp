@@ -194,6 +194,33 @@ TEST(Event, WhenWaitingForEventsThenAllQueuesAreFlushed) {
     EXPECT_EQ(1u, cmdQ2->flushCounter);
 }
 
+TEST(Event, givenMultipleEventsFromOneQueueWhenWaitingForEventsThenQueueIsFirstWaitedForHighestTaskCount) {
+    class MockCommandQueueWithWaitCheck : public MockCommandQueue {
+      public:
+        MockCommandQueueWithWaitCheck(Context &context, ClDevice *device) : MockCommandQueue(&context, device, nullptr) {
+        }
+        void waitUntilComplete(uint32_t gpgpuTaskCountToWait, uint32_t bcsTaskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) override {
+            waitedTaskCounts.push_back(gpgpuTaskCountToWait);
+            MockCommandQueue::waitUntilComplete(gpgpuTaskCountToWait, bcsTaskCountToWait, flushStampToWait, useQuickKmdSleep);
+        }
+        std::vector<uint32_t> waitedTaskCounts;
+    };
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+
+    MockCommandQueueWithWaitCheck cmdQ(context, device.get());
+    Event event1(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 4, 4);
+    Event event2(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 6, 6);
+    Event event3(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 5, 5);
+
+    cl_event eventWaitlist[] = {&event1, &event2, &event3};
+    EXPECT_EQ(CL_SUCCESS, Event::waitForEvents(3, eventWaitlist));
+
+    ASSERT_LE(1u, cmdQ.waitedTaskCounts.size());
+    EXPECT_EQ(6u, cmdQ.waitedTaskCounts[0]);
+}
+
 TEST(Event, GivenNotReadyEventWhenWaitingForEventsThenQueueIsNotFlushed) {
     class MockCommandQueueWithFlushCheck : public MockCommandQueue {
       public:
@@ -17,6 +17,7 @@
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
+#include "shared/source/utilities/worker_pool.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/unit_test/utilities/destructor_counted.h"
@@ -111,6 +112,52 @@ TEST(ExecutionEnvironment, givenDeviceWhenItIsDestroyedThenMemoryManagerIsStillA
     EXPECT_NE(nullptr, executionEnvironment->memoryManager);
 }
 
+TEST(ExecutionEnvironment, givenFastProcessExitDisabledWhenPreparingForFastExitThenFalseIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableFastProcessExit.set(0);
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    EXPECT_FALSE(device->getExecutionEnvironment()->prepareForFastExit());
+}
+
+TEST(ExecutionEnvironment, givenFastProcessExitEnabledAndHwCsrsWhenPreparingForFastExitThenEnginesAreIdleAndTrueIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableFastProcessExit.set(1);
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    auto executionEnvironment = device->getExecutionEnvironment();
+    EXPECT_TRUE(executionEnvironment->prepareForFastExit());
+
+    for (auto &engine : executionEnvironment->memoryManager->getRegisteredEngines()) {
+        EXPECT_GE(*engine.commandStreamReceiver->getTagAddress(), engine.commandStreamReceiver->peekTaskCount());
+    }
+}
+
+TEST(ExecutionEnvironment, givenFastProcessExitEnabledAndNoMemoryManagerWhenPreparingForFastExitThenFalseIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableFastProcessExit.set(1);
+    ExecutionEnvironment executionEnvironment;
+    EXPECT_FALSE(executionEnvironment.prepareForFastExit());
+}
+
+TEST(ExecutionEnvironment, givenDriverWorkerPoolRequestedWhenGettingItAgainThenSamePoolIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DriverWorkerPoolSize.set(2);
+    DebugManager.flags.DriverWorkerPoolCpuAffinityMask.set(1);
+
+    ExecutionEnvironment executionEnvironment;
+    EXPECT_EQ(nullptr, executionEnvironment.peekDriverWorkerPool());
+
+    auto workerPool = executionEnvironment.getDriverWorkerPool();
+    ASSERT_NE(nullptr, workerPool);
+    EXPECT_EQ(workerPool, executionEnvironment.getDriverWorkerPool());
+    EXPECT_EQ(workerPool, executionEnvironment.peekDriverWorkerPool());
+
+    std::atomic<uint32_t> executedTasks{0};
+    workerPool->enqueue(WorkerPoolClient::EventCallbacks, [&]() { executedTasks++; });
+    workerPool->waitForClientTasks(WorkerPoolClient::EventCallbacks);
+    EXPECT_EQ(1u, executedTasks.load());
+    EXPECT_EQ(1u, workerPool->getWorkersCount());
+}
+
 TEST(RootDeviceEnvironment, givenExecutionEnvironmentWhenInitializeAubCenterIsCalledThenItIsReceivesCorrectInputParams) {
     MockExecutionEnvironment executionEnvironment;
     executionEnvironment.rootDeviceEnvironments[0]->setHwInfo(defaultHwInfo.get());
@@ -166,6 +213,9 @@ static_assert(sizeof(ExecutionEnvironment) == sizeof(std::unique_ptr<HardwareInf
                                                   sizeof(std::vector<RootDeviceEnvironment>) +
                                                   sizeof(std::unique_ptr<OsEnvironment>) +
                                                   sizeof(bool) +
+                                                  3 * sizeof(std::unique_ptr<WorkerPool>) +
+                                                  4 * sizeof(std::mutex) +
+                                                  sizeof(std::vector<std::unique_ptr<WorkerPool>>) +
                                                   (is64bit ? 23 : 15),
               "New members detected in ExecutionEnvironment, please ensure that destruction sequence of objects is correct");
 
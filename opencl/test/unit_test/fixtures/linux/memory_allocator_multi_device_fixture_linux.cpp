@@ -19,7 +19,7 @@ void MemoryAllocatorMultiDeviceSystemSpecificFixture::SetUp(ExecutionEnvironment
 
 void MemoryAllocatorMultiDeviceSystemSpecificFixture::TearDown(ExecutionEnvironment &executionEnvironment) {
     auto memoryManager = static_cast<TestedDrmMemoryManager *>(executionEnvironment.memoryManager.get());
-    auto bufferObject = memoryManager->sharingBufferObjects.back();
+    auto bufferObject = memoryManager->sharingBufferObjects.begin()->second;
     memoryManager->eraseSharedBufferObject(bufferObject);
     delete bufferObject;
 }
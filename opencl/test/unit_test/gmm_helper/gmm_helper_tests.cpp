@@ -21,6 +21,7 @@
 #include "opencl/test/unit_test/fixtures/mock_execution_environment_gmm_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_gmm.h"
+#include "opencl/test/unit_test/mocks/mock_gmm_client_context.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
@@ -316,6 +317,56 @@ TEST_F(GmmTests, givenTilingModeSetToNonTiledWhenCreatingGmmThenLinearFlagIsSet)
     EXPECT_EQ(gmm->resourceParams.Flags.Info.TiledY, 0u);
 }
 
+TEST_F(GmmTests, givenCacheImageGmmLayoutsEnabledWhenCreatingImageGmmsWithSameParamsThenResourceInfoIsCopiedFromCachedOne) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CacheImageGmmLayouts.set(1);
+    cl_image_desc imgDesc{};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 4;
+    imgDesc.image_height = 4;
+    imgDesc.image_depth = 1;
+
+    auto clientContext = static_cast<MockGmmClientContext *>(getGmmClientContext());
+    clientContext->cachedImageResourceInfos.clear();
+
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto gmm = std::make_unique<Gmm>(clientContext, imgInfo, StorageInfo{});
+    auto imgSize = imgInfo.size;
+    auto imgRowPitch = imgInfo.rowPitch;
+    EXPECT_EQ(1u, clientContext->cachedImageResourceInfos.size());
+
+    auto imgInfo2 = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto gmm2 = std::make_unique<Gmm>(clientContext, imgInfo2, StorageInfo{});
+    EXPECT_EQ(1u, clientContext->cachedImageResourceInfos.size());
+    EXPECT_NE(gmm->gmmResourceInfo.get(), gmm2->gmmResourceInfo.get());
+    EXPECT_EQ(gmm->gmmResourceInfo->getSizeAllocation(), gmm2->gmmResourceInfo->getSizeAllocation());
+    EXPECT_EQ(imgSize, imgInfo2.size);
+    EXPECT_EQ(imgRowPitch, imgInfo2.rowPitch);
+
+    imgDesc.image_width = 8;
+    auto imgInfo3 = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto gmm3 = std::make_unique<Gmm>(clientContext, imgInfo3, StorageInfo{});
+    EXPECT_EQ(2u, clientContext->cachedImageResourceInfos.size());
+    EXPECT_NE(gmm->gmmResourceInfo->getSizeAllocation(), gmm3->gmmResourceInfo->getSizeAllocation());
+}
+
+TEST_F(GmmTests, givenCacheImageGmmLayoutsDisabledWhenCreatingImageGmmThenResourceInfoIsNotCached) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CacheImageGmmLayouts.set(0);
+    cl_image_desc imgDesc{};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 4;
+    imgDesc.image_height = 4;
+    imgDesc.image_depth = 1;
+
+    auto clientContext = static_cast<MockGmmClientContext *>(getGmmClientContext());
+    clientContext->cachedImageResourceInfos.clear();
+
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto gmm = std::make_unique<Gmm>(clientContext, imgInfo, StorageInfo{});
+    EXPECT_EQ(0u, clientContext->cachedImageResourceInfos.size());
+}
+
 TEST_F(GmmTests, givenZeroRowPitchWhenQueryImgFromBufferParamsThenCalculate) {
     MockGraphicsAllocation bufferAllocation(nullptr, 4096);
 
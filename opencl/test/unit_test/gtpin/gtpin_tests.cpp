@@ -2675,4 +2675,33 @@ HWTEST_F(GTPinTestsWithLocalMemory, givenGtPinCanUseSharedAllocationWhenGtPinBuf
     retVal = clReleaseContext(context);
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
+
+TEST_F(GTPinTests, givenBufferPoolingEnabledWhenBufferIsFreedThenItIsReusedForNextAllocationOfSameSize) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.GTPinPoolBuffers.set(1);
+    auto ctxt = (gtpin::context_handle_t)((cl_context)((Context *)pContext));
+
+    resource_handle_t resource = nullptr;
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinCreateBuffer(ctxt, 256, &resource));
+    ASSERT_NE(nullptr, resource);
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinFreeBuffer(ctxt, resource));
+
+    resource_handle_t reusedResource = nullptr;
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinCreateBuffer(ctxt, 256, &reusedResource));
+    EXPECT_EQ(resource, reusedResource);
+
+    resource_handle_t otherSizeResource = nullptr;
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinCreateBuffer(ctxt, 4096, &otherSizeResource));
+    EXPECT_NE(resource, otherSizeResource);
+
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinFreeBuffer(ctxt, reusedResource));
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinFreeBuffer(ctxt, otherSizeResource));
+    gtpinReleasePooledBuffers(ctxt);
+
+    DebugManager.flags.GTPinPoolBuffers.set(0);
+    resource_handle_t newResource = nullptr;
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinCreateBuffer(ctxt, 256, &newResource));
+    EXPECT_NE(nullptr, newResource);
+    EXPECT_EQ(GTPIN_DI_SUCCESS, gtpinFreeBuffer(ctxt, newResource));
+}
 } // namespace ULT
@@ -413,6 +413,78 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelWithFourBindingTabl
     }
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenIndirectDataReuseEnabledWhenIndirectStateIsEmittedAgainForUnchangedKernelThenPreviousIndirectDataIsReused) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIndirectDataReuse.set(1);
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+    auto &kernel = *mockKernelWithInternal->mockKernel;
+    const size_t localWorkSizes[3]{256, 1, 1};
+    auto isCcsUsed = EngineHelpers::isCcs(cmdQ.getGpgpuEngine().osContext->getEngineType());
+    auto kernelUsesLocalIds = HardwareCommandsHelper<FamilyType>::kernelUsesLocalIds(kernel);
+
+    auto sendIndirectState = [&](GPGPU_WALKER &walkerCmd) {
+        uint32_t interfaceDescriptorIndex = 0;
+        walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        HardwareCommandsHelper<FamilyType>::sendIndirectState(
+            commandStream, dsh, ioh, ssh, kernel,
+            kernel.getKernelStartOffset(true, kernelUsesLocalIds, isCcsUsed),
+            kernel.getKernelInfo().getMaxSimdSize(), localWorkSizes, 0, interfaceDescriptorIndex,
+            pDevice->getPreemptionMode(), &walkerCmd, nullptr, true, *pDevice);
+    };
+
+    GPGPU_WALKER firstWalker;
+    sendIndirectState(firstWalker);
+    auto usedIoh = ioh.getUsed();
+
+    GPGPU_WALKER secondWalker;
+    sendIndirectState(secondWalker);
+    EXPECT_EQ(usedIoh, ioh.getUsed());
+    EXPECT_EQ(firstWalker.getIndirectDataStartAddress(), secondWalker.getIndirectDataStartAddress());
+    EXPECT_EQ(firstWalker.getIndirectDataLength(), secondWalker.getIndirectDataLength());
+
+    kernel.getCrossThreadData()[0]++;
+    GPGPU_WALKER thirdWalker;
+    sendIndirectState(thirdWalker);
+    EXPECT_LT(usedIoh, ioh.getUsed());
+    EXPECT_NE(firstWalker.getIndirectDataStartAddress(), thirdWalker.getIndirectDataStartAddress());
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenIndirectDataReuseEnabledWhenIndirectHeapIsReplacedThenIndirectDataIsUploadedAgain) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIndirectDataReuse.set(1);
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+    auto &kernel = *mockKernelWithInternal->mockKernel;
+    const size_t localWorkSizes[3]{256, 1, 1};
+    auto isCcsUsed = EngineHelpers::isCcs(cmdQ.getGpgpuEngine().osContext->getEngineType());
+    auto kernelUsesLocalIds = HardwareCommandsHelper<FamilyType>::kernelUsesLocalIds(kernel);
+
+    for (auto i = 0u; i < 2; i++) {
+        uint32_t interfaceDescriptorIndex = 0;
+        GPGPU_WALKER walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        auto usedIoh = ioh.getUsed();
+        HardwareCommandsHelper<FamilyType>::sendIndirectState(
+            commandStream, dsh, ioh, ssh, kernel,
+            kernel.getKernelStartOffset(true, kernelUsesLocalIds, isCcsUsed),
+            kernel.getKernelInfo().getMaxSimdSize(), localWorkSizes, 0, interfaceDescriptorIndex,
+            pDevice->getPreemptionMode(), &walkerCmd, nullptr, true, *pDevice);
+        EXPECT_LT(usedIoh, ioh.getUsed());
+
+        ioh.replaceBuffer(ioh.getCpuBase(), ioh.getMaxAvailableSpace());
+    }
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelThatIsSchedulerWhenIndirectStateIsEmittedThenInterfaceDescriptorContainsZeroBindingTableEntryCount) {
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
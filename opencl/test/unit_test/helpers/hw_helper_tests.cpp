@@ -113,6 +113,15 @@ HWTEST_F(HwHelperTest, SetRenderSurfaceStateForBufferIsCalledThenSetL1CachePolic
     alignedFree(stateBuffer);
 }
 
+HWTEST_F(HwHelperTest, whenGettingHwHelperForFamilyThenSameHelperAsForRenderCoreFamilyIsReturned) {
+    auto &helper = HwHelper::get(renderCoreFamily);
+    auto &familyHelper = HwHelperHw<FamilyType>::get();
+
+    EXPECT_EQ(&helper, &familyHelper);
+    EXPECT_EQ(helper.useOnlyGlobalTimestamps(), familyHelper.useOnlyGlobalTimestamps());
+    EXPECT_EQ(helper.getRenderSurfaceStateSize(), familyHelper.getRenderSurfaceStateSize());
+}
+
 HWTEST_F(HwHelperTest, WhenGettingBindingTableStateSurfaceStatePointerThenCorrectPointerIsReturned) {
     using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
     BINDING_TABLE_STATE bindingTableState[4];
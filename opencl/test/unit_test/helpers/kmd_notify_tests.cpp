@@ -226,6 +226,40 @@ HWTEST_F(KmdNotifyTests, givenKmdNotifyDisabledWhenQueueHasPowerSavingModButTher
     cmdQ->waitUntilComplete(1, 0, 0, false);
 }
 
+HWTEST_F(KmdNotifyTests, givenQueueThrottlePolicyEnabledWhenHighThrottleQueueWaitsThenCompletionIsPolledWithoutKmdNotify) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableQueueThrottlePolicy.set(1);
+    auto csr = createMockCsr<FamilyType>();
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, 1u)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForFlushStamp(::testing::_)).Times(0);
+
+    cmdQ->throttle = QueueThrottle::HIGH;
+    EXPECT_TRUE(cmdQ->getThrottlePolicy().flushEverySubmission);
+    cmdQ->waitUntilComplete(1, 0, 1, false);
+}
+
+HWTEST_F(KmdNotifyTests, givenQueueThrottlePolicyDisabledWhenHighThrottleQueueWaitsThenKmdNotifyIsUsed) {
+    auto csr = createMockCsr<FamilyType>();
+    auto expectedDelay = device->getHardwareInfo().capabilityTable.kmdNotifyProperties.delayKmdNotifyMicroseconds;
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, expectedDelay, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+
+    cmdQ->throttle = QueueThrottle::HIGH;
+    EXPECT_FALSE(cmdQ->getThrottlePolicy().flushEverySubmission);
+    cmdQ->waitUntilComplete(1, 0, 1, false);
+}
+
+HWTEST_F(KmdNotifyTests, givenQueueThrottlePolicyEnabledWhenLowThrottleQueueWaitsThenPowerSavingModeIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableQueueThrottlePolicy.set(1);
+    overrideKmdNotifyParams(false, 3, false, 2, false, 9999999);
+    auto csr = createMockCsr<FamilyType>();
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 1, ::testing::_)).Times(1).WillOnce(::testing::Return(true));
+
+    cmdQ->throttle = QueueThrottle::LOW;
+    EXPECT_FALSE(cmdQ->getThrottlePolicy().flushEverySubmission);
+    cmdQ->waitUntilComplete(1, 0, 1, false);
+}
+
 HWTEST_F(KmdNotifyTests, givenQuickSleepRequestWhenItsSporadicWaitOptimizationIsDisabledThenDontOverrideQuickSleepRequest) {
     overrideKmdNotifyParams(true, 3, true, 2, false, 0);
     auto csr = createMockCsr<FamilyType>();
@@ -419,3 +453,69 @@ TEST_F(KmdNotifyTests, givenEnabledKmdNotifyMechanismWhenPowerSavingModeIsSetAnd
     EXPECT_FALSE(timeoutEnabled);
     EXPECT_EQ(0, timeout);
 }
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenNotEnoughWaitsRegisteredThenSpinBudgetIsReturned) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    DebugManager.flags.AdaptiveKmdNotifySpinBudgetMicroseconds.set(500);
+    hwInfo->capabilityTable.kmdNotifyProperties.enableKmdNotify = false;
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    helper.registerWaitCompletion(helper.getMicrosecondsSinceEpoch() - 10000, false);
+
+    int64_t timeout = 0;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false, false);
+    EXPECT_TRUE(timeoutEnabled);
+    EXPECT_EQ(500, timeout);
+
+    auto statistics = helper.getWaitStatistics();
+    EXPECT_EQ(1u, statistics.waits);
+    EXPECT_EQ(0u, statistics.waitsCompletedWhileSpinning);
+    EXPECT_LE(10000, statistics.totalWaitMicroseconds);
+    EXPECT_EQ(500, statistics.lastTimeoutMicroseconds);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenWaitsExceedSpinBudgetThenZeroTimeoutIsReturned) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    DebugManager.flags.AdaptiveKmdNotifySpinBudgetMicroseconds.set(500);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::minimumWaitsToApplyAdaptiveTimeout; i++) {
+        helper.registerWaitCompletion(helper.getMicrosecondsSinceEpoch() - 10000, false);
+    }
+
+    int64_t timeout = -1;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false, false);
+    EXPECT_TRUE(timeoutEnabled);
+    EXPECT_EQ(0, timeout);
+    EXPECT_LE(10000, helper.getWaitStatistics().averageWaitMicroseconds);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenWaitsAreShortThenTimeoutFollowsAverageWait) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    DebugManager.flags.AdaptiveKmdNotifySpinBudgetMicroseconds.set(1000000);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::minimumWaitsToApplyAdaptiveTimeout; i++) {
+        helper.registerWaitCompletion(helper.getMicrosecondsSinceEpoch() - 100, true);
+    }
+
+    int64_t timeout = 0;
+    helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false, false);
+
+    auto statistics = helper.getWaitStatistics();
+    EXPECT_EQ(KmdNotifyConstants::minimumWaitsToApplyAdaptiveTimeout, statistics.waitsCompletedWhileSpinning);
+    EXPECT_LE(100, statistics.averageWaitMicroseconds);
+    EXPECT_EQ(statistics.averageWaitMicroseconds + statistics.averageWaitMicroseconds / 2 + 1, timeout);
+    EXPECT_GT(1000000, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyDisabledWhenWaitIsRegisteredThenStatisticsAreNotUpdated) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    EXPECT_EQ(0, helper.startWaitMeasurement());
+    helper.registerWaitCompletion(0, true);
+    EXPECT_EQ(0u, helper.getWaitStatistics().waits);
+}
@@ -9,6 +9,7 @@
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 
+#include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/helpers/memory_properties_helpers.h"
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
@@ -309,6 +310,36 @@ TEST_F(MemoryPropertiesHelperTests, givenDifferentParametersWhenCallingFillCache
     }
 }
 
+TEST_F(MemoryPropertiesHelperTests, givenCacheRegionPropertyWhenParsingMemoryPropertiesThenRegionIsAcceptedOnlyWhenSupported) {
+    cl_mem_properties_intel defaultRegionProperties[] = {CL_MEM_CACHE_REGION_INTEL, CL_MEM_CACHE_REGION_DEFAULT_INTEL, 0};
+    EXPECT_TRUE(MemoryPropertiesHelper::parseMemoryProperties(defaultRegionProperties, memoryProperties, flags, flagsIntel, allocflags,
+                                                              MemoryPropertiesHelper::ObjType::UNKNOWN, context));
+    EXPECT_EQ(0u, MemoryPropertiesHelper::getCacheRegion(memoryProperties));
+
+    cl_mem_properties_intel invalidRegionProperties[] = {CL_MEM_CACHE_REGION_INTEL, CL_MEM_CACHE_REGION_RESERVED_INTEL + 1, 0};
+    EXPECT_FALSE(MemoryPropertiesHelper::parseMemoryProperties(invalidRegionProperties, memoryProperties, flags, flagsIntel, allocflags,
+                                                               MemoryPropertiesHelper::ObjType::UNKNOWN, context));
+
+    auto &hwInfo = context.getDevice(0)->getDevice().getHardwareInfo();
+    bool supported = MemoryPropertiesHelper::isCacheRegionSupported(hwInfo);
+    EXPECT_EQ(HwHelper::get(hwInfo.platform.eRenderCoreFamily).getNumCacheRegions(hwInfo) > 1, supported);
+
+    cl_mem_properties_intel reservedRegionProperties[] = {CL_MEM_CACHE_REGION_INTEL, CL_MEM_CACHE_REGION_RESERVED_INTEL, 0};
+    EXPECT_EQ(supported, MemoryPropertiesHelper::parseMemoryProperties(reservedRegionProperties, memoryProperties, flags, flagsIntel, allocflags,
+                                                                       MemoryPropertiesHelper::ObjType::BUFFER, context));
+    if (supported) {
+        EXPECT_EQ(1u, MemoryPropertiesHelper::getCacheRegion(memoryProperties));
+    }
+}
+
+TEST_F(MemoryPropertiesHelperTests, givenCacheRegionInMemoryPropertiesWhenFillingPoliciesThenRegionIsSetInAllocationProperties) {
+    AllocationProperties allocationProperties{mockRootDeviceIndex, 0, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield};
+    memoryProperties.cacheRegion = 1u;
+
+    MemoryPropertiesHelper::fillPoliciesInProperties(allocationProperties, memoryProperties, *defaultHwInfo);
+    EXPECT_EQ(1u, allocationProperties.cacheRegion);
+}
+
 TEST_F(MemoryPropertiesHelperTests, givenMemFlagsWithFlagsAndPropertiesWhenParsingMemoryPropertiesThenTheyAreCorrectlyParsed) {
     struct TestInput {
         cl_mem_flags flagsParameter;
@@ -156,6 +156,45 @@ TEST(KernelOperationDestruction, givenKernelOperationWhenItIsDestructedThenAllAl
     EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation3));
 }
 
+TEST(KernelOperationPooling, givenBlockedCommandsDataReleasedToQueueWhenObtainingNextOneThenSameOperationIsReusedAndAllocationsAreStoredForReuse) {
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    MockCommandQueue cmdQ(nullptr, device.get(), nullptr);
+    auto &csr = cmdQ.getGpgpuCommandStreamReceiver();
+    auto &allocationsForReuse = csr.getInternalAllocationStorage()->getAllocationsForReuse();
+
+    auto kernelOperation = cmdQ.obtainBlockedCommandsData();
+    EXPECT_EQ(csr.getInternalAllocationStorage(), kernelOperation->getAllocationStorage());
+    csr.ensureCommandBufferAllocation(*kernelOperation->commandStream, 1, 0);
+    IndirectHeap *ih1 = nullptr, *ih2 = nullptr, *ih3 = nullptr;
+    cmdQ.allocateHeapMemory(IndirectHeap::DYNAMIC_STATE, 1, ih1);
+    cmdQ.allocateHeapMemory(IndirectHeap::INDIRECT_OBJECT, 1, ih2);
+    cmdQ.allocateHeapMemory(IndirectHeap::SURFACE_STATE, 1, ih3);
+    kernelOperation->setHeaps(ih1, ih2, ih3);
+    kernelOperation->blitEnqueue = true;
+
+    auto &cmdStreamAllocation = *kernelOperation->commandStream->getGraphicsAllocation();
+    auto &heapAllocation = *ih1->getGraphicsAllocation();
+    auto kernelOperationPtr = kernelOperation.get();
+    auto commandStreamPtr = kernelOperation->commandStream.get();
+
+    cmdQ.releaseBlockedCommandsData(std::move(kernelOperation));
+    EXPECT_TRUE(allocationsForReuse.peekContains(cmdStreamAllocation));
+    EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation));
+
+    auto reusedKernelOperation = cmdQ.obtainBlockedCommandsData();
+    EXPECT_EQ(kernelOperationPtr, reusedKernelOperation.get());
+    EXPECT_EQ(commandStreamPtr, reusedKernelOperation->commandStream.get());
+    EXPECT_EQ(nullptr, reusedKernelOperation->commandStream->getGraphicsAllocation());
+    EXPECT_EQ(0u, reusedKernelOperation->commandStream->getMaxAvailableSpace());
+    EXPECT_EQ(nullptr, reusedKernelOperation->dsh.get());
+    EXPECT_EQ(nullptr, reusedKernelOperation->ioh.get());
+    EXPECT_EQ(nullptr, reusedKernelOperation->ssh.get());
+    EXPECT_FALSE(reusedKernelOperation->blitEnqueue);
+
+    auto newKernelOperation = cmdQ.obtainBlockedCommandsData();
+    EXPECT_NE(kernelOperationPtr, newKernelOperation.get());
+}
+
 template <typename GfxFamily>
 class MockCsr1 : public CommandStreamReceiverHw<GfxFamily> {
   public:
@@ -270,6 +270,43 @@ TEST_F(TimestampPacketSimpleTests, givenTimestampPacketContainerWhenMovedThenMov
     EXPECT_EQ(1u, node1.returnCalls);
 }
 
+TEST_F(TimestampPacketSimpleTests, givenMoreNodesThanPreallocatedWhenSwappingAndResolvingContainersThenAllNodesAreKeptAndReturned) {
+    struct MockTagNode : public TagNode<TimestampPackets<uint32_t>> {
+        void returnTag() override {
+            returnCalls++;
+        }
+        uint32_t returnCalls = 0;
+    };
+
+    constexpr size_t nodesCount = TimestampPacketContainer::preallocatedNodesCount + 1;
+    MockTagNode nodes[nodesCount];
+
+    {
+        TimestampPacketContainer inlineContainer;
+        TimestampPacketContainer dynamicContainer;
+        inlineContainer.add(&nodes[0]);
+        for (size_t i = 1; i < nodesCount; i++) {
+            dynamicContainer.add(&nodes[i]);
+        }
+
+        inlineContainer.swapNodes(dynamicContainer);
+        EXPECT_EQ(nodesCount - 1, inlineContainer.peekNodes().size());
+        ASSERT_EQ(1u, dynamicContainer.peekNodes().size());
+        EXPECT_EQ(&nodes[0], dynamicContainer.peekNodes()[0]);
+
+        dynamicContainer.assignAndIncrementNodesRefCounts(inlineContainer);
+        EXPECT_EQ(nodesCount, dynamicContainer.peekNodes().size());
+
+        dynamicContainer.resolveDependencies(true);
+        EXPECT_EQ(0u, dynamicContainer.peekNodes().size());
+        EXPECT_EQ(1u, nodes[0].returnCalls);
+    }
+    EXPECT_EQ(1u, nodes[0].returnCalls);
+    for (size_t i = 1; i < nodesCount; i++) {
+        EXPECT_EQ(2u, nodes[i].returnCalls);
+    }
+}
+
 TEST_F(TimestampPacketSimpleTests, whenIsCompletedIsCalledThenItReturnsProperTimestampPacketStatus) {
     MockTimestampPacketStorage timestampPacketStorage;
     auto &packet = timestampPacketStorage.packets[0];
@@ -563,6 +600,35 @@ HWTEST_F(TimestampPacketTests, givenTimestampPacketWriteEnabledWhenEstimatingStr
     EXPECT_EQ(sizeWithEnabled, extendedSize);
 }
 
+HWTEST_F(TimestampPacketTests, givenEventsFromInOrderQueueWhenComputingCsrDepsThenOnlyLatestEventDependencyIsAdded) {
+    device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+    auto allocator = device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
+    MockTimestampPacketContainer timestamp1(*allocator, 1);
+    MockTimestampPacketContainer timestamp2(*allocator, 1);
+    MockTimestampPacketContainer timestamp3(*allocator, 1);
+
+    Event event1(mockCmdQ, 0, 0, 1);
+    event1.addTimestampPacketNodes(timestamp1);
+    Event event2(mockCmdQ, 0, 0, 3);
+    event2.addTimestampPacketNodes(timestamp2);
+    Event event3(mockCmdQ, 0, 0, 2);
+    event3.addTimestampPacketNodes(timestamp3);
+
+    cl_event waitlist[] = {&event1, &event2, &event3};
+    EventsRequest eventsRequest(3, waitlist, nullptr);
+    CsrDependencies csrDeps;
+    eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, device->getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
+
+    ASSERT_EQ(1u, csrDeps.timestampPacketContainer.size());
+    EXPECT_EQ(timestamp2.peekNodes()[0], csrDeps.timestampPacketContainer[0]->peekNodes()[0]);
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AUBDumpSubCaptureMode.set(1);
+    CsrDependencies csrDepsWithoutPruning;
+    eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDepsWithoutPruning, device->getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
+    EXPECT_EQ(3u, csrDepsWithoutPruning.timestampPacketContainer.size());
+}
+
 HWTEST_F(TimestampPacketTests, givenEventsRequestWithEventsWithoutTimestampsWhenComputeCsrDepsThanDoNotAddthemToCsrDeps) {
     device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = false;
 
@@ -741,15 +807,15 @@ HWTEST_F(TimestampPacketTests, givenTimestampPacketWriteEnabledWhenEnqueueingThe
 
     // obtain first node for cmdQ and event1
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event1);
-    auto node1 = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto node1 = cmdQ->timestampPacketContainer->peekNodes()[0];
     EXPECT_NE(nullptr, node1);
-    EXPECT_EQ(node1, cmdQ->timestampPacketContainer->peekNodes().at(0));
+    EXPECT_EQ(node1, cmdQ->timestampPacketContainer->peekNodes()[0]);
 
     // obtain new node for cmdQ and event2
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event2);
-    auto node2 = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto node2 = cmdQ->timestampPacketContainer->peekNodes()[0];
     EXPECT_NE(nullptr, node2);
-    EXPECT_EQ(node2, cmdQ->timestampPacketContainer->peekNodes().at(0));
+    EXPECT_EQ(node2, cmdQ->timestampPacketContainer->peekNodes()[0]);
     EXPECT_EQ(0u, mockTagAllocator->returnedToFreePoolNodes.size()); // nothing returned. event1 owns previous node
     EXPECT_EQ(1u, mockTagAllocator->releaseReferenceNodes.size());   // cmdQ released first node
     EXPECT_EQ(node1, mockTagAllocator->releaseReferenceNodes.at(0));
@@ -1404,13 +1470,13 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingNonBlockedT
     auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context, device.get(), nullptr);
     TimestampPacketContainer previousNodes;
     cmdQ->obtainNewTimestampPacketNodes(1, previousNodes, false, false);
-    auto firstNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto firstNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     csr.storeMakeResidentAllocations = true;
     csr.timestampPacketWriteEnabled = true;
 
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    auto secondNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto secondNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     EXPECT_NE(firstNode->getBaseGraphicsAllocation(), secondNode->getBaseGraphicsAllocation());
     EXPECT_TRUE(csr.isMadeResident(firstNode->getBaseGraphicsAllocation(), csr.taskCount));
@@ -1426,7 +1492,7 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingBlockedThen
     auto cmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(context, device.get(), nullptr));
     TimestampPacketContainer previousNodes;
     cmdQ->obtainNewTimestampPacketNodes(1, previousNodes, false, false);
-    auto firstNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto firstNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     csr.storeMakeResidentAllocations = true;
     csr.timestampPacketWriteEnabled = true;
@@ -1434,7 +1500,7 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingBlockedThen
     UserEvent userEvent;
     cl_event clEvent = &userEvent;
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 1, &clEvent, nullptr);
-    auto secondNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto secondNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     EXPECT_NE(firstNode->getBaseGraphicsAllocation(), secondNode->getBaseGraphicsAllocation());
     EXPECT_FALSE(csr.isMadeResident(firstNode->getBaseGraphicsAllocation(), csr.taskCount));
@@ -1449,7 +1515,7 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingThenDontKee
     MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), nullptr);
     TimestampPacketContainer previousNodes;
     cmdQ.obtainNewTimestampPacketNodes(1, previousNodes, false, false);
-    auto firstNode = cmdQ.timestampPacketContainer->peekNodes().at(0);
+    auto firstNode = cmdQ.timestampPacketContainer->peekNodes()[0];
     setTagToReadyState(firstNode);
 
     cmdQ.enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
@@ -1481,8 +1547,8 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingThenKeepDep
     MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), nullptr);
     TimestampPacketContainer previousNodes;
     cmdQ.obtainNewTimestampPacketNodes(2, previousNodes, false, false);
-    firstNode.add(cmdQ.timestampPacketContainer->peekNodes().at(0));
-    firstNode.add(cmdQ.timestampPacketContainer->peekNodes().at(1));
+    firstNode.add(cmdQ.timestampPacketContainer->peekNodes()[0]);
+    firstNode.add(cmdQ.timestampPacketContainer->peekNodes()[1]);
     auto firstTag0 = firstNode.getNode(0);
     auto firstTag1 = firstNode.getNode(1);
 
@@ -1569,6 +1635,56 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingWithOmitTim
     EXPECT_EQ(0u, atomicsFound);
 }
 
+HWTEST_F(TimestampPacketTests, givenInOrderDependencyElisionEnabledWhenEnqueueingToInOrderQueueThenDontProgramSemaphoreOnPreviousNodeFromSameCsr) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = true;
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableInOrderDependencyElision.set(1);
+
+    MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), nullptr);
+    TimestampPacketContainer previousNodes;
+    cmdQ.obtainNewTimestampPacketNodes(1, previousNodes, false, false);
+
+    cmdQ.enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(*cmdQ.commandStream, 0);
+
+    uint32_t semaphoresFound = 0;
+    uint32_t atomicsFound = 0;
+    for (auto it = hwParser.cmdList.begin(); it != hwParser.cmdList.end(); it++) {
+        if (genCmdCast<typename FamilyType::MI_SEMAPHORE_WAIT *>(*it)) {
+            semaphoresFound++;
+        }
+        if (genCmdCast<typename FamilyType::MI_ATOMIC *>(*it)) {
+            atomicsFound++;
+        }
+    }
+    uint32_t expectedSemaphoresCount = (UnitTestHelper<FamilyType>::isAdditionalMiSemaphoreWaitRequired(device->getHardwareInfo()) ? 2 : 0);
+    EXPECT_EQ(expectedSemaphoresCount, semaphoresFound);
+    EXPECT_EQ(0u, atomicsFound);
+    EXPECT_EQ(1u, cmdQ.peekElidedTimestampPacketDependencies());
+    EXPECT_FALSE(csr.isStallingPipeControlOnNextFlushRequired());
+}
+
+HWTEST_F(TimestampPacketTests, givenInOrderDependencyElisionEnabledWhenEnqueueingToOoqThenDependenciesAreNotElided) {
+    device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableInOrderDependencyElision.set(1);
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), properties);
+    TimestampPacketContainer previousNodes;
+    cmdQ.obtainNewTimestampPacketNodes(1, previousNodes, false, false);
+
+    cmdQ.enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+
+    EXPECT_EQ(0u, cmdQ.peekElidedTimestampPacketDependencies());
+}
+
 HWTEST_F(TimestampPacketTests, givenEventsWaitlistFromDifferentDevicesWhenEnqueueingThenMakeAllTimestampsResident) {
     TagAllocator<TimestampPackets<uint32_t>> tagAllocator(device->getRootDeviceIndex(), executionEnvironment->memoryManager.get(), 1, 1,
                                                           sizeof(TimestampPackets<uint32_t>), false, device->getDeviceBitfield());
@@ -1651,7 +1767,7 @@ HWTEST_F(TimestampPacketTests, givenTimestampPacketWhenEnqueueingNonBlockedThenM
     MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), nullptr);
 
     cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    auto timestampPacketNode = cmdQ.timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ.timestampPacketContainer->peekNodes()[0];
 
     EXPECT_TRUE(csr.isMadeResident(timestampPacketNode->getBaseGraphicsAllocation(), csr.taskCount));
 }
@@ -1670,7 +1786,7 @@ HWTEST_F(TimestampPacketTests, givenTimestampPacketWhenEnqueueingBlockedThenMake
     cl_event clEvent = &userEvent;
 
     cmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 1, &clEvent, nullptr);
-    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     EXPECT_FALSE(csr.isMadeResident(timestampPacketNode->getBaseGraphicsAllocation(), csr.taskCount));
     userEvent.setStatus(CL_COMPLETE);
@@ -1738,14 +1854,14 @@ HWTEST_F(TimestampPacketTests, givenWaitlistAndOutputEventWhenEnqueueingWithoutK
 
     auto outEvent = castToObject<Event>(clOutEvent);
 
-    EXPECT_EQ(cmdQ->timestampPacketContainer->peekNodes().at(0), cmdQNodes.peekNodes().at(0)); // no new nodes obtained
+    EXPECT_EQ(cmdQ->timestampPacketContainer->peekNodes()[0], cmdQNodes.peekNodes()[0]); // no new nodes obtained
     EXPECT_EQ(1u, cmdQ->timestampPacketContainer->peekNodes().size());
 
     auto &eventsNodes = outEvent->getTimestampPacketNodes()->peekNodes();
     EXPECT_EQ(numEventsWithContainer + 1, eventsNodes.size()); // numEventsWithContainer + command queue
-    EXPECT_EQ(cmdQNodes.peekNodes().at(0), eventsNodes.at(0));
-    EXPECT_EQ(event0.getTimestampPacketNodes()->peekNodes().at(0), eventsNodes.at(1));
-    EXPECT_EQ(event1.getTimestampPacketNodes()->peekNodes().at(0), eventsNodes.at(2));
+    EXPECT_EQ(cmdQNodes.peekNodes()[0], eventsNodes.at(0));
+    EXPECT_EQ(event0.getTimestampPacketNodes()->peekNodes()[0], eventsNodes.at(1));
+    EXPECT_EQ(event1.getTimestampPacketNodes()->peekNodes()[0], eventsNodes.at(2));
 
     clReleaseEvent(clOutEvent);
     userEvent.setStatus(CL_COMPLETE);
@@ -1935,7 +2051,7 @@ HWTEST_F(TimestampPacketTests, whenEnqueueingBarrierThenRequestPipeControlOnCsrF
 
     cmdQ.enqueueBarrierWithWaitList(0, nullptr, nullptr);
 
-    EXPECT_EQ(cmdQ.timestampPacketContainer->peekNodes().at(0), cmdQNodes.peekNodes().at(0)); // dont obtain new node
+    EXPECT_EQ(cmdQ.timestampPacketContainer->peekNodes()[0], cmdQNodes.peekNodes()[0]); // dont obtain new node
     EXPECT_EQ(1u, cmdQ.timestampPacketContainer->peekNodes().size());
 
     EXPECT_TRUE(csr.stallingPipeControlOnNextFlushRequired);
@@ -2072,8 +2188,8 @@ HWTEST_F(TimestampPacketTests, givenKernelWhichRequiresFlushWhenEnqueueingKernel
     kernel->mockKernel->svmAllocationsRequireCacheFlush = true;
     // obtain first node for cmdQ and event1
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    auto node1 = cmdQ->timestampPacketContainer->peekNodes().at(0);
-    auto node2 = cmdQ->timestampPacketContainer->peekNodes().at(1);
+    auto node1 = cmdQ->timestampPacketContainer->peekNodes()[0];
+    auto node2 = cmdQ->timestampPacketContainer->peekNodes()[1];
     auto size = cmdQ->timestampPacketContainer->peekNodes().size();
     EXPECT_EQ(size, 2u);
     EXPECT_NE(nullptr, node1);
@@ -454,6 +454,46 @@ TEST_F(KernelArgBufferTest, givenKernelExecInfoWithIndirectStatelessAccessWhenHa
     svmAllocationsManager->freeSVMAlloc(unifiedHostMemoryAllocation);
 }
 
+TEST_F(KernelArgBufferTest, givenBufferAlreadySetAsKernelArgWhenSettingSameBufferAgainThenArgumentIsNotPatchedAgain) {
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+    auto pKernelArg = reinterpret_cast<void **>(pKernel->getCrossThreadData() + pKernelInfo->argAsPtr(0).stateless);
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+
+    *pKernelArg = nullptr;
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+    EXPECT_EQ(nullptr, *pKernelArg);
+}
+
+TEST_F(KernelArgBufferTest, givenBufferAlreadySetAsKernelArgWhenBufferGenerationChangesThenArgumentIsPatchedAgain) {
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+    auto pKernelArg = reinterpret_cast<void **>(pKernel->getCrossThreadData() + pKernelInfo->argAsPtr(0).stateless);
+
+    *pKernelArg = nullptr;
+    buffer.generation++;
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+}
+
+TEST_F(KernelArgBufferTest, givenAddPatchInfoCommentsForAUBDumpWhenSettingSameBufferAgainThenArgumentIsPatchedAgain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AddPatchInfoCommentsForAUBDump.set(true);
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+    auto pKernelArg = reinterpret_cast<void **>(pKernel->getCrossThreadData() + pKernelInfo->argAsPtr(0).stateless);
+
+    *pKernelArg = nullptr;
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+}
+
 TEST_F(KernelArgBufferTest, whenSettingAuxTranslationRequiredThenIsAuxTranslationRequiredReturnsCorrectValue) {
     for (auto auxTranslationRequired : {false, true}) {
         pKernel->setAuxTranslationRequired(auxTranslationRequired);
@@ -11,6 +11,7 @@
 
 #include "opencl/source/helpers/memory_properties_helpers.h"
 #include "opencl/source/kernel/kernel.h"
+#include "opencl/test/unit_test/fixtures/image_fixture.h"
 #include "opencl/test/unit_test/fixtures/kernel_arg_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_allocation_properties.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
@@ -270,6 +271,23 @@ TEST_F(KernelImageArgTest, givenKernelWithSettedArgWhenUnSetCalledThenArgIsUnset
     EXPECT_FALSE(pKernel->getKernelArguments()[0].isPatched);
 }
 
+TEST_F(KernelImageArgTest, givenImageArgSetWhenSameImageIsSetAgainThenSurfaceStateIsNotEncodedAgain) {
+    cl_mem memObj = image.get();
+    auto surfaceState = ptrOffset(pKernel->getSurfaceStateHeap(), pKernelInfo->argAsImg(0).bindful);
+    constexpr uint32_t pattern = 0xdeadbeef;
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(memObj), &memObj));
+    memcpy_s(surfaceState, sizeof(pattern), &pattern, sizeof(pattern));
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(memObj), &memObj));
+    EXPECT_EQ(0, memcmp(surfaceState, &pattern, sizeof(pattern)));
+
+    std::unique_ptr<Image> otherImage(Image2dHelper<>::create(context.get()));
+    memObj = otherImage.get();
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(memObj), &memObj));
+    EXPECT_NE(0, memcmp(surfaceState, &pattern, sizeof(pattern)));
+}
+
 TEST_F(KernelImageArgTest, givenNullKernelWhenClSetKernelArgCalledThenInvalidKernelCodeReturned) {
     cl_mem memObj = NULL;
     retVal = clSetKernelArg(
@@ -1996,6 +1996,51 @@ HWTEST_F(KernelResidencyTest, givenEnableFullKernelTuningWhenPerformTunningThenK
     EXPECT_EQ(result->second.singleSubdevicePrefered, mockKernel.mockKernel->singleSubdevicePreferedInCurrentEnqueue);
 }
 
+HWTEST_F(KernelResidencyTest, givenLocalWorkSizeTuningWhenCandidatesAreLaunchedThenFastestLocalWorkSizeIsSelected) {
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 256u;
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.simdSize = 8u;
+
+    Vec3<size_t> gws{256, 1, 1};
+    Vec3<size_t> defaultLws{64, 1, 1};
+    Vec3<size_t> expectedCandidates[] = {{64, 1, 1}, {128, 1, 1}, {32, 1, 1}};
+    std::vector<std::unique_ptr<MockTimestampPacketContainer>> containers;
+
+    for (auto &expectedCandidate : expectedCandidates) {
+        auto lws = mockKernel.mockKernel->getTunedLocalWorkSize(gws, defaultLws);
+        EXPECT_EQ(expectedCandidate, lws);
+
+        containers.push_back(std::make_unique<MockTimestampPacketContainer>(*commandStreamReceiver.getTimestampPacketAllocator(), 1));
+        mockKernel.mockKernel->performLocalWorkSizeTuning(gws, lws, containers.back().get());
+    }
+    EXPECT_EQ(defaultLws, mockKernel.mockKernel->getTunedLocalWorkSize(gws, defaultLws));
+
+    uint32_t durations[] = {8, 4, 6};
+    for (size_t i = 0; i < containers.size(); i++) {
+        uint32_t data[4] = {2, 2, 2 + durations[i], 2 + durations[i]};
+        containers[i]->getNode(0u)->assignDataToAllTimestamps(0, data);
+    }
+
+    Vec3<size_t> fastestLws{128, 1, 1};
+    EXPECT_EQ(fastestLws, mockKernel.mockKernel->getTunedLocalWorkSize(gws, defaultLws));
+    EXPECT_EQ(fastestLws, mockKernel.mockKernel->getTunedLocalWorkSize(gws, defaultLws));
+}
+
+HWTEST_F(KernelResidencyTest, givenLocalWorkSizeTuningWithoutTimestampsWhenCandidateIsLaunchedThenDefaultLocalWorkSizeIsKept) {
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 256u;
+
+    Vec3<size_t> gws{256, 1, 1};
+    Vec3<size_t> defaultLws{64, 1, 1};
+
+    auto lws = mockKernel.mockKernel->getTunedLocalWorkSize(gws, defaultLws);
+    mockKernel.mockKernel->performLocalWorkSizeTuning(gws, lws, nullptr);
+
+    EXPECT_EQ(defaultLws, mockKernel.mockKernel->getTunedLocalWorkSize(gws, defaultLws));
+    EXPECT_EQ(defaultLws, mockKernel.mockKernel->getTunedLocalWorkSize(gws, defaultLws));
+}
+
 HWTEST_F(KernelResidencyTest, givenSimpleKernelTunningAndNoAtomicsWhenPerformTunningThenSingleSubdeviceIsPreferred) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.EnableKernelTunning.set(1u);
@@ -3162,6 +3207,58 @@ TEST_F(KernelMultiRootDeviceTest, givenKernelWithPrivateSurfaceWhenInitializeThe
     }
 }
 
+TEST_F(KernelMultiRootDeviceTest, givenSplitAcrossRootDevicesWhenCheckingIfKernelCanBeSplitThenOnlyEnabledKernelWithValidRangeIsSplit) {
+    auto pKernelInfo = std::make_unique<MockKernelInfo>();
+    pKernelInfo->kernelDescriptor.kernelAttributes.simdSize = 1;
+
+    KernelInfoContainer kernelInfos;
+    kernelInfos.resize(deviceFactory->rootDevices.size());
+    for (auto &rootDeviceIndex : context->getRootDeviceIndices()) {
+        kernelInfos[rootDeviceIndex] = pKernelInfo.get();
+    }
+
+    MockProgram program(context.get(), false, context->getDevices());
+    int32_t retVal = CL_INVALID_VALUE;
+    auto pMultiDeviceKernel = std::unique_ptr<MultiDeviceKernel>(MultiDeviceKernel::create<MockKernel>(&program, kernelInfos, &retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    MockCommandQueue commandQueue(context.get(), device1, nullptr);
+    size_t globalWorkSize[3] = {1024, 1, 1};
+    EXPECT_FALSE(pMultiDeviceKernel->canSplitAcrossRootDevices(commandQueue, 1, globalWorkSize));
+
+    cl_bool split = CL_TRUE;
+    EXPECT_EQ(CL_SUCCESS, clSetKernelExecInfo(pMultiDeviceKernel.get(), CL_KERNEL_EXEC_INFO_SPLIT_ACROSS_ROOT_DEVICES_INTEL, sizeof(split), &split));
+    EXPECT_TRUE(pMultiDeviceKernel->isSplitAcrossRootDevicesEnabled());
+    EXPECT_TRUE(pMultiDeviceKernel->canSplitAcrossRootDevices(commandQueue, 1, globalWorkSize));
+
+    globalWorkSize[0] = 0;
+    EXPECT_FALSE(pMultiDeviceKernel->canSplitAcrossRootDevices(commandQueue, 1, globalWorkSize));
+
+    EXPECT_EQ(CL_INVALID_VALUE, clSetKernelExecInfo(pMultiDeviceKernel.get(), CL_KERNEL_EXEC_INFO_SPLIT_ACROSS_ROOT_DEVICES_INTEL, sizeof(split), nullptr));
+}
+
+TEST(MultiDeviceKernelSplitTest, givenWeightsWhenPartitioningRangeThenPartitionsAreProportionalAndAlignedToGranularity) {
+    StackVec<uint64_t, 4> weights;
+    weights.push_back(3);
+    weights.push_back(1);
+    StackVec<size_t, 4> partitionSizes;
+
+    MultiDeviceKernel::partitionRange(1024, 64, weights, partitionSizes);
+    ASSERT_EQ(2u, partitionSizes.size());
+    EXPECT_EQ(768u, partitionSizes[0]);
+    EXPECT_EQ(256u, partitionSizes[1]);
+
+    MultiDeviceKernel::partitionRange(1000, 64, weights, partitionSizes);
+    ASSERT_EQ(2u, partitionSizes.size());
+    EXPECT_EQ(704u, partitionSizes[0]);
+    EXPECT_EQ(296u, partitionSizes[1]);
+
+    MultiDeviceKernel::partitionRange(64, 64, weights, partitionSizes);
+    ASSERT_EQ(2u, partitionSizes.size());
+    EXPECT_EQ(0u, partitionSizes[0]);
+    EXPECT_EQ(64u, partitionSizes[1]);
+}
+
 TEST(KernelCreateTest, whenInitFailedThenReturnNull) {
     struct MockProgram {
         ClDeviceVector getDevices() {
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/kernel/kernel_tuning_database.h"
+#include "opencl/test/unit_test/fixtures/cl_device_fixture.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "opencl/test/unit_test/mocks/mock_timestamp_container.h"
+#include "test.h"
+
+#include <cstdio>
+
+using namespace NEO;
+
+struct KernelTuningDatabaseTest : public Test<ClDeviceFixture> {
+    void TearDown() override {
+        std::remove(KernelTuningDatabase(".", *defaultHwInfo, numSubDevices).getFileName().c_str());
+        Test<ClDeviceFixture>::TearDown();
+    }
+
+    const uint32_t numSubDevices = 2u;
+    const uint64_t isaHash = 0x1234u;
+    Vec3<size_t> gws{64, 1, 1};
+    Vec3<size_t> lws{16, 1, 1};
+    Vec3<size_t> offsets{0, 0, 0};
+};
+
+TEST_F(KernelTuningDatabaseTest, givenStoredPreferenceWhenNewDatabaseIsLoadedThenPreferenceIsFound) {
+    KernelTuningDatabase database(".", *defaultHwInfo, numSubDevices);
+    database.storeSingleSubdevicePreference(isaHash, gws, lws, offsets, true);
+    database.storeSingleSubdevicePreference(isaHash, gws, gws, offsets, false);
+
+    KernelTuningDatabase loadedDatabase(".", *defaultHwInfo, numSubDevices);
+    loadedDatabase.load();
+    EXPECT_EQ(2u, loadedDatabase.getEntriesCount());
+
+    bool singleSubdevicePrefered = false;
+    EXPECT_TRUE(loadedDatabase.findSingleSubdevicePreference(isaHash, gws, lws, offsets, singleSubdevicePrefered));
+    EXPECT_TRUE(singleSubdevicePrefered);
+    EXPECT_TRUE(loadedDatabase.findSingleSubdevicePreference(isaHash, gws, gws, offsets, singleSubdevicePrefered));
+    EXPECT_FALSE(singleSubdevicePrefered);
+    EXPECT_FALSE(loadedDatabase.findSingleSubdevicePreference(isaHash + 1, gws, lws, offsets, singleSubdevicePrefered));
+}
+
+TEST_F(KernelTuningDatabaseTest, givenStoredLocalWorkSizeWhenNewDatabaseIsLoadedThenLocalWorkSizeIsFound) {
+    KernelTuningDatabase database(".", *defaultHwInfo, numSubDevices);
+    database.storeLocalWorkSize(isaHash, gws, lws);
+    database.storeSingleSubdevicePreference(isaHash, gws, lws, offsets, true);
+
+    KernelTuningDatabase loadedDatabase(".", *defaultHwInfo, numSubDevices);
+    Vec3<size_t> tunedLws{0, 0, 0};
+    EXPECT_TRUE(loadedDatabase.findLocalWorkSize(isaHash, gws, tunedLws));
+    EXPECT_EQ(lws, tunedLws);
+    EXPECT_FALSE(loadedDatabase.findLocalWorkSize(isaHash, lws, tunedLws));
+
+    bool singleSubdevicePrefered = false;
+    EXPECT_TRUE(loadedDatabase.findSingleSubdevicePreference(isaHash, gws, lws, offsets, singleSubdevicePrefered));
+    EXPECT_TRUE(singleSubdevicePrefered);
+}
+
+HWTEST_F(KernelTuningDatabaseTest, givenLocalWorkSizeInDatabaseWhenGettingTunedLocalWorkSizeThenStoredSizeIsUsedOnFirstLaunch) {
+    MockKernelWithInternals mockKernel(*pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 256u;
+
+    pClDevice->kernelTuningDatabase = std::make_unique<KernelTuningDatabase>(".", *defaultHwInfo, numSubDevices);
+    pClDevice->kernelTuningDatabase->storeLocalWorkSize(mockKernel.mockKernel->getIsaHash(), gws, {32, 1, 1});
+
+    EXPECT_EQ(Vec3<size_t>(32, 1, 1), mockKernel.mockKernel->getTunedLocalWorkSize(gws, lws));
+
+    pClDevice->kernelTuningDatabase.reset();
+}
+
+TEST_F(KernelTuningDatabaseTest, givenDifferentSubDevicesCountWhenCreatingDatabaseThenDifferentFileIsUsed) {
+    KernelTuningDatabase database(".", *defaultHwInfo, numSubDevices);
+    KernelTuningDatabase otherDatabase(".", *defaultHwInfo, numSubDevices + 1);
+    EXPECT_NE(database.getFileName(), otherDatabase.getFileName());
+}
+
+TEST_F(KernelTuningDatabaseTest, givenMalformedLinesInFileWhenLoadingDatabaseThenOnlyValidEntriesAreLoaded) {
+    KernelTuningDatabase database(".", *defaultHwInfo, numSubDevices);
+    std::string fileContent = KernelTuningDatabase::createKey(isaHash, gws, lws, offsets) + " 1\n" +
+                              "garbage\n" +
+                              KernelTuningDatabase::createKey(isaHash, gws, gws, offsets) + " x\n";
+    writeDataToFile(database.getFileName().c_str(), fileContent.c_str(), fileContent.size());
+
+    database.load();
+    EXPECT_EQ(1u, database.getEntriesCount());
+}
+
+TEST_F(KernelTuningDatabaseTest, givenTwoDatabasesSharingFileWhenStoringPreferencesThenEntriesOfBothAreKept) {
+    KernelTuningDatabase database(".", *defaultHwInfo, numSubDevices);
+    KernelTuningDatabase otherDatabase(".", *defaultHwInfo, numSubDevices);
+    database.load();
+    otherDatabase.load();
+
+    database.storeSingleSubdevicePreference(isaHash, gws, lws, offsets, true);
+    otherDatabase.storeSingleSubdevicePreference(isaHash + 1, gws, lws, offsets, true);
+
+    KernelTuningDatabase loadedDatabase(".", *defaultHwInfo, numSubDevices);
+    loadedDatabase.load();
+    EXPECT_EQ(2u, loadedDatabase.getEntriesCount());
+}
+
+HWTEST_F(KernelTuningDatabaseTest, givenPreferenceInDatabaseWhenPerformingFullKernelTunningThenTunningIsDoneOnFirstEnqueue) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelTunning.set(2);
+
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*pClDevice);
+    MockTimestampPacketContainer container(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+
+    pClDevice->kernelTuningDatabase = std::make_unique<KernelTuningDatabase>(".", *defaultHwInfo, numSubDevices);
+    auto kernelIsaHash = Hash::hash(reinterpret_cast<const char *>(mockKernel.kernelInfo.heapInfo.pKernelHeap), mockKernel.kernelInfo.heapInfo.KernelHeapSize);
+    pClDevice->kernelTuningDatabase->storeSingleSubdevicePreference(kernelIsaHash, gws, lws, offsets, true);
+
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, &container);
+
+    auto result = mockKernel.mockKernel->kernelSubmissionMap.find(MockKernel::KernelConfig{gws, lws, offsets});
+    ASSERT_NE(mockKernel.mockKernel->kernelSubmissionMap.end(), result);
+    EXPECT_EQ(MockKernel::TunningStatus::TUNNING_DONE, result->second.status);
+    EXPECT_TRUE(mockKernel.mockKernel->singleSubdevicePreferedInCurrentEnqueue);
+
+    pClDevice->kernelTuningDatabase.reset();
+}
+
+HWTEST_F(KernelTuningDatabaseTest, givenDatabaseWhenFullKernelTunningIsDoneThenPreferenceIsStored) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelTunning.set(2);
+
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*pClDevice);
+    MockTimestampPacketContainer container(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer subdeviceContainer(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+
+    pClDevice->kernelTuningDatabase = std::make_unique<KernelTuningDatabase>(".", *defaultHwInfo, numSubDevices);
+
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, &container);
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, &subdeviceContainer);
+
+    uint32_t data[4] = {0, 0, 2, 2};
+    container.getNode(0u)->assignDataToAllTimestamps(0, data);
+    subdeviceContainer.getNode(0u)->assignDataToAllTimestamps(0, data);
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, &container);
+
+    KernelTuningDatabase loadedDatabase(".", *defaultHwInfo, numSubDevices);
+    bool singleSubdevicePrefered = true;
+    EXPECT_TRUE(loadedDatabase.findSingleSubdevicePreference(mockKernel.mockKernel->getIsaHash(), gws, lws, offsets, singleSubdevicePrefered));
+    EXPECT_FALSE(singleSubdevicePrefered);
+
+    pClDevice->kernelTuningDatabase.reset();
+}
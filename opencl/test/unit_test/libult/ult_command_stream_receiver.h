@@ -34,6 +34,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     using BaseClass::checkPlatformSupportsNewResourceImplicitFlush;
     using BaseClass::directSubmission;
     using BaseClass::dshState;
+    using BaseClass::fixedCmdStreamSize;
     using BaseClass::getCmdSizeForPrologue;
     using BaseClass::getScratchPatchAddress;
     using BaseClass::getScratchSpaceController;
@@ -98,7 +99,10 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     using BaseClass::CommandStreamReceiver::requiredThreadArbitrationPolicy;
     using BaseClass::CommandStreamReceiver::samplerCacheFlushRequired;
     using BaseClass::CommandStreamReceiver::scratchSpaceController;
+    using BaseClass::CommandStreamReceiver::stagingBuffers;
     using BaseClass::CommandStreamReceiver::stallingPipeControlOnNextFlushRequired;
+    using BaseClass::CommandStreamReceiver::submissionGpuTimestamps;
+    using BaseClass::CommandStreamReceiver::submissionLatencyCounters;
     using BaseClass::CommandStreamReceiver::submissionAggregator;
     using BaseClass::CommandStreamReceiver::taskCount;
     using BaseClass::CommandStreamReceiver::taskLevel;
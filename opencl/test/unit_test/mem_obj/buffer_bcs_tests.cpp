@@ -155,6 +155,27 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenBufferWithNotDefaultRootDeviceIndexAndBc
     EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
 }
 
+HWTEST_TEMPLATED_F(BcsBufferTests, givenLocalMemoryBufferWhenEvaluatingCpuCopyForReadThenBlitterStagingIsPreferred) {
+    DebugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::Default));
+    auto mockCmdQueue = static_cast<MockCommandQueueHw<FamilyType> *>(commandQueue.get());
+    static_cast<MockMemoryManager *>(device->getMemoryManager())->cpuCopyRequired = true;
+
+    auto buffer = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    auto allocation = static_cast<MemoryAllocation *>(buffer->getGraphicsAllocation(device->getRootDeviceIndex()));
+    allocation->overrideMemoryPool(MemoryPool::LocalMemory);
+    ASSERT_TRUE(buffer->isReadWriteOnCpuAllowed(device->getDevice()));
+
+    EXPECT_FALSE(mockCmdQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_READ_BUFFER, CL_TRUE, MemoryConstants::pageSize, &hostPtr, 0u, nullptr));
+    EXPECT_TRUE(mockCmdQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_WRITE_BUFFER, CL_TRUE, MemoryConstants::pageSize, &hostPtr, 0u, nullptr));
+
+    DebugManager.flags.EnableBlitterStagingForLocalMemoryReads.set(0);
+    EXPECT_TRUE(mockCmdQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_READ_BUFFER, CL_TRUE, MemoryConstants::pageSize, &hostPtr, 0u, nullptr));
+
+    DebugManager.flags.EnableBlitterStagingForLocalMemoryReads.set(-1);
+    allocation->overrideMemoryPool(MemoryPool::System4KBPages);
+    EXPECT_TRUE(mockCmdQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_READ_BUFFER, CL_TRUE, MemoryConstants::pageSize, &hostPtr, 0u, nullptr));
+}
+
 HWTEST_TEMPLATED_F(BcsBufferTests, givenBcsSupportedWhenEnqueueBufferOperationIsCalledThenUseBcsCsr) {
     DebugManager.flags.EnableBlitterForEnqueueOperations.set(0);
     auto mockCmdQueue = static_cast<MockCommandQueueHw<FamilyType> *>(commandQueue.get());
@@ -506,7 +527,7 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenWriteBufferEnqueueWhenProgrammingCommand
     void *hostPtr = reinterpret_cast<void *>(0x12340000);
 
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     HardwareParse hwParser;
     hwParser.parseCommands<FamilyType>(*cmdQ->peekCommandStream());
@@ -551,7 +572,7 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenReadBufferEnqueueWhenProgrammingCommandS
     void *hostPtr = reinterpret_cast<void *>(0x12340000);
 
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     HardwareParse hwParser;
     hwParser.parseCommands<FamilyType>(*cmdQ->peekCommandStream());
@@ -867,10 +888,10 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenInputAndOutputTimestampPacketWhenBlitCal
 
     // first enqueue to create IOQ dependency
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto inputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes().at(0)->getBaseGraphicsAllocation();
+    auto inputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes()[0]->getBaseGraphicsAllocation();
 
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto outputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes().at(0)->getBaseGraphicsAllocation();
+    auto outputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes()[0]->getBaseGraphicsAllocation();
 
     EXPECT_NE(outputTimestampPacketAllocation, inputTimestampPacketAllocation);
 
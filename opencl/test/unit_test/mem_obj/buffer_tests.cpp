@@ -10,6 +10,7 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -684,6 +685,33 @@ TEST_F(RenderCompressedBuffersTests, givenDebugVariableSetWhenHwFlagIsNotSetThen
     EXPECT_NE(graphicsAllocation->getAllocationType(), GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
 }
 
+TEST_F(RenderCompressedBuffersTests, givenHeuristicCompressionThresholdWhenCreatingReadWriteBufferThenCompressItAndTrackCpuAccesses) {
+    DebugManagerStateRestore restore;
+    hwInfo->capabilityTable.ftrRenderCompressedBuffers = true;
+    DebugManager.flags.BufferCompressionHeuristicThreshold.set(bufferSize);
+
+    buffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+    auto graphicsAllocation = buffer->getGraphicsAllocation(device->getRootDeviceIndex());
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED, graphicsAllocation->getAllocationType());
+    EXPECT_EQ(0u, graphicsAllocation->getCompressionStatistics().cpuAccesses);
+
+    MemObjOffsetArray origin = {{0, 0, 0}};
+    MemObjSizeArray region = {{1, 1, 1}};
+    cl_map_flags mapFlags = CL_MAP_READ;
+    buffer->addMappedPtr(hostPtr, 1, mapFlags, region, origin, 0);
+    EXPECT_EQ(1u, graphicsAllocation->getCompressionStatistics().cpuAccesses);
+    buffer->removeMappedPtr(hostPtr);
+
+    if (!HwHelper::get(hwInfo->platform.eRenderCoreFamily).isBufferSizeSuitableForRenderCompression(bufferSize)) {
+        buffer.reset(Buffer::create(context.get(), CL_MEM_READ_ONLY, bufferSize, nullptr, retVal));
+        EXPECT_NE(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED, buffer->getGraphicsAllocation(device->getRootDeviceIndex())->getAllocationType());
+
+        DebugManager.flags.BufferCompressionHeuristicThreshold.set(bufferSize + 1);
+        buffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+        EXPECT_NE(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED, buffer->getGraphicsAllocation(device->getRootDeviceIndex())->getAllocationType());
+    }
+}
+
 struct RenderCompressedBuffersSvmTests : public RenderCompressedBuffersTests {
     void SetUp() override {
         ExecutionEnvironment *executionEnvironment = platform()->peekExecutionEnvironment();
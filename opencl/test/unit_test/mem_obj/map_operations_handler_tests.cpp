@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,8 +15,11 @@
 using namespace NEO;
 
 struct MockMapOperationsHandler : public MapOperationsHandler {
+    using MapOperationsHandler::coveredRanges;
     using MapOperationsHandler::isOverlapping;
     using MapOperationsHandler::mappedPointers;
+
+    MapInfo &getLastMapInfo(void *ptr) { return std::prev(mappedPointers.upper_bound(ptr))->second; }
 };
 
 struct MapOperationsHandlerTests : public ::testing::Test {
@@ -74,27 +77,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -104,7 +107,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(1u, mockHandler.size());
@@ -116,11 +119,38 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.getLastMapInfo(mappedPtrs[0].ptr).readOnly);
+}
+
+TEST_F(MapOperationsHandlerTests, givenOverlappingReadOnlyMappingsWhenRemovingThemThenWriteMappingIsAllowedOnlyAfterLastOneIsRemoved) {
+    MemObjSizeArray size = {{0, 0, 0}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    cl_map_flags readFlags = CL_MAP_READ;
+    cl_map_flags writeFlags = CL_MAP_WRITE;
+
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1000), 0x100, readFlags, size, offset, 0));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1080), 0x100, readFlags, size, offset, 0));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1000), 0x10, readFlags, size, offset, 0));
+    EXPECT_EQ(4u, mockHandler.coveredRanges.size());
+
+    mockHandler.remove(reinterpret_cast<void *>(0x1000));
+    EXPECT_FALSE(mockHandler.add(reinterpret_cast<void *>(0x1000), 0x10, writeFlags, size, offset, 0));
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.find(reinterpret_cast<void *>(0x1000), receivedMapInfo));
+    EXPECT_EQ(0x10u, receivedMapInfo.ptrLength);
+
+    mockHandler.remove(reinterpret_cast<void *>(0x1000));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1000), 0x10, writeFlags, size, offset, 0));
+    EXPECT_FALSE(mockHandler.add(reinterpret_cast<void *>(0x1100), 0x100, writeFlags, size, offset, 0));
+
+    mockHandler.remove(reinterpret_cast<void *>(0x1000));
+    mockHandler.remove(reinterpret_cast<void *>(0x1080));
+    EXPECT_EQ(0u, mockHandler.size());
+    EXPECT_TRUE(mockHandler.coveredRanges.empty());
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/unit_test/utilities/base_object_utils.h"
 
@@ -155,3 +156,24 @@ TEST(MemObjHelper, givenParentMemObjAndHostPtrFlagsWhenValidatingMemoryPropertie
         EXPECT_FALSE(MemObjHelper::validateMemoryPropertiesForImage(memoryProperties, flags, 0, imageWithAccessFlagsUnrestricted.get(), context));
     }
 }
+
+TEST(MemObjHelper, givenHeuristicCompressionThresholdWhenCheckingSuitabilityForHeuristicCompressionThenOnlyBigReadWriteDeviceMemoryIsSuitable) {
+    DebugManagerStateRestore restore;
+    UltClDeviceFactory deviceFactory{1, 0};
+    auto pDevice = &deviceFactory.rootDevices[0]->getDevice();
+    constexpr size_t threshold = MemoryConstants::pageSize64k;
+
+    auto readWriteProperties = MemoryPropertiesHelper::createMemoryProperties(CL_MEM_READ_WRITE, 0, 0, pDevice);
+    EXPECT_FALSE(MemObjHelper::isSuitableForHeuristicCompression(readWriteProperties, threshold));
+
+    DebugManager.flags.BufferCompressionHeuristicThreshold.set(threshold);
+    EXPECT_TRUE(MemObjHelper::isSuitableForHeuristicCompression(readWriteProperties, threshold));
+    EXPECT_FALSE(MemObjHelper::isSuitableForHeuristicCompression(readWriteProperties, threshold - 1));
+    EXPECT_TRUE(MemObjHelper::isSuitableForHeuristicCompression(MemoryPropertiesHelper::createMemoryProperties(0, 0, 0, pDevice), threshold));
+
+    cl_mem_flags unsuitableFlags[] = {CL_MEM_READ_ONLY, CL_MEM_WRITE_ONLY, CL_MEM_USE_HOST_PTR, CL_MEM_ALLOC_HOST_PTR, CL_MEM_FORCE_HOST_MEMORY_INTEL};
+    for (auto flags : unsuitableFlags) {
+        auto memoryProperties = MemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, pDevice);
+        EXPECT_FALSE(MemObjHelper::isSuitableForHeuristicCompression(memoryProperties, threshold));
+    }
+}
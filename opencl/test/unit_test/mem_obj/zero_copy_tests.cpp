@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/mem_obj/buffer.h"
@@ -147,6 +148,25 @@ TEST(ZeroCopyWithDebugFlag, GivenInputsThatWouldResultInZeroCopyAndUseHostptrDis
     alignedFree(host_ptr);
 }
 
+TEST(ZeroCopyWithDebugFlag, GivenMisalignedHostPtrAndSizeAndAllowZeroCopyForMisalignedUseHostPtrFlagWhenBufferIsCreatedThenZeroCopyBufferIsReturned) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AllowZeroCopyForMisalignedUseHostPtr.set(true);
+    MockContext context;
+    auto allocatedPtr = alignedMalloc(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto host_ptr = ptrOffset(allocatedPtr, 1);
+    auto size = MemoryConstants::pageSize + 1;
+    auto retVal = CL_SUCCESS;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_USE_HOST_PTR, size, host_ptr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    if (buffer->getGraphicsAllocation(context.getDevice(0)->getRootDeviceIndex())->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY) {
+        EXPECT_TRUE(buffer->isMemObjZeroCopy());
+        EXPECT_EQ(host_ptr, buffer->getCpuAddress());
+    }
+    buffer.reset();
+    alignedFree(allocatedPtr);
+}
+
 TEST(ZeroCopyWithDebugFlag, GivenInputsThatWouldResultInZeroCopyAndDisableZeroCopyFlagWhenBufferIsCreatedThenNonZeroCopyBufferIsReturned) {
     DebugManagerStateRestore stateRestore;
     DebugManager.flags.DisableZeroCopyForBuffers.set(true);
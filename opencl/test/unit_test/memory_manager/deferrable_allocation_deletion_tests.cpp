@@ -10,6 +10,7 @@
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 
 #include "opencl/source/platform/platform.h"
@@ -23,7 +24,10 @@ using namespace NEO;
 
 struct DeferredDeleterPublic : DeferredDeleter {
   public:
+    using DeferredDeleter::additionalWorkers;
+    using DeferredDeleter::condition;
     using DeferredDeleter::doWorkInBackground;
+    using DeferredDeleter::elementsToRelease;
     using DeferredDeleter::queue;
     using DeferredDeleter::queueMutex;
     bool shouldStopReached = false;
@@ -170,3 +174,73 @@ TEST_F(DeferrableAllocationDeletionTest, givenAllocationUsedByUnregisteredEngine
     EXPECT_TRUE(deletion.apply());
     EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
 }
+
+TEST_F(DeferrableAllocationDeletionTest, givenAllocationsNotCompletedWhenCollectingTaskCountWaitsThenHighestTaskCountPerEngineIsStored) {
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    allocation1->updateTaskCount(3u, defaultOsContextId);
+    allocation2->updateTaskCount(2u, defaultOsContextId);
+
+    DeferrableAllocationDeletion deletion1{*memoryManager, *allocation1};
+    DeferrableAllocationDeletion deletion2{*memoryManager, *allocation2};
+    DeferrableDeletion::TaskCountWaits taskCountWaits;
+    deletion1.collectTaskCountWaits(taskCountWaits);
+    deletion2.collectTaskCountWaits(taskCountWaits);
+
+    ASSERT_EQ(1u, taskCountWaits.size());
+    EXPECT_EQ(device->getDefaultEngine().commandStreamReceiver, taskCountWaits.begin()->first);
+    EXPECT_EQ(3u, taskCountWaits.begin()->second);
+
+    allocation1->releaseUsageInOsContext(defaultOsContextId);
+    allocation2->releaseUsageInOsContext(defaultOsContextId);
+    memoryManager->freeGraphicsMemory(allocation1);
+    memoryManager->freeGraphicsMemory(allocation2);
+}
+
+HWTEST_F(DeferrableAllocationDeletionTest, givenTwoNotCompletedAllocationsEnqueuedToAsyncDeleterWhenWaitingThenHighestTaskCountIsAwaitedOnceAndBothAllocationsAreReleased) {
+    auto &commandStreamReceiver = device->getUltCommandStreamReceiver<FamilyType>();
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    *hwTag = 0u;
+    commandStreamReceiver.latestWaitForCompletionWithTimeoutTaskCount.store(0u);
+    allocation1->updateTaskCount(2u, defaultOsContextId);
+    allocation2->updateTaskCount(3u, defaultOsContextId);
+
+    while (!asyncDeleter->doWorkInBackground)
+        std::this_thread::yield(); //wait for start async thread work
+    std::unique_lock<std::mutex> lock(asyncDeleter->queueMutex); // enqueue both deletions before async thread wakes up
+    asyncDeleter->elementsToRelease += 2;
+    asyncDeleter->queue.pushTailOne(*new DeferrableAllocationDeletion(*memoryManager, *allocation1));
+    asyncDeleter->queue.pushTailOne(*new DeferrableAllocationDeletion(*memoryManager, *allocation2));
+    lock.unlock();
+    asyncDeleter->condition.notify_one();
+    while (commandStreamReceiver.latestWaitForCompletionWithTimeoutTaskCount.load() != 3u) // wait for async thread to wait for highest task count
+        std::this_thread::yield();
+    EXPECT_EQ(0u, memoryManager->freeGraphicsMemoryCalled);
+
+    asyncDeleter->allowExit = true;
+    *hwTag = 3u;
+    while (2u != memoryManager->freeGraphicsMemoryCalled) // wait for release of both allocations
+        std::this_thread::yield();
+}
+
+TEST(DeferredDeleterThreadsTest, givenDeferredDeleterThreadsCountSetWhenClientIsAddedThenAdditionalWorkersAreCreatedUpToLimit) {
+    DebugManagerStateRestore restorer;
+    {
+        DebugManager.flags.DeferredDeleterThreadsCount.set(3);
+        DeferredDeleterPublic deleter;
+        deleter.addClient();
+        EXPECT_EQ(2u, deleter.additionalWorkers.size());
+        deleter.allowExit = true;
+        deleter.removeClient();
+        EXPECT_EQ(0u, deleter.additionalWorkers.size());
+    }
+    {
+        DebugManager.flags.DeferredDeleterThreadsCount.set(100);
+        DeferredDeleterPublic deleter;
+        deleter.addClient();
+        EXPECT_EQ(DeferredDeleter::maxWorkersCount - 1, deleter.additionalWorkers.size());
+        deleter.allowExit = true;
+        deleter.removeClient();
+    }
+}
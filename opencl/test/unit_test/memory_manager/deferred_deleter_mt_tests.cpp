@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -235,3 +235,38 @@ TEST_F(DeferredDeleterTest, givenDeferredDeleterWhenNonBlockingDrainIsCalledThen
     EXPECT_EQ(0, deleter->areElementsReleasedCalled);
     EXPECT_EQ(1, deleter->drainCalled);
 }
+
+struct MergeableDeferrableDeletion : public DeferrableDeletion {
+    MergeableDeferrableDeletion(const void *mergeKey, uint32_t &applyCalled, uint32_t &appliedDeletions)
+        : mergeKey(mergeKey), applyCalled(applyCalled), appliedDeletions(appliedDeletions) {}
+
+    bool apply() override {
+        applyCalled++;
+        appliedDeletions += getDeletionsCount();
+        return true;
+    }
+    const void *getMergeKey() const override { return mergeKey; }
+
+    const void *mergeKey;
+    uint32_t &applyCalled;
+    uint32_t &appliedDeletions;
+};
+
+TEST_F(DeferredDeleterTest, givenConsecutiveDeletionsWithSameMergeKeyWhenDrainingThenTheyAreReleasedWithSingleApply) {
+    int owner = 0;
+    int otherOwner = 0;
+    uint32_t applyCalled = 0u;
+    uint32_t appliedDeletions = 0u;
+
+    for (auto mergeKey : {&owner, &owner, &owner, &otherOwner, static_cast<int *>(nullptr), static_cast<int *>(nullptr)}) {
+        deleter->DeferredDeleter::deferDeletion(new MergeableDeferrableDeletion(mergeKey, applyCalled, appliedDeletions));
+    }
+    EXPECT_EQ(6, deleter->getElementsToRelease());
+
+    deleter->drain(true);
+
+    EXPECT_EQ(4u, applyCalled);
+    EXPECT_EQ(6u, appliedDeletions);
+    EXPECT_TRUE(deleter->isQueueEmpty());
+    EXPECT_EQ(0, deleter->getElementsToRelease());
+}
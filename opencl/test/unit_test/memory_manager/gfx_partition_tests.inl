@@ -10,6 +10,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/mocks/mock_gfx_partition.h"
 
@@ -450,3 +451,24 @@ INSTANTIATE_TEST_SUITE_P(
                       HeapIndex::HEAP_STANDARD64KB,
                       HeapIndex::HEAP_STANDARD2MB,
                       HeapIndex::HEAP_EXTENDED));
+
+TEST(GfxPartitionTest, givenBestFitHeapAllocatorSelectedForStandardHeapWhenAllocatingThenOnlyStandardHeapUsesBestFitAllocator) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UseBestFitHeapAllocator.set(1ll << static_cast<uint32_t>(HeapIndex::HEAP_STANDARD));
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1);
+
+    EXPECT_TRUE(gfxPartition.isBestFitAllocatorUsed(HeapIndex::HEAP_STANDARD));
+    EXPECT_FALSE(gfxPartition.isBestFitAllocatorUsed(HeapIndex::HEAP_STANDARD64KB));
+    EXPECT_FALSE(gfxPartition.isBestFitAllocatorUsed(HeapIndex::HEAP_INTERNAL));
+
+    size_t sizeToAllocate = MemoryConstants::pageSize;
+    auto address = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD, sizeToAllocate);
+    EXPECT_EQ(gfxPartition.getHeapMinimalAddress(HeapIndex::HEAP_STANDARD), address);
+    EXPECT_EQ(MemoryConstants::pageSize, sizeToAllocate);
+
+    gfxPartition.freeGpuAddressRange(address, sizeToAllocate);
+    sizeToAllocate = MemoryConstants::pageSize;
+    EXPECT_EQ(address, gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD, sizeToAllocate));
+}
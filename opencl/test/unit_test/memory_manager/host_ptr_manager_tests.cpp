@@ -19,6 +19,8 @@
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
+#include <thread>
+
 using namespace NEO;
 
 struct HostPtrManagerTest : ::testing::Test {
@@ -319,6 +321,52 @@ TEST_F(HostPtrManagerTest, WhenStoringFragmentTwiceThenContainerCountIsIncrement
     EXPECT_EQ(1u, hostPtrManager.getFragmentCount());
 }
 
+TEST_F(HostPtrManagerTest, givenFragmentsWithSamePointerOnDifferentRootDevicesWhenStoringThenFragmentsAreKeptInSeparateShards) {
+    MockHostPtrManager hostPtrManager;
+    const uint32_t otherRootDeviceIndex = rootDeviceIndex + 1;
+
+    FragmentStorage allocationFragment;
+    allocationFragment.fragmentCpuPointer = reinterpret_cast<void *>(0x1000);
+    allocationFragment.fragmentSize = MemoryConstants::pageSize;
+
+    hostPtrManager.storeFragment(rootDeviceIndex, allocationFragment);
+    hostPtrManager.storeFragment(otherRootDeviceIndex, allocationFragment);
+
+    EXPECT_EQ(2u, hostPtrManager.getFragmentCount());
+    EXPECT_NE(&hostPtrManager.getShard(rootDeviceIndex), &hostPtrManager.getShard(otherRootDeviceIndex));
+
+    auto fragment = hostPtrManager.getFragment({allocationFragment.fragmentCpuPointer, rootDeviceIndex});
+    auto otherFragment = hostPtrManager.getFragment({allocationFragment.fragmentCpuPointer, otherRootDeviceIndex});
+    ASSERT_NE(nullptr, fragment);
+    ASSERT_NE(nullptr, otherFragment);
+    EXPECT_NE(fragment, otherFragment);
+
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(rootDeviceIndex, allocationFragment.fragmentCpuPointer));
+    EXPECT_EQ(nullptr, hostPtrManager.getFragment({allocationFragment.fragmentCpuPointer, rootDeviceIndex}));
+    EXPECT_EQ(otherFragment, hostPtrManager.getFragment({allocationFragment.fragmentCpuPointer, otherRootDeviceIndex}));
+
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(otherRootDeviceIndex, allocationFragment.fragmentCpuPointer));
+    EXPECT_EQ(0u, hostPtrManager.getFragmentCount());
+}
+
+TEST_F(HostPtrManagerTest, givenOwnershipOfOneRootDeviceWhenFragmentOfOtherRootDeviceIsStoredFromAnotherThreadThenItIsNotBlocked) {
+    MockHostPtrManager hostPtrManager;
+    const uint32_t otherRootDeviceIndex = rootDeviceIndex + 1;
+
+    FragmentStorage allocationFragment;
+    allocationFragment.fragmentCpuPointer = reinterpret_cast<void *>(0x1000);
+    allocationFragment.fragmentSize = MemoryConstants::pageSize;
+
+    auto lock = hostPtrManager.obtainOwnership(rootDeviceIndex);
+    std::thread otherThread([&] {
+        hostPtrManager.storeFragment(otherRootDeviceIndex, allocationFragment);
+    });
+    otherThread.join();
+
+    EXPECT_NE(nullptr, hostPtrManager.getFragment({allocationFragment.fragmentCpuPointer, otherRootDeviceIndex}));
+    EXPECT_EQ(nullptr, hostPtrManager.getFragment({allocationFragment.fragmentCpuPointer, rootDeviceIndex}));
+}
+
 TEST_F(HostPtrManagerTest, GivenEmptyHostPtrManagerWhenAskingForFragmentThenNullptrIsReturned) {
     MockHostPtrManager hostPtrManager;
     auto fragment = hostPtrManager.getFragment({(void *)0x10121, rootDeviceIndex});
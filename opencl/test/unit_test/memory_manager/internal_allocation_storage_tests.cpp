@@ -270,3 +270,63 @@ TEST_F(InternalAllocationStorageTest, givenAllocationListWhenTwoThreadsCleanConc
 
     EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
 }
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingReusableAllocationThenSmallestFittingAllocationIsReturned) {
+    auto bigAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 16 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto otherTypeAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::INTERNAL_HEAP, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(bigAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(otherTypeAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 1u);
+    EXPECT_EQ(3u, csr->getAllocationsForReuse().peekIndexedAllocationsCount());
+
+    *csr->getTagAddress() = 1u;
+
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation.get());
+
+    auto reusedBigAllocation = storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(bigAllocation, reusedBigAllocation.get());
+
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+    EXPECT_EQ(1u, csr->getAllocationsForReuse().peekIndexedAllocationsCount());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*otherTypeAllocation));
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(reusedBigAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsWhenCleaningAllocationListThenIndexContainsOnlyRemainingAllocations) {
+    auto completedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 5u);
+    EXPECT_EQ(2u, csr->getAllocationsForReuse().peekIndexedAllocationsCount());
+
+    storage->cleanAllocationList(1u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(1u, csr->getAllocationsForReuse().peekIndexedAllocationsCount());
+
+    *csr->getTagAddress() = 1u;
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+
+    *csr->getTagAddress() = 5u;
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(busyAllocation, reusedAllocation.get());
+    EXPECT_EQ(0u, csr->getAllocationsForReuse().peekIndexedAllocationsCount());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenTemporaryAllocationWhenStoredThenItIsNotIndexed) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION, 1u);
+
+    EXPECT_EQ(0u, csr->getTemporaryAllocations().peekIndexedAllocationsCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation));
+
+    storage->cleanAllocationList(1u, TEMPORARY_ALLOCATION);
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+}
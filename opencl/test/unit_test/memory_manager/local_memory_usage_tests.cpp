@@ -12,6 +12,8 @@
 
 #include "third_party/gtest/gtest/gtest.h"
 
+#include <bitset>
+
 namespace NEO {
 
 struct MockLocalMemoryUsageBankSelector : public LocalMemoryUsageBankSelector {
@@ -162,4 +164,90 @@ TEST(localMemoryUsageTest, givenBitfieldWhenGettingLeastOccupiedBankThenReturnTh
     EXPECT_EQ(bank, 1u);
 }
 
+TEST(localMemoryUsageTest, givenBandwidthBalancedPolicyWhenSelectingBanksThenLeastAccessedBankIsReturned) {
+    MockLocalMemoryUsageBankSelector selector(3u);
+    selector.reserveOnBank(1u, 1024u);
+    selector.recordAccess(0b001, 4096u);
+    selector.recordAccess(0b100, 2048u);
+
+    auto placement = selector.selectBanks(selector.bitfield, 1024u, BankPlacementPolicy::BandwidthBalanced);
+    EXPECT_EQ(0b010u, placement.memoryBanks);
+    EXPECT_FALSE(placement.interleaved);
+
+    selector.recordAccess(0b010, 8192u);
+    placement = selector.selectBanks(selector.bitfield, 1024u, BankPlacementPolicy::BandwidthBalanced);
+    EXPECT_EQ(0b100u, placement.memoryBanks);
+
+    placement = selector.selectBanks(selector.bitfield, 1024u, BankPlacementPolicy::LeastOccupied);
+    EXPECT_EQ(0b001u, placement.memoryBanks);
+
+    EXPECT_EQ(2u, selector.getPlacementsCount(BankPlacementPolicy::BandwidthBalanced));
+    EXPECT_EQ(1u, selector.getPlacementsCount(BankPlacementPolicy::LeastOccupied));
+    EXPECT_EQ(1u, selector.getPlacementsCountForBank(0u));
+    EXPECT_EQ(1u, selector.getPlacementsCountForBank(1u));
+    EXPECT_EQ(1u, selector.getPlacementsCountForBank(2u));
+}
+
+TEST(localMemoryUsageTest, givenAccessRecordedOnMultipleBanksThenAccessedSizeIsSplitBetweenBanks) {
+    MockLocalMemoryUsageBankSelector selector(4u);
+    selector.recordAccess(0b1010, 4096u);
+    selector.recordAccess(0u, 4096u);
+
+    EXPECT_EQ(0u, selector.getAccessedMemorySizeForBank(0u));
+    EXPECT_EQ(2048u, selector.getAccessedMemorySizeForBank(1u));
+    EXPECT_EQ(0u, selector.getAccessedMemorySizeForBank(2u));
+    EXPECT_EQ(2048u, selector.getAccessedMemorySizeForBank(3u));
+    EXPECT_THROW(selector.getAccessedMemorySizeForBank(4u), std::exception);
+}
+
+TEST(localMemoryUsageTest, givenInterleavedPolicyAndLargeAllocationWhenSelectingBanksThenAllAvailableBanksAreUsed) {
+    MockLocalMemoryUsageBankSelector selector(4u);
+    DeviceBitfield bitfield(0b1101);
+    auto chunkSize = selector.getInterleaveChunkSize();
+
+    auto placement = selector.selectBanks(bitfield, 2 * chunkSize, BankPlacementPolicy::Interleaved);
+    EXPECT_EQ(0b1101u, placement.memoryBanks);
+    EXPECT_TRUE(placement.interleaved);
+    EXPECT_EQ(1u, selector.getPlacementsCount(BankPlacementPolicy::Interleaved));
+
+    placement = selector.selectBanks(bitfield, chunkSize, BankPlacementPolicy::Interleaved);
+    EXPECT_FALSE(placement.interleaved);
+    EXPECT_EQ(1u, std::bitset<32>(placement.memoryBanks).count());
+    EXPECT_EQ(1u, selector.getPlacementsCount(BankPlacementPolicy::Interleaved));
+    EXPECT_EQ(1u, selector.getPlacementsCount(BankPlacementPolicy::BandwidthBalanced));
+
+    placement = selector.selectBanks(DeviceBitfield(0b0100), 4 * chunkSize, BankPlacementPolicy::Interleaved);
+    EXPECT_FALSE(placement.interleaved);
+    EXPECT_EQ(0b0100u, placement.memoryBanks);
+}
+
+TEST(localMemoryUsageTest, givenInterleavedAllocationWhenReservingAndFreeingThenChunksAreSplitBetweenBanks) {
+    MockLocalMemoryUsageBankSelector selector(3u);
+    auto chunkSize = selector.getInterleaveChunkSize();
+    uint64_t allocationSize = 4 * chunkSize + 1024u;
+
+    selector.reserveInterleavedOnBanks(0b111, allocationSize);
+    EXPECT_EQ(2 * chunkSize, selector.getOccupiedMemorySizeForBank(0u));
+    EXPECT_EQ(chunkSize + 1024u, selector.getOccupiedMemorySizeForBank(1u));
+    EXPECT_EQ(chunkSize, selector.getOccupiedMemorySizeForBank(2u));
+
+    selector.freeInterleavedOnBanks(0b111, allocationSize);
+    for (uint32_t i = 0; i < selector.banksCount; i++) {
+        EXPECT_EQ(0u, selector.getOccupiedMemorySizeForBank(i));
+    }
+}
+
+TEST(localMemoryUsageTest, givenDebugFlagsWhenSelectingBanksThenPolicyAndChunkSizeAreOverridden) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.OverrideBankPlacementPolicy.set(static_cast<int32_t>(BankPlacementPolicy::Interleaved));
+    DebugManager.flags.BankInterleaveChunkSize.set(4096);
+    MockLocalMemoryUsageBankSelector selector(2u);
+    EXPECT_EQ(4096u, selector.getInterleaveChunkSize());
+
+    auto placement = selector.selectBanks(selector.bitfield, 8192u, BankPlacementPolicy::LeastOccupied);
+    EXPECT_TRUE(placement.interleaved);
+    EXPECT_EQ(0b11u, placement.memoryBanks);
+    EXPECT_EQ(0u, selector.getPlacementsCount(BankPlacementPolicy::LeastOccupied));
+}
+
 } // namespace NEO
@@ -1442,6 +1442,27 @@ TEST(OsAgnosticMemoryManager, givenOsAgnosticMemoryManagerWhenGpuAddressIsReserv
     memoryManager.freeGpuAddress(addressRange, 0);
 }
 
+TEST(OsAgnosticMemoryManager, givenReservedGpuAddressWhenPhysicalMemoryIsMappedThenAllocationGpuAddressIsChangedAndCpuPtrIsKept) {
+    MockExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(executionEnvironment);
+
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{0, MemoryConstants::pageSize64k});
+    ASSERT_NE(nullptr, allocation);
+    auto cpuPtr = allocation->getUnderlyingBuffer();
+    auto ownGpuAddress = allocation->getGpuAddress();
+
+    auto addressRange = memoryManager.reserveGpuAddress(MemoryConstants::pageSize64k, 0);
+    EXPECT_TRUE(memoryManager.mapPhysicalToVirtualMemory(allocation, addressRange.address));
+    EXPECT_EQ(addressRange.address, allocation->getGpuAddress());
+    EXPECT_EQ(cpuPtr, allocation->getUnderlyingBuffer());
+
+    EXPECT_TRUE(memoryManager.mapPhysicalToVirtualMemory(allocation, ownGpuAddress));
+    EXPECT_EQ(ownGpuAddress, allocation->getGpuAddress());
+
+    memoryManager.freeGpuAddress(addressRange, 0);
+    memoryManager.freeGraphicsMemory(allocation);
+}
+
 TEST(OsAgnosticMemoryManager, givenOsAgnosticMemoryManagerWhenVerifyHandleThenReturnTrue) {
     MockExecutionEnvironment executionEnvironment;
     OsAgnosticMemoryManager memoryManager(executionEnvironment);
@@ -2579,3 +2600,68 @@ TEST(MemoryManagerTest, WhenCallingIsAllocationTypeToCaptureThenScratchAndPrivat
     EXPECT_TRUE(mockMemoryManager.isAllocationTypeToCapture(GraphicsAllocation::AllocationType::SCRATCH_SURFACE));
     EXPECT_TRUE(mockMemoryManager.isAllocationTypeToCapture(GraphicsAllocation::AllocationType::PRIVATE_SURFACE));
 }
+
+TEST(MemoryManagerTest, givenAllocationInPreferredPoolWhenAllocatingAndFreeingThenMemoryUsageStatisticsAreUpdated) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{0, MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_TRUE(allocation->isMemoryUsageTracked());
+
+    auto allocationType = allocation->getAllocationType();
+    auto memoryPool = allocation->getMemoryPool();
+    auto size = allocation->getUnderlyingBufferSize();
+    auto counters = memoryManager.getMemoryUsageStatistics(0u).getCounters(allocationType, memoryPool);
+    EXPECT_EQ(size, counters.currentSize);
+    EXPECT_EQ(size, counters.peakSize);
+    EXPECT_EQ(1u, counters.currentCount);
+    EXPECT_EQ(1u, counters.allocationsCount);
+
+    memoryManager.freeGraphicsMemory(allocation);
+    counters = memoryManager.getMemoryUsageStatistics(0u).getCounters(allocationType, memoryPool);
+    EXPECT_EQ(0u, counters.currentSize);
+    EXPECT_EQ(size, counters.peakSize);
+    EXPECT_EQ(0u, counters.currentCount);
+    EXPECT_EQ(1u, counters.freesCount);
+}
+
+TEST(MemoryManagerTest, givenTrackedAllocationWithChangedAllocationTypeWhenFreeingThenUsageIsRemovedFromOriginalAllocationType) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{0, MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+
+    auto allocationType = allocation->getAllocationType();
+    auto memoryPool = allocation->getMemoryPool();
+    allocation->setAllocationType(GraphicsAllocation::AllocationType::IMAGE);
+
+    memoryManager.freeGraphicsMemory(allocation);
+    auto &statistics = memoryManager.getMemoryUsageStatistics(0u);
+    EXPECT_EQ(0u, statistics.getCounters(allocationType, memoryPool).currentCount);
+    EXPECT_EQ(1u, statistics.getCounters(allocationType, memoryPool).freesCount);
+    EXPECT_EQ(0u, statistics.getCounters(GraphicsAllocation::AllocationType::IMAGE, memoryPool).freesCount);
+}
+
+TEST(MemoryManagerTest, givenPrintMemoryUsageStatisticsWhenAllocatingAndDestroyingMemoryManagerThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintMemoryUsageStatistics.set(2);
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    auto memoryManager = std::make_unique<MockMemoryManager>(false, false, executionEnvironment);
+
+    testing::internal::CaptureStdout();
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{0, MemoryConstants::pageSize});
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+
+    testing::internal::CaptureStdout();
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{0, MemoryConstants::pageSize});
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Memory usage: root device 0, total: current 8192 bytes in 2 allocations"));
+
+    memoryManager->freeGraphicsMemory(allocation);
+    memoryManager->freeGraphicsMemory(allocation2);
+
+    testing::internal::CaptureStdout();
+    memoryManager.reset();
+    output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Memory usage: root device 0, total: current 0 bytes in 0 allocations, peak 8192 bytes, allocated 2 times, freed 2 times"));
+}
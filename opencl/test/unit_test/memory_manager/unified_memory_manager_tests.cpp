@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/memory_manager/allocations_list.h"
+#include "shared/source/memory_manager/unified_memory_pooling.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -73,6 +74,51 @@ TEST_F(SVMMemoryAllocatorTest, whenRequestSVMAllocsThenReturnNonNullptr) {
     EXPECT_NE(svmAllocs, nullptr);
 }
 
+TEST_F(SVMMemoryAllocatorTest, whenSVMAllocationsAreCreatedThenAllocationsVersionIsIncrementedOnlyOnCreation) {
+    auto initialVersion = svmManager->getAllocationsVersion();
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    EXPECT_NE(nullptr, ptr);
+    EXPECT_EQ(initialVersion + 1, svmManager->getAllocationsVersion());
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_EQ(initialVersion + 1, svmManager->getAllocationsVersion());
+}
+
+TEST_F(SVMMemoryAllocatorTest, whenSVMAllocationIsCreatedAndFreedThenOnlyGenerationOfItsMemoryTypeIsChanged) {
+    auto initialSvmGeneration = svmManager->getInternalAllocationsGeneration(InternalMemoryType::SVM);
+    auto initialHostGeneration = svmManager->getInternalAllocationsGeneration(InternalMemoryType::HOST_UNIFIED_MEMORY);
+
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    EXPECT_NE(nullptr, ptr);
+    auto generationAfterCreate = svmManager->getInternalAllocationsGeneration(InternalMemoryType::SVM);
+    EXPECT_NE(initialSvmGeneration, generationAfterCreate);
+    EXPECT_EQ(initialHostGeneration, svmManager->getInternalAllocationsGeneration(InternalMemoryType::HOST_UNIFIED_MEMORY));
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_NE(generationAfterCreate, svmManager->getInternalAllocationsGeneration(InternalMemoryType::SVM));
+    EXPECT_EQ(initialHostGeneration, svmManager->getInternalAllocationsGeneration(InternalMemoryType::HOST_UNIFIED_MEMORY));
+}
+
+TEST_F(SVMMemoryAllocatorTest, whenHostAllocationIsFreedThenItIsNoLongerAddedToResidencyContainer) {
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize, unifiedMemoryProperties);
+    EXPECT_NE(nullptr, ptr);
+    auto allocation = svmManager->getSVMAlloc(ptr)->gpuAllocations.getGraphicsAllocation(mockRootDeviceIndex);
+
+    ResidencyContainer residencyContainer;
+    svmManager->addInternalAllocationsToResidencyContainer(mockRootDeviceIndex, residencyContainer, InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    EXPECT_EQ(0u, residencyContainer.size());
+
+    svmManager->addInternalAllocationsToResidencyContainer(mockRootDeviceIndex, residencyContainer, InternalMemoryType::HOST_UNIFIED_MEMORY | InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, residencyContainer.size());
+    EXPECT_EQ(allocation, residencyContainer[0]);
+
+    svmManager->freeSVMAlloc(ptr);
+    residencyContainer.clear();
+    svmManager->addInternalAllocationsToResidencyContainer(mockRootDeviceIndex, residencyContainer, InternalMemoryType::HOST_UNIFIED_MEMORY);
+    EXPECT_EQ(0u, residencyContainer.size());
+}
+
 using MultiDeviceSVMMemoryAllocatorTest = MultiRootDeviceWithSubDevicesFixture;
 
 TEST_F(MultiDeviceSVMMemoryAllocatorTest, givenMultipleDevicesWhenCreatingSVMAllocThenCreateOneGraphicsAllocationPerRootDeviceIndex) {
@@ -180,6 +226,110 @@ TEST_F(SVMMemoryAllocatorTest, whenGetSVMAllocationFromOutsideOfReturnedPointerA
     svmManager->freeSVMAlloc(ptr);
 }
 
+TEST_F(SVMMemoryAllocatorTest, givenMultipleSvmAllocationsWhenGettingAllocationsByInteriorPointersThenOwningAllocationIsReturned) {
+    constexpr size_t numAllocations = 8;
+    void *ptrs[numAllocations] = {};
+    for (auto &ptr : ptrs) {
+        ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+        ASSERT_NE(nullptr, ptr);
+    }
+    EXPECT_EQ(numAllocations, svmManager->getNumAllocs());
+
+    for (auto ptr : ptrs) {
+        auto svmData = svmManager->getSVMAlloc(ptr);
+        ASSERT_NE(nullptr, svmData);
+        EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize / 2)));
+        EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize - 1)));
+        EXPECT_EQ(ptr, reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    }
+
+    for (auto ptr : ptrs) {
+        svmManager->freeSVMAlloc(ptr);
+    }
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenUsmAllocationPoolingEnabledWhenSmallDeviceAllocationsAreCreatedThenTheyShareOnePooledGraphicsAllocation) {
+    if (is32bit) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUsmAllocationPooling.set(1);
+    MockSVMAllocsManager pooledSvmManager(memoryManager.get(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto ptr1 = pooledSvmManager.createUnifiedMemoryAllocation(64u, unifiedMemoryProperties);
+    auto ptr2 = pooledSvmManager.createUnifiedMemoryAllocation(1000u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr1);
+    ASSERT_NE(nullptr, ptr2);
+    EXPECT_NE(ptr1, ptr2);
+    EXPECT_EQ(2u, pooledSvmManager.getNumAllocs());
+
+    auto allocData1 = pooledSvmManager.getSVMAlloc(ptr1);
+    auto allocData2 = pooledSvmManager.getSVMAlloc(ptr2);
+    ASSERT_NE(nullptr, allocData1);
+    ASSERT_NE(nullptr, allocData2);
+    EXPECT_NE(allocData1, allocData2);
+    EXPECT_EQ(64u, allocData1->size);
+    EXPECT_EQ(1000u, allocData2->size);
+    EXPECT_EQ(castToUint64(ptr1), allocData1->getBaseGpuAddress());
+    EXPECT_EQ(castToUint64(ptr2), allocData2->getBaseGpuAddress());
+    EXPECT_EQ(0u, castToUint64(ptr1) % UsmMemAllocPool::allocationAlignment);
+    EXPECT_EQ(0u, castToUint64(ptr2) % UsmMemAllocPool::allocationAlignment);
+
+    auto pooledAllocation = allocData1->gpuAllocations.getDefaultGraphicsAllocation();
+    EXPECT_EQ(pooledAllocation, allocData2->gpuAllocations.getDefaultGraphicsAllocation());
+    EXPECT_EQ(UsmMemAllocPool::chunkSize, pooledAllocation->getUnderlyingBufferSize());
+    EXPECT_EQ(allocData1, pooledSvmManager.getSVMAlloc(ptrOffset(ptr1, 63)));
+    EXPECT_NE(allocData1, pooledSvmManager.getSVMAlloc(ptrOffset(ptr1, 64)));
+
+    EXPECT_TRUE(pooledSvmManager.freeSVMAlloc(ptr1));
+    EXPECT_EQ(nullptr, pooledSvmManager.getSVMAlloc(ptr1));
+    EXPECT_EQ(allocData2, pooledSvmManager.getSVMAlloc(ptr2));
+
+    auto ptr3 = pooledSvmManager.createUnifiedMemoryAllocation(64u, unifiedMemoryProperties);
+    EXPECT_EQ(ptr1, ptr3);
+
+    EXPECT_TRUE(pooledSvmManager.freeSVMAlloc(ptr2));
+    EXPECT_TRUE(pooledSvmManager.freeSVMAlloc(ptr3));
+    EXPECT_EQ(0u, pooledSvmManager.getNumAllocs());
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenUsmAllocationPoolingEnabledWhenAllocationIsNotPoolableThenDedicatedGraphicsAllocationIsCreated) {
+    if (is32bit) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUsmAllocationPooling.set(1);
+    MockSVMAllocsManager pooledSvmManager(memoryManager.get(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto bigAllocation = pooledSvmManager.createUnifiedMemoryAllocation(UsmMemAllocPool::maxPoolableSize + 1, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, bigAllocation);
+    auto bigAllocData = pooledSvmManager.getSVMAlloc(bigAllocation);
+    EXPECT_EQ(nullptr, bigAllocData->usmPool);
+    EXPECT_EQ(castToUint64(bigAllocation), bigAllocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
+
+    unifiedMemoryProperties.allocationFlags.flags.locallyUncachedResource = 1;
+    auto uncachedAllocation = pooledSvmManager.createUnifiedMemoryAllocation(64u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, uncachedAllocation);
+    EXPECT_EQ(nullptr, pooledSvmManager.getSVMAlloc(uncachedAllocation)->usmPool);
+
+    pooledSvmManager.freeSVMAlloc(bigAllocation);
+    pooledSvmManager.freeSVMAlloc(uncachedAllocation);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenDefaultSettingsWhenSmallDeviceAllocationIsCreatedThenItIsNotPooled) {
+    if (is32bit) {
+        GTEST_SKIP();
+    }
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createUnifiedMemoryAllocation(64u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr)->usmPool);
+    svmManager->freeSVMAlloc(ptr);
+}
+
 TEST_F(SVMMemoryAllocatorTest, whenCouldNotAllocateInMemoryManagerThenReturnsNullAndDoesNotChangeAllocsMap) {
     FailMemoryManager failMemoryManager(executionEnvironment);
     svmManager->memoryManager = &failMemoryManager;
@@ -106,6 +106,7 @@ class GlSharingFunctionsMock : public GLSharingFunctionsWindows {
     using GLSharingFunctionsWindows::glArbEventMapping;
     using GLSharingFunctionsWindows::GLContextHandle;
     using GLSharingFunctionsWindows::GLDeviceHandle;
+    using GLSharingFunctionsWindows::releaseSyncObjects;
 
     using GLSharingFunctionsWindows::getSupportedFormats;
     using GLSharingFunctionsWindows::pfnGlArbSyncObjectCleanup;
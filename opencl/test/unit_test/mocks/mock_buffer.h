@@ -35,6 +35,7 @@ class MockBuffer : public MockBufferStorage, public Buffer {
     using Buffer::magic;
     using Buffer::offset;
     using Buffer::size;
+    using MemObj::generation;
     using MemObj::isZeroCopy;
     using MemObj::memObjectType;
     using MockBufferStorage::device;
@@ -37,6 +37,7 @@ class MockClDevice : public ClDevice {
     using ClDevice::getQueueFamilyCapabilities;
     using ClDevice::getQueueFamilyCapabilitiesAll;
     using ClDevice::initializeCaps;
+    using ClDevice::kernelTuningDatabase;
     using ClDevice::name;
     using ClDevice::ocl21FeaturesEnabled;
     using ClDevice::simultaneousInterops;
@@ -200,14 +200,20 @@ class MockCommandQueueHw : public CommandQueueHw<GfxFamily> {
     using BaseClass::bcsEngine;
     using BaseClass::bcsTaskCount;
     using BaseClass::blitEnqueueAllowed;
+    using BaseClass::bufferCpuCopyAllowed;
     using BaseClass::commandQueueProperties;
     using BaseClass::commandStream;
+    using BaseClass::engineLanes;
     using BaseClass::gpgpuEngine;
+    using BaseClass::implicitScalingAllowed;
+    using BaseClass::ImplicitScalingChunks;
+    using BaseClass::implicitScalingEnabled;
     using BaseClass::isBlitAuxTranslationRequired;
     using BaseClass::latestSentEnqueueType;
     using BaseClass::obtainCommandStream;
     using BaseClass::obtainNewTimestampPacketNodes;
     using BaseClass::requiresCacheFlushAfterWalker;
+    using BaseClass::splitForImplicitScaling;
     using BaseClass::throttle;
     using BaseClass::timestampPacketContainer;
 
@@ -18,6 +18,8 @@ class MockGmmClientContextBase : public GmmClientContext {
     uint8_t getSurfaceStateCompressionFormat(GMM_RESOURCE_FORMAT format) override;
     uint8_t getMediaSurfaceStateCompressionFormat(GMM_RESOURCE_FORMAT format) override;
 
+    using GmmClientContext::cachedImageResourceInfos;
+
     GMM_RESOURCE_FORMAT capturedFormat = GMM_FORMAT_INVALID;
     uint8_t compressionFormatToReturn = 1;
     uint32_t getSurfaceStateCompressionFormatCalled = 0u;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,13 @@ class MockHostPtrManager : public HostPtrManager {
     using HostPtrManager::getAllocationRequirements;
     using HostPtrManager::getFragmentAndCheckForOverlaps;
     using HostPtrManager::populateAlreadyAllocatedFragments;
-    size_t getFragmentCount() { return partialAllocations.size(); }
+    using HostPtrManager::getShard;
+    size_t getFragmentCount() {
+        size_t fragmentCount = 0u;
+        for (auto &shard : shards) {
+            fragmentCount += shard.partialAllocations.size();
+        }
+        return fragmentCount;
+    }
 };
 } // namespace NEO
@@ -108,6 +108,7 @@ class MockKernel : public Kernel {
     using Kernel::enqueuedLocalWorkSizeZ;
     using Kernel::executionType;
     using Kernel::getDevice;
+    using Kernel::getIsaHash;
     using Kernel::globalWorkOffsetX;
     using Kernel::globalWorkOffsetY;
     using Kernel::globalWorkOffsetZ;
@@ -125,6 +126,7 @@ class MockKernel : public Kernel {
     using Kernel::kernelSubmissionMap;
     using Kernel::kernelSvmGfxAllocations;
     using Kernel::kernelUnifiedMemoryGfxAllocations;
+    using Kernel::localWorkSizeTuningMap;
     using Kernel::localWorkSizeX;
     using Kernel::localWorkSizeX2;
     using Kernel::localWorkSizeY;
@@ -17,6 +17,7 @@
 
 #include "gmock/gmock.h"
 
+#include <mutex>
 #include <string>
 
 namespace NEO {
@@ -39,6 +40,7 @@ class MockProgram : public Program {
 
     using Program::applyAdditionalOptions;
     using Program::areSpecializationConstantsInitialized;
+    using Program::asyncBuildPending;
     using Program::blockKernelManager;
     using Program::buildInfos;
     using Program::context;
@@ -97,6 +99,7 @@ class MockProgram : public Program {
     }
     void addKernelInfo(KernelInfo *inInfo, uint32_t rootDeviceIndex) {
         buildInfos[rootDeviceIndex].kernelInfoArray.push_back(inInfo);
+        updateKernelInfoIndex(rootDeviceIndex);
     }
     std::vector<KernelInfo *> &getParentKernelInfoArray(uint32_t rootDeviceIndex) {
         return buildInfos[rootDeviceIndex].parentKernelInfoArray;
@@ -158,11 +161,13 @@ class MockProgram : public Program {
     }
     cl_int processGenBinary(const ClDevice &clDevice) override {
         auto rootDeviceIndex = clDevice.getRootDeviceIndex();
+        std::unique_lock<std::mutex> lock{processGenBinaryMutex};
         if (processGenBinaryCalledPerRootDevice.find(rootDeviceIndex) == processGenBinaryCalledPerRootDevice.end()) {
             processGenBinaryCalledPerRootDevice.insert({rootDeviceIndex, 1});
         } else {
             processGenBinaryCalledPerRootDevice[rootDeviceIndex]++;
         }
+        lock.unlock();
         return Program::processGenBinary(clDevice);
     }
 
@@ -185,6 +190,7 @@ class MockProgram : public Program {
     }
 
     std::map<uint32_t, int> processGenBinaryCalledPerRootDevice;
+    std::mutex processGenBinaryMutex;
     std::map<uint32_t, int> replaceDeviceBinaryCalledPerRootDevice;
     static int initInternalOptionsCalled;
     bool contextSet = false;
@@ -16,7 +16,7 @@ class MockTagAllocator : public TagAllocator<TagType> {
   public:
     using BaseClass = TagAllocator<TagType>;
     using BaseClass::freeTags;
-    using BaseClass::usedTags;
+    using BaseClass::usedTagsCount;
     using NodeType = typename BaseClass::NodeType;
 
     MockTagAllocator(uint32_t rootDeviceIndex, MemoryManager *memoryManager, size_t tagCount = 10)
@@ -47,7 +47,7 @@ class MockTimestampPacketContainer : public TimestampPacketContainer {
     }
 
     TagNodeBase *getNode(size_t position) {
-        return timestampPacketNodes.at(position);
+        return timestampPacketNodes[position];
     }
 };
 } // namespace NEO
@@ -189,6 +189,27 @@ TEST_F(DeviceFactoryTest, givenCreateMultipleRootDevicesDebugFlagWhenPrepareDevi
     EXPECT_EQ(requiredDeviceCount, executionEnvironment->rootDeviceEnvironments.size());
 }
 
+TEST_F(DeviceFactoryTest, givenMultipleRootDevicesWhenPrepareDeviceEnvironmentsIsCalledInParallelOrSequentiallyThenAllEnvironmentsAreInitialized) {
+    DebugManagerStateRestore stateRestore;
+    auto requiredDeviceCount = 4u;
+    DebugManager.flags.CreateMultipleRootDevices.set(requiredDeviceCount);
+
+    for (auto parallelInitialization : {1, 0}) {
+        DebugManager.flags.ParallelRootDeviceInitialization.set(parallelInitialization);
+        platformsImpl->clear();
+        executionEnvironment = constructPlatform()->peekExecutionEnvironment();
+
+        bool success = DeviceFactory::prepareDeviceEnvironments(*executionEnvironment);
+
+        ASSERT_TRUE(success);
+        ASSERT_EQ(requiredDeviceCount, executionEnvironment->rootDeviceEnvironments.size());
+        for (auto &rootDeviceEnvironment : executionEnvironment->rootDeviceEnvironments) {
+            EXPECT_NE(nullptr, rootDeviceEnvironment->osInterface.get());
+            EXPECT_EQ(defaultHwInfo->platform.eProductFamily, rootDeviceEnvironment->getHardwareInfo()->platform.eProductFamily);
+        }
+    }
+}
+
 TEST_F(DeviceFactoryTest, givenDebugFlagSetWhenPrepareDeviceEnvironmentsIsCalledThenOverrideGpuAddressSpace) {
     DebugManagerStateRestore restore;
     DebugManager.flags.OverrideGpuAddressSpace.set(12);
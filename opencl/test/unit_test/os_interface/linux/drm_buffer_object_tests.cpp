@@ -91,6 +91,48 @@ TEST_F(DrmBufferObjectTest, GivenInvalidParamsWhenCallingExecThenEfaultIsReturne
     EXPECT_EQ(EFAULT, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, nullptr, 0u, &execObjectsStorage));
 }
 
+TEST_F(DrmBufferObjectTest, givenFilledExecObjectsCountWhenCallingExecThenOnlyRemainingExecObjectsAreFilled) {
+    mock->ioctl_expected.total = 1;
+    mock->ioctl_res = 0;
+
+    TestedBufferObject residentBo(this->mock.get());
+    BufferObject *residency[] = {&residentBo};
+    drm_i915_gem_exec_object2 execObjects[2] = {};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 1u));
+    EXPECT_EQ(nullptr, residentBo.execObjectPointerFilled);
+    EXPECT_EQ(&execObjects[1], bo->execObjectPointerFilled);
+    EXPECT_EQ(2u, mock->execBuffer.buffer_count);
+}
+
+TEST_F(DrmBufferObjectTest, givenExecFencesWhenCallingExecThenFenceArrayIsPassedToExecBuffer) {
+    mock->ioctl_expected.total = 1;
+    mock->ioctl_res = 0;
+
+    drm_i915_gem_exec_object2 execObjectsStorage = {};
+    drm_i915_gem_exec_fence execFences[2] = {{1u, I915_EXEC_FENCE_WAIT}, {2u, I915_EXEC_FENCE_SIGNAL}};
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, nullptr, 0u, &execObjectsStorage, 0u, execFences, 2u));
+    EXPECT_EQ(static_cast<uint64_t>(I915_EXEC_FENCE_ARRAY), mock->execBuffer.flags & I915_EXEC_FENCE_ARRAY);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(execFences), mock->execBuffer.cliprects_ptr);
+    EXPECT_EQ(2u, mock->execBuffer.num_cliprects);
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectFilledByBufferObjectWhenBufferObjectOrContextChangesThenExecObjectIsNotConsideredFilled) {
+    drm_i915_gem_exec_object2 execObject = {};
+    bo->setAddress(0x1000);
+    bo->fillExecObject(execObject, osContext.get(), 0, 1);
+
+    EXPECT_TRUE(bo->isExecObjectFilled(execObject, 1));
+    EXPECT_FALSE(bo->isExecObjectFilled(execObject, 2));
+
+    bo->setAddress(0x2000);
+    EXPECT_FALSE(bo->isExecObjectFilled(execObject, 1));
+
+    bo->setAddress(0x1000);
+    bo->markForCapture();
+    EXPECT_FALSE(bo->isExecObjectFilled(execObject, 1));
+}
+
 TEST_F(DrmBufferObjectTest, WhenSettingTilingThenCallSucceeds) {
     mock->ioctl_expected.total = 1; //set_tiling
     auto ret = bo->setTiling(I915_TILING_X, 0);
@@ -7,12 +7,116 @@
 
 #include "shared/source/os_interface/linux/cache_info_impl.h"
 
+#include "opencl/test/unit_test/os_interface/linux/drm_mock.h"
+
 #include "gtest/gtest.h"
 
 using namespace NEO;
 
+namespace {
+struct DrmMockClos : public DrmMock {
+    using DrmMock::DrmMock;
+
+    CacheRegion closAlloc() override {
+        closAllocCalled++;
+        return closAllocResult;
+    }
+
+    uint16_t closAllocWays(CacheRegion closIndex, uint16_t cacheLevel, uint16_t numWays) override {
+        passedNumWays = numWays;
+        return failAllocWays ? 0 : numWays;
+    }
+
+    CacheRegion closFree(CacheRegion closIndex) override {
+        closFreeCalled++;
+        return closIndex;
+    }
+
+    CacheRegion closAllocResult = CacheRegion::Region1;
+    bool failAllocWays = false;
+    uint16_t passedNumWays = 0;
+    uint32_t closAllocCalled = 0;
+    uint32_t closFreeCalled = 0;
+};
+} // namespace
+
 TEST(DrmCacheInfoTest, givenCacheInfoCreatedWhenCallingGetCacheRegionThenReturnZero) {
-    CacheInfoImpl cacheInfo;
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drm(*executionEnvironment->rootDeviceEnvironments[0]);
+    CacheInfoImpl cacheInfo(drm, 0, 0, 0);
 
     EXPECT_FALSE(cacheInfo.getCacheRegion(1024, CacheRegion::Default));
 }
+
+TEST(DrmCacheInfoTest, givenReservableCacheWhenRegionIsRequestedForFirstTimeThenRegionIsReservedAndReusedLater) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMockClos drm(*executionEnvironment->rootDeviceEnvironments[0]);
+    {
+        CacheInfoImpl cacheInfo(drm, 32 * MemoryConstants::kiloByte, 2, 8);
+
+        EXPECT_TRUE(cacheInfo.getCacheRegion(0, CacheRegion::Region1));
+        EXPECT_EQ(4u, drm.passedNumWays);
+        EXPECT_TRUE(cacheInfo.getCacheRegion(16 * MemoryConstants::kiloByte, CacheRegion::Region1));
+        EXPECT_FALSE(cacheInfo.getCacheRegion(17 * MemoryConstants::kiloByte, CacheRegion::Region1));
+        EXPECT_EQ(1u, drm.closAllocCalled);
+        EXPECT_EQ(0u, drm.closFreeCalled);
+    }
+    EXPECT_EQ(1u, drm.closFreeCalled);
+}
+
+TEST(DrmCacheInfoTest, givenReservationSizeWhenReservingCacheRegionThenWholeWaysAreReservedWithinLimits) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMockClos drm(*executionEnvironment->rootDeviceEnvironments[0]);
+    CacheInfoImpl cacheInfo(drm, 32 * MemoryConstants::kiloByte, 1, 8);
+
+    EXPECT_EQ(CacheRegion::None, cacheInfo.reserveCacheRegion(0));
+    EXPECT_EQ(CacheRegion::None, cacheInfo.reserveCacheRegion(33 * MemoryConstants::kiloByte));
+    EXPECT_EQ(0u, drm.closAllocCalled);
+
+    EXPECT_EQ(CacheRegion::Region1, cacheInfo.reserveCacheRegion(MemoryConstants::kiloByte));
+    EXPECT_EQ(1u, drm.passedNumWays);
+    EXPECT_TRUE(cacheInfo.getCacheRegion(4 * MemoryConstants::kiloByte, CacheRegion::Region1));
+
+    EXPECT_EQ(CacheRegion::None, cacheInfo.reserveCacheRegion(MemoryConstants::kiloByte));
+    EXPECT_EQ(1u, drm.closAllocCalled);
+
+    EXPECT_EQ(CacheRegion::Region1, cacheInfo.freeCacheRegion(CacheRegion::Region1));
+    EXPECT_EQ(CacheRegion::None, cacheInfo.freeCacheRegion(CacheRegion::Region1));
+    EXPECT_EQ(1u, drm.closFreeCalled);
+}
+
+TEST(DrmCacheInfoTest, givenWaysCannotBeAllocatedWhenReservingCacheRegionThenRegionIsFreed) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMockClos drm(*executionEnvironment->rootDeviceEnvironments[0]);
+    drm.failAllocWays = true;
+    CacheInfoImpl cacheInfo(drm, 32 * MemoryConstants::kiloByte, 2, 8);
+
+    EXPECT_FALSE(cacheInfo.getCacheRegion(0, CacheRegion::Region1));
+    EXPECT_EQ(1u, drm.closFreeCalled);
+}
+
+TEST(DrmCacheInfoTest, givenKernelReturnsOtherRegionWhenRegionIsRequestedThenReservationIsReleasedAndFalseIsReturned) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMockClos drm(*executionEnvironment->rootDeviceEnvironments[0]);
+    drm.closAllocResult = CacheRegion::Region2;
+    CacheInfoImpl cacheInfo(drm, 32 * MemoryConstants::kiloByte, 2, 8);
+
+    EXPECT_FALSE(cacheInfo.getCacheRegion(0, CacheRegion::Region1));
+    EXPECT_EQ(1u, drm.closFreeCalled);
+    EXPECT_FALSE(cacheInfo.getCacheRegion(0, CacheRegion::None));
+}
+
+TEST(DrmCacheInfoTest, givenUpstreamKernelWhenReservingClosThenReservationIsNotSupported) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drm(*executionEnvironment->rootDeviceEnvironments[0]);
+    CacheInfoImpl cacheInfo(drm, 32 * MemoryConstants::kiloByte, 2, 8);
+
+    EXPECT_EQ(CacheRegion::None, cacheInfo.reserveCacheRegion(MemoryConstants::kiloByte));
+    EXPECT_FALSE(cacheInfo.getCacheRegion(0, CacheRegion::Region1));
+}
@@ -579,6 +579,37 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenTaskThatRequiresLargeResou
     EXPECT_EQ(11u, execStorage.size());
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenSameAllocationsFlushedAgainWhenGettingFilledExecObjectsCountThenExecObjectsOfPreviousSubmissionAreReused) {
+    DebugManagerStateRestore restorer;
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto allocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+    csr->makeResident(*allocation);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+    ASSERT_EQ(1u, testedCsr->execObjectsResidency.size());
+    EXPECT_EQ(bo, testedCsr->execObjectsResidency[0]);
+    EXPECT_EQ(0u, testedCsr->residency.size());
+
+    auto drmContextId = static_cast<const OsContextLinux &>(csr->getOsContext()).getDrmContextIds()[0];
+    testedCsr->residency.push_back(bo);
+    EXPECT_EQ(1u, testedCsr->getFilledExecObjectsCount(0u, drmContextId));
+    EXPECT_EQ(0u, testedCsr->getFilledExecObjectsCount(1u, drmContextId));
+
+    DebugManager.flags.ReuseDrmExecObjects.set(0);
+    EXPECT_EQ(0u, testedCsr->getFilledExecObjectsCount(0u, drmContextId));
+    testedCsr->residency.clear();
+
+    mm->freeGraphicsMemory(commandBuffer);
+    mm->freeGraphicsMemory(allocation);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenGemCloseWorkerInactiveModeWhenMakeResidentIsCalledThenRefCountsAreNotUpdated) {
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
 
@@ -1661,3 +1692,40 @@ HWTEST_TEMPLATED_F(DrmCommandStreamTest, givenPageTableManagerAndMapFalseWhenUpd
 
     EXPECT_TRUE(result);
 }
+
+HWTEST_TEMPLATED_F(DrmCommandStreamTest, givenBatchedAuxTableUpdatesWhenMappingIsRequestedThenItIsSubmittedOnFlushOfPendingUpdates) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.BatchAuxTableUpdates.set(1);
+
+    auto mockMngr = new MockGmmPageTableMngr();
+    executionEnvironment.rootDeviceEnvironments[0]->pageTableManager.reset(mockMngr);
+    auto pageTableManager = executionEnvironment.rootDeviceEnvironments[0]->pageTableManager.get();
+    auto gmm = std::make_unique<MockGmm>();
+    GMM_DDI_UPDATEAUXTABLE ddiUpdateAuxTable = {};
+    EXPECT_CALL(*mockMngr, updateAuxTable(::testing::_)).Times(0);
+    EXPECT_TRUE(pageTableManager->updateAuxTable(0x1000, gmm.get(), true));
+    ::testing::Mock::VerifyAndClearExpectations(mockMngr);
+
+    EXPECT_CALL(*mockMngr, updateAuxTable(::testing::_)).Times(1).WillOnce(::testing::Invoke([&](const GMM_DDI_UPDATEAUXTABLE *arg) {ddiUpdateAuxTable = *arg; return GMM_SUCCESS; }));
+    EXPECT_TRUE(pageTableManager->flushPendingAuxTableUpdates());
+    EXPECT_EQ(ddiUpdateAuxTable.BaseGpuVA, 0x1000ull);
+    EXPECT_EQ(ddiUpdateAuxTable.BaseResInfo, gmm->gmmResourceInfo->peekHandle());
+    EXPECT_EQ(ddiUpdateAuxTable.Map, 1u);
+
+    EXPECT_TRUE(pageTableManager->flushPendingAuxTableUpdates());
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamTest, givenBatchedAuxTableUpdatesWhenPendingMappingIsUnmappedThenNoUpdateIsSubmitted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.BatchAuxTableUpdates.set(1);
+
+    auto mockMngr = new MockGmmPageTableMngr();
+    executionEnvironment.rootDeviceEnvironments[0]->pageTableManager.reset(mockMngr);
+    auto pageTableManager = executionEnvironment.rootDeviceEnvironments[0]->pageTableManager.get();
+    auto gmm = std::make_unique<MockGmm>();
+    EXPECT_CALL(*mockMngr, updateAuxTable(::testing::_)).Times(0);
+
+    EXPECT_TRUE(pageTableManager->updateAuxTable(0x1000, gmm.get(), true));
+    EXPECT_TRUE(pageTableManager->updateAuxTable(0x1000, gmm.get(), false));
+    EXPECT_TRUE(pageTableManager->flushPendingAuxTableUpdates());
+}
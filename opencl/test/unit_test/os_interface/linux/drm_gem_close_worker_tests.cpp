@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
@@ -168,24 +169,84 @@ TEST_F(DrmGemCloseWorkerTests, givenAllocationWhenAskedForUnreferenceWithForceFl
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenThreadIsClosed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::threads;
     };
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
-    EXPECT_NE(nullptr, worker->thread);
+    EXPECT_FALSE(worker->threads.empty());
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_TRUE(worker->threads.empty());
 }
 
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTimeWithBlockingFlagThenThreadIsClosed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::threads;
     };
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
     worker->close(true);
     worker->close(true);
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_TRUE(worker->threads.empty());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDefaultSettingsWhenCreatingWorkerThenSingleThreadIsCreated) {
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    EXPECT_EQ(DrmGemCloseWorker::defaultWorkerThreadsCount, worker->getWorkerThreadsCount());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenGemCloseWorkerThreadsCountSetWhenCreatingWorkerThenRequestedThreadsAreCreatedUpToLimit) {
+    DebugManagerStateRestore restorer;
+
+    DebugManager.flags.GemCloseWorkerThreadsCount.set(4);
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    EXPECT_EQ(4u, worker->getWorkerThreadsCount());
+
+    DebugManager.flags.GemCloseWorkerThreadsCount.set(1000);
+    worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    EXPECT_EQ(DrmGemCloseWorker::maxWorkerThreadsCount, worker->getWorkerThreadsCount());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleWorkerThreadsWhenManyBufferObjectsArePushedThenAllAreClosedAndStatisticsAreUpdated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.GemCloseWorkerThreadsCount.set(4);
+
+    constexpr uint32_t bufferObjectsCount = 4 * DrmGemCloseWorker::maxBatchSize + 1;
+    this->drmMock->gem_close_expected = bufferObjectsCount;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    for (auto i = 0u; i < bufferObjectsCount; i++) {
+        worker->push(new BufferObject(this->drmMock, i + 1, 0, 1));
+    }
+
+    while (!worker->isEmpty() && (deadCnt-- > 0))
+        pthread_yield();
+
+    worker->close(true);
+
+    auto statistics = worker->getStatistics();
+    EXPECT_EQ(bufferObjectsCount, statistics.pushedCount);
+    EXPECT_EQ(bufferObjectsCount, statistics.closedCount);
+    EXPECT_EQ(0u, statistics.pendingCount);
+    EXPECT_LE(1u, statistics.maxPendingCount);
+    EXPECT_LE(statistics.maxPendingCount, bufferObjectsCount);
+    EXPECT_LE(bufferObjectsCount / DrmGemCloseWorker::maxBatchSize, statistics.batchesCount);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenWorkerWithPendingBufferObjectsWhenClosedWithBlockingFlagThenAllBufferObjectsAreClosed) {
+    this->drmMock->gem_close_expected = 3;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    {
+        std::lock_guard<std::mutex> lock(this->drmMock->mutex);
+        for (auto i = 0u; i < 3u; i++) {
+            worker->push(new BufferObject(this->drmMock, i + 1, 0, 1));
+        }
+        EXPECT_LE(1u, worker->getStatistics().maxPendingCount);
+    }
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(3u, worker->getStatistics().closedCount);
 }
@@ -985,6 +985,60 @@ TEST_F(DrmMemoryManagerLocalMemoryTest, given2MbAlignmentAllowedWhenAllocatingAl
     }
 }
 
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenLargePageThresholdWhenAllocatingBufferInDevicePoolThenSizeIsAlignedTo2MbAndLargePageBackingIsCounted) {
+    DebugManager.flags.LocalMemoryLargePageThreshold.set(4 * MemoryConstants::megaByte);
+    AllocationData allocationData;
+    allocationData.allFlags = 0;
+    allocationData.flags.allocateMemory = true;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER;
+    allocationData.flags.resource48Bit = true;
+    MemoryManager::AllocationStatus allocationStatus;
+
+    allocationData.size = 4 * MemoryConstants::megaByte - MemoryConstants::pageSize64k;
+    auto smallAllocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryInDevicePool(allocationData, allocationStatus));
+    ASSERT_NE(nullptr, smallAllocation);
+    EXPECT_EQ(0u, smallAllocation->getLargePageBackingSize());
+    EXPECT_EQ(allocationData.size, smallAllocation->getUnderlyingBufferSize());
+    EXPECT_EQ(0u, memoryManager->getLargePageBackedMemorySize());
+
+    allocationData.size = 4 * MemoryConstants::megaByte + MemoryConstants::pageSize64k;
+    auto largeAllocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryInDevicePool(allocationData, allocationStatus));
+    ASSERT_NE(nullptr, largeAllocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, allocationStatus);
+    EXPECT_EQ(6 * MemoryConstants::megaByte, largeAllocation->getUnderlyingBufferSize());
+    EXPECT_EQ(6 * MemoryConstants::megaByte, largeAllocation->getLargePageBackingSize());
+    EXPECT_EQ(6 * MemoryConstants::megaByte, largeAllocation->getBO()->peekSize());
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2Mb>(largeAllocation->getGpuAddress()));
+    EXPECT_TRUE(isAllocationWithinHeap(*largeAllocation, HeapIndex::HEAP_STANDARD2MB));
+    EXPECT_EQ(6 * MemoryConstants::megaByte, memoryManager->getLargePageBackedMemorySize());
+
+    memoryManager->freeGraphicsMemory(largeAllocation);
+    memoryManager->freeGraphicsMemory(smallAllocation);
+    EXPECT_EQ(0u, memoryManager->getLargePageBackedMemorySize());
+    EXPECT_EQ(6 * MemoryConstants::megaByte, memoryManager->getMaxLargePageBackedMemorySize());
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, given2MbVaAlignmentDisabledWhenAllocatingBufferAboveLargePageThresholdThenLargePagesAreNotUsed) {
+    DebugManager.flags.LocalMemoryLargePageThreshold.set(0);
+    DebugManager.flags.AlignLocalMemoryVaTo2MB.set(0);
+    AllocationData allocationData;
+    allocationData.allFlags = 0;
+    allocationData.size = 4 * MemoryConstants::megaByte + MemoryConstants::pageSize64k;
+    allocationData.flags.allocateMemory = true;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER;
+    allocationData.flags.resource48Bit = true;
+    MemoryManager::AllocationStatus allocationStatus;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryInDevicePool(allocationData, allocationStatus));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0u, allocation->getLargePageBackingSize());
+    EXPECT_EQ(allocationData.size, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(0u, memoryManager->getLargePageBackedMemorySize());
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryManagerLocalMemoryTest, givenExtendedHeapPreferredAnd2MbAlignmentAllowedWhenAllocatingAllocationBiggerThenPrefer2MbHeap) {
     if (memoryManager->getGfxPartition(0)->getHeapLimit(HeapIndex::HEAP_EXTENDED) == 0) {
         GTEST_SKIP();
@@ -27,6 +27,7 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/helpers/variable_backup.h"
 
 #include "opencl/source/event/event.h"
 #include "opencl/source/helpers/memory_properties_helpers.h"
@@ -369,6 +370,29 @@ TEST_F(DrmMemoryManagerTest, whenPeekInternalHandleIsCalledThenBoIsReturend) {
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+namespace SysCalls {
+extern uint32_t closeFuncCalled;
+} // namespace SysCalls
+
+TEST_F(DrmMemoryManagerTest, whenPeekDmaBufFdIsCalledMultipleTimesThenFdIsExportedOnceAndClosedWhenAllocationIsFreed) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+    mock->ioctl_expected.handleToPrimeFd = 1;
+    mock->outputFd = 1337;
+    auto allocation = static_cast<DrmAllocation *>(this->memoryManager->allocateGraphicsMemoryWithProperties(createAllocationProperties(rootDeviceIndex, 10 * MemoryConstants::pageSize, true)));
+    ASSERT_NE(allocation->getBO(), nullptr);
+    EXPECT_EQ(-1, allocation->getExportedDmaBufFd());
+
+    EXPECT_EQ(1337, allocation->peekDmaBufFd(this->memoryManager));
+    EXPECT_EQ(1337, allocation->peekDmaBufFd(this->memoryManager));
+    EXPECT_EQ(1337, allocation->getExportedDmaBufFd());
+
+    VariableBackup<uint32_t> closeCalledBackup(&SysCalls::closeFuncCalled, 0u);
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+}
+
 TEST_F(DrmMemoryManagerTest, givenDrmContextIdWhenAllocationIsCreatedThenPinWithPassedDrmContextId) {
     mock->ioctl_expected.gemUserptr = 2;
     mock->ioctl_expected.execbuffer2 = 1;
@@ -2415,6 +2439,70 @@ TEST_F(DrmMemoryManagerTest, givenTwoGraphicsAllocationsThatDoesnShareTheSameBuf
     memoryManager->freeGraphicsMemory(graphicsAllocation2);
 }
 
+TEST_F(DrmMemoryManagerTest, givenSharedHandleWithValidInodeWhenAllocationIsCreatedAgainThenPrimeFdToHandleIsNotCalledAndBoIsReused) {
+    mock->ioctl_expected.primeFdToHandle = 1;
+    mock->ioctl_expected.gemClose = 1;
+    mock->ioctl_expected.gemWait = 2;
+
+    fstatReturn = 0;
+    fstatInode = 0x1234;
+    osHandle sharedHandle = 1u;
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::SHARED_BUFFER, false, mockDeviceBitfield);
+    auto graphicsAllocation = static_cast<DrmAllocation *>(memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, properties, false));
+    auto graphicsAllocation2 = static_cast<DrmAllocation *>(memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, properties, false));
+    ASSERT_NE(nullptr, graphicsAllocation);
+    ASSERT_NE(nullptr, graphicsAllocation2);
+
+    EXPECT_EQ(2, fstatCalledCount);
+    EXPECT_EQ(1, lseekCalledCount);
+    EXPECT_EQ(graphicsAllocation->getBO(), graphicsAllocation2->getBO());
+    EXPECT_EQ(2u, graphicsAllocation->getBO()->getRefCount());
+    EXPECT_EQ(1u, memoryManager->sharingBufferObjects.size());
+    EXPECT_EQ(1u, memoryManager->importedHandles.size());
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(1u, memoryManager->importedHandles.size());
+    memoryManager->freeGraphicsMemory(graphicsAllocation2);
+    EXPECT_EQ(0u, memoryManager->sharingBufferObjects.size());
+    EXPECT_EQ(0u, memoryManager->importedHandles.size());
+}
+
+TEST_F(DrmMemoryManagerTest, givenSharedHandleReusedForDifferentDmaBufWhenAllocationIsCreatedThenPrimeFdToHandleIsCalledAgain) {
+    mock->ioctl_expected.primeFdToHandle = 2;
+    mock->ioctl_expected.gemClose = 2;
+    mock->ioctl_expected.gemWait = 2;
+
+    fstatReturn = 0;
+    fstatInode = 0x1234;
+    osHandle sharedHandle = 1u;
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::SHARED_BUFFER, false, mockDeviceBitfield);
+    auto graphicsAllocation = static_cast<DrmAllocation *>(memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, properties, false));
+    fstatInode++;
+    mock->outputHandle++;
+    auto graphicsAllocation2 = static_cast<DrmAllocation *>(memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, properties, false));
+    ASSERT_NE(nullptr, graphicsAllocation);
+    ASSERT_NE(nullptr, graphicsAllocation2);
+
+    EXPECT_NE(graphicsAllocation->getBO(), graphicsAllocation2->getBO());
+    EXPECT_EQ(1u, graphicsAllocation->getBO()->getRefCount());
+    EXPECT_EQ(2u, memoryManager->sharingBufferObjects.size());
+    ASSERT_EQ(1u, memoryManager->importedHandles.size());
+    EXPECT_EQ(graphicsAllocation2->getBO(), memoryManager->importedHandles.begin()->second.bo);
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    memoryManager->freeGraphicsMemory(graphicsAllocation2);
+    EXPECT_EQ(0u, memoryManager->importedHandles.size());
+}
+
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenSharedHandleWhenGettingIdentityThenInodeIsReturnedOrZeroWhenFstatFails) {
+    fstatReturn = 0;
+    fstatInode = 0x1234;
+    EXPECT_EQ(0x1234u, memoryManager->getSharedHandleIdentity(1u));
+
+    fstatReturn = -1;
+    EXPECT_EQ(0u, memoryManager->getSharedHandleIdentity(1u));
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDrmMemoryManagerWhenCreateAllocationFromNtHandleIsCalledThenReturnNullptr) {
     auto graphicsAllocation = memoryManager->createGraphicsAllocationFromNTHandle(reinterpret_cast<void *>(1), 0);
     EXPECT_EQ(nullptr, graphicsAllocation);
@@ -2943,6 +3031,189 @@ TEST_F(DrmMemoryManagerUSMHostAllocationTests,
     alignedFree(hostPtr);
 }
 
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenHugePageThresholdNotReachedWhenAllocatingHostUsmThenAllocationIsNotHugePageBacked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmHostHugePageThreshold.set(MemoryConstants::pageSize2Mb);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::megaByte;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(0u, alloc->getHugePageMappingSize());
+    EXPECT_EQ(MemoryConstants::megaByte, alloc->getUnderlyingBufferSize());
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenHugePageThresholdReachedWhenAllocatingHostUsmThenHugeTlbMappingOfWholeHugePagesIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmHostHugePageThreshold.set(MemoryConstants::megaByte);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    static int mmapFlags = 0;
+    memoryManager->mmapFunction = [](void *addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept {
+        mmapFlags = flags;
+        return mmapMock(addr, length, prot, flags, fd, offset);
+    };
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::megaByte + MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_NE(0, mmapFlags & MAP_HUGETLB);
+    EXPECT_EQ(MemoryConstants::pageSize2Mb, alloc->getHugePageMappingSize());
+    EXPECT_EQ(MemoryConstants::pageSize2Mb, alloc->getUnderlyingBufferSize());
+    EXPECT_EQ(alloc->getUnderlyingBuffer(), alloc->getDriverAllocatedCpuPtr());
+    EXPECT_FALSE(alloc->isBufferObjectCacheable());
+
+    auto cpuPtr = alloc->getDriverAllocatedCpuPtr();
+    EXPECT_NE(mmapVector.end(), std::find(mmapVector.begin(), mmapVector.end(), cpuPtr));
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+    EXPECT_EQ(mmapVector.end(), std::find(mmapVector.begin(), mmapVector.end(), cpuPtr));
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenHugeTlbMappingFailingWhenAllocatingHostUsmOverHugePageThresholdThenAlignedAnonymousMappingIsAdvisedForTransparentHugePages) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmHostHugePageThreshold.set(0);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    static void *reservedMemory = nullptr;
+    static std::vector<std::pair<void *, size_t>> unmappedRanges;
+    static std::pair<void *, size_t> advisedRange;
+    static int advice = 0;
+    reservedMemory = alignedMalloc(3 * MemoryConstants::pageSize2Mb, MemoryConstants::pageSize2Mb);
+    unmappedRanges.clear();
+    auto alignedReservation = ptrOffset(reservedMemory, MemoryConstants::pageSize2Mb);
+    auto unalignedReservation = ptrOffset(reservedMemory, MemoryConstants::pageSize2Mb - MemoryConstants::pageSize64k);
+
+    memoryManager->mmapFunction = [](void *addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept {
+        if (flags & MAP_HUGETLB) {
+            return MAP_FAILED;
+        }
+        return ptrOffset(reservedMemory, MemoryConstants::pageSize2Mb - MemoryConstants::pageSize64k);
+    };
+    memoryManager->munmapFunction = [](void *addr, size_t length) noexcept {
+        unmappedRanges.push_back({addr, length});
+        return 0;
+    };
+    memoryManager->madviseFunction = [](void *addr, size_t length, int adv) noexcept {
+        advisedRange = {addr, length};
+        advice = adv;
+        return 0;
+    };
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize2Mb;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(alignedReservation, alloc->getUnderlyingBuffer());
+    EXPECT_EQ(alignedReservation, reinterpret_cast<void *>(alloc->getGpuAddress()));
+    EXPECT_EQ(MADV_HUGEPAGE, advice);
+    EXPECT_EQ(alignedReservation, advisedRange.first);
+    EXPECT_EQ(MemoryConstants::pageSize2Mb, advisedRange.second);
+
+    ASSERT_EQ(2u, unmappedRanges.size());
+    EXPECT_EQ(unalignedReservation, unmappedRanges[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize64k, unmappedRanges[0].second);
+    EXPECT_EQ(ptrOffset(alignedReservation, MemoryConstants::pageSize2Mb), unmappedRanges[1].first);
+    EXPECT_EQ(MemoryConstants::pageSize2Mb - MemoryConstants::pageSize64k, unmappedRanges[1].second);
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+    ASSERT_EQ(3u, unmappedRanges.size());
+    EXPECT_EQ(alignedReservation, unmappedRanges[2].first);
+    EXPECT_EQ(MemoryConstants::pageSize2Mb, unmappedRanges[2].second);
+
+    alignedFree(reservedMemory);
+}
+
+namespace SysCalls {
+extern uint32_t mbindFuncCalled;
+extern int mbindFuncArgMode;
+extern unsigned long mbindFuncArgNodeMask;
+extern long mbindFuncRetVal;
+} // namespace SysCalls
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenNumaNodeOverriddenWhenAllocatingHostUsmThenBackingMemoryPrefersGivenNodeAndNodeIsReported) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.OverrideUsmNumaNode.set(3);
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+    VariableBackup<int> mbindModeBackup(&SysCalls::mbindFuncArgMode, 0);
+    VariableBackup<unsigned long> mbindNodeMaskBackup(&SysCalls::mbindFuncArgNodeMask, 0u);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    constexpr int mpolPreferred = 1;
+    EXPECT_EQ(1u, SysCalls::mbindFuncCalled);
+    EXPECT_EQ(mpolPreferred, SysCalls::mbindFuncArgMode);
+    EXPECT_EQ(1ul << 3, SysCalls::mbindFuncArgNodeMask);
+    EXPECT_EQ(3, alloc->getNumaNode());
+    EXPECT_NE(std::string::npos, alloc->getAllocationInfoString().find("NUMA node: 3"));
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenNumaPlacementDisabledWhenAllocatingHostUsmThenBackingMemoryIsNotBound) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUsmNumaPlacement.set(0);
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+    memoryManager->numaNodes[rootDeviceIndex] = 1;
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(0u, SysCalls::mbindFuncCalled);
+    EXPECT_EQ(-1, alloc->getNumaNode());
+    EXPECT_EQ(std::string::npos, alloc->getAllocationInfoString().find("NUMA node"));
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenRootDeviceNumaNodeKnownAndBindingFailsWhenAllocatingHostUsmThenNumaNodeIsNotReported) {
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+    VariableBackup<long> mbindRetValBackup(&SysCalls::mbindFuncRetVal, -1);
+    memoryManager->numaNodes[rootDeviceIndex] = 1;
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(1u, SysCalls::mbindFuncCalled);
+    EXPECT_EQ(-1, alloc->getNumaNode());
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDefaultDrmMemoryManagerWhenAskedForVirtualPaddingSupportThenTrueIsReturned) {
     EXPECT_TRUE(memoryManager->peekVirtualPaddingSupport());
 }
@@ -4414,4 +4685,308 @@ TEST_F(DrmMemoryManagerTest, givenDrmAllocationWithWithAlignmentFromUserptrWhenI
     auto allocation = static_cast<DrmAllocation *>(memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, 0, 0, 0x1000));
     EXPECT_EQ(allocation, nullptr);
 }
+
+TEST_F(DrmMemoryManagerTest, givenDefaultSettingsWhenDrmMemoryManagerIsCreatedThenBufferObjectReuseCacheIsDisabled) {
+    EXPECT_EQ(nullptr, memoryManager->getBufferObjectCache());
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectReuseCacheEnabledWhenAllocationIsFreedAndSameSizeIsAllocatedThenBufferObjectIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BufferObjectReuseCacheSize.set(MemoryConstants::megaByte);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    ASSERT_NE(nullptr, memoryManager->getBufferObjectCache());
+
+    allocationData.size = MemoryConstants::pageSize;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    auto cpuPtr = allocation->getUnderlyingBuffer();
+    auto gpuAddress = allocation->getGpuAddress();
+    memoryManager->freeGraphicsMemory(allocation);
+
+    auto statistics = memoryManager->getBufferObjectCache()->getStatistics();
+    EXPECT_EQ(1u, statistics.cachedCount);
+    EXPECT_EQ(MemoryConstants::pageSize, statistics.cachedSize);
+
+    allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(cpuPtr, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(gpuAddress, allocation->getGpuAddress());
+    EXPECT_EQ(cpuPtr, allocation->getDriverAllocatedCpuPtr());
+
+    statistics = memoryManager->getBufferObjectCache()->getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(0u, statistics.cachedCount);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectReuseCacheEnabledWhenSvmCpuAllocationIsFreedThenBufferObjectIsNotCached) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BufferObjectReuseCacheSize.set(MemoryConstants::megaByte);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.alignment = MemoryConstants::pageSize2Mb;
+    allocationData.type = GraphicsAllocation::AllocationType::SVM_CPU;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_FALSE(allocation->isBufferObjectCacheable());
+    memoryManager->freeGraphicsMemory(allocation);
+
+    EXPECT_EQ(0u, memoryManager->getBufferObjectCache()->getStatistics().cachedCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectReuseCacheEnabledWhenFreedBufferObjectIsBiggerThanCacheSizeThenItIsDestroyed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BufferObjectReuseCacheSize.set(MemoryConstants::pageSize);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+
+    allocationData.size = 2 * MemoryConstants::pageSize;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    auto statistics = memoryManager->getBufferObjectCache()->getStatistics();
+    EXPECT_EQ(0u, statistics.cachedCount);
+    EXPECT_EQ(0u, statistics.cachedSize);
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectReuseCacheEnabledWhenCachedSizeExceedsLimitThenOldestBufferObjectsAreEvicted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BufferObjectReuseCacheSize.set(2 * MemoryConstants::pageSize);
+    mock->ioctl_expected.gemUserptr = 3;
+    mock->ioctl_expected.gemClose = 3;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+
+    allocationData.size = MemoryConstants::pageSize;
+    DrmAllocation *allocations[3] = {};
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+        ASSERT_NE(nullptr, allocation);
+    }
+    for (auto &allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+
+    auto statistics = memoryManager->getBufferObjectCache()->getStatistics();
+    EXPECT_EQ(2u, statistics.cachedCount);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, statistics.cachedSize);
+    EXPECT_EQ(1u, statistics.evictions);
+
+    memoryManager->releaseBufferObjectCache();
+    EXPECT_EQ(0u, memoryManager->getBufferObjectCache()->getStatistics().cachedCount);
+}
+
+TEST(DrmBufferObjectCacheTest, givenCachedBufferObjectsWhenTakingThenOnlyMatchingEntryWithinTwiceRequestedSizeIsReturned) {
+    DrmBufferObjectCache cache(MemoryConstants::megaByte);
+    std::vector<DrmBufferObjectCache::CachedBufferObject> evicted;
+
+    DrmBufferObjectCache::CachedBufferObject entry;
+    entry.cpuPtr = reinterpret_cast<void *>(0x10000);
+    entry.size = 4 * MemoryConstants::pageSize;
+    entry.rootDeviceIndex = 1u;
+    EXPECT_TRUE(cache.store(entry, evicted));
+    EXPECT_TRUE(evicted.empty());
+
+    DrmBufferObjectCache::CachedBufferObject taken;
+    EXPECT_FALSE(cache.take(0u, 4 * MemoryConstants::pageSize, MemoryConstants::pageSize, false, taken));
+    EXPECT_FALSE(cache.take(1u, MemoryConstants::pageSize, MemoryConstants::pageSize, false, taken));
+    EXPECT_FALSE(cache.take(1u, 4 * MemoryConstants::pageSize, MemoryConstants::pageSize, true, taken));
+    EXPECT_FALSE(cache.take(1u, 4 * MemoryConstants::pageSize, MemoryConstants::megaByte, false, taken));
+    EXPECT_TRUE(cache.take(1u, 3 * MemoryConstants::pageSize, MemoryConstants::pageSize, false, taken));
+    EXPECT_EQ(entry.cpuPtr, taken.cpuPtr);
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(4u, statistics.misses);
+    EXPECT_EQ(0u, statistics.cachedSize);
+}
+
+TEST(DrmBufferObjectCacheTest, givenFullBucketWhenStoringThenOldestEntryOfThisBucketIsEvicted) {
+    DrmBufferObjectCache cache(MemoryConstants::gigaByte);
+    std::vector<DrmBufferObjectCache::CachedBufferObject> evicted;
+
+    DrmBufferObjectCache::CachedBufferObject entry;
+    entry.size = MemoryConstants::pageSize;
+    for (auto i = 0u; i <= DrmBufferObjectCache::maxEntriesPerBucket; i++) {
+        entry.cpuPtr = reinterpret_cast<void *>(static_cast<uintptr_t>((i + 1) * MemoryConstants::pageSize));
+        EXPECT_TRUE(cache.store(entry, evicted));
+    }
+
+    ASSERT_EQ(1u, evicted.size());
+    EXPECT_EQ(reinterpret_cast<void *>(MemoryConstants::pageSize), evicted[0].cpuPtr);
+    EXPECT_EQ(DrmBufferObjectCache::maxEntriesPerBucket, cache.getStatistics().cachedCount);
+
+    evicted.clear();
+    cache.release(evicted);
+    EXPECT_EQ(DrmBufferObjectCache::maxEntriesPerBucket, evicted.size());
+    EXPECT_EQ(0u, cache.getStatistics().cachedCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenLockedMappingCacheEnabledWhenAllocationWithoutCpuPtrIsLockedAgainThenCachedMappingIsReusedWithoutIoctls) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LockedMappingCacheSize.set(MemoryConstants::megaByte);
+    mock->ioctl_expected.gemCreate = 1;
+    mock->ioctl_expected.gemMmap = 1;
+    mock->ioctl_expected.gemSetTiling = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    ASSERT_NE(nullptr, memoryManager->getMappingCache());
+
+    cl_image_desc imgDesc = {};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 512;
+    imgDesc.image_height = 512;
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    imgInfo.imgDesc = Image::convertDescriptor(imgDesc);
+    imgInfo.size = 4096u;
+    imgInfo.rowPitch = 512u;
+
+    AllocationData allocationData;
+    allocationData.imgInfo = &imgInfo;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryForImage(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+
+    // allocation not used by GPU yet, so lock skips CPU domain transition
+    auto ptr = memoryManager->lockResource(allocation);
+    EXPECT_NE(nullptr, ptr);
+    memoryManager->unlockResource(allocation);
+    EXPECT_EQ(nullptr, bo->peekLockedAddress());
+    EXPECT_EQ(1u, memoryManager->getMappingCache()->getStatistics().cachedCount);
+
+    EXPECT_EQ(ptr, memoryManager->lockResource(allocation));
+    EXPECT_EQ(ptr, bo->peekLockedAddress());
+    memoryManager->unlockResource(allocation);
+
+    auto statistics = memoryManager->getMappingCache()->getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(bo->peekSize(), statistics.cachedSize);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, memoryManager->getMappingCache()->getStatistics().cachedCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenLockedMappingCacheEnabledWhenAllocationUsedByGpuIsLockedFromCacheThenCpuDomainIsSet) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LockedMappingCacheSize.set(MemoryConstants::megaByte);
+    mock->ioctl_expected.gemCreate = 1;
+    mock->ioctl_expected.gemMmap = 1;
+    mock->ioctl_expected.gemSetDomain = 1;
+    mock->ioctl_expected.gemSetTiling = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+
+    cl_image_desc imgDesc = {};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 512;
+    imgDesc.image_height = 512;
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    imgInfo.imgDesc = Image::convertDescriptor(imgDesc);
+    imgInfo.size = 4096u;
+    imgInfo.rowPitch = 512u;
+
+    AllocationData allocationData;
+    allocationData.imgInfo = &imgInfo;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryForImage(allocationData);
+    ASSERT_NE(nullptr, allocation);
+
+    auto ptr = memoryManager->lockResource(allocation);
+    memoryManager->unlockResource(allocation);
+
+    allocation->updateTaskCount(1u, 0u);
+    EXPECT_EQ(ptr, memoryManager->lockResource(allocation));
+    EXPECT_EQ(static_cast<uint32_t>(static_cast<DrmAllocation *>(allocation)->getBO()->peekHandle()), mock->setDomainHandle);
+    memoryManager->unlockResource(allocation);
+
+    allocation->releaseUsageInOsContext(0u);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST(DrmMappingCacheTest, givenCachedMappingsWhenSizeOrCountLimitIsExceededThenLeastRecentlyStoredMappingsAreEvicted) {
+    DrmMappingCache cache(2 * MemoryConstants::pageSize);
+    std::vector<DrmMappingCache::CachedMapping> evicted;
+
+    DrmMappingCache::CachedMapping mappings[3];
+    for (auto i = 0u; i < 3u; i++) {
+        mappings[i].bo = reinterpret_cast<BufferObject *>(static_cast<uintptr_t>(i + 1));
+        mappings[i].address = reinterpret_cast<void *>(static_cast<uintptr_t>((i + 1) * MemoryConstants::pageSize));
+        mappings[i].size = MemoryConstants::pageSize;
+        EXPECT_TRUE(cache.store(mappings[i], evicted));
+    }
+    EXPECT_FALSE(cache.store(mappings[2], evicted));
+
+    ASSERT_EQ(1u, evicted.size());
+    EXPECT_EQ(mappings[0].bo, evicted[0].bo);
+    EXPECT_EQ(nullptr, cache.take(mappings[0].bo));
+    EXPECT_EQ(mappings[1].address, cache.take(mappings[1].bo));
+
+    DrmMappingCache::CachedMapping removed;
+    EXPECT_TRUE(cache.remove(mappings[2].bo, removed));
+    EXPECT_EQ(mappings[2].address, removed.address);
+    EXPECT_FALSE(cache.remove(mappings[2].bo, removed));
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_EQ(0u, statistics.cachedCount);
+    EXPECT_EQ(0u, statistics.cachedSize);
+
+    DrmMappingCache countLimitedCache(MemoryConstants::gigaByte);
+    DrmMappingCache::CachedMapping mapping;
+    mapping.size = 1u;
+    for (auto i = 0u; i <= DrmMappingCache::maxCachedCount; i++) {
+        mapping.bo = reinterpret_cast<BufferObject *>(static_cast<uintptr_t>(i + 1));
+        mapping.address = reinterpret_cast<void *>(static_cast<uintptr_t>((i + 1) * MemoryConstants::pageSize));
+        EXPECT_TRUE(countLimitedCache.store(mapping, evicted));
+    }
+    EXPECT_EQ(DrmMappingCache::maxCachedCount, countLimitedCache.getStatistics().cachedCount);
+
+    evicted.clear();
+    countLimitedCache.release(evicted);
+    EXPECT_EQ(DrmMappingCache::maxCachedCount, evicted.size());
+    EXPECT_EQ(0u, countLimitedCache.getStatistics().cachedCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenDefaultSettingsWhenDrmMemoryManagerIsCreatedThenLocalMemoryResidencyManagerIsNotCreated) {
+    EXPECT_EQ(nullptr, memoryManager->getLocalMemoryResidencyManager(rootDeviceIndex));
+    EXPECT_FALSE(memoryManager->isMemoryBudgetExhausted());
+}
+
+TEST_F(DrmMemoryManagerTest, givenAllocationWhenMappingPhysicalToVirtualMemoryThenBufferObjectAndAllocationAreMovedToNewAddress) {
+    BufferObject bo(mock, 1, MemoryConstants::pageSize64k, 1);
+    bo.setAddress(0x100000u);
+    DrmAllocation drmAllocation(rootDeviceIndex, GraphicsAllocation::AllocationType::BUFFER, &bo, nullptr, 0x100000u, MemoryConstants::pageSize64k, MemoryPool::LocalMemory);
+
+    EXPECT_TRUE(memoryManager->mapPhysicalToVirtualMemory(&drmAllocation, 0x400000u));
+    EXPECT_EQ(0x400000u, drmAllocation.getGpuAddress());
+    EXPECT_EQ(0x400000u, bo.peekAddress());
+
+    EXPECT_TRUE(memoryManager->mapPhysicalToVirtualMemory(&drmAllocation, 0x100000u));
+    EXPECT_EQ(0x100000u, drmAllocation.getGpuAddress());
+    EXPECT_EQ(0x100000u, bo.peekAddress());
+}
 } // namespace NEO
@@ -42,6 +42,7 @@ class DrmMock : public Drm {
     using Drm::nonPersistentContextsSupported;
     using Drm::preemptionSupported;
     using Drm::query;
+    using Drm::queryCache;
     using Drm::requirePerContextVM;
     using Drm::sliceCountChangeSupported;
     using Drm::systemInfo;
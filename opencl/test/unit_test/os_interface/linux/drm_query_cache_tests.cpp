@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/os_interface/linux/drm_mock.h"
+
+#include "drm_query_flags.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+using namespace NEO;
+
+namespace {
+const std::string testCacheDir = "drm_query_cache_tests";
+
+struct MockDrmQueryCache : public DrmQueryCache {
+    using DrmQueryCache::DrmQueryCache;
+    using DrmQueryCache::getEntryPath;
+};
+
+struct DrmMockWithVersion : public DrmMock {
+    using DrmMock::DrmMock;
+
+    int handleRemainingRequests(unsigned long request, void *arg) override {
+        if (request == DRM_IOCTL_VERSION) {
+            auto version = static_cast<drm_version_t *>(arg);
+            version->version_major = 1;
+            version->version_minor = 6;
+            strncpy(version->date, "20201103", version->date_len);
+            return 0;
+        }
+        return DrmMock::handleRemainingRequests(request, arg);
+    }
+};
+} // namespace
+
+TEST(DrmQueryCacheTests, givenStoredEntryWhenLoadingWithSameKeyThenDataIsReturnedAndOtherKeysDoNotMatch) {
+    MockDrmQueryCache cache(testCacheDir, "0000:03:00.0|1.6.0|boot");
+    MockDrmQueryCache otherCache(testCacheDir, "0000:04:00.0|1.6.0|boot");
+
+    const uint8_t data[] = {1, 2, 3, 4, 5};
+    EXPECT_TRUE(cache.store(DRM_I915_QUERY_ENGINE_INFO, 0, data, sizeof(data)));
+
+    int32_t length = 0;
+    auto loaded = cache.load(DRM_I915_QUERY_ENGINE_INFO, 0, length);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(static_cast<int32_t>(sizeof(data)), length);
+    EXPECT_EQ(0, memcmp(data, loaded.get(), sizeof(data)));
+
+    EXPECT_EQ(nullptr, cache.load(DRM_I915_QUERY_TOPOLOGY_INFO, 0, length));
+    EXPECT_EQ(0, length);
+    EXPECT_EQ(nullptr, otherCache.load(DRM_I915_QUERY_ENGINE_INFO, 0, length));
+
+    std::remove(cache.getEntryPath(DRM_I915_QUERY_ENGINE_INFO, 0).c_str());
+    ::rmdir(testCacheDir.c_str());
+}
+
+TEST(DrmQueryCacheTests, givenQueryIdWhenCheckingIfCacheableThenOnlyHardwareConfigurationQueriesAreCached) {
+    EXPECT_TRUE(DrmQueryCache::isQueryCacheable(DRM_I915_QUERY_TOPOLOGY_INFO));
+    EXPECT_TRUE(DrmQueryCache::isQueryCacheable(DRM_I915_QUERY_ENGINE_INFO));
+    EXPECT_FALSE(DrmQueryCache::isQueryCacheable(0u));
+}
+
+TEST(DrmQueryCacheTests, givenCacheEnabledWhenSecondDrmQueriesTopologyThenQueryIoctlsAreSkipped) {
+    if (DrmQueryCache::getSystemKey().empty()) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableDrmQueryCache.set(1);
+    DebugManager.flags.DrmQueryCacheDir.set(testCacheDir);
+
+    MockExecutionEnvironment executionEnvironment;
+    auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[0];
+
+    DrmMockWithVersion firstDrm(rootDeviceEnvironment);
+    int32_t firstLength = 0;
+    auto firstData = firstDrm.query(DRM_I915_QUERY_TOPOLOGY_INFO, DrmQueryItemFlags::topology, firstLength);
+    ASSERT_NE(nullptr, firstData);
+    ASSERT_NE(nullptr, firstDrm.queryCache.get());
+
+    DrmMockWithVersion secondDrm(rootDeviceEnvironment);
+    secondDrm.ioctlCallsCount = 0;
+    int32_t secondLength = 0;
+    auto secondData = secondDrm.query(DRM_I915_QUERY_TOPOLOGY_INFO, DrmQueryItemFlags::topology, secondLength);
+    ASSERT_NE(nullptr, secondData);
+    EXPECT_EQ(1u, secondDrm.ioctlCallsCount);
+    ASSERT_EQ(firstLength, secondLength);
+    EXPECT_EQ(0, memcmp(firstData.get(), secondData.get(), firstLength));
+
+    MockDrmQueryCache cache(testCacheDir, firstDrm.queryCache->getKey());
+    std::remove(cache.getEntryPath(DRM_I915_QUERY_TOPOLOGY_INFO, DrmQueryItemFlags::topology).c_str());
+    ::rmdir(testCacheDir.c_str());
+}
+
+TEST(DrmQueryCacheTests, givenCacheDisabledWhenQueryingThenCacheIsNotCreated) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableDrmQueryCache.set(0);
+
+    MockExecutionEnvironment executionEnvironment;
+    DrmMockWithVersion drm(*executionEnvironment.rootDeviceEnvironments[0]);
+    int32_t length = 0;
+    EXPECT_NE(nullptr, drm.query(DRM_I915_QUERY_TOPOLOGY_INFO, DrmQueryItemFlags::topology, length));
+    EXPECT_EQ(nullptr, drm.queryCache.get());
+}
@@ -75,6 +75,25 @@ TEST(DrmTest, GivenInvalidPciPathWhenFrequencyIsQueriedThenReturnError) {
     EXPECT_EQ(0, maxFrequency);
 }
 
+TEST(DrmTest, GivenNumaNodeFileExistsWhenNumaNodeIsQueriedThenValueFromFileIsReturned) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    EXPECT_TRUE(fileExists("test_files/linux/devices/device/numa_node"));
+    drm.setPciPath("device");
+    EXPECT_EQ(1, drm.getNumaNode());
+}
+
+TEST(DrmTest, GivenInvalidPciPathWhenNumaNodeIsQueriedThenMinusOneIsReturned) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("invalidPci");
+    EXPECT_EQ(-1, drm.getNumaNode());
+}
+
 TEST(DrmTest, WhenGettingRevisionIdThenCorrectIdIsReturned) {
     auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
     executionEnvironment->prepareRootDeviceEnvironments(1);
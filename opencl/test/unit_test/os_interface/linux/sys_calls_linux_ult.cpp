@@ -39,6 +39,10 @@ uint64_t ioctlVmCreateExtensionArg = 0ull;
 constexpr unsigned long int invalidIoctl = static_cast<unsigned long int>(-1);
 int setErrno = 0;
 int fstatFuncRetVal = 0;
+uint32_t mbindFuncCalled = 0u;
+int mbindFuncArgMode = 0;
+unsigned long mbindFuncArgNodeMask = 0u;
+long mbindFuncRetVal = 0;
 
 int close(int fileDescriptor) {
     closeFuncCalled++;
@@ -130,5 +134,12 @@ int poll(struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) {
 int fstat(int fd, struct stat *buf) {
     return fstatFuncRetVal;
 }
+
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned flags) {
+    mbindFuncCalled++;
+    mbindFuncArgMode = mode;
+    mbindFuncArgNodeMask = nodemask ? nodemask[0] : 0u;
+    return mbindFuncRetVal;
+}
 } // namespace SysCalls
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,6 @@ TEST(DeferrableDeletionImpl, WhenCreatedThenItIsNonAssignable) {
 
 class MockDeferrableDeletion : public DeferrableDeletionImpl {
   public:
-    using DeferrableDeletionImpl::allocationCount;
     using DeferrableDeletionImpl::DeferrableDeletionImpl;
     using DeferrableDeletionImpl::handles;
     using DeferrableDeletionImpl::resourceHandle;
@@ -54,10 +53,9 @@ class DeferrableDeletionTest : public ::testing::Test {
 TEST_F(DeferrableDeletionTest, givenDeferrableDeletionWhenIsCreatedThenObjectMembersAreSetProperly) {
     MockDeferrableDeletion deletion(wddm.get(), &handle, allocationCount, resourceHandle);
     EXPECT_EQ(wddm.get(), deletion.wddm);
-    EXPECT_NE(nullptr, deletion.handles);
-    EXPECT_EQ(handle, *deletion.handles);
-    EXPECT_NE(&handle, deletion.handles);
-    EXPECT_EQ(allocationCount, deletion.allocationCount);
+    ASSERT_EQ(allocationCount, deletion.handles.size());
+    EXPECT_EQ(handle, deletion.handles[0]);
+    EXPECT_NE(&handle, deletion.handles.data());
     EXPECT_EQ(resourceHandle, deletion.resourceHandle);
 }
 
@@ -68,3 +66,25 @@ TEST_F(DeferrableDeletionTest, givenDeferrableDeletionWhenApplyIsCalledThenDelet
     deletion->apply();
     EXPECT_EQ(1, wddm->destroyAllocationResult.called);
 }
+
+TEST_F(DeferrableDeletionTest, givenDeletionsOfAllocationsWithoutResourceWhenMergedThenHandlesAreDestroyedWithSingleCall) {
+    wddm->callBaseDestroyAllocations = false;
+    const D3DKMT_HANDLE handles[] = {1, 2};
+    MockDeferrableDeletion deletion(wddm.get(), &handles[0], 1, resourceHandle);
+    MockDeferrableDeletion otherDeletion(wddm.get(), &handles[1], 1, resourceHandle);
+    EXPECT_EQ(wddm.get(), deletion.getMergeKey());
+    EXPECT_EQ(deletion.getMergeKey(), otherDeletion.getMergeKey());
+
+    deletion.merge(otherDeletion);
+    EXPECT_EQ(2u, deletion.getDeletionsCount());
+    ASSERT_EQ(2u, deletion.handles.size());
+    EXPECT_EQ(handles[1], deletion.handles[1]);
+
+    deletion.apply();
+    EXPECT_EQ(1, wddm->destroyAllocationResult.called);
+}
+
+TEST_F(DeferrableDeletionTest, givenDeletionOfResourceWhenGettingMergeKeyThenNullIsReturned) {
+    MockDeferrableDeletion deletion(wddm.get(), nullptr, 0, 0x1234);
+    EXPECT_EQ(nullptr, deletion.getMergeKey());
+}
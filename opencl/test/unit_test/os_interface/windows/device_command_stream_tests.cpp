@@ -621,7 +621,7 @@ TEST_F(WddmCommandStreamTest, WhenProcessingEvictionThenAllAllocationsArePlacedO
 
     csr->processEviction();
 
-    EXPECT_EQ(2u, static_cast<OsContextWin &>(csr->getOsContext()).getResidencyController().peekTrimCandidateList().size());
+    EXPECT_EQ(2u, static_cast<OsContextWin &>(csr->getOsContext()).getResidencyController().peekTrimCandidatesCount());
 
     memoryManager->freeGraphicsMemory(allocation);
     memoryManager->freeGraphicsMemory(allocation2);
@@ -789,7 +789,7 @@ TEST_F(WddmCommandStreamMockGdiTest, WhenMakingResidentThenResidencyAllocationsL
     EXPECT_EQ(1u, csr->getResidencyAllocations().size());
     EXPECT_EQ(0u, csr->getEvictionAllocations().size());
 
-    EXPECT_EQ(trimListUnusedPosition, static_cast<WddmAllocation *>(commandBuffer)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
+    EXPECT_FALSE(static_cast<WddmAllocation *>(commandBuffer)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
 
     csr->processResidency(csr->getResidencyAllocations(), 0u);
 
@@ -798,7 +798,7 @@ TEST_F(WddmCommandStreamMockGdiTest, WhenMakingResidentThenResidencyAllocationsL
     EXPECT_EQ(0u, csr->getResidencyAllocations().size());
     EXPECT_EQ(0u, csr->getEvictionAllocations().size());
 
-    EXPECT_EQ(0u, static_cast<WddmAllocation *>(commandBuffer)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
+    EXPECT_TRUE(static_cast<WddmAllocation *>(commandBuffer)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
 
     memoryManager->freeGraphicsMemory(commandBuffer);
 }
@@ -873,12 +873,12 @@ HWTEST_F(WddmCommandStreamMockGdiTest, givenRecordedCommandBufferWhenItIsSubmitt
         EXPECT_TRUE(found);
     }
 
-    EXPECT_NE(trimListUnusedPosition, static_cast<WddmAllocation *>(tagAllocation)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
-    EXPECT_NE(trimListUnusedPosition, static_cast<WddmAllocation *>(commandBuffer)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
-    EXPECT_EQ(trimListUnusedPosition, static_cast<WddmAllocation *>(dshAlloc)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
-    EXPECT_EQ(trimListUnusedPosition, static_cast<WddmAllocation *>(iohAlloc)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
-    EXPECT_NE(trimListUnusedPosition, static_cast<WddmAllocation *>(sshAlloc)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
-    EXPECT_NE(trimListUnusedPosition, static_cast<WddmAllocation *>(csrCommandStream)->getTrimCandidateListPosition(csr->getOsContext().getContextId()));
+    EXPECT_TRUE(static_cast<WddmAllocation *>(tagAllocation)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
+    EXPECT_TRUE(static_cast<WddmAllocation *>(commandBuffer)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
+    EXPECT_FALSE(static_cast<WddmAllocation *>(dshAlloc)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
+    EXPECT_FALSE(static_cast<WddmAllocation *>(iohAlloc)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
+    EXPECT_TRUE(static_cast<WddmAllocation *>(sshAlloc)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
+    EXPECT_TRUE(static_cast<WddmAllocation *>(csrCommandStream)->isOnTrimCandidateList(csr->getOsContext().getContextId()));
 
     memoryManager->freeGraphicsMemory(dshAlloc);
     memoryManager->freeGraphicsMemory(iohAlloc);
@@ -22,6 +22,7 @@
 #include "shared/source/os_interface/windows/wddm_allocation.h"
 #include "shared/source/os_interface/windows/wddm_engine_mapper.h"
 #include "shared/source/os_interface/windows/wddm_memory_manager.h"
+#include "shared/source/utilities/wait_util.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 
@@ -39,6 +40,7 @@
 
 #include <functional>
 #include <memory>
+#include <thread>
 
 namespace NEO {
 namespace SysCalls {
@@ -770,6 +772,30 @@ TEST_F(Wddm20Tests, WhenLastFenceGreaterThanMonitoredThenWaitFromCpuIsCalled) {
     EXPECT_NE(nullptr, gdi->getWaitFromCpuArg().ObjectHandleArray);
 }
 
+TEST_F(Wddm20Tests, givenFenceSignaledWithinSpinPeriodWhenWaitingFromCpuThenKernelWaitIsNotCalled) {
+    VariableBackup<int64_t> spinMicrosecondsBackup(&WaitUtils::spinMicroseconds, 10 * 1000 * 1000);
+    auto &monitoredFence = osContext->getResidencyController().getMonitoredFence();
+    *monitoredFence.cpuAddress = 10;
+    gdi->getWaitFromCpuArg().ObjectCount = 0;
+
+    std::thread signalingThread([&monitoredFence]() {
+        *monitoredFence.cpuAddress = 20;
+    });
+    EXPECT_TRUE(wddm->waitFromCpu(20, monitoredFence));
+    signalingThread.join();
+
+    EXPECT_EQ(0u, gdi->getWaitFromCpuArg().ObjectCount);
+}
+
+TEST_F(Wddm20Tests, givenSpinPeriodElapsedWhenFenceIsNotSignaledThenSpinningReturnsFalse) {
+    VariableBackup<int64_t> spinMicrosecondsBackup(&WaitUtils::spinMicroseconds, 0);
+    auto &monitoredFence = osContext->getResidencyController().getMonitoredFence();
+    *monitoredFence.cpuAddress = 10;
+
+    EXPECT_FALSE(wddm->spinOnMonitoredFence(20, monitoredFence));
+    EXPECT_TRUE(wddm->spinOnMonitoredFence(10, monitoredFence));
+}
+
 TEST_F(Wddm20Tests, WhenCreatingMonitoredFenceThenItIsInitializedWithFenceValueZeroAndCurrentFenceValueIsSetToOne) {
     gdi->createSynchronizationObject2 = gdi->createSynchronizationObject2Mock;
 
@@ -1213,6 +1239,18 @@ TEST_F(WddmTest, WhenFeatureFlagHwQueueIsEnabledThenReturnWddm23Version) {
     EXPECT_EQ(WddmVersion::WDDM_2_3, wddm->getWddmVersion());
 }
 
+TEST_F(WddmTest, GivenEnableWddmHwQueuesFlagSetWhenGettingWddmVersionThenFeatureFlagIsOverridden) {
+    DebugManagerStateRestore restore;
+
+    wddm->featureTable->ftrWddmHwQueues = 1;
+    DebugManager.flags.EnableWddmHwQueues.set(0);
+    EXPECT_EQ(WddmVersion::WDDM_2_0, wddm->getWddmVersion());
+
+    wddm->featureTable->ftrWddmHwQueues = 0;
+    DebugManager.flags.EnableWddmHwQueues.set(1);
+    EXPECT_EQ(WddmVersion::WDDM_2_3, wddm->getWddmVersion());
+}
+
 TEST_F(Wddm20WithMockGdiDllTests, GivenCreationSucceedWhenCreatingSeparateMonitorFenceThenReturnFilledStructure) {
     MonitoredFence monitorFence = {0};
 
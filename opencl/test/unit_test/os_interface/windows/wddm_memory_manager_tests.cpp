@@ -78,27 +78,27 @@ TEST(WddmMemoryManager, WhenWddmMemoryManagerIsCreatedThenItIsNonAssignable) {
     EXPECT_FALSE(std::is_copy_assignable<WddmMemoryManager>::value);
 }
 
-TEST(WddmAllocationTest, givenAllocationIsTrimCandidateInOneOsContextWhenGettingTrimCandidatePositionThenReturnItsPositionAndUnusedPositionInOtherContexts) {
+TEST(WddmAllocationTest, givenAllocationIsTrimCandidateInOneOsContextWhenCheckingTrimCandidateListThenItIsOnTheListOnlyInThatContext) {
     MockWddmAllocation allocation;
     MockOsContext osContext(1u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular},
                             PreemptionHelper::getDefaultPreemptionMode(*defaultHwInfo),
                             false);
-    allocation.setTrimCandidateListPosition(osContext.getContextId(), 700u);
-    EXPECT_EQ(trimListUnusedPosition, allocation.getTrimCandidateListPosition(0u));
-    EXPECT_EQ(700u, allocation.getTrimCandidateListPosition(1u));
+    allocation.getTrimCandidateListLinks(osContext.getContextId()).onList = true;
+    EXPECT_FALSE(allocation.isOnTrimCandidateList(0u));
+    EXPECT_TRUE(allocation.isOnTrimCandidateList(1u));
 }
 
 TEST(WddmAllocationTest, givenAllocationCreatedWithOsContextCountOneWhenItIsCreatedThenMaxOsContextCountIsUsedInstead) {
     MockWddmAllocation allocation;
-    allocation.setTrimCandidateListPosition(1u, 700u);
-    EXPECT_EQ(700u, allocation.getTrimCandidateListPosition(1u));
-    EXPECT_EQ(trimListUnusedPosition, allocation.getTrimCandidateListPosition(0u));
+    allocation.getTrimCandidateListLinks(1u).onList = true;
+    EXPECT_TRUE(allocation.isOnTrimCandidateList(1u));
+    EXPECT_FALSE(allocation.isOnTrimCandidateList(0u));
 }
 
-TEST(WddmAllocationTest, givenRequestedContextIdTooLargeWhenGettingTrimCandidateListPositionThenReturnUnusedPosition) {
+TEST(WddmAllocationTest, givenRequestedContextIdTooLargeWhenCheckingTrimCandidateListThenReturnFalse) {
     MockWddmAllocation allocation;
-    EXPECT_EQ(trimListUnusedPosition, allocation.getTrimCandidateListPosition(1u));
-    EXPECT_EQ(trimListUnusedPosition, allocation.getTrimCandidateListPosition(1000u));
+    EXPECT_FALSE(allocation.isOnTrimCandidateList(1u));
+    EXPECT_FALSE(allocation.isOnTrimCandidateList(1000u));
 }
 
 TEST(WddmAllocationTest, givenAllocationTypeWhenPassedToWddmAllocationConstructorThenAllocationTypeIsStored) {
@@ -40,23 +40,19 @@ class MockWddmResidencyController : public WddmResidencyController {
   public:
     using WddmResidencyController::lastTrimFenceValue;
     using WddmResidencyController::trimCallbackHandle;
-    using WddmResidencyController::trimCandidateList;
+    using WddmResidencyController::trimCandidateListHead;
+    using WddmResidencyController::trimCandidateListTail;
     using WddmResidencyController::trimCandidatesCount;
     using WddmResidencyController::trimResidency;
     using WddmResidencyController::trimResidencyToBudget;
     using WddmResidencyController::WddmResidencyController;
 
     uint32_t acquireLockCallCount = 0u;
-    bool forceTrimCandidateListCompaction = false;
 
     std::unique_lock<SpinLock> acquireLock() override {
         acquireLockCallCount++;
         return WddmResidencyController::acquireLock();
     }
-
-    bool checkTrimCandidateListCompaction() override {
-        return forceTrimCandidateListCompaction || WddmResidencyController::checkTrimCandidateListCompaction();
-    }
 };
 
 class MockOsContextWin : public OsContextWin {
@@ -274,8 +270,8 @@ TEST_F(WddmResidencyControllerWithGdiTest, givenWddmResidencyControllerWhenItIsD
 TEST_F(WddmResidencyControllerTest, givenUsedAllocationWhenCallingRemoveFromTrimCandidateListIfUsedThenRemoveIt) {
     MockWddmAllocation allocation;
     residencyController->addToTrimCandidateList(&allocation);
-    residencyController->removeFromTrimCandidateListIfUsed(&allocation, false);
-    EXPECT_EQ(trimListUnusedPosition, allocation.getTrimCandidateListPosition(osContextId));
+    residencyController->removeFromTrimCandidateListIfUsed(&allocation);
+    EXPECT_FALSE(allocation.isOnTrimCandidateList(osContextId));
 }
 
 TEST_F(WddmResidencyControllerTest, givenWddmResidencyControllerWhenIsMemoryExhaustedIsCalledThenReturnCorrectResult) {
@@ -286,201 +282,108 @@ TEST_F(WddmResidencyControllerTest, givenWddmResidencyControllerWhenIsMemoryExha
 
 TEST_F(WddmResidencyControllerTest, givenUnusedAllocationWhenCallingRemoveFromTrimCandidateListIfUsedThenIgnore) {
     MockWddmAllocation allocation;
-    residencyController->removeFromTrimCandidateListIfUsed(&allocation, false);
-    EXPECT_EQ(trimListUnusedPosition, allocation.getTrimCandidateListPosition(osContextId));
+    residencyController->removeFromTrimCandidateListIfUsed(&allocation);
+    EXPECT_FALSE(allocation.isOnTrimCandidateList(osContextId));
+    EXPECT_EQ(0u, residencyController->peekTrimCandidatesCount());
 }
 
-TEST_F(WddmResidencyControllerTest, WhenAddingToTrimCandidateListThenAllocationIsPlacedInContainerAndAssignedPosition) {
+TEST_F(WddmResidencyControllerTest, WhenAddingToTrimCandidateListThenAllocationIsLinkedAsHeadAndTail) {
     MockWddmAllocation allocation;
     residencyController->addToTrimCandidateList(&allocation);
 
-    EXPECT_NE(0u, residencyController->trimCandidateList.size());
-    EXPECT_NE(trimListUnusedPosition, allocation.getTrimCandidateListPosition(osContextId));
-
-    size_t position = allocation.getTrimCandidateListPosition(osContextId);
-    ASSERT_LT(position, residencyController->trimCandidateList.size());
-
-    EXPECT_EQ(&allocation, residencyController->trimCandidateList[position]);
+    EXPECT_TRUE(allocation.isOnTrimCandidateList(osContextId));
+    EXPECT_EQ(1u, residencyController->peekTrimCandidatesCount());
+    EXPECT_EQ(&allocation, residencyController->getTrimCandidateHead());
+    EXPECT_EQ(&allocation, residencyController->getTrimCandidateTail());
+    EXPECT_EQ(nullptr, allocation.getTrimCandidateListLinks(osContextId).previous);
+    EXPECT_EQ(nullptr, allocation.getTrimCandidateListLinks(osContextId).next);
 }
 
 TEST_F(WddmResidencyControllerTest, WhenAddingToTrimCandidateListThenDoNotInsertAllocationAlreadyOnTheList) {
-    MockWddmAllocation allocation;
-
-    residencyController->trimCandidateList.resize(0);
-
-    residencyController->addToTrimCandidateList(&allocation);
-
-    EXPECT_NE(trimListUnusedPosition, allocation.getTrimCandidateListPosition(osContextId));
-
-    size_t position = allocation.getTrimCandidateListPosition(osContextId);
-    ASSERT_LT(position, residencyController->trimCandidateList.size());
-
-    EXPECT_EQ(&allocation, residencyController->trimCandidateList[position]);
-
-    size_t previousSize = residencyController->trimCandidateList.size();
-    residencyController->addToTrimCandidateList(&allocation);
-
-    EXPECT_EQ(previousSize, residencyController->trimCandidateList.size());
-    EXPECT_EQ(position, allocation.getTrimCandidateListPosition(osContextId));
-}
-
-TEST_F(WddmResidencyControllerTest, WhenRemovingFromTrimCandidateListThenUnusedPositionIsAssigned) {
-    MockWddmAllocation allocation;
-
-    residencyController->addToTrimCandidateList(&allocation);
-    residencyController->removeFromTrimCandidateList(&allocation, false);
-
-    EXPECT_EQ(trimListUnusedPosition, allocation.getTrimCandidateListPosition(osContextId));
-}
-
-TEST_F(WddmResidencyControllerTest, WhenRemovingFromTrimCandidateListThenAllocationInAssignedPositionIsRemoved) {
-    MockWddmAllocation allocation;
-
-    residencyController->addToTrimCandidateList(&allocation);
-    size_t position = allocation.getTrimCandidateListPosition(osContextId);
-
-    residencyController->removeFromTrimCandidateList(&allocation, false);
-
-    if (residencyController->trimCandidateList.size() > position) {
-        EXPECT_NE(&allocation, residencyController->trimCandidateList[position]);
-    }
-}
-
-TEST_F(WddmResidencyControllerTest, GivenOneAllocationWhenRemovingFromTrimCandidateListThenTrimCandidateListIsEmpty) {
-    MockWddmAllocation allocation;
-
-    residencyController->trimCandidateList.resize(0);
-
-    residencyController->addToTrimCandidateList(&allocation);
-
-    residencyController->removeFromTrimCandidateList(&allocation, false);
-
-    EXPECT_EQ(0u, residencyController->trimCandidateList.size());
-}
-
-TEST_F(WddmResidencyControllerTest, WhenRemovingFromTrimCandidateListThenLastAllocationAndAllPreviousEmptyEntriesAreRemoved) {
     MockWddmAllocation allocation1, allocation2;
 
-    residencyController->trimCandidateList.resize(0);
-
     residencyController->addToTrimCandidateList(&allocation1);
-
-    residencyController->trimCandidateList.push_back(nullptr);
-    residencyController->trimCandidateList.push_back(nullptr);
-    residencyController->trimCandidateList.push_back(nullptr);
-
     residencyController->addToTrimCandidateList(&allocation2);
+    residencyController->addToTrimCandidateList(&allocation1);
 
-    EXPECT_EQ(5u, residencyController->trimCandidateList.size());
-
-    residencyController->removeFromTrimCandidateList(&allocation2, false);
-
-    EXPECT_EQ(1u, residencyController->trimCandidateList.size());
+    EXPECT_EQ(2u, residencyController->peekTrimCandidatesCount());
+    EXPECT_EQ(&allocation1, residencyController->getTrimCandidateHead());
+    EXPECT_EQ(&allocation2, residencyController->getTrimCandidateTail());
 }
 
-TEST_F(WddmResidencyControllerTest, WhenAddingToTrimCandidateListThenSuccessivePositionIsAssigned) {
+TEST_F(WddmResidencyControllerTest, WhenAddingToTrimCandidateListThenAllocationsAreLinkedInInsertionOrder) {
     MockWddmAllocation allocation1, allocation2, allocation3;
 
     residencyController->addToTrimCandidateList(&allocation1);
     residencyController->addToTrimCandidateList(&allocation2);
     residencyController->addToTrimCandidateList(&allocation3);
 
-    EXPECT_EQ(3u, residencyController->trimCandidateList.size());
-    EXPECT_NE(allocation1.getTrimCandidateListPosition(osContextId), allocation2.getTrimCandidateListPosition(osContextId));
-    EXPECT_NE(allocation2.getTrimCandidateListPosition(osContextId), allocation3.getTrimCandidateListPosition(osContextId));
+    EXPECT_EQ(3u, residencyController->peekTrimCandidatesCount());
+    EXPECT_EQ(&allocation1, residencyController->getTrimCandidateHead());
+    EXPECT_EQ(&allocation2, allocation1.getTrimCandidateListLinks(osContextId).next);
+    EXPECT_EQ(&allocation3, allocation2.getTrimCandidateListLinks(osContextId).next);
+    EXPECT_EQ(&allocation1, allocation2.getTrimCandidateListLinks(osContextId).previous);
+    EXPECT_EQ(&allocation2, allocation3.getTrimCandidateListLinks(osContextId).previous);
+    EXPECT_EQ(&allocation3, residencyController->getTrimCandidateTail());
 }
 
-TEST_F(WddmResidencyControllerTest, GivenAllocationThatIsNotLastWhenRemovingFromTrimCandidateListAndCompactingThenRemoveEntry) {
-    MockWddmAllocation allocation1, allocation2, allocation3;
-
-    residencyController->addToTrimCandidateList(&allocation1);
-    residencyController->addToTrimCandidateList(&allocation2);
-    residencyController->addToTrimCandidateList(&allocation3);
-
-    residencyController->forceTrimCandidateListCompaction = true;
-    residencyController->removeFromTrimCandidateList(&allocation2, true);
+TEST_F(WddmResidencyControllerTest, GivenOneAllocationWhenRemovingFromTrimCandidateListThenTrimCandidateListIsEmpty) {
+    MockWddmAllocation allocation;
 
-    EXPECT_EQ(2u, residencyController->trimCandidateList.size());
+    residencyController->addToTrimCandidateList(&allocation);
+    residencyController->removeFromTrimCandidateList(&allocation);
 
-    EXPECT_EQ(1u, allocation3.getTrimCandidateListPosition(osContextId));
-    EXPECT_EQ(trimListUnusedPosition, allocation2.getTrimCandidateListPosition(osContextId));
+    EXPECT_FALSE(allocation.isOnTrimCandidateList(osContextId));
+    EXPECT_EQ(0u, residencyController->peekTrimCandidatesCount());
+    EXPECT_EQ(nullptr, residencyController->getTrimCandidateHead());
+    EXPECT_EQ(nullptr, residencyController->getTrimCandidateTail());
 }
 
-TEST_F(WddmResidencyControllerTest, GivenAllocationThatIsNotLastWhenRemovingFromTrimCandidateListThenReplaceWithNullEntry) {
+TEST_F(WddmResidencyControllerTest, GivenAllocationInTheMiddleWhenRemovingFromTrimCandidateListThenNeighboursAreLinked) {
     MockWddmAllocation allocation1, allocation2, allocation3;
 
     residencyController->addToTrimCandidateList(&allocation1);
     residencyController->addToTrimCandidateList(&allocation2);
     residencyController->addToTrimCandidateList(&allocation3);
-    size_t position2 = allocation2.getTrimCandidateListPosition(osContextId);
-    size_t position3 = allocation3.getTrimCandidateListPosition(osContextId);
 
-    residencyController->removeFromTrimCandidateList(&allocation2, false);
+    residencyController->removeFromTrimCandidateList(&allocation2);
 
-    EXPECT_EQ(3u, residencyController->trimCandidateList.size());
-    EXPECT_EQ(2u, position3);
-    EXPECT_EQ(nullptr, residencyController->trimCandidateList[position2]);
+    EXPECT_FALSE(allocation2.isOnTrimCandidateList(osContextId));
+    EXPECT_EQ(nullptr, allocation2.getTrimCandidateListLinks(osContextId).previous);
+    EXPECT_EQ(nullptr, allocation2.getTrimCandidateListLinks(osContextId).next);
+    EXPECT_EQ(2u, residencyController->peekTrimCandidatesCount());
+    EXPECT_EQ(&allocation3, allocation1.getTrimCandidateListLinks(osContextId).next);
+    EXPECT_EQ(&allocation1, allocation3.getTrimCandidateListLinks(osContextId).previous);
 }
 
-TEST_F(WddmResidencyControllerTest, WhenCompactingTrimCandidateListThenInitialNullEntriesAreRemovedAndPositionsAreUpdated) {
-    MockWddmAllocation allocation1, allocation2, allocation3, allocation4;
+TEST_F(WddmResidencyControllerTest, GivenHeadAndTailAllocationsWhenRemovingFromTrimCandidateListThenHeadAndTailAreUpdated) {
+    MockWddmAllocation allocation1, allocation2, allocation3;
 
     residencyController->addToTrimCandidateList(&allocation1);
     residencyController->addToTrimCandidateList(&allocation2);
     residencyController->addToTrimCandidateList(&allocation3);
-    residencyController->addToTrimCandidateList(&allocation4);
-
-    allocation3.getTrimCandidateListPosition(osContextId);
-    allocation4.getTrimCandidateListPosition(osContextId);
-
-    residencyController->removeFromTrimCandidateList(&allocation2, false);
-    residencyController->removeFromTrimCandidateList(&allocation1, false);
-
-    EXPECT_EQ(4u, residencyController->trimCandidateList.size());
 
-    residencyController->compactTrimCandidateList();
+    residencyController->removeFromTrimCandidateList(&allocation1);
+    EXPECT_EQ(&allocation2, residencyController->getTrimCandidateHead());
+    EXPECT_EQ(nullptr, allocation2.getTrimCandidateListLinks(osContextId).previous);
 
-    EXPECT_EQ(2u, residencyController->trimCandidateList.size());
-
-    EXPECT_EQ(residencyController->trimCandidateList[0], &allocation3);
-    EXPECT_EQ(0u, allocation3.getTrimCandidateListPosition(osContextId));
-
-    EXPECT_EQ(residencyController->trimCandidateList[1], &allocation4);
-    EXPECT_EQ(1u, allocation4.getTrimCandidateListPosition(osContextId));
+    residencyController->removeFromTrimCandidateList(&allocation3);
+    EXPECT_EQ(&allocation2, residencyController->getTrimCandidateTail());
+    EXPECT_EQ(nullptr, allocation2.getTrimCandidateListLinks(osContextId).next);
+    EXPECT_EQ(1u, residencyController->peekTrimCandidatesCount());
 }
 
-TEST_F(WddmResidencyControllerTest, WhenCompactingTrimCandidateListThenNonNullEntriesAreNotRemoved) {
-    MockWddmAllocation allocation1, allocation2, allocation3, allocation4;
+TEST_F(WddmResidencyControllerTest, GivenRemovedAllocationWhenAddingToTrimCandidateListAgainThenItIsAppendedAtTail) {
+    MockWddmAllocation allocation1, allocation2;
 
     residencyController->addToTrimCandidateList(&allocation1);
     residencyController->addToTrimCandidateList(&allocation2);
-    residencyController->addToTrimCandidateList(&allocation3);
-    residencyController->addToTrimCandidateList(&allocation4);
-
-    EXPECT_EQ(4u, residencyController->trimCandidateList.size());
-
-    residencyController->compactTrimCandidateList();
-
-    EXPECT_EQ(4u, residencyController->trimCandidateList.size());
-}
-
-TEST_F(WddmResidencyControllerTest, GivenListSizeLessThenDoubleCandidateCountWhenCheckingTrimCandidateListCompactionThenCompactionIsRequired) {
-    bool comapactionRequired;
-
-    residencyController->trimCandidatesCount = 10;
-    residencyController->trimCandidateList.resize(20);
-    comapactionRequired = residencyController->checkTrimCandidateListCompaction();
-    EXPECT_TRUE(comapactionRequired);
-
-    residencyController->trimCandidatesCount = 5;
-    residencyController->trimCandidateList.resize(20);
-    comapactionRequired = residencyController->checkTrimCandidateListCompaction();
-    EXPECT_TRUE(comapactionRequired);
+    residencyController->removeFromTrimCandidateList(&allocation1);
+    residencyController->addToTrimCandidateList(&allocation1);
 
-    residencyController->trimCandidatesCount = 18;
-    residencyController->trimCandidateList.resize(20);
-    comapactionRequired = residencyController->checkTrimCandidateListCompaction();
-    EXPECT_FALSE(comapactionRequired);
+    EXPECT_EQ(&allocation2, residencyController->getTrimCandidateHead());
+    EXPECT_EQ(&allocation1, residencyController->getTrimCandidateTail());
+    EXPECT_EQ(2u, residencyController->peekTrimCandidatesCount());
 }
 
 TEST_F(WddmResidencyControllerWithGdiTest, givenNotUsedAllocationsFromPreviousPeriodicTrimWhenTrimResidencyPeriodicTrimIsCalledThenAllocationsAreEvictedMarkedAndRemovedFromTrimCandidateList) {
@@ -512,7 +415,7 @@ TEST_F(WddmResidencyControllerWithGdiTest, givenNotUsedAllocationsFromPreviousPe
     // 2 allocations evicted
     EXPECT_EQ(2u, wddm->makeNonResidentResult.called);
     // removed from trim candidate list
-    EXPECT_EQ(0u, residencyController->peekTrimCandidateList().size());
+    EXPECT_EQ(0u, residencyController->peekTrimCandidatesCount());
     // marked nonresident
     EXPECT_FALSE(allocation1.getResidencyData().resident[osContextId]);
     EXPECT_FALSE(allocation2.getResidencyData().resident[osContextId]);
@@ -546,7 +449,7 @@ TEST_F(WddmResidencyControllerWithGdiTest, givenOneUsedAllocationFromPreviousPer
     // 1 allocation evicted
     EXPECT_EQ(1u, wddm->makeNonResidentResult.called);
     // removed from trim candidate list
-    EXPECT_EQ(trimListUnusedPosition, allocation1.getTrimCandidateListPosition(osContextId));
+    EXPECT_FALSE(allocation1.isOnTrimCandidateList(osContextId));
 
     //marked nonresident
     EXPECT_FALSE(allocation1.getResidencyData().resident[osContextId]);
@@ -663,12 +566,11 @@ TEST_F(WddmResidencyControllerWithGdiTest, WhenTrimmingToBudgetThenAllDoneAlloca
     EXPECT_EQ(2u, wddm->makeNonResidentResult.called);
 
     EXPECT_EQ(1u, residencyController->peekTrimCandidatesCount());
-    residencyController->compactTrimCandidateList();
-    EXPECT_EQ(1u, residencyController->peekTrimCandidateList().size());
+    EXPECT_EQ(&allocation3, residencyController->getTrimCandidateHead());
 
-    EXPECT_EQ(trimListUnusedPosition, allocation1.getTrimCandidateListPosition(osContextId));
-    EXPECT_EQ(trimListUnusedPosition, allocation2.getTrimCandidateListPosition(osContextId));
-    EXPECT_NE(trimListUnusedPosition, allocation3.getTrimCandidateListPosition(osContextId));
+    EXPECT_FALSE(allocation1.isOnTrimCandidateList(osContextId));
+    EXPECT_FALSE(allocation2.isOnTrimCandidateList(osContextId));
+    EXPECT_TRUE(allocation3.isOnTrimCandidateList(osContextId));
 }
 
 TEST_F(WddmResidencyControllerWithGdiTest, GivenNumBytesToTrimIsNotZeroWhenTrimmingToBudgetThenFalseIsReturned) {
@@ -689,7 +591,7 @@ TEST_F(WddmResidencyControllerWithGdiTest, GivenNumBytesToTrimIsNotZeroWhenTrimm
     bool status = residencyController->trimResidencyToBudget(3 * 4096);
 
     EXPECT_EQ(1u, wddm->makeNonResidentResult.called);
-    EXPECT_EQ(0u, residencyController->peekTrimCandidateList().size());
+    EXPECT_EQ(0u, residencyController->peekTrimCandidatesCount());
 
     EXPECT_FALSE(status);
 }
@@ -722,11 +624,11 @@ TEST_F(WddmResidencyControllerWithGdiTest, GivenNumBytesToTrimIsZeroWhenTrimming
 
     EXPECT_TRUE(status);
     EXPECT_EQ(2u, wddm->makeNonResidentResult.called);
-    EXPECT_EQ(1u, residencyController->peekTrimCandidateList().size());
+    EXPECT_EQ(1u, residencyController->peekTrimCandidatesCount());
 
-    EXPECT_EQ(trimListUnusedPosition, allocation1.getTrimCandidateListPosition(osContextId));
-    EXPECT_EQ(trimListUnusedPosition, allocation2.getTrimCandidateListPosition(osContextId));
-    EXPECT_NE(trimListUnusedPosition, allocation3.getTrimCandidateListPosition(osContextId));
+    EXPECT_FALSE(allocation1.isOnTrimCandidateList(osContextId));
+    EXPECT_FALSE(allocation2.isOnTrimCandidateList(osContextId));
+    EXPECT_TRUE(allocation3.isOnTrimCandidateList(osContextId));
 }
 
 TEST_F(WddmResidencyControllerWithGdiTest, WhenTrimmingToBudgetThenEvictedAllocationIsMarkedNonResident) {
@@ -1047,6 +949,30 @@ TEST_F(WddmResidencyControllerWithMockWddmTest, givenAllocationPackPassedWhenCal
     EXPECT_TRUE(result);
 }
 
+TEST_F(WddmResidencyControllerWithMockWddmTest, givenResidentAndNonResidentAllocationsWhenCallingMakeResidentResidencyAllocationsThenOnlyNonResidentHandlesArePassedAndAllFencesAreUpdated) {
+    MockWddmAllocation residentAllocation;
+    MockWddmAllocation allocation;
+    residentAllocation.handle = 1;
+    allocation.handle = 2;
+    residentAllocation.getResidencyData().resident[osContextId] = true;
+    residencyController->getMonitoredFence().currentFenceValue = 20;
+    ResidencyContainer residencyPack{&residentAllocation, &allocation};
+
+    auto makeResidentWithNonResidentHandles = [](const D3DKMT_HANDLE *handles, uint32_t count, bool cantTrimFurther, uint64_t *numberOfBytesToTrim, size_t size) -> bool {
+        EXPECT_EQ(2, handles[0]);
+        return true;
+    };
+    ON_CALL(*wddm, makeResident(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_)).WillByDefault(::testing::Invoke(makeResidentWithNonResidentHandles));
+    EXPECT_CALL(*wddm, makeResident(::testing::_, EngineLimits::maxHandleCount, false, ::testing::_, ::testing::_)).Times(1);
+
+    bool result = residencyController->makeResidentResidencyAllocations(residencyPack);
+    EXPECT_TRUE(result);
+
+    EXPECT_TRUE(allocation.getResidencyData().resident[osContextId]);
+    EXPECT_EQ(20u, residentAllocation.getResidencyData().getFenceValueForContextId(osContextId));
+    EXPECT_EQ(20u, allocation.getResidencyData().getFenceValueForContextId(osContextId));
+}
+
 TEST_F(WddmResidencyControllerWithMockWddmTest, givenMakeResidentFailsAndTrimToBudgetSuceedsWhenCallingMakeResidentResidencyAllocationsThenSucceed) {
     MockWddmAllocation allocation1;
     void *cpuPtr = reinterpret_cast<void *>(wddm->getWddmMinAddress() + 0x1000);
@@ -32,6 +32,19 @@ class MidThreadPreemptionTests : public DevicePreemptionTests {
     }
 };
 
+TEST(PreemptionHelperTest, givenHighPriorityEngineUsageWhenSelectingContextPreemptionModeThenModeIsLimitedToThreadGroup) {
+    EXPECT_EQ(PreemptionMode::ThreadGroup, PreemptionHelper::contextPreemptionMode(PreemptionMode::MidThread, EngineUsage::HighPriority));
+    EXPECT_EQ(PreemptionMode::MidBatch, PreemptionHelper::contextPreemptionMode(PreemptionMode::MidBatch, EngineUsage::HighPriority));
+    EXPECT_EQ(PreemptionMode::MidThread, PreemptionHelper::contextPreemptionMode(PreemptionMode::MidThread, EngineUsage::Regular));
+    EXPECT_EQ(PreemptionMode::MidThread, PreemptionHelper::contextPreemptionMode(PreemptionMode::MidThread, EngineUsage::LowPriority));
+}
+
+TEST(PreemptionHelperTest, givenContextPreemptionModeWhenLimitingTaskPreemptionModeThenFinerModesAreLimited) {
+    EXPECT_EQ(PreemptionMode::ThreadGroup, PreemptionHelper::limitToContextPreemptionMode(PreemptionMode::MidThread, PreemptionMode::ThreadGroup));
+    EXPECT_EQ(PreemptionMode::MidBatch, PreemptionHelper::limitToContextPreemptionMode(PreemptionMode::MidBatch, PreemptionMode::ThreadGroup));
+    EXPECT_EQ(PreemptionMode::MidThread, PreemptionHelper::limitToContextPreemptionMode(PreemptionMode::MidThread, PreemptionMode::Initial));
+}
+
 TEST_F(ThreadGroupPreemptionTests, GivenDisallowedByKmdThenThreadGroupPreemptionIsDisabled) {
     PreemptionFlags flags = {};
     waTable->waDisablePerCtxtPreemptionGranularityControl = 1;
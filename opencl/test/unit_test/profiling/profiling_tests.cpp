@@ -879,7 +879,7 @@ HWTEST_F(ProfilingWithPerfCountersTests, GivenCommandQueueWithProfilingPerfCount
 
 template <typename TagType>
 struct FixedGpuAddressTagAllocator : TagAllocator<TagType> {
-    using TagAllocator<TagType>::usedTags;
+    using TagAllocator<TagType>::usedTagsCount;
     using TagAllocator<TagType>::deferredTags;
 
     struct MockTagNode : TagNode<TagType> {
@@ -944,7 +944,7 @@ HWTEST_F(ProfilingWithPerfCountersTests, givenTimestampPacketsEnabledWhenEnqueue
 
     myCmdQ->enqueueKernel(kernel->mockKernel, 1, globalOffsets, workItems, nullptr, 0, nullptr, &event);
 
-    EXPECT_EQ(!!myCmdQ->getTimestampPacketContainer(), mockAllocator->usedTags.peekIsEmpty());
+    EXPECT_EQ(!!myCmdQ->getTimestampPacketContainer(), (mockAllocator->usedTagsCount == 0u));
     EXPECT_TRUE(mockAllocator->deferredTags.peekIsEmpty());
 
     clReleaseEvent(event);
@@ -82,6 +82,29 @@ TEST(KernelInfoTest, givenKernelInfoWhenCreatingKernelAllocationWithInternalIsaT
     device->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
 }
 
+TEST(KernelInfoTest, givenKernelInfosWithIdenticalIsaWhenCreatingSharedKernelAllocationThenAllocationIsSharedUntilLastRelease) {
+    KernelInfo kernelInfo;
+    KernelInfo otherKernelInfo;
+    auto factory = UltDeviceFactory{1, 0};
+    auto device = factory.rootDevices[0];
+    const size_t heapSize = 0x40;
+    char heap[heapSize] = {1, 2, 3};
+    char otherHeap[heapSize] = {1, 2, 3};
+    kernelInfo.heapInfo.KernelHeapSize = heapSize;
+    kernelInfo.heapInfo.pKernelHeap = &heap;
+    otherKernelInfo.heapInfo.KernelHeapSize = heapSize;
+    otherKernelInfo.heapInfo.pKernelHeap = &otherHeap;
+
+    EXPECT_TRUE(kernelInfo.createKernelAllocation(*device, false, true));
+    EXPECT_TRUE(otherKernelInfo.createKernelAllocation(*device, false, true));
+    EXPECT_EQ(kernelInfo.kernelAllocation, otherKernelInfo.kernelAllocation);
+
+    auto &isaCache = device->getMemoryManager()->getKernelIsaCache();
+    EXPECT_FALSE(isaCache.releaseAllocation(kernelInfo.kernelAllocation));
+    EXPECT_TRUE(isaCache.releaseAllocation(otherKernelInfo.kernelAllocation));
+    device->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(otherKernelInfo.kernelAllocation);
+}
+
 class MyMemoryManager : public OsAgnosticMemoryManager {
   public:
     using OsAgnosticMemoryManager::OsAgnosticMemoryManager;
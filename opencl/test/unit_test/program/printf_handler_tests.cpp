@@ -5,9 +5,11 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
+#include "opencl/source/program/async_printf_processor.h"
 #include "opencl/source/program/printf_handler.h"
 #include "opencl/test/unit_test/fixtures/multi_root_device_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
@@ -220,3 +222,82 @@ TEST_F(PrintfHandlerMultiRootDeviceTests, GivenPrintfSurfaceThenItHasCorrectRoot
     ASSERT_NE(nullptr, surface);
     EXPECT_EQ(expectedRootDeviceIndex, surface->getRootDeviceIndex());
 }
+
+TEST(PrintfHandlerTest, givenAsyncPrintfDisabledWhenCreatingDeviceThenProcessorIsNotCreated) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAsyncPrintf.set(0);
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    EXPECT_EQ(nullptr, device->getAsyncPrintfProcessor());
+}
+
+TEST(PrintfHandlerTest, givenAsyncPrintfEnabledWhenPrintfHandlerIsDestroyedThenSurfaceIsReturnedToPoolAndReused) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAsyncPrintf.set(1);
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto processor = device->getAsyncPrintfProcessor();
+    ASSERT_NE(nullptr, processor);
+
+    MockContext context(device.get());
+    auto pKernelInfo = std::make_unique<MockKernelInfo>();
+    pKernelInfo->setPrintfSurface(sizeof(uintptr_t), 0);
+
+    auto program = std::make_unique<MockProgram>(&context, false, toClDeviceVector(*device));
+    auto kernel = std::make_unique<MockKernel>(program.get(), *pKernelInfo, *device);
+    uint64_t crossThread[10];
+    kernel->setCrossThreadData(&crossThread, sizeof(uint64_t) * 8);
+
+    MockMultiDispatchInfo multiDispatchInfo(device.get(), kernel.get());
+    std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, *device));
+    printfHandler->prepareDispatch(multiDispatchInfo);
+    auto surface = printfHandler->getSurface();
+    ASSERT_NE(nullptr, surface);
+
+    printfHandler.reset();
+    EXPECT_EQ(1u, processor->getPooledSurfacesCount());
+
+    printfHandler.reset(PrintfHandler::create(multiDispatchInfo, *device));
+    printfHandler->prepareDispatch(multiDispatchInfo);
+    EXPECT_EQ(surface, printfHandler->getSurface());
+    EXPECT_EQ(0u, processor->getPooledSurfacesCount());
+}
+
+TEST(PrintfHandlerTest, givenAsyncPrintfEnabledWhenOutputIsSubmittedThenItIsPrintedOnlyAfterTaskCountIsCompleted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAsyncPrintf.set(1);
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto processor = device->getAsyncPrintfProcessor();
+    ASSERT_NE(nullptr, processor);
+
+    MockContext context(device.get());
+    auto pKernelInfo = std::make_unique<MockKernelInfo>();
+    pKernelInfo->setPrintfSurface(sizeof(uintptr_t), 0);
+
+    auto program = std::make_unique<MockProgram>(&context, false, toClDeviceVector(*device));
+    auto kernel = std::make_unique<MockKernel>(program.get(), *pKernelInfo, *device);
+    uint64_t crossThread[10];
+    kernel->setCrossThreadData(&crossThread, sizeof(uint64_t) * 8);
+
+    MockMultiDispatchInfo multiDispatchInfo(device.get(), kernel.get());
+    std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, *device));
+    printfHandler->prepareDispatch(multiDispatchInfo);
+
+    auto &csr = device->getGpgpuCommandStreamReceiver();
+    *csr.getTagAddress() = 0;
+    auto refInternalCount = kernel->getRefInternalCount();
+
+    processor->submit(std::move(printfHandler), csr, 1);
+    EXPECT_EQ(refInternalCount + 1, kernel->getRefInternalCount());
+
+    processor->printCompletedOutputs();
+    EXPECT_EQ(1u, processor->getPendingOutputsCount());
+    EXPECT_EQ(0u, processor->getPooledSurfacesCount());
+
+    *csr.getTagAddress() = 1;
+    processor->printCompletedOutputs();
+    EXPECT_EQ(0u, processor->getPendingOutputsCount());
+    EXPECT_EQ(1u, processor->getPooledSurfacesCount());
+    EXPECT_EQ(refInternalCount, kernel->getRefInternalCount());
+}
@@ -51,9 +51,11 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace NEO;
@@ -2378,6 +2380,30 @@ TEST_F(ProgramTests, givenSeparateBlockKernelsWhenNoParentAndSubgroupKernelsThen
     EXPECT_EQ(0u, program.getBlockKernelManager()->getCount());
 }
 
+TEST_F(ProgramTests, givenKernelInfosWhenGettingKernelInfoByNameThenFirstKernelInfoWithMatchingNameIsReturned) {
+    MockProgram program(pContext, false, toClDeviceVector(*pClDevice));
+
+    auto pKernel1Info = new KernelInfo();
+    pKernel1Info->kernelDescriptor.kernelMetadata.kernelName = "kernel_1";
+    program.addKernelInfo(pKernel1Info, rootDeviceIndex);
+
+    auto pKernel2Info = new KernelInfo();
+    pKernel2Info->kernelDescriptor.kernelMetadata.kernelName = "kernel_2";
+    program.addKernelInfo(pKernel2Info, rootDeviceIndex);
+
+    auto pDuplicatedKernel1Info = new KernelInfo();
+    pDuplicatedKernel1Info->kernelDescriptor.kernelMetadata.kernelName = "kernel_1";
+    program.addKernelInfo(pDuplicatedKernel1Info, rootDeviceIndex);
+
+    EXPECT_EQ(pKernel1Info, program.getKernelInfo("kernel_1", rootDeviceIndex));
+    EXPECT_EQ(pKernel2Info, program.getKernelInfo("kernel_2", rootDeviceIndex));
+    EXPECT_EQ(nullptr, program.getKernelInfo("kernel_3", rootDeviceIndex));
+    EXPECT_EQ(nullptr, program.getKernelInfo(nullptr, rootDeviceIndex));
+
+    program.cleanCurrentKernelInfo(rootDeviceIndex);
+    EXPECT_EQ(nullptr, program.getKernelInfo("kernel_1", rootDeviceIndex));
+}
+
 TEST_F(ProgramTests, givenSeparateBlockKernelsWhenRegularKernelsThenSeparateNoneKernel) {
     MockProgram program(pContext, false, toClDeviceVector(*pClDevice));
 
@@ -3040,6 +3066,49 @@ TEST(ProgramCallbackTest, whenInvokeCallbackIsCalledThenFunctionIsProperlyInvoke
     program.invokeCallback(nullptr, nullptr);
 }
 
+void CL_CALLBACK asyncBuildCallbackFuncProgram(
+    cl_program program,
+    void *userData) {
+    *reinterpret_cast<std::atomic<bool> *>(userData) = true;
+}
+
+TEST_F(ProgramFromSourceTest, givenAsyncProgramBuildEnabledWhenBuildingProgramWithCallbackThenBuildResultsAreAvailableAfterWait) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+    std::atomic<bool> callbackInvoked{false};
+
+    retVal = clBuildProgram(pProgram, 1, devices, nullptr, asyncBuildCallbackFuncProgram, &callbackInvoked);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto kernel = clCreateKernel(pProgram, kernelName, &retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(pProgram->isAsyncBuildPending());
+
+    cl_build_status buildStatus = CL_BUILD_NONE;
+    retVal = clGetProgramBuildInfo(pProgram, devices[0], CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+
+    while (!callbackInvoked) {
+        std::this_thread::yield();
+    }
+    clReleaseKernel(kernel);
+}
+
+TEST_F(ProgramFromSourceTest, givenPendingAsyncBuildWhenBuildingOrQueryingProgramThenBuildInProgressIsReported) {
+    pProgram->asyncBuildPending = true;
+
+    retVal = clBuildProgram(pProgram, 1, devices, nullptr, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    cl_build_status buildStatus = CL_BUILD_NONE;
+    retVal = clGetProgramBuildInfo(pProgram, devices[0], CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_IN_PROGRESS, buildStatus);
+
+    pProgram->asyncBuildPending = false;
+}
+
 TEST(BuildProgramTest, givenMultiDeviceProgramWhenBuildingThenStoreAndProcessBinaryOnlyOncePerRootDevice) {
     MockProgram *pProgram = nullptr;
     std::unique_ptr<char[]> pSource = nullptr;
@@ -3158,6 +3227,55 @@ TEST(BuildProgramTest, givenMultiDeviceProgramWhenBuildingThenStoreKernelInfoPer
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+struct MockCompilerInterfaceCountBuilds : MockCompilerInterfaceCaptureBuildOptions {
+    TranslationOutput::ErrorCode build(const NEO::Device &device, const TranslationInput &input, TranslationOutput &out) override {
+        buildCalled++;
+        return TranslationOutput::ErrorCode::Success;
+    }
+
+    std::atomic<uint32_t> buildCalled{0};
+};
+
+TEST(BuildProgramTest, givenMultiDeviceProgramWithSameHardwareInfoWhenBuildingThenDeviceBinaryIsCompiledOnceAndSetForEachRootDevice) {
+    MockUnrestrictiveContextMultiGPU context;
+    auto cip = new MockCompilerInterfaceCountBuilds();
+    context.getDevice(0)->getExecutionEnvironment()->rootDeviceEnvironments[context.getDevice(0)->getRootDeviceIndex()]->compilerInterface.reset(cip);
+
+    const char *sources[1] = {"kernel void k(){}"};
+    size_t sourceSize = strlen(sources[0]);
+    cl_int retVal = CL_INVALID_PROGRAM;
+    std::unique_ptr<MockProgram> pProgram(Program::create<MockProgram>(&context, 1, sources, &sourceSize, retVal));
+    ASSERT_NE(nullptr, pProgram);
+
+    pProgram->build(pProgram->getDevices(), nullptr, false);
+
+    EXPECT_EQ(1u, cip->buildCalled.load());
+    for (auto &rootDeviceIndex : context.getRootDeviceIndices()) {
+        EXPECT_EQ(1, pProgram->replaceDeviceBinaryCalledPerRootDevice[rootDeviceIndex]);
+    }
+}
+
+TEST(BuildProgramTest, givenMultiDeviceProgramWithDifferentHardwareInfoWhenBuildingThenDeviceBinaryIsCompiledForEachHardwareInfo) {
+    MockUnrestrictiveContextMultiGPU context;
+    auto cip = new MockCompilerInterfaceCountBuilds();
+    auto executionEnvironment = context.getDevice(0)->getExecutionEnvironment();
+    executionEnvironment->rootDeviceEnvironments[context.getDevice(0)->getRootDeviceIndex()]->compilerInterface.reset(cip);
+    executionEnvironment->rootDeviceEnvironments[context.pRootDevice1->getRootDeviceIndex()]->getMutableHardwareInfo()->platform.usRevId++;
+
+    const char *sources[1] = {"kernel void k(){}"};
+    size_t sourceSize = strlen(sources[0]);
+    cl_int retVal = CL_INVALID_PROGRAM;
+    std::unique_ptr<MockProgram> pProgram(Program::create<MockProgram>(&context, 1, sources, &sourceSize, retVal));
+    ASSERT_NE(nullptr, pProgram);
+
+    pProgram->build(pProgram->getDevices(), nullptr, false);
+
+    EXPECT_EQ(2u, cip->buildCalled.load());
+    for (auto &rootDeviceIndex : context.getRootDeviceIndices()) {
+        EXPECT_EQ(1, pProgram->replaceDeviceBinaryCalledPerRootDevice[rootDeviceIndex]);
+    }
+}
+
 TEST(ProgramTest, whenProgramIsBuiltAsAnExecutableForAtLeastOneDeviceThenIsBuiltMethodReturnsTrue) {
     MockSpecializedContext context;
     MockProgram program(&context, false, context.getDevices());
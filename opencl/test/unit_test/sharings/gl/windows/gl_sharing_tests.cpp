@@ -599,6 +599,8 @@ TEST_F(glSharingTests, givenHwCommandQueueWhenAcquireAndReleaseCallsAreMadeWithE
 }
 
 HWTEST_F(glSharingTests, givenCommandQueueWhenReleaseGlObjectIsCalledThenFinishIsCalled) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableGlGpuSyncRelease.set(0);
     MockCommandQueueHw<FamilyType> mockCmdQueue(&context, context.getDevice(0), nullptr);
     auto glBuffer = clCreateFromGLBuffer(&context, 0, bufferId, nullptr);
 
@@ -610,6 +612,82 @@ HWTEST_F(glSharingTests, givenCommandQueueWhenReleaseGlObjectIsCalledThenFinishI
     clReleaseMemObject(glBuffer);
 }
 
+struct GlGpuSyncReleaseTests : public glSharingTests {
+    void SetUp() override {
+        glSharingTests::SetUp();
+        DebugManager.flags.EnableGlGpuSyncRelease.set(1);
+        mockGlSharingFunctions->GLContextHandle = 1;
+        mockGlSharingFunctions->GLDeviceHandle = 2;
+        mockGlSharingFunctions->pfnGlArbSyncObjectSetup = mockGlArbSyncObjectSetup<false>;
+        mockGlSharingFunctions->pfnGlArbSyncObjectCleanup = glArbSyncObjectCleanupMockDoNothing;
+        mockGlSharingFunctions->pfnGlArbSyncObjectSignal = glArbSyncObjectSignalMockDoNothing;
+        mockGlSharingFunctions->pfnGlArbSyncObjectWaitServer = glArbSyncObjectWaitServerMock;
+
+        auto &rootDeviceEnvironment = *context.getDevice(0)->getExecutionEnvironment()->rootDeviceEnvironments[rootDeviceIndex];
+        if (rootDeviceEnvironment.osInterface == nullptr) {
+            rootDeviceEnvironment.osInterface.reset(new OSInterface);
+            osInterfaceCreated = true;
+        }
+    }
+
+    void TearDown() override {
+        mockGlSharingFunctions->cleanupReleaseSyncObjects(false);
+        if (osInterfaceCreated) {
+            context.getDevice(0)->getExecutionEnvironment()->rootDeviceEnvironments[rootDeviceIndex]->osInterface.reset();
+        }
+    }
+
+    static void glArbSyncObjectWaitServerMock(OSInterface &osInterface, CL_GL_SYNC_INFO &glSyncInfo) {
+        glSyncInfo.waitCalled = true;
+    }
+
+    DebugManagerStateRestore restore;
+    bool osInterfaceCreated = false;
+};
+
+HWTEST_F(GlGpuSyncReleaseTests, givenGpuSyncSupportedWhenReleaseGlObjectIsCalledThenGlContextWaitsOnGpuInsteadOfFinish) {
+    MockCommandQueueHw<FamilyType> mockCmdQueue(&context, context.getDevice(0), nullptr);
+    auto glBuffer = clCreateFromGLBuffer(&context, 0, bufferId, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, clEnqueueAcquireGLObjects(&mockCmdQueue, 1, &glBuffer, 0, nullptr, nullptr));
+    mockCmdQueue.taskCount = 5u;
+    mockCmdQueue.latestTaskCountWaited = 0u;
+    EXPECT_EQ(CL_SUCCESS, clEnqueueReleaseGLObjects(&mockCmdQueue, 1, &glBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(0u, mockCmdQueue.latestTaskCountWaited);
+
+    ASSERT_EQ(1u, mockGlSharingFunctions->releaseSyncObjects.size());
+    EXPECT_TRUE(mockGlSharingFunctions->releaseSyncObjects[0].syncInfo->waitCalled);
+    EXPECT_EQ(mockCmdQueue.taskCount, mockGlSharingFunctions->releaseSyncObjects[0].taskCount);
+
+    clReleaseMemObject(glBuffer);
+}
+
+HWTEST_F(GlGpuSyncReleaseTests, givenSyncObjectSetupFailureWhenReleaseGlObjectIsCalledThenFinishIsCalled) {
+    mockGlSharingFunctions->pfnGlArbSyncObjectSetup = mockGlArbSyncObjectSetup<true>;
+    MockCommandQueueHw<FamilyType> mockCmdQueue(&context, context.getDevice(0), nullptr);
+    auto glBuffer = clCreateFromGLBuffer(&context, 0, bufferId, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, clEnqueueAcquireGLObjects(&mockCmdQueue, 1, &glBuffer, 0, nullptr, nullptr));
+    mockCmdQueue.taskCount = 5u;
+    EXPECT_EQ(CL_SUCCESS, clEnqueueReleaseGLObjects(&mockCmdQueue, 1, &glBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(5u, mockCmdQueue.latestTaskCountWaited);
+    EXPECT_TRUE(mockGlSharingFunctions->releaseSyncObjects.empty());
+
+    clReleaseMemObject(glBuffer);
+}
+
+TEST_F(GlGpuSyncReleaseTests, givenGpuSyncDisabledWhenCheckingSupportThenFalseIsReturned) {
+    auto &csr = *context.getDevice(0)->getDefaultEngine().commandStreamReceiver;
+    EXPECT_TRUE(mockGlSharingFunctions->isGpuSyncReleaseSupported(csr));
+
+    DebugManager.flags.EnableGlGpuSyncRelease.set(0);
+    EXPECT_FALSE(mockGlSharingFunctions->isGpuSyncReleaseSupported(csr));
+
+    DebugManager.flags.EnableGlGpuSyncRelease.set(-1);
+    mockGlSharingFunctions->GLContextHandle = 0;
+    EXPECT_FALSE(mockGlSharingFunctions->isGpuSyncReleaseSupported(csr));
+}
+
 TEST_F(glSharingTests, givenMockGLWhenFunctionsAreCalledThenCallsAreReceived) {
     auto ptrToStruct = &mockGlSharing->m_clGlResourceInfo;
     auto glDisplay = (GLDisplay)1;
@@ -38,6 +38,12 @@
 
 using namespace NEO;
 
+namespace NEO {
+namespace SysCalls {
+extern uint32_t closeFuncCalled;
+} // namespace SysCalls
+} // namespace NEO
+
 class VaSharingTests : public ::testing::Test, public PlatformFixture {
   public:
     void SetUp() override {
@@ -280,6 +286,63 @@ TEST_F(VaSharingTests, givenMockVaWhenVaSurfaceIsCreatedThenMemObjectHasVaHandle
     delete vaSurface;
 }
 
+TEST_F(VaSharingTests, givenImportCacheEnabledWhenSameSurfaceIsCreatedAgainThenImportedAllocationIsReused) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableVaSurfaceImportCache.set(1);
+    vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto firstSurface = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                                CL_MEM_READ_WRITE, 0, &vaSurfaceId, 1, &errCode));
+    ASSERT_NE(nullptr, firstSurface);
+    auto graphicsAllocation = firstSurface->getGraphicsAllocation(rootDeviceIndex);
+    auto gmm = graphicsAllocation->getDefaultGmm();
+    size_t rowPitch = firstSurface->getImageDesc().image_row_pitch;
+    EXPECT_EQ(1u, vaSharing->sharingFunctions.importedSurfaces.size());
+    EXPECT_EQ(2u, graphicsAllocation->peekReuseCount());
+
+    firstSurface.reset();
+    EXPECT_EQ(1u, graphicsAllocation->peekReuseCount());
+
+    VariableBackup<uint32_t> closeCalledBackup(&SysCalls::closeFuncCalled, 0u);
+    auto secondSurface = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                                 CL_MEM_READ_WRITE, 0, &vaSurfaceId, 1, &errCode));
+    ASSERT_NE(nullptr, secondSurface);
+    EXPECT_EQ(graphicsAllocation, secondSurface->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(gmm, secondSurface->getGraphicsAllocation(rootDeviceIndex)->getDefaultGmm());
+    EXPECT_EQ(rowPitch, secondSurface->getImageDesc().image_row_pitch);
+    EXPECT_EQ(128u, secondSurface->getImageDesc().image_width);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+    EXPECT_EQ(1u, vaSharing->sharingFunctions.importedSurfaces.size());
+    EXPECT_EQ(2u, graphicsAllocation->peekReuseCount());
+}
+
+TEST_F(VaSharingTests, givenImportCacheEnabledWhenSurfaceIdIsRecycledWithOtherBufferThenSurfaceIsImportedAgain) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableVaSurfaceImportCache.set(1);
+
+    auto firstSurface = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                                CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, firstSurface);
+    EXPECT_EQ(1u, firstSurface->getGraphicsAllocation(rootDeviceIndex)->peekSharedHandle());
+    firstSurface.reset();
+
+    updateAcquiredHandle(2u);
+    auto secondSurface = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                                 CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, secondSurface);
+    EXPECT_EQ(2u, secondSurface->getGraphicsAllocation(rootDeviceIndex)->peekSharedHandle());
+    ASSERT_EQ(1u, vaSharing->sharingFunctions.importedSurfaces.size());
+    EXPECT_EQ(2u, vaSharing->sharingFunctions.importedSurfaces[0].bufferId);
+}
+
+TEST_F(VaSharingTests, givenImportCacheDisabledWhenVaSurfaceIsCreatedThenNothingIsCached) {
+    auto vaSurface = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                             CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface);
+    EXPECT_EQ(0u, vaSurface->getGraphicsAllocation(rootDeviceIndex)->peekReuseCount());
+    EXPECT_TRUE(vaSharing->sharingFunctions.importedSurfaces.empty());
+}
+
 TEST_F(VaSharingTests, givenInvalidPlaneWhenVaSurfaceIsCreatedAndNotRGBPThenUnrecoverableIsCalled) {
     EXPECT_THROW(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
                                                   CL_MEM_READ_WRITE, 0, &vaSurfaceId, 2, &errCode),
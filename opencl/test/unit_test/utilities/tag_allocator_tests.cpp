@@ -97,7 +97,7 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::freeTags;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
-    using BaseClass::usedTags;
+    using BaseClass::usedTagsCount;
     using BaseClass::TagAllocatorBase::cleanUpResources;
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment, bool disableCompletionCheck, DeviceBitfield deviceBitfield)
@@ -116,8 +116,8 @@ class MockTagAllocator : public TagAllocator<TagType> {
         return this->freeTags.peekHead();
     }
 
-    TagNodeT *getUsedTagsHead() {
-        return this->usedTags.peekHead();
+    size_t getUsedTagsCount() {
+        return this->usedTagsCount.load();
     }
 
     size_t getGraphicsAllocationsCount() {
@@ -141,7 +141,7 @@ TEST_F(TagAllocatorTest, WhenTagAllocatorIsCreatedThenItIsCorrectlyInitialized)
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
 
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 
     void *gfxMemory = tagAllocator.getGraphicsAllocation()->getUnderlyingBuffer();
     void *head = reinterpret_cast<void *>(tagAllocator.getFreeTagsHead()->tagForCpuAccess);
@@ -154,28 +154,25 @@ TEST_F(TagAllocatorTest, WhenGettingAndReturningTagThenFreeAndUsedListsAreUpdate
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 
     auto tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
 
     EXPECT_NE(nullptr, tagNode);
 
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
-    IDList<TagNode<TimeStamps>> &usedList = tagAllocator.usedTags;
+    auto &freeList = tagAllocator.freeTags;
 
-    bool isFoundOnUsedList = usedList.peekContains(*tagNode);
     bool isFoundOnFreeList = freeList.peekContains(*tagNode);
 
     EXPECT_FALSE(isFoundOnFreeList);
-    EXPECT_TRUE(isFoundOnUsedList);
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
 
     tagAllocator.returnTag(tagNode);
 
-    isFoundOnUsedList = usedList.peekContains(*tagNode);
     isFoundOnFreeList = freeList.peekContains(*tagNode);
 
     EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_FALSE(isFoundOnUsedList);
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 }
 
 TEST_F(TagAllocatorTest, WhenTagAllocatorIsCreatedThenItPopulatesTagsWithProperDeviceBitfield) {
@@ -271,7 +268,7 @@ TEST_F(TagAllocatorTest, GivenSpecificOrderWhenReturningTagsThenFreeListIsUpdate
     EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
     EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
 
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
+    auto &freeList = tagAllocator.freeTags;
     bool isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
     EXPECT_FALSE(isFoundOnFreeList);
 
@@ -363,18 +360,18 @@ TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhen
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield);
 
     auto tag = tagAllocator.getTag();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead()); // only 1 reference
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount()); // only 1 reference
 
     tag = tagAllocator.getTag();
     tag->incRefCount();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
 
     tagAllocator.returnTag(tag);
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead()); // 1 reference left
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount()); // 1 reference left
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 }
 
 TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
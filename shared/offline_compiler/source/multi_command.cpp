@@ -9,19 +9,25 @@
 
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/parallel_tasks.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 
 namespace NEO {
-int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+int MultiCommand::singleBuild(BuildCommand &command, bool useSafetyGuard) {
     int retVal = OfflineCompiler::ErrorCode::SUCCESS;
+    const auto &args = command.args;
+    auto outFileName = command.outFileName;
 
     if (requestedFatBinary(args, argHelper)) {
         retVal = buildFatBinary(args, argHelper);
     } else {
         std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
         if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+            // safety guard recovers from crash through process wide jump buffer, it can't be used by concurrent builds
+            retVal = useSafetyGuard ? buildWithSafetyGuard(pCompiler.get()) : pCompiler->build();
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
@@ -38,11 +44,10 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     }
 
     if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        command.outputFileEntry = getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
     } else {
-        outputFile << "Unsuccesful build";
+        command.outputFileEntry = "Unsuccesful build";
     }
-    outputFile << '\n';
 
     return retVal;
 }
@@ -64,14 +69,19 @@ MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &re
     return pMultiCommand;
 }
 
-void MultiCommand::addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &singleLineWithArguments, size_t buildId) {
+void MultiCommand::addAdditionalOptionsToSingleCommandLine(BuildCommand &command, size_t buildId) {
+    auto &singleLineWithArguments = command.args;
     bool hasOutDir = false;
     bool hasOutName = false;
-    for (const auto &arg : singleLineWithArguments) {
+    for (size_t argIndex = 0; argIndex < singleLineWithArguments.size(); argIndex++) {
+        const auto &arg = singleLineWithArguments[argIndex];
         if (ConstStringRef("-out_dir") == arg) {
             hasOutDir = true;
         } else if (ConstStringRef("-output") == arg) {
             hasOutName = true;
+            if (argIndex + 1 < singleLineWithArguments.size()) {
+                command.outFileName = singleLineWithArguments[argIndex + 1];
+            }
         }
     }
 
@@ -82,8 +92,8 @@ void MultiCommand::addAdditionalOptionsToSingleCommandLine(std::vector<std::stri
     }
     if (!hasOutName) {
         singleLineWithArguments.push_back("-output");
-        outFileName = "build_no_" + std::to_string(buildId + 1);
-        singleLineWithArguments.push_back(outFileName);
+        command.outFileName = "build_no_" + std::to_string(buildId + 1);
+        singleLineWithArguments.push_back(command.outFileName);
     }
     if (quiet)
         singleLineWithArguments.push_back("-q");
@@ -102,6 +112,8 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             pathToCommandFile = args[++argIndex];
         } else if (hasMoreArgs && ConstStringRef("-output_file_list") == currArg) {
             outputFileList = args[++argIndex];
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            workersCount = static_cast<size_t>(std::max(1, atoi(args[++argIndex].c_str())));
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
         } else {
@@ -132,22 +144,57 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    std::vector<BuildCommand> commands(lines.size());
     for (size_t i = 0; i < lines.size(); ++i) {
-        std::vector<std::string> args = {argZero};
+        auto &command = commands[i];
+        command.args = {argZero};
 
-        int retVal = splitLineInSeparateArgs(args, lines[i], i);
-        if (retVal != OfflineCompiler::ErrorCode::SUCCESS) {
-            retValues.push_back(retVal);
+        command.retVal = splitLineInSeparateArgs(command.args, lines[i], i);
+        if (command.retVal != OfflineCompiler::ErrorCode::SUCCESS) {
             continue;
         }
+        addAdditionalOptionsToSingleCommandLine(command, i);
+        command.parsed = true;
+    }
 
+    auto runBuild = [&](size_t buildId, bool useSafetyGuard) {
         if (!quiet) {
-            argHelper->printf("Command numer %zu: \n", i + 1);
+            argHelper->printf("Command numer %zu: \n", buildId + 1);
+        }
+        commands[buildId].retVal = singleBuild(commands[buildId], useSafetyGuard);
+    };
+
+    if (workersCount > 1) {
+        // fat binary builds are left to calling thread, they use safety guard for each target
+        std::vector<size_t> parallelBuilds;
+        for (size_t i = 0; i < commands.size(); ++i) {
+            if (commands[i].parsed && !requestedFatBinary(commands[i].args, argHelper)) {
+                parallelBuilds.push_back(i);
+            }
+        }
+        auto parallelBuild = [&](size_t taskId) {
+            runBuild(parallelBuilds[taskId], false);
+        };
+        runParallelTasks(parallelBuilds.size(), workersCount, parallelBuild);
+
+        for (size_t i = 0; i < commands.size(); ++i) {
+            if (commands[i].parsed && requestedFatBinary(commands[i].args, argHelper)) {
+                runBuild(i, true);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < commands.size(); ++i) {
+            if (commands[i].parsed) {
+                runBuild(i, true);
+            }
         }
+    }
 
-        addAdditionalOptionsToSingleCommandLine(args, i);
-        retVal = singleBuild(args);
-        retValues.push_back(retVal);
+    for (const auto &command : commands) {
+        retValues.push_back(command.retVal);
+        if (command.parsed) {
+            outputFile << command.outputFileEntry << '\n';
+        }
     }
 }
 
@@ -166,6 +213,9 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <N>                        Number of builds run in parallel.
+                                Default is 1 (builds run one by one).
+
 )===");
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,22 +31,30 @@ class MultiCommand {
     std::string outputFileList;
 
   protected:
+    struct BuildCommand {
+        std::vector<std::string> args;
+        std::string outFileName;
+        std::string outputFileEntry;
+        int retVal = 0;
+        bool parsed = false;
+    };
+
     MultiCommand() = default;
 
     int initialize(const std::vector<std::string> &args);
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
-    int singleBuild(const std::vector<std::string> &args);
-    void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
+    int singleBuild(BuildCommand &command, bool useSafetyGuard);
+    void addAdditionalOptionsToSingleCommandLine(BuildCommand &command, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
     std::vector<std::string> lines;
-    std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    size_t workersCount = 1;
     bool quiet = false;
 };
 } // namespace NEO
@@ -13,6 +13,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -57,10 +58,13 @@ class OclocArgHelper {
     std::map<std::string, unsigned int> genIGFXMap;
     void moveOutputs();
     MessagePrinter messagePrinter;
+    // builds run in parallel by ocloc multi and fatbinary share single helper
+    std::mutex outputMutex;
     Source *findSourceFile(const std::string &filename);
     bool sourceFileExists(const std::string &filename) const;
 
     inline void addOutput(const std::string &filename, const void *data, const size_t &size) {
+        std::lock_guard<std::mutex> lock(outputMutex);
         outputs.push_back(new Output(filename, data, size));
     }
 
@@ -97,10 +101,12 @@ class OclocArgHelper {
 
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
+        std::lock_guard<std::mutex> lock(outputMutex);
         messagePrinter.printf(message);
     }
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        std::lock_guard<std::mutex> lock(outputMutex);
         messagePrinter.printf(format, std::forward<Args>(args)...);
     }
     std::string returnProductNameForDevice(unsigned short deviceId);
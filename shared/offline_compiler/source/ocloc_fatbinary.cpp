@@ -13,13 +13,16 @@
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_tasks.h"
 
 #include "compiler_options.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 
 namespace NEO {
 
@@ -197,11 +200,21 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string inputFileName = "";
     std::string outputFileName = "";
     std::string outputDirectory = "";
+    size_t workersCount = 1;
 
-    std::vector<std::string> argsCopy(args);
-    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
-        const auto &currArg = args[argIndex];
-        const bool hasMoreArgs = (argIndex + 1 < args.size());
+    // -j is consumed here, it is not passed to compilers of each target
+    std::vector<std::string> argsCopy;
+    for (size_t argIndex = 0; argIndex < args.size(); argIndex++) {
+        if ((ConstStringRef("-j") == args[argIndex]) && (argIndex + 1 < args.size())) {
+            workersCount = static_cast<size_t>(std::max(1, atoi(args[++argIndex].c_str())));
+            continue;
+        }
+        argsCopy.push_back(args[argIndex]);
+    }
+
+    for (size_t argIndex = 1; argIndex < argsCopy.size(); argIndex++) {
+        const auto &currArg = argsCopy[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < argsCopy.size());
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
@@ -210,39 +223,69 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
             pointerSizeInBits = "64";
         } else if ((ConstStringRef("-file") == currArg) && hasMoreArgs) {
-            inputFileName = args[argIndex + 1];
+            inputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-output") == currArg) && hasMoreArgs) {
-            outputFileName = args[argIndex + 1];
+            outputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
-            outputDirectory = args[argIndex + 1];
+            outputDirectory = argsCopy[argIndex + 1];
             ++argIndex;
         }
     }
 
     std::vector<ConstStringRef> targetPlatforms;
-    targetPlatforms = getTargetPlatformsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    targetPlatforms = getTargetPlatformsForFatbinary(ConstStringRef(argsCopy[deviceArgIndex]), argHelper);
     if (targetPlatforms.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", argsCopy[deviceArgIndex].c_str());
         return 1;
     }
 
     NEO::Ar::ArEncoder fatbinary(true);
 
-    for (auto targetPlatform : targetPlatforms) {
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers(targetPlatforms.size());
+    std::vector<std::vector<std::string>> targetsArgs(targetPlatforms.size(), argsCopy);
+    auto createCompiler = [&](size_t targetId) {
         int retVal = 0;
-        argsCopy[deviceArgIndex] = targetPlatform.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+        targetsArgs[targetId][deviceArgIndex] = targetPlatforms[targetId].str();
+        compilers[targetId].reset(OfflineCompiler::create(targetsArgs[targetId].size(), targetsArgs[targetId], false, retVal, argHelper));
         if (OfflineCompiler::ErrorCode::SUCCESS != retVal) {
             argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
         }
+        return retVal;
+    };
+
+    std::vector<int> buildRetVals(targetPlatforms.size(), 0);
+    if (workersCount > 1) {
+        for (size_t targetId = 0; targetId < targetPlatforms.size(); targetId++) {
+            auto retVal = createCompiler(targetId);
+            if (OfflineCompiler::ErrorCode::SUCCESS != retVal) {
+                return retVal;
+            }
+        }
+
+        // safety guard recovers from crash through process wide jump buffer, it can't be used by concurrent builds
+        auto buildTarget = [&](size_t targetId) {
+            buildRetVals[targetId] = compilers[targetId]->build();
+        };
+        runParallelTasks(targetPlatforms.size(), workersCount, buildTarget);
+    }
+
+    for (size_t targetId = 0; targetId < targetPlatforms.size(); targetId++) {
+        int retVal = 0;
+        if (workersCount == 1) {
+            retVal = createCompiler(targetId);
+            if (OfflineCompiler::ErrorCode::SUCCESS != retVal) {
+                return retVal;
+            }
+        }
+        auto &targetPlatform = targetPlatforms[targetId];
+        auto &pCompiler = compilers[targetId];
+        auto &argsForTarget = targetsArgs[targetId];
 
         auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
         if (retVal == 0) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+            retVal = (workersCount > 1) ? buildRetVals[targetId] : buildWithSafetyGuard(pCompiler.get());
 
             std::string buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
@@ -255,7 +298,7 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             } else {
                 argHelper->printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
                 argHelper->printf("Command was:");
-                for (const auto &arg : argsCopy)
+                for (const auto &arg : argsForTarget)
                     argHelper->printf(" %s", arg.c_str());
                 argHelper->printf("\n");
             }
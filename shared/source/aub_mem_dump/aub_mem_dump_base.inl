@@ -104,6 +104,11 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    // in asynchronous mode records are gathered into chunks of this size and written to file by background thread
+    static constexpr size_t asyncWriteChunkSize = 4 * 1024 * 1024;
+
+    AubFileStream();
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -127,6 +132,19 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    static void *writeChunks(void *self);
+    void submitPendingData();
+
+    // pending data is guarded by stream mutex held by callers of write
+    std::vector<char> pendingData;
+    std::deque<std::vector<char>> writeQueue;
+    std::mutex writeQueueMutex;
+    std::condition_variable writeQueueCondition;
+    std::unique_ptr<NEO::Thread> writerThread;
+    bool keepWriting = false;
+    bool writingChunk = false;
 };
 
 template <int addressingBits>
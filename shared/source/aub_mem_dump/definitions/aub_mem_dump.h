@@ -6,11 +6,15 @@
  */
 
 #pragma once
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
+#include <deque>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #ifndef BIT
 #define BIT(x) (((uint64_t)1) << (x))
@@ -20,7 +24,8 @@
 
 namespace NEO {
 class AubHelper;
-}
+class Thread;
+} // namespace NEO
 
 namespace AubMemDump {
 #include "shared/source/aub_mem_dump/aub_mem_dump_base.inl"
@@ -38,13 +38,17 @@ const SipKernel &BuiltIns::getSipKernel(SipKernelType type, Device &device) {
     auto initializer = [&] {
         std::vector<char> sipBinary;
         std::vector<char> stateSaveAreaHeader;
-        auto compilerInteface = device.getCompilerInterface();
-        UNRECOVERABLE_IF(compilerInteface == nullptr);
+        auto executionEnvironment = device.getExecutionEnvironment();
+        if (!executionEnvironment->getCachedSipBinary(type, device.getHardwareInfo(), sipBinary, stateSaveAreaHeader)) {
+            auto compilerInteface = device.getCompilerInterface();
+            UNRECOVERABLE_IF(compilerInteface == nullptr);
 
-        auto ret = compilerInteface->getSipKernelBinary(device, type, sipBinary, stateSaveAreaHeader);
+            auto ret = compilerInteface->getSipKernelBinary(device, type, sipBinary, stateSaveAreaHeader);
 
-        UNRECOVERABLE_IF(ret != TranslationOutput::ErrorCode::Success);
-        UNRECOVERABLE_IF(sipBinary.size() == 0);
+            UNRECOVERABLE_IF(ret != TranslationOutput::ErrorCode::Success);
+            UNRECOVERABLE_IF(sipBinary.size() == 0);
+            executionEnvironment->cacheSipBinary(type, device.getHardwareInfo(), sipBinary, stateSaveAreaHeader);
+        }
 
         const auto allocType = GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL;
 
@@ -16,6 +16,7 @@
 #include "shared/source/helpers/heap_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 namespace NEO {
@@ -26,10 +27,8 @@ CommandContainer::~CommandContainer() {
         return;
     }
 
-    auto memoryManager = device->getMemoryManager();
-
     for (auto *alloc : cmdBufferAllocations) {
-        memoryManager->freeGraphicsMemory(alloc);
+        storeCommandBufferAllocation(alloc);
     }
 
     for (auto allocationIndirectHeap : allocationIndirectHeaps) {
@@ -48,15 +47,7 @@ ErrorCode CommandContainer::initialize(Device *device) {
     this->device = device;
 
     size_t alignedSize = alignUp<size_t>(totalCmdBufferSize, MemoryConstants::pageSize64k);
-    AllocationProperties properties{device->getRootDeviceIndex(),
-                                    true /* allocateMemory*/,
-                                    alignedSize,
-                                    GraphicsAllocation::AllocationType::COMMAND_BUFFER,
-                                    (device->getNumAvailableDevices() > 1u) /* multiOsContextCapable */,
-                                    false,
-                                    device->getDeviceBitfield()};
-
-    auto cmdBufferAllocation = device->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    auto cmdBufferAllocation = obtainCommandBufferAllocation();
     if (!cmdBufferAllocation) {
         return ErrorCode::OUT_OF_DEVICE_MEMORY;
     }
@@ -120,12 +111,15 @@ void CommandContainer::removeDuplicatesFromResidencyContainer() {
 void CommandContainer::reset() {
     setDirtyStateForAllHeaps(true);
     slmSize = std::numeric_limits<uint32_t>::max();
+    initialL3Config = std::numeric_limits<uint32_t>::max();
+    lastSentL3Config = std::numeric_limits<uint32_t>::max();
+    l3ConfigChangesCount = 0;
     getResidencyContainer().clear();
     getDeallocationContainer().clear();
     sshAllocations.clear();
 
     for (size_t i = 1; i < cmdBufferAllocations.size(); i++) {
-        device->getMemoryManager()->freeGraphicsMemory(cmdBufferAllocations[i]);
+        storeCommandBufferAllocation(cmdBufferAllocations[i]);
     }
     cmdBufferAllocations.erase(cmdBufferAllocations.begin() + 1, cmdBufferAllocations.end());
 
@@ -220,25 +214,54 @@ IndirectHeap *CommandContainer::getHeapWithRequiredSizeAndAlignment(HeapType hea
 }
 
 void CommandContainer::allocateNextCommandBuffer() {
-    size_t alignedSize = alignUp<size_t>(totalCmdBufferSize, MemoryConstants::pageSize64k);
-    AllocationProperties properties{0u,
-                                    true /* allocateMemory*/,
-                                    alignedSize,
-                                    GraphicsAllocation::AllocationType::COMMAND_BUFFER,
-                                    (device->getNumAvailableDevices() > 1u) /* multiOsContextCapable */,
-                                    false,
-                                    device->getDeviceBitfield()};
-
-    auto cmdBufferAllocation = device->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    auto cmdBufferAllocation = obtainCommandBufferAllocation();
     UNRECOVERABLE_IF(!cmdBufferAllocation);
 
     cmdBufferAllocations.push_back(cmdBufferAllocation);
 
+    previousCmdBufferUsedSize = commandStream->getUsed();
     commandStream->replaceBuffer(cmdBufferAllocation->getUnderlyingBuffer(), defaultListCmdBufferSize);
     commandStream->replaceGraphicsAllocation(cmdBufferAllocation);
 
     addToResidencyContainer(cmdBufferAllocation);
 }
+void CommandContainer::storeCmdBuffersForReuse(uint32_t taskCount) {
+    UNRECOVERABLE_IF(immediateCmdListCsr == nullptr);
+    // all buffers except the current one are fully consumed, hand them back to CSR until GPU is done with them
+    auto allocationStorage = getCmdBufferReuseStorage();
+    for (size_t i = 0; i + 1 < cmdBufferAllocations.size(); i++) {
+        allocationStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(cmdBufferAllocations[i]), REUSABLE_ALLOCATION, taskCount);
+    }
+    cmdBufferAllocations.erase(cmdBufferAllocations.begin(), cmdBufferAllocations.end() - 1);
+}
+
+InternalAllocationStorage *CommandContainer::getCmdBufferReuseStorage() const {
+    auto csr = immediateCmdListCsr ? immediateCmdListCsr : device->getDefaultEngine().commandStreamReceiver;
+    return csr->getInternalAllocationStorage();
+}
+
+GraphicsAllocation *CommandContainer::obtainCommandBufferAllocation() {
+    size_t alignedSize = alignUp<size_t>(totalCmdBufferSize, MemoryConstants::pageSize64k);
+    auto cmdBufferAllocation = getCmdBufferReuseStorage()->obtainReusableAllocation(alignedSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+    if (cmdBufferAllocation) {
+        return cmdBufferAllocation;
+    }
+
+    AllocationProperties properties{device->getRootDeviceIndex(),
+                                    true /* allocateMemory*/,
+                                    alignedSize,
+                                    GraphicsAllocation::AllocationType::COMMAND_BUFFER,
+                                    (device->getNumAvailableDevices() > 1u) /* multiOsContextCapable */,
+                                    false,
+                                    device->getDeviceBitfield()};
+    return device->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+}
+
+void CommandContainer::storeCommandBufferAllocation(GraphicsAllocation *cmdBufferAllocation) {
+    // GPU may still consume the buffer, it is handed out again only after CSR task count passes current one
+    getCmdBufferReuseStorage()->storeAllocation(std::unique_ptr<GraphicsAllocation>(cmdBufferAllocation), REUSABLE_ALLOCATION);
+}
+
 void CommandContainer::prepareBindfulSsh() {
     if (ApiSpecificConfig::getBindlessConfiguration()) {
         if (allocationIndirectHeaps[IndirectHeap::SURFACE_STATE] == nullptr) {
@@ -17,8 +17,10 @@
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Device;
 class GraphicsAllocation;
+class InternalAllocationStorage;
 class LinearStream;
 
 using ResidencyContainer = std::vector<GraphicsAllocation *>;
@@ -84,6 +86,10 @@ class CommandContainer : public NonCopyableOrMovableClass {
     virtual ~CommandContainer();
 
     uint32_t slmSize = std::numeric_limits<uint32_t>::max();
+    // L3 config required by first kernel is left to be programmed at container boundary, only later changes are encoded
+    uint32_t initialL3Config = std::numeric_limits<uint32_t>::max();
+    uint32_t lastSentL3Config = std::numeric_limits<uint32_t>::max();
+    uint32_t l3ConfigChangesCount = 0;
     uint32_t nextIddInBlock = 0;
     uint32_t lastSentNumGrfRequired = 0;
     bool lastPipelineSelectModeRequired = false;
@@ -93,6 +99,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
 
     IndirectHeap *getHeapWithRequiredSizeAndAlignment(HeapType heapType, size_t sizeRequired, size_t alignment);
     void allocateNextCommandBuffer();
+    void storeCmdBuffersForReuse(uint32_t taskCount);
 
     void reset();
 
@@ -106,12 +113,24 @@ class CommandContainer : public NonCopyableOrMovableClass {
     void setReservedSshSize(size_t reserveSize) {
         reservedSshSize = reserveSize;
     }
+    void setImmediateCmdListCsr(CommandStreamReceiver *newValue) {
+        this->immediateCmdListCsr = newValue;
+    }
+    size_t getPreviousCmdBufferUsedSize() const {
+        return previousCmdBufferUsedSize;
+    }
     HeapContainer sshAllocations;
 
   protected:
+    InternalAllocationStorage *getCmdBufferReuseStorage() const;
+    GraphicsAllocation *obtainCommandBufferAllocation();
+    void storeCommandBufferAllocation(GraphicsAllocation *cmdBufferAllocation);
+
     void *iddBlock = nullptr;
     Device *device = nullptr;
     std::unique_ptr<HeapHelper> heapHelper;
+    CommandStreamReceiver *immediateCmdListCsr = nullptr;
+    size_t previousCmdBufferUsedSize = 0u;
 
     CmdBufferContainer cmdBufferAllocations;
     GraphicsAllocation *allocationIndirectHeaps[HeapType::NUM_TYPES] = {};
@@ -23,6 +23,13 @@ struct HardwareInfo;
 class IndirectHeap;
 class BindlessHeapsHelper;
 
+// CPU pointers to data programmed for single dispatch, valid until command container is reset
+struct EncodedDispatchKernelData {
+    void *walkerCmd = nullptr;
+    void *crossThreadData = nullptr;
+    void *surfaceStateHeapData = nullptr;
+};
+
 template <typename GfxFamily>
 struct EncodeDispatchKernel {
     using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
@@ -41,7 +48,15 @@ struct EncodeDispatchKernel {
                        PreemptionMode preemptionMode,
                        bool &requiresUncachedMocs,
                        uint32_t &partitionCount,
-                       bool isInternal);
+                       bool isInternal,
+                       EncodedDispatchKernelData *encodedData = nullptr);
+
+    // indirect dispatch of the same kernel right after previousWalkerCmd, states programmed for previous walker are reused
+    static void encodeRepeatedIndirect(CommandContainer &container,
+                                       const void *previousWalkerCmd,
+                                       DispatchKernelEncoderI *dispatchInterface,
+                                       Device *device,
+                                       EncodedDispatchKernelData *encodedData = nullptr);
 
     static void encodeAdditionalWalkerFields(const HardwareInfo &hwInfo, WALKER_TYPE &walkerCmd);
 
@@ -41,6 +41,16 @@ uint32_t EncodeStates<Family>::copySamplerState(IndirectHeap *dsh,
     SAMPLER_STATE *dstSamplerState = nullptr;
     uint32_t samplerStateOffsetInDsh = 0;
 
+    // border color precedes sampler states in kernel heap, so both are reused as one block
+    const bool deduplicateStates = IndirectHeap::isStateDeduplicationEnabled() && !ApiSpecificConfig::getBindlessConfiguration();
+    const uint64_t statesTag = (static_cast<uint64_t>(samplerCount) << 32) | borderColorSize;
+    auto srcStates = ptrOffset(fnDynamicStateHeap, borderColorOffset);
+    auto srcStatesSize = borderColorSize + sizeSamplerState;
+    size_t reusedSamplerStateOffset = 0;
+    if (deduplicateStates && dsh->findReusableBlock(statesTag, srcStates, srcStatesSize, reusedSamplerStateOffset)) {
+        return static_cast<uint32_t>(reusedSamplerStateOffset);
+    }
+
     dsh->align(EncodeStates<Family>::alignIndirectStatePointer);
     uint32_t borderColorOffsetInDsh = 0;
     if (!ApiSpecificConfig::getBindlessConfiguration()) {
@@ -80,6 +90,9 @@ uint32_t EncodeStates<Family>::copySamplerState(IndirectHeap *dsh,
         dstSamplerState[i] = state;
     }
 
+    if (deduplicateStates) {
+        dsh->storeReusableBlock(statesTag, srcStates, srcStatesSize, samplerStateOffsetInDsh);
+    }
     return samplerStateOffsetInDsh;
 } // namespace NEO
 
@@ -389,6 +402,14 @@ size_t EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(IndirectHeap
     size_t sshSize = srcKernelSshSize;
     DEBUG_BREAK_IF(srcKernelSsh == nullptr);
 
+    // binding table pointers are patched relative to heap position, so unchanged kernel heap can be referenced again
+    const bool deduplicateStates = IndirectHeap::isStateDeduplicationEnabled() && !ApiSpecificConfig::getBindlessConfiguration();
+    const uint64_t statesTag = (static_cast<uint64_t>(numberOfBindingTableStates) << 32) | offsetOfBindingTable;
+    size_t bindingTableOffset = 0;
+    if (deduplicateStates && dstHeap.findReusableBlock(statesTag, srcKernelSsh, sshSize, bindingTableOffset)) {
+        return bindingTableOffset;
+    }
+
     auto srcSurfaceState = srcKernelSsh;
     // Allocate space for new ssh data
     auto dstSurfaceState = dstHeap.getSpace(sshSize);
@@ -399,6 +420,9 @@ size_t EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(IndirectHeap
         // nothing to patch, we're at the start of heap (which is assumed to be the surface state base address)
         // we need to simply copy the ssh (including BTIs from compiler)
         memcpy_s(dstSurfaceState, sshSize, srcSurfaceState, sshSize);
+        if (deduplicateStates) {
+            dstHeap.storeReusableBlock(statesTag, srcKernelSsh, sshSize, offsetOfBindingTable);
+        }
         return offsetOfBindingTable;
     }
 
@@ -420,7 +444,11 @@ size_t EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(IndirectHeap
         DEBUG_BREAK_IF(bti.getRawData(0) % sizeof(BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE) != 0);
     }
 
-    return ptrDiff(dstBtiTableBase, dstHeap.getCpuBase());
+    bindingTableOffset = ptrDiff(dstBtiTableBase, dstHeap.getCpuBase());
+    if (deduplicateStates) {
+        dstHeap.storeReusableBlock(statesTag, srcKernelSsh, sshSize, bindingTableOffset);
+    }
+    return bindingTableOffset;
 }
 
 template <typename Family>
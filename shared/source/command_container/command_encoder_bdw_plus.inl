@@ -26,7 +26,7 @@ template <typename Family>
 void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
                                           const void *pThreadGroupDimensions, bool isIndirect, bool isPredicate, DispatchKernelEncoderI *dispatchInterface,
                                           uint64_t eventAddress, bool isTimestampEvent, bool L3FlushEnable, Device *device, PreemptionMode preemptionMode, bool &requiresUncachedMocs,
-                                          uint32_t &partitionCount, bool isInternal) {
+                                          uint32_t &partitionCount, bool isInternal, EncodedDispatchKernelData *encodedData) {
 
     using MEDIA_STATE_FLUSH = typename Family::MEDIA_STATE_FLUSH;
     using MEDIA_INTERFACE_DESCRIPTOR_LOAD = typename Family::MEDIA_INTERFACE_DESCRIPTOR_LOAD;
@@ -57,12 +57,38 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
         container.allocateNextCommandBuffer();
     }
 
+    static_assert(sizeof(WALKER_TYPE) <= DispatchKernelTemplate::maxWalkerSize, "");
+    static_assert(sizeof(INTERFACE_DESCRIPTOR_DATA) <= DispatchKernelTemplate::maxInterfaceDescriptorSize, "");
+
     WALKER_TYPE cmd = Family::cmdInitGpgpuWalker;
     auto idd = Family::cmdInitInterfaceDescriptorData;
 
-    {
-        auto alloc = dispatchInterface->getIsaAllocation();
-        UNRECOVERABLE_IF(nullptr == alloc);
+    auto alloc = dispatchInterface->getIsaAllocation();
+    UNRECOVERABLE_IF(nullptr == alloc);
+
+    auto dispatchTemplate = dispatchInterface->getDispatchTemplate();
+    DispatchKernelTemplate::State templateState;
+    bool useDispatchTemplate = false;
+    if (dispatchTemplate) {
+        auto groupSize = dispatchInterface->getGroupSize();
+        templateState.isaGpuAddress = alloc->getGpuAddressToPatch();
+        templateState.groupSize[0] = groupSize[0];
+        templateState.groupSize[1] = groupSize[1];
+        templateState.groupSize[2] = groupSize[2];
+        templateState.slmTotalSize = dispatchInterface->getSlmTotalSize();
+        templateState.numThreadsPerThreadGroup = dispatchInterface->getNumThreadsPerThreadGroup();
+        templateState.threadExecutionMask = dispatchInterface->getThreadExecutionMask();
+        templateState.requiredWorkgroupOrder = dispatchInterface->getRequiredWorkgroupOrder();
+        templateState.preemptionMode = preemptionMode;
+        templateState.isIndirect = isIndirect;
+        templateState.isPredicate = isPredicate;
+        useDispatchTemplate = dispatchTemplate->valid && dispatchTemplate->state == templateState;
+    }
+
+    if (useDispatchTemplate) {
+        memcpy_s(&idd, sizeof(idd), dispatchTemplate->interfaceDescriptor, sizeof(idd));
+        memcpy_s(&cmd, sizeof(cmd), dispatchTemplate->walker, sizeof(cmd));
+    } else {
         auto offset = alloc->getGpuAddressToPatch();
         idd.setKernelStartPointer(offset);
         idd.setKernelStartPointerHigh(0u);
@@ -73,15 +99,17 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
                                                  kernelDescriptor.kernelAttributes.flags.useGlobalAtomics, device->getNumAvailableDevices() > 1);
     EncodeWA<Family>::encodeAdditionalPipelineSelect(*container.getDevice(), *container.getCommandStream(), false);
 
-    auto numThreadsPerThreadGroup = dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(numThreadsPerThreadGroup);
+    if (!useDispatchTemplate) {
+        auto numThreadsPerThreadGroup = dispatchInterface->getNumThreadsPerThreadGroup();
+        idd.setNumberOfThreadsInGpgpuThreadGroup(numThreadsPerThreadGroup);
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
-    auto slmSize = static_cast<typename INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE>(
-        HwHelperHw<Family>::get().computeSlmValues(hwInfo, dispatchInterface->getSlmTotalSize()));
-    idd.setSharedLocalMemorySize(slmSize);
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor.kernelAttributes.barrierCount,
+                                                           hwInfo);
+        auto slmSize = static_cast<typename INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE>(
+            HwHelperHw<Family>::get().computeSlmValues(hwInfo, dispatchInterface->getSlmTotalSize()));
+        idd.setSharedLocalMemorySize(slmSize);
+    }
 
     uint32_t bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     uint32_t bindingTablePointer = 0u;
@@ -96,11 +124,16 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
                 dispatchInterface->getSurfaceStateHeapData(),
                 dispatchInterface->getSurfaceStateHeapDataSize(), bindingTableStateCount,
                 kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+            if (encodedData) {
+                encodedData->surfaceStateHeapData = ptrOffset(ssh->getCpuBase(), sshOffset);
+            }
         }
     }
     idd.setBindingTablePointer(bindingTablePointer);
 
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
+    if (!useDispatchTemplate) {
+        PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
+    }
 
     auto heap = ApiSpecificConfig::getBindlessConfiguration() ? device->getBindlessHeapsHelper()->getHeap(BindlessHeapsHelper::GLOBAL_DSH) : container.getIndirectHeap(HeapType::DYNAMIC_STATE);
     UNRECOVERABLE_IF(!heap);
@@ -121,7 +154,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     }
 
     idd.setSamplerStatePointer(samplerStateOffset);
-    if (!isBindlessKernel) {
+    if (!isBindlessKernel && !useDispatchTemplate) {
         EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
     }
 
@@ -145,6 +178,9 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
 
         memcpy_s(ptr, sizeCrossThreadData,
                  dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
+        if (encodedData) {
+            encodedData->crossThreadData = ptr;
+        }
 
         if (isIndirect) {
             void *gpuPtr = reinterpret_cast<void *>(heapIndirect->getHeapGpuBase() + heapIndirect->getUsed() - sizeThreadData);
@@ -179,7 +215,14 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
         }
 
         if (container.slmSize != slmSizeNew) {
-            EncodeL3State<Family>::encode(container, slmSizeNew != 0u);
+            auto l3Config = PreambleHelper<Family>::getL3Config(hwInfo, slmSizeNew != 0u);
+            if (container.lastSentL3Config == std::numeric_limits<uint32_t>::max()) {
+                container.initialL3Config = l3Config;
+            } else if (container.lastSentL3Config != l3Config && PreambleHelper<Family>::isL3Configurable(hwInfo)) {
+                EncodeL3State<Family>::encode(container, slmSizeNew != 0u);
+                container.l3ConfigChangesCount++;
+            }
+            container.lastSentL3Config = l3Config;
             container.slmSize = slmSizeNew;
 
             if (container.nextIddInBlock != container.getNumIddPerBlock()) {
@@ -196,20 +239,35 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     cmd.setIndirectDataLength(sizeThreadData);
     cmd.setInterfaceDescriptorOffset(numIDD);
 
-    EncodeDispatchKernel<Family>::encodeThreadData(cmd,
-                                                   nullptr,
-                                                   threadDims,
-                                                   dispatchInterface->getGroupSize(),
-                                                   kernelDescriptor.kernelAttributes.simdSize,
-                                                   kernelDescriptor.kernelAttributes.numLocalIdChannels,
-                                                   dispatchInterface->getNumThreadsPerThreadGroup(),
-                                                   dispatchInterface->getThreadExecutionMask(),
-                                                   true,
-                                                   false,
-                                                   isIndirect,
-                                                   dispatchInterface->getRequiredWorkgroupOrder());
-
-    cmd.setPredicateEnable(isPredicate);
+    if (useDispatchTemplate) {
+        if (!isIndirect) {
+            cmd.setThreadGroupIdXDimension(threadDims[0]);
+            cmd.setThreadGroupIdYDimension(threadDims[1]);
+            cmd.setThreadGroupIdZDimension(threadDims[2]);
+        }
+    } else {
+        EncodeDispatchKernel<Family>::encodeThreadData(cmd,
+                                                       nullptr,
+                                                       threadDims,
+                                                       dispatchInterface->getGroupSize(),
+                                                       kernelDescriptor.kernelAttributes.simdSize,
+                                                       kernelDescriptor.kernelAttributes.numLocalIdChannels,
+                                                       dispatchInterface->getNumThreadsPerThreadGroup(),
+                                                       dispatchInterface->getThreadExecutionMask(),
+                                                       true,
+                                                       false,
+                                                       isIndirect,
+                                                       dispatchInterface->getRequiredWorkgroupOrder());
+
+        cmd.setPredicateEnable(isPredicate);
+
+        if (dispatchTemplate) {
+            dispatchTemplate->state = templateState;
+            memcpy_s(dispatchTemplate->interfaceDescriptor, sizeof(dispatchTemplate->interfaceDescriptor), &idd, sizeof(idd));
+            memcpy_s(dispatchTemplate->walker, sizeof(dispatchTemplate->walker), &cmd, sizeof(cmd));
+            dispatchTemplate->valid = true;
+        }
+    }
 
     EncodeDispatchKernel<Family>::adjustInterfaceDescriptorData(idd, hwInfo);
 
@@ -217,6 +275,9 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
 
     auto buffer = listCmdBufferStream->getSpace(sizeof(cmd));
     *(decltype(cmd) *)buffer = cmd;
+    if (encodedData) {
+        encodedData->walkerCmd = buffer;
+    }
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *device);
     {
@@ -227,6 +288,67 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     partitionCount = 1;
 }
 
+template <typename Family>
+void EncodeDispatchKernel<Family>::encodeRepeatedIndirect(CommandContainer &container, const void *previousWalkerCmd,
+                                                          DispatchKernelEncoderI *dispatchInterface, Device *device,
+                                                          EncodedDispatchKernelData *encodedData) {
+    using MEDIA_STATE_FLUSH = typename Family::MEDIA_STATE_FLUSH;
+    using MI_BATCH_BUFFER_END = typename Family::MI_BATCH_BUFFER_END;
+
+    // interface descriptor, binding table and L3 setup of previous walker stay valid, only thread data is not shared
+    // as group count of each dispatch is stored into it
+    WALKER_TYPE cmd = *reinterpret_cast<const WALKER_TYPE *>(previousWalkerCmd);
+    auto &kernelDescriptor = dispatchInterface->getKernelDescriptor();
+    auto sizeCrossThreadData = dispatchInterface->getCrossThreadDataSize();
+    auto sizePerThreadDataForWholeGroup = dispatchInterface->getPerThreadDataSizeForWholeThreadGroup();
+
+    LinearStream *listCmdBufferStream = container.getCommandStream();
+    size_t estimatedSizeRequired = estimateEncodeDispatchKernelCmdsSize(device, {0, 0, 0}, {0, 0, 0}, false);
+    if (listCmdBufferStream->getAvailableSpace() < estimatedSizeRequired) {
+        auto bbEnd = listCmdBufferStream->getSpaceForCmd<MI_BATCH_BUFFER_END>();
+        *bbEnd = Family::cmdInitBatchBufferEnd;
+
+        container.allocateNextCommandBuffer();
+    }
+
+    uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
+    auto heapIndirect = container.getIndirectHeap(HeapType::INDIRECT_OBJECT);
+    UNRECOVERABLE_IF(!(heapIndirect));
+    heapIndirect->align(WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
+
+    auto ptr = container.getHeapSpaceAllowGrow(HeapType::INDIRECT_OBJECT, sizeThreadData);
+    UNRECOVERABLE_IF(!(ptr));
+    uint64_t offsetThreadData = heapIndirect->getHeapGpuStartOffset() + static_cast<uint64_t>(heapIndirect->getUsed() - sizeThreadData);
+
+    memcpy_s(ptr, sizeCrossThreadData, dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
+    if (encodedData) {
+        encodedData->crossThreadData = ptr;
+    }
+
+    void *gpuPtr = reinterpret_cast<void *>(heapIndirect->getHeapGpuBase() + heapIndirect->getUsed() - sizeThreadData);
+    EncodeIndirectParams<Family>::setGroupCountIndirect(container, kernelDescriptor.payloadMappings.dispatchTraits.numWorkGroups, gpuPtr);
+    EncodeIndirectParams<Family>::setGlobalWorkSizeIndirect(container, kernelDescriptor.payloadMappings.dispatchTraits.globalWorkSize, gpuPtr, dispatchInterface->getGroupSize());
+
+    memcpy_s(ptrOffset(ptr, sizeCrossThreadData), sizePerThreadDataForWholeGroup,
+             dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup);
+
+    cmd.setIndirectDataStartAddress(static_cast<uint32_t>(offsetThreadData));
+
+    PreemptionHelper::applyPreemptionWaCmdsBegin<Family>(listCmdBufferStream, *device);
+
+    auto buffer = listCmdBufferStream->getSpace(sizeof(cmd));
+    *(decltype(cmd) *)buffer = cmd;
+    if (encodedData) {
+        encodedData->walkerCmd = buffer;
+    }
+
+    PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *device);
+    {
+        auto mediaStateFlush = listCmdBufferStream->getSpace(sizeof(MEDIA_STATE_FLUSH));
+        *reinterpret_cast<MEDIA_STATE_FLUSH *>(mediaStateFlush) = Family::cmdInitMediaStateFlush;
+    }
+}
+
 template <typename Family>
 void EncodeMediaInterfaceDescriptorLoad<Family>::encode(CommandContainer &container) {
     using MEDIA_STATE_FLUSH = typename Family::MEDIA_STATE_FLUSH;
@@ -273,7 +395,7 @@ void EncodeDispatchKernel<Family>::encodeThreadData(WALKER_TYPE &walkerCmd,
                                                     bool inlineDataProgrammingRequired,
                                                     bool isIndirect,
                                                     uint32_t requiredWorkGroupOrder) {
-
+    // GPGPU_WALKER has no inline data, whole cross thread data is always read from indirect object heap
     if (isIndirect) {
         walkerCmd.setIndirectParameterEnable(true);
     } else {
@@ -11,6 +11,8 @@
 #include "shared/source/command_stream/experimental_command_buffer.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
+#include "shared/source/command_stream/submission_gpu_timestamps.h"
+#include "shared/source/command_stream/submission_latency_counters.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/array_count.h"
@@ -26,9 +28,12 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/runtime_tracer.h"
 #include "shared/source/utilities/tag_allocator.h"
 #include "shared/source/utilities/wait_util.h"
 
+#include <sstream>
+
 namespace NEO {
 
 // Global table of CommandStreamReceiver factories for HW and tests
@@ -54,6 +59,9 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
     if (deviceBitfield.count() > 1 && DebugManager.flags.EnableStaticPartitioning.get() != 0) {
         this->staticWorkPartitioningEnabled = true;
     }
+    if (SubmissionLatencyCounters::isEnabled() || SubmissionGpuTimestamps::isEnabled()) {
+        submissionLatencyCounters = std::make_unique<SubmissionLatencyCounters>();
+    }
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
@@ -66,6 +74,17 @@ CommandStreamReceiver::~CommandStreamReceiver() {
         userPauseConfirmation->join();
     }
 
+    if (submissionGpuTimestamps) {
+        submissionGpuTimestamps->harvest(peekCompletedTaskCount(), *submissionLatencyCounters);
+        submissionGpuTimestamps.reset();
+    }
+
+    if (submissionLatencyCounters && submissionLatencyCounters->getSamplesCount(SubmissionLatencyCounters::Submit) > 0) {
+        std::ostringstream counters;
+        submissionLatencyCounters->dump(counters);
+        PRINT_DEBUG_STRING(true, stdout, "Submission latency counters of CSR %p, root device %u:\n%s", this, rootDeviceIndex, counters.str().c_str());
+    }
+
     for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
         if (indirectHeap[i] != nullptr) {
             auto allocation = indirectHeap[i]->getGraphicsAllocation();
@@ -86,6 +105,22 @@ bool CommandStreamReceiver::submitBatchBuffer(BatchBuffer &batchBuffer, Residenc
     this->latestFlushedTaskCount = taskCount + 1;
     this->latestSentTaskCount = taskCount + 1;
 
+    if (gpuProgressWatchdogEnabled) {
+        SubmissionDiagnostics diagnostics;
+        diagnostics.taskCount = taskCount + 1;
+        diagnostics.batchBufferGpuAddress = batchBuffer.commandBufferAllocation->getGpuAddress() + batchBuffer.startOffset;
+        diagnostics.batchBufferSize = batchBuffer.usedSize - batchBuffer.startOffset;
+        diagnostics.residencyCount = allocationsForResidency.size();
+        for (auto allocation : allocationsForResidency) {
+            diagnostics.residencySize += allocation->getUnderlyingBufferSize();
+        }
+        diagnostics.description = std::move(pendingSubmissionDescription);
+        pendingSubmissionDescription.clear();
+
+        std::lock_guard<std::mutex> lock(submissionDiagnosticsMutex);
+        lastSubmissionDiagnostics = std::move(diagnostics);
+    }
+
     auto ret = this->flush(batchBuffer, allocationsForResidency);
     taskCount++;
 
@@ -101,6 +136,9 @@ void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
         if (!gfxAllocation.isResident(osContext->getContextId())) {
             this->totalMemoryUsed += gfxAllocation.getUnderlyingBufferSize();
         }
+        if (gfxAllocation.isAllocatedInLocalMemoryPool() && gfxAllocation.storageInfo.getMemoryBanks() != 0u) {
+            getMemoryManager()->getLocalMemoryUsageBankSelector(rootDeviceIndex)->recordAccess(gfxAllocation.storageInfo.getMemoryBanks(), gfxAllocation.getUnderlyingBufferSize());
+        }
     }
     gfxAllocation.updateResidencyTaskCount(submissionTaskCount, osContext->getContextId());
 }
@@ -244,9 +282,27 @@ void CommandStreamReceiver::cleanupResources() {
         getMemoryManager()->freeGraphicsMemory(workPartitionAllocation);
         workPartitionAllocation = nullptr;
     }
+
+    for (auto stagingBuffer : stagingBuffers) {
+        getMemoryManager()->freeGraphicsMemory(stagingBuffer);
+    }
+    stagingBuffers.clear();
+}
+
+void CommandStreamReceiver::addSubmissionDescription(const std::string &description) {
+    if (!pendingSubmissionDescription.empty()) {
+        pendingSubmissionDescription += "; ";
+    }
+    pendingSubmissionDescription += description;
+}
+
+CommandStreamReceiver::SubmissionDiagnostics CommandStreamReceiver::getLastSubmissionDiagnostics() {
+    std::lock_guard<std::mutex> lock(submissionDiagnosticsMutex);
+    return lastSubmissionDiagnostics;
 }
 
 bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) {
+    RUNTIME_TRACE_SCOPE("waitForCompletion");
     std::chrono::high_resolution_clock::time_point time1, time2;
     int64_t timeDiff = 0;
 
@@ -274,6 +330,32 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
     return false;
 }
 
+bool CommandStreamReceiver::joinCompletionWait(uint32_t taskCountToWait, bool &activeWaiter) {
+    activeWaiter = false;
+    std::unique_lock<std::mutex> lock(completionWaitMutex);
+    while (*getTagAddress() < taskCountToWait) {
+        if (!completionWaitActive) {
+            completionWaitActive = true;
+            completionWaitTaskCount = taskCountToWait;
+            activeWaiter = true;
+            return false;
+        }
+        if (completionWaitTaskCount < taskCountToWait) {
+            return false;
+        }
+        completionWaitCondition.wait(lock);
+    }
+    return true;
+}
+
+void CommandStreamReceiver::leaveCompletionWait() {
+    {
+        std::lock_guard<std::mutex> lock(completionWaitMutex);
+        completionWaitActive = false;
+    }
+    completionWaitCondition.notify_all();
+}
+
 void CommandStreamReceiver::setTagAllocation(GraphicsAllocation *allocation) {
     this->tagAllocation = allocation;
     UNRECOVERABLE_IF(allocation == nullptr);
@@ -572,7 +654,25 @@ bool CommandStreamReceiver::createPreemptionAllocation() {
     return this->preemptionAllocation != nullptr;
 }
 
+bool CommandStreamReceiver::ensurePreemptionAllocationCreated() {
+    if (this->preemptionAllocation) {
+        return true;
+    }
+    return createPreemptionAllocation();
+}
+
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
+    if (submissionLatencyCounters) {
+        std::unique_lock<CommandStreamReceiver::MutexType> lock(this->ownershipMutex, std::try_to_lock);
+        uint64_t waitTime = 0u;
+        if (!lock.owns_lock()) {
+            auto waitStart = SubmissionLatencyCounters::getTimestampInNs();
+            lock.lock();
+            waitTime = SubmissionLatencyCounters::getTimestampInNs() - waitStart;
+        }
+        submissionLatencyCounters->record(SubmissionLatencyCounters::OwnershipWait, waitTime);
+        return lock;
+    }
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
 AllocationsList &CommandStreamReceiver::getTemporaryAllocations() { return internalAllocationStorage->getTemporaryAllocations(); }
@@ -608,6 +708,39 @@ bool CommandStreamReceiver::createAllocationForHostSurface(HostPtrSurface &surfa
     return true;
 }
 
+GraphicsAllocation *CommandStreamReceiver::obtainStagingBuffer(size_t size) {
+    auto stagingBufferSize = DebugManager.flags.HostPtrStagingBufferSize.get();
+    if (stagingBufferSize <= 0 || size > static_cast<size_t>(stagingBufferSize)) {
+        return nullptr;
+    }
+    size_t stagingBuffersCount = 4u;
+    if (DebugManager.flags.HostPtrStagingBuffersCount.get() > 0) {
+        stagingBuffersCount = static_cast<size_t>(DebugManager.flags.HostPtrStagingBuffersCount.get());
+    }
+
+    // buffers are pinned once and reused round robin, so CPU copy to the next one overlaps GPU copy from the previous one
+    if (stagingBuffers.size() < stagingBuffersCount) {
+        auto stagingBuffer = getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, static_cast<size_t>(stagingBufferSize),
+                                                                                       GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, osContext->getDeviceBitfield()});
+        if (stagingBuffer) {
+            stagingBuffers.push_back(stagingBuffer);
+            return stagingBuffer;
+        }
+        if (stagingBuffers.empty()) {
+            return nullptr;
+        }
+    }
+
+    auto stagingBuffer = stagingBuffers[nextStagingBuffer];
+    nextStagingBuffer = (nextStagingBuffer + 1) % stagingBuffers.size();
+
+    auto taskCountToWait = stagingBuffer->getTaskCount(osContext->getContextId());
+    if (taskCountToWait != GraphicsAllocation::objectNotUsed && *getTagAddress() < taskCountToWait) {
+        waitForCompletionWithTimeout(false, 0, taskCountToWait);
+    }
+    return stagingBuffer;
+}
+
 TagAllocatorBase *CommandStreamReceiver::getEventTsAllocator() {
     if (profilingTimeStampAllocator.get() == nullptr) {
         profilingTimeStampAllocator = std::make_unique<TagAllocator<HwTimeStamps>>(rootDeviceIndex, getMemoryManager(), getPreferredTagPoolSize(), MemoryConstants::cacheLineSize,
@@ -25,8 +25,11 @@
 #include "csr_properties_flags.h"
 #include "pipe_control_args.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 namespace NEO {
 class AllocationsList;
@@ -44,6 +47,8 @@ class MultiGraphicsAllocation;
 class OsContext;
 class OSInterface;
 class ScratchSpaceController;
+class SubmissionGpuTimestamps;
+class SubmissionLatencyCounters;
 class HwPerfCounter;
 class HwTimeStamps;
 class TagAllocatorBase;
@@ -124,8 +129,23 @@ class CommandStreamReceiver {
 
     virtual bool waitForFlushStamp(FlushStamp &flushStampToWait) { return true; };
 
+    // sync_file interop, export returns fence of latest submission, imported fence is waited on by next submission
+    virtual bool exportSubmissionSyncFile(int32_t &syncFileFd) { return false; }
+    virtual bool importSyncFileForNextSubmission(int32_t syncFileFd) { return false; }
+
     uint32_t peekTaskCount() const { return taskCount; }
 
+    uint32_t peekLastSentL3Config() const { return lastSentL3Config; }
+    void setLastSentL3Config(uint32_t l3Config) { lastSentL3Config = l3Config; }
+
+    // must be called under ownership lock, 0 is reserved for allocations never stamped
+    uint32_t obtainNextSubmissionStamp() {
+        if (++submissionStamp == 0u) {
+            submissionStamp = 1u;
+        }
+        return submissionStamp;
+    }
+
     uint32_t peekTaskLevel() const { return taskLevel; }
     FlushStamp obtainCurrentFlushStamp() const;
 
@@ -156,6 +176,12 @@ class CommandStreamReceiver {
 
     virtual void waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) = 0;
     virtual bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait);
+
+    // Coalesces concurrent blocking waits on this CSR. Returns true when task count was reached while sleeping behind
+    // other thread's wait covering it. Otherwise caller waits by itself and, when it became the active waiter,
+    // has to call leaveCompletionWait after the wait.
+    bool joinCompletionWait(uint32_t taskCountToWait, bool &activeWaiter);
+    void leaveCompletionWait();
     virtual void downloadAllocations(){};
 
     void setSamplerCacheFlushRequired(SamplerCacheFlushState value) { this->samplerCacheFlushRequired = value; }
@@ -179,6 +205,7 @@ class CommandStreamReceiver {
     MOCKABLE_VIRTUAL bool createWorkPartitionAllocation(const Device &device);
     MOCKABLE_VIRTUAL bool createGlobalFenceAllocation();
     MOCKABLE_VIRTUAL bool createPreemptionAllocation();
+    bool ensurePreemptionAllocationCreated();
     MOCKABLE_VIRTUAL bool createPerDssBackedBuffer(Device &device);
     MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
 
@@ -191,6 +218,7 @@ class CommandStreamReceiver {
     AllocationsList &getAllocationsForReuse();
     InternalAllocationStorage *getInternalAllocationStorage() const { return internalAllocationStorage.get(); }
     MOCKABLE_VIRTUAL bool createAllocationForHostSurface(HostPtrSurface &surface, bool requiresL3Flush);
+    GraphicsAllocation *obtainStagingBuffer(size_t size);
     virtual size_t getPreferredTagPoolSize() const;
     virtual void setupContext(OsContext &osContext) { this->osContext = &osContext; }
     OsContext &getOsContext() const { return *osContext; }
@@ -240,6 +268,10 @@ class CommandStreamReceiver {
         return false;
     }
 
+    virtual bool stopDirectSubmissionIfIdle(std::chrono::steady_clock::time_point now) {
+        return false;
+    }
+
     bool isStaticWorkPartitioningEnabled() const {
         return staticWorkPartitioningEnabled;
     }
@@ -252,6 +284,23 @@ class CommandStreamReceiver {
 
     virtual GraphicsAllocation *getClearColorAllocation() = 0;
 
+    struct SubmissionDiagnostics {
+        uint32_t taskCount = 0;
+        uint64_t batchBufferGpuAddress = 0;
+        size_t batchBufferSize = 0;
+        size_t residencyCount = 0;
+        size_t residencySize = 0;
+        std::string description;
+    };
+    bool isGpuProgressWatchdogEnabled() const { return gpuProgressWatchdogEnabled; }
+    // must be called under ownership lock, description is attached to next submitted batch buffer
+    void addSubmissionDescription(const std::string &description);
+    SubmissionDiagnostics getLastSubmissionDiagnostics();
+    uint32_t peekCompletedTaskCount() const { return tagAddress ? *tagAddress : 0u; }
+
+    SubmissionLatencyCounters *getSubmissionLatencyCounters() const { return submissionLatencyCounters.get(); }
+    SubmissionGpuTimestamps *getSubmissionGpuTimestamps() const { return submissionGpuTimestamps.get(); }
+
   protected:
     void cleanupResources();
     void printDeviceIndex();
@@ -269,6 +318,8 @@ class CommandStreamReceiver {
     std::unique_ptr<TagAllocatorBase> perfCounterAllocator;
     std::unique_ptr<TagAllocatorBase> timestampPacketAllocator;
     std::unique_ptr<Thread> userPauseConfirmation;
+    std::unique_ptr<SubmissionLatencyCounters> submissionLatencyCounters;
+    std::unique_ptr<SubmissionGpuTimestamps> submissionGpuTimestamps;
 
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
@@ -294,6 +345,18 @@ class CommandStreamReceiver {
     GraphicsAllocation *perDssBackedBuffer = nullptr;
     GraphicsAllocation *clearColorAllocation = nullptr;
     GraphicsAllocation *workPartitionAllocation = nullptr;
+    std::vector<GraphicsAllocation *> stagingBuffers;
+    size_t nextStagingBuffer = 0u;
+
+    // read by GPU progress watchdog thread
+    SubmissionDiagnostics lastSubmissionDiagnostics;
+    std::string pendingSubmissionDescription;
+    std::mutex submissionDiagnosticsMutex;
+
+    std::mutex completionWaitMutex;
+    std::condition_variable completionWaitCondition;
+    uint32_t completionWaitTaskCount = 0;
+    bool completionWaitActive = false;
 
     MultiGraphicsAllocation *tagsMultiAllocation = nullptr;
 
@@ -312,6 +375,7 @@ class CommandStreamReceiver {
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
 
     uint32_t lastSentL3Config = 0;
+    uint32_t submissionStamp = 0u;
     uint32_t latestSentStatelessMocsConfig = 0;
     uint32_t lastSentNumGrfRequired = GrfConfig::DefaultGrfNumber;
     uint32_t requiredThreadArbitrationPolicy = ThreadArbitrationPolicy::RoundRobin;
@@ -353,6 +417,7 @@ class CommandStreamReceiver {
     bool newResources = false;
     bool useGpuIdleImplicitFlush = false;
     bool lastSentUseGlobalAtomics = false;
+    bool gpuProgressWatchdogEnabled = false;
 };
 
 typedef CommandStreamReceiver *(*CommandStreamReceiverCreateFunc)(bool withAubDump,
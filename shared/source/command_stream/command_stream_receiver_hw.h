@@ -56,6 +56,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     static void alignToCacheLine(LinearStream &commandStream);
 
     size_t getRequiredStateBaseAddressSize() const;
+    size_t getFixedCmdStreamSize();
     size_t getRequiredCmdStreamSize(const DispatchFlags &dispatchFlags, Device &device);
     size_t getRequiredCmdStreamSizeAligned(const DispatchFlags &dispatchFlags, Device &device);
     size_t getRequiredCmdSizeForPreamble(Device &device) const;
@@ -122,6 +123,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     virtual bool isAnyDirectSubmissionActive() { return false; }
 
     bool initDirectSubmission(Device &device, OsContext &osContext) override;
+    bool stopDirectSubmissionIfIdle(std::chrono::steady_clock::time_point now) override;
     GraphicsAllocation *getClearColorAllocation() override;
 
     TagAllocatorBase *getTimestampPacketAllocator() override;
@@ -141,6 +143,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     void programStallingPipeControlForBarrier(LinearStream &cmdStream, DispatchFlags &dispatchFlags);
     void programEngineModeCommands(LinearStream &csr, const DispatchFlags &dispatchFlags);
     void programEngineModeEpliogue(LinearStream &csr, const DispatchFlags &dispatchFlags);
+    uint64_t programSubmissionGpuTimestampEnd(LinearStream &commandStreamTask, Device &device);
 
     void programEnginePrologue(LinearStream &csr);
     size_t getCmdSizeForPrologue() const;
@@ -177,6 +180,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     std::unique_ptr<DirectSubmissionHw<GfxFamily, BlitterDispatcher<GfxFamily>>> blitterDirectSubmission;
 
     size_t cmdStreamStart = 0;
+    size_t fixedCmdStreamSize = 0;
 };
 
 } // namespace NEO
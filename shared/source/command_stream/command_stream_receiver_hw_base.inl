@@ -7,12 +7,17 @@
 
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
+#include "shared/source/command_stream/gpu_progress_watchdog.h"
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/command_stream/submission_gpu_timestamps.h"
+#include "shared/source/command_stream/submission_latency_counters.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -29,6 +34,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/runtime_tracer.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "command_stream_receiver_hw_ext.inl"
@@ -37,7 +43,14 @@
 namespace NEO {
 
 template <typename GfxFamily>
-CommandStreamReceiverHw<GfxFamily>::~CommandStreamReceiverHw() = default;
+CommandStreamReceiverHw<GfxFamily>::~CommandStreamReceiverHw() {
+    if (directSubmission || blitterDirectSubmission) {
+        executionEnvironment.getDirectSubmissionController()->unregisterDirectSubmission(this);
+    }
+    if (gpuProgressWatchdogEnabled) {
+        executionEnvironment.getGpuProgressWatchdog()->unregisterCsr(this);
+    }
+}
 
 template <typename GfxFamily>
 CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiverHw(ExecutionEnvironment &executionEnvironment,
@@ -51,6 +64,11 @@ CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiverHw(ExecutionEnvironment
     requiredThreadArbitrationPolicy = hwHelper.getDefaultThreadArbitrationPolicy();
     resetKmdNotifyHelper(new KmdNotifyHelper(&peekHwInfo().capabilityTable.kmdNotifyProperties));
     flatBatchBufferHelper.reset(new FlatBatchBufferHelperHw<GfxFamily>(executionEnvironment));
+
+    if (DebugManager.flags.GpuProgressWatchdogTimeout.get() > 0) {
+        gpuProgressWatchdogEnabled = true;
+        executionEnvironment.getGpuProgressWatchdog()->registerCsr(this);
+    }
     defaultSshSize = getSshHeapSize();
     canUse4GbHeaps = are4GbHeapsAvailable();
 
@@ -177,6 +195,8 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     uint32_t taskLevel,
     DispatchFlags &dispatchFlags,
     Device &device) {
+    RUNTIME_TRACE_SCOPE("flushTask");
+    auto stateProgrammingStart = submissionLatencyCounters ? SubmissionLatencyCounters::getTimestampInNs() : 0u;
     typedef typename GfxFamily::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
     typedef typename GfxFamily::MI_BATCH_BUFFER_END MI_BATCH_BUFFER_END;
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
@@ -184,6 +204,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
+    dispatchFlags.preemptionMode = PreemptionHelper::limitToContextPreemptionMode(dispatchFlags.preemptionMode, osContext->getPreemptionMode());
     DEBUG_BREAK_IF(taskLevel >= CompletionStamp::notReady);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
@@ -206,6 +227,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     }
 
     bool updateTag = false;
+    uint64_t gpuTimestampsStartAddress = 0u;
     if (dispatchFlags.blocking || dispatchFlags.dcFlush || dispatchFlags.guardCommandBufferWithPipeControl) {
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
             //for ImmediateDispatch we will send this right away, therefore this pipe control will close the level
@@ -230,6 +252,10 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         updateTag |= dispatchFlags.blocking;
 
         if (updateTag) {
+            if (submissionLatencyCounters && SubmissionGpuTimestamps::isEnabled() && this->dispatchMode == DispatchMode::ImmediateDispatch) {
+                gpuTimestampsStartAddress = programSubmissionGpuTimestampEnd(commandStreamTask, device);
+            }
+
             PipeControlArgs args(dispatchFlags.dcFlush);
             MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
                 commandStreamTask,
@@ -308,6 +334,11 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         }
     }
 
+    if (device.getPreemptionMode() == PreemptionMode::MidThread) {
+        auto preemptionAllocationCreated = ensurePreemptionAllocationCreated();
+        UNRECOVERABLE_IF(!preemptionAllocationCreated);
+    }
+
     if (dispatchFlags.usePerDssBackedBuffer) {
         if (!perDssBackedBuffer) {
             createPerDssBackedBuffer(device);
@@ -326,6 +357,17 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     auto &commandStreamCSR = this->getCS(getRequiredCmdStreamSizeAligned(dispatchFlags, device));
     auto commandStreamStartCSR = commandStreamCSR.getUsed();
 
+    if (gpuTimestampsStartAddress != 0u) {
+        PipeControlArgs args;
+        MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
+            commandStreamCSR,
+            PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_TIMESTAMP,
+            gpuTimestampsStartAddress,
+            0llu,
+            peekHwInfo(),
+            args);
+    }
+
     TimestampPacketHelper::programCsrDependenciesForTimestampPacketContainer<GfxFamily>(commandStreamCSR, dispatchFlags.csrDependencies, getOsContext().getNumSupportedDevices());
 
     if (stallingPipeControlOnNextFlushRequired) {
@@ -333,8 +375,13 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     }
 
     programEngineModeCommands(commandStreamCSR, dispatchFlags);
-    if (executionEnvironment.rootDeviceEnvironments[device.getRootDeviceIndex()]->pageTableManager.get() && !pageTableManagerInitialized) {
-        pageTableManagerInitialized = executionEnvironment.rootDeviceEnvironments[device.getRootDeviceIndex()]->pageTableManager->initPageTableManagerRegisters(this);
+    auto pageTableManager = executionEnvironment.rootDeviceEnvironments[device.getRootDeviceIndex()]->pageTableManager.get();
+    if (pageTableManager && !pageTableManagerInitialized) {
+        pageTableManagerInitialized = pageTableManager->initPageTableManagerRegisters(this);
+    }
+    if (pageTableManager) {
+        auto auxTableUpdated = pageTableManager->flushPendingAuxTableUpdates();
+        DEBUG_BREAK_IF(!auxTableUpdated);
     }
 
     programHardwareContext(commandStreamCSR);
@@ -363,7 +410,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     auto isStateBaseAddressDirty = dshDirty || iohDirty || sshDirty || stateBaseAddressDirty;
 
     auto mocsIndex = latestSentStatelessMocsConfig;
-    auto &hwHelper = HwHelper::get(peekHwInfo().platform.eRenderCoreFamily);
+    auto &hwHelper = HwHelperHw<GfxFamily>::get();
 
     if (dispatchFlags.l3CacheSettings != L3CachingSettings::NotApplicable) {
         auto l3On = dispatchFlags.l3CacheSettings != L3CachingSettings::l3CacheOff;
@@ -578,16 +625,26 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
                             dispatchFlags.requiresCoherency, dispatchFlags.lowPriority, dispatchFlags.throttle, dispatchFlags.sliceCount,
                             streamToSubmit.getUsed(), &streamToSubmit, bbEndLocation, dispatchFlags.useSingleSubdevice};
 
+    if (submissionLatencyCounters) {
+        submissionLatencyCounters->record(SubmissionLatencyCounters::StateProgramming, SubmissionLatencyCounters::getTimestampInNs() - stateProgrammingStart);
+    }
+
     if (submitCSR | submitTask) {
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
             if (updateTag) {
                 this->latestFlushedTaskCount = this->taskCount + 1;
             }
+            if (gpuTimestampsStartAddress != 0u) {
+                uint64_t submitTime = 0u;
+                device.getOSTime()->getCpuTime(&submitTime);
+                submissionGpuTimestamps->setSubmitTime(submitTime);
+            }
             flushHandler(batchBuffer, this->getResidencyAllocations());
         } else {
             auto commandBuffer = new CommandBuffer(device);
             commandBuffer->batchBuffer = batchBuffer;
             commandBuffer->surfaces.swap(this->getResidencyAllocations());
+            this->submissionAggregator->obtainSurfaces(this->getResidencyAllocations());
             commandBuffer->batchBufferEndLocation = bbEndLocation;
             commandBuffer->taskCount = this->taskCount + 1;
             commandBuffer->flushStamp->replaceStampObject(dispatchFlags.flushStampReference);
@@ -620,6 +677,10 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     }
     implicitFlush |= checkImplicitFlushForGpuIdle();
 
+    if (this->dispatchMode == DispatchMode::BatchedDispatch) {
+        implicitFlush |= this->submissionAggregator->isFlushRequired(std::chrono::steady_clock::now());
+    }
+
     if (this->dispatchMode == DispatchMode::BatchedDispatch && implicitFlush) {
         this->flushBatchedSubmissions();
     }
@@ -670,6 +731,43 @@ inline void CommandStreamReceiverHw<GfxFamily>::programStallingPipeControlForBar
     }
 }
 
+template <typename GfxFamily>
+uint64_t CommandStreamReceiverHw<GfxFamily>::programSubmissionGpuTimestampEnd(LinearStream &commandStreamTask, Device &device) {
+    if (submissionGpuTimestamps) {
+        submissionGpuTimestamps->harvest(peekCompletedTaskCount(), *submissionLatencyCounters);
+    }
+
+    auto timestampSize = MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(peekHwInfo());
+
+    // end timestamp must not eat space reserved for epilogue, such submission is not timed
+    if (osContext->getNumSupportedDevices() > 1 ||
+        commandStreamTask.getAvailableSpace() < timestampSize + CSRequirements::minCommandQueueCommandStreamSize) {
+        return 0u;
+    }
+
+    if (!submissionGpuTimestamps) {
+        submissionGpuTimestamps = std::make_unique<SubmissionGpuTimestamps>(*this, HwHelperHw<GfxFamily>::get(), device.getProfilingTimerResolution());
+    }
+
+    auto slot = submissionGpuTimestamps->acquireSlot(taskCount + 1, *device.getOSTime());
+    if (slot == nullptr) {
+        return 0u;
+    }
+
+    // written before tag update, so completed task count guarantees both timestamps are visible
+    auto startAddress = submissionGpuTimestamps->getGpuAddress(slot);
+    PipeControlArgs args;
+    MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
+        commandStreamTask,
+        PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_TIMESTAMP,
+        startAddress + offsetof(SubmissionGpuTimestamps::GpuTimestamps, end),
+        0llu,
+        peekHwInfo(),
+        args);
+    makeResident(*submissionGpuTimestamps->getAllocation());
+    return startAddress;
+}
+
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
     if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
@@ -685,6 +783,7 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
         const auto totalMemoryBudget = static_cast<size_t>(commandBufferList.peekHead()->device.getDeviceInfo().globalMemSize / 2);
 
         ResidencyContainer surfacesForSubmit;
+        this->submissionAggregator->obtainSurfaces(surfacesForSubmit);
         ResourcePackage resourcePackage;
         auto pipeControlLocationSize = MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(peekHwInfo());
         void *currentPipeControlForNooping = nullptr;
@@ -731,7 +830,7 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                 currentBBendLocation = nextCommandBuffer->batchBufferEndLocation;
                 lastTaskCount = nextCommandBuffer->taskCount;
                 nextCommandBuffer = nextCommandBuffer->next;
-                commandBufferList.removeFrontOne();
+                this->submissionAggregator->recycleSurfaces(commandBufferList.removeFrontOne()->surfaces);
             }
             surfacesForSubmit.reserve(resourcePackage.size() + 1);
             for (auto &surface : resourcePackage) {
@@ -762,8 +861,11 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
 
             this->latestFlushedTaskCount = lastTaskCount;
             this->makeSurfacePackNonResident(surfacesForSubmit);
+            this->submissionAggregator->recycleSurfaces(primaryCmdBuffer->surfaces);
             resourcePackage.clear();
         }
+        this->submissionAggregator->recycleSurfaces(surfacesForSubmit);
+        this->submissionAggregator->registerFlush(std::chrono::steady_clock::now());
         this->totalMemoryUsed = 0;
     }
 
@@ -776,15 +878,24 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSizeAligned(const
     return alignUp(size, MemoryConstants::cacheLineSize);
 }
 
+template <typename GfxFamily>
+size_t CommandStreamReceiverHw<GfxFamily>::getFixedCmdStreamSize() {
+    if (fixedCmdStreamSize == 0u) {
+        // reserved on every flush and depends only on hardware info
+        fixedCmdStreamSize = getRequiredStateBaseAddressSize() +
+                             MemorySynchronizationCommands<GfxFamily>::getSizeForSinglePipeControl() +
+                             sizeof(typename GfxFamily::MI_BATCH_BUFFER_START);
+    }
+    return fixedCmdStreamSize;
+}
+
 template <typename GfxFamily>
 size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const DispatchFlags &dispatchFlags, Device &device) {
-    size_t size = getRequiredCmdSizeForPreamble(device);
-    size += getRequiredStateBaseAddressSize();
+    size_t size = getFixedCmdStreamSize();
+    size += getRequiredCmdSizeForPreamble(device);
     if (!this->isStateSipSent || device.isDebuggerActive()) {
         size += PreemptionHelper::getRequiredStateSipCmdSize<GfxFamily>(device);
     }
-    size += MemorySynchronizationCommands<GfxFamily>::getSizeForSinglePipeControl();
-    size += sizeof(typename GfxFamily::MI_BATCH_BUFFER_START);
 
     size += getCmdSizeForL3Config();
     size += getCmdSizeForComputeMode();
@@ -795,7 +906,7 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
     size += getCmdSizeForEpilogue(dispatchFlags);
     size += getCmdsSizeForHardwareContext();
 
-    if (executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo()->workaroundTable.waSamplerCacheFlushBetweenRedescribedSurfaceReads) {
+    if (peekHwInfo().workaroundTable.waSamplerCacheFlushBetweenRedescribedSurfaceReads) {
         if (this->samplerCacheFlushRequired != SamplerCacheFlushState::samplerCacheFlushNotRequired) {
             size += sizeof(typename GfxFamily::PIPE_CONTROL);
         }
@@ -803,6 +914,9 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
     if (experimentalCmdBuffer.get() != nullptr) {
         size += experimentalCmdBuffer->getRequiredInjectionSize<GfxFamily>();
     }
+    if (SubmissionGpuTimestamps::isEnabled()) {
+        size += MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(peekHwInfo());
+    }
 
     size += TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(dispatchFlags.csrDependencies);
 
@@ -849,8 +963,14 @@ inline void CommandStreamReceiverHw<GfxFamily>::emitNoop(LinearStream &commandSt
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) {
+    RUNTIME_TRACE_SCOPE("waitForTaskCount");
     updateTagFromWait();
 
+    bool activeCompletionWaiter = false;
+    if (DebugManager.flags.CoalesceCompletionWaits.get() == 1 && joinCompletionWait(taskCountToWait, activeCompletionWaiter)) {
+        return;
+    }
+
     int64_t waitTimeout = 0;
     bool enableTimeout = false;
 
@@ -860,6 +980,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
                        "\nWaiting for task count %u at location %p. Current value: %u\n",
                        taskCountToWait, getTagAddress(), *getTagAddress());
 
+    auto waitStart = kmdNotifyHelper->startWaitMeasurement();
     auto status = waitForCompletionWithTimeout(enableTimeout, waitTimeout, taskCountToWait);
     if (!status) {
         waitForFlushStamp(flushStampToWait);
@@ -867,6 +988,10 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
         waitForCompletionWithTimeout(false, 0, taskCountToWait);
     }
     UNRECOVERABLE_IF(*getTagAddress() < taskCountToWait);
+    if (activeCompletionWaiter) {
+        leaveCompletionWait();
+    }
+    kmdNotifyHelper->registerWaitCompletion(waitStart, status);
 
     if (kmdNotifyHelper->quickKmdSleepForSporadicWaitsEnabled()) {
         kmdNotifyHelper->updateLastWaitForCompletionTimestamp();
@@ -1018,6 +1143,7 @@ uint32_t CommandStreamReceiverHw<GfxFamily>::blitBuffer(const BlitPropertiesCont
 
     for (auto &blitProperties : blitPropertiesContainer) {
         TimestampPacketHelper::programCsrDependenciesForTimestampPacketContainer<GfxFamily>(commandStream, blitProperties.csrDependencies, getOsContext().getNumSupportedDevices());
+        TimestampPacketHelper::programCsrDependenciesForForTaskCountContainer<GfxFamily>(commandStream, blitProperties.csrDependencies);
 
         if (blitProperties.outputTimestampPacket && profilingEnabled) {
             BlitCommandsHelper<GfxFamily>::encodeProfilingStartMmios(commandStream, *blitProperties.outputTimestampPacket);
@@ -1281,7 +1407,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::updateTagFromWait() {
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programAdditionalPipelineSelect(LinearStream &csr, PipelineSelectArgs &pipelineSelectArgs, bool is3DPipeline) {
-    auto &hwHelper = HwHelper::get(peekHwInfo().platform.eRenderCoreFamily);
+    auto &hwHelper = HwHelperHw<GfxFamily>::get();
     if (hwHelper.is3DPipelineSelectWARequired(peekHwInfo()) && isRcs()) {
         auto localPipelineSelectArgs = pipelineSelectArgs;
         localPipelineSelectArgs.is3DPipelineRequired = is3DPipeline;
@@ -1301,7 +1427,7 @@ inline MemoryCompressionState CommandStreamReceiverHw<GfxFamily>::getMemoryCompr
 
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::isPipelineSelectAlreadyProgrammed() const {
-    auto &hwHelper = HwHelper::get(peekHwInfo().platform.eRenderCoreFamily);
+    auto &hwHelper = HwHelperHw<GfxFamily>::get();
     return isComputeModeNeeded() && hwHelper.is3DPipelineSelectWARequired(peekHwInfo()) && isRcs();
 }
 
@@ -1354,12 +1480,33 @@ inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission(Device &dev
             directSubmission = DirectSubmissionHw<GfxFamily, RenderDispatcher<GfxFamily>>::create(device, osContext);
             ret = directSubmission->initialize(submitOnInit);
             this->dispatchMode = DispatchMode::ImmediateDispatch;
+            if (DebugManager.flags.DirectSubmissionCoalesceSubmissions.get() == 1) {
+                this->dispatchMode = DispatchMode::BatchedDispatch;
+            }
         }
         osContext.setDirectSubmissionActive();
+
+        executionEnvironment.getDirectSubmissionController()->registerDirectSubmission(this);
     }
     return ret;
 }
 
+template <typename GfxFamily>
+bool CommandStreamReceiverHw<GfxFamily>::stopDirectSubmissionIfIdle(std::chrono::steady_clock::time_point now) {
+    // csr used by submitting thread is not idle, ownership is only tried so submissions are never blocked
+    std::unique_lock<MutexType> lock(this->ownershipMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false;
+    }
+    if (blitterDirectSubmission) {
+        return blitterDirectSubmission->stopRingBufferIfIdle(now);
+    }
+    if (directSubmission) {
+        return directSubmission->stopRingBufferIfIdle(now);
+    }
+    return false;
+}
+
 template <typename GfxFamily>
 size_t CommandStreamReceiverHw<GfxFamily>::getCmdSizeForPerDssBackedBuffer(const HardwareInfo &hwInfo) {
     return 0;
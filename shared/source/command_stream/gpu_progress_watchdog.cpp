@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/gpu_progress_watchdog.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <sstream>
+
+namespace NEO {
+
+GpuProgressWatchdog::GpuProgressWatchdog() : timeout(getTimeout()) {
+}
+
+GpuProgressWatchdog::~GpuProgressWatchdog() {
+    std::unique_lock<std::mutex> lock(csrsMutex);
+    keepWatching = false;
+    lock.unlock();
+    condition.notify_all();
+    if (watchdogThread) {
+        watchdogThread->join();
+        watchdogThread.reset();
+    }
+}
+
+std::chrono::milliseconds GpuProgressWatchdog::getTimeout() {
+    int32_t timeout = 0;
+    if (DebugManager.flags.GpuProgressWatchdogTimeout.get() > 0) {
+        timeout = DebugManager.flags.GpuProgressWatchdogTimeout.get();
+    }
+    return std::chrono::milliseconds(timeout);
+}
+
+void GpuProgressWatchdog::registerCsr(CommandStreamReceiver *csr) {
+    if (timeout.count() <= 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(csrsMutex);
+    csrsProgress[csr] = {csr->peekCompletedTaskCount(), std::chrono::steady_clock::now(), false};
+    // watchdog thread is started with first CSR and lives until watchdog destruction
+    if (!watchdogThread) {
+        keepWatching = true;
+        watchdogThread = Thread::create(watchProgress, reinterpret_cast<void *>(this));
+    }
+}
+
+void GpuProgressWatchdog::unregisterCsr(CommandStreamReceiver *csr) {
+    std::lock_guard<std::mutex> lock(csrsMutex);
+    csrsProgress.erase(csr);
+}
+
+std::vector<std::string> GpuProgressWatchdog::getHangReports() {
+    std::lock_guard<std::mutex> lock(csrsMutex);
+    return hangReports;
+}
+
+void *GpuProgressWatchdog::watchProgress(void *self) {
+    auto watchdog = reinterpret_cast<GpuProgressWatchdog *>(self);
+    std::unique_lock<std::mutex> lock(watchdog->csrsMutex);
+    while (watchdog->keepWatching) {
+        // checking twice per timeout bounds detection latency to one and a half of timeout
+        watchdog->condition.wait_for(lock, watchdog->timeout / 2);
+        if (!watchdog->keepWatching) {
+            break;
+        }
+        watchdog->checkProgress(std::chrono::steady_clock::now());
+    }
+    return nullptr;
+}
+
+void GpuProgressWatchdog::checkProgress(std::chrono::steady_clock::time_point now) {
+    // called with csrsMutex acquired, only tag and task counts are read so submitting threads are never blocked
+    for (auto &csrProgress : csrsProgress) {
+        auto csr = csrProgress.first;
+        auto &progress = csrProgress.second;
+
+        auto completedTaskCount = csr->peekCompletedTaskCount();
+        if (completedTaskCount != progress.completedTaskCount || completedTaskCount >= csr->peekLatestFlushedTaskCount()) {
+            progress.completedTaskCount = completedTaskCount;
+            progress.lastProgress = now;
+            progress.hangReported = false;
+            continue;
+        }
+
+        auto stallTime = std::chrono::duration_cast<std::chrono::milliseconds>(now - progress.lastProgress);
+        if (stallTime > timeout && !progress.hangReported) {
+            reportHang(*csr, completedTaskCount, stallTime);
+            progress.hangReported = true;
+        }
+    }
+}
+
+void GpuProgressWatchdog::reportHang(CommandStreamReceiver &csr, uint32_t completedTaskCount, std::chrono::milliseconds stallTime) {
+    auto diagnostics = csr.getLastSubmissionDiagnostics();
+
+    std::ostringstream report;
+    report << "GPU progress watchdog: no progress for " << stallTime.count() << " ms";
+    // flushed task count is ahead of tag only after submission, so os context is already set up
+    auto &osContext = csr.getOsContext();
+    report << " on engine " << static_cast<int32_t>(osContext.getEngineType()) << " (context " << osContext.getContextId() << ")"
+           << ", completed task count " << completedTaskCount << " of " << csr.peekLatestFlushedTaskCount()
+           << ", last submission: task count " << diagnostics.taskCount
+           << ", batch buffer 0x" << std::hex << diagnostics.batchBufferGpuAddress << std::dec
+           << " size " << diagnostics.batchBufferSize
+           << ", residency " << diagnostics.residencyCount << " allocations " << diagnostics.residencySize << " bytes";
+    if (!diagnostics.description.empty()) {
+        report << ", " << diagnostics.description;
+    }
+
+    hangReports.push_back(report.str());
+    PRINT_DEBUG_STRING(true, stderr, "%s\n", hangReports.back().c_str());
+}
+} // namespace NEO
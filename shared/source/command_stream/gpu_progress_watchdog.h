@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Thread;
+
+// Watches tag of every registered CSR and reports submissions after which GPU made no progress
+// for longer than configured timeout, so stuck jobs can be identified on shared machines.
+class GpuProgressWatchdog {
+  public:
+    GpuProgressWatchdog();
+    virtual ~GpuProgressWatchdog();
+
+    GpuProgressWatchdog(const GpuProgressWatchdog &) = delete;
+    GpuProgressWatchdog &operator=(const GpuProgressWatchdog &) = delete;
+
+    void registerCsr(CommandStreamReceiver *csr);
+    void unregisterCsr(CommandStreamReceiver *csr);
+
+    static std::chrono::milliseconds getTimeout();
+
+    std::vector<std::string> getHangReports();
+
+  protected:
+    struct CsrProgress {
+        uint32_t completedTaskCount = 0;
+        std::chrono::steady_clock::time_point lastProgress;
+        bool hangReported = false;
+    };
+
+    static void *watchProgress(void *self);
+    MOCKABLE_VIRTUAL void checkProgress(std::chrono::steady_clock::time_point now);
+    MOCKABLE_VIRTUAL void reportHang(CommandStreamReceiver &csr, uint32_t completedTaskCount, std::chrono::milliseconds stallTime);
+
+    std::unordered_map<CommandStreamReceiver *, CsrProgress> csrsProgress;
+    std::vector<std::string> hangReports;
+    std::mutex csrsMutex;
+    std::condition_variable condition;
+
+    std::unique_ptr<Thread> watchdogThread;
+    std::atomic<bool> keepWatching{false};
+    const std::chrono::milliseconds timeout;
+};
+} // namespace NEO
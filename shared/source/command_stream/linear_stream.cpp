@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,4 +33,9 @@ LinearStream::LinearStream(GraphicsAllocation *gfxAllocation)
 LinearStream::LinearStream()
     : LinearStream(nullptr) {
 }
+
+uint64_t LinearStream::obtainBufferGeneration() {
+    static std::atomic<uint64_t> generationCounter{0};
+    return ++generationCounter;
+}
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,8 @@ class LinearStream {
     void replaceBuffer(void *buffer, size_t bufferSize);
     GraphicsAllocation *getGraphicsAllocation() const;
     void replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation);
+    // changes whenever stream starts using new memory, so previously written contents can be trusted only within same generation
+    uint64_t getBufferGeneration() const { return bufferGeneration; }
 
     template <typename Cmd>
     Cmd *getSpaceForCmd() {
@@ -44,6 +46,9 @@ class LinearStream {
     size_t maxAvailableSpace;
     void *buffer;
     GraphicsAllocation *graphicsAllocation;
+    uint64_t bufferGeneration = obtainBufferGeneration();
+
+    static uint64_t obtainBufferGeneration();
 };
 
 inline void *LinearStream::getCpuBase() const {
@@ -78,6 +83,7 @@ inline void LinearStream::replaceBuffer(void *buffer, size_t bufferSize) {
     this->buffer = buffer;
     maxAvailableSpace = bufferSize;
     sizeUsed = 0;
+    bufferGeneration = obtainBufferGeneration();
 }
 
 inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
@@ -86,5 +92,6 @@ inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
 
 inline void LinearStream::replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation) {
     graphicsAllocation = gfxAllocation;
+    bufferGeneration = obtainBufferGeneration();
 }
 } // namespace NEO
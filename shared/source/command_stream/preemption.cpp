@@ -90,6 +90,22 @@ PreemptionMode PreemptionHelper::taskPreemptionMode(Device &device, const MultiD
     return devMode;
 }
 
+PreemptionMode PreemptionHelper::contextPreemptionMode(PreemptionMode devicePreemptionMode, EngineUsage engineUsage) {
+    // high priority work is preempted only by other high priority work,
+    // thread group granularity avoids mid thread context save and restore on latency critical submissions
+    if (engineUsage == EngineUsage::HighPriority && devicePreemptionMode > PreemptionMode::ThreadGroup) {
+        return PreemptionMode::ThreadGroup;
+    }
+    return devicePreemptionMode;
+}
+
+PreemptionMode PreemptionHelper::limitToContextPreemptionMode(PreemptionMode taskPreemptionMode, PreemptionMode contextPreemptionMode) {
+    if (contextPreemptionMode != PreemptionMode::Initial && taskPreemptionMode > contextPreemptionMode) {
+        return contextPreemptionMode;
+    }
+    return taskPreemptionMode;
+}
+
 void PreemptionHelper::adjustDefaultPreemptionMode(RuntimeCapabilityTable &deviceCapabilities, bool allowMidThread, bool allowThreadGroup, bool allowMidBatch) {
     if (deviceCapabilities.defaultPreemptionMode >= PreemptionMode::MidThread &&
         allowMidThread) {
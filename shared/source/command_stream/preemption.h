@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/hw_info.h"
 
 #include "sku_info.h"
@@ -44,6 +45,8 @@ class PreemptionHelper {
 
     static PreemptionMode taskPreemptionMode(PreemptionMode devicePreemptionMode, const PreemptionFlags &flags);
     static PreemptionMode taskPreemptionMode(Device &device, const MultiDispatchInfo &multiDispatchInfo);
+    static PreemptionMode contextPreemptionMode(PreemptionMode devicePreemptionMode, EngineUsage engineUsage);
+    static PreemptionMode limitToContextPreemptionMode(PreemptionMode taskPreemptionMode, PreemptionMode contextPreemptionMode);
     static bool allowThreadGroupPreemption(const PreemptionFlags &flags);
     static bool allowMidThreadPreemption(const PreemptionFlags &flags);
     static void adjustDefaultPreemptionMode(RuntimeCapabilityTable &deviceCapabilities, bool allowMidThread, bool allowThreadGroup, bool allowMidBatch);
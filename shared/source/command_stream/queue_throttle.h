@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,4 +14,17 @@ enum QueueThrottle : uint32_t {
     MEDIUM,
     HIGH
 };
+
+// HIGH trades CPU time for latency: every submission is flushed and waits poll for completion,
+// LOW trades latency for CPU time and power: submissions follow dispatch mode of CSR and waits sleep in KMD,
+// MEDIUM keeps adaptive KMD notify waits.
+struct QueueThrottlePolicy {
+    bool flushEverySubmission;
+    bool pollingWait;
+    bool powerSavingWait;
+
+    static constexpr QueueThrottlePolicy get(QueueThrottle throttle) {
+        return {throttle == HIGH, throttle == HIGH, throttle == LOW};
+    }
+};
 } // namespace NEO
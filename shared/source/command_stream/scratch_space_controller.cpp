@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,14 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
 ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
@@ -20,17 +22,34 @@ ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, Executi
     auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
     auto &hwHelper = HwHelper::get(hwInfo->platform.eRenderCoreFamily);
     computeUnitsUsedForScratch = hwHelper.getComputeUnitsUsedForScratch(hwInfo);
+    if (ScratchSpacePool::isEnabled()) {
+        scratchSpacePool = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getScratchSpacePool(rootDeviceIndex);
+    }
 }
 
 ScratchSpaceController::~ScratchSpaceController() {
     if (scratchAllocation) {
-        getMemoryManager()->freeGraphicsMemory(scratchAllocation);
+        if (scratchSpacePool) {
+            scratchSpacePool->releaseAllocation(scratchAllocation, csrAllocationStorage.getDeviceBitfield());
+        } else {
+            getMemoryManager()->freeGraphicsMemory(scratchAllocation);
+        }
     }
     if (privateScratchAllocation) {
         getMemoryManager()->freeGraphicsMemory(privateScratchAllocation);
     }
 }
 
+void ScratchSpaceController::releaseScratchSpaceAllocation(uint32_t currentTaskCount, OsContext &osContext) {
+    scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
+    if (scratchSpacePool) {
+        scratchSpacePool->releaseAllocation(scratchAllocation, csrAllocationStorage.getDeviceBitfield());
+    } else {
+        csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+    }
+    scratchAllocation = nullptr;
+}
+
 MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
@@ -20,6 +20,7 @@ class InternalAllocationStorage;
 class MemoryManager;
 struct HardwareInfo;
 class OsContext;
+class ScratchSpacePool;
 
 namespace ScratchSpaceConstants {
 constexpr size_t scratchSpaceOffsetFor64Bit = 4096u;
@@ -73,12 +74,14 @@ class ScratchSpaceController {
 
   protected:
     MemoryManager *getMemoryManager() const;
+    void releaseScratchSpaceAllocation(uint32_t currentTaskCount, OsContext &osContext);
 
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
     GraphicsAllocation *scratchAllocation = nullptr;
     GraphicsAllocation *privateScratchAllocation = nullptr;
     InternalAllocationStorage &csrAllocationStorage;
+    ScratchSpacePool *scratchSpacePool = nullptr;
     size_t scratchSizeBytes = 0;
     size_t privateScratchSizeBytes = 0;
     bool force32BitAllocation = false;
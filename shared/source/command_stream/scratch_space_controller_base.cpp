@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/scratch_space_controller_base.h"
 
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
@@ -33,8 +34,7 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
     size_t requiredScratchSizeInBytes = requiredPerThreadScratchSize * computeUnitsUsedForScratch;
     if (requiredScratchSizeInBytes && (scratchSizeBytes < requiredScratchSizeInBytes)) {
         if (scratchAllocation) {
-            scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-            csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            releaseScratchSpaceAllocation(currentTaskCount, osContext);
         }
         scratchSizeBytes = requiredScratchSizeInBytes;
         createScratchSpaceAllocation();
@@ -47,6 +47,10 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
 }
 
 void ScratchSpaceControllerBase::createScratchSpaceAllocation() {
+    if (scratchSpacePool) {
+        scratchAllocation = scratchSpacePool->obtainAllocation(scratchSizeBytes, this->csrAllocationStorage.getDeviceBitfield());
+        return;
+    }
     scratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, scratchSizeBytes, GraphicsAllocation::AllocationType::SCRATCH_SURFACE, this->csrAllocationStorage.getDeviceBitfield()});
     UNRECOVERABLE_IF(scratchAllocation == nullptr);
 }
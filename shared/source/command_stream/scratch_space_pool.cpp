@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_pool.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace NEO {
+ScratchSpacePool::ScratchSpacePool(uint32_t rootDeviceIndex, ExecutionEnvironment &executionEnvironment)
+    : rootDeviceIndex(rootDeviceIndex), executionEnvironment(executionEnvironment) {
+}
+
+ScratchSpacePool::~ScratchSpacePool() {
+    for (auto &pooledAllocation : pooledAllocations) {
+        executionEnvironment.memoryManager->freeGraphicsMemory(pooledAllocation.allocation);
+    }
+}
+
+bool ScratchSpacePool::isEnabled() {
+    return DebugManager.flags.EnableScratchSpacePool.get() == 1;
+}
+
+size_t ScratchSpacePool::getPooledBytesLimit() {
+    if (DebugManager.flags.ScratchSpacePoolSizeLimit.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.ScratchSpacePoolSizeLimit.get());
+    }
+    return std::numeric_limits<size_t>::max();
+}
+
+GraphicsAllocation *ScratchSpacePool::obtainAllocation(size_t requiredSize, DeviceBitfield deviceBitfield) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    auto bestFit = pooledAllocations.end();
+    for (auto it = pooledAllocations.begin(); it != pooledAllocations.end(); it++) {
+        auto allocation = it->allocation;
+        if (allocation->getUnderlyingBufferSize() < requiredSize || it->deviceBitfield != deviceBitfield) {
+            continue;
+        }
+        if (bestFit != pooledAllocations.end() && bestFit->allocation->getUnderlyingBufferSize() <= allocation->getUnderlyingBufferSize()) {
+            continue;
+        }
+        if (!isAllocationBusy(*allocation)) {
+            bestFit = it;
+        }
+    }
+
+    if (bestFit != pooledAllocations.end()) {
+        auto allocation = bestFit->allocation;
+        pooledAllocations.erase(bestFit);
+        pooledBytes -= allocation->getUnderlyingBufferSize();
+        return allocation;
+    }
+
+    auto allocation = executionEnvironment.memoryManager->allocateGraphicsMemoryWithProperties({rootDeviceIndex, requiredSize, GraphicsAllocation::AllocationType::SCRATCH_SURFACE, deviceBitfield});
+    UNRECOVERABLE_IF(allocation == nullptr);
+    allocatedBytes += allocation->getUnderlyingBufferSize();
+    peakAllocatedBytes = std::max(peakAllocatedBytes, allocatedBytes);
+    return allocation;
+}
+
+void ScratchSpacePool::releaseAllocation(GraphicsAllocation *allocation, DeviceBitfield deviceBitfield) {
+    std::unique_lock<std::mutex> lock(mtx);
+    pooledAllocations.push_back({allocation, deviceBitfield});
+    pooledBytes += allocation->getUnderlyingBufferSize();
+    trimPool();
+}
+
+void ScratchSpacePool::trimPool() {
+    auto limit = getPooledBytesLimit();
+    auto memoryManager = executionEnvironment.memoryManager.get();
+    while (pooledBytes > limit) {
+        auto allocation = pooledAllocations.front().allocation;
+        pooledAllocations.erase(pooledAllocations.begin());
+        pooledBytes -= allocation->getUnderlyingBufferSize();
+        allocatedBytes -= allocation->getUnderlyingBufferSize();
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    }
+}
+
+bool ScratchSpacePool::isAllocationBusy(GraphicsAllocation &allocation) const {
+    if (!allocation.isUsed()) {
+        return false;
+    }
+    for (auto &engine : executionEnvironment.memoryManager->getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (allocation.isUsedByOsContext(contextId) &&
+            allocation.getTaskCount(contextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t ScratchSpacePool::getAllocatedBytes() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return allocatedBytes;
+}
+
+size_t ScratchSpacePool::getPooledBytes() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return pooledBytes;
+}
+
+size_t ScratchSpacePool::getPeakAllocatedBytes() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return peakAllocatedBytes;
+}
+} // namespace NEO
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class ExecutionEnvironment;
+class GraphicsAllocation;
+
+// Scratch allocations shared by all command stream receivers of a root device.
+// Allocation released by one CSR is handed to another one only after GPU completed all work using it,
+// so engines running concurrently never share scratch.
+class ScratchSpacePool : NonCopyableOrMovableClass {
+  public:
+    ScratchSpacePool(uint32_t rootDeviceIndex, ExecutionEnvironment &executionEnvironment);
+    MOCKABLE_VIRTUAL ~ScratchSpacePool();
+
+    static bool isEnabled();
+    static size_t getPooledBytesLimit();
+
+    GraphicsAllocation *obtainAllocation(size_t requiredSize, DeviceBitfield deviceBitfield);
+    void releaseAllocation(GraphicsAllocation *allocation, DeviceBitfield deviceBitfield);
+
+    size_t getAllocatedBytes() const;
+    size_t getPooledBytes() const;
+    size_t getPeakAllocatedBytes() const;
+
+  protected:
+    struct PooledAllocation {
+        GraphicsAllocation *allocation;
+        DeviceBitfield deviceBitfield;
+    };
+
+    MOCKABLE_VIRTUAL bool isAllocationBusy(GraphicsAllocation &allocation) const;
+    void trimPool();
+
+    const uint32_t rootDeviceIndex;
+    ExecutionEnvironment &executionEnvironment;
+    std::vector<PooledAllocation> pooledAllocations;
+    size_t allocatedBytes = 0u;
+    size_t peakAllocatedBytes = 0u;
+    size_t pooledBytes = 0u;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/submission_gpu_timestamps.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/submission_latency_counters.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <cstring>
+
+namespace NEO {
+
+bool SubmissionGpuTimestamps::isEnabled() {
+    return DebugManager.flags.EnableSubmissionGpuTimestamps.get() == 1;
+}
+
+SubmissionGpuTimestamps::SubmissionGpuTimestamps(CommandStreamReceiver &csr, const HwHelper &hwHelper, double timerResolution) : csr(csr),
+                                                                                                                                   hwHelper(hwHelper),
+                                                                                                                                   timerResolution(timerResolution) {
+    allocation = csr.getMemoryManager()->allocateGraphicsMemoryWithProperties({csr.getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY, csr.getOsContext().getDeviceBitfield()});
+    if (allocation) {
+        memset(allocation->getUnderlyingBuffer(), 0, allocation->getUnderlyingBufferSize());
+    }
+}
+
+SubmissionGpuTimestamps::~SubmissionGpuTimestamps() {
+    csr.getMemoryManager()->freeGraphicsMemory(allocation);
+}
+
+SubmissionGpuTimestamps::GpuTimestamps *SubmissionGpuTimestamps::acquireSlot(uint32_t taskCount, OSTime &osTime) {
+    if (allocation == nullptr || pendingCount == slotsCount) {
+        return nullptr;
+    }
+    auto index = (firstPending + pendingCount) % slotsCount;
+    if (index == 0u) {
+        // GPU clock drifts against CPU clock, one resample per ring wrap keeps correlation cheap
+        TimeStampData sample = {};
+        if (osTime.getCpuGpuTime(&sample)) {
+            cpuGpuTime = sample;
+        }
+    }
+
+    auto slot = static_cast<GpuTimestamps *>(allocation->getUnderlyingBuffer()) + index;
+    slot->start = 0u;
+    slot->end = 0u;
+    pending[index] = {taskCount, 0u};
+    pendingCount++;
+    return slot;
+}
+
+uint64_t SubmissionGpuTimestamps::getGpuAddress(const GpuTimestamps *slot) const {
+    return allocation->getGpuAddress() + ptrDiff(slot, allocation->getUnderlyingBuffer());
+}
+
+void SubmissionGpuTimestamps::setSubmitTime(uint64_t cpuTimeInNs) {
+    if (pendingCount > 0u) {
+        pending[(firstPending + pendingCount - 1) % slotsCount].submitTimeInNs = cpuTimeInNs;
+    }
+}
+
+void SubmissionGpuTimestamps::harvest(uint32_t completedTaskCount, SubmissionLatencyCounters &counters) {
+    auto slots = static_cast<const GpuTimestamps *>(allocation ? allocation->getUnderlyingBuffer() : nullptr);
+    int64_t cpuGpuTimeOffset = static_cast<int64_t>(cpuGpuTime.CPUTimeinNS) - static_cast<int64_t>(hwHelper.getGpuTimeStampInNS(cpuGpuTime.GPUTimeStamp, timerResolution));
+
+    while (pendingCount > 0u && pending[firstPending].taskCount <= completedTaskCount) {
+        auto &submission = pending[firstPending];
+        auto &slot = slots[firstPending];
+
+        if (slot.start != 0u && slot.end >= slot.start) {
+            counters.record(SubmissionLatencyCounters::GpuBusy, static_cast<uint64_t>((slot.end - slot.start) * timerResolution));
+
+            auto gpuStartInNs = static_cast<int64_t>(hwHelper.getGpuTimeStampInNS(slot.start, timerResolution)) + cpuGpuTimeOffset;
+            if (cpuGpuTime.CPUTimeinNS != 0u && submission.submitTimeInNs != 0u && gpuStartInNs > static_cast<int64_t>(submission.submitTimeInNs)) {
+                counters.record(SubmissionLatencyCounters::GpuQueueing, static_cast<uint64_t>(gpuStartInNs) - submission.submitTimeInNs);
+            }
+        }
+
+        firstPending = (firstPending + 1) % slotsCount;
+        pendingCount--;
+    }
+}
+} // namespace NEO
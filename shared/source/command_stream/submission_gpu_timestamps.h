@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/os_interface/os_time.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+class CommandStreamReceiver;
+class GraphicsAllocation;
+class HwHelper;
+class SubmissionLatencyCounters;
+
+// Ring of GPU timestamps written by PIPE_CONTROLs at start and end of every batch buffer of single CSR.
+// Completed entries are harvested against CSR tag into GPU busy and queueing delay stages of submission latency counters,
+// queueing delay correlates CPU submit time with GPU start through CPU/GPU time sample refreshed once per ring wrap.
+class SubmissionGpuTimestamps {
+  public:
+    struct GpuTimestamps {
+        uint64_t start;
+        uint64_t end;
+    };
+    static constexpr uint32_t slotsCount = static_cast<uint32_t>(MemoryConstants::pageSize / sizeof(GpuTimestamps));
+
+    static bool isEnabled();
+
+    SubmissionGpuTimestamps(CommandStreamReceiver &csr, const HwHelper &hwHelper, double timerResolution);
+    ~SubmissionGpuTimestamps();
+
+    // returns nullptr when all slots wait for completion, such submission is not timed
+    GpuTimestamps *acquireSlot(uint32_t taskCount, OSTime &osTime);
+    uint64_t getGpuAddress(const GpuTimestamps *slot) const;
+    void setSubmitTime(uint64_t cpuTimeInNs);
+    void harvest(uint32_t completedTaskCount, SubmissionLatencyCounters &counters);
+
+    GraphicsAllocation *getAllocation() const { return allocation; }
+    uint32_t getPendingCount() const { return pendingCount; }
+
+  protected:
+    struct PendingSubmission {
+        uint32_t taskCount;
+        uint64_t submitTimeInNs;
+    };
+
+    CommandStreamReceiver &csr;
+    const HwHelper &hwHelper;
+    GraphicsAllocation *allocation = nullptr;
+    double timerResolution;
+    TimeStampData cpuGpuTime = {};
+    PendingSubmission pending[slotsCount] = {};
+    uint32_t firstPending = 0u;
+    uint32_t pendingCount = 0u;
+};
+} // namespace NEO
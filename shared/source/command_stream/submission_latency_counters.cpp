@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/submission_latency_counters.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+bool SubmissionLatencyCounters::isEnabled() {
+    return DebugManager.flags.EnableSubmissionLatencyCounters.get() == 1;
+}
+
+const char *SubmissionLatencyCounters::getStageName(Stage stage) {
+    switch (stage) {
+    case StateProgramming:
+        return "stateProgramming";
+    case Residency:
+        return "residency";
+    case Submit:
+        return "submit";
+    case GpuStart:
+        return "gpuStart";
+    case OwnershipWait:
+        return "ownershipWait";
+    case GpuBusy:
+        return "gpuBusy";
+    case GpuQueueing:
+        return "gpuQueueing";
+    default:
+        return "unknown";
+    }
+}
+
+uint32_t SubmissionLatencyCounters::getBucketIndex(uint64_t latencyInNs) {
+    if (latencyInNs == 0) {
+        return 0;
+    }
+    return std::min(Math::log2(latencyInNs), bucketsCount - 1);
+}
+
+void SubmissionLatencyCounters::record(Stage stage, uint64_t latencyInNs) {
+    // GPU start may be recorded by thread not owning CSR, relaxed atomic adds keep counters consistent
+    samplesCount[stage].fetch_add(1, std::memory_order_relaxed);
+    totalTimeInNs[stage].fetch_add(latencyInNs, std::memory_order_relaxed);
+    buckets[stage][getBucketIndex(latencyInNs)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void SubmissionLatencyCounters::dump(std::ostream &out) const {
+    out << "stage,samples,totalNs";
+    for (uint32_t bucket = 0; bucket < bucketsCount; bucket++) {
+        out << ",<" << (1ull << (bucket + 1)) << "ns";
+    }
+    out << "\n";
+
+    for (uint32_t stage = 0; stage < StagesCount; stage++) {
+        auto samples = getSamplesCount(static_cast<Stage>(stage));
+        if (samples == 0) {
+            continue;
+        }
+        out << getStageName(static_cast<Stage>(stage)) << "," << samples << "," << getTotalTime(static_cast<Stage>(stage));
+        for (uint32_t bucket = 0; bucket < bucketsCount; bucket++) {
+            out << "," << getBucketCount(static_cast<Stage>(stage), bucket);
+        }
+        out << "\n";
+    }
+    out.flush();
+}
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace NEO {
+
+// Log2 latency histograms of submission stages of single CSR, used to tune batching and residency policies.
+// Host stages are recorded under CSR ownership, GPU start is recorded when profiled event completes.
+// Ownership wait is recorded for every acquisition of CSR ownership, uncontended ones land in first bucket.
+// GPU busy and queueing delay of every batch buffer are recorded from SubmissionGpuTimestamps when enabled.
+class SubmissionLatencyCounters {
+  public:
+    enum Stage : uint32_t {
+        StateProgramming = 0,
+        Residency,
+        Submit,
+        GpuStart,
+        OwnershipWait,
+        GpuBusy,
+        GpuQueueing,
+        StagesCount
+    };
+    // bucket i counts latencies in [2^i, 2^(i+1)) ns, last bucket also takes longer ones
+    static constexpr uint32_t bucketsCount = 32;
+
+    static bool isEnabled();
+    static const char *getStageName(Stage stage);
+    static uint32_t getBucketIndex(uint64_t latencyInNs);
+
+    static uint64_t getTimestampInNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void record(Stage stage, uint64_t latencyInNs);
+
+    uint64_t getSamplesCount(Stage stage) const { return samplesCount[stage].load(std::memory_order_relaxed); }
+    uint64_t getTotalTime(Stage stage) const { return totalTimeInNs[stage].load(std::memory_order_relaxed); }
+    uint64_t getBucketCount(Stage stage, uint32_t bucket) const { return buckets[stage][bucket].load(std::memory_order_relaxed); }
+
+    void dump(std::ostream &out) const;
+
+  protected:
+    std::atomic<uint64_t> samplesCount[StagesCount] = {};
+    std::atomic<uint64_t> totalTimeInNs[StagesCount] = {};
+    std::atomic<uint64_t> buckets[StagesCount][bucketsCount] = {};
+};
+
+struct SubmissionLatencyScope {
+    SubmissionLatencyScope(SubmissionLatencyCounters *counters, SubmissionLatencyCounters::Stage stage) : counters(counters), stage(stage) {
+        if (counters) {
+            start = SubmissionLatencyCounters::getTimestampInNs();
+        }
+    }
+
+    ~SubmissionLatencyScope() {
+        if (counters) {
+            counters->record(stage, SubmissionLatencyCounters::getTimestampInNs() - start);
+        }
+    }
+
+    SubmissionLatencyCounters *counters;
+    SubmissionLatencyCounters::Stage stage;
+    uint64_t start = 0;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,13 +7,72 @@
 
 #include "submissions_aggregator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 
+NEO::SubmissionAggregator::SubmissionAggregator() {
+    if (DebugManager.flags.BatchedDispatchFlushDeadline.get() > 0) {
+        flushDeadline = std::chrono::microseconds(DebugManager.flags.BatchedDispatchFlushDeadline.get());
+    }
+    if (DebugManager.flags.BatchedDispatchMaxCommandBuffers.get() > 0) {
+        maxPendingCommandBuffers = static_cast<size_t>(DebugManager.flags.BatchedDispatchMaxCommandBuffers.get());
+    }
+    if (DebugManager.flags.BatchedDispatchMaxSurfaces.get() > 0) {
+        maxPendingSurfaces = static_cast<size_t>(DebugManager.flags.BatchedDispatchMaxSurfaces.get());
+    }
+}
+
 void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
+    if (pendingCommandBuffers == 0u) {
+        oldestPendingTime = std::chrono::steady_clock::now();
+    }
+    pendingCommandBuffers++;
+    pendingSurfaces += commandBuffer->surfaces.size();
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
 
+bool NEO::SubmissionAggregator::isFlushRequired(std::chrono::steady_clock::time_point now) const {
+    if (pendingCommandBuffers == 0u) {
+        return false;
+    }
+    if (maxPendingCommandBuffers > 0u && pendingCommandBuffers >= maxPendingCommandBuffers) {
+        return true;
+    }
+    if (maxPendingSurfaces > 0u && pendingSurfaces >= maxPendingSurfaces) {
+        return true;
+    }
+    return flushDeadline.count() > 0 && now - oldestPendingTime >= flushDeadline;
+}
+
+void NEO::SubmissionAggregator::registerFlush(std::chrono::steady_clock::time_point now) {
+    if (pendingCommandBuffers == 0u) {
+        return;
+    }
+    batchingStatistics.batches++;
+    batchingStatistics.batchedCommandBuffers += pendingCommandBuffers;
+    batchingStatistics.totalAddedLatencyNs += std::chrono::duration_cast<std::chrono::nanoseconds>(now - oldestPendingTime).count();
+    pendingCommandBuffers = 0u;
+    pendingSurfaces = 0u;
+}
+
+void NEO::SubmissionAggregator::recycleSurfaces(ResidencyContainer &surfaces) {
+    if (surfaces.capacity() == 0u || recycledSurfaceContainers.size() >= maxRecycledSurfaceContainers) {
+        return;
+    }
+    surfaces.clear();
+    recycledSurfaceContainers.push_back(std::move(surfaces));
+    surfaces.clear();
+}
+
+void NEO::SubmissionAggregator::obtainSurfaces(ResidencyContainer &surfaces) {
+    if (recycledSurfaceContainers.empty() || surfaces.capacity() != 0u) {
+        return;
+    }
+    surfaces.swap(recycledSurfaceContainers.back());
+    recycledSurfaceContainers.pop_back();
+}
+
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
@@ -12,6 +12,7 @@
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <chrono>
 #include <vector>
 namespace NEO {
 class Device;
@@ -69,12 +70,46 @@ using ResourcePackage = StackVec<GraphicsAllocation *, 128>;
 
 class SubmissionAggregator {
   public:
+    struct BatchingStatistics {
+        uint64_t batches = 0u;
+        uint64_t batchedCommandBuffers = 0u;
+        uint64_t totalAddedLatencyNs = 0u;
+
+        uint64_t getAverageBatchSize() const {
+            return batches ? batchedCommandBuffers / batches : 0u;
+        }
+        uint64_t getAverageAddedLatencyNs() const {
+            return batches ? totalAddedLatencyNs / batches : 0u;
+        }
+    };
+
+    SubmissionAggregator();
+
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
 
+    bool isFlushRequired(std::chrono::steady_clock::time_point now) const;
+    void registerFlush(std::chrono::steady_clock::time_point now);
+    const BatchingStatistics &getBatchingStatistics() const { return batchingStatistics; }
+
+    // surface containers of flushed command buffers are handed out again, so recording keeps their capacity
+    static constexpr size_t maxRecycledSurfaceContainers = 32u;
+    void recycleSurfaces(ResidencyContainer &surfaces);
+    void obtainSurfaces(ResidencyContainer &surfaces);
+
   protected:
     CommandBufferList cmdBuffers;
     uint32_t inspectionId = 1;
+
+    std::chrono::microseconds flushDeadline{0};
+    size_t maxPendingCommandBuffers = 0u;
+    size_t maxPendingSurfaces = 0u;
+
+    size_t pendingCommandBuffers = 0u;
+    size_t pendingSurfaces = 0u;
+    std::chrono::steady_clock::time_point oldestPendingTime;
+    BatchingStatistics batchingStatistics;
+    std::vector<ResidencyContainer> recycledSurfaceContainers;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,21 +11,35 @@
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/utilities/debug_settings_reader.h"
+#include "shared/source/utilities/directory.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <iomanip>
-#include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
+namespace {
+const std::string lockFileExtension = ".lock";
+const std::string tempFileExtension = ".tmp";
+const std::string directoryLockName = "cache_directory.lock";
+
+bool endsWith(const std::string &text, const std::string &suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+} // namespace
+
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
-                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const std::unordered_map<uint32_t, uint64_t> &specConstants) {
     Hash hash;
 
     hash.update("----", 4);
@@ -35,6 +49,17 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update("----", 4);
     hash.update(&*internalOptions.begin(), internalOptions.size());
 
+    if (false == specConstants.empty()) {
+        // ordered by id, so the same specialization gives the same name in every process
+        std::vector<std::pair<uint32_t, uint64_t>> sortedSpecConstants(specConstants.begin(), specConstants.end());
+        std::sort(sortedSpecConstants.begin(), sortedSpecConstants.end());
+        hash.update("----", 4);
+        for (const auto &specConstant : sortedSpecConstants) {
+            hash.update(reinterpret_cast<const char *>(&specConstant.first), sizeof(specConstant.first));
+            hash.update(reinterpret_cast<const char *>(&specConstant.second), sizeof(specConstant.second));
+        }
+    }
+
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
     hash.update("----", 4);
@@ -52,22 +77,202 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (false == config.sharedCacheDir.empty()) {
+        createDirectory(config.sharedCacheDir);
+    }
+}
+
+CompilerMemoryCache &CompilerMemoryCache::getInstance() {
+    static CompilerMemoryCache memoryCache(defaultCompilerMemoryCacheSize);
+    return memoryCache;
+}
+
+std::unique_ptr<char[]> CompilerMemoryCache::load(const std::string &kernelFileHash, size_t &binarySize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entriesMap.find(kernelFileHash);
+    if (entry == entriesMap.end()) {
+        binarySize = 0u;
+        return nullptr;
+    }
+    entries.splice(entries.begin(), entries, entry->second);
+
+    binarySize = entry->second->size;
+    std::unique_ptr<char[]> binary(new char[binarySize]);
+    memcpy_s(binary.get(), binarySize, entry->second->binary.get(), binarySize);
+    return binary;
+}
+
+void CompilerMemoryCache::store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (binarySize > capacity) {
+        return;
+    }
+
+    std::unique_ptr<char[]> binary(new char[binarySize]);
+    memcpy_s(binary.get(), binarySize, pBinary, binarySize);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entriesMap.find(kernelFileHash) != entriesMap.end()) {
+        return;
+    }
+    while (usedSize + binarySize > capacity) {
+        auto &leastRecentlyUsed = entries.back();
+        usedSize -= leastRecentlyUsed.size;
+        entriesMap.erase(leastRecentlyUsed.kernelFileHash);
+        entries.pop_back();
+    }
+
+    entries.push_front({kernelFileHash, std::move(binary), binarySize});
+    entriesMap[kernelFileHash] = entries.begin();
+    usedSize += binarySize;
+}
+
+void CompilerMemoryCache::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    entriesMap.clear();
+    entries.clear();
+    usedSize = 0u;
+}
 
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+    if (config.memoryCacheEnabled) {
+        CompilerMemoryCache::getInstance().store(kernelFileHash, pBinary, binarySize);
+    }
+    // first process building the binary publishes it to other processes of the node
+    if (false == config.sharedCacheDir.empty()) {
+        storeInDirectory(config.sharedCacheDir, config.sharedCacheSize, kernelFileHash, pBinary, binarySize);
+    }
+    return storeInDirectory(config.cacheDir, config.cacheSize, kernelFileHash, pBinary, binarySize);
+}
+
+bool CompilerCache::storeInDirectory(const std::string &cacheDir, size_t cacheSize, const std::string &kernelFileHash, const char *pBinary, uint32_t binarySize) {
+    std::string filePath = cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+
+    // the same binary is being stored by other thread or process
+    auto entryLock = tryLockFile(filePath + lockFileExtension);
+    if (entryLock == invalidLock) {
+        return false;
+    }
+
+    // readers never see partially written file, entry appears only after rename
+    std::string tempPath = filePath + "." + std::to_string(getProcessId()) + "_" + std::to_string(tempFilesCount++) + tempFileExtension;
+    bool cached = binarySize == writeDataToFile(tempPath.c_str(), pBinary, binarySize) && replaceFile(tempPath, filePath);
+    if (!cached) {
+        std::remove(tempPath.c_str());
+    }
+    unlockFile(entryLock);
+
+    if (cached) {
+        evictEntries(cacheDir, cacheSize);
+    }
+    return cached;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+    if (config.memoryCacheEnabled) {
+        auto binary = CompilerMemoryCache::getInstance().load(kernelFileHash, cachedBinarySize);
+        if (binary) {
+            memoryHits++;
+            return binary;
+        }
+    }
+
+    std::unique_ptr<char[]> binary;
+    if (false == config.sharedCacheDir.empty()) {
+        binary = loadFromDirectory(config.sharedCacheDir, kernelFileHash, cachedBinarySize);
+        if (binary) {
+            sharedHits++;
+        }
+    }
+
+    if (nullptr == binary) {
+        binary = loadFromDirectory(config.cacheDir, kernelFileHash, cachedBinarySize);
+        if (binary) {
+            hits++;
+            if (false == config.sharedCacheDir.empty()) {
+                storeInDirectory(config.sharedCacheDir, config.sharedCacheSize, kernelFileHash, binary.get(), static_cast<uint32_t>(cachedBinarySize));
+            }
+        }
+    }
+
+    if (binary) {
+        if (config.memoryCacheEnabled) {
+            CompilerMemoryCache::getInstance().store(kernelFileHash, binary.get(), cachedBinarySize);
+        }
+    } else {
+        misses++;
+    }
+    return binary;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadFromDirectory(const std::string &cacheDir, const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    std::string filePath = cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+
+    auto binary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    if (binary) {
+        updateAccessTime(filePath);
+    }
+    return binary;
+}
+
+CompilerCacheStatistics CompilerCache::getStatistics() const {
+    CompilerCacheStatistics statistics;
+    statistics.hits = hits.load();
+    statistics.memoryHits = memoryHits.load();
+    statistics.sharedHits = sharedHits.load();
+    statistics.misses = misses.load();
+    statistics.evictions = evictions.load();
+    return statistics;
+}
+
+bool CompilerCache::isCacheEntry(const std::string &path) const {
+    if (endsWith(path, lockFileExtension) || endsWith(path, tempFileExtension)) {
+        return false;
+    }
+    return endsWith(path, config.cacheFileExtension);
+}
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+void CompilerCache::evictEntries(const std::string &cacheDir, size_t cacheSize) {
+    if (cacheSize == 0u) {
+        return;
+    }
+
+    // process holding the lock is already trimming the directory
+    auto directoryLock = tryLockFile(cacheDir + PATH_SEPARATOR + directoryLockName);
+    if (directoryLock == invalidLock) {
+        return;
+    }
+
+    std::vector<CacheEntry> entries;
+    size_t totalSize = 0u;
+    for (auto &file : Directory::getFiles(cacheDir)) {
+        CacheEntry entry;
+        if (isCacheEntry(file) && getEntryInfo(file, entry)) {
+            totalSize += entry.size;
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    if (totalSize > cacheSize) {
+        std::sort(entries.begin(), entries.end(), [](const CacheEntry &left, const CacheEntry &right) {
+            return left.lastAccessTime < right.lastAccessTime;
+        });
+
+        for (auto &entry : entries) {
+            if (totalSize <= cacheSize) {
+                break;
+            }
+            if (std::remove(entry.path.c_str()) == 0) {
+                std::remove((entry.path + lockFileExtension).c_str());
+                totalSize -= entry.size;
+                evictions++;
+            }
+        }
+    }
+    unlockFile(directoryLock);
 }
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,27 +7,78 @@
 
 #pragma once
 
+#include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/arrayref.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 struct HardwareInfo;
 
+constexpr size_t defaultCompilerCacheSize = 1024u * 1024u * 1024u;
+constexpr size_t defaultCompilerMemoryCacheSize = 64u * 1024u * 1024u;
+constexpr size_t defaultCompilerSharedCacheSize = 256u * 1024u * 1024u;
+
 struct CompilerCacheConfig {
     bool enabled = true;
+    bool memoryCacheEnabled = false;
+    size_t cacheSize = 0u; // 0 - unlimited
     std::string cacheFileExtension;
     std::string cacheDir;
+    // directory on memory backed file system (e.g. /dev/shm) shared by processes of the node, empty - disabled
+    std::string sharedCacheDir;
+    size_t sharedCacheSize = defaultCompilerSharedCacheSize; // 0 - unlimited
+};
+
+struct CompilerCacheStatistics {
+    uint64_t hits = 0u;
+    uint64_t memoryHits = 0u;
+    uint64_t sharedHits = 0u;
+    uint64_t misses = 0u;
+    uint64_t evictions = 0u;
+};
+
+// Binaries built or loaded recently in this process, keyed by cached file name.
+// Shared by caches of all devices, so the same module built for several devices is compiled and read from disk once.
+class CompilerMemoryCache : NonCopyableOrMovableClass {
+  public:
+    static CompilerMemoryCache &getInstance();
+
+    CompilerMemoryCache(size_t capacity) : capacity(capacity) {}
+
+    std::unique_ptr<char[]> load(const std::string &kernelFileHash, size_t &binarySize);
+    void store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    void clear();
+
+    size_t getUsedSize() const { return usedSize; }
+
+  protected:
+    struct Entry {
+        std::string kernelFileHash;
+        std::unique_ptr<char[]> binary;
+        size_t size = 0u;
+    };
+
+    // front is most recently used
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entriesMap;
+    std::mutex mtx;
+    size_t capacity = 0u;
+    size_t usedSize = 0u;
 };
 
 class CompilerCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
-                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                               const std::unordered_map<uint32_t, uint64_t> &specConstants = {});
 
     CompilerCache(const CompilerCacheConfig &config);
     virtual ~CompilerCache() = default;
@@ -40,8 +91,36 @@ class CompilerCache {
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
 
+    CompilerCacheStatistics getStatistics() const;
+
   protected:
-    static std::mutex cacheAccessMtx;
+    struct CacheEntry {
+        std::string path;
+        uint64_t lastAccessTime = 0u;
+        size_t size = 0u;
+    };
+
+    bool storeInDirectory(const std::string &cacheDir, size_t cacheSize, const std::string &kernelFileHash, const char *pBinary, uint32_t binarySize);
+    std::unique_ptr<char[]> loadFromDirectory(const std::string &cacheDir, const std::string &kernelFileHash, size_t &cachedBinarySize);
+    void evictEntries(const std::string &cacheDir, size_t cacheSize);
+    bool isCacheEntry(const std::string &path) const;
+
+    // os specific, locks are held per open file so they exclude threads of the same process too
+    static constexpr intptr_t invalidLock = -1;
+    static intptr_t tryLockFile(const std::string &lockPath);
+    static void unlockFile(intptr_t lock);
+    MOCKABLE_VIRTUAL bool replaceFile(const std::string &sourcePath, const std::string &destinationPath);
+    MOCKABLE_VIRTUAL bool getEntryInfo(const std::string &path, CacheEntry &entry);
+    MOCKABLE_VIRTUAL void updateAccessTime(const std::string &path);
+    static uint32_t getProcessId();
+    static bool createDirectory(const std::string &path);
+
     CompilerCacheConfig config;
+    std::atomic<uint32_t> tempFilesCount{0u};
+    std::atomic<uint64_t> hits{0u};
+    std::atomic<uint64_t> memoryHits{0u};
+    std::atomic<uint64_t> sharedHits{0u};
+    std::atomic<uint64_t> misses{0u};
+    std::atomic<uint64_t> evictions{0u};
 };
 } // namespace NEO
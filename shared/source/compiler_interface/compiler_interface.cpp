@@ -69,9 +69,11 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
                                                           input.src,
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          input.specializedValues);
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
+            output.deviceBinaryLoadedFromCache = true;
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -122,9 +124,11 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cachingMode == CachingMode::PreProcess) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          input.specializedValues);
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
+            output.deviceBinaryLoadedFromCache = true;
             return TranslationOutput::ErrorCode::Success;
         }
     }
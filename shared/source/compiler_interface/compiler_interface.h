@@ -66,6 +66,7 @@ struct TranslationOutput {
     MemAndSize intermediateRepresentation;
     MemAndSize deviceBinary;
     MemAndSize debugData;
+    bool deviceBinaryLoadedFromCache = false;
     std::string frontendCompilerLog;
     std::string backendCompilerLog;
 
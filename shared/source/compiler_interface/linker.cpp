@@ -10,6 +10,7 @@
 #include "shared/source/compiler_interface/linker.inl"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/elf/zebin_elf.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -17,6 +18,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/compiler_support.h"
+#include "shared/source/utilities/parallel_tasks.h"
 
 #include "RelocationInfo.h"
 
@@ -36,6 +38,7 @@ SegmentType LinkerInput::getSegmentForSection(ConstStringRef name) {
 }
 
 bool LinkerInput::decodeGlobalVariablesSymbolTable(const void *data, uint32_t numEntries) {
+    invalidateResolvedRelocations();
     auto symbolEntryIt = reinterpret_cast<const vISA::GenSymEntry *>(data);
     auto symbolEntryEnd = symbolEntryIt + numEntries;
     symbols.reserve(symbols.size() + numEntries);
@@ -63,6 +66,7 @@ bool LinkerInput::decodeGlobalVariablesSymbolTable(const void *data, uint32_t nu
 }
 
 bool LinkerInput::decodeExportedFunctionsSymbolTable(const void *data, uint32_t numEntries, uint32_t instructionsSegmentId) {
+    invalidateResolvedRelocations();
     auto symbolEntryIt = reinterpret_cast<const vISA::GenSymEntry *>(data);
     auto symbolEntryEnd = symbolEntryIt + numEntries;
     symbols.reserve(symbols.size() + numEntries);
@@ -95,6 +99,7 @@ bool LinkerInput::decodeExportedFunctionsSymbolTable(const void *data, uint32_t
 }
 
 bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, uint32_t instructionsSegmentId) {
+    invalidateResolvedRelocations();
     this->traits.requiresPatchingOfInstructionSegments = true;
     auto relocEntryIt = reinterpret_cast<const vISA::GenRelocEntry *>(data);
     auto relocEntryEnd = relocEntryIt + numEntries;
@@ -144,6 +149,7 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
 }
 
 void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId) {
+    invalidateResolvedRelocations();
     this->traits.requiresPatchingOfInstructionSegments = true;
 
     if (instructionsSegmentId >= relocations.size()) {
@@ -160,6 +166,7 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
 }
 
 void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<Elf::EI_CLASS_64> &elf, const SectionNameToSegmentIdMap &nameToSegmentId) {
+    invalidateResolvedRelocations();
     for (auto &reloc : elf.getRelocations()) {
         NEO::LinkerInput::RelocationInfo relocationInfo;
         relocationInfo.offset = reloc.offset;
@@ -240,9 +247,48 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<Elf::EI_CLASS_64>
     }
 }
 
+const LinkerInput::ResolvedRelocations &LinkerInput::getResolvedRelocations() const {
+    std::lock_guard<std::mutex> lock(resolvedRelocationsMutex);
+    if (nullptr != resolvedRelocations) {
+        return *resolvedRelocations;
+    }
+
+    auto resolved = std::make_unique<ResolvedRelocations>();
+    std::unordered_map<std::string, uint32_t> symbolIds;
+    symbolIds.reserve(symbols.size());
+    resolved->symbols.reserve(symbols.size());
+    for (auto &symbol : symbols) {
+        symbolIds[symbol.first] = static_cast<uint32_t>(resolved->symbols.size());
+        resolved->symbols.push_back(&symbol);
+    }
+
+    resolved->symbolIdsPerInstSegment.resize(relocations.size());
+    for (size_t segmentId = 0; segmentId < relocations.size(); segmentId++) {
+        auto &symbolIdsInSegment = resolved->symbolIdsPerInstSegment[segmentId];
+        symbolIdsInSegment.reserve(relocations[segmentId].size());
+        for (const auto &relocation : relocations[segmentId]) {
+            auto symbolIdIt = symbolIds.find(relocation.symbolName);
+            symbolIdsInSegment.push_back((symbolIdIt != symbolIds.end()) ? symbolIdIt->second : ResolvedRelocations::unresolvedSymbolId);
+        }
+        resolved->relocationsCount += relocations[segmentId].size();
+    }
+
+    resolvedRelocations = std::move(resolved);
+    return *resolvedRelocations;
+}
+
+void LinkerInput::invalidateResolvedRelocations() {
+    std::lock_guard<std::mutex> lock(resolvedRelocationsMutex);
+    resolvedRelocations.reset();
+}
+
 bool Linker::processRelocations(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions) {
-    relocatedSymbols.reserve(data.getSymbols().size());
-    for (auto &symbol : data.getSymbols()) {
+    auto &resolvedSymbols = data.getResolvedRelocations().symbols;
+    relocatedSymbols.reserve(resolvedSymbols.size());
+    relocatedSymbolsById.clear();
+    relocatedSymbolsById.reserve(resolvedSymbols.size());
+    for (auto symbolEntry : resolvedSymbols) {
+        auto &symbol = *symbolEntry;
         const SegmentInfo *seg = nullptr;
         switch (symbol.second.segment) {
         default:
@@ -264,6 +310,7 @@ bool Linker::processRelocations(const SegmentInfo &globalVariables, const Segmen
             return false;
         }
         relocatedSymbols[symbol.first] = {symbol.second, gpuAddress};
+        relocatedSymbolsById.push_back({symbol.second, gpuAddress});
     }
     return true;
 }
@@ -292,31 +339,52 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
         return;
     }
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    auto segIt = instructionsSegments.begin();
-    for (auto relocsIt = data.getRelocationsInInstructionSegments().begin(), relocsEnd = data.getRelocationsInInstructionSegments().end();
-         relocsIt != relocsEnd; ++relocsIt, ++segIt) {
-        auto &thisSegmentRelocs = *relocsIt;
-        const PatchableSegment &instSeg = *segIt;
-        for (const auto &relocation : thisSegmentRelocs) {
-            if (shouldIgnoreRelocation(relocation)) {
-                continue;
-            }
-            UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
-            auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+    auto &resolvedRelocations = data.getResolvedRelocations();
+    auto segmentsCount = data.getRelocationsInInstructionSegments().size();
+
+    if ((segmentsCount < 2) || (resolvedRelocations.relocationsCount < minRelocationsForParallelPatching)) {
+        for (uint32_t segmentId = 0; segmentId < segmentsCount; segmentId++) {
+            patchInstructionsSegment(resolvedRelocations, instructionsSegments, segmentId, outUnresolvedExternals);
+        }
+        return;
+    }
 
-            bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
-            bool unresolvedExternal = (symbolIt == relocatedSymbols.end());
+    // segments don't overlap, unresolved externals are gathered per segment to keep them reported in segment order
+    std::vector<UnresolvedExternals> unresolvedExternalsPerSegment(segmentsCount);
+    auto patchSegment = [&](size_t segmentId) {
+        patchInstructionsSegment(resolvedRelocations, instructionsSegments, static_cast<uint32_t>(segmentId), unresolvedExternalsPerSegment[segmentId]);
+    };
+    runParallelTasks(segmentsCount, ExecutionEnvironment::getBuildWorkersCount(), patchSegment);
 
-            DEBUG_BREAK_IF(invalidOffset);
-            if (invalidOffset || unresolvedExternal) {
-                uint32_t segId = static_cast<uint32_t>(segIt - instructionsSegments.begin());
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
-                continue;
-            }
+    for (const auto &segmentUnresolvedExternals : unresolvedExternalsPerSegment) {
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), segmentUnresolvedExternals.begin(), segmentUnresolvedExternals.end());
+    }
+}
 
-            patchAddress(relocAddress, symbolIt->second, relocation);
+void Linker::patchInstructionsSegment(const LinkerInput::ResolvedRelocations &resolvedRelocations, const std::vector<PatchableSegment> &instructionsSegments,
+                                      uint32_t segmentId, std::vector<UnresolvedExternal> &outUnresolvedExternals) {
+    const auto &thisSegmentRelocs = data.getRelocationsInInstructionSegments()[segmentId];
+    const auto &thisSegmentSymbolIds = resolvedRelocations.symbolIdsPerInstSegment[segmentId];
+    const PatchableSegment &instSeg = instructionsSegments[segmentId];
+    for (size_t relocationId = 0; relocationId < thisSegmentRelocs.size(); relocationId++) {
+        const auto &relocation = thisSegmentRelocs[relocationId];
+        if (shouldIgnoreRelocation(relocation)) {
+            continue;
         }
+        UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
+        auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        auto symbolId = thisSegmentSymbolIds[relocationId];
+
+        bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
+        bool unresolvedExternal = (symbolId == LinkerInput::ResolvedRelocations::unresolvedSymbolId);
+
+        DEBUG_BREAK_IF(invalidOffset);
+        if (invalidOffset || unresolvedExternal) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segmentId, invalidOffset});
+            continue;
+        }
+
+        patchAddress(relocAddress, relocatedSymbolsById[symbolId], relocation);
     }
 }
 
@@ -10,6 +10,8 @@
 
 #include <cstdint>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -94,6 +96,16 @@ struct LinkerInput {
     using SymbolMap = std::unordered_map<std::string, SymbolInfo>;
     using RelocationsPerInstSegment = std::vector<Relocations>;
 
+    // symbol names of instruction segment relocations are resolved once per linker input,
+    // so every following link (e.g. for another device) only applies offsets
+    struct ResolvedRelocations {
+        static constexpr uint32_t unresolvedSymbolId = std::numeric_limits<uint32_t>::max();
+
+        std::vector<const SymbolMap::value_type *> symbols;
+        std::vector<std::vector<uint32_t>> symbolIdsPerInstSegment;
+        size_t relocationsCount = 0;
+    };
+
     virtual ~LinkerInput() = default;
 
     static SegmentType getSegmentForSection(ConstStringRef name);
@@ -134,13 +146,20 @@ struct LinkerInput {
         return valid;
     }
 
+    const ResolvedRelocations &getResolvedRelocations() const;
+
   protected:
+    void invalidateResolvedRelocations();
+
     Traits traits;
     SymbolMap symbols;
     RelocationsPerInstSegment relocations;
     Relocations dataRelocations;
     int32_t exportedFunctionsSegmentId = -1;
     bool valid = true;
+
+    mutable std::mutex resolvedRelocationsMutex;
+    mutable std::unique_ptr<ResolvedRelocations> resolvedRelocations;
 };
 
 struct Linker {
@@ -206,10 +225,14 @@ struct Linker {
   protected:
     const LinkerInput &data;
     RelocatedSymbolsMap relocatedSymbols;
+    std::vector<RelocatedSymbol> relocatedSymbolsById;
+    size_t minRelocationsForParallelPatching = 4096u;
 
     bool processRelocations(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions);
 
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals);
+    void patchInstructionsSegment(const LinkerInput::ResolvedRelocations &resolvedRelocations, const std::vector<PatchableSegment> &instructionsSegments,
+                                  uint32_t segmentId, std::vector<UnresolvedExternal> &outUnresolvedExternals);
 
     void patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                            GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
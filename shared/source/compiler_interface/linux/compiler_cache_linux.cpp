@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+intptr_t CompilerCache::tryLockFile(const std::string &lockPath) {
+    int fd = ::open(lockPath.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0666);
+    if (fd < 0) {
+        return invalidLock;
+    }
+    if (::flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        ::close(fd);
+        return invalidLock;
+    }
+    return static_cast<intptr_t>(fd);
+}
+
+void CompilerCache::unlockFile(intptr_t lock) {
+    auto fd = static_cast<int>(lock);
+    ::flock(fd, LOCK_UN);
+    ::close(fd);
+}
+
+bool CompilerCache::replaceFile(const std::string &sourcePath, const std::string &destinationPath) {
+    return ::rename(sourcePath.c_str(), destinationPath.c_str()) == 0;
+}
+
+bool CompilerCache::getEntryInfo(const std::string &path, CacheEntry &entry) {
+    struct stat fileStat = {};
+    if (::stat(path.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+        return false;
+    }
+    entry.path = path;
+    entry.lastAccessTime = static_cast<uint64_t>(fileStat.st_mtim.tv_sec) * 1000000000ull + static_cast<uint64_t>(fileStat.st_mtim.tv_nsec);
+    entry.size = static_cast<size_t>(fileStat.st_size);
+    return true;
+}
+
+void CompilerCache::updateAccessTime(const std::string &path) {
+    ::utimensat(AT_FDCWD, path.c_str(), nullptr, 0);
+}
+
+uint32_t CompilerCache::getProcessId() {
+    return static_cast<uint32_t>(::getpid());
+}
+
+bool CompilerCache::createDirectory(const std::string &path) {
+    return ::mkdir(path.c_str(), 0777) == 0 || errno == EEXIST;
+}
+} // namespace NEO
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+intptr_t CompilerCache::tryLockFile(const std::string &lockPath) {
+    auto handle = CreateFileA(lockPath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return invalidLock;
+    }
+    OVERLAPPED overlapped = {};
+    if (!LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        CloseHandle(handle);
+        return invalidLock;
+    }
+    return reinterpret_cast<intptr_t>(handle);
+}
+
+void CompilerCache::unlockFile(intptr_t lock) {
+    auto handle = reinterpret_cast<HANDLE>(lock);
+    OVERLAPPED overlapped = {};
+    UnlockFileEx(handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+    CloseHandle(handle);
+}
+
+bool CompilerCache::replaceFile(const std::string &sourcePath, const std::string &destinationPath) {
+    return MoveFileExA(sourcePath.c_str(), destinationPath.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
+bool CompilerCache::getEntryInfo(const std::string &path, CacheEntry &entry) {
+    WIN32_FILE_ATTRIBUTE_DATA attributes = {};
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes) || (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        return false;
+    }
+    entry.path = path;
+    entry.lastAccessTime = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+    entry.size = static_cast<size_t>((static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow);
+    return true;
+}
+
+void CompilerCache::updateAccessTime(const std::string &path) {
+    auto handle = CreateFileA(path.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    FILETIME currentTime = {};
+    GetSystemTimeAsFileTime(&currentTime);
+    SetFileTime(handle, nullptr, nullptr, &currentTime);
+    CloseHandle(handle);
+}
+
+uint32_t CompilerCache::getProcessId() {
+    return static_cast<uint32_t>(GetCurrentProcessId());
+}
+
+bool CompilerCache::createDirectory(const std::string &path) {
+    return CreateDirectoryA(path.c_str(), nullptr) != 0 || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+} // namespace NEO
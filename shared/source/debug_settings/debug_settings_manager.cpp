@@ -75,7 +75,7 @@ void DebugSettingsManager<DebugLevel>::dumpFlags() const {
     settingsDumpFile << getNonReleaseKeyName(#variableName) << " = " << flags.variableName.get() << '\n'; \
     dumpNonDefaultFlag<dataType>(getNonReleaseKeyName(#variableName), flags.variableName.get(), defaultValue);
 
-    if (registryReadAvailable() || isDebugKeysReadEnabled()) {
+    if (!debugVariablesConstant() && (registryReadAvailable() || isDebugKeysReadEnabled())) {
 #include "debug_variables.inl"
     }
 #undef DECLARE_DEBUG_VARIABLE
@@ -96,7 +96,7 @@ void DebugSettingsManager<DebugLevel>::injectSettingsFromReader() {
         flags.variableName.set(tempData);                                                                          \
     }
 
-    if (registryReadAvailable() || isDebugKeysReadEnabled()) {
+    if (!debugVariablesConstant() && (registryReadAvailable() || isDebugKeysReadEnabled())) {
 #include "debug_variables.inl"
     }
 
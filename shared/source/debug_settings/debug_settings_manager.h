@@ -28,6 +28,12 @@ constexpr DebugFunctionalityLevel globalDebugFunctionalityLevel = DebugFunctiona
 constexpr DebugFunctionalityLevel globalDebugFunctionalityLevel = DebugFunctionalityLevel::None;
 #endif
 
+#if !defined(NEO_CONSTANT_DEBUG_VARIABLES)
+#define NEO_CONSTANT_DEBUG_VARIABLES 0
+#endif
+static_assert(!NEO_CONSTANT_DEBUG_VARIABLES || globalDebugFunctionalityLevel == DebugFunctionalityLevel::None,
+              "constant debug variables are supported only in release builds");
+
 #define PRINT_DEBUG_STRING(flag, ...) \
     if (flag)                         \
         NEO::printDebugString(flag, __VA_ARGS__);
@@ -74,9 +80,22 @@ struct DebugVariables {
         constexpr static int32_t DUMP_ELF{1 << 10};
     };
 
+#if NEO_CONSTANT_DEBUG_VARIABLES
+// debug only variables always hold default value, so reads are folded by compiler and writes are dropped
+#define DECLARE_DEBUG_VARIABLE(dataType, variableName, defaultValue, description) \
+    struct variableName##Constant {                                               \
+        static dataType get() { return defaultValue; }                            \
+        static void set(dataType) {}                                              \
+    } variableName;
+#else
 #define DECLARE_DEBUG_VARIABLE(dataType, variableName, defaultValue, description) \
     DebugVarBase<dataType> variableName{defaultValue};
+#endif
 #include "debug_variables.inl"
+#undef DECLARE_DEBUG_VARIABLE
+
+#define DECLARE_DEBUG_VARIABLE(dataType, variableName, defaultValue, description) \
+    DebugVarBase<dataType> variableName{defaultValue};
 #include "release_variables.inl"
 #undef DECLARE_DEBUG_VARIABLE
 };
@@ -98,6 +117,10 @@ class DebugSettingsManager {
         return DebugLevel == DebugFunctionalityLevel::None;
     }
 
+    static constexpr bool debugVariablesConstant() {
+        return disabled() && NEO_CONSTANT_DEBUG_VARIABLES;
+    }
+
     void getHardwareInfoOverride(std::string &hwInfoConfig);
 
     void injectSettingsFromReader();
@@ -25,6 +25,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpAsyncWrite, -1, "Write AUB file from background thread in large chunks instead of on submitting thread, -1:default(disabled), 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpSkipUnchangedAllocations, -1, "Do not write allocation to AUB again when its size and content hash did not change since last write, -1:default(disabled), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
@@ -67,10 +69,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableExperimentalCommandBuffer, 0, "Enables inj
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideStatelessMocsIndex, -1, "-1: feature inactive, >=0 : following MOCS index will be programmed for stateless accesses in state base address")
 DECLARE_DEBUG_VARIABLE(int32_t, CFEFusedEUDispatch, -1, "Set Fused EU dispatch in FrontEnd State command. -1 - default, 0 - enabled, 1 - disabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceAuxTranslationMode, -1, "-1: Default, 0: None, 1: Builtin, 2: Blit")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyAuxTranslation, -1, "-1: default (disabled), 0: disabled, 1: enabled, in-order queue keeps buffers decompressed after builtin aux translation until other operation requires them compressed")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchAuxTableUpdates, -1, "-1: default (disabled), 0: disabled, 1: enabled, AUX table mappings are queued and applied on next submission")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideGpuAddressSpace, -1, "-1: Default, !=-1: GPU address space range in bits")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxWorkgroupSize, -1, "-1: Default, !=-1: Overrides max worgkroup size to this value")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnReadBuffer, -1, "-1: default 0: do not use CPU copy, 1: triggers CPU copy path for Read Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnWriteBuffer, -1, "-1: default 0: do not use CPU copy, 1: triggers CPU copy path for Write Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyParallelThreshold, -1, "-1: default, >=0: size in bytes above which CPU copies of buffer transfers are split across multiple threads")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyNonTemporalThreshold, -1, "-1: default, >=0: size in bytes above which CPU copies of buffer transfers use non-temporal stores")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnEnqueue, -1, "-1: default, -2: always, x: pause on enqueue number x and ask for user confirmation before and after execution, counted from 0")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnBlitCopy, -1, "-1: default, -2: always, x: pause on blit enqueue number x and ask for user confirmation before and after execution, counted from 0. Note that single blit enqueue may have multiple copy instructions")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnGpuMode, -1, "-1: default (before and after), 0: before only, 1: after only")
@@ -80,6 +86,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, LimitBlitterMaxHeight, -1, "-1: default, >=0: Ma
 DECLARE_DEBUG_VARIABLE(int32_t, PostBlitCommand, -1, "-1: default, 0: MI_ARB_CHECK, 1: MI_FLUSH, 2: Nothing")
 DECLARE_DEBUG_VARIABLE(int32_t, OverridePreemptionSurfaceSizeInMb, -1, "-1: default, >=0 Override preemption surface size with value")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideLeastOccupiedBank, -1, "-1: default,  >=0 Override least occupied bank with value")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideBankPlacementPolicy, -1, "-1: default, 0: least occupied bank, 1: least accessed bank, 2: interleave large allocations across banks")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideQueuePlacementPolicy, -1, "-1: default, 0: default engine, 1: round-robin across engines of queue engine group, 2: engine with least tasks in flight")
+DECLARE_DEBUG_VARIABLE(int64_t, BankInterleaveChunkSize, -1, "-1: default - 64KB, >0: size of chunks used when interleaving allocations across banks")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideRevision, -1, "-1: default,  >=0: Revision id")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceCacheFlushForBcs, -1, "Force cache flush from gpgpu engine before dispatching BCS copy. -1: default,  1: enabled, 0: disabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceGpgpuSubmissionForBcsEnqueue, -1, "-1: Default, 1: Submit gpgpu command buffer with cache flushing and completion synchronization, 0: Do nothing, if possible")
@@ -89,6 +98,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, MediaVfeStateMaxSubSlices, -1, ">=0: Programs Me
 DECLARE_DEBUG_VARIABLE(int32_t, EnableMockSourceLevelDebugger, 0, "Switches driver to mode with active debugger. Active modes: 1: opt-disabled, 2: opt-enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceBtpPrefetchMode, -1, "-1: default, 0: disable, 1: enable, Enables Btp prefetching")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPointerImport, -1, "-1: default - disabled, 0: disabled, 1: enabled, Experimental implementation to import Host Pointer into L0")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImplicitHostPointerImport, -1, "-1: default - disabled, 0: disabled, 1: enabled, Import non-USM host pointers used by L0 command lists into driver wide cache instead of per command list allocations, released with zexDriverReleaseImportedPointer or at driver teardown")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideProfilingTimerResolution, -1, "-1: default - disabled, 0<=: Override deviceInfo.profilingTimerResolution")
 DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteAfterWalker, -1, "-1: disabled, x: add GPU scratch register write after x walker")
 DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteRegisterOffset, 0, "register offset for GPU scratch register write after walker")
@@ -124,6 +134,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch pa
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
 DECLARE_DEBUG_VARIABLE(bool, PrintRelocations, false, "prints relocations debug information")
 DECLARE_DEBUG_VARIABLE(bool, PrintTimestampPacketContents, false, "prints all timestamps values during profiling data calculation")
+DECLARE_DEBUG_VARIABLE(bool, PrintCompressionStatistics, false, "prints stateful, stateless and CPU access counts of compressed buffer allocations when they are freed")
 DECLARE_DEBUG_VARIABLE(bool, WddmResidencyLogger, false, "gather Wddm residency statistics to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOCreateDestroyResult, false, "tracks the result of creation and destruction of BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOBindingResult, false, "tracks the result of binding and unbinding of BOs")
@@ -132,6 +143,7 @@ DECLARE_DEBUG_VARIABLE(bool, ProvideVerboseImplicitFlush, false, "provides verbo
 DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispatch details")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlTimes, false, "Print ioctl times")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlEntries, false, "Print ioctl being called")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintMemoryUsageStatistics, -1, "-1: default - disabled, >0: print per allocation type and memory pool usage counters every N-th tracked allocation and on memory manager destruction")
 
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
@@ -147,10 +159,14 @@ DECLARE_DEBUG_VARIABLE(bool, DisableStatelessToStatefulOptimization, false, "Dis
 DECLARE_DEBUG_VARIABLE(bool, DisableConcurrentBlockExecution, false, "disables concurrent block kernel execution")
 DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passes flag to KMD that informs KMD to not emit any ring buffer flushes.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active all buffer allocations created with CL_MEM_USE_HOST_PTR flag will not share memory with CPU.")
+DECLARE_DEBUG_VARIABLE(bool, AllowZeroCopyForMisalignedUseHostPtr, false, "When active, buffers created with CL_MEM_USE_HOST_PTR share memory with CPU also when host pointer or size is not aligned to cache line.")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrTracking, -1, "Enable host ptr tracking: -1 - default platform setting, 0 - disabled, 1 - enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, MaxHwThreadsPercent, 0, "If not zero then maximum number of used HW threads is capped to max * MaxHwThreadsPercent / 100")
 DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then maximum number of used HW threads is reduced by MinHwThreadsUnoccupied")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater than 0, driver performs implicit flush every N submissions.")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchFlushDeadline, -1, "-1: default - disabled, >0: in batched dispatch mode flush pending submissions when the oldest one waits longer than given time in microseconds, checked on each submission")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandBuffers, -1, "-1: default - disabled, >0: in batched dispatch mode flush pending submissions when given number of command buffers is pending")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxSurfaces, -1, "-1: default - disabled, >0: in batched dispatch mode flush pending submissions when given number of allocations is used by pending command buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
 
@@ -171,7 +187,12 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideComputeSupport, -1, "Ove
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableCacheFlush, -1, "-1: driver default, 0: additional cache flush is present 1: disable dispatching cache flush commands")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionNewResourceTlbFlush, -1, "-1: driver default - flush when new resource is bound, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, true, "Evict USM allocation after implicit migration to GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmMigrationBlockSize, -1, "-1: default - migrate whole shared allocation on CPU page fault, >0: track CPU access and migrate shared allocations in blocks of given size in KB, aligned to page size")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmMigrationPrefetchBlocks, -1, "-1: default - 0, >0: number of blocks following the faulting block migrated to CPU together with it, used with UsmMigrationBlockSize")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableMonitorFence, -1, "Disable dispatching monitor fence commands")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionIdleTimeout, -1, "-1: default - 5000, 0: keep ring buffer running until destruction, >0: time in microseconds without submissions after which ring buffer is stopped, it is restarted on next submission")
+DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintStatistics, false, "Print ring buffer stops, restarts and average submit latency on direct submission destruction")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionCoalesceSubmissions, -1, "-1: default - disabled, 0: disabled, 1: use batched dispatch with render direct submission, so aggregated submissions are dispatched to ring buffer together with single semaphore update")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -190,18 +211,34 @@ DECLARE_DEBUG_VARIABLE(bool, EnableFreeMemory, false, "Enable freeMemory in memo
 DECLARE_DEBUG_VARIABLE(bool, ForceSamplerLowFilteringPrecision, false, "Force Low Filtering Precision Sampler mode")
 DECLARE_DEBUG_VARIABLE(bool, EngineInstancedSubDevices, false, "Create subdevices assigned to specific engine")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
+DECLARE_DEBUG_VARIABLE(std::string, KernelTuningDatabaseDir, std::string("unk"), "Directory of on-disk database with full kernel tunning outcomes, used when EnableKernelTunning=2, unk:default(disabled)")
+DECLARE_DEBUG_VARIABLE(std::string, DrmQueryCacheDir, std::string("unk"), "Directory of hardware query cache used when EnableDrmQueryCache=1, unk:default($XDG_RUNTIME_DIR/neo_drm_query_cache)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerThreadsCount, -1, "-1: default - 1 thread, >0: number of gem close worker threads, limited to 16")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferredDeleterThreadsCount, -1, "-1: default - 1 thread, >0: number of deferred deleter threads, limited to 8")
+DECLARE_DEBUG_VARIABLE(int64_t, HostPtrStagingBufferSize, -1, "-1: default - disabled, >0: read and write buffer transfers from host pointers up to this size are staged through pre-pinned buffers of this size")
+DECLARE_DEBUG_VARIABLE(int32_t, HostPtrStagingBuffersCount, -1, "-1: default - 4, >0: number of staging buffers per command stream receiver")
+DECLARE_DEBUG_VARIABLE(int64_t, BufferObjectReuseCacheSize, -1, "-1: default (disabled), >0: keep freed userptr buffer objects with their GPU VA ranges for reuse, up to given total size in bytes")
+DECLARE_DEBUG_VARIABLE(int64_t, LocalMemoryEvictionBudget, -1, "-1: default (disabled), 0: evict least recently used idle local memory allocations to system memory when reported local memory size is exceeded, >0: same with given budget in bytes")
+DECLARE_DEBUG_VARIABLE(int64_t, UsmHostHugePageThreshold, -1, "-1: default (disabled), >=0: back host USM allocations of at least given size in bytes with 2MB aligned huge pages and 2MB aligned GPU VA")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmNumaPlacement, -1, "-1: default (enabled), 0: disabled, 1: enabled - prefer NUMA node closest to the root device for host and shared USM allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideUsmNumaNode, -1, "-1: default (NUMA node of the root device PCI device), >=0: bind host and shared USM allocations to given NUMA node")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueOperations, -1, "Use Blitter engine for enqueue operations. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, BlitterEnqueueSizeThreshold, -1, "-1: default, >=0: buffer transfers of at least this many bytes use Blitter engine when available, smaller ones use EUs")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForReadWriteImage, -1, "Use Blitter engine for read/write image operations. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalker, -1, "-1: platform behavior, 0: disabled, 1: enabled. Adds dedicated cache flush command after WALKER command when surfaces used by kernel require to flush the cache")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemory, -1, "-1: default behavior, 0: disabled, 1: enabled, Allows allocating graphics memory in Local Memory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-1: dont override, 0: disable, 1: enable, Enables buffer-offset improvement of the stateless to stateful optimization")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableVaLibCalls, -1, "-1: default, 0: disable, 1: enable cl-va sharing lib calls")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableVaSurfaceImportCache, -1, "-1: default - disabled, 0: disable, 1: enable reusing imported cl-va surface allocations within context")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGlGpuSyncRelease, -1, "-1: default - enabled when supported, 0: disable, 1: enable GL context waiting on GPU for objects released by clEnqueueReleaseGLObjects instead of host side finish")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleRootDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) devices during initialization.")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelRootDeviceInitialization, -1, "-1: default - enabled, 0: initialize os interfaces of root devices sequentially, 1: initialize them in parallel")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDrmQueryCache, -1, "-1: default - disabled, 0: disabled, 1: reuse hardware query results of previous processes started within the same boot")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleSubDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) sub devices during initialization.")
 DECLARE_DEBUG_VARIABLE(int32_t, LimitAmountOfReturnedDevices, 0, "0: default - disable, 1+: Driver will limit the number of devices returned from clGetDeviceIds to N.")
 DECLARE_DEBUG_VARIABLE(int32_t, Enable64kbpages, -1, "-1: default behaviour, 0 Disables, 1 Enables support for 64KB pages for driver allocated fine grain svm buffers")
@@ -211,10 +248,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleep, -1, "-1: dont overr
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideQuickKmdSleepDelayMicroseconds, -1, "-1: dont override, 0: infinite timeout, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1, "-1: dont override, 0: disable, 1: enable. It works only when QuickKmdSleep is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: dont override, >0: timeout in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveKmdNotify, -1, "-1: default, 0: disable, 1: enable. Pick KMD notify spin timeout from history of previous waits on given CSR")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveKmdNotifySpinBudgetMicroseconds, -1, "-1: use KMD notify delay, >=0: maximum spin time in microseconds used by adaptive KMD notify")
 DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whenever driver waits on GPU and its not ready, put waiting thread to sleep and wait for notification.")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedBuffersEnabled, -1, "-1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int64_t, BufferCompressionHeuristicThreshold, -1, "-1: default (disabled), >=0: read-write buffers and device USM allocations of at least this size are render compressed, stateless kernel accesses resolve them with aux translation")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedSystemUsmSupport, -1, "-1: default, 0: shared system memory disabled, 1: shared system memory enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnablePassInlineData, -1, "-1: default, 0: Do not allow to pass inline data 1: Enable passing of inline data")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceFineGrainedSVMSupport, -1, "-1: default, 0: Do not report Fine Grained SVM capabilties 1: Report SVM Fine Grained capabilities if device supports SVM")
@@ -225,8 +265,48 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseBindlessMode, -1, "Use precompiled builtins i
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmSize, -1, "Force different slm size than default in kB")
 DECLARE_DEBUG_VARIABLE(int32_t, UseCyclesPerSecondTimer, 0, "0: default behavior, 0: disabled: Report L0 timer in nanosecond units, 1: enabled: Report L0 timer in cycles per second")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitLoopCount, -1, "-1: use default, >=0: number of iterations in wait loop")
+DECLARE_DEBUG_VARIABLE(int32_t, HostWaitPolicy, -1, "-1: use default, 0: spin, 1: spin then wait with umwait when supported and sleep. Used by L0 event and fence host synchronization")
+DECLARE_DEBUG_VARIABLE(int32_t, HostWaitSpinMicroseconds, -1, "-1: use default, >=0: time in microseconds spent spinning before HostWaitPolicy switches to lower power wait")
+DECLARE_DEBUG_VARIABLE(int32_t, EventPoolAllocationsCacheSize, -1, "-1: default (disabled), 0: disabled, >0: number of event pool allocations kept by driver for reuse")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceLocalEventPool, -1, "-1: default (disabled), 0: disabled, 1: event pools without host visible flag created for single device are placed in device local memory, host accesses them through CPU mapping")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIpcImportCache, -1, "-1: default (disabled), 0: disabled, 1: closed IPC memory handles stay imported in context and are reused by next open of same buffer, imported buffer is kept alive until context is destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableRepeatedIndirectDispatch, -1, "-1: default (enabled), 0: disabled, 1: enabled, consecutive entries of the same kernel in appendLaunchMultipleKernelsIndirect reuse states of previous walker")
+DECLARE_DEBUG_VARIABLE(int32_t, ReuseDrmExecObjects, -1, "-1: default (enabled), 0: disabled, 1: enabled, exec objects filled for previous submission are reused for the same buffer objects")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWddmHwQueues, -1, "-1: default (enabled when KMD reports support), 0: disabled, 1: enabled, submit through WDDM hardware queues and their progress fences instead of legacy context submission")
+DECLARE_DEBUG_VARIABLE(int32_t, SelectLeastLoadedEngineForCommandQueue, -1, "-1: default (disabled), 0: disabled, 1: enabled, L0 command queues created without ZE_COMMAND_QUEUE_FLAG_EXPLICIT_ONLY use engine of requested group with least work in flight")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSubmissionGpuTimestamps, -1, "Write GPU timestamps around every batch buffer of immediate dispatch CSR and record GPU busy and queueing delay in submission latency counters, -1:default(disabled), 1:enable")
+DECLARE_DEBUG_VARIABLE(int64_t, LockedMappingCacheSize, -1, "-1: default (disabled), >0: keep CPU mappings of unlocked buffer objects for next lock, up to given total size in bytes")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterStagingForLocalMemoryReads, -1, "-1: default, 0: disable, 1: enable. Reads from local memory buffers are staged by blitter copy into system memory instead of CPU reads through uncached mapping")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeCorrelationRefreshPeriodMs, -1, "-1: default (100ms), 0: read GPU timestamp for every profiled submission, >0: period in ms after which CPU to GPU time correlation used for submit timestamps is refreshed")
+DECLARE_DEBUG_VARIABLE(int64_t, LocalMemoryLargePageThreshold, -1, "-1: default (disabled), >=0: size of device pool buffers of at least given size in bytes is aligned to 2MB, so with 2MB aligned GPU VA they can be mapped with 2MB GPU pages")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableScratchSpacePool, -1, "-1: default (disabled), 0: disabled, 1: enabled, command stream receivers of root device share scratch allocations through device level pool")
+DECLARE_DEBUG_VARIABLE(int32_t, ScratchSpacePoolSizeLimit, -1, "-1: default (no limit), >=0: max size in bytes of idle scratch allocations kept in device scratch pool")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableFlushTaskSubmission, -1, "-1: default (disabled), 0: disabled, 1: enabled, L0 immediate command lists are submitted directly with command stream receiver flush task")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchKernelTemplate, -1, "-1: default (enabled), 0: disabled, 1: enabled, L0 kernels reuse interface descriptor and walker encoded at previous dispatch")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderDependencyElision, -1, "-1: default (disabled), 0: disabled, 1: enabled, in-order queue skips semaphores for dependencies on the same CSR and stalls on next flush instead")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableOoqMultiEngineDispatch, -1, "-1: default (disabled), 0: disabled, 1: enabled, out-of-order queue dispatches independent kernels to all engines of its engine group")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImplicitScaling, -1, "-1: default (disabled), 0: disabled, 1: enabled, root device queue splits workgroups of single kernel between sub-devices")
+DECLARE_DEBUG_VARIABLE(int32_t, ProgramBuildWorkersCount, -1, "-1: default (up to 8), >0: max number of threads compiling and processing device binaries of program builds")
+DECLARE_DEBUG_VARIABLE(int32_t, DriverWorkerPoolSize, -1, "-1: default (ProgramBuildWorkersCount or up to 8), >0: max number of threads of driver worker pool shared by program builds and event callbacks")
+DECLARE_DEBUG_VARIABLE(int64_t, DriverWorkerPoolCpuAffinityMask, -1, "-1: default (no affinity), >0: mask of CPUs threads of driver worker pool are allowed to run on")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTileLocalResidency, -1, "-1: default (disabled), 0: disabled, 1: enabled, local memory allocation of sub-device is bound and made resident only in VMs of tiles it was allocated for")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableQueueThrottlePolicy, -1, "-1: default (disabled), 0: disabled, 1: enabled, OpenCL queue with high throttle flushes every enqueue and polls for completion, low throttle waits in power saving mode")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncProgramBuild, -1, "-1: default (disabled), 0: disabled, 1: enabled, clBuildProgram with notify callback and SPIR-V zeModuleCreate return before build is finished, build runs on driver worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncPrintf, -1, "-1: default (disabled), 0: disabled, 1: enabled, enqueue of kernel using printf does not wait for completion, output is printed by background thread and printf buffers are reused")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelIsaAllocation, -1, "-1: default (disabled), 0: disabled, 1: enabled, ISA of user module kernel is allocated and uploaded on first zeKernelCreate")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncBuiltinsInit, -1, "-1: default (disabled), 0: disabled, 1: enabled, L0 builtin kernels are created on driver worker thread right after device creation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelIsaDeduplication, -1, "-1: default (disabled), 0: disabled, 1: enabled, kernels with identical ISA and no instruction relocations share one ISA allocation per device")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIndirectDataReuse, -1, "-1: default (disabled), 0: disabled, 1: enabled, repeated launch with unchanged cross thread data and local work size points walker at indirect data uploaded previously")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHeapStateDeduplication, -1, "-1: default (disabled), 0: disabled, 1: enabled, sampler states and surface states identical to ones already copied to current heap are referenced instead of copied again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalWorkSizeTuning, -1, "Try few local work sizes on first launches with NULL local size and use the fastest one, -1:default(disabled), 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableApiLatencyHistograms, -1, "Count calls and log2 latency histograms of API functions per thread, dumped to ApiLatencyHistograms.csv at exit, -1:default(disabled), 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableRuntimeTracing, -1, "Trace host intervals of runtime internals and GPU execution of profiled events, dumped to runtime_trace.json in Chrome trace format at exit, -1:default(disabled), 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GpuProgressWatchdogTimeout, -1, "Report submission when tag of its engine does not progress for given time in milliseconds, -1:default(disabled), >0:timeout")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSubmissionLatencyCounters, -1, "Collect log2 histograms of state programming, residency, submit, submit to GPU start and CSR ownership wait times per CSR, printed at CSR destruction, -1:default(disabled), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, GTPinAllocateBufferInSharedMemory, -1, "Force GTPin to allocate buffer in shared memory")
+DECLARE_DEBUG_VARIABLE(int32_t, GTPinPoolBuffers, -1, "-1: default (disabled), 0: disabled, 1: enabled, buffers freed by GTPin are pooled per context and reused once GPU completed their last use")
 DECLARE_DEBUG_VARIABLE(int32_t, AlignLocalMemoryVaTo2MB, -1, "Allow 2MB pages for allocations with size>=2MB. On Linux it means aligned VA, on Windows it means aligned size. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmAllocationPooling, -1, "-1: default (disabled), 0: disabled, 1: enabled. Sub-allocate small device and host USM allocations from pooled 2MB chunks")
 
 /*DRIVER TOGGLES*/
 DECLARE_DEBUG_VARIABLE(int32_t, ForceOCLVersion, 0, "Force specific OpenCL API version")
@@ -245,12 +325,23 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceUserptrAlignment, -1, "-1: no force (4kb),
 DECLARE_DEBUG_VARIABLE(int32_t, PreferCopyEngineForCopyBufferToBuffer, -1, "-1: default, 0: prefer EUs, 1: prefer blitter")
 DECLARE_DEBUG_VARIABLE(int64_t, ForceSystemMemoryPlacement, 0, "0: default,  >0: (bitmask) for given Graphics Allocation Type, force system memory placement")
 DECLARE_DEBUG_VARIABLE(int64_t, ForceNonSystemMemoryPlacement, 0, "0: default,  >0: (bitmask) for given Graphics Allocation Type, force non-system memory placement")
+DECLARE_DEBUG_VARIABLE(int64_t, UseBestFitHeapAllocator, 0, "0: default, >0: (bitmask) for given HeapIndex, use best-fit GPU VA allocator with O(log n) allocate and free instead of HeapAllocator")
 DECLARE_DEBUG_VARIABLE(int64_t, DisableIndirectAccess, -1, "0: default,  0: Use indirect access settings provided by application, 1: Disable indirect access and ignore settings provided by application")
 DECLARE_DEBUG_VARIABLE(int32_t, UseVmBind, -1, "Use new residency model on Linux (requires kernel support), -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, PassBoundBOToExec, -1, "Pass bound BOs to exec call to keep dependencies")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStaticPartitioning, -1, "Divide workload into partitions during dispatch, -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, UpdateTaskCountFromWait, -1, " Do not update task count after each enqueue, but send update request while wait, -1: default(disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferOsContextInitialization, -1, "-1: default, 0: create all contexts immediately, 1: defer, if possible")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferDeviceEngineInitialization, -1, "-1: default, 0: initialize engines with device, 1: initialize default engines on first context creation and other engines on first lookup")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferPreemptionAllocationCreation, -1, "-1: default, 0: create preemption allocation with engine, 1: create preemption allocation on first submission to engine")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHighPriorityEngine, -1, "-1: default (disabled), 0: disabled, 1: enabled, create high priority context on default engine for high priority queues")
+DECLARE_DEBUG_VARIABLE(int32_t, CoalesceCompletionWaits, -1, "-1: default (disabled), 0: disabled, 1: enabled, concurrent blocking waits on the same CSR sleep behind single waiter covering their task count")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableFastProcessExit, -1, "-1: default (disabled), 0: disabled, 1: enabled, at process exit wait for engines and skip destruction of driver objects when HW CSR without debugger and direct submission is used")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableL0ModuleCaching, -1, "-1: default (disabled), 0: disabled, 1: enabled, L0 modules built from SPIR-V are stored in compiler cache, keyed also by specialization constants")
+DECLARE_DEBUG_VARIABLE(int32_t, CacheImageGmmLayouts, -1, "-1: default (disabled), 0: disabled, 1: enabled, image GMM resource info is copied from cached one created with identical parameters")
+DECLARE_DEBUG_VARIABLE(int32_t, CreateMinimalEngineSet, -1, "-1: default (disabled), 0: disabled, 1: enabled, device creates only default, high priority, copy and internal engines, lookups of other compute engines return default engine")
+DECLARE_DEBUG_VARIABLE(int32_t, TrustCachedDeviceBinaries, -1, "-1: default (disabled), 0: disabled, 1: enabled, device binaries loaded from compiler cache are decoded without validation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedModuleUpload, -1, "-1: default (disabled), 0: disabled, 1: enabled, initial ISA and global surfaces of module in local memory are uploaded with single copy engine submission")
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU tiemstamps instead of calculated ones.")
 DECLARE_DEBUG_VARIABLE(bool, ForcePerDssBackedBufferProgramming, false, "Always program per-DSS memory backed buffer in preamble")
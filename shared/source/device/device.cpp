@@ -12,6 +12,7 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/driver_info.h"
@@ -21,6 +22,8 @@
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 decltype(&PerformanceCounters::create) Device::createPerformanceCountersFunc = PerformanceCounters::create;
@@ -156,9 +159,12 @@ bool Device::createDeviceImpl() {
 
     getDefaultEngine().osContext->setDefaultContext(true);
 
-    for (auto &engine : engines) {
-        auto commandStreamReceiver = engine.commandStreamReceiver;
-        auto osContext = engine.osContext;
+    for (auto engineIndex = 0u; engineIndex < engines.size(); engineIndex++) {
+        if (std::find(deferredEngineIndices.begin(), deferredEngineIndices.end(), engineIndex) != deferredEngineIndices.end()) {
+            continue;
+        }
+        auto commandStreamReceiver = engines[engineIndex].commandStreamReceiver;
+        auto osContext = engines[engineIndex].osContext;
         if (!commandStreamReceiver->initDirectSubmission(*this, *osContext)) {
             return false;
         }
@@ -209,6 +215,25 @@ bool Device::createDeviceImpl() {
 bool Device::createEngines() {
     auto &hwInfo = getHardwareInfo();
     auto gpgpuEngines = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getGpgpuEngineInstances(hwInfo);
+    if (isHighPriorityEngineEnabled()) {
+        gpgpuEngines.push_back({getChosenEngineType(hwInfo), EngineUsage::HighPriority});
+    }
+    if (isMinimalEngineSetEnabled()) {
+        const auto defaultEngineType = getChosenEngineType(hwInfo);
+        auto isRedundantEngine = [defaultEngineType](const EngineTypeUsage &engineTypeUsage) {
+            if (engineTypeUsage.second == EngineUsage::Internal || engineTypeUsage.second == EngineUsage::HighPriority || EngineHelpers::isBcs(engineTypeUsage.first)) {
+                return false;
+            }
+            return !(engineTypeUsage.first == defaultEngineType && engineTypeUsage.second == EngineUsage::Regular);
+        };
+        HwHelper::EngineInstancesContainer minimalEngines;
+        for (auto &engineTypeUsage : gpgpuEngines) {
+            if (!isRedundantEngine(engineTypeUsage)) {
+                minimalEngines.push_back(engineTypeUsage);
+            }
+        }
+        gpgpuEngines = minimalEngines;
+    }
 
     this->engineGroups.resize(static_cast<uint32_t>(EngineGroupType::MaxEngineGroups));
     for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < gpgpuEngines.size(); deviceCsrIndex++) {
@@ -262,21 +287,21 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
     }
 
     bool lowPriority = (engineTypeUsage.second == EngineUsage::LowPriority);
+    bool highPriority = (engineTypeUsage.second == EngineUsage::HighPriority);
     auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(commandStreamReceiver.get(),
                                                                                      engineTypeUsage,
                                                                                      getDeviceBitfield(),
-                                                                                     preemptionMode,
+                                                                                     PreemptionHelper::contextPreemptionMode(preemptionMode, engineUsage),
                                                                                      false);
     if (osContext->isImmediateContextInitializationEnabled(isDefaultEngine)) {
         osContext->ensureContextInitialized();
     }
     commandStreamReceiver->setupContext(*osContext);
 
-    if (!commandStreamReceiver->initializeTagAllocation()) {
-        return false;
-    }
-
-    if (!commandStreamReceiver->createGlobalFenceAllocation()) {
+    if (isEngineInitializationDeferred() && !internalUsage) {
+        deferredEngineIndices.push_back(static_cast<uint32_t>(engines.size()));
+        hasDeferredEngines = true;
+    } else if (!initializeEngineAllocations(*commandStreamReceiver)) {
         return false;
     }
 
@@ -284,13 +309,9 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
         defaultEngineIndex = deviceCsrIndex;
     }
 
-    if (preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
-        return false;
-    }
-
     EngineControl engine{commandStreamReceiver.get(), osContext};
     engines.push_back(engine);
-    if (!lowPriority && !internalUsage) {
+    if (!lowPriority && !highPriority && !internalUsage) {
         addEngineToEngineGroup(engine);
     }
 
@@ -299,6 +320,69 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
     return true;
 }
 
+bool Device::initializeEngineAllocations(CommandStreamReceiver &commandStreamReceiver) {
+    if (!commandStreamReceiver.initializeTagAllocation()) {
+        return false;
+    }
+
+    if (!commandStreamReceiver.createGlobalFenceAllocation()) {
+        return false;
+    }
+
+    if (preemptionMode == PreemptionMode::MidThread && !isPreemptionAllocationCreationDeferred() && !commandStreamReceiver.createPreemptionAllocation()) {
+        return false;
+    }
+    return true;
+}
+
+bool Device::isEngineInitializationDeferred() {
+    return DebugManager.flags.DeferDeviceEngineInitialization.get() == 1;
+}
+
+bool Device::isHighPriorityEngineEnabled() {
+    return DebugManager.flags.EnableHighPriorityEngine.get() == 1;
+}
+
+bool Device::isMinimalEngineSetEnabled() {
+    return DebugManager.flags.CreateMinimalEngineSet.get() == 1;
+}
+
+bool Device::isPreemptionAllocationCreationDeferred() {
+    return DebugManager.flags.DeferPreemptionAllocationCreation.get() == 1;
+}
+
+bool Device::ensureDefaultEnginesInitialized() {
+    for (auto subDevice : subdevices) {
+        if (subDevice && !subDevice->ensureDefaultEnginesInitialized()) {
+            return false;
+        }
+    }
+    return ensureEngineInitialized(getDefaultEngine());
+}
+
+bool Device::ensureEngineInitialized(const EngineControl &engine) {
+    if (!hasDeferredEngines.load()) {
+        return true;
+    }
+
+    // engines created with device only own CSR and OS context, allocations and direct submission are set up on first lookup
+    std::lock_guard<std::mutex> lock(deferredEnginesMutex);
+    for (auto it = deferredEngineIndices.begin(); it != deferredEngineIndices.end(); it++) {
+        auto &deferredEngine = engines[*it];
+        if (deferredEngine.commandStreamReceiver != engine.commandStreamReceiver) {
+            continue;
+        }
+        if (!initializeEngineAllocations(*deferredEngine.commandStreamReceiver) ||
+            !deferredEngine.commandStreamReceiver->initDirectSubmission(*this, *deferredEngine.osContext)) {
+            return false;
+        }
+        deferredEngineIndices.erase(it);
+        hasDeferredEngines = !deferredEngineIndices.empty();
+        break;
+    }
+    return true;
+}
+
 const HardwareInfo &Device::getHardwareInfo() const { return *getRootDeviceEnvironment().getHardwareInfo(); }
 
 const DeviceInfo &Device::getDeviceInfo() const {
@@ -379,18 +463,27 @@ EngineControl &Device::getEngine(aub_stream::EngineType engineType, EngineUsage
     for (auto &engine : engines) {
         if (engine.osContext->getEngineType() == engineType &&
             engine.osContext->isLowPriority() == (engineUsage == EngineUsage::LowPriority) &&
+            engine.osContext->isHighPriority() == (engineUsage == EngineUsage::HighPriority) &&
             engine.osContext->isInternalEngine() == (engineUsage == EngineUsage::Internal)) {
+            UNRECOVERABLE_IF(!ensureEngineInitialized(engine));
             return engine;
         }
     }
     if (DebugManager.flags.OverrideInvalidEngineWithDefault.get()) {
+        UNRECOVERABLE_IF(!ensureEngineInitialized(engines[0]));
         return engines[0];
     }
+    if (isMinimalEngineSetEnabled() && !EngineHelpers::isBcs(engineType)) {
+        auto &defaultEngine = getDefaultEngine();
+        UNRECOVERABLE_IF(!ensureEngineInitialized(defaultEngine));
+        return defaultEngine;
+    }
     UNRECOVERABLE_IF(true);
 }
 
 EngineControl &Device::getEngine(uint32_t index) {
     UNRECOVERABLE_IF(index >= engines.size());
+    UNRECOVERABLE_IF(!ensureEngineInitialized(engines[index]));
     return engines[index];
 }
 
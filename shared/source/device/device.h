@@ -15,12 +15,15 @@
 #include "shared/source/helpers/engine_control.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/local_ids_cache.h"
 #include "shared/source/program/sync_buffer_handler.h"
 
 #include "opencl/source/os_interface/performance_counters.h"
 
 #include "engine_group_types.h"
 
+#include <mutex>
+
 namespace NEO {
 class OSTime;
 class SourceLevelDebugger;
@@ -75,6 +78,12 @@ class Device : public ReferenceTrackedObject<Device> {
     Debugger *getDebugger() const { return getRootDeviceEnvironment().debugger.get(); }
     NEO::SourceLevelDebugger *getSourceLevelDebugger();
     const std::vector<EngineControl> &getEngines() const;
+    bool ensureEngineInitialized(const EngineControl &engine);
+    bool ensureDefaultEnginesInitialized();
+    static bool isEngineInitializationDeferred();
+    static bool isHighPriorityEngineEnabled();
+    static bool isMinimalEngineSetEnabled();
+    static bool isPreemptionAllocationCreationDeferred();
     const std::string getDeviceName(const HardwareInfo &hwInfo) const;
 
     ExecutionEnvironment *getExecutionEnvironment() const { return executionEnvironment; }
@@ -107,6 +116,7 @@ class Device : public ReferenceTrackedObject<Device> {
     virtual bool isSubDevice() const = 0;
 
     BindlessHeapsHelper *getBindlessHeapsHelper() const;
+    LocalIdsCache &getLocalIdsCache() const { return *localIdsCache; }
 
     static decltype(&PerformanceCounters::create) createPerformanceCountersFunc;
     std::unique_ptr<SyncBufferHandler> syncBufferHandler;
@@ -130,6 +140,7 @@ class Device : public ReferenceTrackedObject<Device> {
     virtual bool createEngines();
     void addEngineToEngineGroup(EngineControl &engine);
     bool createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsage);
+    bool initializeEngineAllocations(CommandStreamReceiver &commandStreamReceiver);
     MOCKABLE_VIRTUAL std::unique_ptr<CommandStreamReceiver> createCommandStreamReceiver() const;
     MOCKABLE_VIRTUAL SubDevice *createSubDevice(uint32_t subDeviceIndex);
     MOCKABLE_VIRTUAL SubDevice *createEngineInstancedSubDevice(uint32_t subDeviceIndex, aub_stream::EngineType engineType);
@@ -148,8 +159,10 @@ class Device : public ReferenceTrackedObject<Device> {
     std::unique_ptr<PerformanceCounters> performanceCounters;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     std::vector<EngineControl> engines;
+    std::vector<uint32_t> deferredEngineIndices;
     std::vector<std::vector<EngineControl>> engineGroups;
     std::vector<SubDevice *> subdevices;
+    std::unique_ptr<LocalIdsCache> localIdsCache = std::make_unique<LocalIdsCache>();
 
     PreemptionMode preemptionMode;
     ExecutionEnvironment *executionEnvironment = nullptr;
@@ -158,6 +171,8 @@ class Device : public ReferenceTrackedObject<Device> {
     bool hasGenericSubDevices = false;
 
     std::atomic<uint32_t> selectorCopyEngine{0};
+    std::mutex deferredEnginesMutex;
+    std::atomic<bool> hasDeferredEngines{false};
 
     DeviceBitfield deviceBitfield = 1;
 
@@ -49,11 +49,11 @@ DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(Progr
     NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(src.deviceBinary, decodedProgram);
     DBG_LOG(LogPatchTokens, NEO::PatchTokenBinary::asString(decodedProgram).c_str());
 
-    std::string validatorWarnings;
-    std::string validatorErrMessage;
-    auto validatorErr = PatchTokenBinary::validate(decodedProgram, outErrReason, outWarning);
-    if (DecodeError::Success != validatorErr) {
-        return validatorErr;
+    if ((false == src.trusted) || (DecodeError::Success != decodedProgram.decodeStatus)) {
+        auto validatorErr = PatchTokenBinary::validate(decodedProgram, outErrReason, outWarning);
+        if (DecodeError::Success != validatorErr) {
+            return validatorErr;
+        }
     }
 
     NEO::populateProgramInfo(dst, decodedProgram);
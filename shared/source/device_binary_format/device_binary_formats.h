@@ -67,6 +67,7 @@ struct SingleDeviceBinary {
     ArrayRef<const uint8_t> intermediateRepresentation;
     ConstStringRef buildOptions;
     TargetDevice targetDevice;
+    bool trusted = false; // produced and validated by this driver before, e.g. loaded from compiler cache
 };
 
 template <DeviceBinaryFormat Format>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include <cstring>
+
 namespace NEO {
 
 namespace Yaml {
@@ -112,6 +114,12 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         return true;
     }
 
+    // zeInfo of binaries with many kernels has hundreds of thousands of lines,
+    // reserving up front avoids regrowing caches while tokenizing
+    auto linesCount = countLines(text);
+    outLines.reserve(outLines.size() + linesCount);
+    outTokens.reserve(outTokens.size() + linesCount * estimatedTokensPerLine);
+
     TokenizerContext context{text};
     context.isParsingIdent = true;
 
@@ -136,12 +144,8 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::SingleCharacter));
             auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentEnd = reinterpret_cast<const char *>(memchr(commentIt, '\n', context.end - commentIt));
+            commentIt = (nullptr != commentEnd) ? commentEnd : context.end;
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::Comment));
             }
@@ -279,6 +283,7 @@ void finalizeNode(NodeId nodeId, const TokensCache &tokens, NodesCache &outNodes
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
     StackVec<NodeId, 64> nesting;
     size_t lineId = 0U;
+    outNodes.reserve(outNodes.size() + lines.size() + 1);
     outNodes.resize(1);
     outNodes.rbegin()->id = 0U;
     outNodes.rbegin()->firstChildId = 1U;
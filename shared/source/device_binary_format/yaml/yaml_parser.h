@@ -11,6 +11,7 @@
 #include "shared/source/utilities/const_stringref.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <algorithm>
 #include <iterator>
 #include <string>
 
@@ -239,6 +240,13 @@ static_assert(sizeof(Line) == 12, "");
 using TokensCache = StackVec<Token, 2048>;
 using LinesCache = StackVec<Line, 512>;
 
+// typical line is "key : value\n"
+constexpr size_t estimatedTokensPerLine = 4U;
+
+inline size_t countLines(ConstStringRef text) {
+    return static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + (((false == text.empty()) && ('\n' != text[text.size() - 1])) ? 1U : 0U);
+}
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason = nullptr);
 
 bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning);
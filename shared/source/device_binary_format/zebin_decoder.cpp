@@ -1028,9 +1028,11 @@ DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo
         return extractError;
     }
 
-    extractError = validateZebinSectionsCount(zebinSections, outErrReason, outWarning);
-    if (DecodeError::Success != extractError) {
-        return extractError;
+    if (false == src.trusted) {
+        extractError = validateZebinSectionsCount(zebinSections, outErrReason, outWarning);
+        if (DecodeError::Success != extractError) {
+            return extractError;
+        }
     }
 
     dst.decodedElf = elf;
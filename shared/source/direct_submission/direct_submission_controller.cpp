@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/direct_submission_controller.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+namespace NEO {
+
+DirectSubmissionController::DirectSubmissionController() : idleTimeout(getIdleTimeout()) {
+}
+
+DirectSubmissionController::~DirectSubmissionController() {
+    std::unique_lock<std::mutex> lock(directSubmissionsMutex);
+    keepControlling = false;
+    lock.unlock();
+    condition.notify_all();
+    if (directSubmissionControllingThread) {
+        directSubmissionControllingThread->join();
+        directSubmissionControllingThread.reset();
+    }
+}
+
+std::chrono::microseconds DirectSubmissionController::getIdleTimeout() {
+    int32_t timeout = defaultIdleTimeout;
+    if (DebugManager.flags.DirectSubmissionIdleTimeout.get() != -1) {
+        timeout = DebugManager.flags.DirectSubmissionIdleTimeout.get();
+    }
+    return std::chrono::microseconds(timeout);
+}
+
+void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver *csr) {
+    if (idleTimeout.count() <= 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+    directSubmissions.insert(csr);
+    // controlling thread is started with first direct submission and lives until controller destruction
+    if (!directSubmissionControllingThread) {
+        keepControlling = true;
+        directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
+    }
+}
+
+void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceiver *csr) {
+    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+    directSubmissions.erase(csr);
+}
+
+void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
+    auto controller = reinterpret_cast<DirectSubmissionController *>(self);
+    std::unique_lock<std::mutex> lock(controller->directSubmissionsMutex);
+    while (controller->keepControlling) {
+        controller->condition.wait_for(lock, controller->idleTimeout);
+        if (!controller->keepControlling) {
+            break;
+        }
+        controller->checkNewSubmissions(std::chrono::steady_clock::now());
+    }
+    return nullptr;
+}
+
+void DirectSubmissionController::checkNewSubmissions(std::chrono::steady_clock::time_point now) {
+    // called with directSubmissionsMutex acquired, csr ownership is only tried so submitting threads are never blocked
+    for (auto csr : directSubmissions) {
+        csr->stopDirectSubmissionIfIdle(now);
+    }
+}
+} // namespace NEO
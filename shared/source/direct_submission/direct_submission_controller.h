@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Thread;
+
+class DirectSubmissionController {
+  public:
+    DirectSubmissionController();
+    virtual ~DirectSubmissionController();
+
+    DirectSubmissionController(const DirectSubmissionController &) = delete;
+    DirectSubmissionController &operator=(const DirectSubmissionController &) = delete;
+
+    void registerDirectSubmission(CommandStreamReceiver *csr);
+    void unregisterDirectSubmission(CommandStreamReceiver *csr);
+
+    static constexpr int32_t defaultIdleTimeout = 5000;
+    static std::chrono::microseconds getIdleTimeout();
+
+  protected:
+    static void *controlDirectSubmissionsState(void *self);
+    MOCKABLE_VIRTUAL void checkNewSubmissions(std::chrono::steady_clock::time_point now);
+
+    std::unordered_set<CommandStreamReceiver *> directSubmissions;
+    std::mutex directSubmissionsMutex;
+    std::condition_variable condition;
+
+    std::unique_ptr<Thread> directSubmissionControllingThread;
+    std::atomic<bool> keepControlling{false};
+    const std::chrono::microseconds idleTimeout;
+};
+} // namespace NEO
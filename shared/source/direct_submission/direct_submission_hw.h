@@ -9,8 +9,10 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <chrono>
 #include <memory>
 
 namespace NEO {
@@ -65,6 +67,23 @@ class DirectSubmissionHw {
 
     bool dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp);
 
+    bool dispatchCommandBuffers(ArrayRef<BatchBuffer *> batchBuffers, FlushStampTracker &flushStamp);
+
+    bool stopRingBufferIfIdle(std::chrono::steady_clock::time_point now);
+
+    struct Statistics {
+        uint64_t submissions = 0u;
+        uint64_t ringStops = 0u;
+        uint64_t ringRestarts = 0u;
+        uint64_t coalescedBatchBuffers = 0u;
+        uint64_t totalSubmitLatencyNs = 0u;
+
+        uint64_t getAverageSubmitLatencyNs() const {
+            return submissions ? totalSubmitLatencyNs / submissions : 0u;
+        }
+    };
+    const Statistics &getStatistics() const { return statistics; }
+
     static std::unique_ptr<DirectSubmissionHw<GfxFamily, Dispatcher>> create(Device &device, OsContext &osContext);
 
   protected:
@@ -98,6 +117,8 @@ class DirectSubmissionHw {
     void setReturnAddress(void *returnCmd, uint64_t returnAddress);
 
     void *dispatchWorkloadSection(BatchBuffer &batchBuffer);
+    void dispatchChainedWorkloadSection(BatchBuffer &batchBuffer);
+    size_t getSizeChainedWorkloadSection();
     size_t getSizeDispatch();
 
     void dispatchPrefetchMitigation();
@@ -110,6 +131,8 @@ class DirectSubmissionHw {
 
     uint64_t getCommandBufferPositionGpuAddress(void *position);
 
+    void printStatistics();
+
     void createDiagnostic();
     void initDiagnostic(bool &submitOnInit);
     MOCKABLE_VIRTUAL void performDiagnosticMode();
@@ -125,6 +148,9 @@ class DirectSubmissionHw {
     LinearStream ringCommandStream;
     FlushStamp completionRingBuffers[RingBufferUse::MaxBuffers] = {0ull, 0ull};
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    Statistics statistics;
+    std::chrono::steady_clock::time_point lastDispatchTime;
+    std::chrono::microseconds idleTimeout{0};
 
     uint64_t semaphoreGpuVa = 0u;
 
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/direct_submission_hw_diagnostic_mode.h"
 #include "shared/source/helpers/flush_stamp.h"
@@ -20,7 +21,10 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/runtime_tracer.h"
 
+#include <cinttypes>
+#include <cstdio>
 #include <cstring>
 
 namespace NEO {
@@ -43,11 +47,16 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(Device &device,
         disableCpuCacheFlush = disableCacheFlushKey == 1 ? true : false;
     }
     hwInfo = &device.getHardwareInfo();
+    idleTimeout = DirectSubmissionController::getIdleTimeout();
     createDiagnostic();
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    if (DebugManager.flags.DirectSubmissionPrintStatistics.get()) {
+        printStatistics();
+    }
+}
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
@@ -163,6 +172,9 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::startRingBuffer() {
     dispatchSemaphoreSection(currentQueueWorkCount);
 
     ringStart = submit(gpuStartVa, startSize);
+    if (ringStart && statistics.ringStops > 0u) {
+        statistics.ringRestarts++;
+    }
 
     return ringStart;
 }
@@ -182,9 +194,28 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::stopRingBuffer() {
     semaphoreData->QueueWorkCount = currentQueueWorkCount;
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
 
+    if (ringStart) {
+        statistics.ringStops++;
+    }
+    ringStart = false;
+
     return true;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::stopRingBufferIfIdle(std::chrono::steady_clock::time_point now) {
+    if (!ringStart || idleTimeout.count() <= 0 || now - lastDispatchTime < idleTimeout) {
+        return false;
+    }
+    return stopRingBuffer();
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::printStatistics() {
+    printf("Direct submission: submissions %" PRIu64 ", ring stops %" PRIu64 ", ring restarts %" PRIu64 ", coalesced batch buffers %" PRIu64 ", average submit latency %" PRIu64 " ns\n",
+           statistics.submissions, statistics.ringStops, statistics.ringRestarts, statistics.coalescedBatchBuffers, statistics.getAverageSubmitLatencyNs());
+}
+
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreSection(uint32_t value) {
     using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
@@ -292,17 +323,31 @@ inline size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizePrefetchMitigati
 }
 
 template <typename GfxFamily, typename Dispatcher>
-void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBuffer &batchBuffer) {
-    void *currentPosition = ringCommandStream.getSpace(0);
+inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchChainedWorkloadSection(BatchBuffer &batchBuffer) {
+    auto commandStreamAddress = ptrOffset(batchBuffer.commandBufferAllocation->getGpuAddress(), batchBuffer.startOffset);
+    void *returnCmd = batchBuffer.endCmdPtr;
 
+    dispatchStartSection(commandStreamAddress);
+    void *returnPosition = ringCommandStream.getSpace(0);
+
+    setReturnAddress(returnCmd, getCommandBufferPositionGpuAddress(returnPosition));
+}
+
+template <typename GfxFamily, typename Dispatcher>
+inline size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizeChainedWorkloadSection() {
+    //diagnostic modes do not execute workloads, so there is nothing to chain
     if (workloadMode == 0) {
-        auto commandStreamAddress = ptrOffset(batchBuffer.commandBufferAllocation->getGpuAddress(), batchBuffer.startOffset);
-        void *returnCmd = batchBuffer.endCmdPtr;
+        return getSizeStartSection();
+    }
+    return 0u;
+}
 
-        dispatchStartSection(commandStreamAddress);
-        void *returnPosition = ringCommandStream.getSpace(0);
+template <typename GfxFamily, typename Dispatcher>
+void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBuffer &batchBuffer) {
+    void *currentPosition = ringCommandStream.getSpace(0);
 
-        setReturnAddress(returnCmd, getCommandBufferPositionGpuAddress(returnPosition));
+    if (workloadMode == 0) {
+        dispatchChainedWorkloadSection(batchBuffer);
     } else if (workloadMode == 1) {
         DirectSubmissionDiagnostics::diagnosticModeOneDispatch(diagnostic.get());
         dispatchDiagnosticModeSection();
@@ -325,24 +370,40 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
-    //for now workloads requiring cache coherency are not supported
-    UNRECOVERABLE_IF(batchBuffer.requiresCoherency);
+    BatchBuffer *batchBuffers[] = {&batchBuffer};
+    return dispatchCommandBuffers(batchBuffers, flushStamp);
+}
 
-    size_t dispatchSize = getSizeDispatch();
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffers(ArrayRef<BatchBuffer *> batchBuffers, FlushStampTracker &flushStamp) {
+    RUNTIME_TRACE_SCOPE("directSubmissionDispatch");
+    UNRECOVERABLE_IF(batchBuffers.size() == 0u);
+    for (auto batchBuffer : batchBuffers) {
+        //for now workloads requiring cache coherency are not supported
+        UNRECOVERABLE_IF(batchBuffer->requiresCoherency);
+    }
+
+    auto dispatchStartTime = std::chrono::steady_clock::now();
+    size_t dispatchSize = getSizeDispatch() + (batchBuffers.size() - 1) * getSizeChainedWorkloadSection();
     size_t cycleSize = getSizeSwitchRingBufferSection();
     size_t requiredMinimalSize = dispatchSize + cycleSize + getSizeEnd();
 
-    bool buffersSwitched = false;
-    uint64_t startGpuVa = getCommandBufferPositionGpuAddress(ringCommandStream.getSpace(0));
-
     if (ringCommandStream.getAvailableSpace() < requiredMinimalSize) {
-        startGpuVa = switchRingBuffers();
-        buffersSwitched = true;
+        switchRingBuffers();
     }
+    //not running ring does not jump to next buffer, so submission starts directly at current position
+    uint64_t startGpuVa = getCommandBufferPositionGpuAddress(ringCommandStream.getSpace(0));
 
     handleNewResourcesSubmission();
 
-    void *currentPosition = dispatchWorkloadSection(batchBuffer);
+    //all but last buffer return to start of next one, cache flush, monitor fence and semaphore are dispatched once
+    void *currentPosition = ringCommandStream.getSpace(0);
+    if (getSizeChainedWorkloadSection() > 0u) {
+        for (size_t i = 0; i < batchBuffers.size() - 1; i++) {
+            dispatchChainedWorkloadSection(*batchBuffers[i]);
+        }
+    }
+    dispatchWorkloadSection(*batchBuffers[batchBuffers.size() - 1]);
 
     if (ringStart) {
         cpuCachelineFlush(currentPosition, dispatchSize);
@@ -356,15 +417,19 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
     //when ring buffer is not started at init or being restarted
     if (!ringStart) {
-        size_t submitSize = dispatchSize;
-        if (buffersSwitched) {
-            submitSize = cycleSize;
+        ringStart = submit(startGpuVa, dispatchSize);
+        if (ringStart && statistics.ringStops > 0u) {
+            statistics.ringRestarts++;
         }
-        ringStart = submit(startGpuVa, submitSize);
     }
     uint64_t flushValue = updateTagValue();
     flushStamp.setStamp(flushValue);
 
+    lastDispatchTime = std::chrono::steady_clock::now();
+    statistics.submissions++;
+    statistics.coalescedBatchBuffers += batchBuffers.size() - 1;
+    statistics.totalSubmitLatencyNs += std::chrono::duration_cast<std::chrono::nanoseconds>(lastDispatchTime - dispatchStartTime).count();
+
     return ringStart;
 }
 
@@ -46,6 +46,10 @@ inline DrmDirectSubmission<GfxFamily, Dispatcher>::~DrmDirectSubmission() {
         this->wait(static_cast<uint32_t>(this->currentTagData.tagValue));
         auto bb = static_cast<DrmAllocation *>(this->ringBuffer)->getBO();
         bb->wait(-1);
+    } else if (this->statistics.ringStops > 0u) {
+        //ring stopped when idle may still be finishing last workload
+        auto bb = static_cast<DrmAllocation *>(this->ringCommandStream.getGraphicsAllocation())->getBO();
+        bb->wait(-1);
     }
     this->deallocateResources();
 }
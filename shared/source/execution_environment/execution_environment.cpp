@@ -9,19 +9,34 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/gpu_progress_watchdog.h"
+#include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/debugger/debugger.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/utilities/wait_util.h"
+#include "shared/source/utilities/worker_pool.h"
 
 namespace NEO {
+struct ExecutionEnvironment::CachedSipBinary {
+    SipKernelType type;
+    HardwareInfo hwInfo;
+    std::vector<char> sipBinary;
+    std::vector<char> stateSaveAreaHeader;
+};
+
 ExecutionEnvironment::ExecutionEnvironment() {
     WaitUtils::init();
 }
 
 ExecutionEnvironment::~ExecutionEnvironment() {
+    driverWorkerPool.reset();
+    directSubmissionController.reset();
+    gpuProgressWatchdog.reset();
     if (memoryManager) {
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -34,6 +49,88 @@ ExecutionEnvironment::~ExecutionEnvironment() {
     rootDeviceEnvironments.clear();
 }
 
+DirectSubmissionController *ExecutionEnvironment::getDirectSubmissionController() {
+    std::lock_guard<std::mutex> lock(initializeDirectSubmissionControllerMutex);
+    if (!directSubmissionController) {
+        directSubmissionController = std::make_unique<DirectSubmissionController>();
+    }
+    return directSubmissionController.get();
+}
+
+GpuProgressWatchdog *ExecutionEnvironment::getGpuProgressWatchdog() {
+    std::lock_guard<std::mutex> lock(initializeGpuProgressWatchdogMutex);
+    if (!gpuProgressWatchdog) {
+        gpuProgressWatchdog = std::make_unique<GpuProgressWatchdog>();
+    }
+    return gpuProgressWatchdog.get();
+}
+
+WorkerPool *ExecutionEnvironment::getDriverWorkerPool() {
+    std::lock_guard<std::mutex> lock(initializeDriverWorkerPoolMutex);
+    if (!driverWorkerPool) {
+        size_t workersCount = getBuildWorkersCount();
+        if (DebugManager.flags.DriverWorkerPoolSize.get() > 0) {
+            workersCount = static_cast<size_t>(DebugManager.flags.DriverWorkerPoolSize.get());
+        }
+        uint64_t cpuAffinityMask = 0u;
+        if (DebugManager.flags.DriverWorkerPoolCpuAffinityMask.get() > 0) {
+            cpuAffinityMask = static_cast<uint64_t>(DebugManager.flags.DriverWorkerPoolCpuAffinityMask.get());
+        }
+        driverWorkerPool = std::make_unique<WorkerPool>(workersCount, cpuAffinityMask);
+    }
+    return driverWorkerPool.get();
+}
+
+size_t ExecutionEnvironment::getBuildWorkersCount() {
+    if (DebugManager.flags.ProgramBuildWorkersCount.get() > 0) {
+        return static_cast<size_t>(DebugManager.flags.ProgramBuildWorkersCount.get());
+    }
+    return defaultBuildWorkersCount;
+}
+
+bool ExecutionEnvironment::prepareForFastExit() {
+    if (DebugManager.flags.EnableFastProcessExit.get() != 1 || !memoryManager) {
+        return false;
+    }
+    for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
+        if (rootDeviceEnvironment->debugger.get()) {
+            return false;
+        }
+    }
+    auto &engines = memoryManager->getRegisteredEngines();
+    for (auto &engine : engines) {
+        auto csr = engine.commandStreamReceiver;
+        if (csr->getType() != CommandStreamReceiverType::CSR_HW || csr->isDirectSubmissionEnabled() || csr->isBlitterDirectSubmissionEnabled()) {
+            return false;
+        }
+    }
+    for (auto &engine : engines) {
+        auto csr = engine.commandStreamReceiver;
+        csr->waitForCompletionWithTimeout(false, 0, csr->peekTaskCount());
+    }
+    driverWorkerPool.reset();
+    directSubmissionController.reset();
+    gpuProgressWatchdog.reset();
+    return true;
+}
+
+bool ExecutionEnvironment::getCachedSipBinary(SipKernelType type, const HardwareInfo &hwInfo, std::vector<char> &sipBinary, std::vector<char> &stateSaveAreaHeader) {
+    std::lock_guard<std::mutex> lock(sipBinariesMutex);
+    for (auto &cachedSipBinary : sipBinaries) {
+        if (cachedSipBinary->type == type && isSameHardwareInfo(cachedSipBinary->hwInfo, hwInfo)) {
+            sipBinary = cachedSipBinary->sipBinary;
+            stateSaveAreaHeader = cachedSipBinary->stateSaveAreaHeader;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ExecutionEnvironment::cacheSipBinary(SipKernelType type, const HardwareInfo &hwInfo, const std::vector<char> &sipBinary, const std::vector<char> &stateSaveAreaHeader) {
+    std::lock_guard<std::mutex> lock(sipBinariesMutex);
+    sipBinaries.push_back(std::make_unique<CachedSipBinary>(CachedSipBinary{type, hwInfo, sipBinary, stateSaveAreaHeader}));
+}
+
 bool ExecutionEnvironment::initializeMemoryManager() {
     if (this->memoryManager) {
         return memoryManager->isInitialized();
@@ -6,14 +6,23 @@
  */
 
 #pragma once
+#include "shared/source/built_ins/sip_kernel_type.h"
 #include "shared/source/utilities/reference_tracked_object.h"
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
+class DirectSubmissionController;
+class GpuProgressWatchdog;
+struct HardwareInfo;
 class MemoryManager;
 struct OsEnvironment;
 struct RootDeviceEnvironment;
+class WorkerPool;
+
+constexpr size_t defaultBuildWorkersCount = 8u;
 
 class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment> {
 
@@ -29,6 +38,20 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
         debuggingEnabled = true;
     }
     bool isDebuggingEnabled() { return debuggingEnabled; }
+    DirectSubmissionController *getDirectSubmissionController();
+    GpuProgressWatchdog *getGpuProgressWatchdog();
+    // worker pool shared by driver subsystems running tasks in background (program builds, event callbacks)
+    WorkerPool *getDriverWorkerPool();
+    WorkerPool *peekDriverWorkerPool() const { return driverWorkerPool.get(); }
+    static size_t getBuildWorkersCount();
+
+    // waits for outstanding work on every engine and stops helper threads, returns false when
+    // driver objects have to be destroyed at process exit (capture, debugger or direct submission active)
+    bool prepareForFastExit();
+
+    // sip binaries are compiled once and shared by root devices with the same hardware info
+    bool getCachedSipBinary(SipKernelType type, const HardwareInfo &hwInfo, std::vector<char> &sipBinary, std::vector<char> &stateSaveAreaHeader);
+    void cacheSipBinary(SipKernelType type, const HardwareInfo &hwInfo, const std::vector<char> &sipBinary, const std::vector<char> &stateSaveAreaHeader);
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<OsEnvironment> osEnvironment;
@@ -36,5 +59,14 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
 
   protected:
     bool debuggingEnabled = false;
+    std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::mutex initializeDirectSubmissionControllerMutex;
+    std::unique_ptr<GpuProgressWatchdog> gpuProgressWatchdog;
+    std::mutex initializeGpuProgressWatchdogMutex;
+    std::unique_ptr<WorkerPool> driverWorkerPool;
+    std::mutex initializeDriverWorkerPoolMutex;
+    struct CachedSipBinary;
+    std::vector<std::unique_ptr<CachedSipBinary>> sipBinaries;
+    std::mutex sipBinariesMutex;
 };
 } // namespace NEO
@@ -9,6 +9,7 @@
 
 #include "shared/source/aub/aub_center.h"
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debugger/debugger.h"
@@ -101,4 +102,14 @@ BuiltIns *RootDeviceEnvironment::getBuiltIns() {
     }
     return this->builtins.get();
 }
+
+ScratchSpacePool *RootDeviceEnvironment::getScratchSpacePool(uint32_t rootDeviceIndex) {
+    if (this->scratchSpacePool.get() == nullptr) {
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->scratchSpacePool.get() == nullptr) {
+            this->scratchSpacePool = std::make_unique<ScratchSpacePool>(rootDeviceIndex, executionEnvironment);
+        }
+    }
+    return this->scratchSpacePool.get();
+}
 } // namespace NEO
@@ -29,6 +29,7 @@ class HwDeviceId;
 class MemoryManager;
 class MemoryOperationsHandler;
 class OSInterface;
+class ScratchSpacePool;
 class SipKernel;
 class SWTagsManager;
 struct HardwareInfo;
@@ -57,6 +58,7 @@ struct RootDeviceEnvironment {
     GmmClientContext *getGmmClientContext() const;
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface();
     BuiltIns *getBuiltIns();
+    ScratchSpacePool *getScratchSpacePool(uint32_t rootDeviceIndex);
     BindlessHeapsHelper *getBindlessHeapsHelper() const;
     void createBindlessHeapsHelper(MemoryManager *memoryManager, bool availableDevices, uint32_t rootDeviceIndex);
 
@@ -72,6 +74,7 @@ struct RootDeviceEnvironment {
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<Debugger> debugger;
     std::unique_ptr<SWTagsManager> tagsManager;
+    std::unique_ptr<ScratchSpacePool> scratchSpacePool;
     ExecutionEnvironment &executionEnvironment;
 
     uint32_t deviceAffinityMask = allSubDevicesActive;
@@ -9,11 +9,16 @@
 
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/gmm_interface.h"
+#include "shared/source/gmm_helper/resource_info.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/sku_info/operations/sku_info_transfer.h"
 
+#include "gmm_client_context.h"
+
+#include <cstring>
+
 namespace NEO {
 GmmClientContextBase::GmmClientContextBase(OSInterface *osInterface, HardwareInfo *hwInfo) : hardwareInfo(hwInfo) {
     _SKU_FEATURE_TABLE gmmFtrTable = {};
@@ -41,6 +46,8 @@ GmmClientContextBase::GmmClientContextBase(OSInterface *osInterface, HardwareInf
     clientContext = outArgs.pGmmClientContext;
 }
 GmmClientContextBase::~GmmClientContextBase() {
+    cachedImageResourceInfos.clear();
+
     GMM_INIT_OUT_ARGS outArgs;
     outArgs.pGmmClientContext = clientContext;
 
@@ -75,4 +82,27 @@ uint8_t GmmClientContextBase::getMediaSurfaceStateCompressionFormat(GMM_RESOURCE
     return clientContext->GetMediaSurfaceStateCompressionFormat(format);
 }
 
+GmmResourceInfo *GmmClientContextBase::createCachedImageResourceInfo(GMM_RESCREATE_PARAMS &resourceParams) {
+    auto gmmClientContext = static_cast<GmmClientContext *>(this);
+    std::lock_guard<std::mutex> lock(cachedImageResourceInfosMutex);
+
+    for (auto &cachedEntry : cachedImageResourceInfos) {
+        if (memcmp(&cachedEntry.resourceParams, &resourceParams, sizeof(GMM_RESCREATE_PARAMS)) == 0) {
+            return GmmResourceInfo::create(gmmClientContext, cachedEntry.resourceInfo->peekHandle());
+        }
+    }
+
+    std::unique_ptr<GmmResourceInfo> resourceInfo(GmmResourceInfo::create(gmmClientContext, &resourceParams));
+    if (resourceInfo == nullptr) {
+        return nullptr;
+    }
+
+    if (cachedImageResourceInfos.size() >= maxCachedImageResourceInfos) {
+        cachedImageResourceInfos.erase(cachedImageResourceInfos.begin());
+    }
+    auto resourceInfoCopy = GmmResourceInfo::create(gmmClientContext, resourceInfo->peekHandle());
+    cachedImageResourceInfos.push_back({resourceParams, std::move(resourceInfo)});
+    return resourceInfoCopy;
+}
+
 } // namespace NEO
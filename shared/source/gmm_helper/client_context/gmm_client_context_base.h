@@ -9,9 +9,12 @@
 #include "shared/source/gmm_helper/gmm_lib.h"
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 class GmmClientContext;
+class GmmResourceInfo;
 class OSInterface;
 struct HardwareInfo;
 
@@ -36,7 +39,17 @@ class GmmClientContextBase {
     MOCKABLE_VIRTUAL uint8_t getSurfaceStateCompressionFormat(GMM_RESOURCE_FORMAT format);
     MOCKABLE_VIRTUAL uint8_t getMediaSurfaceStateCompressionFormat(GMM_RESOURCE_FORMAT format);
 
+    GmmResourceInfo *createCachedImageResourceInfo(GMM_RESCREATE_PARAMS &resourceParams);
+
   protected:
+    struct CachedImageResourceInfo {
+        GMM_RESCREATE_PARAMS resourceParams;
+        std::unique_ptr<GmmResourceInfo> resourceInfo;
+    };
+    static constexpr size_t maxCachedImageResourceInfos = 64u;
+
+    std::vector<CachedImageResourceInfo> cachedImageResourceInfos;
+    std::mutex cachedImageResourceInfosMutex;
     HardwareInfo *hardwareInfo = nullptr;
     GMM_CLIENT_CONTEXT *clientContext;
     GmmClientContextBase(OSInterface *osInterface, HardwareInfo *hwInfo);
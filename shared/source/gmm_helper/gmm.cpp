@@ -7,6 +7,7 @@
 
 #include "shared/source/gmm_helper/gmm.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/gmm_helper/client_context/gmm_client_context.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/resource_info.h"
@@ -64,7 +65,11 @@ Gmm::Gmm(GmmClientContext *clientContext, ImageInfo &inputOutputImgInfo, Storage
     this->resourceParams = {};
     setupImageResourceParams(inputOutputImgInfo);
     applyMemoryFlags(!inputOutputImgInfo.useLocalMemory, storageInfo);
-    this->gmmResourceInfo.reset(GmmResourceInfo::create(clientContext, &this->resourceParams));
+    if (DebugManager.flags.CacheImageGmmLayouts.get() == 1) {
+        this->gmmResourceInfo.reset(clientContext->createCachedImageResourceInfo(this->resourceParams));
+    } else {
+        this->gmmResourceInfo.reset(GmmResourceInfo::create(clientContext, &this->resourceParams));
+    }
     UNRECOVERABLE_IF(this->gmmResourceInfo == nullptr);
 
     queryImageParams(inputOutputImgInfo);
@@ -17,6 +17,7 @@
 #include "gmm_client_context.h"
 
 #include <algorithm>
+#include <mutex>
 
 namespace NEO {
 
@@ -37,6 +38,10 @@ uint32_t GmmHelper::getMOCS(uint32_t type) const {
 }
 
 GmmHelper::GmmHelper(OSInterface *osInterface, const HardwareInfo *pHwInfo) : hwInfo(pHwInfo) {
+    // root device environments may be initialized in parallel, gmm library and address width are process wide
+    static std::mutex gmmInitializationMutex;
+    std::lock_guard<std::mutex> lock(gmmInitializationMutex);
+
     auto hwInfoAddressWidth = Math::log2(hwInfo->capabilityTable.gpuAddressSpace + 1);
     HwHelper::get(hwInfo->platform.eRenderCoreFamily).adjustAddressWidthForCanonize(hwInfoAddressWidth);
     GmmHelper::addressWidth = std::max(hwInfoAddressWidth, static_cast<uint32_t>(48));
@@ -12,6 +12,8 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 class Gmm;
@@ -26,6 +28,7 @@ class GmmPageTableMngr {
     MOCKABLE_VIRTUAL void setCsrHandle(void *csrHandle);
 
     bool updateAuxTable(uint64_t gpuVa, Gmm *gmm, bool map);
+    bool flushPendingAuxTableUpdates();
     bool initPageTableManagerRegisters(void *csrHandle);
 
   protected:
@@ -40,7 +43,16 @@ class GmmPageTableMngr {
     }
 
     GmmPageTableMngr(GmmClientContext *clientContext, unsigned int translationTableFlags, GMM_TRANSLATIONTABLE_CALLBACKS *translationTableCb);
+    bool submitAuxTableUpdate(uint64_t gpuVa, Gmm *gmm, bool map);
+
+    struct PendingAuxTableUpdate {
+        uint64_t gpuVa;
+        Gmm *gmm;
+    };
+
     GMM_CLIENT_CONTEXT *clientContext = nullptr;
     GMM_PAGETABLE_MGR *pageTableManager = nullptr;
+    std::vector<PendingAuxTableUpdate> pendingAuxTableUpdates;
+    std::mutex pendingAuxTableUpdatesMutex;
 };
 } // namespace NEO
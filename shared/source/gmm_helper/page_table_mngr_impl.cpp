@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
@@ -20,6 +21,33 @@ GmmPageTableMngr::~GmmPageTableMngr() {
 }
 
 bool GmmPageTableMngr::updateAuxTable(uint64_t gpuVa, Gmm *gmm, bool map) {
+    if (DebugManager.flags.BatchAuxTableUpdates.get() == 1) {
+        std::lock_guard<std::mutex> lock(pendingAuxTableUpdatesMutex);
+        if (map) {
+            pendingAuxTableUpdates.push_back({gpuVa, gmm});
+            return true;
+        }
+        for (auto it = pendingAuxTableUpdates.begin(); it != pendingAuxTableUpdates.end(); it++) {
+            if (it->gpuVa == gpuVa && it->gmm == gmm) {
+                pendingAuxTableUpdates.erase(it);
+                return true;
+            }
+        }
+    }
+    return submitAuxTableUpdate(gpuVa, gmm, map);
+}
+
+bool GmmPageTableMngr::flushPendingAuxTableUpdates() {
+    std::lock_guard<std::mutex> lock(pendingAuxTableUpdatesMutex);
+    bool result = true;
+    for (auto &pendingUpdate : pendingAuxTableUpdates) {
+        result &= submitAuxTableUpdate(pendingUpdate.gpuVa, pendingUpdate.gmm, true);
+    }
+    pendingAuxTableUpdates.clear();
+    return result;
+}
+
+bool GmmPageTableMngr::submitAuxTableUpdate(uint64_t gpuVa, Gmm *gmm, bool map) {
     GMM_DDI_UPDATEAUXTABLE ddiUpdateAuxTable = {};
     ddiUpdateAuxTable.BaseGpuVA = gpuVa;
     ddiUpdateAuxTable.BaseResInfo = gmm->gmmResourceInfo->peekHandle();
@@ -52,13 +52,13 @@ GraphicsAllocation *BindlessHeapsHelper::getHeapAllocation(size_t heapSize, size
 }
 
 SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType) {
+    std::lock_guard<std::mutex> autolock(this->mtx);
     auto heap = surfaceStateHeaps[heapType].get();
     if (heapType == BindlesHeapType::GLOBAL_SSH) {
         auto ssAllocatedInfo = surfaceStateInHeapAllocationMap.find(surfaceAllocation);
         if (ssAllocatedInfo != surfaceStateInHeapAllocationMap.end()) {
             return *ssAllocatedInfo->second.get();
         } else {
-            std::lock_guard<std::mutex> autolock(this->mtx);
             if (surfaceStateInHeapVectorReuse.size()) {
                 SurfaceStateInHeapInfo surfaceStateFromVector = *(surfaceStateInHeapVectorReuse.back());
                 surfaceStateInHeapVectorReuse.pop_back();
@@ -117,9 +117,9 @@ void BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
 }
 
 void BindlessHeapsHelper::placeSSAllocationInReuseVectorOnFreeMemory(GraphicsAllocation *gfxAllocation) {
+    std::lock_guard<std::mutex> autolock(this->mtx);
     auto ssAllocatedInfo = surfaceStateInHeapAllocationMap.find(gfxAllocation);
     if (ssAllocatedInfo != surfaceStateInHeapAllocationMap.end()) {
-        std::lock_guard<std::mutex> autolock(this->mtx);
         surfaceStateInHeapVectorReuse.push_back(std::move(ssAllocatedInfo->second));
         surfaceStateInHeapAllocationMap.erase(ssAllocatedInfo);
     }
@@ -18,7 +18,8 @@ struct HardwareInfo;
 enum class EngineUsage : uint32_t {
     Regular,
     LowPriority,
-    Internal
+    Internal,
+    HighPriority
 };
 
 using EngineTypeUsage = std::pair<aub_stream::EngineType, EngineUsage>;
@@ -13,6 +13,7 @@
 #include "hw_cmds.h"
 
 #include <algorithm>
+#include <cstring>
 
 namespace NEO {
 HardwareInfo::HardwareInfo(const PLATFORM *platform, const FeatureTable *featureTable, const WorkaroundTable *workaroundTable,
@@ -124,4 +125,11 @@ const std::string getFamilyNameWithType(const HardwareInfo &hwInfo) {
     platformName.append(hwInfo.capabilityTable.platformType);
     return platformName;
 }
+
+bool isSameHardwareInfo(const HardwareInfo &hwInfo, const HardwareInfo &otherHwInfo) {
+    return (0 == memcmp(&hwInfo.platform, &otherHwInfo.platform, sizeof(hwInfo.platform))) &&
+           (0 == memcmp(&hwInfo.featureTable, &otherHwInfo.featureTable, sizeof(hwInfo.featureTable))) &&
+           (0 == memcmp(&hwInfo.workaroundTable, &otherHwInfo.workaroundTable, sizeof(hwInfo.workaroundTable))) &&
+           (0 == memcmp(&hwInfo.gtSystemInfo, &otherHwInfo.gtSystemInfo, sizeof(hwInfo.gtSystemInfo)));
+}
 } // namespace NEO
@@ -114,6 +114,8 @@ bool parseHwInfoConfigString(const std::string &hwInfoConfigStr, uint64_t &hwInf
 void overridePlatformName(std::string &name);
 aub_stream::EngineType getChosenEngineType(const HardwareInfo &hwInfo);
 const std::string getFamilyNameWithType(const HardwareInfo &hwInfo);
+// compares hardware description passed to compiler device context
+bool isSameHardwareInfo(const HardwareInfo &hwInfo, const HardwareInfo &otherHwInfo);
 
 // Utility conversion
 template <PRODUCT_FAMILY productFamily>
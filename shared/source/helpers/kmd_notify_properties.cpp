@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 
+#include <algorithm>
 #include <cstdint>
 
 using namespace NEO;
@@ -44,6 +45,9 @@ bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
         timeoutValueOutput = KmdNotifyConstants::timeoutInMicrosecondsForDisconnectedAcLine;
     } else if (quickKmdSleepRequest && properties->enableQuickKmdSleep) {
         timeoutValueOutput = properties->delayQuickKmdSleepMicroseconds;
+    } else if (adaptiveKmdNotifyEnabled()) {
+        timeoutValueOutput = getAdaptiveTimeout(multiplier);
+        return true;
     } else {
         timeoutValueOutput = getBaseTimeout(multiplier);
     }
@@ -51,6 +55,64 @@ bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
     return (properties->enableKmdNotify || !acLineConnected);
 }
 
+bool KmdNotifyHelper::adaptiveKmdNotifyEnabled() const {
+    return DebugManager.flags.EnableAdaptiveKmdNotify.get() == 1;
+}
+
+int64_t KmdNotifyHelper::getAdaptiveTimeout(const int64_t &multiplier) {
+    int64_t spinBudget = getBaseTimeout(multiplier);
+    if (DebugManager.flags.AdaptiveKmdNotifySpinBudgetMicroseconds.get() >= 0) {
+        spinBudget = static_cast<int64_t>(DebugManager.flags.AdaptiveKmdNotifySpinBudgetMicroseconds.get());
+    }
+
+    std::unique_lock<std::mutex> lock(waitStatisticsMtx);
+    int64_t timeout = spinBudget;
+    if (waitStatistics.waits >= KmdNotifyConstants::minimumWaitsToApplyAdaptiveTimeout) {
+        auto averageWait = waitStatistics.averageWaitMicroseconds;
+        if (averageWait > spinBudget) {
+            // tasks usually outlast the budget, spinning would only burn CPU before sleeping anyway
+            timeout = 0;
+        } else {
+            // spin slightly longer than a typical task to catch most completions without sleeping
+            timeout = std::min(spinBudget, averageWait + averageWait / 2 + 1);
+        }
+    }
+    waitStatistics.lastTimeoutMicroseconds = timeout;
+    return timeout;
+}
+
+int64_t KmdNotifyHelper::startWaitMeasurement() const {
+    if (adaptiveKmdNotifyEnabled()) {
+        return getMicrosecondsSinceEpoch();
+    }
+    return 0;
+}
+
+void KmdNotifyHelper::registerWaitCompletion(int64_t waitStartMicroseconds, bool completedWhileSpinning) {
+    if (!adaptiveKmdNotifyEnabled()) {
+        return;
+    }
+    auto waitTime = std::max(getMicrosecondsSinceEpoch() - waitStartMicroseconds, static_cast<int64_t>(0));
+
+    std::unique_lock<std::mutex> lock(waitStatisticsMtx);
+    if (waitStatistics.waits == 0u) {
+        waitStatistics.averageWaitMicroseconds = waitTime;
+    } else {
+        auto &average = waitStatistics.averageWaitMicroseconds;
+        average += (waitTime - average) >> KmdNotifyConstants::adaptiveAverageWeightShift;
+    }
+    waitStatistics.waits++;
+    waitStatistics.totalWaitMicroseconds += waitTime;
+    if (completedWhileSpinning) {
+        waitStatistics.waitsCompletedWhileSpinning++;
+    }
+}
+
+KmdNotifyHelper::WaitStatistics KmdNotifyHelper::getWaitStatistics() const {
+    std::unique_lock<std::mutex> lock(waitStatisticsMtx);
+    return waitStatistics;
+}
+
 bool KmdNotifyHelper::applyQuickKmdSleepForSporadicWait() const {
     if (properties->enableQuickKmdSleepForSporadicWaits) {
         auto timeDiff = getMicrosecondsSinceEpoch() - lastWaitForCompletionTimestampUs.load();
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <mutex>
 
 namespace NEO {
 struct KmdNotifyProperties {
@@ -28,10 +29,20 @@ struct KmdNotifyProperties {
 namespace KmdNotifyConstants {
 constexpr int64_t timeoutInMicrosecondsForDisconnectedAcLine = 10000;
 constexpr uint32_t minimumTaskCountDiffToCheckAcLine = 10;
+constexpr uint64_t minimumWaitsToApplyAdaptiveTimeout = 8;
+constexpr int64_t adaptiveAverageWeightShift = 3;
 } // namespace KmdNotifyConstants
 
 class KmdNotifyHelper {
   public:
+    struct WaitStatistics {
+        uint64_t waits = 0u;
+        uint64_t waitsCompletedWhileSpinning = 0u;
+        int64_t totalWaitMicroseconds = 0;
+        int64_t averageWaitMicroseconds = 0;
+        int64_t lastTimeoutMicroseconds = 0;
+    };
+
     KmdNotifyHelper() = delete;
     KmdNotifyHelper(const KmdNotifyProperties *properties) : properties(properties){};
     MOCKABLE_VIRTUAL ~KmdNotifyHelper() = default;
@@ -48,16 +59,25 @@ class KmdNotifyHelper {
     MOCKABLE_VIRTUAL void updateLastWaitForCompletionTimestamp();
     MOCKABLE_VIRTUAL void updateAcLineStatus();
 
+    bool adaptiveKmdNotifyEnabled() const;
+    int64_t startWaitMeasurement() const;
+    void registerWaitCompletion(int64_t waitStartMicroseconds, bool completedWhileSpinning);
+    WaitStatistics getWaitStatistics() const;
+
     static void overrideFromDebugVariable(int32_t debugVariableValue, int64_t &destination);
     static void overrideFromDebugVariable(int32_t debugVariableValue, bool &destination);
 
   protected:
     bool applyQuickKmdSleepForSporadicWait() const;
     int64_t getBaseTimeout(const int64_t &multiplier) const;
+    int64_t getAdaptiveTimeout(const int64_t &multiplier);
     int64_t getMicrosecondsSinceEpoch() const;
 
     const KmdNotifyProperties *properties = nullptr;
     std::atomic<int64_t> lastWaitForCompletionTimestampUs{0};
     std::atomic<bool> acLineConnected{true};
+
+    mutable std::mutex waitStatisticsMtx;
+    WaitStatistics waitStatistics;
 };
 } // namespace NEO
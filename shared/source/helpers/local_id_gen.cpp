@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,11 +16,12 @@ namespace NEO {
 
 struct uint16x8_t;
 struct uint16x16_t;
+struct uint16x32_t;
 
 // This is the initial value of SIMD for local ID
 // computation.  It correlates to the SIMD lane.
-// Must be 32byte aligned for AVX2 usage
-ALIGNAS(32)
+// Must be 64byte aligned for AVX-512 usage
+ALIGNAS(64)
 const uint16_t initialLocalID[] = {
     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
@@ -38,6 +39,11 @@ LocalIDHelper::LocalIDHelper() {
         LocalIDHelper::generateSimd16 = generateLocalIDsSimd<uint16x16_t, 16>;
         LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x16_t, 32>;
     }
+    // 32 lanes fill whole SIMD32 row, narrower SIMD sizes keep AVX2 variant
+    bool supportsAVX512 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512F | CpuInfo::featureAvX512Bw);
+    if (supportsAVX512) {
+        LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x32_t, 32>;
+    }
 }
 
 LocalIDHelper LocalIDHelper::initializer;
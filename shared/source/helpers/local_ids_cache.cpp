@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/local_ids_cache.h"
+
+#include "shared/source/helpers/local_id_gen.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+void LocalIdsCache::generateLocalIds(void *buffer, size_t size, uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
+                                     const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel, uint32_t grfSize) {
+    if (size > maxEntrySize) {
+        generateLocalIDs(buffer, simd, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel, grfSize);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        if (entry.simd == simd && entry.grfSize == grfSize && entry.isImageOnlyKernel == isImageOnlyKernel &&
+            entry.localWorkgroupSize == localWorkgroupSize && entry.dimensionsOrder == dimensionsOrder && entry.localIds.size() == size) {
+            entry.lastUse = ++useCounter;
+            memcpy(buffer, entry.localIds.data(), size);
+            return;
+        }
+    }
+
+    generateLocalIDs(buffer, simd, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel, grfSize);
+
+    Entry *entry = nullptr;
+    if (entries.size() < maxEntriesCount) {
+        entries.emplace_back();
+        entry = &entries.back();
+    } else {
+        entry = &*std::min_element(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.lastUse < b.lastUse; });
+    }
+    entry->localWorkgroupSize = localWorkgroupSize;
+    entry->dimensionsOrder = dimensionsOrder;
+    entry->grfSize = grfSize;
+    entry->simd = simd;
+    entry->isImageOnlyKernel = isImageOnlyKernel;
+    entry->lastUse = ++useCounter;
+    entry->localIds.assign(static_cast<uint8_t *>(buffer), static_cast<uint8_t *>(buffer) + size);
+}
+
+size_t LocalIdsCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+} // namespace NEO
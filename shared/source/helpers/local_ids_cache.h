@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Local IDs depend only on dispatch shape, so blocks generated once are copied on repeated dispatches
+class LocalIdsCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxEntriesCount = 16u;
+    static constexpr size_t maxEntrySize = 64 * 1024u;
+
+    void generateLocalIds(void *buffer, size_t size, uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
+                          const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel, uint32_t grfSize);
+
+    size_t getEntriesCount() const;
+
+  protected:
+    struct Entry {
+        std::array<uint16_t, 3> localWorkgroupSize = {};
+        std::array<uint8_t, 3> dimensionsOrder = {};
+        uint32_t grfSize = 0u;
+        uint16_t simd = 0u;
+        bool isImageOnlyKernel = false;
+        uint64_t lastUse = 0u;
+        std::vector<uint8_t> localIds;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t useCounter = 0u;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -24,11 +24,11 @@ TimestampPacketContainer::~TimestampPacketContainer() {
 }
 
 void TimestampPacketContainer::swapNodes(TimestampPacketContainer &timestampPacketContainer) {
-    timestampPacketNodes.swap(timestampPacketContainer.timestampPacketNodes);
+    std::swap(timestampPacketNodes, timestampPacketContainer.timestampPacketNodes);
 }
 
 void TimestampPacketContainer::resolveDependencies(bool clearAllDependencies) {
-    std::vector<TagNodeBase *> pendingNodes;
+    Nodes pendingNodes;
 
     for (auto node : timestampPacketNodes) {
         if (node->canBeReleased() || clearAllDependencies) {
@@ -43,9 +43,8 @@ void TimestampPacketContainer::resolveDependencies(bool clearAllDependencies) {
 
 void TimestampPacketContainer::assignAndIncrementNodesRefCounts(const TimestampPacketContainer &inputTimestampPacketContainer) {
     auto &inputNodes = inputTimestampPacketContainer.peekNodes();
-    std::copy(inputNodes.begin(), inputNodes.end(), std::back_inserter(timestampPacketNodes));
-
     for (auto node : inputNodes) {
+        timestampPacketNodes.push_back(node);
         node->incRefCount();
     }
 }
@@ -13,6 +13,7 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/stackvec.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "pipe_control_args.h"
@@ -106,12 +107,16 @@ static_assert(((4 * TimestampPacketSizeControl::preferredPacketCount + 2) * size
 
 class TimestampPacketContainer : public NonCopyableClass {
   public:
+    // containers are created for every enqueue and its dependencies, typical node count fits inline storage
+    static constexpr size_t preallocatedNodesCount = 8;
+    using Nodes = StackVec<TagNodeBase *, preallocatedNodesCount>;
+
     TimestampPacketContainer() = default;
     TimestampPacketContainer(TimestampPacketContainer &&) = default;
     TimestampPacketContainer &operator=(TimestampPacketContainer &&) = default;
     MOCKABLE_VIRTUAL ~TimestampPacketContainer();
 
-    const std::vector<TagNodeBase *> &peekNodes() const { return timestampPacketNodes; }
+    const Nodes &peekNodes() const { return timestampPacketNodes; }
     void add(TagNodeBase *timestampPacketNode);
     void swapNodes(TimestampPacketContainer &timestampPacketContainer);
     void assignAndIncrementNodesRefCounts(const TimestampPacketContainer &inputTimestampPacketContainer);
@@ -119,7 +124,7 @@ class TimestampPacketContainer : public NonCopyableClass {
     void makeResident(CommandStreamReceiver &commandStreamReceiver);
 
   protected:
-    std::vector<TagNodeBase *> timestampPacketNodes;
+    Nodes timestampPacketNodes;
 };
 
 struct TimestampPacketDependencies : public NonCopyableClass {
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/indirect_heap/indirect_heap.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
+
+namespace NEO {
+
+bool IndirectHeap::isStateDeduplicationEnabled() {
+    return DebugManager.flags.EnableHeapStateDeduplication.get() == 1 && !DebugManager.flags.AddPatchInfoCommentsForAUBDump.get();
+}
+
+bool IndirectHeap::findReusableBlock(uint64_t tag, const void *content, size_t size, size_t &offset) const {
+    if (reusableBlocksGeneration != bufferGeneration || size == 0u) {
+        return false;
+    }
+    auto hash = Hash::hash(reinterpret_cast<const char *>(content), size);
+    for (auto &block : reusableBlocks) {
+        if (block.tag == tag && block.hash == hash && block.size == size && memcmp(block.content.get(), content, size) == 0) {
+            offset = block.offset;
+            return true;
+        }
+    }
+    return false;
+}
+
+void IndirectHeap::storeReusableBlock(uint64_t tag, const void *content, size_t size, size_t offset) {
+    if (size == 0u) {
+        return;
+    }
+    if (reusableBlocksGeneration != bufferGeneration) {
+        reusableBlocks.clear();
+        nextReusableBlock = 0u;
+        reusableBlocksGeneration = bufferGeneration;
+    }
+
+    ReusableBlock *block = nullptr;
+    if (reusableBlocks.size() < maxReusableBlocks) {
+        reusableBlocks.emplace_back();
+        block = &reusableBlocks.back();
+    } else {
+        block = &reusableBlocks[nextReusableBlock];
+        nextReusableBlock = (nextReusableBlock + 1) % maxReusableBlocks;
+    }
+    if (block->size != size) {
+        block->content.reset(new char[size]);
+        block->size = size;
+    }
+    memcpy_s(block->content.get(), size, content, size);
+    block->tag = tag;
+    block->hash = Hash::hash(reinterpret_cast<const char *>(content), size);
+    block->offset = offset;
+}
+} // namespace NEO
@@ -13,6 +13,9 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 
+#include <memory>
+#include <vector>
+
 namespace NEO {
 class GraphicsAllocation;
 
@@ -45,8 +48,26 @@ class IndirectHeap : public LinearStream {
     uint64_t getHeapGpuBase() const;
     uint32_t getHeapSizeInPages() const;
 
+    // state blocks written within current buffer generation are looked up by content, so identical state can be
+    // referenced by its offset instead of being copied again; tag separates blocks with different internal layout
+    static bool isStateDeduplicationEnabled();
+    bool findReusableBlock(uint64_t tag, const void *content, size_t size, size_t &offset) const;
+    void storeReusableBlock(uint64_t tag, const void *content, size_t size, size_t offset);
+
   protected:
+    struct ReusableBlock {
+        uint64_t tag = 0u;
+        uint64_t hash = 0u;
+        std::unique_ptr<char[]> content;
+        size_t size = 0u;
+        size_t offset = 0u;
+    };
+    static constexpr size_t maxReusableBlocks = 16u;
+
     bool canBeUtilizedAs4GbHeap = false;
+    std::vector<ReusableBlock> reusableBlocks;
+    uint64_t reusableBlocksGeneration = 0u;
+    size_t nextReusableBlock = 0u;
 };
 
 inline void IndirectHeap::align(size_t alignment) {
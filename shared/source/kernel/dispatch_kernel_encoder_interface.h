@@ -6,6 +6,8 @@
  */
 
 #pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+
 #include <cstddef>
 #include <cstdint>
 
@@ -19,6 +21,45 @@ enum class SlmPolicy {
     SlmPolicyLargeData
 };
 
+// Interface descriptor and walker encoded at previous dispatch of the kernel.
+// They are reused while kernel state they were built from does not change,
+// only heap offsets and group counts are programmed for every dispatch.
+struct DispatchKernelTemplate {
+    static constexpr size_t maxInterfaceDescriptorSize = 64u;
+    static constexpr size_t maxWalkerSize = 128u;
+
+    struct State {
+        uint64_t isaGpuAddress = 0u;
+        uint32_t groupSize[3] = {};
+        uint32_t slmTotalSize = 0u;
+        uint32_t numThreadsPerThreadGroup = 0u;
+        uint32_t threadExecutionMask = 0u;
+        uint32_t requiredWorkgroupOrder = 0u;
+        PreemptionMode preemptionMode = PreemptionMode::Initial;
+        bool isIndirect = false;
+        bool isPredicate = false;
+
+        bool operator==(const State &other) const {
+            return isaGpuAddress == other.isaGpuAddress &&
+                   groupSize[0] == other.groupSize[0] &&
+                   groupSize[1] == other.groupSize[1] &&
+                   groupSize[2] == other.groupSize[2] &&
+                   slmTotalSize == other.slmTotalSize &&
+                   numThreadsPerThreadGroup == other.numThreadsPerThreadGroup &&
+                   threadExecutionMask == other.threadExecutionMask &&
+                   requiredWorkgroupOrder == other.requiredWorkgroupOrder &&
+                   preemptionMode == other.preemptionMode &&
+                   isIndirect == other.isIndirect &&
+                   isPredicate == other.isPredicate;
+        }
+    };
+
+    State state;
+    bool valid = false;
+    alignas(8) uint8_t interfaceDescriptor[maxInterfaceDescriptorSize];
+    alignas(8) uint8_t walker[maxWalkerSize];
+};
+
 struct DispatchKernelEncoderI {
     virtual ~DispatchKernelEncoderI() = default;
 
@@ -44,5 +85,8 @@ struct DispatchKernelEncoderI {
 
     virtual uint32_t getRequiredWorkgroupOrder() const = 0;
     virtual bool requiresGenerationOfLocalIdsByRuntime() const = 0;
+
+    // nullptr when dispatch template is not cached for this kernel
+    virtual DispatchKernelTemplate *getDispatchTemplate() = 0;
 };
 } // namespace NEO
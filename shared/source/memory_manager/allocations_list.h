@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,11 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <list>
+#include <map>
 #include <mutex>
+#include <unordered_map>
+#include <utility>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -19,9 +23,46 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     AllocationsList(AllocationUsage allocationUsage);
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver &commandStreamReceiver, GraphicsAllocation::AllocationType allocationType);
 
+    // Mutators are shadowed to keep the reuse index in sync with the list, under the list lock
+    void pushFrontOne(GraphicsAllocation &allocation);
+    void pushTailOne(GraphicsAllocation &allocation);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &allocation);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &allocations);
+    void deleteAll();
+
+    size_t peekIndexedAllocationsCount();
+
   private:
+    using IndexKey = std::pair<GraphicsAllocation::AllocationType, uint32_t>;
+    using IndexBucket = std::list<GraphicsAllocation *>;
+    struct IndexEntry {
+        IndexKey key;
+        IndexBucket::iterator position;
+    };
+
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachIndexedAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushFrontOneIndexedImpl(GraphicsAllocation *allocation, void *);
+    GraphicsAllocation *pushTailOneIndexedImpl(GraphicsAllocation *allocation, void *);
+    GraphicsAllocation *removeOneIndexedImpl(GraphicsAllocation *allocation, void *);
+    GraphicsAllocation *removeFrontOneIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachSequenceIndexedImpl(GraphicsAllocation *first, void *last);
+    GraphicsAllocation *detachNodesIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceIndexedImpl(GraphicsAllocation *allocations, void *);
+    GraphicsAllocation *peekIndexedAllocationsCountImpl(GraphicsAllocation *, void *);
+
+    bool isIndexed() const { return allocationUsage == REUSABLE_ALLOCATION; }
+    static uint32_t getSizeClass(size_t size);
+    void addToIndex(GraphicsAllocation &allocation, bool pushFront);
+    void removeFromIndex(GraphicsAllocation &allocation);
 
     const AllocationUsage allocationUsage;
+
+    // allocations grouped by type and power-of-two size class, each bucket kept in list (task count) order
+    std::map<IndexKey, IndexBucket> reuseIndex;
+    std::unordered_map<GraphicsAllocation *, IndexEntry> reuseIndexEntries;
 };
 } // namespace NEO
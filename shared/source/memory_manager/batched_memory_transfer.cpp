@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/batched_memory_transfer.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/blit_commands_helper.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <cstring>
+
+namespace NEO {
+
+BatchedMemoryTransfer::BatchedMemoryTransfer(Device &device) : device(device) {}
+
+BatchedMemoryTransfer::~BatchedMemoryTransfer() {
+    wait();
+}
+
+bool BatchedMemoryTransfer::isEnabled() {
+    return DebugManager.flags.EnableBatchedModuleUpload.get() == 1;
+}
+
+void BatchedMemoryTransfer::add(GraphicsAllocation *dstAllocation, size_t dstOffset, const void *srcMemory, size_t srcSize) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    Chunk *chunk = nullptr;
+    for (auto &addedChunk : chunks) {
+        if (addedChunk.dstAllocation == dstAllocation && addedChunk.dstOffset == dstOffset && addedChunk.size == srcSize) {
+            chunk = &addedChunk;
+            break;
+        }
+    }
+    if (nullptr == chunk) {
+        Chunk newChunk;
+        newChunk.dstAllocation = dstAllocation;
+        newChunk.dstOffset = dstOffset;
+        newChunk.stagingOffset = alignUp(stagingData.size(), MemoryConstants::cacheLineSize);
+        newChunk.size = srcSize;
+        stagingData.resize(newChunk.stagingOffset + srcSize);
+        chunks.push_back(newChunk);
+        chunk = &chunks.back();
+    }
+
+    auto stagingPtr = ptrOffset(stagingData.data(), chunk->stagingOffset);
+    if (nullptr != srcMemory) {
+        memcpy_s(stagingPtr, srcSize, srcMemory, srcSize);
+    } else {
+        memset(stagingPtr, 0, srcSize);
+    }
+}
+
+CommandStreamReceiver *BatchedMemoryTransfer::getCopyEngineCsr() const {
+    if (false == device.getHardwareInfo().capabilityTable.blitterOperationsSupported) {
+        return nullptr;
+    }
+    auto &engineGroups = device.getEngineGroups();
+    auto copyGroupIndex = static_cast<size_t>(EngineGroupType::Copy);
+    if (copyGroupIndex >= engineGroups.size() || engineGroups[copyGroupIndex].empty()) {
+        return nullptr;
+    }
+    auto &engine = engineGroups[copyGroupIndex][0];
+    if (false == device.ensureEngineInitialized(engine)) {
+        return nullptr;
+    }
+    return engine.commandStreamReceiver;
+}
+
+bool BatchedMemoryTransfer::canUseCopyEngine() const {
+    for (const auto &chunk : chunks) {
+        if (chunk.dstAllocation->isAllocatedInLocalMemoryPool()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BatchedMemoryTransfer::submit() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (chunks.empty()) {
+        return true;
+    }
+    UNRECOVERABLE_IF(nullptr != bcsCsr);
+
+    auto memoryManager = device.getMemoryManager();
+    auto csr = canUseCopyEngine() ? getCopyEngineCsr() : nullptr;
+    if (nullptr != csr) {
+        stagingAllocation = memoryManager->allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(), stagingData.size(),
+                                                                                 GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
+                                                                                 device.getDeviceBitfield()});
+        if (nullptr == stagingAllocation) {
+            csr = nullptr;
+        } else {
+            memcpy_s(stagingAllocation->getUnderlyingBuffer(), stagingAllocation->getUnderlyingBufferSize(), stagingData.data(), stagingData.size());
+        }
+    }
+
+    auto &hwInfo = device.getHardwareInfo();
+    auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+
+    bool success = true;
+    BlitPropertiesContainer blitPropertiesContainer;
+    for (const auto &chunk : chunks) {
+        if (nullptr != csr && chunk.dstAllocation->isAllocatedInLocalMemoryPool()) {
+            blitPropertiesContainer.push_back(BlitProperties::constructPropertiesForCopyBuffer(chunk.dstAllocation, stagingAllocation,
+                                                                                               {chunk.dstOffset, 0, 0}, {chunk.stagingOffset, 0, 0}, {chunk.size, 1, 1},
+                                                                                               0, 0, 0, 0, csr->getClearColorAllocation()));
+            continue;
+        }
+        success &= MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *chunk.dstAllocation),
+                                                                    device, chunk.dstAllocation, chunk.dstOffset,
+                                                                    ptrOffset(stagingData.data(), chunk.stagingOffset), chunk.size);
+    }
+
+    if (false == blitPropertiesContainer.empty()) {
+        bcsTaskCount = csr->blitBuffer(blitPropertiesContainer, false, false);
+        bcsCsr = csr;
+        completed = false;
+    }
+
+    chunks.clear();
+    std::vector<uint8_t>().swap(stagingData);
+    return success;
+}
+
+void BatchedMemoryTransfer::wait() {
+    if (completed) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    if (completed) {
+        return;
+    }
+    bcsCsr->waitForCompletionWithTimeout(false, 0, bcsTaskCount);
+    device.getMemoryManager()->freeGraphicsMemory(stagingAllocation);
+    stagingAllocation = nullptr;
+    bcsCsr = nullptr;
+    completed = true;
+}
+
+} // namespace NEO
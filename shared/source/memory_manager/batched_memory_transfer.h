@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Device;
+class GraphicsAllocation;
+
+// Collects initial contents of local memory allocations (e.g. kernel ISA, constant and global surfaces)
+// and uploads them with single copy engine submission from staging buffer instead of CPU writes through locked mappings.
+// Contents are copied to staging storage when added, so source memory may be released right after add.
+// Transfer falls back to MemoryTransferHelper when copy engine can not be used.
+class BatchedMemoryTransfer : NonCopyableOrMovableClass {
+  public:
+    BatchedMemoryTransfer(Device &device);
+    ~BatchedMemoryTransfer();
+
+    static bool isEnabled();
+
+    // chunk with same destination and offset replaces contents added before
+    void add(GraphicsAllocation *dstAllocation, size_t dstOffset, const void *srcMemory, size_t srcSize);
+    bool submit();
+    void wait();
+
+    bool isSubmittedToCopyEngine() const { return nullptr != bcsCsr; }
+    size_t getChunksCount() const { return chunks.size(); }
+
+  protected:
+    struct Chunk {
+        GraphicsAllocation *dstAllocation = nullptr;
+        size_t dstOffset = 0u;
+        size_t stagingOffset = 0u;
+        size_t size = 0u;
+    };
+
+    CommandStreamReceiver *getCopyEngineCsr() const;
+    bool canUseCopyEngine() const;
+
+    Device &device;
+    std::vector<Chunk> chunks;
+    std::vector<uint8_t> stagingData;
+    GraphicsAllocation *stagingAllocation = nullptr;
+    CommandStreamReceiver *bcsCsr = nullptr;
+    uint32_t bcsTaskCount = 0u;
+    std::atomic<bool> completed{true};
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -12,6 +12,8 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 DeferrableAllocationDeletion::DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation) : memoryManager(memoryManager),
@@ -27,8 +29,6 @@ bool DeferrableAllocationDeletion::apply() {
                     graphicsAllocation.releaseUsageInOsContext(contextId);
                 } else {
                     isStillUsed = true;
-                    engine.commandStreamReceiver->flushBatchedSubmissions();
-                    engine.commandStreamReceiver->updateTagFromWait();
                 }
             }
         }
@@ -39,4 +39,14 @@ bool DeferrableAllocationDeletion::apply() {
     memoryManager.freeGraphicsMemory(&graphicsAllocation);
     return true;
 }
+
+void DeferrableAllocationDeletion::collectTaskCountWaits(TaskCountWaits &taskCountWaits) {
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (graphicsAllocation.isUsedByOsContext(contextId)) {
+            auto &taskCountToWait = taskCountWaits[engine.commandStreamReceiver];
+            taskCountToWait = std::max(taskCountToWait, graphicsAllocation.getTaskCount(contextId));
+        }
+    }
+}
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@ class DeferrableAllocationDeletion : public DeferrableDeletion {
   public:
     DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation);
     bool apply() override;
+    void collectTaskCountWaits(TaskCountWaits &taskCountWaits) override;
 
   protected:
     MemoryManager &memoryManager;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,11 +8,32 @@
 #pragma once
 #include "shared/source/utilities/idlist.h"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace NEO {
+class CommandStreamReceiver;
+
 class DeferrableDeletion : public IDNode<DeferrableDeletion> {
   public:
+    using TaskCountWaits = std::unordered_map<CommandStreamReceiver *, uint32_t>;
+
     template <typename... Args>
     static DeferrableDeletion *create(Args... args);
     virtual bool apply() = 0;
+    virtual void collectTaskCountWaits(TaskCountWaits &taskCountWaits) {}
+
+    // deletions of the same type and owner return the same non-null key, they are merged and released with a single apply
+    virtual const void *getMergeKey() const { return nullptr; }
+    void merge(DeferrableDeletion &deletion) {
+        mergeImpl(deletion);
+        mergedDeletionsCount += deletion.mergedDeletionsCount + 1;
+    }
+    uint32_t getDeletionsCount() const { return mergedDeletionsCount + 1; }
+
+  protected:
+    virtual void mergeImpl(DeferrableDeletion &deletion) {}
+
+    uint32_t mergedDeletionsCount = 0u;
 };
 } // namespace NEO
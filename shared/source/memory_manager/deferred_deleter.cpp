@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,13 @@
 
 #include "shared/source/memory_manager/deferred_deleter.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/deferrable_deletion.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
+
 namespace NEO {
 DeferredDeleter::DeferredDeleter() {
     doWorkInBackground = false;
@@ -21,19 +25,24 @@ void DeferredDeleter::stop() {
     if (worker != nullptr) {
         // Working thread was created so we can safely stop it
         std::unique_lock<std::mutex> lock(queueMutex);
-        // Make sure that working thread really started
-        while (!doWorkInBackground) {
+        // Make sure that all working threads really started
+        while (!doWorkInBackground || startedWorkersCount < additionalWorkers.size() + 1) {
             lock.unlock();
             lock.lock();
         }
-        // Signal working thread to finish its job
+        // Signal working threads to finish their job
         doWorkInBackground = false;
+        startedWorkersCount = 0u;
         lock.unlock();
-        condition.notify_one();
-        // Wait for the working job to exit
+        condition.notify_all();
+        // Wait for the working jobs to exit
         worker->join();
-        // Delete working thread
+        for (auto &additionalWorker : additionalWorkers) {
+            additionalWorker->join();
+        }
+        // Delete working threads
         worker.reset();
+        additionalWorkers.clear();
     }
     drain(false);
 }
@@ -74,6 +83,14 @@ void DeferredDeleter::ensureThread() {
         return;
     }
     worker = Thread::create(run, reinterpret_cast<void *>(this));
+
+    auto workersCount = 1u;
+    if (DebugManager.flags.DeferredDeleterThreadsCount.get() > 0) {
+        workersCount = std::min(static_cast<uint32_t>(DebugManager.flags.DeferredDeleterThreadsCount.get()), maxWorkersCount);
+    }
+    for (auto i = 1u; i < workersCount; i++) {
+        additionalWorkers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
 }
 
 bool DeferredDeleter::areElementsReleased() {
@@ -89,6 +106,7 @@ void *DeferredDeleter::run(void *arg) {
     std::unique_lock<std::mutex> lock(self->queueMutex);
     // Mark that working thread really started
     self->doWorkInBackground = true;
+    self->startedWorkersCount++;
     do {
         if (self->queue.peekIsEmpty()) {
             // Wait for signal that some items are ready to be deleted
@@ -114,13 +132,37 @@ void DeferredDeleter::drain(bool blocking) {
 
 void DeferredDeleter::clearQueue() {
     do {
-        auto deletion = queue.removeFrontOne();
-        if (deletion) {
+        // Take all queued deletions at once, completed ones are released in a single pass
+        auto deletion = queue.detachNodes();
+        IDList<DeferrableDeletion, false> pendingDeletions;
+        DeferrableDeletion::TaskCountWaits taskCountWaits;
+        while (deletion != nullptr) {
+            auto nextDeletion = deletion->slice();
+            // bursts of frees are queued one after another, so they are released by single apply
+            auto mergeKey = deletion->getMergeKey();
+            while (mergeKey != nullptr && nextDeletion != nullptr && nextDeletion->getMergeKey() == mergeKey) {
+                auto mergedDeletion = nextDeletion;
+                nextDeletion = mergedDeletion->slice();
+                deletion->merge(*mergedDeletion);
+                delete mergedDeletion;
+            }
             if (deletion->apply()) {
-                elementsToRelease--;
+                elementsToRelease -= deletion->getDeletionsCount();
+                delete deletion;
             } else {
-                queue.pushTailOne(*deletion.release());
+                deletion->collectTaskCountWaits(taskCountWaits);
+                pendingDeletions.pushTailOne(*deletion);
             }
+            deletion = nextDeletion;
+        }
+
+        // Wait once per engine, for the highest task count any pending deletion needs
+        for (auto &taskCountWait : taskCountWaits) {
+            taskCountWait.first->waitForCompletionWithTimeout(false, 0, taskCountWait.second);
+        }
+
+        if (!pendingDeletions.peekIsEmpty()) {
+            queue.splice(*pendingDeletions.detachNodes());
         }
     } while (!queue.peekIsEmpty());
 }
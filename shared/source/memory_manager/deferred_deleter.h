@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace NEO {
 class DeferrableDeletion;
@@ -32,6 +33,8 @@ class DeferredDeleter {
 
     MOCKABLE_VIRTUAL void drain(bool blocking);
 
+    static constexpr uint32_t maxWorkersCount = 8u;
+
   protected:
     void stop();
     void safeStop();
@@ -45,6 +48,8 @@ class DeferredDeleter {
     std::atomic<bool> doWorkInBackground;
     std::atomic<int> elementsToRelease;
     std::unique_ptr<Thread> worker;
+    std::vector<std::unique_ptr<Thread>> additionalWorkers;
+    uint32_t startedWorkersCount = 0u;
     int32_t numClients = 0;
     IDList<DeferrableDeletion, true> queue;
     std::mutex queueMutex;
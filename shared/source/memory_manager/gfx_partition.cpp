@@ -7,7 +7,9 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/cpu_info.h"
@@ -28,7 +30,14 @@ const std::array<HeapIndex, 8> GfxPartition::heapNonSvmNames{{HeapIndex::HEAP_IN
                                                               HeapIndex::HEAP_STANDARD2MB,
                                                               HeapIndex::HEAP_EXTENDED}};
 
-GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &sharedReservedCpuAddressRange) : reservedCpuAddressRange(sharedReservedCpuAddressRange), osMemory(OSMemory::create()) {}
+GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &sharedReservedCpuAddressRange) : reservedCpuAddressRange(sharedReservedCpuAddressRange), osMemory(OSMemory::create()) {
+    auto bestFitHeapsMask = DebugManager.flags.UseBestFitHeapAllocator.get();
+    if (bestFitHeapsMask > 0) {
+        for (uint32_t heapIndex = 0; heapIndex < static_cast<uint32_t>(HeapIndex::TOTAL_HEAPS); heapIndex++) {
+            heaps[heapIndex].selectBestFitAllocator(isBitSet(bestFitHeapsMask, heapIndex));
+        }
+    }
+}
 
 GfxPartition::~GfxPartition() {
     osMemory->releaseCpuAddressRange(reservedCpuAddressRange);
@@ -49,7 +58,7 @@ void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAli
         size -= 2 * heapGranularity;
     }
 
-    alloc = std::make_unique<HeapAllocator>(base + heapGranularity, size, allocationAlignment);
+    createAllocator(base + heapGranularity, size, allocationAlignment, 4 * MemoryConstants::megaByte);
 }
 
 void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t size) {
@@ -58,7 +67,7 @@ void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t siz
 
     size -= GfxPartition::heapGranularity;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    createAllocator(base, size, MemoryConstants::pageSize, 0u);
 }
 
 void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize) {
@@ -69,14 +78,24 @@ void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint6
     size -= GfxPartition::heapGranularity;
     size -= frontWindowSize;
 
-    alloc = std::make_unique<HeapAllocator>(base + frontWindowSize, size, MemoryConstants::pageSize);
+    createAllocator(base + frontWindowSize, size, MemoryConstants::pageSize, 4 * MemoryConstants::megaByte);
 }
 
 void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
     this->base = base;
     this->size = size;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    createAllocator(base, size, MemoryConstants::pageSize, 0u);
+}
+
+void GfxPartition::Heap::createAllocator(uint64_t allocatorBase, uint64_t allocatorSize, size_t allocationAlignment, size_t threshold) {
+    if (bestFitAllocatorSelected) {
+        alloc.reset();
+        bestFitAlloc = std::make_unique<BestFitHeapAllocator>(allocatorBase, allocatorSize, allocationAlignment);
+    } else {
+        bestFitAlloc.reset();
+        alloc = std::make_unique<HeapAllocator>(allocatorBase, allocatorSize, allocationAlignment, threshold);
+    }
 }
 
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
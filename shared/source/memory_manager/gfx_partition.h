@@ -9,6 +9,7 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/os_interface/os_memory.h"
+#include "shared/source/utilities/best_fit_heap_allocator.h"
 #include "shared/source/utilities/heap_allocator.h"
 
 #include <array>
@@ -107,6 +108,8 @@ class GfxPartition {
 
     bool isLimitedRange() { return getHeap(HeapIndex::HEAP_SVM).getSize() == 0ull; }
 
+    bool isBestFitAllocatorUsed(HeapIndex heapIndex) { return getHeap(heapIndex).isBestFitAllocatorUsed(); }
+
     static constexpr uint64_t heapGranularity = MemoryConstants::pageSize64k;
     static constexpr uint64_t heapGranularity2MB = 2 * MemoryConstants::megaByte;
     static constexpr size_t externalFrontWindowPoolSize = 16 * MemoryConstants::megaByte;
@@ -128,12 +131,24 @@ class GfxPartition {
         uint64_t getBase() const { return base; }
         uint64_t getSize() const { return size; }
         uint64_t getLimit() const { return size ? base + size - 1 : 0; }
-        uint64_t allocate(size_t &size) { return alloc->allocate(size); }
-        void free(uint64_t ptr, size_t size) { alloc->free(ptr, size); }
+        uint64_t allocate(size_t &size) { return bestFitAlloc ? bestFitAlloc->allocate(size) : alloc->allocate(size); }
+        void free(uint64_t ptr, size_t size) {
+            if (bestFitAlloc) {
+                bestFitAlloc->free(ptr, size);
+            } else {
+                alloc->free(ptr, size);
+            }
+        }
+        void selectBestFitAllocator(bool selected) { bestFitAllocatorSelected = selected; }
+        bool isBestFitAllocatorUsed() const { return bestFitAlloc != nullptr; }
 
       protected:
+        void createAllocator(uint64_t allocatorBase, uint64_t allocatorSize, size_t allocationAlignment, size_t threshold);
+
         uint64_t base = 0, size = 0;
+        bool bestFitAllocatorSelected = false;
         std::unique_ptr<HeapAllocator> alloc;
+        std::unique_ptr<BestFitHeapAllocator> bestFitAlloc;
     };
 
     Heap &getHeap(HeapIndex heapIndex) {
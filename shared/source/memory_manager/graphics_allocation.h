@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/helpers/common_types.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -139,6 +140,10 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
         allocationOffset = offset;
     }
 
+    // sub-devices allocation was created for, empty when it is used by whole root device
+    DeviceBitfield getSubDevicesBitfield() const { return subDevicesBitfield; }
+    void setSubDevicesBitfield(DeviceBitfield bitfield) { subDevicesBitfield = bitfield; }
+
     uint64_t getGpuBaseAddress() const {
         return gpuBaseAddress;
     }
@@ -169,6 +174,14 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     void setUncacheable(bool uncacheable) { allocationInfo.flags.uncacheable = uncacheable; }
     bool is32BitAllocation() const { return allocationInfo.flags.is32BitAllocation; }
     void set32BitAllocation(bool is32BitAllocation) { allocationInfo.flags.is32BitAllocation = is32BitAllocation; }
+    bool isMemoryUsageTracked() const { return allocationInfo.flags.memoryUsageTracked; }
+    void setMemoryUsageTracked(bool memoryUsageTracked) {
+        allocationInfo.flags.memoryUsageTracked = memoryUsageTracked;
+        memoryUsageAllocationType = allocationType;
+    }
+    AllocationType getMemoryUsageAllocationType() const { return memoryUsageAllocationType; }
+    bool isZeroInitPending() const { return allocationInfo.flags.zeroInitPending; }
+    void setZeroInitPending(bool zeroInitPending) { allocationInfo.flags.zeroInitPending = zeroInitPending; }
 
     void setAubWritable(bool writable, uint32_t banks);
     bool isAubWritable(uint32_t banks) const;
@@ -201,6 +214,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     void releaseUsageInOsContext(uint32_t contextId) { updateTaskCount(objectNotUsed, contextId); }
     uint32_t getInspectionId(uint32_t contextId) const { return usageInfos[contextId].inspectionId; }
     void setInspectionId(uint32_t newInspectionId, uint32_t contextId) { usageInfos[contextId].inspectionId = newInspectionId; }
+    uint32_t getSubmissionStamp(uint32_t contextId) const { return usageInfos[contextId].submissionStamp; }
+    void setSubmissionStamp(uint32_t newSubmissionStamp, uint32_t contextId) { usageInfos[contextId].submissionStamp = newSubmissionStamp; }
 
     bool isResident(uint32_t contextId) const { return GraphicsAllocation::objectNotResident != getResidencyTaskCount(contextId); }
     bool isAlwaysResident(uint32_t contextId) const { return GraphicsAllocation::objectAlwaysResident == getResidencyTaskCount(contextId); }
@@ -215,6 +230,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     virtual std::string getAllocationInfoString() const;
     virtual uint64_t peekInternalHandle(MemoryManager *memoryManager) { return 0llu; }
+    virtual int peekDmaBufFd(MemoryManager *memoryManager) { return -1; }
 
     static bool isCpuAccessRequired(AllocationType allocationType) {
         return allocationType == AllocationType::COMMAND_BUFFER ||
@@ -280,6 +296,13 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     const AubInfo &getAubInfo() const { return aubInfo; }
 
+    struct CompressionStatistics {
+        uint32_t statefulAccesses = 0u;
+        uint32_t statelessAccesses = 0u;
+        uint32_t cpuAccesses = 0u;
+    };
+    CompressionStatistics &getCompressionStatistics() { return compressionStatistics; }
+
     OsHandleStorage fragmentsStorage;
     StorageInfo storageInfo = {};
 
@@ -294,6 +317,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
         uint32_t taskCount = objectNotUsed;
         uint32_t residencyTaskCount = objectNotResident;
         uint32_t inspectionId = 0u;
+        uint32_t submissionStamp = 0u;
     };
 
     struct SharingInfo {
@@ -308,7 +332,9 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
                 uint32_t flushL3Required : 1;
                 uint32_t uncacheable : 1;
                 uint32_t is32BitAllocation : 1;
-                uint32_t reserved : 27;
+                uint32_t memoryUsageTracked : 1;
+                uint32_t zeroInitPending : 1;
+                uint32_t reserved : 25;
             } flags;
             uint32_t allFlags = 0u;
         };
@@ -333,6 +359,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     AubInfo aubInfo;
     SharingInfo sharingInfo;
     ReservedAddressRange reservedAddressRangeInfo;
+    CompressionStatistics compressionStatistics;
+    DeviceBitfield subDevicesBitfield;
 
     uint64_t allocationOffset = 0u;
     uint64_t gpuBaseAddress = 0;
@@ -344,6 +372,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     MemoryPool::Type memoryPool = MemoryPool::MemoryNull;
     AllocationType allocationType = AllocationType::UNKNOWN;
+    AllocationType memoryUsageAllocationType = AllocationType::UNKNOWN;
 
     StackVec<UsageInfo, 32> usageInfos;
     std::atomic<uint32_t> registeredContextsNum{0};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,7 +11,7 @@
 
 using namespace NEO;
 
-HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrEntryKey key) {
+HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrFragmentsContainer &partialAllocations, HostPtrEntryKey key) {
     auto nextElement = partialAllocations.lower_bound(key);
     auto element = nextElement;
     if (element != partialAllocations.end()) {
@@ -120,9 +120,11 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
 }
 
 void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    auto &shard = getShard(rootDeviceIndex);
+    auto &partialAllocations = shard.partialAllocations;
+    std::lock_guard<std::recursive_mutex> lock(shard.allocationsMutex);
     HostPtrEntryKey key{fragment.fragmentCpuPointer, rootDeviceIndex};
-    auto element = findElement(key);
+    auto element = findElement(partialAllocations, key);
     if (element != partialAllocations.end()) {
         element->second.refCount++;
     } else {
@@ -140,8 +142,8 @@ void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, AllocationStorageDa
     storeFragment(rootDeviceIndex, fragment);
 }
 
-std::unique_lock<std::recursive_mutex> HostPtrManager::obtainOwnership() {
-    return std::unique_lock<std::recursive_mutex>(allocationsMutex);
+std::unique_lock<std::recursive_mutex> HostPtrManager::obtainOwnership(uint32_t rootDeviceIndex) {
+    return std::unique_lock<std::recursive_mutex>(getShard(rootDeviceIndex).allocationsMutex);
 }
 
 void HostPtrManager::releaseHandleStorage(uint32_t rootDeviceIndex, OsHandleStorage &fragments) {
@@ -153,10 +155,12 @@ void HostPtrManager::releaseHandleStorage(uint32_t rootDeviceIndex, OsHandleStor
 }
 
 bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    auto &shard = getShard(rootDeviceIndex);
+    auto &partialAllocations = shard.partialAllocations;
+    std::lock_guard<std::recursive_mutex> lock(shard.allocationsMutex);
     bool fragmentReadyToBeReleased = false;
 
-    auto element = findElement({ptr, rootDeviceIndex});
+    auto element = findElement(partialAllocations, {ptr, rootDeviceIndex});
 
     DEBUG_BREAK_IF(element == partialAllocations.end());
 
@@ -170,8 +174,10 @@ bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
 }
 
 FragmentStorage *HostPtrManager::getFragment(HostPtrEntryKey key) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    auto element = findElement(key);
+    auto &shard = getShard(key.rootDeviceIndex);
+    auto &partialAllocations = shard.partialAllocations;
+    std::lock_guard<std::recursive_mutex> lock(shard.allocationsMutex);
+    auto element = findElement(partialAllocations, key);
     if (element != partialAllocations.end()) {
         return &element->second;
     }
@@ -180,7 +186,9 @@ FragmentStorage *HostPtrManager::getFragment(HostPtrEntryKey key) {
 
 //for given inputs see if any allocation overlaps
 FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inPtr, size_t size, OverlapStatus &overlappingStatus) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    auto &shard = getShard(rootDeviceIndex);
+    auto &partialAllocations = shard.partialAllocations;
+    std::lock_guard<std::recursive_mutex> lock(shard.allocationsMutex);
     void *inputPtr = const_cast<void *>(inPtr);
     auto nextElement = partialAllocations.lower_bound({inputPtr, rootDeviceIndex});
     auto element = nextElement;
@@ -245,7 +253,7 @@ FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(uint32_t rootDev
 }
 
 OsHandleStorage HostPtrManager::prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr, uint32_t rootDeviceIndex) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    std::lock_guard<std::recursive_mutex> lock(getShard(rootDeviceIndex).allocationsMutex);
     auto requirements = HostPtrManager::getAllocationRequirements(rootDeviceIndex, ptr, size);
     UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements) == RequirementsStatus::FATAL);
     auto osStorage = populateAlreadyAllocatedFragments(requirements);
@@ -269,8 +277,8 @@ RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager
         getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
                                        requirements->allocationFragments[i].allocationSize, overlapStatus);
         if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
-            // clean temporary allocations
-            memoryManager.cleanTemporaryAllocationListOnAllEngines(false);
+            // clean temporary allocations, only engines of the same root device can hold fragments of this shard
+            memoryManager.cleanTemporaryAllocationListOnAllEngines(requirements->rootDeviceIndex, false);
 
             // check overlapping again
             getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
@@ -278,7 +286,7 @@ RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager
             if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
 
                 // Wait for completion
-                memoryManager.cleanTemporaryAllocationListOnAllEngines(true);
+                memoryManager.cleanTemporaryAllocationListOnAllEngines(requirements->rootDeviceIndex, true);
 
                 // check overlapping last time
                 getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/memory_manager/host_ptr_defines.h"
 
+#include <array>
 #include <map>
 #include <mutex>
 
@@ -33,7 +34,9 @@ class HostPtrManager {
     bool releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr);
     void storeFragment(uint32_t rootDeviceIndex, AllocationStorageData &storageData);
     void storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment);
-    std::unique_lock<std::recursive_mutex> obtainOwnership();
+    std::unique_lock<std::recursive_mutex> obtainOwnership(uint32_t rootDeviceIndex);
+
+    static constexpr uint32_t shardsCount = 4u;
 
   protected:
     static AllocationRequirements getAllocationRequirements(uint32_t rootDeviceIndex, const void *inputPtr, size_t size);
@@ -41,8 +44,14 @@ class HostPtrManager {
     FragmentStorage *getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inputPtr, size_t size, OverlapStatus &overlappingStatus);
     RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements);
 
-    HostPtrFragmentsContainer::iterator findElement(HostPtrEntryKey key);
-    HostPtrFragmentsContainer partialAllocations;
-    std::recursive_mutex allocationsMutex;
+    // fragments never overlap across root devices, so each root device is guarded by its shard lock only
+    struct FragmentsShard {
+        HostPtrFragmentsContainer partialAllocations;
+        std::recursive_mutex allocationsMutex;
+    };
+    FragmentsShard &getShard(uint32_t rootDeviceIndex) { return shards[rootDeviceIndex % shardsCount]; }
+
+    static HostPtrFragmentsContainer::iterator findElement(HostPtrFragmentsContainer &partialAllocations, HostPtrEntryKey key);
+    std::array<FragmentsShard, shardsCount> shards;
 };
 } // namespace NEO
@@ -8,6 +8,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -45,7 +46,7 @@ void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint
 
 void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList) {
     auto memoryManager = commandStreamReceiver.getMemoryManager();
-    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership(commandStreamReceiver.getRootDeviceIndex());
 
     GraphicsAllocation *curr = allocationsList.detachNodes();
 
@@ -94,7 +95,12 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
     req.contextId = commandStreamReceiver.getOsContext().getContextId();
     req.requiredPtr = requiredPtr;
     GraphicsAllocation *a = nullptr;
-    GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
+    GraphicsAllocation *retAlloc = nullptr;
+    if (isIndexed() && requiredPtr == nullptr) {
+        retAlloc = processLocked<AllocationsList, &AllocationsList::detachIndexedAllocationImpl>(a, static_cast<void *>(&req));
+    } else {
+        retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
+    }
     return std::unique_ptr<GraphicsAllocation>(retAlloc);
 }
 
@@ -110,13 +116,149 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
                 // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
                 curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
             }
-            return removeOneImpl(curr, nullptr);
+            return removeOneIndexedImpl(curr, nullptr);
         }
         curr = curr->next;
     }
     return nullptr;
 }
 
+GraphicsAllocation *AllocationsList::detachIndexedAllocationImpl(GraphicsAllocation *, void *data) {
+    ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
+    // buckets of the required size class may hold smaller allocations, all following size classes fit
+    for (auto bucket = reuseIndex.lower_bound({req->allocationType, getSizeClass(req->requiredMinimalSize)});
+         bucket != reuseIndex.end() && bucket->first.first == req->allocationType; bucket++) {
+        for (auto allocation : bucket->second) {
+            if ((allocation->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
+                (*req->csrTagAddress >= allocation->getTaskCount(req->contextId))) {
+                return removeOneIndexedImpl(allocation, nullptr);
+            }
+        }
+    }
+    return nullptr;
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &allocation) {
+    processLocked<AllocationsList, &AllocationsList::pushFrontOneIndexedImpl>(&allocation);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &allocation) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneIndexedImpl>(&allocation);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &allocation) {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeOneIndexedImpl>(&allocation));
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeFrontOneIndexedImpl>(nullptr));
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    return processLocked<AllocationsList, &AllocationsList::detachSequenceIndexedImpl>(&first, &last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesIndexedImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &allocations) {
+    processLocked<AllocationsList, &AllocationsList::spliceIndexedImpl>(&allocations);
+}
+
+void AllocationsList::deleteAll() {
+    GraphicsAllocation *allocations = detachNodes();
+    if (allocations != nullptr) {
+        allocations->deleteThisAndAllNext();
+    }
+}
+
+size_t AllocationsList::peekIndexedAllocationsCount() {
+    size_t count = 0u;
+    processLocked<AllocationsList, &AllocationsList::peekIndexedAllocationsCountImpl>(nullptr, &count);
+    return count;
+}
+
+GraphicsAllocation *AllocationsList::pushFrontOneIndexedImpl(GraphicsAllocation *allocation, void *) {
+    pushFrontOneImpl(allocation, nullptr);
+    addToIndex(*allocation, true);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::pushTailOneIndexedImpl(GraphicsAllocation *allocation, void *) {
+    pushTailOneImpl(allocation, nullptr);
+    addToIndex(*allocation, false);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::removeOneIndexedImpl(GraphicsAllocation *allocation, void *) {
+    removeFromIndex(*allocation);
+    return removeOneImpl(allocation, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFrontOneIndexedImpl(GraphicsAllocation *, void *) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    return removeOneIndexedImpl(head, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachSequenceIndexedImpl(GraphicsAllocation *first, void *last) {
+    auto lastAllocation = static_cast<GraphicsAllocation *>(last);
+    for (auto curr = first; curr != nullptr; curr = curr->next) {
+        removeFromIndex(*curr);
+        if (curr == lastAllocation) {
+            break;
+        }
+    }
+    return detachSequenceImpl(first, last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodesIndexedImpl(GraphicsAllocation *, void *) {
+    reuseIndex.clear();
+    reuseIndexEntries.clear();
+    return detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceIndexedImpl(GraphicsAllocation *allocations, void *) {
+    for (auto curr = allocations; curr != nullptr; curr = curr->next) {
+        addToIndex(*curr, false);
+    }
+    return spliceImpl(allocations, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::peekIndexedAllocationsCountImpl(GraphicsAllocation *, void *data) {
+    *static_cast<size_t *>(data) = reuseIndexEntries.size();
+    return nullptr;
+}
+
+uint32_t AllocationsList::getSizeClass(size_t size) {
+    return size == 0u ? 0u : Math::log2(static_cast<uint64_t>(size));
+}
+
+void AllocationsList::addToIndex(GraphicsAllocation &allocation, bool pushFront) {
+    if (!isIndexed()) {
+        return;
+    }
+    auto key = IndexKey{allocation.getAllocationType(), getSizeClass(allocation.getUnderlyingBufferSize())};
+    auto &bucket = reuseIndex[key];
+    auto position = pushFront ? bucket.insert(bucket.begin(), &allocation) : bucket.insert(bucket.end(), &allocation);
+    reuseIndexEntries[&allocation] = {key, position};
+}
+
+void AllocationsList::removeFromIndex(GraphicsAllocation &allocation) {
+    auto entry = reuseIndexEntries.find(&allocation);
+    if (entry == reuseIndexEntries.end()) {
+        return;
+    }
+    auto bucket = reuseIndex.find(entry->second.key);
+    bucket->second.erase(entry->second.position);
+    if (bucket->second.empty()) {
+        reuseIndex.erase(bucket);
+    }
+    reuseIndexEntries.erase(entry);
+}
+
 DeviceBitfield InternalAllocationStorage::getDeviceBitfield() const {
     return commandStreamReceiver.getOsContext().getDeviceBitfield();
 }
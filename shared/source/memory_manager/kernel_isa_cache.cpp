@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/kernel_isa_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <cstring>
+
+namespace NEO {
+
+KernelIsaCache::~KernelIsaCache() {
+    // owners release shared ISA before memory manager is destroyed
+    DEBUG_BREAK_IF(false == entries.empty());
+}
+
+bool KernelIsaCache::isEnabled() {
+    return DebugManager.flags.EnableKernelIsaDeduplication.get() == 1;
+}
+
+GraphicsAllocation *KernelIsaCache::obtainAllocation(const Device &device, const void *isa, size_t isaSize, GraphicsAllocation::AllocationType allocationType) {
+    auto isaBytes = reinterpret_cast<const char *>(isa);
+    auto hash = Hash::hash(isaBytes, isaSize);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto matchingEntries = entries.equal_range(hash);
+    for (auto it = matchingEntries.first; it != matchingEntries.second; ++it) {
+        auto &entry = it->second;
+        if (entry.allocation->getRootDeviceIndex() == device.getRootDeviceIndex() && entry.deviceBitfield == device.getDeviceBitfield() &&
+            entry.allocation->getAllocationType() == allocationType && entry.isa.size() == isaSize &&
+            0 == memcmp(entry.isa.data(), isaBytes, isaSize)) {
+            entry.refCount++;
+            return entry.allocation;
+        }
+    }
+
+    auto allocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(), isaSize, allocationType, device.getDeviceBitfield()});
+    if (nullptr == allocation) {
+        return nullptr;
+    }
+
+    auto &hwInfo = device.getHardwareInfo();
+    auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+    if (false == MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation),
+                                                                  device, allocation, 0, isa, isaSize)) {
+        device.getMemoryManager()->freeGraphicsMemory(allocation);
+        return nullptr;
+    }
+
+    Entry entry;
+    entry.isa.assign(isaBytes, isaBytes + isaSize);
+    entry.allocation = allocation;
+    entry.deviceBitfield = device.getDeviceBitfield();
+    entry.refCount = 1;
+    entries.emplace(hash, std::move(entry));
+    allocationHashes[allocation] = hash;
+    return allocation;
+}
+
+bool KernelIsaCache::releaseAllocation(GraphicsAllocation *allocation) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto hashIt = allocationHashes.find(allocation);
+    if (allocationHashes.end() == hashIt) {
+        return true;
+    }
+
+    auto matchingEntries = entries.equal_range(hashIt->second);
+    for (auto it = matchingEntries.first; it != matchingEntries.second; ++it) {
+        if (it->second.allocation != allocation) {
+            continue;
+        }
+        if (--it->second.refCount > 0) {
+            return false;
+        }
+        entries.erase(it);
+        break;
+    }
+    allocationHashes.erase(hashIt);
+    return true;
+}
+
+size_t KernelIsaCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+} // namespace NEO
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Device;
+
+// Read-only ISA allocations shared by kernels with identical binary on the same device.
+// Allocation is freed by last user, release returns true when it is no longer referenced.
+class KernelIsaCache : NonCopyableOrMovableClass {
+  public:
+    KernelIsaCache() = default;
+    ~KernelIsaCache();
+
+    static bool isEnabled();
+
+    GraphicsAllocation *obtainAllocation(const Device &device, const void *isa, size_t isaSize, GraphicsAllocation::AllocationType allocationType);
+    bool releaseAllocation(GraphicsAllocation *allocation);
+
+    size_t getEntriesCount() const;
+
+  protected:
+    struct Entry {
+        std::vector<char> isa;
+        GraphicsAllocation *allocation = nullptr;
+        DeviceBitfield deviceBitfield;
+        uint32_t refCount = 0;
+    };
+
+    std::unordered_multimap<uint64_t, Entry> entries;
+    std::unordered_map<GraphicsAllocation *, uint64_t> allocationHashes;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,8 +20,15 @@ LocalMemoryUsageBankSelector::LocalMemoryUsageBankSelector(uint32_t banksCount)
     UNRECOVERABLE_IF(banksCount == 0);
 
     memorySizes.reset(new std::atomic<uint64_t>[banksCount]);
+    accessedSizes.reset(new std::atomic<uint64_t>[banksCount]);
+    placementsCounts.reset(new std::atomic<uint64_t>[banksCount]);
     for (uint32_t i = 0; i < banksCount; i++) {
         memorySizes[i] = 0;
+        accessedSizes[i] = 0;
+        placementsCounts[i] = 0;
+    }
+    for (auto &policyPlacementsCount : policyPlacementsCounts) {
+        policyPlacementsCount = 0;
     }
 }
 
@@ -45,6 +52,95 @@ uint32_t LocalMemoryUsageBankSelector::getLeastOccupiedBank(DeviceBitfield devic
     return leastOccupiedBank;
 }
 
+uint32_t LocalMemoryUsageBankSelector::getLeastAccessedBank(DeviceBitfield deviceBitfield) {
+    uint32_t leastAccessedBank = 0u;
+    uint64_t smallestAccessedSize = std::numeric_limits<uint64_t>::max();
+    uint64_t smallestMemorySize = std::numeric_limits<uint64_t>::max();
+
+    UNRECOVERABLE_IF(deviceBitfield.count() == 0);
+    for (uint32_t i = 0u; i < banksCount; i++) {
+        if (deviceBitfield.test(i)) {
+            uint64_t accessedSize = accessedSizes[i];
+            uint64_t memorySize = memorySizes[i];
+            if (accessedSize < smallestAccessedSize || (accessedSize == smallestAccessedSize && memorySize < smallestMemorySize)) {
+                leastAccessedBank = i;
+                smallestAccessedSize = accessedSize;
+                smallestMemorySize = memorySize;
+            }
+        }
+    }
+
+    return leastAccessedBank;
+}
+
+uint32_t LocalMemoryUsageBankSelector::getAvailableBanks(DeviceBitfield deviceBitfield) const {
+    uint32_t memoryBanks = 0u;
+    for (uint32_t i = 0u; i < banksCount && i < 32u; i++) {
+        if (deviceBitfield.test(i)) {
+            memoryBanks |= (1u << i);
+        }
+    }
+    return memoryBanks;
+}
+
+uint64_t LocalMemoryUsageBankSelector::getInterleaveChunkSize() const {
+    if (DebugManager.flags.BankInterleaveChunkSize.get() > 0) {
+        return static_cast<uint64_t>(DebugManager.flags.BankInterleaveChunkSize.get());
+    }
+    return defaultInterleaveChunkSize;
+}
+
+BankPlacement LocalMemoryUsageBankSelector::selectBanks(DeviceBitfield deviceBitfield, uint64_t allocationSize, BankPlacementPolicy policy) {
+    if (DebugManager.flags.OverrideBankPlacementPolicy.get() != -1) {
+        policy = static_cast<BankPlacementPolicy>(DebugManager.flags.OverrideBankPlacementPolicy.get());
+    }
+
+    BankPlacement placement;
+    if (policy == BankPlacementPolicy::Interleaved) {
+        auto availableBanks = getAvailableBanks(deviceBitfield);
+        if (std::bitset<32>(availableBanks).count() > 1 && allocationSize >= 2 * getInterleaveChunkSize()) {
+            placement.memoryBanks = availableBanks;
+            placement.interleaved = true;
+            recordPlacement(placement.memoryBanks, policy);
+            return placement;
+        }
+        policy = BankPlacementPolicy::BandwidthBalanced;
+    }
+
+    if (policy == BankPlacementPolicy::BandwidthBalanced) {
+        placement.memoryBanks = 1u << getLeastAccessedBank(deviceBitfield);
+    } else {
+        policy = BankPlacementPolicy::LeastOccupied;
+        placement.memoryBanks = 1u << getLeastOccupiedBank(deviceBitfield);
+    }
+    recordPlacement(placement.memoryBanks, policy);
+    return placement;
+}
+
+void LocalMemoryUsageBankSelector::recordPlacement(uint32_t memoryBanks, BankPlacementPolicy policy) {
+    policyPlacementsCounts[static_cast<uint32_t>(policy)]++;
+    auto banks = std::bitset<32>(memoryBanks);
+    for (uint32_t bankIndex = 0; bankIndex < banks.size() && bankIndex < banksCount; bankIndex++) {
+        if (banks.test(bankIndex)) {
+            placementsCounts[bankIndex]++;
+        }
+    }
+}
+
+void LocalMemoryUsageBankSelector::recordAccess(uint32_t memoryBanks, uint64_t accessedSize) {
+    auto banks = std::bitset<32>(memoryBanks);
+    auto banksUsed = banks.count();
+    if (banksUsed == 0u) {
+        return;
+    }
+    auto accessedSizePerBank = accessedSize / banksUsed;
+    for (uint32_t bankIndex = 0; bankIndex < banks.size() && bankIndex < banksCount; bankIndex++) {
+        if (banks.test(bankIndex)) {
+            accessedSizes[bankIndex] += accessedSizePerBank;
+        }
+    }
+}
+
 void LocalMemoryUsageBankSelector::freeOnBank(uint32_t bankIndex, uint64_t allocationSize) {
     UNRECOVERABLE_IF(bankIndex >= banksCount);
     memorySizes[bankIndex] -= allocationSize;
@@ -67,4 +163,39 @@ void LocalMemoryUsageBankSelector::updateUsageInfo(uint32_t memoryBanks, uint64_
     }
 }
 
+void LocalMemoryUsageBankSelector::updateInterleavedUsageInfo(uint32_t memoryBanks, uint64_t allocationSize, bool reserve) {
+    auto banks = std::bitset<32>(memoryBanks);
+    uint64_t banksUsed = 0u;
+    for (uint32_t bankIndex = 0; bankIndex < banks.size() && bankIndex < banksCount; bankIndex++) {
+        banksUsed += banks.test(bankIndex) ? 1u : 0u;
+    }
+    if (banksUsed == 0u) {
+        return;
+    }
+
+    // chunks are placed round robin starting from the lowest bank, the last chunk may be partial
+    auto chunkSize = getInterleaveChunkSize();
+    auto chunksCount = (allocationSize + chunkSize - 1) / chunkSize;
+    auto lastChunkBank = (chunksCount - 1) % banksUsed;
+    auto lastChunkTail = chunksCount * chunkSize - allocationSize;
+
+    uint64_t bankOrdinal = 0u;
+    for (uint32_t bankIndex = 0; bankIndex < banks.size() && bankIndex < banksCount; bankIndex++) {
+        if (!banks.test(bankIndex)) {
+            continue;
+        }
+        auto chunksOnBank = chunksCount / banksUsed + (bankOrdinal < chunksCount % banksUsed ? 1u : 0u);
+        auto sizeOnBank = chunksOnBank * chunkSize;
+        if (bankOrdinal == lastChunkBank) {
+            sizeOnBank -= lastChunkTail;
+        }
+        if (reserve) {
+            reserveOnBank(bankIndex, sizeOnBank);
+        } else {
+            freeOnBank(bankIndex, sizeOnBank);
+        }
+        bankOrdinal++;
+    }
+}
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,28 +15,71 @@
 #include <memory>
 
 namespace NEO {
+enum class BankPlacementPolicy : uint32_t {
+    LeastOccupied = 0,
+    BandwidthBalanced,
+    Interleaved,
+    Count
+};
+
+struct BankPlacement {
+    uint32_t memoryBanks = 0u;
+    bool interleaved = false;
+};
+
 class LocalMemoryUsageBankSelector : public NonCopyableOrMovableClass {
   public:
+    static constexpr uint64_t defaultInterleaveChunkSize = 64 * 1024;
+
     LocalMemoryUsageBankSelector() = delete;
     LocalMemoryUsageBankSelector(uint32_t banksCount);
     uint32_t getLeastOccupiedBank(DeviceBitfield deviceBitfield);
+    BankPlacement selectBanks(DeviceBitfield deviceBitfield, uint64_t allocationSize, BankPlacementPolicy policy);
+
     void reserveOnBanks(uint32_t memoryBanks, uint64_t allocationSize) {
         updateUsageInfo(memoryBanks, allocationSize, true);
     }
     void freeOnBanks(uint32_t memoryBanks, uint64_t allocationSize) {
         updateUsageInfo(memoryBanks, allocationSize, false);
     }
+    void reserveInterleavedOnBanks(uint32_t memoryBanks, uint64_t allocationSize) {
+        updateInterleavedUsageInfo(memoryBanks, allocationSize, true);
+    }
+    void freeInterleavedOnBanks(uint32_t memoryBanks, uint64_t allocationSize) {
+        updateInterleavedUsageInfo(memoryBanks, allocationSize, false);
+    }
+    void recordAccess(uint32_t memoryBanks, uint64_t accessedSize);
 
     uint64_t getOccupiedMemorySizeForBank(uint32_t bankIndex) {
         UNRECOVERABLE_IF(bankIndex >= banksCount);
         return memorySizes[bankIndex].load();
     }
+    uint64_t getAccessedMemorySizeForBank(uint32_t bankIndex) {
+        UNRECOVERABLE_IF(bankIndex >= banksCount);
+        return accessedSizes[bankIndex].load();
+    }
+    uint64_t getPlacementsCountForBank(uint32_t bankIndex) {
+        UNRECOVERABLE_IF(bankIndex >= banksCount);
+        return placementsCounts[bankIndex].load();
+    }
+    uint64_t getPlacementsCount(BankPlacementPolicy policy) {
+        UNRECOVERABLE_IF(policy >= BankPlacementPolicy::Count);
+        return policyPlacementsCounts[static_cast<uint32_t>(policy)].load();
+    }
+    uint64_t getInterleaveChunkSize() const;
 
   protected:
     uint32_t banksCount = 0;
     std::unique_ptr<std::atomic<uint64_t>[]> memorySizes = nullptr;
+    std::unique_ptr<std::atomic<uint64_t>[]> accessedSizes = nullptr;
+    std::unique_ptr<std::atomic<uint64_t>[]> placementsCounts = nullptr;
+    std::atomic<uint64_t> policyPlacementsCounts[static_cast<uint32_t>(BankPlacementPolicy::Count)];
     void updateUsageInfo(uint32_t memoryBanks, uint64_t allocationSize, bool reserve);
+    void updateInterleavedUsageInfo(uint32_t memoryBanks, uint64_t allocationSize, bool reserve);
     void freeOnBank(uint32_t bankIndex, uint64_t allocationSize);
     void reserveOnBank(uint32_t bankIndex, uint64_t allocationSize);
+    uint32_t getLeastAccessedBank(DeviceBitfield deviceBitfield);
+    uint32_t getAvailableBanks(DeviceBitfield deviceBitfield) const;
+    void recordPlacement(uint32_t memoryBanks, BankPlacementPolicy policy);
 };
 } // namespace NEO
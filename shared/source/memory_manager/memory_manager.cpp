@@ -38,7 +38,8 @@ namespace NEO {
 uint32_t MemoryManager::maxOsContextCount = 0u;
 
 MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : executionEnvironment(executionEnvironment), hostPtrManager(std::make_unique<HostPtrManager>()),
-                                                                           multiContextResourceDestructor(std::make_unique<DeferredDeleter>()) {
+                                                                           multiContextResourceDestructor(std::make_unique<DeferredDeleter>()),
+                                                                           kernelIsaCache(std::make_unique<KernelIsaCache>()) {
 
     bool anyLocalMemorySupported = false;
 
@@ -46,6 +47,7 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < executionEnvironment.rootDeviceEnvironments.size(); ++rootDeviceIndex) {
         auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
         localMemoryUsageBankSelector.emplace_back(new LocalMemoryUsageBankSelector(HwHelper::getSubDevicesCount(hwInfo)));
+        memoryUsageStatistics.push_back(std::make_unique<MemoryUsageStatistics>());
         this->localMemorySupported.push_back(HwHelper::get(hwInfo->platform.eRenderCoreFamily).getEnableLocalMemory(*hwInfo));
         this->enable64kbpages.push_back(OSInterface::osEnabled64kbPages && hwInfo->capabilityTable.ftr64KBpages && !!DebugManager.flags.Enable64kbpages.get());
 
@@ -64,6 +66,11 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
 }
 
 MemoryManager::~MemoryManager() {
+    if (DebugManager.flags.PrintMemoryUsageStatistics.get() > 0) {
+        for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < memoryUsageStatistics.size(); rootDeviceIndex++) {
+            memoryUsageStatistics[rootDeviceIndex]->print(rootDeviceIndex);
+        }
+    }
     for (auto &engine : registeredEngines) {
         engine.osContext->decRefInternal();
     }
@@ -192,6 +199,13 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation) {
     if (ApiSpecificConfig::getBindlessConfiguration() && executionEnvironment.rootDeviceEnvironments[gfxAllocation->getRootDeviceIndex()]->getBindlessHeapsHelper() != nullptr) {
         executionEnvironment.rootDeviceEnvironments[gfxAllocation->getRootDeviceIndex()]->getBindlessHeapsHelper()->placeSSAllocationInReuseVectorOnFreeMemory(gfxAllocation);
     }
+    if (gfxAllocation->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
+        auto &compressionStatistics = gfxAllocation->getCompressionStatistics();
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintCompressionStatistics.get(), stdout,
+                           "Compressed allocation 0x%llx size %zu: stateful accesses %u, stateless accesses %u, CPU accesses %u\n",
+                           gfxAllocation->getGpuAddress(), gfxAllocation->getUnderlyingBufferSize(),
+                           compressionStatistics.statefulAccesses, compressionStatistics.statelessAccesses, compressionStatistics.cpuAccesses);
+    }
     const bool hasFragments = gfxAllocation->fragmentsStorage.fragmentCount != 0;
     const bool isLocked = gfxAllocation->isLocked();
     DEBUG_BREAK_IF(hasFragments && isLocked);
@@ -203,7 +217,12 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation) {
         freeAssociatedResourceImpl(*gfxAllocation);
     }
 
-    localMemoryUsageBankSelector[gfxAllocation->getRootDeviceIndex()]->freeOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
+    if (gfxAllocation->storageInfo.multiStorage) {
+        localMemoryUsageBankSelector[gfxAllocation->getRootDeviceIndex()]->freeInterleavedOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
+    } else {
+        localMemoryUsageBankSelector[gfxAllocation->getRootDeviceIndex()]->freeOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
+    }
+    unregisterMemoryUsage(*gfxAllocation);
     freeGraphicsMemoryImpl(gfxAllocation);
 }
 //if not in use destroy in place
@@ -446,18 +465,48 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(const A
     AllocationStatus status = AllocationStatus::Error;
     GraphicsAllocation *allocation = allocateGraphicsMemoryInDevicePool(allocationData, status);
     if (allocation) {
-        localMemoryUsageBankSelector[properties.rootDeviceIndex]->reserveOnBanks(allocationData.storageInfo.getMemoryBanks(), allocation->getUnderlyingBufferSize());
+        if (allocationData.storageInfo.multiStorage) {
+            localMemoryUsageBankSelector[properties.rootDeviceIndex]->reserveInterleavedOnBanks(allocationData.storageInfo.getMemoryBanks(), allocation->getUnderlyingBufferSize());
+        } else {
+            localMemoryUsageBankSelector[properties.rootDeviceIndex]->reserveOnBanks(allocationData.storageInfo.getMemoryBanks(), allocation->getUnderlyingBufferSize());
+        }
+        if (properties.subDevicesBitfield.count() < HwHelper::getSubDevicesCount(executionEnvironment.rootDeviceEnvironments[properties.rootDeviceIndex]->getHardwareInfo())) {
+            allocation->setSubDevicesBitfield(properties.subDevicesBitfield);
+        }
         this->registerLocalMemAlloc(allocation, properties.rootDeviceIndex);
     }
     if (!allocation && status == AllocationStatus::RetryInNonDevicePool) {
         allocation = allocateGraphicsMemory(allocationData);
         this->registerSysMemAlloc(allocation);
     }
+    if (allocation) {
+        registerMemoryUsage(*allocation);
+    }
     FileLoggerInstance().logAllocation(allocation);
     registerAllocationInOs(allocation);
     return allocation;
 }
 
+void MemoryManager::registerMemoryUsage(GraphicsAllocation &allocation) {
+    auto rootDeviceIndex = allocation.getRootDeviceIndex();
+    auto &statistics = *memoryUsageStatistics[rootDeviceIndex];
+    auto allocationsCount = statistics.registerAllocation(allocation.getAllocationType(), allocation.getMemoryPool(), allocation.getUnderlyingBufferSize());
+    allocation.setMemoryUsageTracked(true);
+
+    auto printInterval = DebugManager.flags.PrintMemoryUsageStatistics.get();
+    if (printInterval > 0 && allocationsCount % static_cast<uint64_t>(printInterval) == 0u) {
+        statistics.print(rootDeviceIndex);
+    }
+}
+
+void MemoryManager::unregisterMemoryUsage(GraphicsAllocation &allocation) {
+    if (!allocation.isMemoryUsageTracked()) {
+        return;
+    }
+    memoryUsageStatistics[allocation.getRootDeviceIndex()]->unregisterAllocation(allocation.getMemoryUsageAllocationType(), allocation.getMemoryPool(), allocation.getUnderlyingBufferSize());
+    allocation.setMemoryUsageTracked(false);
+}
+
 GraphicsAllocation *MemoryManager::allocateInternalGraphicsMemoryWithHostCopy(uint32_t rootDeviceIndex,
                                                                               DeviceBitfield bitField,
                                                                               const void *ptr,
@@ -608,6 +657,11 @@ HeapIndex MemoryManager::selectHeap(const GraphicsAllocation *allocation, bool h
     return HeapIndex::HEAP_STANDARD;
 }
 
+bool MemoryManager::mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuAddress) {
+    physicalAllocation->setCpuPtrAndGpuAddress(physicalAllocation->getUnderlyingBuffer(), gpuAddress);
+    return true;
+}
+
 bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy) {
     if (!graphicsAllocation->getUnderlyingBuffer()) {
         return false;
@@ -627,9 +681,16 @@ void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocat
     }
 }
 
-void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion) {
+void MemoryManager::cleanTemporaryAllocationListOnAllEngines(uint32_t rootDeviceIndex, bool waitForCompletion) {
     for (auto &engine : getRegisteredEngines()) {
         auto csr = engine.commandStreamReceiver;
+        if (csr->getRootDeviceIndex() != rootDeviceIndex) {
+            continue;
+        }
+        if (!csr->getTagAddress()) {
+            // engine initialization deferred, nothing was submitted yet
+            continue;
+        }
         if (waitForCompletion) {
             csr->waitForCompletionWithTimeout(false, 0, csr->peekLatestSentTaskCount());
         }
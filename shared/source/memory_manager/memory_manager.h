@@ -17,7 +17,9 @@
 #include "shared/source/memory_manager/gfx_partition.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/host_ptr_defines.h"
+#include "shared/source/memory_manager/kernel_isa_cache.h"
 #include "shared/source/memory_manager/local_memory_usage.h"
+#include "shared/source/memory_manager/memory_usage_statistics.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
@@ -88,6 +90,8 @@ class MemoryManager {
     virtual bool verifyHandle(osHandle handle, uint32_t rootDeviceIndex, bool) { return true; }
     virtual GraphicsAllocation *createGraphicsAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool requireSpecificBitness) = 0;
     virtual void closeSharedHandle(GraphicsAllocation *graphicsAllocation){};
+    // identifies buffer behind shared handle, 0 when handle cannot be told apart from reused one
+    virtual uint64_t getSharedHandleIdentity(osHandle handle) { return 0u; }
     virtual GraphicsAllocation *createGraphicsAllocationFromNTHandle(void *handle, uint32_t rootDeviceIndex) = 0;
 
     virtual bool mapAuxGpuVA(GraphicsAllocation *graphicsAllocation);
@@ -137,9 +141,13 @@ class MemoryManager {
         return pageFaultManager.get();
     }
 
+    KernelIsaCache &getKernelIsaCache() const {
+        return *kernelIsaCache;
+    }
+
     void waitForDeletions();
     MOCKABLE_VIRTUAL void waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation);
-    void cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion);
+    void cleanTemporaryAllocationListOnAllEngines(uint32_t rootDeviceIndex, bool waitForCompletion);
 
     bool isAsyncDeleterEnabled() const;
     bool isLocalMemorySupported(uint32_t rootDeviceIndex) const;
@@ -185,8 +193,11 @@ class MemoryManager {
     virtual void releaseReservedCpuAddressRange(void *reserved, size_t size, uint32_t rootDeviceIndex){};
     void *getReservedMemory(size_t size, size_t alignment);
     GfxPartition *getGfxPartition(uint32_t rootDeviceIndex) { return gfxPartitions.at(rootDeviceIndex).get(); }
+    LocalMemoryUsageBankSelector *getLocalMemoryUsageBankSelector(uint32_t rootDeviceIndex) { return localMemoryUsageBankSelector.at(rootDeviceIndex).get(); }
+    const MemoryUsageStatistics &getMemoryUsageStatistics(uint32_t rootDeviceIndex) const { return *memoryUsageStatistics.at(rootDeviceIndex); }
     virtual AddressRange reserveGpuAddress(size_t size, uint32_t rootDeviceIndex) = 0;
     virtual void freeGpuAddress(AddressRange addressRange, uint32_t rootDeviceIndex) = 0;
+    virtual bool mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuAddress);
     static HeapIndex selectInternalHeap(bool useLocalMemory) { return useLocalMemory ? HeapIndex::HEAP_INTERNAL_DEVICE_MEMORY : HeapIndex::HEAP_INTERNAL; }
     static HeapIndex selectExternalHeap(bool useLocalMemory) { return useLocalMemory ? HeapIndex::HEAP_EXTERNAL_DEVICE_MEMORY : HeapIndex::HEAP_EXTERNAL; }
 
@@ -226,6 +237,8 @@ class MemoryManager {
     virtual void freeAssociatedResourceImpl(GraphicsAllocation &graphicsAllocation) { return unlockResourceImpl(graphicsAllocation); };
     virtual void registerAllocationInOs(GraphicsAllocation *allocation) {}
     bool isAllocationTypeToCapture(GraphicsAllocation::AllocationType type) const;
+    void registerMemoryUsage(GraphicsAllocation &allocation);
+    void unregisterMemoryUsage(GraphicsAllocation &allocation);
 
     bool initialized = false;
     bool forceNonSvmForExternalHostPtr = false;
@@ -244,8 +257,10 @@ class MemoryManager {
     std::unique_ptr<DeferredDeleter> multiContextResourceDestructor;
     std::vector<std::unique_ptr<GfxPartition>> gfxPartitions;
     std::vector<std::unique_ptr<LocalMemoryUsageBankSelector>> localMemoryUsageBankSelector;
+    std::vector<std::unique_ptr<MemoryUsageStatistics>> memoryUsageStatistics;
     void *reservedMemory = nullptr;
     std::unique_ptr<PageFaultManager> pageFaultManager;
+    std::unique_ptr<KernelIsaCache> kernelIsaCache;
     OSMemory::ReservedCpuAddressRange reservedCpuAddressRange;
     HeapAssigner heapAssigner;
 };
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/memory_usage_statistics.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace NEO {
+
+uint64_t MemoryUsageStatistics::registerAllocation(GraphicsAllocation::AllocationType allocationType, MemoryPool::Type memoryPool, uint64_t size) {
+    auto typeIndex = static_cast<uint32_t>(allocationType);
+    UNRECOVERABLE_IF(typeIndex >= allocationTypesCount);
+    add(counters[typeIndex][getPoolIndex(memoryPool)], size);
+    return add(totalCounters, size);
+}
+
+void MemoryUsageStatistics::unregisterAllocation(GraphicsAllocation::AllocationType allocationType, MemoryPool::Type memoryPool, uint64_t size) {
+    auto typeIndex = static_cast<uint32_t>(allocationType);
+    UNRECOVERABLE_IF(typeIndex >= allocationTypesCount);
+    remove(counters[typeIndex][getPoolIndex(memoryPool)], size);
+    remove(totalCounters, size);
+}
+
+MemoryUsageStatistics::Counters MemoryUsageStatistics::getCounters(GraphicsAllocation::AllocationType allocationType, MemoryPool::Type memoryPool) const {
+    auto typeIndex = static_cast<uint32_t>(allocationType);
+    UNRECOVERABLE_IF(typeIndex >= allocationTypesCount);
+    return load(counters[typeIndex][getPoolIndex(memoryPool)]);
+}
+
+MemoryUsageStatistics::Counters MemoryUsageStatistics::getTotalCounters() const {
+    return load(totalCounters);
+}
+
+void MemoryUsageStatistics::print(uint32_t rootDeviceIndex) const {
+    for (uint32_t typeIndex = 0u; typeIndex < allocationTypesCount; typeIndex++) {
+        for (uint32_t poolIndex = 0u; poolIndex < memoryPoolsCount; poolIndex++) {
+            auto current = load(counters[typeIndex][poolIndex]);
+            if (current.allocationsCount == 0u) {
+                continue;
+            }
+            printf("Memory usage: root device %u, allocation type %u, memory pool %u: current %" PRIu64 " bytes in %" PRIu64 " allocations, peak %" PRIu64 " bytes, allocated %" PRIu64 " times, freed %" PRIu64 " times\n",
+                   rootDeviceIndex, typeIndex, poolIndex, current.currentSize, current.currentCount, current.peakSize, current.allocationsCount, current.freesCount);
+        }
+    }
+    auto total = load(totalCounters);
+    printf("Memory usage: root device %u, total: current %" PRIu64 " bytes in %" PRIu64 " allocations, peak %" PRIu64 " bytes, allocated %" PRIu64 " times, freed %" PRIu64 " times\n",
+           rootDeviceIndex, total.currentSize, total.currentCount, total.peakSize, total.allocationsCount, total.freesCount);
+}
+
+uint32_t MemoryUsageStatistics::getPoolIndex(MemoryPool::Type memoryPool) {
+    uint32_t poolIndex = memoryPool;
+    DEBUG_BREAK_IF(poolIndex >= memoryPoolsCount);
+    return poolIndex < memoryPoolsCount ? poolIndex : static_cast<uint32_t>(MemoryPool::MemoryNull);
+}
+
+uint64_t MemoryUsageStatistics::add(AtomicCounters &counters, uint64_t size) {
+    auto currentSize = counters.currentSize.fetch_add(size) + size;
+    auto peakSize = counters.peakSize.load();
+    while (peakSize < currentSize && !counters.peakSize.compare_exchange_weak(peakSize, currentSize)) {
+    }
+    counters.currentCount++;
+    return ++counters.allocationsCount;
+}
+
+void MemoryUsageStatistics::remove(AtomicCounters &counters, uint64_t size) {
+    DEBUG_BREAK_IF(counters.currentSize.load() < size || counters.currentCount.load() == 0u);
+    counters.currentSize -= size;
+    counters.currentCount--;
+    counters.freesCount++;
+}
+
+MemoryUsageStatistics::Counters MemoryUsageStatistics::load(const AtomicCounters &counters) {
+    Counters current;
+    current.currentSize = counters.currentSize.load();
+    current.peakSize = counters.peakSize.load();
+    current.currentCount = counters.currentCount.load();
+    current.allocationsCount = counters.allocationsCount.load();
+    current.freesCount = counters.freesCount.load();
+    return current;
+}
+
+} // namespace NEO
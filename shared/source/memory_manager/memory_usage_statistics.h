@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_pool.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace NEO {
+class MemoryUsageStatistics : public NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t allocationTypesCount = static_cast<uint32_t>(GraphicsAllocation::AllocationType::COUNT);
+    static constexpr uint32_t memoryPoolsCount = MemoryPool::LocalMemory + 1;
+
+    struct Counters {
+        uint64_t currentSize = 0u;
+        uint64_t peakSize = 0u;
+        uint64_t currentCount = 0u;
+        uint64_t allocationsCount = 0u;
+        uint64_t freesCount = 0u;
+    };
+
+    uint64_t registerAllocation(GraphicsAllocation::AllocationType allocationType, MemoryPool::Type memoryPool, uint64_t size);
+    void unregisterAllocation(GraphicsAllocation::AllocationType allocationType, MemoryPool::Type memoryPool, uint64_t size);
+
+    Counters getCounters(GraphicsAllocation::AllocationType allocationType, MemoryPool::Type memoryPool) const;
+    Counters getTotalCounters() const;
+    void print(uint32_t rootDeviceIndex) const;
+
+  protected:
+    struct AtomicCounters {
+        std::atomic<uint64_t> currentSize{0u};
+        std::atomic<uint64_t> peakSize{0u};
+        std::atomic<uint64_t> currentCount{0u};
+        std::atomic<uint64_t> allocationsCount{0u};
+        std::atomic<uint64_t> freesCount{0u};
+    };
+
+    static uint32_t getPoolIndex(MemoryPool::Type memoryPool);
+    static uint64_t add(AtomicCounters &counters, uint64_t size);
+    static void remove(AtomicCounters &counters, uint64_t size);
+    static Counters load(const AtomicCounters &counters);
+
+    AtomicCounters counters[allocationTypesCount][memoryPoolsCount];
+    AtomicCounters totalCounters;
+};
+} // namespace NEO
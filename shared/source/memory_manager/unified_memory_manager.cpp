@@ -9,45 +9,92 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_pooling.h"
 
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
+#include <unordered_set>
+
 namespace NEO {
 
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
-    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()), allocationsPair));
+    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.getBaseGpuAddress()), allocationsPair));
+    updateInternalAllocations(allocationsPair, true);
+    insertionsCount++;
 }
 
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
     SvmAllocationContainer::iterator iter;
-    iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    iter = allocations.find(reinterpret_cast<void *>(allocationsPair.getBaseGpuAddress()));
     allocations.erase(iter);
+    updateInternalAllocations(allocationsPair, false);
 }
 
-SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
-    SvmAllocationContainer::iterator Iter, End;
-    SvmAllocationData *svmAllocData;
-    if ((ptr == nullptr) || (allocations.size() == 0)) {
-        return nullptr;
+void SVMAllocsManager::MapBasedAllocationTracker::updateInternalAllocations(const SvmAllocationData &allocationData, bool inserted) {
+    if (allocationData.memoryType == InternalMemoryType::NOT_SPECIFIED) {
+        return;
     }
-    End = allocations.end();
-    Iter = allocations.lower_bound(ptr);
-    if (((Iter != End) && (Iter->first != ptr)) ||
-        (Iter == End)) {
-        if (Iter == allocations.begin()) {
-            Iter = End;
+    auto memoryTypeIndex = Math::log2(static_cast<uint32_t>(allocationData.memoryType));
+    UNRECOVERABLE_IF(memoryTypeIndex >= memoryTypesCount);
+    auto &allocationsOfType = internalAllocations[memoryTypeIndex];
+
+    auto &gpuAllocations = allocationData.gpuAllocations.getGraphicsAllocations();
+    for (auto rootDeviceIndex = 0u; rootDeviceIndex < gpuAllocations.size(); rootDeviceIndex++) {
+        auto gpuAllocation = gpuAllocations[rootDeviceIndex];
+        if (gpuAllocation == nullptr) {
+            continue;
+        }
+        if (allocationsOfType.size() <= rootDeviceIndex) {
+            allocationsOfType.resize(rootDeviceIndex + 1);
+        }
+        auto &container = allocationsOfType[rootDeviceIndex];
+        if (inserted) {
+            container[gpuAllocation]++;
         } else {
-            Iter--;
+            auto iter = container.find(gpuAllocation);
+            if (iter != container.end() && --iter->second == 0u) {
+                container.erase(iter);
+            }
         }
     }
-    if (Iter != End) {
-        svmAllocData = &Iter->second;
-        char *charPtr = reinterpret_cast<char *>(svmAllocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
-        if (ptr < (charPtr + svmAllocData->size)) {
-            return svmAllocData;
+    internalAllocationsGenerations[memoryTypeIndex]++;
+}
+
+const SVMAllocsManager::MapBasedAllocationTracker::InternalAllocationsContainer *
+SVMAllocsManager::MapBasedAllocationTracker::getInternalAllocations(uint32_t memoryTypeIndex, uint32_t rootDeviceIndex) const {
+    auto &allocationsOfType = internalAllocations[memoryTypeIndex];
+    if (rootDeviceIndex >= allocationsOfType.size()) {
+        return nullptr;
+    }
+    return &allocationsOfType[rootDeviceIndex];
+}
+
+uint64_t SVMAllocsManager::MapBasedAllocationTracker::getInternalAllocationsGeneration(uint32_t requestedTypesMask) const {
+    // generations only grow, so their sum changes whenever any of them changes
+    uint64_t generation = 0u;
+    for (auto memoryTypeIndex = 0u; memoryTypeIndex < memoryTypesCount; memoryTypeIndex++) {
+        if (requestedTypesMask & (1u << memoryTypeIndex)) {
+            generation += internalAllocationsGenerations[memoryTypeIndex];
         }
     }
+    return generation;
+}
+
+SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
+    if ((ptr == nullptr) || (allocations.size() == 0)) {
+        return nullptr;
+    }
+    auto iter = allocations.upper_bound(ptr);
+    if (iter == allocations.begin()) {
+        return nullptr;
+    }
+    --iter;
+    auto baseAddress = reinterpret_cast<const char *>(iter->first);
+    if (ptr < (baseAddress + iter->second.size)) {
+        return &iter->second;
+    }
     return nullptr;
 }
 
@@ -73,37 +120,43 @@ SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionP
 void SVMAllocsManager::addInternalAllocationsToResidencyContainer(uint32_t rootDeviceIndex,
                                                                   ResidencyContainer &residencyContainer,
                                                                   uint32_t requestedTypesMask) {
-    std::unique_lock<SpinLock> lock(mtx);
-    for (auto &allocation : this->SVMAllocs.allocations) {
-        if (rootDeviceIndex >= allocation.second.gpuAllocations.getGraphicsAllocations().size()) {
-            continue;
-        }
-
-        if (!(allocation.second.memoryType & requestedTypesMask) ||
-            (nullptr == allocation.second.gpuAllocations.getGraphicsAllocation(rootDeviceIndex))) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    std::unordered_set<GraphicsAllocation *> alreadyAdded(residencyContainer.begin(), residencyContainer.end());
+    for (auto memoryTypeIndex = 0u; memoryTypeIndex < MapBasedAllocationTracker::memoryTypesCount; memoryTypeIndex++) {
+        auto internalAllocations = SVMAllocs.getInternalAllocations(memoryTypeIndex, rootDeviceIndex);
+        if (!(requestedTypesMask & (1u << memoryTypeIndex)) || internalAllocations == nullptr) {
             continue;
         }
-
-        auto alloc = allocation.second.gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
-        if (residencyContainer.end() == std::find(residencyContainer.begin(), residencyContainer.end(), alloc)) {
-            residencyContainer.push_back(alloc);
+        for (auto &internalAllocation : *internalAllocations) {
+            if (alreadyAdded.insert(internalAllocation.first).second) {
+                residencyContainer.push_back(internalAllocation.first);
+            }
         }
     }
 }
 
 void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
-    std::unique_lock<SpinLock> lock(mtx);
-    for (auto &allocation : this->SVMAllocs.allocations) {
-        if (allocation.second.memoryType & requestedTypesMask) {
-            auto gpuAllocation = allocation.second.gpuAllocations.getGraphicsAllocation(commandStreamReceiver.getRootDeviceIndex());
-            UNRECOVERABLE_IF(nullptr == gpuAllocation);
-            commandStreamReceiver.makeResident(*gpuAllocation);
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    for (auto memoryTypeIndex = 0u; memoryTypeIndex < MapBasedAllocationTracker::memoryTypesCount; memoryTypeIndex++) {
+        auto internalAllocations = SVMAllocs.getInternalAllocations(memoryTypeIndex, commandStreamReceiver.getRootDeviceIndex());
+        if (!(requestedTypesMask & (1u << memoryTypeIndex)) || internalAllocations == nullptr) {
+            continue;
+        }
+        for (auto &internalAllocation : *internalAllocations) {
+            commandStreamReceiver.makeResident(*internalAllocation.first);
         }
     }
 }
 
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsContextSupport)
     : memoryManager(memoryManager), multiOsContextSupport(multiOsContextSupport) {
+    if (DebugManager.flags.EnableUsmAllocationPooling.get() != -1) {
+        usmMemAllocPoolingEnabled = !!DebugManager.flags.EnableUsmAllocationPooling.get();
+    }
+}
+
+SVMAllocsManager::~SVMAllocsManager() {
+    releaseUsmMemAllocPools();
 }
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
@@ -125,6 +178,12 @@ void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationPropertie
 
 void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
                                                           const UnifiedMemoryProperties &memoryProperties) {
+    if (usmMemAllocPoolingEnabled &&
+        (memoryProperties.rootDeviceIndices.size() == 1u) &&
+        UsmMemAllocPool::isPoolable(size, memoryProperties)) {
+        return createPooledUnifiedMemoryAllocation(size, memoryProperties, *memoryProperties.rootDeviceIndices.begin());
+    }
+
     size_t alignedSize = alignUp<size_t>(size, MemoryConstants::pageSize64k);
 
     GraphicsAllocation::AllocationType allocationType = getGraphicsAllocationType(memoryProperties);
@@ -160,7 +219,7 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
     allocData.device = nullptr;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     this->SVMAllocs.insert(allocData);
 
     return usmPtr;
@@ -173,6 +232,12 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
                                : *memoryProperties.rootDeviceIndices.begin();
     auto &deviceBitfield = memoryProperties.subdeviceBitfields.at(rootDeviceIndex);
 
+    if (usmMemAllocPoolingEnabled &&
+        (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) &&
+        UsmMemAllocPool::isPoolable(size, memoryProperties)) {
+        return createPooledUnifiedMemoryAllocation(size, memoryProperties, rootDeviceIndex);
+    }
+
     size_t alignedSize = alignUp<size_t>(size, MemoryConstants::pageSize64k);
 
     GraphicsAllocation::AllocationType allocationType = getGraphicsAllocationType(memoryProperties);
@@ -208,7 +273,7 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
     allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
     allocData.device = memoryProperties.device;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     this->SVMAllocs.insert(allocData);
     return reinterpret_cast<void *>(unifiedMemoryAllocation->getGpuAddress());
 }
@@ -247,7 +312,6 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size,
         }
 
         auto unifiedMemoryAllocation = this->getSVMAlloc(unifiedMemoryPointer);
-        unifiedMemoryAllocation->memoryType = memoryProperties.memoryType;
         unifiedMemoryAllocation->allocationFlagsProperty = memoryProperties.allocationFlags;
 
         return unifiedMemoryPointer;
@@ -284,8 +348,9 @@ void *SVMAllocsManager::createUnifiedKmdMigratedAllocation(size_t size, const Sv
     allocData.cpuAllocation = nullptr;
     allocData.device = unifiedMemoryProperties.device;
     allocData.size = size;
+    allocData.memoryType = unifiedMemoryProperties.memoryType;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     this->SVMAllocs.insert(allocData);
     return allocationGpu->getUnderlyingBuffer();
 }
@@ -296,17 +361,17 @@ void SVMAllocsManager::setUnifiedAllocationProperties(GraphicsAllocation *alloca
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx);
     return SVMAllocs.get(ptr);
 }
 
 void SVMAllocsManager::insertSVMAlloc(const SvmAllocationData &svmAllocData) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     SVMAllocs.insert(svmAllocData);
 }
 
 void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     SVMAllocs.remove(svmAllocData);
 }
 
@@ -325,11 +390,16 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
             }
         }
 
+        if (svmData->usmPool) {
+            freePooledSvmAllocation(svmData);
+            return true;
+        }
+
         auto pageFaultManager = this->memoryManager->getPageFaultManager();
         if (pageFaultManager) {
             pageFaultManager->removeAllocation(ptr);
         }
-        std::unique_lock<SpinLock> lock(mtx);
+        std::unique_lock<std::shared_mutex> lock(mtx);
         if (svmData->gpuAllocations.getAllocationType() == GraphicsAllocation::AllocationType::SVM_ZERO_COPY) {
             freeZeroCopySvmAllocation(svmData);
         } else {
@@ -370,7 +440,7 @@ void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAlloca
     }
     allocData.size = size;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     this->SVMAllocs.insert(allocData);
     return usmPtr;
 }
@@ -418,8 +488,11 @@ void *SVMAllocsManager::createUnifiedAllocationWithDeviceStorage(size_t size, co
     allocData.cpuAllocation = allocationCpu;
     allocData.device = unifiedMemoryProperties.device;
     allocData.size = size;
+    if (unifiedMemoryProperties.memoryType != InternalMemoryType::NOT_SPECIFIED) {
+        allocData.memoryType = unifiedMemoryProperties.memoryType;
+    }
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     this->SVMAllocs.insert(allocData);
     return svmPtr;
 }
@@ -443,8 +516,41 @@ void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svm
     memoryManager->freeGraphicsMemory(cpuAllocation);
 }
 
+void *SVMAllocsManager::createPooledUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties, uint32_t rootDeviceIndex) {
+    UsmMemAllocPool *usmMemAllocPool = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(usmMemAllocPoolsMtx);
+        for (auto &pool : usmMemAllocPools) {
+            if (pool->isMatching(memoryProperties.memoryType, memoryProperties.device, rootDeviceIndex)) {
+                usmMemAllocPool = pool.get();
+                break;
+            }
+        }
+        if (usmMemAllocPool == nullptr) {
+            usmMemAllocPools.push_back(std::make_unique<UsmMemAllocPool>(this, memoryManager, memoryProperties.memoryType, memoryProperties.device, rootDeviceIndex));
+            usmMemAllocPool = usmMemAllocPools.back().get();
+        }
+    }
+    return usmMemAllocPool->createUnifiedMemoryAllocation(size, memoryProperties);
+}
+
+void SVMAllocsManager::freePooledSvmAllocation(SvmAllocationData *svmData) {
+    auto usmMemAllocPool = svmData->usmPool;
+    auto gpuAddress = svmData->getBaseGpuAddress();
+    {
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        SVMAllocs.remove(*svmData);
+    }
+    usmMemAllocPool->freeUnifiedMemoryAllocation(gpuAddress);
+}
+
+void SVMAllocsManager::releaseUsmMemAllocPools() {
+    std::unique_lock<std::mutex> lock(usmMemAllocPoolsMtx);
+    usmMemAllocPools.clear();
+}
+
 bool SVMAllocsManager::hasHostAllocations() {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx);
     for (auto &allocation : this->SVMAllocs.allocations) {
         if (allocation.second.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY) {
             return true;
@@ -454,7 +560,7 @@ bool SVMAllocsManager::hasHostAllocations() {
 }
 
 SvmMapOperation *SVMAllocsManager::getSvmMapOperation(const void *ptr) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx);
     return svmMapOperations.get(ptr);
 }
 
@@ -465,12 +571,12 @@ void SVMAllocsManager::insertSvmMapOperation(void *regionSvmPtr, size_t regionSi
     svmMapOperation.offset = offset;
     svmMapOperation.regionSize = regionSize;
     svmMapOperation.readOnlyMap = readOnlyMap;
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     svmMapOperations.insert(svmMapOperation);
 }
 
 void SVMAllocsManager::removeSvmMapOperation(const void *regionSvmPtr) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     svmMapOperations.remove(regionSvmPtr);
 }
 
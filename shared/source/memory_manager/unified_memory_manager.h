@@ -10,20 +10,26 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
-#include "shared/source/utilities/spinlock.h"
 
 #include "memory_properties_flags.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
 class GraphicsAllocation;
 class MemoryManager;
 class Device;
+class UsmMemAllocPool;
 
 struct SvmAllocationData {
     SvmAllocationData(uint32_t maxRootDeviceIndex) : gpuAllocations(maxRootDeviceIndex), maxRootDeviceIndex(maxRootDeviceIndex){};
@@ -33,6 +39,8 @@ struct SvmAllocationData {
         this->device = svmAllocData.device;
         this->size = svmAllocData.size;
         this->memoryType = svmAllocData.memoryType;
+        this->usmPool = svmAllocData.usmPool;
+        this->offsetInUsmPool = svmAllocData.offsetInUsmPool;
         for (auto allocation : svmAllocData.gpuAllocations.getGraphicsAllocations()) {
             if (allocation) {
                 this->gpuAllocations.addAllocation(allocation);
@@ -40,12 +48,17 @@ struct SvmAllocationData {
         }
     }
     SvmAllocationData &operator=(const SvmAllocationData &) = delete;
+    uint64_t getBaseGpuAddress() const {
+        return gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress() + offsetInUsmPool;
+    }
     GraphicsAllocation *cpuAllocation = nullptr;
     MultiGraphicsAllocation gpuAllocations;
     size_t size = 0;
     InternalMemoryType memoryType = InternalMemoryType::SVM;
     MemoryProperties allocationFlagsProperty;
     Device *device = nullptr;
+    UsmMemAllocPool *usmPool = nullptr;
+    size_t offsetInUsmPool = 0;
 
   protected:
     const uint32_t maxRootDeviceIndex;
@@ -70,8 +83,24 @@ class SVMAllocsManager {
         void remove(SvmAllocationData);
         SvmAllocationData *get(const void *);
         size_t getNumAllocs() const { return allocations.size(); };
+        uint64_t getInsertionsCount() const { return insertionsCount; }
+
+        // gpu allocations of given memory type and root device, counted per svm allocation sharing them (e.g. pooled ones)
+        using InternalAllocationsContainer = std::unordered_map<GraphicsAllocation *, uint32_t>;
+        const InternalAllocationsContainer *getInternalAllocations(uint32_t memoryTypeIndex, uint32_t rootDeviceIndex) const;
+        // changes whenever allocation of any of requested memory types is inserted or removed
+        uint64_t getInternalAllocationsGeneration(uint32_t requestedTypesMask) const;
 
         SvmAllocationContainer allocations;
+
+        static constexpr uint32_t memoryTypesCount = 4u;
+
+      protected:
+        void updateInternalAllocations(const SvmAllocationData &allocationData, bool inserted);
+
+        std::atomic<uint64_t> insertionsCount{0u};
+        std::array<std::vector<InternalAllocationsContainer>, memoryTypesCount> internalAllocations;
+        std::array<std::atomic<uint64_t>, memoryTypesCount> internalAllocationsGenerations{};
     };
 
     struct MapOperationsTracker {
@@ -100,12 +129,13 @@ class SVMAllocsManager {
         InternalMemoryType memoryType = InternalMemoryType::NOT_SPECIFIED;
         MemoryProperties allocationFlags;
         Device *device = nullptr;
+        bool preferRenderCompression = false;
         const std::set<uint32_t> &rootDeviceIndices;
         const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields;
     };
 
     SVMAllocsManager(MemoryManager *memoryManager, bool multiOsContextSupport);
-    MOCKABLE_VIRTUAL ~SVMAllocsManager() = default;
+    MOCKABLE_VIRTUAL ~SVMAllocsManager();
     void *createSVMAlloc(size_t size,
                          const SvmAllocationProperties svmProperties,
                          const std::set<uint32_t> &rootDeviceIndices,
@@ -128,6 +158,8 @@ class SVMAllocsManager {
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return SVMAllocs.getNumAllocs(); }
     MapBasedAllocationTracker *getSVMAllocs() { return &SVMAllocs; }
+    uint64_t getAllocationsVersion() const { return SVMAllocs.getInsertionsCount(); }
+    uint64_t getInternalAllocationsGeneration(uint32_t requestedTypesMask) const { return SVMAllocs.getInternalAllocationsGeneration(requestedTypesMask); }
 
     MOCKABLE_VIRTUAL void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap);
     void removeSvmMapOperation(const void *regionSvmPtr);
@@ -142,6 +174,7 @@ class SVMAllocsManager {
     bool getMultiOsContextSupport() {
         return multiOsContextSupport;
     }
+    void releaseUsmMemAllocPools();
 
   protected:
     void *createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
@@ -150,11 +183,16 @@ class SVMAllocsManager {
     GraphicsAllocation::AllocationType getGraphicsAllocationType(const UnifiedMemoryProperties &unifiedMemoryProperties) const;
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
+    void *createPooledUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties, uint32_t rootDeviceIndex);
+    void freePooledSvmAllocation(SvmAllocationData *svmData);
 
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
     MemoryManager *memoryManager;
-    SpinLock mtx;
+    std::shared_mutex mtx;
     bool multiOsContextSupport;
+    bool usmMemAllocPoolingEnabled = false;
+    std::vector<std::unique_ptr<UsmMemAllocPool>> usmMemAllocPools;
+    std::mutex usmMemAllocPoolsMtx;
 };
 } // namespace NEO
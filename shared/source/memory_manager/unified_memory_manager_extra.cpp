@@ -14,6 +14,8 @@ GraphicsAllocation::AllocationType SVMAllocsManager::getGraphicsAllocationType(c
     if (unifiedMemoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
         if (unifiedMemoryProperties.allocationFlags.allocFlags.allocWriteCombined) {
             allocationType = GraphicsAllocation::AllocationType::WRITE_COMBINED;
+        } else if (unifiedMemoryProperties.preferRenderCompression) {
+            allocationType = GraphicsAllocation::AllocationType::BUFFER_COMPRESSED;
         } else {
             allocationType = GraphicsAllocation::AllocationType::BUFFER;
         }
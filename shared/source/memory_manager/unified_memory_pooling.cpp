@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_pooling.h"
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+namespace NEO {
+
+UsmMemAllocPool::Chunk::Chunk(const SvmAllocationData &allocData, uint64_t gpuAddress)
+    : allocData(allocData), gpuAddress(gpuAddress),
+      allocator(std::make_unique<HeapAllocator>(gpuAddress, UsmMemAllocPool::chunkSize, UsmMemAllocPool::allocationAlignment, UsmMemAllocPool::chunkSize)) {
+}
+
+UsmMemAllocPool::Chunk::~Chunk() = default;
+
+UsmMemAllocPool::UsmMemAllocPool(SVMAllocsManager *svmAllocsManager, MemoryManager *memoryManager, InternalMemoryType memoryType, Device *device, uint32_t rootDeviceIndex)
+    : svmAllocsManager(svmAllocsManager), memoryManager(memoryManager), memoryType(memoryType), device(device), rootDeviceIndex(rootDeviceIndex) {
+}
+
+UsmMemAllocPool::~UsmMemAllocPool() {
+    releaseChunks();
+}
+
+bool UsmMemAllocPool::isPoolable(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) {
+    return (size > 0u) &&
+           (size <= maxPoolableSize) &&
+           (memoryProperties.allocationFlags.allFlags == 0u) &&
+           (memoryProperties.allocationFlags.allAllocFlags == 0u) &&
+           !memoryProperties.preferRenderCompression;
+}
+
+bool UsmMemAllocPool::isMatching(InternalMemoryType memoryType, Device *device, uint32_t rootDeviceIndex) const {
+    return (this->memoryType == memoryType) && (this->device == device) && (this->rootDeviceIndex == rootDeviceIndex);
+}
+
+UsmMemAllocPool::Chunk *UsmMemAllocPool::createChunk(const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) {
+    void *chunkPtr = nullptr;
+    if (memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY) {
+        chunkPtr = svmAllocsManager->createHostUnifiedMemoryAllocation(chunkSize, memoryProperties);
+    } else {
+        chunkPtr = svmAllocsManager->createUnifiedMemoryAllocation(chunkSize, memoryProperties);
+    }
+    if (chunkPtr == nullptr) {
+        return nullptr;
+    }
+
+    auto chunkAllocData = svmAllocsManager->getSVMAlloc(chunkPtr);
+    UNRECOVERABLE_IF(chunkAllocData == nullptr);
+    chunks.push_back(std::make_unique<Chunk>(*chunkAllocData, castToUint64(chunkPtr)));
+    svmAllocsManager->removeSVMAlloc(*chunkAllocData);
+
+    return chunks.back().get();
+}
+
+void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    Chunk *chunk = nullptr;
+    uint64_t gpuAddress = 0u;
+    size_t sizeToAllocate = size;
+    for (auto &candidateChunk : chunks) {
+        sizeToAllocate = size;
+        gpuAddress = candidateChunk->allocator->allocate(sizeToAllocate);
+        if (gpuAddress != 0u) {
+            chunk = candidateChunk.get();
+            break;
+        }
+    }
+
+    if (chunk == nullptr) {
+        chunk = createChunk(memoryProperties);
+        if (chunk == nullptr) {
+            return nullptr;
+        }
+        sizeToAllocate = size;
+        gpuAddress = chunk->allocator->allocate(sizeToAllocate);
+        UNRECOVERABLE_IF(gpuAddress == 0u);
+    }
+
+    pooledAllocations.insert({gpuAddress, {chunk, sizeToAllocate}});
+
+    SvmAllocationData allocData(chunk->allocData);
+    allocData.size = size;
+    allocData.memoryType = memoryProperties.memoryType;
+    allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
+    allocData.usmPool = this;
+    allocData.offsetInUsmPool = static_cast<size_t>(gpuAddress - chunk->allocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
+    svmAllocsManager->insertSVMAlloc(allocData);
+
+    return reinterpret_cast<void *>(gpuAddress);
+}
+
+void UsmMemAllocPool::freeUnifiedMemoryAllocation(uint64_t gpuAddress) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto pooledAllocation = pooledAllocations.find(gpuAddress);
+    if (pooledAllocation == pooledAllocations.end()) {
+        DEBUG_BREAK_IF(true);
+        return;
+    }
+
+    auto chunk = pooledAllocation->second.chunk;
+    chunk->allocator->free(gpuAddress, pooledAllocation->second.allocatedSize);
+    pooledAllocations.erase(pooledAllocation);
+
+    if ((chunk->allocator->getUsedSize() == 0u) && (chunks.size() > 1u)) {
+        for (auto it = chunks.begin(); it != chunks.end(); it++) {
+            if (it->get() == chunk) {
+                for (auto graphicsAllocation : chunk->allocData.gpuAllocations.getGraphicsAllocations()) {
+                    memoryManager->freeGraphicsMemory(graphicsAllocation);
+                }
+                chunks.erase(it);
+                break;
+            }
+        }
+    }
+}
+
+void UsmMemAllocPool::releaseChunks() {
+    std::unique_lock<std::mutex> lock(mtx);
+    for (auto &chunk : chunks) {
+        for (auto graphicsAllocation : chunk->allocData.gpuAllocations.getGraphicsAllocations()) {
+            memoryManager->freeGraphicsMemory(graphicsAllocation);
+        }
+    }
+    chunks.clear();
+    pooledAllocations.clear();
+}
+
+} // namespace NEO
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class HeapAllocator;
+
+class UsmMemAllocPool {
+  public:
+    static constexpr size_t chunkSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t maxPoolableSize = 64 * MemoryConstants::kiloByte;
+    static constexpr size_t allocationAlignment = 128u;
+
+    UsmMemAllocPool(SVMAllocsManager *svmAllocsManager, MemoryManager *memoryManager, InternalMemoryType memoryType, Device *device, uint32_t rootDeviceIndex);
+    ~UsmMemAllocPool();
+
+    static bool isPoolable(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties);
+    bool isMatching(InternalMemoryType memoryType, Device *device, uint32_t rootDeviceIndex) const;
+
+    void *createUnifiedMemoryAllocation(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties);
+    void freeUnifiedMemoryAllocation(uint64_t gpuAddress);
+    void releaseChunks();
+
+    size_t getChunksCount() const { return chunks.size(); }
+
+  protected:
+    struct Chunk {
+        Chunk(const SvmAllocationData &allocData, uint64_t gpuAddress);
+        ~Chunk();
+
+        SvmAllocationData allocData;
+        uint64_t gpuAddress;
+        std::unique_ptr<HeapAllocator> allocator;
+    };
+
+    struct PooledAllocation {
+        Chunk *chunk;
+        size_t allocatedSize;
+    };
+
+    Chunk *createChunk(const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties);
+
+    SVMAllocsManager *svmAllocsManager;
+    MemoryManager *memoryManager;
+    const InternalMemoryType memoryType;
+    Device *const device;
+    const uint32_t rootDeviceIndex;
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::unordered_map<uint64_t, PooledAllocation> pooledAllocations;
+    std::mutex mtx;
+};
+} // namespace NEO
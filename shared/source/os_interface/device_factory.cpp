@@ -16,9 +16,12 @@
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/parallel_tasks.h"
 
 #include "hw_device_id.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 bool DeviceFactory::prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment) {
@@ -99,26 +102,38 @@ bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnv
         return false;
     }
 
-    executionEnvironment.prepareRootDeviceEnvironments(static_cast<uint32_t>(hwDeviceIds.size()));
-
-    uint32_t rootDeviceIndex = 0u;
+    auto rootDevicesCount = hwDeviceIds.size();
+    executionEnvironment.prepareRootDeviceEnvironments(static_cast<uint32_t>(rootDevicesCount));
 
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
-            return false;
+    // each root device environment is filled only by its own task, so results keep discovery order
+    std::vector<uint8_t> initialized(rootDevicesCount, 0u);
+    auto initializeRootDeviceEnvironment = [&](size_t index) {
+        auto rootDeviceIndex = static_cast<uint32_t>(index);
+        auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[rootDeviceIndex];
+        if (!rootDeviceEnvironment.initOsInterface(std::move(hwDeviceIds[rootDeviceIndex]), rootDeviceIndex)) {
+            return;
         }
 
         if (DebugManager.flags.OverrideGpuAddressSpace.get() != -1) {
-            executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
+            rootDeviceEnvironment.getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
                 maxNBitValue(static_cast<uint64_t>(DebugManager.flags.OverrideGpuAddressSpace.get()));
         }
 
         if (DebugManager.flags.OverrideRevision.get() != -1) {
-            executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->platform.usRevId =
+            rootDeviceEnvironment.getMutableHardwareInfo()->platform.usRevId =
                 static_cast<unsigned short>(DebugManager.flags.OverrideRevision.get());
         }
+        initialized[rootDeviceIndex] = 1u;
+    };
 
-        rootDeviceIndex++;
+    size_t maxWorkers = rootDevicesCount;
+    if (DebugManager.flags.ParallelRootDeviceInitialization.get() == 0) {
+        maxWorkers = 1u;
+    }
+    runParallelTasks(rootDevicesCount, maxWorkers, initializeRootDeviceEnvironment);
+
+    if (std::find(initialized.begin(), initialized.end(), 0u) != initialized.end()) {
+        return false;
     }
 
     executionEnvironment.parseAffinityMask();
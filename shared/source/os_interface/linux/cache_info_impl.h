@@ -8,15 +8,104 @@
 #pragma once
 
 #include "shared/source/os_interface/linux/cache_info.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
 
 namespace NEO {
 
+// L3 ways reserved with class of service (CLOS) regions are excluded from default region,
+// so allocations placed in reserved region are not evicted by streaming traffic.
+// Regions are reserved on first use and released when cache info is destroyed.
 struct CacheInfoImpl : public CacheInfo {
-    CacheInfoImpl() {}
+    static constexpr uint16_t l3CacheLevel = 3;
+
+    CacheInfoImpl(Drm &drm, size_t maxReservationCacheSize, uint32_t maxReservationNumCacheRegions, uint16_t maxReservationNumWays)
+        : drm(drm), maxReservationCacheSize(maxReservationCacheSize), maxReservationNumCacheRegions(maxReservationNumCacheRegions), maxReservationNumWays(maxReservationNumWays) {
+    }
+
+    ~CacheInfoImpl() override {
+        for (auto &reservedRegion : reservedCacheRegions) {
+            drm.closFree(reservedRegion.first);
+        }
+    }
+
+    size_t getMaxReservationCacheSize() const { return maxReservationCacheSize; }
+    uint32_t getMaxReservationNumCacheRegions() const { return maxReservationNumCacheRegions; }
+
+    CacheRegion reserveCacheRegion(size_t cacheReservationSize) {
+        std::lock_guard<std::mutex> lock(mtx);
+        return reserveRegion(cacheReservationSize);
+    }
+
+    CacheRegion freeCacheRegion(CacheRegion regionIndex) {
+        std::lock_guard<std::mutex> lock(mtx);
+        return freeRegion(regionIndex);
+    }
+
+    bool getCacheRegion(size_t regionSize, CacheRegion regionIndex) override {
+        if (regionIndex == CacheRegion::Default || regionIndex >= CacheRegion::Count) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mtx);
+        auto reservedRegion = reservedCacheRegions.find(regionIndex);
+        if (reservedRegion != reservedCacheRegions.end()) {
+            return reservedRegion->second >= regionSize;
+        }
+
+        // reservable ways are split evenly between regions, unless larger region is requested
+        auto reservationSize = std::max(regionSize, maxReservationCacheSize / std::max(maxReservationNumCacheRegions, 1u));
+        auto reservedIndex = reserveRegion(reservationSize);
+        if (reservedIndex == regionIndex) {
+            return true;
+        }
+        if (reservedIndex != CacheRegion::None) {
+            freeRegion(reservedIndex);
+        }
+        return false;
+    }
+
+  protected:
+    CacheRegion reserveRegion(size_t cacheReservationSize) {
+        if (cacheReservationSize == 0 || cacheReservationSize > maxReservationCacheSize ||
+            reservedCacheRegions.size() >= maxReservationNumCacheRegions) {
+            return CacheRegion::None;
+        }
+
+        auto numWays = static_cast<uint16_t>((maxReservationNumWays * cacheReservationSize + maxReservationCacheSize - 1) / maxReservationCacheSize);
+        auto regionIndex = drm.closAlloc();
+        if (regionIndex == CacheRegion::None) {
+            return CacheRegion::None;
+        }
+
+        if (drm.closAllocWays(regionIndex, l3CacheLevel, numWays) != numWays) {
+            drm.closFree(regionIndex);
+            return CacheRegion::None;
+        }
+
+        // whole ways are reserved, so reserved size may exceed requested one
+        reservedCacheRegions[regionIndex] = (maxReservationCacheSize * numWays) / maxReservationNumWays;
+        return regionIndex;
+    }
 
-    ~CacheInfoImpl() override = default;
+    CacheRegion freeRegion(CacheRegion regionIndex) {
+        auto reservedRegion = reservedCacheRegions.find(regionIndex);
+        if (reservedRegion == reservedCacheRegions.end()) {
+            return CacheRegion::None;
+        }
+        reservedCacheRegions.erase(reservedRegion);
+        return drm.closFree(regionIndex);
+    }
 
-    bool getCacheRegion(size_t regionSize, CacheRegion regionIndex) override { return false; }
+    Drm &drm;
+    const size_t maxReservationCacheSize;
+    const uint32_t maxReservationNumCacheRegions;
+    const uint16_t maxReservationNumWays;
+    std::map<CacheRegion, size_t> reservedCacheRegions;
+    std::mutex mtx;
 };
 
 } // namespace NEO
@@ -22,6 +22,9 @@ std::string DrmAllocation::getAllocationInfoString() const {
             ss << " Handle: " << bo->peekHandle();
         }
     }
+    if (numaNode >= 0) {
+        ss << " NUMA node: " << numaNode;
+    }
     return ss.str();
 }
 
@@ -29,6 +32,15 @@ uint64_t DrmAllocation::peekInternalHandle(MemoryManager *memoryManager) {
     return static_cast<uint64_t>((static_cast<DrmMemoryManager *>(memoryManager))->obtainFdFromHandle(getBO()->peekHandle(), this->rootDeviceIndex));
 }
 
+int DrmAllocation::peekDmaBufFd(MemoryManager *memoryManager) {
+    auto drmMemoryManager = static_cast<DrmMemoryManager *>(memoryManager);
+    auto lock = drmMemoryManager->acquireAllocLock();
+    if (this->exportedDmaBufFd < 0) {
+        this->exportedDmaBufFd = drmMemoryManager->obtainFdFromHandle(getBO()->peekHandle(), this->rootDeviceIndex);
+    }
+    return this->exportedDmaBufFd;
+}
+
 bool DrmAllocation::setCacheAdvice(Drm *drm, size_t regionSize, CacheRegion regionIndex) {
     if (!drm->getCacheInfo()->getCacheRegion(regionSize, regionIndex)) {
         return false;
@@ -63,6 +63,8 @@ class DrmAllocation : public GraphicsAllocation {
     }
 
     uint64_t peekInternalHandle(MemoryManager *memoryManager) override;
+    int peekDmaBufFd(MemoryManager *memoryManager) override;
+    int getExportedDmaBufFd() const { return this->exportedDmaBufFd; }
 
     bool setCacheRegion(Drm *drm, CacheRegion regionIndex);
     bool setCacheAdvice(Drm *drm, size_t regionSize, CacheRegion regionIndex);
@@ -72,6 +74,18 @@ class DrmAllocation : public GraphicsAllocation {
     size_t getMmapSize() { return this->mmapSize; }
     void setMmapSize(size_t size) { this->mmapSize = size; }
 
+    int getNumaNode() const { return this->numaNode; }
+    void setNumaNode(int node) { this->numaNode = node; }
+
+    size_t getHugePageMappingSize() const { return this->hugePageMappingSize; }
+    void setHugePageMappingSize(size_t size) { this->hugePageMappingSize = size; }
+
+    size_t getLargePageBackingSize() const { return this->largePageBackingSize; }
+    void setLargePageBackingSize(size_t size) { this->largePageBackingSize = size; }
+
+    bool isBufferObjectCacheable() const { return this->bufferObjectCacheable; }
+    void setBufferObjectCacheable(bool cacheable) { this->bufferObjectCacheable = cacheable; }
+
     void makeBOsResident(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
     void bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
     void bindBOs(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
@@ -86,5 +100,10 @@ class DrmAllocation : public GraphicsAllocation {
 
     void *mmapPtr = nullptr;
     size_t mmapSize = 0u;
+    size_t hugePageMappingSize = 0u;
+    size_t largePageBackingSize = 0u;
+    int numaNode = -1;
+    int exportedDmaBufFd = -1;
+    bool bufferObjectCacheable = false;
 };
 } // namespace NEO
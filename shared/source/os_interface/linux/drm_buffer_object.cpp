@@ -13,6 +13,7 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_time_linux.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/runtime_tracer.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "drm/i915_drm.h"
@@ -133,8 +134,20 @@ void BufferObject::fillExecObject(drm_i915_gem_exec_object2 &execObject, OsConte
     this->fillExecObjectImpl(execObject, osContext, vmHandleId);
 }
 
-int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage) {
-    for (size_t i = 0; i < residencyCount; i++) {
+bool BufferObject::isExecObjectFilled(const drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId) const {
+    bool asyncFlagSet = (execObject.flags & EXEC_OBJECT_ASYNC) != 0;
+    bool captureFlagSet = (execObject.flags & EXEC_OBJECT_CAPTURE) != 0;
+    return execObject.handle == static_cast<uint32_t>(this->handle) &&
+           execObject.offset == this->gpuAddress &&
+           execObject.rsvd1 == drmContextId &&
+           captureFlagSet == this->allowCapture &&
+           asyncFlagSet == (DebugManager.flags.UseAsyncDrmExec.get() == 1);
+}
+
+int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage,
+                       size_t filledExecObjectsCount, drm_i915_gem_exec_fence *execFences, uint32_t execFencesCount) {
+    RUNTIME_TRACE_SCOPE("execbufferIoctl");
+    for (size_t i = filledExecObjectsCount; i < residencyCount; i++) {
         residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
     }
     this->fillExecObject(execObjectsStorage[residencyCount], osContext, vmHandleId, drmContextId);
@@ -146,6 +159,11 @@ int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bo
     execbuf.batch_len = alignUp(used, 8);
     execbuf.flags = flags;
     execbuf.rsvd1 = drmContextId;
+    if (execFencesCount > 0) {
+        execbuf.flags |= I915_EXEC_FENCE_ARRAY;
+        execbuf.cliprects_ptr = reinterpret_cast<uintptr_t>(execFences);
+        execbuf.num_cliprects = execFencesCount;
+    }
 
     if (DebugManager.flags.PrintExecutionBuffer.get()) {
         printExecutionBuffer(execbuf, residencyCount, execObjectsStorage, residency);
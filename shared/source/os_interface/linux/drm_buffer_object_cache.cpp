@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_buffer_object_cache.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+
+namespace NEO {
+
+DrmBufferObjectCache::DrmBufferObjectCache(size_t maxCachedSize) : maxCachedSize(maxCachedSize) {
+}
+
+bool DrmBufferObjectCache::take(uint32_t rootDeviceIndex, size_t size, size_t alignment, bool reservedRangeRequired, CachedBufferObject &cachedBufferObject) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // accept buckets up to twice the requested size to bound the wasted memory
+    for (auto bucket = buckets.lower_bound(size); bucket != buckets.end() && bucket->first < (size << 1); bucket++) {
+        auto &entries = bucket->second;
+        for (auto entry = entries.rbegin(); entry != entries.rend(); entry++) {
+            if (entry->rootDeviceIndex == rootDeviceIndex &&
+                isAligned(reinterpret_cast<uintptr_t>(entry->cpuPtr), alignment) &&
+                (entry->reservedAddress != nullptr) == reservedRangeRequired) {
+                cachedBufferObject = *entry;
+                entries.erase(std::next(entry).base());
+                if (entries.empty()) {
+                    buckets.erase(bucket);
+                }
+                cachedSize -= cachedBufferObject.size;
+                statistics.hits++;
+                return true;
+            }
+        }
+    }
+
+    statistics.misses++;
+    return false;
+}
+
+bool DrmBufferObjectCache::store(const CachedBufferObject &cachedBufferObject, std::vector<CachedBufferObject> &evictedBufferObjects) {
+    if (cachedBufferObject.size > maxCachedSize) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    auto &entries = buckets[cachedBufferObject.size];
+    if (entries.size() >= maxEntriesPerBucket) {
+        evictedBufferObjects.push_back(entries.front());
+        cachedSize -= entries.front().size;
+        entries.erase(entries.begin());
+        statistics.evictions++;
+    }
+    entries.push_back(cachedBufferObject);
+    cachedSize += cachedBufferObject.size;
+
+    if (cachedSize > maxCachedSize) {
+        trim(maxCachedSize, evictedBufferObjects);
+    }
+    return true;
+}
+
+void DrmBufferObjectCache::release(std::vector<CachedBufferObject> &evictedBufferObjects) {
+    std::unique_lock<std::mutex> lock(mtx);
+    trim(0u, evictedBufferObjects);
+}
+
+DrmBufferObjectCache::Statistics DrmBufferObjectCache::getStatistics() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto currentStatistics = statistics;
+    currentStatistics.cachedSize = cachedSize;
+    currentStatistics.cachedCount = 0u;
+    for (auto &bucket : buckets) {
+        currentStatistics.cachedCount += bucket.second.size();
+    }
+    return currentStatistics;
+}
+
+void DrmBufferObjectCache::trim(size_t targetSize, std::vector<CachedBufferObject> &evictedBufferObjects) {
+    // evict oldest entries of largest buckets first, they give back the most memory
+    while (cachedSize > targetSize && !buckets.empty()) {
+        auto bucket = std::prev(buckets.end());
+        auto &entries = bucket->second;
+        evictedBufferObjects.push_back(entries.front());
+        cachedSize -= entries.front().size;
+        entries.erase(entries.begin());
+        if (entries.empty()) {
+            buckets.erase(bucket);
+        }
+        if (targetSize != 0u) {
+            statistics.evictions++;
+        }
+    }
+}
+} // namespace NEO
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class BufferObject;
+
+class DrmBufferObjectCache {
+  public:
+    static constexpr size_t maxEntriesPerBucket = 8u;
+
+    struct CachedBufferObject {
+        BufferObject *bo = nullptr;
+        void *cpuPtr = nullptr;
+        void *reservedAddress = nullptr;
+        size_t reservedSize = 0u;
+        size_t size = 0u;
+        uint32_t rootDeviceIndex = 0u;
+    };
+
+    struct Statistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictions = 0u;
+        size_t cachedSize = 0u;
+        size_t cachedCount = 0u;
+    };
+
+    DrmBufferObjectCache(size_t maxCachedSize);
+
+    DrmBufferObjectCache(const DrmBufferObjectCache &) = delete;
+    DrmBufferObjectCache &operator=(const DrmBufferObjectCache &) = delete;
+
+    bool take(uint32_t rootDeviceIndex, size_t size, size_t alignment, bool reservedRangeRequired, CachedBufferObject &cachedBufferObject);
+    bool store(const CachedBufferObject &cachedBufferObject, std::vector<CachedBufferObject> &evictedBufferObjects);
+    void release(std::vector<CachedBufferObject> &evictedBufferObjects);
+
+    Statistics getStatistics() const;
+    size_t getMaxCachedSize() const { return maxCachedSize; }
+
+  protected:
+    void trim(size_t targetSize, std::vector<CachedBufferObject> &evictedBufferObjects);
+
+    const size_t maxCachedSize;
+    size_t cachedSize = 0u;
+    std::map<size_t, std::vector<CachedBufferObject>> buckets;
+    Statistics statistics;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
@@ -14,25 +15,33 @@
 
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
-#include <queue>
 #include <stdio.h>
 
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
-    thread = Thread::create(worker, reinterpret_cast<void *>(this));
+    auto workerThreadsCount = defaultWorkerThreadsCount;
+    if (DebugManager.flags.GemCloseWorkerThreadsCount.get() > 0) {
+        workerThreadsCount = std::min(static_cast<uint32_t>(DebugManager.flags.GemCloseWorkerThreadsCount.get()), maxWorkerThreadsCount);
+    }
+    for (auto i = 0u; i < workerThreadsCount; i++) {
+        threads.push_back(Thread::create(worker, reinterpret_cast<void *>(this)));
+    }
 }
 
 void DrmGemCloseWorker::closeThread() {
-    if (thread) {
-        while (!workerDone.load()) {
+    if (!threads.empty()) {
+        while (workersDone.load() != threads.size()) {
             condition.notify_all();
         }
 
-        thread->join();
-        thread.reset();
+        for (auto &thread : threads) {
+            thread->join();
+        }
+        threads.clear();
     }
 }
 
@@ -42,11 +51,65 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
-    workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    auto pendingCount = ++workCount;
+    pushedCount++;
+
+    auto currentMax = maxPendingCount.load();
+    while (pendingCount > currentMax && !maxPendingCount.compare_exchange_weak(currentMax, pendingCount)) {
+    }
+
+    auto workItem = new WorkItem{bo, nullptr};
+    pushWorkItems(workItem, workItem);
+
+    // workers register as sleeping before checking the list, so the mutex is only taken when one may be waiting
+    if (sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        condition.notify_one();
+    }
+}
+
+void DrmGemCloseWorker::pushWorkItems(WorkItem *first, WorkItem *last) {
+    auto head = workItems.load();
+    do {
+        last->next = head;
+    } while (!workItems.compare_exchange_weak(head, first));
+}
+
+DrmGemCloseWorker::WorkItem *DrmGemCloseWorker::takeWorkItems() {
+    auto taken = workItems.exchange(nullptr);
+    if (taken == nullptr) {
+        return nullptr;
+    }
+
+    // keep one batch and give the rest back, so other workers can process it in parallel
+    auto last = taken;
+    for (auto count = 1u; count < maxBatchSize && last->next != nullptr; count++) {
+        last = last->next;
+    }
+    auto remaining = last->next;
+    last->next = nullptr;
+    if (remaining != nullptr) {
+        auto remainingLast = remaining;
+        while (remainingLast->next != nullptr) {
+            remainingLast = remainingLast->next;
+        }
+        pushWorkItems(remaining, remainingLast);
+        if (sleepingWorkers.load() > 0) {
+            std::lock_guard<std::mutex> lock(closeWorkerMutex);
+            condition.notify_one();
+        }
+    }
+    return taken;
+}
+
+void DrmGemCloseWorker::processWorkItems(WorkItem *workItem) {
+    batchesCount++;
+    while (workItem != nullptr) {
+        auto next = workItem->next;
+        close(workItem->bo);
+        delete workItem;
+        workItem = next;
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -61,48 +124,48 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+DrmGemCloseWorker::Statistics DrmGemCloseWorker::getStatistics() const {
+    Statistics statistics;
+    statistics.pushedCount = pushedCount.load();
+    statistics.closedCount = closedCount.load();
+    statistics.batchesCount = batchesCount.load();
+    statistics.pendingCount = workCount.load();
+    statistics.maxPendingCount = maxPendingCount.load();
+    return statistics;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo, false);
+    closedCount++;
     workCount--;
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
+    WorkItem *localWorkItems = nullptr;
 
     while (self->active) {
-        lock.lock();
-        workItem = nullptr;
-
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+        localWorkItems = self->takeWorkItems();
+
+        if (localWorkItems == nullptr) {
+            std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+            self->sleepingWorkers++;
+            while (self->workItems.load() == nullptr && self->active) {
+                self->condition.wait(lock);
+            }
+            self->sleepingWorkers--;
+            continue;
         }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
-        }
-
-        lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
-        }
+        self->processWorkItems(localWorkItems);
     }
 
-    lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
+    while ((localWorkItems = self->takeWorkItems()) != nullptr) {
+        self->processWorkItems(localWorkItems);
     }
 
-    lock.unlock();
-    self->workerDone.store(true);
+    self->workersDone++;
     return nullptr;
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,10 +9,9 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
-#include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -26,6 +25,18 @@ enum class gemCloseWorkerMode {
 
 class DrmGemCloseWorker {
   public:
+    static constexpr uint32_t defaultWorkerThreadsCount = 1u;
+    static constexpr uint32_t maxWorkerThreadsCount = 16u;
+    static constexpr uint32_t maxBatchSize = 256u;
+
+    struct Statistics {
+        uint64_t pushedCount = 0u;
+        uint64_t closedCount = 0u;
+        uint64_t batchesCount = 0u;
+        uint32_t pendingCount = 0u;
+        uint32_t maxPendingCount = 0u;
+    };
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     ~DrmGemCloseWorker();
 
@@ -36,22 +47,39 @@ class DrmGemCloseWorker {
     void close(bool blocking);
 
     bool isEmpty();
+    Statistics getStatistics() const;
+    size_t getWorkerThreadsCount() const { return threads.size(); }
 
   protected:
+    struct WorkItem {
+        BufferObject *bo;
+        WorkItem *next;
+    };
+
     void close(BufferObject *workItem);
     void closeThread();
+    void pushWorkItems(WorkItem *first, WorkItem *last);
+    WorkItem *takeWorkItems();
+    void processWorkItems(WorkItem *workItems);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
-    std::unique_ptr<Thread> thread;
+    std::vector<std::unique_ptr<Thread>> threads;
 
-    std::queue<BufferObject *> queue;
+    // lock-free multi-producer list, consumers detach it as a whole
+    std::atomic<WorkItem *> workItems{nullptr};
     std::atomic<uint32_t> workCount{0};
+    std::atomic<uint32_t> sleepingWorkers{0};
 
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
-    std::atomic<bool> workerDone{false};
+    std::atomic<uint32_t> workersDone{0};
+
+    std::atomic<uint64_t> pushedCount{0};
+    std::atomic<uint64_t> closedCount{0};
+    std::atomic<uint64_t> batchesCount{0};
+    std::atomic<uint32_t> maxPendingCount{0};
 };
 } // namespace NEO
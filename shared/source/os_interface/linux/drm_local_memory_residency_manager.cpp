@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_local_memory_residency_manager.h"
+
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+namespace NEO {
+
+DrmLocalMemoryResidencyManager::DrmLocalMemoryResidencyManager(uint64_t budget) : budget(budget) {
+}
+
+void DrmLocalMemoryResidencyManager::registerAllocation(GraphicsAllocation &allocation) {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (lruEntries.find(&allocation) != lruEntries.end()) {
+        return;
+    }
+    auto size = allocation.getUnderlyingBufferSize();
+    lruEntries[&allocation] = lruList.insert(lruList.end(), {&allocation, size, false});
+    usedSize += size;
+}
+
+void DrmLocalMemoryResidencyManager::unregisterAllocation(GraphicsAllocation &allocation) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto lruEntry = lruEntries.find(&allocation);
+    if (lruEntry == lruEntries.end()) {
+        return;
+    }
+    if (!lruEntry->second->evicted) {
+        usedSize -= lruEntry->second->size;
+    }
+    lruList.erase(lruEntry->second);
+    lruEntries.erase(lruEntry);
+    if (usedSize <= budget) {
+        memoryBudgetExhausted = false;
+    }
+}
+
+void DrmLocalMemoryResidencyManager::markUsed(const std::vector<GraphicsAllocation *> &allocations) {
+    std::unique_lock<std::mutex> lock(mtx);
+    for (auto allocation : allocations) {
+        auto lruEntry = lruEntries.find(allocation);
+        if (lruEntry == lruEntries.end()) {
+            continue;
+        }
+        if (lruEntry->second->evicted) {
+            statistics.refaults++;
+        }
+        lruList.splice(lruList.end(), lruList, lruEntry->second);
+    }
+}
+
+bool DrmLocalMemoryResidencyManager::reserve(size_t size, const EvictFunction &evict) {
+    std::unique_lock<std::mutex> lock(mtx);
+    // walk from the coldest allocation, evict function skips allocations still in use by GPU
+    for (auto lruEntry = lruList.begin(); lruEntry != lruList.end() && usedSize + size > budget; lruEntry++) {
+        if (lruEntry->evicted || !evict(*lruEntry->allocation)) {
+            continue;
+        }
+        lruEntry->evicted = true;
+        usedSize -= lruEntry->size;
+        statistics.evictions++;
+        statistics.evictedBytes += lruEntry->size;
+    }
+
+    memoryBudgetExhausted = usedSize + size > budget;
+    if (memoryBudgetExhausted) {
+        statistics.failedReservations++;
+        return false;
+    }
+    return true;
+}
+
+bool DrmLocalMemoryResidencyManager::isEvicted(GraphicsAllocation &allocation) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto lruEntry = lruEntries.find(&allocation);
+    return lruEntry != lruEntries.end() && lruEntry->second->evicted;
+}
+
+DrmLocalMemoryResidencyManager::Statistics DrmLocalMemoryResidencyManager::getStatistics() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto currentStatistics = statistics;
+    currentStatistics.usedSize = usedSize;
+    currentStatistics.trackedCount = lruList.size();
+    currentStatistics.evictedCount = 0u;
+    for (auto &entry : lruList) {
+        if (entry.evicted) {
+            currentStatistics.evictedCount++;
+        }
+    }
+    return currentStatistics;
+}
+} // namespace NEO
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+
+class DrmLocalMemoryResidencyManager {
+  public:
+    using EvictFunction = std::function<bool(GraphicsAllocation &)>;
+
+    struct Statistics {
+        uint64_t evictions = 0u;
+        uint64_t evictedBytes = 0u;
+        uint64_t refaults = 0u;
+        uint64_t failedReservations = 0u;
+        uint64_t usedSize = 0u;
+        size_t trackedCount = 0u;
+        size_t evictedCount = 0u;
+    };
+
+    DrmLocalMemoryResidencyManager(uint64_t budget);
+
+    DrmLocalMemoryResidencyManager(const DrmLocalMemoryResidencyManager &) = delete;
+    DrmLocalMemoryResidencyManager &operator=(const DrmLocalMemoryResidencyManager &) = delete;
+
+    void registerAllocation(GraphicsAllocation &allocation);
+    void unregisterAllocation(GraphicsAllocation &allocation);
+    void markUsed(const std::vector<GraphicsAllocation *> &allocations);
+
+    bool reserve(size_t size, const EvictFunction &evict);
+
+    bool isEvicted(GraphicsAllocation &allocation);
+    bool isMemoryBudgetExhausted() const { return memoryBudgetExhausted; }
+    uint64_t getBudget() const { return budget; }
+    Statistics getStatistics() const;
+
+  protected:
+    struct Entry {
+        GraphicsAllocation *allocation;
+        size_t size;
+        bool evicted;
+    };
+    using LruList = std::list<Entry>;
+
+    const uint64_t budget;
+    uint64_t usedSize = 0u;
+    Statistics statistics;
+    std::atomic<bool> memoryBudgetExhausted{false};
+
+    // least recently used allocations at the front
+    LruList lruList;
+    std::unordered_map<GraphicsAllocation *, LruList::iterator> lruEntries;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
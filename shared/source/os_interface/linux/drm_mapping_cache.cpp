@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_mapping_cache.h"
+
+namespace NEO {
+
+DrmMappingCache::DrmMappingCache(size_t maxCachedSize) : maxCachedSize(maxCachedSize) {
+}
+
+void *DrmMappingCache::take(BufferObject *bo) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    auto entry = mappingsByBo.find(bo);
+    if (entry == mappingsByBo.end()) {
+        statistics.misses++;
+        return nullptr;
+    }
+
+    // locked mapping is owned by buffer object until next unlock stores it again
+    auto address = entry->second->address;
+    cachedSize -= entry->second->size;
+    mappings.erase(entry->second);
+    mappingsByBo.erase(entry);
+    statistics.hits++;
+    return address;
+}
+
+bool DrmMappingCache::store(const CachedMapping &cachedMapping, std::vector<CachedMapping> &evictedMappings) {
+    if (cachedMapping.size > maxCachedSize || cachedMapping.address == nullptr) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    if (mappingsByBo.find(cachedMapping.bo) != mappingsByBo.end()) {
+        return false;
+    }
+
+    trim(maxCachedSize - cachedMapping.size, maxCachedCount - 1, evictedMappings);
+    mappings.push_back(cachedMapping);
+    mappingsByBo[cachedMapping.bo] = std::prev(mappings.end());
+    cachedSize += cachedMapping.size;
+    return true;
+}
+
+bool DrmMappingCache::remove(BufferObject *bo, CachedMapping &cachedMapping) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    auto entry = mappingsByBo.find(bo);
+    if (entry == mappingsByBo.end()) {
+        return false;
+    }
+    cachedMapping = *entry->second;
+    cachedSize -= cachedMapping.size;
+    mappings.erase(entry->second);
+    mappingsByBo.erase(entry);
+    return true;
+}
+
+void DrmMappingCache::release(std::vector<CachedMapping> &evictedMappings) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto evictions = statistics.evictions;
+    trim(0u, 0u, evictedMappings);
+    statistics.evictions = evictions;
+}
+
+DrmMappingCache::Statistics DrmMappingCache::getStatistics() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto currentStatistics = statistics;
+    currentStatistics.cachedSize = cachedSize;
+    currentStatistics.cachedCount = mappings.size();
+    return currentStatistics;
+}
+
+void DrmMappingCache::trim(size_t targetSize, size_t targetCount, std::vector<CachedMapping> &evictedMappings) {
+    while ((cachedSize > targetSize || mappings.size() > targetCount) && !mappings.empty()) {
+        auto &oldestMapping = mappings.front();
+        evictedMappings.push_back(oldestMapping);
+        cachedSize -= oldestMapping.size;
+        mappingsByBo.erase(oldestMapping.bo);
+        mappings.pop_front();
+        statistics.evictions++;
+    }
+}
+} // namespace NEO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class BufferObject;
+
+// CPU mappings of unlocked buffer objects kept for next lock, least recently unlocked are unmapped first.
+// Count of entries is bounded as well, every mapping takes a VMA of process address space.
+class DrmMappingCache {
+  public:
+    static constexpr size_t maxCachedCount = 256u;
+
+    struct CachedMapping {
+        BufferObject *bo = nullptr;
+        void *address = nullptr;
+        size_t size = 0u;
+    };
+
+    struct Statistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictions = 0u;
+        size_t cachedSize = 0u;
+        size_t cachedCount = 0u;
+    };
+
+    DrmMappingCache(size_t maxCachedSize);
+
+    DrmMappingCache(const DrmMappingCache &) = delete;
+    DrmMappingCache &operator=(const DrmMappingCache &) = delete;
+
+    void *take(BufferObject *bo);
+    bool store(const CachedMapping &cachedMapping, std::vector<CachedMapping> &evictedMappings);
+    bool remove(BufferObject *bo, CachedMapping &cachedMapping);
+    void release(std::vector<CachedMapping> &evictedMappings);
+
+    Statistics getStatistics() const;
+    size_t getMaxCachedSize() const { return maxCachedSize; }
+
+  protected:
+    void trim(size_t targetSize, size_t targetCount, std::vector<CachedMapping> &evictedMappings);
+
+    const size_t maxCachedSize;
+    size_t cachedSize = 0u;
+    std::list<CachedMapping> mappings;
+    std::unordered_map<BufferObject *, std::list<CachedMapping>::iterator> mappingsByBo;
+    Statistics statistics;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -23,6 +23,7 @@
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "drm/i915_drm.h"
 
@@ -88,12 +89,30 @@ void DrmMemoryManager::initialize(gemCloseWorkerMode mode) {
         }
 
         pinBBs.push_back(bo);
+        auto osInterface = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->osInterface.get();
+        auto drm = osInterface ? osInterface->get()->getDrm() : nullptr;
+        numaNodes.push_back(drm ? drm->getNumaNode() : -1);
+    }
+
+    if (DebugManager.flags.BufferObjectReuseCacheSize.get() > 0) {
+        bufferObjectCache = std::make_unique<DrmBufferObjectCache>(static_cast<size_t>(DebugManager.flags.BufferObjectReuseCacheSize.get()));
+    }
+
+    if (DebugManager.flags.LockedMappingCacheSize.get() > 0) {
+        mappingCache = std::make_unique<DrmMappingCache>(static_cast<size_t>(DebugManager.flags.LockedMappingCacheSize.get()));
+    }
+
+    if (DebugManager.flags.LocalMemoryEvictionBudget.get() >= 0) {
+        createLocalMemoryResidencyManagers();
     }
 
     initialized = true;
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    releaseMappingCache();
+    releaseBufferObjectCache();
+    printLocalMemoryResidencyStatistics();
     for (auto &memoryForPinBB : memoryForPinBBs) {
         if (memoryForPinBB) {
             MemoryManager::alignedFreeWrapper(memoryForPinBB);
@@ -106,6 +125,9 @@ void DrmMemoryManager::commonCleanup() {
         gemCloseWorker->close(false);
     }
 
+    releaseMappingCache();
+    releaseBufferObjectCache();
+
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < pinBBs.size(); ++rootDeviceIndex) {
         if (auto bo = pinBBs[rootDeviceIndex]) {
             if (isLimitedRange(rootDeviceIndex)) {
@@ -118,15 +140,23 @@ void DrmMemoryManager::commonCleanup() {
 }
 
 void DrmMemoryManager::eraseSharedBufferObject(NEO::BufferObject *bo) {
-    auto it = std::find(sharingBufferObjects.begin(), sharingBufferObjects.end(), bo);
-    DEBUG_BREAK_IF(it == sharingBufferObjects.end());
-    releaseGpuRange(reinterpret_cast<void *>((*it)->gpuAddress), (*it)->peekUnmapSize(), this->getRootDeviceIndex(bo->drm));
+    auto it = sharingBufferObjects.find(bo->handle);
+    DEBUG_BREAK_IF(it == sharingBufferObjects.end() || it->second != bo);
+    releaseGpuRange(reinterpret_cast<void *>(bo->gpuAddress), bo->peekUnmapSize(), this->getRootDeviceIndex(bo->drm));
     sharingBufferObjects.erase(it);
+
+    for (auto importedHandle = importedHandles.begin(); importedHandle != importedHandles.end();) {
+        if (importedHandle->second.bo == bo) {
+            importedHandle = importedHandles.erase(importedHandle);
+        } else {
+            importedHandle++;
+        }
+    }
 }
 
 void DrmMemoryManager::pushSharedBufferObject(NEO::BufferObject *bo) {
     bo->isReused = true;
-    sharingBufferObjects.push_back(bo);
+    sharingBufferObjects[bo->handle] = bo;
 }
 
 uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDestroy) {
@@ -233,9 +263,25 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(allocationData.size, minAlignment), minAlignment);
 
+    auto hugePageBacking = isHugePageBackingPreferred(allocationData, cSize);
+    if (hugePageBacking) {
+        // whole 2MB pages, a partial tail page would be backed with 4KB pages
+        cSize = alignUp(cSize, MemoryConstants::pageSize2Mb);
+        cAlignment = alignUp(cAlignment, MemoryConstants::pageSize2Mb);
+    }
+
     uint64_t gpuAddress = 0;
     size_t alignedSize = cSize;
     auto svmCpuAllocation = allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU;
+
+    if (bufferObjectCache && !svmCpuAllocation && !hugePageBacking && isUserptrUsedForAllocWithAlignment(allocationData)) {
+        auto reservedRangeRequired = isLimitedRange(allocationData.rootDeviceIndex) && !allocationData.flags.isUSMHostAllocation;
+        DrmBufferObjectCache::CachedBufferObject cachedBufferObject;
+        if (bufferObjectCache->take(allocationData.rootDeviceIndex, cSize, cAlignment, reservedRangeRequired, cachedBufferObject)) {
+            return createAllocFromCachedBufferObject(allocationData, cSize, cachedBufferObject);
+        }
+    }
+
     if (svmCpuAllocation) {
         //add 2MB padding in case reserved addr is not 2MB aligned
         alignedSize = alignUp(cSize, cAlignment) + cAlignment;
@@ -256,15 +302,107 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
     return createAllocWithAlignment(allocationData, cSize, cAlignment, alignedSize, gpuAddress);
 }
 
+bool DrmMemoryManager::isHugePageBackingPreferred(const AllocationData &allocationData, size_t size) const {
+    auto threshold = DebugManager.flags.UsmHostHugePageThreshold.get();
+    return allocationData.flags.isUSMHostAllocation && threshold >= 0 && size >= static_cast<size_t>(threshold);
+}
+
+bool DrmMemoryManager::isLargePageBackingPreferred(const AllocationData &allocationData, size_t size) {
+    auto threshold = DebugManager.flags.LocalMemoryLargePageThreshold.get();
+    if (threshold < 0 || size < static_cast<size_t>(threshold) || DebugManager.flags.AlignLocalMemoryVaTo2MB.get() == 0) {
+        return false;
+    }
+    // only allocations getting GPU VA from HEAP_STANDARD2MB can be mapped with 2MB pages
+    return allocationData.type != GraphicsAllocation::AllocationType::IMAGE &&
+           allocationData.type != GraphicsAllocation::AllocationType::WRITE_COMBINED &&
+           allocationData.type != GraphicsAllocation::AllocationType::SVM_GPU &&
+           !heapAssigner.useInternal32BitHeap(allocationData.type);
+}
+
+void DrmMemoryManager::registerLargePageBacking(size_t size) {
+    auto currentSize = largePageBackedMemorySize.fetch_add(size) + size;
+    auto maxSize = maxLargePageBackedMemorySize.load();
+    while (currentSize > maxSize && !maxLargePageBackedMemorySize.compare_exchange_weak(maxSize, currentSize)) {
+    }
+}
+
+void *DrmMemoryManager::mmapHugePageMemory(size_t size) {
+    DEBUG_BREAK_IF(!isAligned<MemoryConstants::pageSize2Mb>(size));
+
+    // explicit huge pages are used when hugetlbfs pool has enough pages reserved
+    auto ptr = this->mmapFunction(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED) {
+        return ptr;
+    }
+
+    // otherwise reserve additional 2MB to align anonymous mapping and advise transparent huge pages
+    auto reservedSize = size + MemoryConstants::pageSize2Mb;
+    ptr = this->mmapFunction(nullptr, reservedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto alignedPtr = alignUp(ptr, MemoryConstants::pageSize2Mb);
+    auto headSize = ptrDiff(alignedPtr, ptr);
+    if (headSize != 0) {
+        this->munmapFunction(ptr, headSize);
+    }
+    this->munmapFunction(ptrOffset(alignedPtr, size), MemoryConstants::pageSize2Mb - headSize);
+
+    [[maybe_unused]] auto retCode = this->madviseFunction(alignedPtr, size, MADV_HUGEPAGE);
+    DEBUG_BREAK_IF(retCode != 0);
+
+    return alignedPtr;
+}
+
+int DrmMemoryManager::getUsmNumaNode(uint32_t rootDeviceIndex) const {
+    if (DebugManager.flags.OverrideUsmNumaNode.get() >= 0) {
+        return DebugManager.flags.OverrideUsmNumaNode.get();
+    }
+    if (DebugManager.flags.EnableUsmNumaPlacement.get() == 0 || rootDeviceIndex >= numaNodes.size()) {
+        return -1;
+    }
+    return numaNodes[rootDeviceIndex];
+}
+
+bool DrmMemoryManager::bindToNumaNode(void *ptr, size_t size, int numaNode) {
+    constexpr int mpolPreferred = 1;
+    constexpr unsigned mpolMfMove = 1u << 1;
+    constexpr size_t bitsPerMaskEntry = sizeof(unsigned long) * 8;
+
+    std::vector<unsigned long> nodeMask(numaNode / bitsPerMaskEntry + 1, 0u);
+    nodeMask[numaNode / bitsPerMaskEntry] = 1ul << (numaNode % bitsPerMaskEntry);
+
+    // preferred policy falls back to other nodes instead of failing when the node runs out of memory,
+    // pages already touched by the allocator are migrated
+    return SysCalls::mbind(ptr, size, mpolPreferred, nodeMask.data(), nodeMask.size() * bitsPerMaskEntry + 1, mpolMfMove) == 0;
+}
+
 DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSVMSize, uint64_t gpuAddress) {
-    auto res = alignedMallocWrapper(size, alignment);
+    auto hugePageBacking = isHugePageBackingPreferred(allocationData, size) && isAligned<MemoryConstants::pageSize2Mb>(size);
+    auto res = hugePageBacking ? mmapHugePageMemory(size) : alignedMallocWrapper(size, alignment);
     if (!res) {
         return nullptr;
     }
+    auto freeBacking = [&]() {
+        if (hugePageBacking) {
+            this->munmapFunction(res, size);
+        } else {
+            alignedFreeWrapper(res);
+        }
+    };
+
+    auto numaNode = -1;
+    if (allocationData.flags.isUSMHostAllocation || allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU) {
+        numaNode = getUsmNumaNode(allocationData.rootDeviceIndex);
+        if (numaNode >= 0 && !bindToNumaNode(res, size, numaNode)) {
+            numaNode = -1;
+        }
+    }
 
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), size, 0, allocationData.rootDeviceIndex));
     if (!bo) {
-        alignedFreeWrapper(res);
+        freeBacking();
         return nullptr;
     }
 
@@ -274,8 +412,13 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const Alloc
     auto allocation = std::make_unique<DrmAllocation>(allocationData.rootDeviceIndex, allocationData.type, bo.get(), res, bo->gpuAddress, size, MemoryPool::System4KBPages);
     allocation->setDriverAllocatedCpuPtr(res);
     allocation->setReservedAddressRange(reinterpret_cast<void *>(gpuAddress), alignedSVMSize);
+    allocation->setBufferObjectCacheable(allocationData.type != GraphicsAllocation::AllocationType::SVM_CPU && !hugePageBacking);
+    if (hugePageBacking) {
+        allocation->setHugePageMappingSize(size);
+    }
+    allocation->setNumaNode(numaNode);
     if (!allocation->setCacheRegion(&this->getDrm(allocationData.rootDeviceIndex), static_cast<CacheRegion>(allocationData.cacheRegion))) {
-        alignedFreeWrapper(res);
+        freeBacking();
         return nullptr;
     }
 
@@ -284,6 +427,158 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const Alloc
     return allocation.release();
 }
 
+DrmAllocation *DrmMemoryManager::createAllocFromCachedBufferObject(const AllocationData &allocationData, size_t size, const DrmBufferObjectCache::CachedBufferObject &cachedBufferObject) {
+    auto bo = cachedBufferObject.bo;
+    emitPinningRequest(bo, allocationData);
+
+    auto allocation = std::make_unique<DrmAllocation>(allocationData.rootDeviceIndex, allocationData.type, bo, cachedBufferObject.cpuPtr, bo->gpuAddress, size, MemoryPool::System4KBPages);
+    allocation->setDriverAllocatedCpuPtr(cachedBufferObject.cpuPtr);
+    allocation->setReservedAddressRange(cachedBufferObject.reservedAddress, cachedBufferObject.reservedSize);
+    allocation->setBufferObjectCacheable(true);
+    if (!allocation->setCacheRegion(&this->getDrm(allocationData.rootDeviceIndex), static_cast<CacheRegion>(allocationData.cacheRegion))) {
+        destroyCachedBufferObject(cachedBufferObject);
+        return nullptr;
+    }
+
+    return allocation.release();
+}
+
+bool DrmMemoryManager::storeBufferObjectInCache(DrmAllocation *drmAllocation) {
+    if (!bufferObjectCache || !drmAllocation->isBufferObjectCacheable() ||
+        drmAllocation->fragmentsStorage.fragmentCount || drmAllocation->getMmapPtr() ||
+        drmAllocation->peekSharedHandle() != Sharing::nonSharedResource || drmAllocation->getExportedDmaBufFd() >= 0) {
+        return false;
+    }
+
+    auto bo = drmAllocation->getBO();
+    if (!bo || bo->peekIsReusableAllocation() || bo->isMarkedForCapture() ||
+        bo->peekCacheRegion() != CacheRegion::Default || bo->getRefCount() != 1) {
+        return false;
+    }
+
+    DrmBufferObjectCache::CachedBufferObject cachedBufferObject;
+    cachedBufferObject.bo = bo;
+    cachedBufferObject.cpuPtr = drmAllocation->getDriverAllocatedCpuPtr();
+    cachedBufferObject.reservedAddress = drmAllocation->getReservedAddressPtr();
+    cachedBufferObject.reservedSize = drmAllocation->getReservedAddressSize();
+    cachedBufferObject.size = bo->peekSize();
+    cachedBufferObject.rootDeviceIndex = drmAllocation->getRootDeviceIndex();
+
+    std::vector<DrmBufferObjectCache::CachedBufferObject> evictedBufferObjects;
+    auto stored = bufferObjectCache->store(cachedBufferObject, evictedBufferObjects);
+    for (auto &evictedBufferObject : evictedBufferObjects) {
+        destroyCachedBufferObject(evictedBufferObject);
+    }
+    return stored;
+}
+
+void DrmMemoryManager::destroyCachedBufferObject(const DrmBufferObjectCache::CachedBufferObject &cachedBufferObject) {
+    unreference(cachedBufferObject.bo, true);
+    releaseGpuRange(cachedBufferObject.reservedAddress, cachedBufferObject.reservedSize, cachedBufferObject.rootDeviceIndex);
+    alignedFreeWrapper(cachedBufferObject.cpuPtr);
+}
+
+void DrmMemoryManager::releaseBufferObjectCache() {
+    if (!bufferObjectCache) {
+        return;
+    }
+
+    auto statistics = bufferObjectCache->getStatistics();
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintBOCreateDestroyResult.get(), stdout, "BO reuse cache hits: %llu, misses: %llu, evictions: %llu\n",
+                       static_cast<unsigned long long>(statistics.hits), static_cast<unsigned long long>(statistics.misses), static_cast<unsigned long long>(statistics.evictions));
+
+    std::vector<DrmBufferObjectCache::CachedBufferObject> evictedBufferObjects;
+    bufferObjectCache->release(evictedBufferObjects);
+    for (auto &evictedBufferObject : evictedBufferObjects) {
+        destroyCachedBufferObject(evictedBufferObject);
+    }
+}
+
+void *DrmMemoryManager::takeCachedMapping(GraphicsAllocation &graphicsAllocation) {
+    auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
+    if (!mappingCache || bo == nullptr) {
+        return nullptr;
+    }
+
+    auto address = mappingCache->take(bo);
+    if (address == nullptr) {
+        return nullptr;
+    }
+    bo->setLockedAddress(address);
+
+    if (MemoryPool::LocalMemory != graphicsAllocation.getMemoryPool() && isCpuDomainTransitionRequired(graphicsAllocation)) {
+        auto success = setDomainCpu(graphicsAllocation, false);
+        DEBUG_BREAK_IF(!success);
+        (void)success;
+    }
+    return address;
+}
+
+bool DrmMemoryManager::storeMappingInCache(GraphicsAllocation &graphicsAllocation) {
+    // write combined mapping is trimmed to 64KB alignment, it cannot be reused as whole
+    if (!mappingCache || graphicsAllocation.getUnderlyingBuffer() != nullptr ||
+        graphicsAllocation.getAllocationType() == GraphicsAllocation::AllocationType::WRITE_COMBINED) {
+        return false;
+    }
+
+    auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
+    if (bo == nullptr || bo->peekLockedAddress() == nullptr) {
+        return false;
+    }
+
+    DrmMappingCache::CachedMapping cachedMapping;
+    cachedMapping.bo = bo;
+    cachedMapping.address = bo->peekLockedAddress();
+    cachedMapping.size = bo->peekSize();
+
+    std::vector<DrmMappingCache::CachedMapping> evictedMappings;
+    auto stored = mappingCache->store(cachedMapping, evictedMappings);
+    unmapCachedMappings(evictedMappings);
+    if (stored) {
+        bo->setLockedAddress(nullptr);
+    }
+    return stored;
+}
+
+void DrmMemoryManager::removeCachedMappings(DrmAllocation &drmAllocation) {
+    if (!mappingCache) {
+        return;
+    }
+
+    std::vector<DrmMappingCache::CachedMapping> removedMappings;
+    for (auto bo : drmAllocation.getBOs()) {
+        DrmMappingCache::CachedMapping cachedMapping;
+        if (bo && mappingCache->remove(bo, cachedMapping)) {
+            removedMappings.push_back(cachedMapping);
+        }
+    }
+    unmapCachedMappings(removedMappings);
+}
+
+void DrmMemoryManager::unmapCachedMappings(const std::vector<DrmMappingCache::CachedMapping> &cachedMappings) {
+    for (auto &cachedMapping : cachedMappings) {
+        auto ret = munmapFunction(cachedMapping.address, cachedMapping.size);
+        DEBUG_BREAK_IF(ret != 0);
+        UNUSED_VARIABLE(ret);
+    }
+}
+
+bool DrmMemoryManager::releaseMappingCache() {
+    if (!mappingCache) {
+        return false;
+    }
+
+    std::vector<DrmMappingCache::CachedMapping> evictedMappings;
+    mappingCache->release(evictedMappings);
+    unmapCachedMappings(evictedMappings);
+    return !evictedMappings.empty();
+}
+
+bool DrmMemoryManager::isCpuDomainTransitionRequired(GraphicsAllocation &graphicsAllocation) const {
+    // allocation never used by GPU has no GPU writes to wait for or flush
+    return !mappingCache || graphicsAllocation.isUsed();
+}
+
 void DrmMemoryManager::obtainGpuAddress(const AllocationData &allocationData, BufferObject *bo, uint64_t gpuAddress) {
     if ((isLimitedRange(allocationData.rootDeviceIndex) || allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU) &&
         !allocationData.flags.isUSMHostAllocation) {
@@ -311,7 +606,8 @@ DrmAllocation *DrmMemoryManager::allocateUSMHostGraphicsMemory(const AllocationD
     // if limitedRangeAlloction is enabled, memory allocation for bo in the limited Range heap is required
     uint64_t gpuAddress = 0;
     if (isLimitedRange(allocationData.rootDeviceIndex)) {
-        gpuAddress = acquireGpuRange(cSize, allocationData.rootDeviceIndex, HeapIndex::HEAP_STANDARD);
+        auto heapIndex = isHugePageBackingPreferred(allocationData, cSize) ? HeapIndex::HEAP_STANDARD2MB : HeapIndex::HEAP_STANDARD;
+        gpuAddress = acquireGpuRange(cSize, allocationData.rootDeviceIndex, heapIndex);
         if (!gpuAddress) {
             return nullptr;
         }
@@ -551,58 +847,84 @@ DrmAllocation *DrmMemoryManager::allocate32BitGraphicsMemoryImpl(const Allocatio
 }
 
 BufferObject *DrmMemoryManager::findAndReferenceSharedBufferObject(int boHandle) {
-    BufferObject *bo = nullptr;
-    for (const auto &i : sharingBufferObjects) {
-        if (i->handle == boHandle) {
-            bo = i;
-            bo->reference();
-            break;
-        }
+    auto it = sharingBufferObjects.find(boHandle);
+    if (it == sharingBufferObjects.end()) {
+        return nullptr;
     }
-
-    return bo;
+    it->second->reference();
+    return it->second;
 }
 
-GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool requireSpecificBitness) {
-    std::unique_lock<std::mutex> lock(mtx);
-
-    drm_prime_handle openFd = {0, 0, 0};
-    openFd.fd = handle;
-
-    auto ret = this->getDrm(properties.rootDeviceIndex).ioctl(DRM_IOCTL_PRIME_FD_TO_HANDLE, &openFd);
+BufferObject *DrmMemoryManager::findAndReferenceImportedBufferObject(osHandle handle, ino_t &inode) {
+    inode = 0;
+    struct stat handleStat = {};
+    if (fstatFunction(handle, &handleStat) != 0) {
+        return nullptr;
+    }
+    inode = handleStat.st_ino;
 
-    if (ret != 0) {
-        int err = errno;
-        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "ioctl(PRIME_FD_TO_HANDLE) failed with %d. errno=%d(%s)\n", ret, err, strerror(err));
-        DEBUG_BREAK_IF(ret != 0);
-        UNUSED_VARIABLE(ret);
+    auto importedHandle = importedHandles.find(handle);
+    if (importedHandle == importedHandles.end()) {
+        return nullptr;
+    }
+    if (importedHandle->second.inode != inode) {
+        // fd was closed and reused for a different dma-buf
+        importedHandles.erase(importedHandle);
         return nullptr;
     }
+    importedHandle->second.bo->reference();
+    return importedHandle->second.bo;
+}
+
+GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool requireSpecificBitness) {
+    std::unique_lock<std::mutex> lock(mtx);
 
-    auto boHandle = openFd.handle;
-    auto bo = findAndReferenceSharedBufferObject(boHandle);
+    int ret = 0;
+    ino_t inode = 0;
+    auto bo = findAndReferenceImportedBufferObject(handle, inode);
 
     if (bo == nullptr) {
-        size_t size = lseekFunction(handle, 0, SEEK_END);
+        drm_prime_handle openFd = {0, 0, 0};
+        openFd.fd = handle;
 
-        bo = new (std::nothrow) BufferObject(&getDrm(properties.rootDeviceIndex), boHandle, size, maxOsContextCount);
+        ret = this->getDrm(properties.rootDeviceIndex).ioctl(DRM_IOCTL_PRIME_FD_TO_HANDLE, &openFd);
 
-        if (!bo) {
+        if (ret != 0) {
+            int err = errno;
+            PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "ioctl(PRIME_FD_TO_HANDLE) failed with %d. errno=%d(%s)\n", ret, err, strerror(err));
+            DEBUG_BREAK_IF(ret != 0);
+            UNUSED_VARIABLE(ret);
             return nullptr;
         }
 
-        auto heapIndex = isLocalMemorySupported(properties.rootDeviceIndex) ? HeapIndex::HEAP_STANDARD2MB : HeapIndex::HEAP_STANDARD;
-        if (requireSpecificBitness && this->force32bitAllocations) {
-            heapIndex = HeapIndex::HEAP_EXTERNAL;
-        }
-        auto gpuRange = acquireGpuRange(size, properties.rootDeviceIndex, heapIndex);
+        bo = findAndReferenceSharedBufferObject(openFd.handle);
 
-        bo->setAddress(gpuRange);
-        bo->setUnmapSize(size);
+        if (bo == nullptr) {
+            size_t size = lseekFunction(handle, 0, SEEK_END);
 
-        pushSharedBufferObject(bo);
-    }
+            bo = new (std::nothrow) BufferObject(&getDrm(properties.rootDeviceIndex), openFd.handle, size, maxOsContextCount);
+
+            if (!bo) {
+                return nullptr;
+            }
+
+            auto heapIndex = isLocalMemorySupported(properties.rootDeviceIndex) ? HeapIndex::HEAP_STANDARD2MB : HeapIndex::HEAP_STANDARD;
+            if (requireSpecificBitness && this->force32bitAllocations) {
+                heapIndex = HeapIndex::HEAP_EXTERNAL;
+            }
+            auto gpuRange = acquireGpuRange(size, properties.rootDeviceIndex, heapIndex);
+
+            bo->setAddress(gpuRange);
+            bo->setUnmapSize(size);
+
+            pushSharedBufferObject(bo);
+        }
 
+        if (inode != 0) {
+            importedHandles[handle] = {inode, bo};
+        }
+    }
+    auto boHandle = bo->handle;
     lock.unlock();
 
     auto drmAllocation = new DrmAllocation(properties.rootDeviceIndex, properties.allocationType, bo, reinterpret_cast<void *>(bo->gpuAddress), bo->size,
@@ -638,6 +960,14 @@ void DrmMemoryManager::closeSharedHandle(GraphicsAllocation *gfxAllocation) {
     }
 }
 
+uint64_t DrmMemoryManager::getSharedHandleIdentity(osHandle handle) {
+    struct stat handleStat = {};
+    if (fstatFunction(handle, &handleStat) != 0) {
+        return 0u;
+    }
+    return static_cast<uint64_t>(handleStat.st_ino);
+}
+
 GraphicsAllocation *DrmMemoryManager::createPaddedAllocation(GraphicsAllocation *inputGraphicsAllocation, size_t sizeWithPadding) {
     uint64_t gpuRange = 0llu;
 
@@ -705,10 +1035,26 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
         this->munmapFunction(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
     }
 
+    removeCachedMappings(*drmAlloc);
+
+    if (drmAlloc->getExportedDmaBufFd() >= 0) {
+        SysCalls::close(drmAlloc->getExportedDmaBufFd());
+    }
+
+    if (drmAlloc->getLargePageBackingSize()) {
+        largePageBackedMemorySize -= drmAlloc->getLargePageBackingSize();
+    }
+
     for (auto handleId = 0u; handleId < gfxAllocation->getNumGmms(); handleId++) {
         delete gfxAllocation->getGmm(handleId);
     }
 
+    if (storeBufferObjectInCache(drmAlloc)) {
+        drmAlloc->freeRegisteredBOBindExtHandles(&getDrm(drmAlloc->getRootDeviceIndex()));
+        delete gfxAllocation;
+        return;
+    }
+
     if (gfxAllocation->fragmentsStorage.fragmentCount) {
         cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
     } else {
@@ -720,7 +1066,11 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
     }
 
     releaseGpuRange(gfxAllocation->getReservedAddressPtr(), gfxAllocation->getReservedAddressSize(), gfxAllocation->getRootDeviceIndex());
-    alignedFreeWrapper(gfxAllocation->getDriverAllocatedCpuPtr());
+    if (drmAlloc->getHugePageMappingSize()) {
+        this->munmapFunction(gfxAllocation->getDriverAllocatedCpuPtr(), drmAlloc->getHugePageMappingSize());
+    } else {
+        alignedFreeWrapper(gfxAllocation->getDriverAllocatedCpuPtr());
+    }
 
     drmAlloc->freeRegisteredBOBindExtHandles(&getDrm(drmAlloc->getRootDeviceIndex()));
 
@@ -862,15 +1212,21 @@ bool DrmMemoryManager::setDomainCpu(GraphicsAllocation &graphicsAllocation, bool
 }
 
 void *DrmMemoryManager::lockResourceImpl(GraphicsAllocation &graphicsAllocation) {
+    if (auto cachedAddress = takeCachedMapping(graphicsAllocation)) {
+        return cachedAddress;
+    }
+
     if (MemoryPool::LocalMemory == graphicsAllocation.getMemoryPool()) {
         return lockResourceInLocalMemoryImpl(graphicsAllocation);
     }
 
     auto cpuPtr = graphicsAllocation.getUnderlyingBuffer();
     if (cpuPtr != nullptr) {
-        auto success = setDomainCpu(graphicsAllocation, false);
-        DEBUG_BREAK_IF(!success);
-        (void)success;
+        if (isCpuDomainTransitionRequired(graphicsAllocation)) {
+            auto success = setDomainCpu(graphicsAllocation, false);
+            DEBUG_BREAK_IF(!success);
+            (void)success;
+        }
         return cpuPtr;
     }
 
@@ -882,19 +1238,29 @@ void *DrmMemoryManager::lockResourceImpl(GraphicsAllocation &graphicsAllocation)
     mmap_arg.handle = bo->peekHandle();
     mmap_arg.size = bo->peekSize();
     if (getDrm(graphicsAllocation.getRootDeviceIndex()).ioctl(DRM_IOCTL_I915_GEM_MMAP, &mmap_arg) != 0) {
-        return nullptr;
+        // out of address space, retry once with cached mappings unmapped
+        mmap_arg.addr_ptr = 0u;
+        if (!releaseMappingCache() || getDrm(graphicsAllocation.getRootDeviceIndex()).ioctl(DRM_IOCTL_I915_GEM_MMAP, &mmap_arg) != 0) {
+            return nullptr;
+        }
     }
 
     bo->setLockedAddress(reinterpret_cast<void *>(mmap_arg.addr_ptr));
 
-    auto success = setDomainCpu(graphicsAllocation, false);
-    DEBUG_BREAK_IF(!success);
-    (void)success;
+    if (isCpuDomainTransitionRequired(graphicsAllocation)) {
+        auto success = setDomainCpu(graphicsAllocation, false);
+        DEBUG_BREAK_IF(!success);
+        (void)success;
+    }
 
     return bo->peekLockedAddress();
 }
 
 void DrmMemoryManager::unlockResourceImpl(GraphicsAllocation &graphicsAllocation) {
+    if (storeMappingInCache(graphicsAllocation)) {
+        return;
+    }
+
     if (MemoryPool::LocalMemory == graphicsAllocation.getMemoryPool()) {
         return unlockResourceInLocalMemoryImpl(static_cast<DrmAllocation &>(graphicsAllocation).getBO());
     }
@@ -963,6 +1329,27 @@ void DrmMemoryManager::freeGpuAddress(AddressRange addressRange, uint32_t rootDe
     releaseGpuRange(reinterpret_cast<void *>(addressRange.address), addressRange.size, rootDeviceIndex);
 }
 
+bool DrmMemoryManager::mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuAddress) {
+    auto drmAllocation = static_cast<DrmAllocation *>(physicalAllocation);
+    if (drmAllocation->fragmentsStorage.fragmentCount) {
+        return false;
+    }
+
+    // bindings at the previous address have to be dropped before buffer objects are moved
+    auto memoryOperationsInterface = static_cast<DrmMemoryOperationsHandler *>(executionEnvironment.rootDeviceEnvironments[physicalAllocation->getRootDeviceIndex()]->memoryOperationsInterface.get());
+    for (auto &engine : this->registeredEngines) {
+        memoryOperationsInterface->evictWithinOsContext(engine.osContext, *physicalAllocation);
+    }
+
+    auto previousGpuAddress = physicalAllocation->getGpuAddress();
+    for (auto bo : drmAllocation->getBOs()) {
+        if (bo) {
+            bo->setAddress(gpuAddress + (bo->peekAddress() - previousGpuAddress));
+        }
+    }
+    return MemoryManager::mapPhysicalToVirtualMemory(physicalAllocation, gpuAddress);
+}
+
 std::unique_lock<std::mutex> DrmMemoryManager::acquireAllocLock() {
     return std::unique_lock<std::mutex>(this->allocMutex);
 }
@@ -981,10 +1368,16 @@ void DrmMemoryManager::registerSysMemAlloc(GraphicsAllocation *allocation) {
 }
 
 void DrmMemoryManager::registerLocalMemAlloc(GraphicsAllocation *allocation, uint32_t rootDeviceIndex) {
+    if (auto residencyManager = getLocalMemoryResidencyManager(rootDeviceIndex)) {
+        residencyManager->registerAllocation(*allocation);
+    }
     std::lock_guard<std::mutex> lock(this->allocMutex);
     this->localMemAllocs[rootDeviceIndex].push_back(allocation);
 }
 void DrmMemoryManager::unregisterAllocation(GraphicsAllocation *allocation) {
+    if (auto residencyManager = getLocalMemoryResidencyManager(allocation->getRootDeviceIndex())) {
+        residencyManager->unregisterAllocation(*allocation);
+    }
     std::lock_guard<std::mutex> lock(this->allocMutex);
     sysMemAllocs.erase(std::remove(sysMemAllocs.begin(), sysMemAllocs.end(), allocation),
                        sysMemAllocs.end());
@@ -994,6 +1387,73 @@ void DrmMemoryManager::unregisterAllocation(GraphicsAllocation *allocation) {
                                                            localMemAllocs[allocation->getRootDeviceIndex()].end());
 }
 
+void DrmMemoryManager::createLocalMemoryResidencyManagers() {
+    localMemoryResidencyManagers.resize(gfxPartitions.size());
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < gfxPartitions.size(); ++rootDeviceIndex) {
+        if (!localMemorySupported[rootDeviceIndex]) {
+            continue;
+        }
+        uint64_t budget = static_cast<uint64_t>(DebugManager.flags.LocalMemoryEvictionBudget.get());
+        if (budget == 0u) {
+            budget = getLocalMemorySize(rootDeviceIndex, 1u);
+        }
+        if (budget != 0u) {
+            localMemoryResidencyManagers[rootDeviceIndex] = std::make_unique<DrmLocalMemoryResidencyManager>(budget);
+        }
+    }
+}
+
+DrmLocalMemoryResidencyManager *DrmMemoryManager::getLocalMemoryResidencyManager(uint32_t rootDeviceIndex) const {
+    if (rootDeviceIndex >= localMemoryResidencyManagers.size()) {
+        return nullptr;
+    }
+    return localMemoryResidencyManagers[rootDeviceIndex].get();
+}
+
+bool DrmMemoryManager::isMemoryBudgetExhausted() const {
+    for (auto &residencyManager : localMemoryResidencyManagers) {
+        if (residencyManager && residencyManager->isMemoryBudgetExhausted()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DrmMemoryManager::reserveLocalMemory(uint32_t rootDeviceIndex, size_t size) {
+    auto residencyManager = getLocalMemoryResidencyManager(rootDeviceIndex);
+    if (!residencyManager) {
+        return true;
+    }
+    return residencyManager->reserve(size, [this](GraphicsAllocation &allocation) {
+        return isAllocationIdle(allocation) && evictLocalMemoryAllocation(static_cast<DrmAllocation &>(allocation));
+    });
+}
+
+bool DrmMemoryManager::isAllocationIdle(GraphicsAllocation &allocation) {
+    for (auto &engine : getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        if (allocation.isUsedByOsContext(osContextId) &&
+            allocation.getTaskCount(osContextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DrmMemoryManager::printLocalMemoryResidencyStatistics() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintBOCreateDestroyResult.get() && maxLargePageBackedMemorySize > 0, stdout, "Local memory backed by 2MB pages: %llu bytes, peak: %llu bytes\n",
+                       static_cast<unsigned long long>(largePageBackedMemorySize), static_cast<unsigned long long>(maxLargePageBackedMemorySize));
+    for (auto &residencyManager : localMemoryResidencyManagers) {
+        if (!residencyManager) {
+            continue;
+        }
+        auto statistics = residencyManager->getStatistics();
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintBOCreateDestroyResult.get(), stdout, "Local memory evictions: %llu (%llu bytes), refaults: %llu, failed reservations: %llu\n",
+                           static_cast<unsigned long long>(statistics.evictions), static_cast<unsigned long long>(statistics.evictedBytes),
+                           static_cast<unsigned long long>(statistics.refaults), static_cast<unsigned long long>(statistics.failedReservations));
+    }
+}
+
 void DrmMemoryManager::registerAllocationInOs(GraphicsAllocation *allocation) {
     if (allocation && getDrm(allocation->getRootDeviceIndex()).resourceRegistrationEnabled()) {
         auto drmAllocation = static_cast<DrmAllocation *>(allocation);
@@ -9,13 +9,19 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_buffer_object_cache.h"
+#include "shared/source/os_interface/linux/drm_local_memory_residency_manager.h"
+#include "shared/source/os_interface/linux/drm_mapping_cache.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 
 #include "drm_gem_close_worker.h"
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <unordered_map>
 
 namespace NEO {
 class BufferObject;
@@ -37,6 +43,7 @@ class DrmMemoryManager : public MemoryManager {
     GraphicsAllocation *createGraphicsAllocationFromExistingStorage(AllocationProperties &properties, void *ptr, MultiGraphicsAllocation &multiGraphicsAllocation) override;
     GraphicsAllocation *createGraphicsAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool requireSpecificBitness) override;
     void closeSharedHandle(GraphicsAllocation *gfxAllocation) override;
+    uint64_t getSharedHandleIdentity(osHandle handle) override;
     GraphicsAllocation *createPaddedAllocation(GraphicsAllocation *inputGraphicsAllocation, size_t sizeWithPadding) override;
     GraphicsAllocation *createGraphicsAllocationFromNTHandle(void *handle, uint32_t rootDeviceIndex) override { return nullptr; }
 
@@ -60,9 +67,11 @@ class DrmMemoryManager : public MemoryManager {
     int obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex);
     AddressRange reserveGpuAddress(size_t size, uint32_t rootDeviceIndex) override;
     void freeGpuAddress(AddressRange addressRange, uint32_t rootDeviceIndex) override;
+    bool mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuAddress) override;
     MOCKABLE_VIRTUAL BufferObject *createBufferObjectInMemoryRegion(Drm *drm, uint64_t gpuAddress, size_t size, uint32_t memoryBanks, size_t maxOsContextCount);
 
     bool isKmdMigrationAvailable(uint32_t rootDeviceIndex) override;
+    bool isMemoryBudgetExhausted() const override;
 
     std::unique_lock<std::mutex> acquireAllocLock();
     std::vector<GraphicsAllocation *> &getSysMemAllocs();
@@ -71,8 +80,21 @@ class DrmMemoryManager : public MemoryManager {
     void registerLocalMemAlloc(GraphicsAllocation *allocation, uint32_t rootDeviceIndex) override;
     void unregisterAllocation(GraphicsAllocation *allocation);
 
+    DrmBufferObjectCache *getBufferObjectCache() const { return bufferObjectCache.get(); }
+    void releaseBufferObjectCache();
+
+    DrmMappingCache *getMappingCache() const { return mappingCache.get(); }
+    bool releaseMappingCache();
+
+    DrmLocalMemoryResidencyManager *getLocalMemoryResidencyManager(uint32_t rootDeviceIndex) const;
+    void printLocalMemoryResidencyStatistics();
+
+    uint64_t getLargePageBackedMemorySize() const { return largePageBackedMemorySize; }
+    uint64_t getMaxLargePageBackedMemorySize() const { return maxLargePageBackedMemorySize; }
+
   protected:
     BufferObject *findAndReferenceSharedBufferObject(int boHandle);
+    BufferObject *findAndReferenceImportedBufferObject(osHandle handle, ino_t &inode);
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint64_t flags, uint32_t rootDeviceIndex);
@@ -89,7 +111,26 @@ class DrmMemoryManager : public MemoryManager {
     DrmAllocation *createUSMHostAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties);
     DrmAllocation *createAllocWithAlignmentFromUserptr(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSVMSize, uint64_t gpuAddress);
     DrmAllocation *createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress);
+    bool isUserptrUsedForAllocWithAlignment(const AllocationData &allocationData);
+    bool isHugePageBackingPreferred(const AllocationData &allocationData, size_t size) const;
+    bool isLargePageBackingPreferred(const AllocationData &allocationData, size_t size);
+    void registerLargePageBacking(size_t size);
+    void *mmapHugePageMemory(size_t size);
+    int getUsmNumaNode(uint32_t rootDeviceIndex) const;
+    bool bindToNumaNode(void *ptr, size_t size, int numaNode);
+    DrmAllocation *createAllocFromCachedBufferObject(const AllocationData &allocationData, size_t size, const DrmBufferObjectCache::CachedBufferObject &cachedBufferObject);
+    bool storeBufferObjectInCache(DrmAllocation *drmAllocation);
+    void destroyCachedBufferObject(const DrmBufferObjectCache::CachedBufferObject &cachedBufferObject);
+    void *takeCachedMapping(GraphicsAllocation &graphicsAllocation);
+    bool storeMappingInCache(GraphicsAllocation &graphicsAllocation);
+    void removeCachedMappings(DrmAllocation &drmAllocation);
+    void unmapCachedMappings(const std::vector<DrmMappingCache::CachedMapping> &cachedMappings);
+    bool isCpuDomainTransitionRequired(GraphicsAllocation &graphicsAllocation) const;
     void obtainGpuAddress(const AllocationData &allocationData, BufferObject *bo, uint64_t gpuAddress);
+    void createLocalMemoryResidencyManagers();
+    bool reserveLocalMemory(uint32_t rootDeviceIndex, size_t size);
+    bool isAllocationIdle(GraphicsAllocation &allocation);
+    MOCKABLE_VIRTUAL bool evictLocalMemoryAllocation(DrmAllocation &allocation);
     DrmAllocation *allocateUSMHostGraphicsMemory(const AllocationData &allocationData) override;
     DrmAllocation *allocateGraphicsMemoryWithHostPtr(const AllocationData &allocationData) override;
     DrmAllocation *allocateGraphicsMemory64kb(const AllocationData &allocationData) override;
@@ -113,16 +154,31 @@ class DrmMemoryManager : public MemoryManager {
 
     std::vector<BufferObject *> pinBBs;
     std::vector<void *> memoryForPinBBs;
+    std::vector<int> numaNodes;
     size_t pinThreshold = 8 * 1024 * 1024;
     bool forcePinEnabled = false;
     const bool validateHostPtrMemory;
     std::unique_ptr<DrmGemCloseWorker> gemCloseWorker;
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
+    decltype(&madvise) madviseFunction = madvise;
     decltype(&lseek) lseekFunction = lseek;
     decltype(&close) closeFunction = close;
-    std::vector<BufferObject *> sharingBufferObjects;
+    decltype(&fstat) fstatFunction = fstat;
+
+    struct ImportedHandle {
+        ino_t inode;
+        BufferObject *bo;
+    };
+    // shared buffer objects keyed by gem handle, imported fds keyed by fd and validated with dma-buf inode
+    std::unordered_map<int, BufferObject *> sharingBufferObjects;
+    std::unordered_map<int, ImportedHandle> importedHandles;
     std::mutex mtx;
+    std::unique_ptr<DrmBufferObjectCache> bufferObjectCache;
+    std::unique_ptr<DrmMappingCache> mappingCache;
+    std::vector<std::unique_ptr<DrmLocalMemoryResidencyManager>> localMemoryResidencyManagers;
+    std::atomic<uint64_t> largePageBackedMemorySize{0u};
+    std::atomic<uint64_t> maxLargePageBackedMemorySize{0u};
 
     std::vector<std::vector<GraphicsAllocation *>> localMemAllocs;
     std::vector<GraphicsAllocation *> sysMemAllocs;
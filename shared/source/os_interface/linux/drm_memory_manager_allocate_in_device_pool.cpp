@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,10 @@ BufferObject *DrmMemoryManager::createBufferObjectInMemoryRegion(Drm *drm, uint6
     return nullptr;
 }
 
+bool DrmMemoryManager::isUserptrUsedForAllocWithAlignment(const AllocationData &allocationData) {
+    return true;
+}
+
 DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress) {
     return createAllocWithAlignmentFromUserptr(allocationData, size, alignment, alignedSize, gpuAddress);
 }
@@ -45,6 +49,10 @@ bool DrmMemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAlloca
     return MemoryManager::copyMemoryToAllocation(graphicsAllocation, destinationOffset, memoryToCopy, sizeToCopy);
 }
 
+bool DrmMemoryManager::evictLocalMemoryAllocation(DrmAllocation &allocation) {
+    return false;
+}
+
 uint64_t DrmMemoryManager::getLocalMemorySize(uint32_t rootDeviceIndex, uint32_t deviceBitfield) {
     return 0 * GB;
 }
@@ -68,14 +68,18 @@ GraphicsAllocation *DrmMemoryManager::createSharedUnifiedMemoryAllocation(const
     return nullptr;
 }
 
-DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress) {
+bool DrmMemoryManager::isUserptrUsedForAllocWithAlignment(const AllocationData &allocationData) {
     bool useBooMmap = this->getDrm(allocationData.rootDeviceIndex).getMemoryInfo() && allocationData.useMmapObject;
 
     if (DebugManager.flags.EnableBOMmapCreate.get() != -1) {
         useBooMmap = DebugManager.flags.EnableBOMmapCreate.get();
     }
 
-    if (useBooMmap) {
+    return !useBooMmap;
+}
+
+DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress) {
+    if (!isUserptrUsedForAllocWithAlignment(allocationData)) {
         auto totalSizeToAlloc = alignedSize + alignment;
         auto cpuPointer = this->mmapFunction(0, totalSizeToAlloc, PROT_NONE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
 
@@ -169,7 +173,7 @@ bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation,
         if (storageInfo.getNumBanks() > 1) {
             memoryBanks &= 1u << handleId;
         }
-        auto boSize = alignUp(allocation->getGmm(handleId)->gmmResourceInfo->getSizeAllocation(), MemoryConstants::pageSize64k);
+        auto boSize = alignUp(allocation->getGmm(handleId)->gmmResourceInfo->getSizeAllocation(), allocation->getLargePageBackingSize() ? MemoryConstants::pageSize2Mb : MemoryConstants::pageSize64k);
         bos[handleId] = std::unique_ptr<BufferObject>(createBufferObjectInMemoryRegion(drm, boAddress, boSize, memoryBanks, maxOsContextCount));
         if (nullptr == bos[handleId]) {
             return false;
@@ -196,6 +200,7 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
 
     std::unique_ptr<Gmm> gmm;
     size_t sizeAligned = 0;
+    bool largePageBacking = false;
     auto numHandles = allocationData.storageInfo.getNumBanks();
     DEBUG_BREAK_IF(numHandles > 1);
     if (allocationData.type == GraphicsAllocation::AllocationType::IMAGE) {
@@ -205,6 +210,10 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
     } else {
         if (allocationData.type == GraphicsAllocation::AllocationType::WRITE_COMBINED) {
             sizeAligned = alignUp(allocationData.size + MemoryConstants::pageSize64k, 2 * MemoryConstants::megaByte) + 2 * MemoryConstants::megaByte;
+        } else if (isLargePageBackingPreferred(allocationData, allocationData.size)) {
+            // 2MB multiple size with 2MB aligned VA from HEAP_STANDARD2MB lets KMD map buffer with 2MB GPU pages
+            sizeAligned = alignUp(allocationData.size, MemoryConstants::pageSize2Mb);
+            largePageBacking = true;
         } else {
             sizeAligned = alignUp(allocationData.size, MemoryConstants::pageSize64k);
         }
@@ -230,7 +239,11 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
     allocation->storageInfo = allocationData.storageInfo;
     allocation->setFlushL3Required(allocationData.flags.flushL3);
     allocation->setReservedAddressRange(reinterpret_cast<void *>(gpuAddress), sizeAllocated);
+    if (largePageBacking) {
+        allocation->setLargePageBackingSize(sizeAligned);
+    }
 
+    reserveLocalMemory(allocationData.rootDeviceIndex, sizeAligned);
     if (!createDrmAllocation(&getDrm(allocationData.rootDeviceIndex), allocation.get(), gpuAddress, maxOsContextCount)) {
         for (auto handleId = 0u; handleId < allocationData.storageInfo.getNumBanks(); handleId++) {
             delete allocation->getGmm(handleId);
@@ -239,6 +252,9 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
         status = AllocationStatus::Error;
         return nullptr;
     }
+    if (largePageBacking) {
+        registerLargePageBacking(sizeAligned);
+    }
     if (allocationData.type == GraphicsAllocation::AllocationType::WRITE_COMBINED) {
         auto cpuAddress = lockResource(allocation.get());
         auto alignedCpuAddress = alignDown(cpuAddress, 2 * MemoryConstants::megaByte);
@@ -287,6 +303,10 @@ void *DrmMemoryManager::lockResourceInLocalMemoryImpl(BufferObject *bo) {
     }
 
     auto addr = mmapFunction(nullptr, bo->peekSize(), PROT_WRITE | PROT_READ, MAP_SHARED, getDrm(rootDeviceIndex).getFileDescriptor(), static_cast<off_t>(mmapOffset.offset));
+    if (addr == MAP_FAILED && releaseMappingCache()) {
+        // out of address space, retry once with cached mappings unmapped
+        addr = mmapFunction(nullptr, bo->peekSize(), PROT_WRITE | PROT_READ, MAP_SHARED, getDrm(rootDeviceIndex).getFileDescriptor(), static_cast<off_t>(mmapOffset.offset));
+    }
     DEBUG_BREAK_IF(addr == MAP_FAILED);
 
     bo->setLockedAddress(addr);
@@ -309,6 +329,17 @@ bool DrmMemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAlloca
     if (graphicsAllocation->getUnderlyingBuffer()) {
         return MemoryManager::copyMemoryToAllocation(graphicsAllocation, destinationOffset, memoryToCopy, sizeToCopy);
     }
+    if (mappingCache && graphicsAllocation->storageInfo.getNumBanks() == 1u && !graphicsAllocation->isLocked()) {
+        // single bank allocation goes through lock, so its mapping stays cached for next copy
+        auto ptr = lockResource(graphicsAllocation);
+        if (!ptr) {
+            return false;
+        }
+        memcpy_s(ptrOffset(ptr, destinationOffset), graphicsAllocation->getUnderlyingBufferSize() - destinationOffset, memoryToCopy, sizeToCopy);
+        unlockResource(graphicsAllocation);
+        return true;
+    }
+
     auto drmAllocation = static_cast<DrmAllocation *>(graphicsAllocation);
     for (auto handleId = 0u; handleId < graphicsAllocation->storageInfo.getNumBanks(); handleId++) {
         auto ptr = lockResourceInLocalMemoryImpl(drmAllocation->getBOs()[handleId]);
@@ -321,6 +352,50 @@ bool DrmMemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAlloca
     return true;
 }
 
+bool DrmMemoryManager::evictLocalMemoryAllocation(DrmAllocation &allocation) {
+    // backing storage can be replaced only when no CPU mapping and no other owner refers to the buffer object
+    if (allocation.storageInfo.getNumBanks() > 1 ||
+        allocation.isLocked() ||
+        allocation.getUnderlyingBuffer() != nullptr ||
+        allocation.getAllocationType() == GraphicsAllocation::AllocationType::WRITE_COMBINED) {
+        return false;
+    }
+    auto localBo = allocation.getBO();
+    auto &drm = getDrm(allocation.getRootDeviceIndex());
+    if (localBo == nullptr || localBo->peekIsReusableAllocation() || localBo->getRefCount() > 1 || drm.isVmBindAvailable()) {
+        return false;
+    }
+
+    // system memory buffer object is soft-pinned at the same GPU VA, so already programmed addresses stay valid
+    std::unique_ptr<BufferObject, BufferObject::Deleter> systemBo(createBufferObjectInMemoryRegion(&drm, localBo->peekAddress(), localBo->peekSize(), 0u, maxOsContextCount));
+    if (!systemBo) {
+        return false;
+    }
+
+    auto srcPtr = lockResourceInLocalMemoryImpl(localBo);
+    auto dstPtr = lockResourceInLocalMemoryImpl(systemBo.get());
+    if (srcPtr && dstPtr) {
+        memcpy_s(dstPtr, systemBo->peekSize(), srcPtr, localBo->peekSize());
+    }
+    if (srcPtr) {
+        unlockResourceInLocalMemoryImpl(localBo);
+    }
+    if (dstPtr) {
+        unlockResourceInLocalMemoryImpl(systemBo.get());
+    }
+    if (!srcPtr || !dstPtr) {
+        return false;
+    }
+
+    allocation.getBufferObjectToModify(0u) = systemBo.release();
+    unreference(localBo, false);
+    if (allocation.getLargePageBackingSize()) {
+        largePageBackedMemorySize -= allocation.getLargePageBackingSize();
+        allocation.setLargePageBackingSize(0u);
+    }
+    return true;
+}
+
 uint64_t DrmMemoryManager::getLocalMemorySize(uint32_t rootDeviceIndex, uint32_t deviceBitfield) {
     auto memoryInfo = static_cast<MemoryInfoImpl *>(getDrm(rootDeviceIndex).getMemoryInfo());
     if (!memoryInfo) {
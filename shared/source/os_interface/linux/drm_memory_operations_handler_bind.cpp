@@ -33,22 +33,58 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResident(Device *devi
     return MemoryOperationsStatus::SUCCESS;
 }
 
+bool DrmMemoryOperationsHandlerBind::isBoundInVm(const GraphicsAllocation &gfxAllocation, DeviceBitfield contextBitfield, uint32_t vmHandleId) {
+    if (DebugManager.flags.EnableTileLocalResidency.get() != 1) {
+        return true;
+    }
+    auto subDevicesBitfield = gfxAllocation.getSubDevicesBitfield();
+    if (subDevicesBitfield.none() || (subDevicesBitfield & contextBitfield).none()) {
+        return true;
+    }
+    return subDevicesBitfield.test(vmHandleId);
+}
+
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
-        auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
-        for (auto drmIterator = 0u; drmIterator < osContext->getDeviceBitfield().size(); drmIterator++) {
-            if (osContext->getDeviceBitfield().test(drmIterator)) {
-                drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
-            }
+    std::lock_guard<std::mutex> lock(getOsContextMutex(osContext->getContextId()));
+    std::vector<BufferObject *> bufferObjects;
+    bufferObjects.reserve(gfxAllocations.size());
+    for (auto drmIterator = 0u; drmIterator < osContext->getDeviceBitfield().size(); drmIterator++) {
+        if (osContext->getDeviceBitfield().test(drmIterator)) {
+            bindBufferObjectsBatched(osContext, gfxAllocations, drmIterator, bufferObjects);
         }
-        if (!evictable) {
-            drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
+    }
+    if (!evictable) {
+        for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
+            (*gfxAllocation)->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
         }
     }
     return MemoryOperationsStatus::SUCCESS;
 }
 
+void DrmMemoryOperationsHandlerBind::bindBufferObjectsBatched(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, uint32_t vmHandleId, std::vector<BufferObject *> &bufferObjects) {
+    bufferObjects.clear();
+    for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
+        if (!isBoundInVm(**gfxAllocation, osContext->getDeviceBitfield(), vmHandleId)) {
+            continue;
+        }
+        auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
+        drmAllocation->makeBOsResident(osContext, vmHandleId, &bufferObjects, true);
+    }
+    for (auto bo : bufferObjects) {
+        auto retVal = bo->bind(osContext, vmHandleId);
+        UNRECOVERABLE_IF(retVal);
+    }
+}
+
+std::mutex &DrmMemoryOperationsHandlerBind::getOsContextMutex(uint32_t contextId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &osContextMutex = osContextMutexes[contextId];
+    if (!osContextMutex) {
+        osContextMutex = std::make_unique<std::mutex>();
+    }
+    return *osContextMutex;
+}
+
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evict(Device *device, GraphicsAllocation &gfxAllocation) {
     auto &engines = device->getEngines();
     auto retVal = MemoryOperationsStatus::SUCCESS;
@@ -62,7 +98,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evict(Device *device, Gra
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictWithinOsContext(OsContext *osContext, GraphicsAllocation &gfxAllocation) {
-    std::lock_guard<std::mutex> lock(mutex);
+    std::lock_guard<std::mutex> lock(getOsContextMutex(osContext->getContextId()));
     evictImpl(osContext, gfxAllocation, osContext->getDeviceBitfield());
     return MemoryOperationsStatus::SUCCESS;
 }
@@ -70,7 +106,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictWithinOsContext(OsCo
 void DrmMemoryOperationsHandlerBind::evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield) {
     auto drmAllocation = static_cast<DrmAllocation *>(&gfxAllocation);
     for (auto drmIterator = 0u; drmIterator < deviceBitfield.size(); drmIterator++) {
-        if (deviceBitfield.test(drmIterator)) {
+        if (deviceBitfield.test(drmIterator) && isBoundInVm(gfxAllocation, osContext->getDeviceBitfield(), drmIterator)) {
             drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, false);
         }
     }
@@ -113,6 +149,10 @@ void DrmMemoryOperationsHandlerBind::evictUnusedAllocations() {
     auto memoryManager = static_cast<DrmMemoryManager *>(this->rootDeviceEnvironment.executionEnvironment.memoryManager.get());
 
     std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::unique_lock<std::mutex>> osContextLocks;
+    for (auto &osContextMutex : osContextMutexes) {
+        osContextLocks.emplace_back(*osContextMutex.second);
+    }
     auto allocLock = memoryManager->acquireAllocLock();
 
     this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs());
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,11 @@
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
+#include <map>
+#include <vector>
+
 namespace NEO {
+class BufferObject;
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   public:
@@ -27,11 +31,21 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
 
     MOCKABLE_VIRTUAL void evictUnusedAllocations();
 
+    // with tile local residency, allocation of sub-devices is bound only in VMs of its tiles used by the context;
+    // allocation of other tiles only, e.g. read by peer tile, is bound in all VMs of the context
+    static bool isBoundInVm(const GraphicsAllocation &gfxAllocation, DeviceBitfield contextBitfield, uint32_t vmHandleId);
+
   protected:
+    void bindBufferObjectsBatched(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, uint32_t vmHandleId, std::vector<BufferObject *> &bufferObjects);
+    std::mutex &getOsContextMutex(uint32_t contextId);
     void evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
     void evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction);
 
     RootDeviceEnvironment &rootDeviceEnvironment;
     uint32_t rootDeviceIndex = 0;
+
+    // residency state is tracked per OsContext, so each context serializes only its own binds;
+    // the handler mutex guards this map and is held across contexts by eviction
+    std::map<uint32_t, std::unique_ptr<std::mutex>> osContextMutexes;
 };
 } // namespace NEO
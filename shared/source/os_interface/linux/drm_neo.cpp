@@ -28,6 +28,7 @@
 
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <linux/limits.h>
 
 namespace NEO {
@@ -135,6 +136,10 @@ int Drm::getExecSoftPin(int &execSoftPin) {
     return getParamIoctl(I915_PARAM_HAS_EXEC_SOFTPIN, &execSoftPin);
 }
 
+int Drm::getExecFenceArray(int &execFenceArray) {
+    return getParamIoctl(I915_PARAM_HAS_EXEC_FENCE_ARRAY, &execFenceArray);
+}
+
 int Drm::enableTurboBoost() {
     drm_i915_gem_context_param contextParam = {};
 
@@ -159,6 +164,22 @@ std::string Drm::getSysFsPciPath() {
     return {};
 }
 
+int Drm::getNumaNode() {
+    std::string numaNodeFile = std::string(Os::sysFsPciPathPrefix) + hwDeviceId->getPciPath() + "/numa_node";
+
+    std::ifstream ifs(numaNodeFile.c_str(), std::ifstream::in);
+    if (ifs.fail()) {
+        return -1;
+    }
+
+    int numaNode = -1;
+    ifs >> numaNode;
+    if (ifs.fail()) {
+        return -1;
+    }
+    return numaNode;
+}
+
 int Drm::queryGttSize(uint64_t &gttSizeOutput) {
     drm_i915_gem_context_param contextParam = {0};
     contextParam.param = I915_CONTEXT_PARAM_GTT_SIZE;
@@ -191,6 +212,15 @@ void Drm::setLowPriorityContextParam(uint32_t drmContextId) {
     UNRECOVERABLE_IF(retVal != 0);
 }
 
+bool Drm::setHighPriorityContextParam(uint32_t drmContextId) {
+    drm_i915_gem_context_param gcp = {};
+    gcp.ctx_id = drmContextId;
+    gcp.param = I915_CONTEXT_PARAM_PRIORITY;
+    gcp.value = I915_CONTEXT_MAX_USER_PRIORITY;
+
+    return ioctl(DRM_IOCTL_I915_GEM_CONTEXT_SETPARAM, &gcp) == 0;
+}
+
 int Drm::getQueueSliceCount(drm_i915_gem_context_param_sseu *sseu) {
     drm_i915_gem_context_param contextParam = {};
     contextParam.param = I915_CONTEXT_PARAM_SSEU;
@@ -269,6 +299,39 @@ void Drm::destroyDrmContext(uint32_t drmContextId) {
     UNRECOVERABLE_IF(retVal != 0);
 }
 
+int Drm::createSyncObject(uint32_t &syncObjectHandle, bool signaled) {
+    drm_syncobj_create create = {};
+    create.flags = signaled ? DRM_SYNCOBJ_CREATE_SIGNALED : 0u;
+    auto retVal = ioctl(DRM_IOCTL_SYNCOBJ_CREATE, &create);
+    syncObjectHandle = create.handle;
+    return retVal;
+}
+
+void Drm::destroySyncObject(uint32_t syncObjectHandle) {
+    drm_syncobj_destroy destroy = {};
+    destroy.handle = syncObjectHandle;
+    auto retVal = ioctl(DRM_IOCTL_SYNCOBJ_DESTROY, &destroy);
+    DEBUG_BREAK_IF(retVal != 0);
+}
+
+int Drm::exportSyncObjectToSyncFile(uint32_t syncObjectHandle, int32_t &syncFileFd) {
+    drm_syncobj_handle args = {};
+    args.handle = syncObjectHandle;
+    args.flags = DRM_SYNCOBJ_HANDLE_TO_FD_FLAGS_EXPORT_SYNC_FILE;
+    args.fd = -1;
+    auto retVal = ioctl(DRM_IOCTL_SYNCOBJ_HANDLE_TO_FD, &args);
+    syncFileFd = args.fd;
+    return retVal;
+}
+
+int Drm::importSyncFileToSyncObject(uint32_t syncObjectHandle, int32_t syncFileFd) {
+    drm_syncobj_handle args = {};
+    args.handle = syncObjectHandle;
+    args.flags = DRM_SYNCOBJ_FD_TO_HANDLE_FLAGS_IMPORT_SYNC_FILE;
+    args.fd = syncFileFd;
+    return ioctl(DRM_IOCTL_SYNCOBJ_FD_TO_HANDLE, &args);
+}
+
 void Drm::destroyDrmVirtualMemory(uint32_t drmVmId) {
     drm_i915_gem_vm_control ctl = {};
     ctl.vm_id = drmVmId;
@@ -455,7 +518,47 @@ bool Drm::isi915Version(int fileDescriptor) {
     return strcmp(name, "i915") == 0;
 }
 
+std::string Drm::getDriverVersion() {
+    drm_version_t version = {};
+    char date[32] = {};
+    version.date = date;
+    version.date_len = sizeof(date) - 1;
+
+    if (this->ioctl(DRM_IOCTL_VERSION, &version) != 0) {
+        return {};
+    }
+    return std::to_string(version.version_major) + "." + std::to_string(version.version_minor) + "." +
+           std::to_string(version.version_patchlevel) + " " + date;
+}
+
+DrmQueryCache *Drm::getQueryCache() {
+    if (queryCacheChecked) {
+        return queryCache.get();
+    }
+    queryCacheChecked = true;
+
+    if (!DrmQueryCache::isEnabled()) {
+        return nullptr;
+    }
+    auto directory = DrmQueryCache::getCacheDirectory();
+    auto systemKey = DrmQueryCache::getSystemKey();
+    auto driverVersion = getDriverVersion();
+    if (directory.empty() || systemKey.empty() || driverVersion.empty()) {
+        return nullptr;
+    }
+    queryCache = std::make_unique<DrmQueryCache>(directory, std::string(hwDeviceId->getPciPath()) + "|" + driverVersion + "|" + systemKey);
+    return queryCache.get();
+}
+
 std::unique_ptr<uint8_t[]> Drm::query(uint32_t queryId, uint32_t queryItemFlags, int32_t &length) {
+    auto cache = DrmQueryCache::isQueryCacheable(queryId) ? getQueryCache() : nullptr;
+    if (cache) {
+        auto cachedData = cache->load(queryId, queryItemFlags, length);
+        if (cachedData) {
+            return cachedData;
+        }
+    }
+
     drm_i915_query query{};
     drm_i915_query_item queryItem{};
     queryItem.query_id = queryId;
@@ -480,6 +583,9 @@ std::unique_ptr<uint8_t[]> Drm::query(uint32_t queryId, uint32_t queryItemFlags,
     }
 
     length = queryItem.length;
+    if (cache) {
+        cache->store(queryId, queryItemFlags, data.get(), length);
+    }
     return data;
 }
 
@@ -9,6 +9,7 @@
 #include "shared/source/gmm_helper/gmm_lib.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/os_interface/linux/cache_info.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
 #include "shared/source/os_interface/linux/memory_info.h"
@@ -83,6 +84,7 @@ class Drm {
     int getDeviceID(int &devId);
     int getDeviceRevID(int &revId);
     int getExecSoftPin(int &execSoftPin);
+    int getExecFenceArray(int &execFenceArray);
     int enableTurboBoost();
     int getEuTotal(int &euTotal);
     int getSubsliceTotal(int &subsliceTotal);
@@ -102,8 +104,13 @@ class Drm {
     uint32_t createDrmContext(uint32_t drmVmId, bool isDirectSubmission);
     void appendDrmContextFlags(drm_i915_gem_context_create_ext &gcc, bool isDirectSubmission);
     void destroyDrmContext(uint32_t drmContextId);
+    int createSyncObject(uint32_t &syncObjectHandle, bool signaled);
+    void destroySyncObject(uint32_t syncObjectHandle);
+    int exportSyncObjectToSyncFile(uint32_t syncObjectHandle, int32_t &syncFileFd);
+    int importSyncFileToSyncObject(uint32_t syncObjectHandle, int32_t syncFileFd);
     int queryVmId(uint32_t drmContextId, uint32_t &vmId);
     void setLowPriorityContextParam(uint32_t drmContextId);
+    bool setHighPriorityContextParam(uint32_t drmContextId);
 
     unsigned int bindDrmContext(uint32_t drmContextId, uint32_t deviceIndex, aub_stream::EngineType engineType);
 
@@ -125,6 +132,9 @@ class Drm {
     int setupHardwareInfo(DeviceDescriptor *, bool);
     void setupSystemInfo(HardwareInfo *hwInfo, SystemInfo &sysInfo);
     void setupCacheInfo(const HardwareInfo &hwInfo);
+    MOCKABLE_VIRTUAL CacheRegion closAlloc();
+    MOCKABLE_VIRTUAL uint16_t closAllocWays(CacheRegion closIndex, uint16_t cacheLevel, uint16_t numWays);
+    MOCKABLE_VIRTUAL CacheRegion closFree(CacheRegion closIndex);
 
     bool areNonPersistentContextsSupported() const { return nonPersistentContextsSupported; }
     void checkNonPersistentContextsSupport();
@@ -182,6 +192,7 @@ class Drm {
     std::string getPciPath() {
         return hwDeviceId->getPciPath();
     }
+    int getNumaNode();
 
     void waitForBind(uint32_t vmHandleId);
     uint64_t getNextFenceVal(uint32_t vmHandleId) { return ++fenceVal[vmHandleId]; }
@@ -224,6 +235,10 @@ class Drm {
 
     std::string getSysFsPciPath();
     std::unique_ptr<uint8_t[]> query(uint32_t queryId, uint32_t queryItemFlags, int32_t &length);
+    std::string getDriverVersion();
+    DrmQueryCache *getQueryCache();
+    std::unique_ptr<DrmQueryCache> queryCache;
+    bool queryCacheChecked = false;
 
     StackVec<uint32_t, size_t(ResourceClass::MaxSize)> classHandles;
 
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include "drm/i915_drm.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+namespace {
+std::string readFirstLine(const char *path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+} // namespace
+
+bool DrmQueryCache::isEnabled() {
+    return DebugManager.flags.EnableDrmQueryCache.get() == 1;
+}
+
+std::string DrmQueryCache::getCacheDirectory() {
+    if (DebugManager.flags.DrmQueryCacheDir.get() != "unk") {
+        return DebugManager.flags.DrmQueryCacheDir.get();
+    }
+    // runtime directory is tmpfs cleared on reboot, so stale entries do not accumulate
+    auto runtimeDir = IoFunctions::getenvPtr("XDG_RUNTIME_DIR");
+    if (runtimeDir == nullptr || runtimeDir[0] == '\0') {
+        return {};
+    }
+    return std::string(runtimeDir) + "/neo_drm_query_cache";
+}
+
+std::string DrmQueryCache::getSystemKey() {
+    auto bootId = readFirstLine("/proc/sys/kernel/random/boot_id");
+    if (bootId.empty()) {
+        return {};
+    }
+    return bootId + "|" + readFirstLine("/proc/sys/kernel/osrelease") + "|" + readFirstLine("/proc/sys/kernel/version");
+}
+
+bool DrmQueryCache::isQueryCacheable(uint32_t queryId) {
+    // only queries describing hardware configuration, which cannot change without reboot
+    switch (queryId) {
+    case DRM_I915_QUERY_TOPOLOGY_INFO:
+    case DRM_I915_QUERY_ENGINE_INFO:
+        return true;
+    default:
+        return false;
+    }
+}
+
+DrmQueryCache::DrmQueryCache(const std::string &directory, const std::string &key) : directory(directory), key(key) {
+    std::stringstream stream;
+    stream << std::setfill('0') << std::setw(sizeof(uint64_t) * 2) << std::hex << Hash::hash(key.c_str(), key.size());
+    keyHash = stream.str();
+    if (::mkdir(directory.c_str(), 0777) != 0 && errno != EEXIST) {
+        this->directory.clear();
+    }
+}
+
+std::string DrmQueryCache::getEntryPath(uint32_t queryId, uint32_t queryItemFlags) const {
+    return directory + "/" + keyHash + "_" + std::to_string(queryId) + "_" + std::to_string(queryItemFlags) + ".bin";
+}
+
+std::unique_ptr<uint8_t[]> DrmQueryCache::load(uint32_t queryId, uint32_t queryItemFlags, int32_t &length) const {
+    length = 0;
+    if (directory.empty()) {
+        return nullptr;
+    }
+
+    size_t fileSize = 0u;
+    auto file = loadDataFromFile(getEntryPath(queryId, queryItemFlags).c_str(), fileSize);
+    if (!file || fileSize < sizeof(EntryHeader)) {
+        return nullptr;
+    }
+
+    // full key is stored in entry, so hash collisions and foreign entries are rejected
+    EntryHeader header = {};
+    memcpy(&header, file.get(), sizeof(EntryHeader));
+    if (header.magic != entryMagic || header.keySize != key.size() || header.dataSize <= 0 ||
+        fileSize != sizeof(EntryHeader) + header.keySize + static_cast<size_t>(header.dataSize) ||
+        memcmp(file.get() + sizeof(EntryHeader), key.c_str(), key.size()) != 0) {
+        return nullptr;
+    }
+
+    auto data = std::make_unique<uint8_t[]>(header.dataSize);
+    memcpy(data.get(), file.get() + sizeof(EntryHeader) + header.keySize, header.dataSize);
+    length = header.dataSize;
+    return data;
+}
+
+bool DrmQueryCache::store(uint32_t queryId, uint32_t queryItemFlags, const uint8_t *data, int32_t length) {
+    if (directory.empty() || data == nullptr || length <= 0) {
+        return false;
+    }
+
+    EntryHeader header = {entryMagic, static_cast<uint32_t>(key.size()), length};
+    std::string entry(sizeof(EntryHeader) + key.size() + length, '\0');
+    memcpy(&entry[0], &header, sizeof(EntryHeader));
+    memcpy(&entry[sizeof(EntryHeader)], key.c_str(), key.size());
+    memcpy(&entry[sizeof(EntryHeader) + key.size()], data, length);
+
+    // readers never see partially written entry, it appears only after rename
+    auto entryPath = getEntryPath(queryId, queryItemFlags);
+    auto tempPath = entryPath + "." + std::to_string(::getpid()) + "_" + std::to_string(tempFilesCount++) + ".tmp";
+    bool stored = entry.size() == writeDataToFile(tempPath.c_str(), entry.c_str(), entry.size()) &&
+                  ::rename(tempPath.c_str(), entryPath.c_str()) == 0;
+    if (!stored) {
+        std::remove(tempPath.c_str());
+    }
+    return stored;
+}
+} // namespace NEO
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+// Raw DRM query results shared by processes started within the same boot.
+// Entries are keyed by device PCI path, i915 driver version and running kernel build,
+// boot id is part of the key, so entries left after reboot are never matched.
+class DrmQueryCache {
+  public:
+    static constexpr uint32_t entryMagic = 0x4e515143; // "CQQN"
+
+    static bool isEnabled();
+    static std::string getCacheDirectory();
+    static std::string getSystemKey();
+    static bool isQueryCacheable(uint32_t queryId);
+
+    DrmQueryCache(const std::string &directory, const std::string &key);
+
+    std::unique_ptr<uint8_t[]> load(uint32_t queryId, uint32_t queryItemFlags, int32_t &length) const;
+    bool store(uint32_t queryId, uint32_t queryItemFlags, const uint8_t *data, int32_t length);
+
+    const std::string &getKey() const { return key; }
+
+  protected:
+    struct EntryHeader {
+        uint32_t magic;
+        uint32_t keySize;
+        int32_t dataSize;
+    };
+
+    std::string getEntryPath(uint32_t queryId, uint32_t queryItemFlags) const;
+
+    std::string directory;
+    std::string key;
+    std::string keyHash;
+    uint32_t tempFilesCount = 0u;
+};
+} // namespace NEO
@@ -5,7 +5,6 @@
  *
  */
 
-#include "shared/source/os_interface/linux/cache_info_impl.h"
 #include "shared/source/os_interface/linux/drm_engine_mapper.h"
 #include "shared/source/os_interface/linux/engine_info_impl.h"
 #include "shared/source/os_interface/linux/memory_info_impl.h"
@@ -83,10 +82,6 @@ bool Drm::isVmBindAvailable() {
 void Drm::appendDrmContextFlags(drm_i915_gem_context_create_ext &gcc, bool isDirectSubmission) {
 }
 
-void Drm::setupCacheInfo(const HardwareInfo &hwInfo) {
-    this->cacheInfo.reset(new CacheInfoImpl());
-}
-
 int Drm::createDrmVirtualMemory(uint32_t &drmVmId) {
     drm_i915_gem_vm_control ctl = {};
     auto ret = SysCalls::ioctl(getFileDescriptor(), DRM_IOCTL_I915_GEM_VM_CREATE, &ctl);
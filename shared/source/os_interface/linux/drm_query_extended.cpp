@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/os_interface/linux/cache_info_impl.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 
 #include "drm_query_flags.h"
@@ -30,4 +33,33 @@ bool Drm::isDebugAttachAvailable() {
     return false;
 }
 
+void Drm::setupCacheInfo(const HardwareInfo &hwInfo) {
+    auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+    auto numCacheRegions = hwHelper.getNumCacheRegions(hwInfo);
+    if (numCacheRegions <= 1) {
+        this->cacheInfo.reset(new CacheInfoImpl(*this, 0, 0, 0));
+        return;
+    }
+
+    // single client may reserve at most a quarter of L3 ways, default region keeps the rest
+    constexpr uint16_t maxNumWays = 32;
+    constexpr uint16_t maxReservationNumWays = 8;
+    const size_t totalCacheSize = hwInfo.gtSystemInfo.L3CacheSizeInKb * MemoryConstants::kiloByte;
+    const size_t maxReservationCacheSize = (totalCacheSize * maxReservationNumWays) / maxNumWays;
+    this->cacheInfo.reset(new CacheInfoImpl(*this, maxReservationCacheSize, numCacheRegions - 1, maxReservationNumWays));
+}
+
+CacheRegion Drm::closAlloc() {
+    // CLOS reservation is not part of upstream i915 uAPI
+    return CacheRegion::None;
+}
+
+uint16_t Drm::closAllocWays(CacheRegion closIndex, uint16_t cacheLevel, uint16_t numWays) {
+    return 0;
+}
+
+CacheRegion Drm::closFree(CacheRegion closIndex) {
+    return CacheRegion::None;
+}
+
 } // namespace NEO
@@ -36,7 +36,7 @@ void OsContextLinux::initializeContext() {
     auto hwInfo = drm.getRootDeviceEnvironment().getHardwareInfo();
     auto defaultEngineType = getChosenEngineType(*hwInfo);
 
-    if (engineType == defaultEngineType && !isLowPriority() && !isInternalEngine()) {
+    if (engineType == defaultEngineType && !isLowPriority() && !isHighPriority() && !isInternalEngine()) {
         this->setDefaultContext(true);
     }
 
@@ -64,6 +64,14 @@ void OsContextLinux::initializeContext() {
             if ((drm.isPreemptionSupported() && isLowPriority()) ||
                 lowPriorityDirectSubmissionBcs) {
                 drm.setLowPriorityContextParam(drmContextId);
+            } else if (isLowPriority()) {
+                this->priorityHonored = false;
+            }
+
+            if (isHighPriority()) {
+                // raising priority above default needs CAP_SYS_NICE, context stays at default priority otherwise
+                auto highPriorityApplied = drm.isPreemptionSupported() && drm.setHighPriorityContextParam(drmContextId);
+                this->priorityHonored = this->priorityHonored && highPriorityApplied;
             }
 
             this->engineFlag = drm.bindDrmContext(drmContextId, deviceIndex, engineType);
@@ -24,4 +24,15 @@ void ThreadLinux::yield() {
     pthread_yield();
 }
 
+bool ThreadLinux::setAffinityMask(uint64_t cpuMask) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint32_t cpu = 0; cpu < 64; cpu++) {
+        if (cpuMask & (1ull << cpu)) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    return pthread_setaffinity_np(threadId, sizeof(cpuSet), &cpuSet) == 0;
+}
+
 } // namespace NEO
@@ -15,6 +15,7 @@ class ThreadLinux : public Thread {
     ThreadLinux(pthread_t threadId);
     void join() override;
     void yield() override;
+    bool setAffinityMask(uint64_t cpuMask) override;
     ~ThreadLinux() override = default;
 
   protected:
@@ -21,5 +21,6 @@ int access(const char *pathname, int mode);
 int readlink(const char *path, char *buf, size_t bufsize);
 int poll(struct pollfd *pollFd, unsigned long int numberOfFds, int timeout);
 int fstat(int fd, struct stat *buf);
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned flags);
 } // namespace SysCalls
 } // namespace NEO
@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/sysmacros.h>
 #include <unistd.h>
 
@@ -60,5 +61,9 @@ int poll(struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) {
 int fstat(int fd, struct stat *buf) {
     return ::fstat(fd, buf);
 }
+
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned flags) {
+    return ::syscall(SYS_mbind, addr, len, mode, nodemask, maxnode, flags);
+}
 } // namespace SysCalls
 } // namespace NEO
@@ -39,10 +39,13 @@ class OsContext : public ReferenceTrackedObject<OsContext> {
     aub_stream::EngineType &getEngineType() { return engineType; }
     bool isRegular() const { return engineUsage == EngineUsage::Regular; }
     bool isLowPriority() const { return engineUsage == EngineUsage::LowPriority; }
+    bool isHighPriority() const { return engineUsage == EngineUsage::HighPriority; }
     bool isInternalEngine() const { return engineUsage == EngineUsage::Internal; }
     bool isRootDevice() const { return rootDevice; }
     virtual bool isDirectSubmissionSupported(const HardwareInfo &hwInfo) const { return false; }
     bool isDefaultContext() const { return defaultContext; }
+    // false when KMD did not apply scheduling priority requested by engine usage, valid after context is initialized
+    bool isPriorityHonored() const { return priorityHonored; }
     void setDefaultContext(bool value) { defaultContext = value; }
     bool isDirectSubmissionActive() { return directSubmissionActive; }
     void setDirectSubmissionActive() { directSubmissionActive = true; }
@@ -66,6 +69,7 @@ class OsContext : public ReferenceTrackedObject<OsContext> {
     const bool rootDevice = false;
     bool defaultContext = false;
     bool directSubmissionActive = false;
+    bool priorityHonored = true;
     std::once_flag contextInitializedFlag = {};
     bool contextInitialized = false;
 };
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
 namespace NEO {
 
@@ -15,5 +16,6 @@ class Thread {
     virtual void join() = 0;
     virtual ~Thread() = default;
     virtual void yield() = 0;
+    virtual bool setAffinityMask(uint64_t cpuMask) = 0;
 };
 } // namespace NEO
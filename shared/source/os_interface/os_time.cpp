@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/os_time.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/hw_info.h"
 
 namespace NEO {
@@ -14,4 +15,31 @@ namespace NEO {
 double OSTime::getDeviceTimerResolution(HardwareInfo const &hwInfo) {
     return hwInfo.capabilityTable.defaultProfilingTimerResolution;
 };
+
+bool OSTime::getCpuGpuTimeFromCorrelation(TimeStampData *pGpuCpuTime, double deviceTimerResolution) {
+    auto refreshPeriodInNs = defaultCorrelationRefreshPeriodInMs * 1000000u;
+    if (DebugManager.flags.CpuGpuTimeCorrelationRefreshPeriodMs.get() != -1) {
+        refreshPeriodInNs = static_cast<uint64_t>(DebugManager.flags.CpuGpuTimeCorrelationRefreshPeriodMs.get()) * 1000000u;
+    }
+    uint64_t cpuTime = 0;
+    if (refreshPeriodInNs == 0 || deviceTimerResolution <= 0.0 || !getCpuTime(&cpuTime)) {
+        return getCpuGpuTime(pGpuCpuTime);
+    }
+
+    // GPU timestamp read is expensive (ioctl on Linux), so CPU time of each call is translated
+    // with GPU timer resolution from last exact sample, which is refreshed periodically to bound drift
+    std::lock_guard<std::mutex> lock(correlationMutex);
+    if (!correlationSampleValid || cpuTime < correlationSample.CPUTimeinNS || cpuTime - correlationSample.CPUTimeinNS >= refreshPeriodInNs) {
+        correlationSampleValid = getCpuGpuTime(&correlationSample);
+        if (!correlationSampleValid) {
+            return false;
+        }
+        *pGpuCpuTime = correlationSample;
+        return true;
+    }
+
+    pGpuCpuTime->CPUTimeinNS = cpuTime;
+    pGpuCpuTime->GPUTimeStamp = correlationSample.GPUTimeStamp + static_cast<uint64_t>((cpuTime - correlationSample.CPUTimeinNS) / deviceTimerResolution);
+    return true;
+}
 } // namespace NEO
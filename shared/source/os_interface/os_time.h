@@ -7,6 +7,7 @@
 
 #pragma once
 #include <memory>
+#include <mutex>
 
 #define NSEC_PER_SEC (1000000000ULL)
 
@@ -31,14 +32,20 @@ class OSTime {
     virtual double getDynamicDeviceTimerResolution(HardwareInfo const &hwInfo) const = 0;
     virtual uint64_t getDynamicDeviceTimerClock(HardwareInfo const &hwInfo) const = 0;
     virtual uint64_t getCpuRawTimestamp() = 0;
+    bool getCpuGpuTimeFromCorrelation(TimeStampData *pGpuCpuTime, double deviceTimerResolution);
     OSInterface *getOSInterface() const {
         return osInterface;
     }
 
     static double getDeviceTimerResolution(HardwareInfo const &hwInfo);
+    static constexpr uint64_t defaultCorrelationRefreshPeriodInMs = 100;
 
   protected:
     OSTime() {}
     OSInterface *osInterface = nullptr;
+
+    std::mutex correlationMutex;
+    TimeStampData correlationSample = {};
+    bool correlationSampleValid = false;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,22 +18,25 @@ DeferrableDeletion *DeferrableDeletion::create(Args... args) {
 template DeferrableDeletion *DeferrableDeletion::create(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle);
 
 DeferrableDeletionImpl::DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle)
-    : wddm(wddm), allocationCount(allocationCount), resourceHandle(resourceHandle) {
+    : wddm(wddm), resourceHandle(resourceHandle) {
     if (handles) {
-        this->handles = new D3DKMT_HANDLE[allocationCount];
-        for (uint32_t i = 0; i < allocationCount; i++) {
-            this->handles[i] = handles[i];
-        }
+        this->handles.assign(handles, handles + allocationCount);
     }
 }
 bool DeferrableDeletionImpl::apply() {
-    bool destroyStatus = wddm->destroyAllocations(handles, allocationCount, resourceHandle);
+    bool destroyStatus = wddm->destroyAllocations(handles.empty() ? nullptr : handles.data(), static_cast<uint32_t>(handles.size()), resourceHandle);
     DEBUG_BREAK_IF(!destroyStatus);
     return true;
 }
-DeferrableDeletionImpl::~DeferrableDeletionImpl() {
-    if (handles) {
-        delete[] handles;
+const void *DeferrableDeletionImpl::getMergeKey() const {
+    // allocations belonging to resource are destroyed with it, one resource per destroy call
+    if (resourceHandle != 0 || handles.empty()) {
+        return nullptr;
     }
+    return wddm;
+}
+void DeferrableDeletionImpl::mergeImpl(DeferrableDeletion &deletion) {
+    auto &mergedDeletion = static_cast<DeferrableDeletionImpl &>(deletion);
+    handles.insert(handles.end(), mergedDeletion.handles.begin(), mergedDeletion.handles.end());
 }
 } // namespace NEO
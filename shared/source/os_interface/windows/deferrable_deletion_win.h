@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,8 @@
 
 #include <d3dkmthk.h>
 
+#include <vector>
+
 namespace NEO {
 
 class OsContextWin;
@@ -21,15 +23,17 @@ class DeferrableDeletionImpl : public DeferrableDeletion {
   public:
     DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle);
     bool apply() override;
-    ~DeferrableDeletionImpl();
+    const void *getMergeKey() const override;
+    ~DeferrableDeletionImpl() override = default;
 
     DeferrableDeletionImpl(const DeferrableDeletionImpl &) = delete;
     DeferrableDeletionImpl &operator=(const DeferrableDeletionImpl &) = delete;
 
   protected:
+    void mergeImpl(DeferrableDeletion &deletion) override;
+
     Wddm *wddm;
-    D3DKMT_HANDLE *handles = nullptr;
-    uint32_t allocationCount;
+    std::vector<D3DKMT_HANDLE> handles;
     D3DKMT_HANDLE resourceHandle;
 };
 } // namespace NEO
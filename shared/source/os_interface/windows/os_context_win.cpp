@@ -38,6 +38,9 @@ void OsContextWin::initializeContext() {
 
     residencyController.registerCallback();
     UNRECOVERABLE_IF(!residencyController.isInitialized());
+
+    // context scheduling priority is not passed to KMD
+    this->priorityHonored = !isLowPriority() && !isHighPriority();
 };
 
 OsContextWin::~OsContextWin() {
@@ -6,6 +6,9 @@
  */
 
 #include "shared/source/os_interface/windows/os_thread_win.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
 namespace NEO {
 ThreadWin::ThreadWin(std::thread *thread) {
     this->thread.reset(thread);
@@ -22,4 +25,8 @@ void ThreadWin::join() {
 void ThreadWin::yield() {
     std::this_thread::yield();
 }
+
+bool ThreadWin::setAffinityMask(uint64_t cpuMask) {
+    return SetThreadAffinityMask(thread->native_handle(), static_cast<DWORD_PTR>(cpuMask)) != 0;
+}
 } // namespace NEO
@@ -15,6 +15,7 @@ class ThreadWin : public Thread {
     ThreadWin(std::thread *thread);
     void join() override;
     void yield() override;
+    bool setAffinityMask(uint64_t cpuMask) override;
     ~ThreadWin() override = default;
 
   protected:
@@ -32,9 +32,11 @@
 #include "shared/source/os_interface/windows/wddm_residency_allocations_container.h"
 #include "shared/source/sku_info/operations/windows/sku_info_receiver.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include "gmm_memory.h"
 
+#include <chrono>
 #include <dxgi.h>
 
 namespace NEO {
@@ -887,10 +889,23 @@ bool Wddm::waitOnGPU(D3DKMT_HANDLE context) {
     return status == STATUS_SUCCESS;
 }
 
+bool Wddm::spinOnMonitoredFence(uint64_t lastFenceValue, const MonitoredFence &monitoredFence) {
+    auto spinStart = std::chrono::steady_clock::now();
+    while (lastFenceValue > *monitoredFence.cpuAddress) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - spinStart).count();
+        if (elapsed >= WaitUtils::spinMicroseconds) {
+            return false;
+        }
+        CpuIntrinsics::pause();
+    }
+    return true;
+}
+
 bool Wddm::waitFromCpu(uint64_t lastFenceValue, const MonitoredFence &monitoredFence) {
     NTSTATUS status = STATUS_SUCCESS;
 
-    if (lastFenceValue > *monitoredFence.cpuAddress) {
+    // short submissions usually complete within spin period, which is cheaper than entering kernel wait
+    if (lastFenceValue > *monitoredFence.cpuAddress && !spinOnMonitoredFence(lastFenceValue, monitoredFence)) {
         D3DKMT_WAITFORSYNCHRONIZATIONOBJECTFROMCPU waitFromCpu = {0};
         waitFromCpu.ObjectCount = 1;
         waitFromCpu.ObjectHandleArray = &monitoredFence.fenceHandle;
@@ -1116,7 +1131,11 @@ void Wddm::updatePagingFenceValue(uint64_t newPagingFenceValue) {
 }
 
 WddmVersion Wddm::getWddmVersion() {
-    if (featureTable->ftrWddmHwQueues) {
+    bool hwQueuesEnabled = featureTable->ftrWddmHwQueues;
+    if (DebugManager.flags.EnableWddmHwQueues.get() != -1) {
+        hwQueuesEnabled = DebugManager.flags.EnableWddmHwQueues.get();
+    }
+    if (hwQueuesEnabled) {
         return WddmVersion::WDDM_2_3;
     } else {
         return WddmVersion::WDDM_2_0;
@@ -22,7 +22,13 @@ struct OsHandleWin : OsHandle {
     Gmm *gmm = nullptr;
 };
 
-constexpr size_t trimListUnusedPosition = std::numeric_limits<size_t>::max();
+class WddmAllocation;
+
+struct TrimCandidateListLinks {
+    WddmAllocation *previous = nullptr;
+    WddmAllocation *next = nullptr;
+    bool onList = false;
+};
 
 class WddmAllocation : public GraphicsAllocation {
   public:
@@ -32,7 +38,7 @@ class WddmAllocation : public GraphicsAllocation {
     WddmAllocation(uint32_t rootDeviceIndex, size_t numGmms, AllocationType allocationType, void *cpuPtrIn, size_t sizeIn,
                    void *reservedAddr, MemoryPool::Type pool, uint32_t shareable, size_t maxOsContextCount)
         : GraphicsAllocation(rootDeviceIndex, numGmms, allocationType, cpuPtrIn, castToUint64(cpuPtrIn), 0llu, sizeIn, pool, maxOsContextCount),
-          shareable(shareable), residency(maxOsContextCount), trimCandidateListPositions(maxOsContextCount, trimListUnusedPosition) {
+          shareable(shareable), residency(maxOsContextCount), trimCandidateListLinks(maxOsContextCount) {
         reservedAddressRangeInfo.addressPtr = reservedAddr;
         reservedAddressRangeInfo.rangeSize = sizeIn;
         handles.resize(gmms.size());
@@ -44,7 +50,7 @@ class WddmAllocation : public GraphicsAllocation {
     WddmAllocation(uint32_t rootDeviceIndex, size_t numGmms, AllocationType allocationType, void *cpuPtrIn, size_t sizeIn,
                    osHandle sharedHandle, MemoryPool::Type pool, size_t maxOsContextCount)
         : GraphicsAllocation(rootDeviceIndex, numGmms, allocationType, cpuPtrIn, sizeIn, sharedHandle, pool, maxOsContextCount),
-          residency(maxOsContextCount), trimCandidateListPositions(maxOsContextCount, trimListUnusedPosition) {
+          residency(maxOsContextCount), trimCandidateListLinks(maxOsContextCount) {
         handles.resize(gmms.size());
     }
 
@@ -77,15 +83,15 @@ class WddmAllocation : public GraphicsAllocation {
         return nullptr;
     }
 
-    void setTrimCandidateListPosition(uint32_t osContextId, size_t position) {
-        trimCandidateListPositions[osContextId] = position;
+    TrimCandidateListLinks &getTrimCandidateListLinks(uint32_t osContextId) {
+        return trimCandidateListLinks[osContextId];
     }
 
-    size_t getTrimCandidateListPosition(uint32_t osContextId) const {
-        if (osContextId < trimCandidateListPositions.size()) {
-            return trimCandidateListPositions[osContextId];
+    bool isOnTrimCandidateList(uint32_t osContextId) const {
+        if (osContextId < trimCandidateListLinks.size()) {
+            return trimCandidateListLinks[osContextId].onList;
         }
-        return trimListUnusedPosition;
+        return false;
     }
 
     void setGpuAddress(uint64_t graphicsAddress) { this->gpuAddress = graphicsAddress; }
@@ -111,7 +117,7 @@ class WddmAllocation : public GraphicsAllocation {
         return ss.str();
     }
     ResidencyData residency;
-    std::vector<size_t> trimCandidateListPositions;
+    std::vector<TrimCandidateListLinks> trimCandidateListLinks;
     StackVec<D3DKMT_HANDLE, EngineLimits::maxHandleCount> handles;
 };
 } // namespace NEO
@@ -440,7 +440,7 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
     for (auto &engine : this->registeredEngines) {
         auto &residencyController = static_cast<OsContextWin *>(engine.osContext)->getResidencyController();
         auto lock = residencyController.acquireLock();
-        residencyController.removeFromTrimCandidateListIfUsed(input, true);
+        residencyController.removeFromTrimCandidateListIfUsed(input);
     }
 
     auto defaultGmm = gfxAllocation->getDefaultGmm();
@@ -47,132 +47,65 @@ std::unique_lock<SpinLock> WddmResidencyController::acquireTrimCallbackLock() {
     return std::unique_lock<SpinLock>{this->trimCallbackLock};
 }
 
-WddmAllocation *WddmResidencyController::getTrimCandidateHead() {
-    uint32_t i = 0;
-    const size_t size = trimCandidateList.size();
-
-    if (size == 0) {
-        return nullptr;
-    }
-    while ((trimCandidateList[i] == nullptr) && (i < size))
-        i++;
-
-    return static_cast<WddmAllocation *>(trimCandidateList[i]);
-}
-
 void WddmResidencyController::addToTrimCandidateList(GraphicsAllocation *allocation) {
-    WddmAllocation *wddmAllocation = (WddmAllocation *)allocation;
-    size_t position = trimCandidateList.size();
-
-    DEBUG_BREAK_IF(trimCandidatesCount > trimCandidateList.size());
-
-    if (wddmAllocation->getTrimCandidateListPosition(this->osContextId) == trimListUnusedPosition) {
+    auto wddmAllocation = static_cast<WddmAllocation *>(allocation);
+    auto &links = wddmAllocation->getTrimCandidateListLinks(this->osContextId);
+
+    if (!links.onList) {
+        links.previous = trimCandidateListTail;
+        links.next = nullptr;
+        links.onList = true;
+        if (trimCandidateListTail) {
+            trimCandidateListTail->getTrimCandidateListLinks(this->osContextId).next = wddmAllocation;
+        } else {
+            trimCandidateListHead = wddmAllocation;
+        }
+        trimCandidateListTail = wddmAllocation;
         trimCandidatesCount++;
-        trimCandidateList.push_back(allocation);
-        wddmAllocation->setTrimCandidateListPosition(this->osContextId, position);
     }
 
     checkTrimCandidateCount();
 }
 
-void WddmResidencyController::removeFromTrimCandidateList(GraphicsAllocation *allocation, bool compactList) {
-    WddmAllocation *wddmAllocation = (WddmAllocation *)allocation;
-    size_t position = wddmAllocation->getTrimCandidateListPosition(this->osContextId);
-
-    DEBUG_BREAK_IF(!(trimCandidatesCount > (trimCandidatesCount - 1)));
-    DEBUG_BREAK_IF(trimCandidatesCount > trimCandidateList.size());
-
-    trimCandidatesCount--;
-
-    trimCandidateList[position] = nullptr;
-
-    checkTrimCandidateCount();
-
-    if (position == trimCandidateList.size() - 1) {
-        size_t erasePosition = position;
+void WddmResidencyController::removeFromTrimCandidateList(GraphicsAllocation *allocation) {
+    auto wddmAllocation = static_cast<WddmAllocation *>(allocation);
+    auto &links = wddmAllocation->getTrimCandidateListLinks(this->osContextId);
 
-        if (position == 0) {
-            trimCandidateList.resize(0);
-        } else {
-            while (trimCandidateList[erasePosition] == nullptr && erasePosition > 0) {
-                erasePosition--;
-            }
+    DEBUG_BREAK_IF(!links.onList);
+    DEBUG_BREAK_IF(trimCandidatesCount == 0);
 
-            size_t sizeRemaining = erasePosition + 1;
-            if (erasePosition == 0 && trimCandidateList[erasePosition] == nullptr) {
-                sizeRemaining = 0;
-            }
-
-            trimCandidateList.resize(sizeRemaining);
-        }
+    if (links.previous) {
+        links.previous->getTrimCandidateListLinks(this->osContextId).next = links.next;
+    } else {
+        trimCandidateListHead = links.next;
     }
-    wddmAllocation->setTrimCandidateListPosition(this->osContextId, trimListUnusedPosition);
-
-    if (compactList && checkTrimCandidateListCompaction()) {
-        compactTrimCandidateList();
+    if (links.next) {
+        links.next->getTrimCandidateListLinks(this->osContextId).previous = links.previous;
+    } else {
+        trimCandidateListTail = links.previous;
     }
+    links = {};
+    trimCandidatesCount--;
 
     checkTrimCandidateCount();
 }
 
-void WddmResidencyController::removeFromTrimCandidateListIfUsed(WddmAllocation *allocation, bool compactList) {
-    if (allocation->getTrimCandidateListPosition(this->osContextId) != trimListUnusedPosition) {
-        this->removeFromTrimCandidateList(allocation, true);
+void WddmResidencyController::removeFromTrimCandidateListIfUsed(WddmAllocation *allocation) {
+    if (allocation->isOnTrimCandidateList(this->osContextId)) {
+        this->removeFromTrimCandidateList(allocation);
     }
 }
 
 void WddmResidencyController::checkTrimCandidateCount() {
     if (DebugManager.flags.ResidencyDebugEnable.get()) {
         uint32_t sum = 0;
-        for (auto trimCandidate : trimCandidateList) {
-            if (trimCandidate != nullptr) {
-                sum++;
-            }
+        for (auto trimCandidate = trimCandidateListHead; trimCandidate != nullptr; trimCandidate = trimCandidate->getTrimCandidateListLinks(this->osContextId).next) {
+            sum++;
         }
         DEBUG_BREAK_IF(sum != trimCandidatesCount);
     }
 }
 
-bool WddmResidencyController::checkTrimCandidateListCompaction() {
-    return 2 * trimCandidatesCount <= trimCandidateList.size();
-}
-
-void WddmResidencyController::compactTrimCandidateList() {
-    size_t size = trimCandidateList.size();
-    size_t freePosition = 0;
-
-    if (size == 0 || size == trimCandidatesCount) {
-        return;
-    }
-
-    DEBUG_BREAK_IF(!(trimCandidateList[size - 1] != nullptr));
-
-    uint32_t previousCount = trimCandidatesCount;
-    DEBUG_BREAK_IF(trimCandidatesCount > trimCandidateList.size());
-
-    while (freePosition < trimCandidatesCount && trimCandidateList[freePosition] != nullptr)
-        freePosition++;
-
-    for (uint32_t i = 1; i < size; i++) {
-
-        if (trimCandidateList[i] != nullptr && freePosition < i) {
-            trimCandidateList[freePosition] = trimCandidateList[i];
-            trimCandidateList[i] = nullptr;
-            static_cast<WddmAllocation *>(trimCandidateList[freePosition])->setTrimCandidateListPosition(this->osContextId, freePosition);
-            freePosition++;
-
-            // Last element was moved, erase elements from freePosition
-            if (i == size - 1) {
-                trimCandidateList.resize(freePosition);
-            }
-        }
-    }
-    DEBUG_BREAK_IF(trimCandidatesCount > trimCandidateList.size());
-    DEBUG_BREAK_IF(trimCandidatesCount != previousCount);
-
-    checkTrimCandidateCount();
-}
-
 void WddmResidencyController::resetMonitoredFenceParams(D3DKMT_HANDLE &handle, uint64_t *cpuAddress, D3DGPU_VIRTUAL_ADDRESS &gpuAddress) {
     monitoredFence.lastSubmittedFence = 0;
     monitoredFence.currentFenceValue = 1;
@@ -219,11 +152,7 @@ void WddmResidencyController::trimResidency(D3DDDI_TRIMRESIDENCYSET_FLAGS flags,
             }
             wddmAllocation->getResidencyData().resident[osContextId] = false;
 
-            this->removeFromTrimCandidateList(wddmAllocation, false);
-        }
-
-        if (this->checkTrimCandidateListCompaction()) {
-            this->compactTrimCandidateList();
+            this->removeFromTrimCandidateList(wddmAllocation);
         }
     }
 
@@ -289,11 +218,7 @@ bool WddmResidencyController::trimResidencyToBudget(uint64_t bytes) {
         }
 
         wddmAllocation->getResidencyData().resident[osContextId] = false;
-        this->removeFromTrimCandidateList(wddmAllocation, false);
-    }
-
-    if (bytes > numberOfBytesToTrim && this->checkTrimCandidateListCompaction()) {
-        this->compactTrimCandidateList();
+        this->removeFromTrimCandidateList(wddmAllocation);
     }
 
     return numberOfBytesToTrim == 0;
@@ -304,12 +229,15 @@ bool WddmResidencyController::makeResidentResidencyAllocations(const ResidencyCo
     constexpr uint32_t stackAllocations = 64;
     constexpr uint32_t stackHandlesCount = NEO::maxFragmentsCount * EngineLimits::maxHandleCount * stackAllocations;
     StackVec<D3DKMT_HANDLE, stackHandlesCount> handlesForResidency;
+    StackVec<WddmAllocation *, stackAllocations> allocationsToMakeResident;
     uint32_t totalHandlesCount = 0;
     size_t totalSize = 0;
 
     auto lock = this->acquireLock();
 
-    DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "currentFenceValue =", this->getMonitoredFence().currentFenceValue);
+    // Update fence value not to early destroy / evict allocation or fragment referenced by different GA in trimming callback
+    const auto currentFence = this->getMonitoredFence().currentFenceValue;
+    DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "currentFenceValue =", currentFence);
 
     for (uint32_t i = 0; i < residencyCount; i++) {
         WddmAllocation *allocation = static_cast<WddmAllocation *>(allocationsForResidency[i]);
@@ -319,9 +247,9 @@ bool WddmResidencyController::makeResidentResidencyAllocations(const ResidencyCo
 
         DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "allocation =", allocation, residencyData.resident[osContextId] ? "resident" : "not resident");
 
-        if (allocation->getTrimCandidateListPosition(this->osContextId) != trimListUnusedPosition) {
+        if (allocation->isOnTrimCandidateList(this->osContextId)) {
             DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "allocation =", allocation, "on trimCandidateList");
-            this->removeFromTrimCandidateList(allocation, false);
+            this->removeFromTrimCandidateList(allocation);
         } else {
             for (uint32_t allocationId = 0; allocationId < allocation->fragmentsStorage.fragmentCount; allocationId++) {
                 fragmentResidency[allocationId] = allocation->fragmentsStorage.fragmentStorageData[allocationId].residency->resident[osContextId];
@@ -331,6 +259,7 @@ bool WddmResidencyController::makeResidentResidencyAllocations(const ResidencyCo
             }
         }
 
+        const auto allocationHandlesStart = totalHandlesCount;
         if (allocation->fragmentsStorage.fragmentCount > 0) {
             for (uint32_t allocationId = 0; allocationId < allocation->fragmentsStorage.fragmentCount; allocationId++) {
                 if (!fragmentResidency[allocationId]) {
@@ -344,6 +273,13 @@ bool WddmResidencyController::makeResidentResidencyAllocations(const ResidencyCo
                 totalHandlesCount++;
             }
         }
+
+        if (totalHandlesCount != allocationHandlesStart) {
+            allocationsToMakeResident.push_back(allocation);
+        } else {
+            // already resident, only fence has to be refreshed and allocation is not revisited after MakeResident
+            updateResidencyData(allocation, currentFence);
+        }
     }
 
     bool result = true;
@@ -365,25 +301,25 @@ bool WddmResidencyController::makeResidentResidencyAllocations(const ResidencyCo
     }
 
     if (result == true) {
-        for (uint32_t i = 0; i < residencyCount; i++) {
-            WddmAllocation *allocation = static_cast<WddmAllocation *>(allocationsForResidency[i]);
-            // Update fence value not to early destroy / evict allocation
-            const auto currentFence = this->getMonitoredFence().currentFenceValue;
-            allocation->getResidencyData().updateCompletionData(currentFence, this->osContextId);
-            allocation->getResidencyData().resident[osContextId] = true;
-
-            for (uint32_t allocationId = 0; allocationId < allocation->fragmentsStorage.fragmentCount; allocationId++) {
-                auto residencyData = allocation->fragmentsStorage.fragmentStorageData[allocationId].residency;
-                // Update fence value not to remove the fragment referenced by different GA in trimming callback
-                residencyData->updateCompletionData(currentFence, this->osContextId);
-                residencyData->resident[osContextId] = true;
-            }
+        for (auto allocation : allocationsToMakeResident) {
+            updateResidencyData(allocation, currentFence);
         }
     }
 
     return result;
 }
 
+void WddmResidencyController::updateResidencyData(WddmAllocation *allocation, uint64_t currentFence) {
+    allocation->getResidencyData().updateCompletionData(currentFence, this->osContextId);
+    allocation->getResidencyData().resident[osContextId] = true;
+
+    for (uint32_t allocationId = 0; allocationId < allocation->fragmentsStorage.fragmentCount; allocationId++) {
+        auto residencyData = allocation->fragmentsStorage.fragmentStorageData[allocationId].residency;
+        residencyData->updateCompletionData(currentFence, this->osContextId);
+        residencyData->resident[osContextId] = true;
+    }
+}
+
 void WddmResidencyController::makeNonResidentEvictionAllocations(const ResidencyContainer &evictionAllocations) {
     auto lock = this->acquireLock();
     const size_t residencyCount = evictionAllocations.size();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,18 +31,15 @@ class WddmResidencyController {
     MOCKABLE_VIRTUAL std::unique_lock<SpinLock> acquireLock();
     std::unique_lock<SpinLock> acquireTrimCallbackLock();
 
-    WddmAllocation *getTrimCandidateHead();
+    WddmAllocation *getTrimCandidateHead() const { return trimCandidateListHead; }
+    WddmAllocation *getTrimCandidateTail() const { return trimCandidateListTail; }
     void addToTrimCandidateList(GraphicsAllocation *allocation);
-    void removeFromTrimCandidateList(GraphicsAllocation *allocation, bool compactList);
-    void removeFromTrimCandidateListIfUsed(WddmAllocation *allocation, bool compactList);
+    void removeFromTrimCandidateList(GraphicsAllocation *allocation);
+    void removeFromTrimCandidateListIfUsed(WddmAllocation *allocation);
     void checkTrimCandidateCount();
 
-    MOCKABLE_VIRTUAL bool checkTrimCandidateListCompaction();
-    void compactTrimCandidateList();
-
     bool wasAllocationUsedSinceLastTrim(uint64_t fenceValue) { return fenceValue > lastTrimFenceValue; }
     void updateLastTrimFenceValue() { lastTrimFenceValue = *this->getMonitoredFence().cpuAddress; }
-    const ResidencyContainer &peekTrimCandidateList() const { return trimCandidateList; }
     uint32_t peekTrimCandidatesCount() const { return trimCandidatesCount; }
 
     MonitoredFence &getMonitoredFence() { return monitoredFence; }
@@ -62,6 +59,8 @@ class WddmResidencyController {
     bool isInitialized() const;
 
   protected:
+    void updateResidencyData(WddmAllocation *allocation, uint64_t currentFence);
+
     Wddm &wddm;
     uint32_t osContextId;
     MonitoredFence monitoredFence = {};
@@ -71,7 +70,10 @@ class WddmResidencyController {
 
     bool memoryBudgetExhausted = false;
     uint64_t lastTrimFenceValue = 0u;
-    ResidencyContainer trimCandidateList;
+    // intrusive list linked through WddmAllocation, allocations are appended when they stop being used
+    // so they are ordered by last fence value with the least recently used one at the head
+    WddmAllocation *trimCandidateListHead = nullptr;
+    WddmAllocation *trimCandidateListTail = nullptr;
     uint32_t trimCandidatesCount = 0;
 
     VOID *trimCallbackHandle = nullptr;
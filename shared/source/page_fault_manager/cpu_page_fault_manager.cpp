@@ -8,11 +8,15 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace NEO {
@@ -20,8 +24,14 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     const bool initialPlacementCpu = !memoryProperties.allocFlags.usmInitialPlacementGpu;
     const auto domain = initialPlacementCpu ? AllocationDomain::Cpu : AllocationDomain::None;
 
-    std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    pageFaultData.blockSize = getMigrationBlockSize(size);
+    if (pageFaultData.blockSize != 0u) {
+        pageFaultData.cpuBlocks.assign(Math::divideAndRoundUp(size, pageFaultData.blockSize), initialPlacementCpu);
+    }
+
+    std::unique_lock<std::shared_mutex> lock{mtx};
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (!initialPlacementCpu) {
         this->setAubWritable(false, ptr, unifiedMemoryManager);
         this->protectCPUMemoryAccess(ptr, size);
@@ -29,62 +39,220 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
 }
 
 void PageFaultManager::removeAllocation(void *ptr) {
-    std::unique_lock<SpinLock> lock{mtx};
+    std::unique_lock<std::shared_mutex> lock{mtx};
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain == AllocationDomain::Gpu) {
+        bool partiallyProtected = pageFaultData.domain == AllocationDomain::Cpu &&
+                                  std::find(pageFaultData.cpuBlocks.begin(), pageFaultData.cpuBlocks.end(), false) != pageFaultData.cpuBlocks.end();
+        if (pageFaultData.domain == AllocationDomain::Gpu || pageFaultData.domain == AllocationDomain::CpuReadOnly || partiallyProtected) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         }
-        this->memoryData.erase(ptr);
+        this->memoryData.erase(alloc);
+    }
+}
+
+void PageFaultManager::setReadMostly(void *ptr, bool readMostly) {
+    std::shared_lock<std::shared_mutex> lock{mtx};
+    auto alloc = memoryData.find(ptr);
+    if (alloc != memoryData.end()) {
+        std::unique_lock<SpinLock> allocationLock{*alloc->second.lock};
+        alloc->second.readMostly = readMostly;
+    }
+}
+
+void PageFaultManager::setPreferredGpuLocation(void *ptr, bool gpuPreferred) {
+    std::shared_lock<std::shared_mutex> lock{mtx};
+    auto alloc = memoryData.find(ptr);
+    if (alloc == memoryData.end()) {
+        return;
+    }
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    std::unique_lock<SpinLock> allocationLock{*pageFaultData.lock};
+    pageFaultData.gpuPreferred = gpuPreferred;
+
+    if (gpuPreferred) {
+        if (pageFaultData.blockSize != 0u || pageFaultData.domain == AllocationDomain::CpuReadOnly) {
+            return;
+        }
+        auto blockSize = getPreferredLocationBlockSize(pageFaultData.size);
+        if (blockSize != 0u) {
+            // whole allocation is either accessible or protected, so block state follows domain
+            pageFaultData.blockSize = blockSize;
+            pageFaultData.cpuBlocks.assign(Math::divideAndRoundUp(pageFaultData.size, blockSize), pageFaultData.domain == AllocationDomain::Cpu);
+            pageFaultData.blocksFromAdvice = true;
+        }
+    } else if (pageFaultData.blocksFromAdvice) {
+        if (pageFaultData.domain == AllocationDomain::Cpu) {
+            migrateBlockRangeToCpuDomain(allocPtr, pageFaultData, 0u, pageFaultData.cpuBlocks.size());
+        }
+        pageFaultData.blockSize = 0u;
+        pageFaultData.cpuBlocks.clear();
+        pageFaultData.blocksFromAdvice = false;
     }
 }
 
 void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
-    std::unique_lock<SpinLock> lock{mtx};
+    std::shared_lock<std::shared_mutex> lock{mtx};
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
+        std::unique_lock<SpinLock> allocationLock{*pageFaultData.lock};
         if (pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Cpu) {
-                this->transferToGpu(ptr, pageFaultData.cmdQ);
-                this->protectCPUMemoryAccess(ptr, pageFaultData.size);
-            }
-            pageFaultData.domain = AllocationDomain::Gpu;
+            migrateToGpuDomain(ptr, pageFaultData);
         }
     }
 }
 
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
-    std::unique_lock<SpinLock> lock{mtx};
+    std::shared_lock<std::shared_mutex> lock{mtx};
     for (auto &alloc : this->memoryData) {
         auto allocPtr = alloc.first;
         auto &pageFaultData = alloc.second;
-        if (pageFaultData.unifiedMemoryManager == unifiedMemoryManager && pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Cpu) {
-                this->transferToGpu(allocPtr, pageFaultData.cmdQ);
-                this->protectCPUMemoryAccess(allocPtr, pageFaultData.size);
+        if (pageFaultData.unifiedMemoryManager != unifiedMemoryManager) {
+            continue;
+        }
+        std::unique_lock<SpinLock> allocationLock{*pageFaultData.lock};
+        if (pageFaultData.domain != AllocationDomain::Gpu) {
+            migrateToGpuDomain(allocPtr, pageFaultData);
+        }
+    }
+}
+
+void PageFaultManager::migrateToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.domain == AllocationDomain::CpuReadOnly) {
+        // CPU only read duplicated data, GPU copy is still valid
+        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+    } else if (pageFaultData.domain == AllocationDomain::Cpu) {
+        if (pageFaultData.blockSize == 0u) {
+            this->transferToGpu(ptr, pageFaultData.cmdQ);
+            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        } else {
+            // only blocks touched by CPU hold newer data, migrate them in contiguous runs
+            auto &cpuBlocks = pageFaultData.cpuBlocks;
+            for (size_t block = 0u; block < cpuBlocks.size();) {
+                if (!cpuBlocks[block]) {
+                    block++;
+                    continue;
+                }
+                auto runEnd = block;
+                while (runEnd < cpuBlocks.size() && cpuBlocks[runEnd]) {
+                    cpuBlocks[runEnd++] = false;
+                }
+                auto offset = block * pageFaultData.blockSize;
+                auto size = getBlockRangeSize(pageFaultData, block, runEnd);
+                this->transferRangeToGpu(ptr, offset, size, pageFaultData.cmdQ);
+                this->protectCPUMemoryAccess(ptrOffset(ptr, offset), size);
+                block = runEnd;
             }
-            pageFaultData.domain = AllocationDomain::Gpu;
         }
     }
+    pageFaultData.domain = AllocationDomain::Gpu;
 }
 
-bool PageFaultManager::verifyPageFault(void *ptr) {
-    std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+void PageFaultManager::migrateBlocksToCpuDomain(void *ptr, void *faultPtr, PageFaultData &pageFaultData) {
+    auto &cpuBlocks = pageFaultData.cpuBlocks;
+    auto faultBlock = ptrDiff(faultPtr, ptr) / pageFaultData.blockSize;
+
+    size_t prefetchBlocks = 0u;
+    if (DebugManager.flags.UsmMigrationPrefetchBlocks.get() > 0) {
+        prefetchBlocks = static_cast<size_t>(DebugManager.flags.UsmMigrationPrefetchBlocks.get());
+    }
+    auto lastBlock = std::min(faultBlock + prefetchBlocks + 1, cpuBlocks.size());
 
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
+    migrateBlockRangeToCpuDomain(ptr, pageFaultData, faultBlock, lastBlock);
+}
+
+void PageFaultManager::migrateBlockRangeToCpuDomain(void *ptr, PageFaultData &pageFaultData, size_t firstBlock, size_t lastBlock) {
+    auto &cpuBlocks = pageFaultData.cpuBlocks;
+    for (auto block = firstBlock; block < lastBlock;) {
+        if (cpuBlocks[block]) {
+            block++;
+            continue;
+        }
+        auto runEnd = block;
+        while (runEnd < lastBlock && !cpuBlocks[runEnd]) {
+            cpuBlocks[runEnd++] = true;
+        }
+        auto offset = block * pageFaultData.blockSize;
+        auto size = getBlockRangeSize(pageFaultData, block, runEnd);
+        if (pageFaultData.domain != AllocationDomain::None) {
+            this->transferRangeToCpu(ptr, offset, size, pageFaultData.cmdQ);
         }
+        this->allowCPUMemoryAccess(ptrOffset(ptr, offset), size);
+        block = runEnd;
+    }
+    pageFaultData.domain = AllocationDomain::Cpu;
+}
+
+void PageFaultManager::duplicateToCpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    if (pageFaultData.domain == AllocationDomain::CpuReadOnly) {
+        // write to duplicated allocation, GPU copy becomes stale
+        this->allowCPUMemoryAccess(ptr, pageFaultData.size);
+        pageFaultData.domain = AllocationDomain::Cpu;
+        return;
+    }
+    if (pageFaultData.domain == AllocationDomain::Gpu) {
+        this->transferToCpu(ptr, pageFaultData.size, pageFaultData.cmdQ);
+    }
+    this->allowCPUMemoryReadAccess(ptr, pageFaultData.size);
+    pageFaultData.domain = AllocationDomain::CpuReadOnly;
+}
+
+size_t PageFaultManager::getPreferredLocationBlockSize(size_t size) const {
+    if (this->gpuDomainHandler != &PageFaultManager::handleGpuDomainTransferForHw) {
+        return 0u;
+    }
+    return size > preferredLocationBlockSize ? preferredLocationBlockSize : 0u;
+}
+
+size_t PageFaultManager::getMigrationBlockSize(size_t size) const {
+    if (DebugManager.flags.UsmMigrationBlockSize.get() <= 0 ||
+        this->gpuDomainHandler != &PageFaultManager::handleGpuDomainTransferForHw) {
+        return 0u;
+    }
+    auto blockSize = alignUp(static_cast<size_t>(DebugManager.flags.UsmMigrationBlockSize.get()) * MemoryConstants::kiloByte, MemoryConstants::pageSize);
+    return size > blockSize ? blockSize : 0u;
+}
+
+size_t PageFaultManager::getBlockRangeSize(const PageFaultData &pageFaultData, size_t firstBlock, size_t lastBlock) {
+    return std::min(lastBlock * pageFaultData.blockSize, pageFaultData.size) - firstBlock * pageFaultData.blockSize;
+}
+
+PageFaultManager::MemoryDataContainer::iterator PageFaultManager::findAllocationContaining(void *ptr) {
+    auto alloc = memoryData.upper_bound(ptr);
+    if (alloc == memoryData.begin()) {
+        return memoryData.end();
+    }
+    alloc--;
+    if (ptr >= ptrOffset(alloc->first, alloc->second.size)) {
+        return memoryData.end();
+    }
+    return alloc;
+}
+
+bool PageFaultManager::verifyPageFault(void *ptr) {
+    std::shared_lock<std::shared_mutex> lock{mtx};
+    auto alloc = findAllocationContaining(ptr);
+    if (alloc == memoryData.end()) {
+        return false;
+    }
+
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    std::unique_lock<SpinLock> allocationLock{*pageFaultData.lock};
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+
+    if (pageFaultData.blockSize != 0u) {
+        migrateBlocksToCpuDomain(allocPtr, ptr, pageFaultData);
+    } else if (pageFaultData.readMostly && this->gpuDomainHandler == &PageFaultManager::handleGpuDomainTransferForHw) {
+        duplicateToCpuDomain(allocPtr, pageFaultData);
+    } else {
+        gpuDomainHandler(this, allocPtr, pageFaultData);
     }
-    return false;
+    return true;
 }
 
 void PageFaultManager::handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *allocPtr, PageFaultData &pageFaultData) {
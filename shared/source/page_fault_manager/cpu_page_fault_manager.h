@@ -7,13 +7,16 @@
 
 #pragma once
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include "memory_properties_flags.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <shared_mutex>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -31,21 +34,37 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties);
     void removeAllocation(void *ptr);
 
+    // read mostly allocation is duplicated on CPU read, GPU copy stays valid until CPU writes to it
+    MOCKABLE_VIRTUAL void setReadMostly(void *ptr, bool readMostly);
+    // allocation preferring GPU location migrates to CPU only in blocks touched by CPU
+    MOCKABLE_VIRTUAL void setPreferredGpuLocation(void *ptr, bool gpuPreferred);
+
     enum class AllocationDomain {
         None,
         Cpu,
+        CpuReadOnly,
         Gpu,
     };
 
+    static constexpr size_t preferredLocationBlockSize = MemoryConstants::pageSize64k;
+
   protected:
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t blockSize = 0u;
+        std::vector<bool> cpuBlocks;
+        bool readMostly = false;
+        bool gpuPreferred = false;
+        bool blocksFromAdvice = false;
+        std::unique_ptr<SpinLock> lock = std::make_unique<SpinLock>();
     };
+    using MemoryDataContainer = std::map<void *, PageFaultData>;
 
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
+    virtual void allowCPUMemoryReadAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
 
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
@@ -53,14 +72,26 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
     static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     static void handleGpuDomainTransferForAubAndTbx(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
 
+    void migrateToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateBlocksToCpuDomain(void *ptr, void *faultPtr, PageFaultData &pageFaultData);
+    void migrateBlockRangeToCpuDomain(void *ptr, PageFaultData &pageFaultData, size_t firstBlock, size_t lastBlock);
+    void duplicateToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    size_t getPreferredLocationBlockSize(size_t size) const;
+    size_t getMigrationBlockSize(size_t size) const;
+    static size_t getBlockRangeSize(const PageFaultData &pageFaultData, size_t firstBlock, size_t lastBlock);
+    MemoryDataContainer::iterator findAllocationContaining(void *ptr);
+
     decltype(&handleGpuDomainTransferForHw) gpuDomainHandler = &handleGpuDomainTransferForHw;
-    std::unordered_map<void *, PageFaultData> memoryData;
-    SpinLock mtx;
+    // ordered by base address for range lookup; mtx guards the container, each entry's lock guards its migration state
+    MemoryDataContainer memoryData;
+    std::shared_mutex mtx;
 };
 } // namespace NEO
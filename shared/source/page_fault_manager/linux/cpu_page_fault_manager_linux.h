@@ -22,6 +22,7 @@ class PageFaultManagerLinux : public PageFaultManager {
 
   protected:
     void allowCPUMemoryAccess(void *ptr, size_t size) override;
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override;
     void protectCPUMemoryAccess(void *ptr, size_t size) override;
 
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override;
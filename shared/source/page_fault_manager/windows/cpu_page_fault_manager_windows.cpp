@@ -48,6 +48,12 @@ void PageFaultManagerWindows::allowCPUMemoryAccess(void *ptr, size_t size) {
     UNRECOVERABLE_IF(!retVal);
 }
 
+void PageFaultManagerWindows::allowCPUMemoryReadAccess(void *ptr, size_t size) {
+    DWORD previousState;
+    auto retVal = VirtualProtect(ptr, size, PAGE_READONLY, &previousState);
+    UNRECOVERABLE_IF(!retVal);
+}
+
 void PageFaultManagerWindows::protectCPUMemoryAccess(void *ptr, size_t size) {
     DWORD previousState;
     auto retVal = VirtualProtect(ptr, size, PAGE_NOACCESS, &previousState);
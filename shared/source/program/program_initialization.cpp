@@ -12,6 +12,7 @@
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/batched_memory_transfer.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_info.h"
@@ -19,7 +20,8 @@
 namespace NEO {
 
 GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAllocManager, NEO::Device &device, size_t size, bool constant,
-                                           LinkerInput *const linkerInput, const void *initData) {
+                                           LinkerInput *const linkerInput, const void *initData,
+                                           BatchedMemoryTransfer *batchedTransfer) {
     bool globalsAreExported = false;
     GraphicsAllocation *gpuAllocation = nullptr;
     auto rootDeviceIndex = device.getRootDeviceIndex();
@@ -60,6 +62,11 @@ GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAlloc
         return nullptr;
     }
 
+    if (batchedTransfer != nullptr) {
+        batchedTransfer->add(gpuAllocation, 0, initData, size);
+        return gpuAllocation;
+    }
+
     auto &hwInfo = device.getHardwareInfo();
     auto &helper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
 
@@ -11,6 +11,7 @@
 
 namespace NEO {
 
+class BatchedMemoryTransfer;
 class Device;
 class GraphicsAllocation;
 class SVMAllocsManager;
@@ -18,6 +19,7 @@ struct LinkerInput;
 
 GraphicsAllocation *allocateGlobalsSurface(SVMAllocsManager *const svmAllocManager, Device &device,
                                            size_t size, bool constant,
-                                           LinkerInput *const linkerInput, const void *initData);
+                                           LinkerInput *const linkerInput, const void *initData,
+                                           BatchedMemoryTransfer *batchedTransfer = nullptr);
 
 } // namespace NEO
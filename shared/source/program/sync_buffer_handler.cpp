@@ -10,10 +10,14 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
 
 SyncBufferHandler::~SyncBufferHandler() {
+    for (auto retiredAllocation : retiredAllocations) {
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(retiredAllocation);
+    }
     memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
 };
 SyncBufferHandler::SyncBufferHandler(Device &device)
@@ -26,6 +30,35 @@ void SyncBufferHandler::makeResident(CommandStreamReceiver &csr) {
     csr.makeResident(*graphicsAllocation);
 }
 
+bool SyncBufferHandler::isAllocationInUse(GraphicsAllocation &allocation) {
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        if (allocation.isUsedByOsContext(osContextId) &&
+            allocation.getTaskCount(osContextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SyncBufferHandler::switchToNextBuffer() {
+    retiredAllocations.push_back(graphicsAllocation);
+
+    auto &oldestAllocation = retiredAllocations.front();
+    if (!isAllocationInUse(*oldestAllocation)) {
+        graphicsAllocation = oldestAllocation;
+        retiredAllocations.erase(retiredAllocations.begin());
+        std::memset(graphicsAllocation->getUnderlyingBuffer(), 0, bufferSize);
+        return;
+    }
+
+    if (retiredAllocations.size() > maxRetiredAllocationsCount) {
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(oldestAllocation);
+        retiredAllocations.erase(retiredAllocations.begin());
+    }
+    allocateNewBuffer();
+}
+
 void SyncBufferHandler::allocateNewBuffer() {
     AllocationProperties allocationProperties{device.getRootDeviceIndex(), true, bufferSize,
                                               GraphicsAllocation::AllocationType::LINEAR_STREAM,
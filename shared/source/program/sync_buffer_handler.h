@@ -10,6 +10,7 @@
 #include "shared/source/helpers/constants.h"
 
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 
@@ -31,11 +32,17 @@ class SyncBufferHandler {
     void makeResident(CommandStreamReceiver &csr);
 
   protected:
+    static constexpr size_t maxRetiredAllocationsCount = 4;
+
     void allocateNewBuffer();
+    void switchToNextBuffer();
+    bool isAllocationInUse(GraphicsAllocation &allocation);
 
     Device &device;
     MemoryManager &memoryManager;
     GraphicsAllocation *graphicsAllocation;
+    // full buffers, oldest first, reused once GPU completed all kernels using them
+    std::vector<GraphicsAllocation *> retiredAllocations;
     const size_t bufferSize = 64 * KB;
     size_t usedBufferSize = 0;
     std::mutex mutex;
@@ -14,8 +14,7 @@ void NEO::SyncBufferHandler::prepareForEnqueue(size_t workGroupsCount, KernelT &
 
     bool isCurrentBufferFull = (usedBufferSize + requiredSize > bufferSize);
     if (isCurrentBufferFull) {
-        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
-        allocateNewBuffer();
+        switchToNextBuffer();
         usedBufferSize = 0;
     }
 
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/best_fit_heap_allocator.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+namespace NEO {
+
+BestFitHeapAllocator::BestFitHeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment)
+    : size(size), availableSize(size), allocationAlignment(allocationAlignment) {
+    if (size > 0u) {
+        insertFreeRange(address, size);
+    }
+}
+
+uint64_t BestFitHeapAllocator::allocate(size_t &sizeToAllocate) {
+    sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (sizeToAllocate == 0u || availableSize < sizeToAllocate) {
+        return 0llu;
+    }
+
+    auto bestFit = freeRangesBySize.lower_bound({sizeToAllocate, 0llu});
+    if (bestFit == freeRangesBySize.end()) {
+        return 0llu;
+    }
+
+    auto rangeSize = bestFit->first;
+    auto ptr = bestFit->second;
+    eraseFreeRange(freeRangesByAddress.find(ptr));
+    if (rangeSize > sizeToAllocate) {
+        insertFreeRange(ptr + sizeToAllocate, rangeSize - sizeToAllocate);
+    }
+
+    availableSize -= sizeToAllocate;
+    return ptr;
+}
+
+void BestFitHeapAllocator::free(uint64_t ptr, size_t size) {
+    if (ptr == 0llu) {
+        return;
+    }
+    uint64_t rangeSize = alignUp(size, allocationAlignment);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    availableSize += rangeSize;
+
+    auto next = freeRangesByAddress.lower_bound(ptr);
+    DEBUG_BREAK_IF(next != freeRangesByAddress.end() && next->first < ptr + rangeSize);
+
+    if (next != freeRangesByAddress.begin()) {
+        auto previous = std::prev(next);
+        DEBUG_BREAK_IF(previous->first + previous->second > ptr);
+        if (previous->first + previous->second == ptr) {
+            ptr = previous->first;
+            rangeSize += previous->second;
+            eraseFreeRange(previous);
+        }
+    }
+
+    if (next != freeRangesByAddress.end() && next->first == ptr + rangeSize) {
+        rangeSize += next->second;
+        eraseFreeRange(next);
+    }
+
+    insertFreeRange(ptr, rangeSize);
+}
+
+void BestFitHeapAllocator::insertFreeRange(uint64_t ptr, uint64_t rangeSize) {
+    freeRangesByAddress.emplace(ptr, rangeSize);
+    freeRangesBySize.emplace(rangeSize, ptr);
+}
+
+void BestFitHeapAllocator::eraseFreeRange(FreeRangesByAddress::iterator freeRange) {
+    freeRangesBySize.erase({freeRange->second, freeRange->first});
+    freeRangesByAddress.erase(freeRange);
+}
+} // namespace NEO
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace NEO {
+
+// Address range allocator with the same contract as HeapAllocator.
+// Free ranges are indexed both by address (for coalescing on free) and by size (for best-fit lookup),
+// so allocate and free are O(log n) regardless of fragmentation.
+class BestFitHeapAllocator {
+  public:
+    BestFitHeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment);
+
+    BestFitHeapAllocator(const BestFitHeapAllocator &) = delete;
+    BestFitHeapAllocator &operator=(const BestFitHeapAllocator &) = delete;
+
+    uint64_t allocate(size_t &sizeToAllocate);
+    void free(uint64_t ptr, size_t size);
+
+    uint64_t getLeftSize() const {
+        return availableSize;
+    }
+
+    uint64_t getUsedSize() const {
+        return size - availableSize;
+    }
+
+    size_t getFreeRangesCount() const {
+        return freeRangesByAddress.size();
+    }
+
+  protected:
+    using FreeRangesByAddress = std::map<uint64_t, uint64_t>;
+
+    void insertFreeRange(uint64_t ptr, uint64_t rangeSize);
+    void eraseFreeRange(FreeRangesByAddress::iterator freeRange);
+
+    const uint64_t size;
+    uint64_t availableSize;
+    const size_t allocationAlignment;
+
+    FreeRangesByAddress freeRangesByAddress;
+    std::set<std::pair<uint64_t, uint64_t>> freeRangesBySize;
+    std::mutex mtx;
+};
+} // namespace NEO
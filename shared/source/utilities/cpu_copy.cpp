@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/cpu_info.h"
+#include "shared/source/utilities/parallel_tasks.h"
+
+#include <algorithm>
+#include <emmintrin.h>
+#include <limits>
+
+namespace NEO {
+namespace CpuCopy {
+
+size_t getParallelThreshold() {
+    if (DebugManager.flags.CpuCopyParallelThreshold.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.CpuCopyParallelThreshold.get());
+    }
+    return defaultParallelThreshold;
+}
+
+size_t getNonTemporalThreshold() {
+    if (DebugManager.flags.CpuCopyNonTemporalThreshold.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.CpuCopyNonTemporalThreshold.get());
+    }
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureSsE2)) {
+        return std::numeric_limits<size_t>::max();
+    }
+    return defaultNonTemporalThreshold;
+}
+
+static void streamData(void *dst, const void *src, size_t size) {
+    constexpr size_t blockSize = 4 * sizeof(__m128i);
+
+    auto headSize = std::min(size, static_cast<size_t>(ptrDiff(alignUp(dst, sizeof(__m128i)), dst)));
+    memcpy_s(dst, headSize, src, headSize);
+
+    auto dstBlock = reinterpret_cast<__m128i *>(ptrOffset(dst, headSize));
+    auto srcBlock = reinterpret_cast<const __m128i *>(ptrOffset(src, headSize));
+    auto blocksCount = (size - headSize) / blockSize;
+    for (size_t block = 0; block < blocksCount; block++) {
+        auto data0 = _mm_loadu_si128(srcBlock);
+        auto data1 = _mm_loadu_si128(srcBlock + 1);
+        auto data2 = _mm_loadu_si128(srcBlock + 2);
+        auto data3 = _mm_loadu_si128(srcBlock + 3);
+        _mm_stream_si128(dstBlock, data0);
+        _mm_stream_si128(dstBlock + 1, data1);
+        _mm_stream_si128(dstBlock + 2, data2);
+        _mm_stream_si128(dstBlock + 3, data3);
+        srcBlock += 4;
+        dstBlock += 4;
+    }
+
+    auto tailSize = size - headSize - blocksCount * blockSize;
+    memcpy_s(dstBlock, tailSize, srcBlock, tailSize);
+}
+
+void copyNonTemporal(void *dst, const void *src, size_t size) {
+    streamData(dst, src, size);
+    // streaming stores are weakly ordered, fence makes them visible before transfer is reported complete
+    _mm_sfence();
+}
+
+void copy(void *dst, const void *src, size_t size) {
+    auto nonTemporal = size >= getNonTemporalThreshold();
+    size_t chunksCount = 1;
+    if (size >= getParallelThreshold()) {
+        chunksCount = std::max(static_cast<size_t>(1), std::min(maxThreads, size / minChunkSize));
+    }
+    auto chunkSize = alignUp((size + chunksCount - 1) / chunksCount, MemoryConstants::cacheLineSize);
+
+    auto copyChunk = [&](size_t chunkId) {
+        auto offset = chunkId * chunkSize;
+        if (offset >= size) {
+            return;
+        }
+        auto length = std::min(chunkSize, size - offset);
+        if (nonTemporal) {
+            copyNonTemporal(ptrOffset(dst, offset), ptrOffset(src, offset), length);
+        } else {
+            memcpy_s(ptrOffset(dst, offset), length, ptrOffset(src, offset), length);
+        }
+    };
+    runParallelTasks(chunksCount, maxThreads, copyChunk);
+}
+
+void copyRows(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    if (rowSize == dstRowPitch && rowSize == srcRowPitch) {
+        copy(dst, src, rowSize * rowsCount);
+        return;
+    }
+
+    auto size = rowSize * rowsCount;
+    auto nonTemporal = size >= getNonTemporalThreshold();
+    size_t chunksCount = 1;
+    if (size >= getParallelThreshold()) {
+        chunksCount = std::max(static_cast<size_t>(1), std::min({maxThreads, size / minChunkSize, rowsCount}));
+    }
+    auto rowsInChunk = (rowsCount + chunksCount - 1) / chunksCount;
+
+    auto copyChunk = [&](size_t chunkId) {
+        auto firstRow = chunkId * rowsInChunk;
+        auto lastRow = std::min(firstRow + rowsInChunk, rowsCount);
+        for (auto row = firstRow; row < lastRow; row++) {
+            auto dstRow = ptrOffset(dst, row * dstRowPitch);
+            auto srcRow = ptrOffset(src, row * srcRowPitch);
+            if (nonTemporal) {
+                streamData(dstRow, srcRow, rowSize);
+            } else {
+                memcpy_s(dstRow, rowSize, srcRow, rowSize);
+            }
+        }
+        if (nonTemporal) {
+            _mm_sfence();
+        }
+    };
+    runParallelTasks(chunksCount, maxThreads, copyChunk);
+}
+
+} // namespace CpuCopy
+} // namespace NEO
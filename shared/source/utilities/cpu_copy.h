@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <cstddef>
+
+namespace NEO {
+namespace CpuCopy {
+
+constexpr size_t maxThreads = 4;
+// smaller chunks don't pay off thread creation
+constexpr size_t minChunkSize = 2 * MemoryConstants::megaByte;
+constexpr size_t defaultParallelThreshold = 8 * MemoryConstants::megaByte;
+// copies larger than last level cache would only evict other data
+constexpr size_t defaultNonTemporalThreshold = 16 * MemoryConstants::megaByte;
+
+size_t getParallelThreshold();
+size_t getNonTemporalThreshold();
+
+// Copies host memory used by CPU transfer paths, large copies are split across threads
+// and written with non-temporal stores.
+void copy(void *dst, const void *src, size_t size);
+void copyNonTemporal(void *dst, const void *src, size_t size);
+// Copies rowsCount rows of rowSize bytes between pitched surfaces, e.g. linear images.
+void copyRows(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+
+} // namespace CpuCopy
+} // namespace NEO
@@ -54,6 +54,8 @@ struct CpuInfo {
     static const uint64_t featureClflush = 0x2000000000ULL;
     static const uint64_t featureTsc = 0x4000000000ULL;
     static const uint64_t featureRdtscp = 0x8000000000ULL;
+    static const uint64_t featureWaitpkg = 0x10000000000ULL;
+    static const uint64_t featureAvX512Bw = 0x20000000000ULL;
 
     CpuInfo() : features(featureNone) {
     }
@@ -168,6 +170,14 @@ struct CpuInfo {
                 features |= (cpuInfo[1] & mask) == mask ? featureBmi : featureNone;
             }
 
+            {
+                features |= cpuInfo[1] & BIT(16) ? featureAvX512F : featureNone;
+            }
+
+            {
+                features |= cpuInfo[1] & BIT(30) ? featureAvX512Bw : featureNone;
+            }
+
             {
                 features |= cpuInfo[1] & BIT(4) ? featureHle : featureNone;
             }
@@ -175,6 +185,10 @@ struct CpuInfo {
             {
                 features |= cpuInfo[1] & BIT(11) ? featureRtm : featureNone;
             }
+
+            {
+                features |= cpuInfo[2] & BIT(5) ? featureWaitpkg : featureNone;
+            }
         }
 
         cpuid(cpuInfo, 0x80000000);
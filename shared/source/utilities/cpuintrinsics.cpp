@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,14 @@
 
 #include <emmintrin.h>
 
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_ia32_umonitor)
+#include <immintrin.h>
+#include <x86intrin.h>
+#define CPU_INTRINSICS_SUPPORT_WAITPKG
+#endif
+#endif
+
 namespace NEO {
 namespace CpuIntrinsics {
 
@@ -20,5 +28,18 @@ void pause() {
     _mm_pause();
 }
 
+#if defined(CPU_INTRINSICS_SUPPORT_WAITPKG)
+__attribute__((target("waitpkg"))) bool umwait(volatile void *monitorAddress, uint64_t timestampCounterDelta) {
+    _umonitor(const_cast<void *>(monitorAddress));
+    // control 0 selects C0.2 state, wakes up on write to monitored line or when deadline passes
+    _umwait(0u, __rdtsc() + timestampCounterDelta);
+    return true;
+}
+#else
+bool umwait(volatile void *monitorAddress, uint64_t timestampCounterDelta) {
+    return false;
+}
+#endif
+
 } // namespace CpuIntrinsics
 } // namespace NEO
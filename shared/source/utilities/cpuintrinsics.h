@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace NEO {
 namespace CpuIntrinsics {
 
@@ -14,5 +16,8 @@ void clFlush(void const *ptr);
 
 void pause();
 
+// returns false when umonitor/umwait can't be used in this build
+bool umwait(volatile void *monitorAddress, uint64_t timestampCounterDelta);
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace NEO {
+
+// Intrusive LIFO list of nodes linked with their "next" member.
+// Head keeps a modification counter next to the pointer, so concurrent pops are protected from ABA problem.
+// Nodes must outlive the stack, they are never freed by it.
+template <typename NodeObjectType>
+class LockFreeStack : NonCopyableOrMovableClass {
+  public:
+    void pushFrontOne(NodeObjectType &node) {
+        pushFrontChain(node, node);
+    }
+
+    // pushes already linked sequence first -> ... -> last
+    void pushFrontChain(NodeObjectType &first, NodeObjectType &last) {
+        auto currentHead = head.load(std::memory_order_relaxed);
+        do {
+            last.next = getNode(currentHead);
+        } while (!head.compare_exchange_weak(currentHead, pack(&first, currentHead), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    NodeObjectType *removeFrontOne() {
+        auto currentHead = head.load(std::memory_order_acquire);
+        NodeObjectType *node = nullptr;
+        do {
+            node = getNode(currentHead);
+            if (node == nullptr) {
+                return nullptr;
+            }
+        } while (!head.compare_exchange_weak(currentHead, pack(node->next, currentHead), std::memory_order_acquire, std::memory_order_acquire));
+        node->next = nullptr;
+        return node;
+    }
+
+    NodeObjectType *detachNodes() {
+        auto currentHead = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(currentHead, pack(nullptr, currentHead), std::memory_order_acquire, std::memory_order_relaxed)) {
+        }
+        return getNode(currentHead);
+    }
+
+    NodeObjectType *peekHead() const {
+        return getNode(head.load(std::memory_order_acquire));
+    }
+
+    bool peekIsEmpty() const {
+        return peekHead() == nullptr;
+    }
+
+    bool peekContains(NodeObjectType &node) const {
+        for (auto current = peekHead(); current != nullptr; current = current->next) {
+            if (current == &node) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+  protected:
+    static constexpr uint32_t pointerBits = sizeof(void *) == 8 ? 48u : 32u;
+    static constexpr uint64_t pointerMask = (1ull << pointerBits) - 1;
+
+    static NodeObjectType *getNode(uint64_t packedHead) {
+        return reinterpret_cast<NodeObjectType *>(static_cast<uintptr_t>(packedHead & pointerMask));
+    }
+
+    static uint64_t pack(NodeObjectType *node, uint64_t previousHead) {
+        auto counter = (previousHead >> pointerBits) + 1;
+        return (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(node)) & pointerMask) | (counter << pointerBits);
+    }
+
+    std::atomic<uint64_t> head{0u};
+};
+} // namespace NEO
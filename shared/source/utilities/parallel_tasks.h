@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace NEO {
+
+// Calls task(taskId) for each taskId in [0, tasksCount) using at most maxWorkers threads.
+// Calling thread is one of the workers, so no thread is created when there is a single task.
+template <typename TaskT>
+void runParallelTasks(size_t tasksCount, size_t maxWorkers, TaskT &task) {
+    struct Worker {
+        static void *run(void *arg) {
+            auto worker = reinterpret_cast<Worker *>(arg);
+            for (auto taskId = worker->nextTaskId++; taskId < worker->tasksCount; taskId = worker->nextTaskId++) {
+                (*worker->task)(taskId);
+            }
+            return nullptr;
+        }
+
+        TaskT *task;
+        size_t tasksCount;
+        std::atomic<size_t> nextTaskId;
+    };
+
+    Worker worker;
+    worker.task = &task;
+    worker.tasksCount = tasksCount;
+    worker.nextTaskId = 0;
+
+    auto workersCount = std::min(tasksCount, std::max(maxWorkers, static_cast<size_t>(1)));
+    std::vector<std::unique_ptr<Thread>> threads;
+    for (size_t i = 1; i < workersCount; i++) {
+        threads.push_back(Thread::create(Worker::run, reinterpret_cast<void *>(&worker)));
+    }
+
+    Worker::run(&worker);
+
+    for (auto &thread : threads) {
+        thread->join();
+    }
+}
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,15 @@
 
 #include "shared/source/utilities/perf_profiler.h"
 
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "os_inc.h"
 
 #include <atomic>
+#include <algorithm>
 #include <cstring>
+#include <mutex>
 #include <sstream>
 #include <thread>
 
@@ -176,4 +179,137 @@ void PerfProfiler::logTimes(long long start, long long end, long long span, unsi
 void PerfProfiler::logSysTimes(long long start, unsigned long long time, unsigned int id) {
     systemLogs.emplace_back(SystemLog{id, start, time});
 }
+
+std::atomic<uint32_t> ApiLatencyProfiler::apisCount(0);
+const char *ApiLatencyProfiler::apiNames[ApiLatencyProfiler::maxApis] = {
+    nullptr,
+};
+std::atomic<uint32_t> ApiLatencyProfiler::threadsCount(0);
+std::atomic<uint32_t> ApiLatencyProfiler::generation(0);
+ApiLatencyProfiler::ThreadData *ApiLatencyProfiler::threads[ApiLatencyProfiler::maxThreads] = {
+    nullptr,
+};
+
+namespace {
+std::mutex apiLatencyProfilerMutex;
+thread_local ApiLatencyProfiler::ThreadData *threadApiLatencyData = nullptr;
+thread_local uint32_t threadApiLatencyDataGeneration = 0;
+
+struct ApiLatencyProfilerExitDump {
+    ~ApiLatencyProfilerExitDump() {
+        // thread data exists only when histograms were enabled, so debug settings are not needed at exit
+        if (ApiLatencyProfiler::getThreadsCount() == 0) {
+            return;
+        }
+        // data is not released, threads still running at exit may record
+        std::ofstream dumpFile("ApiLatencyHistograms.csv", std::ios::trunc);
+        ApiLatencyProfiler::dump(dumpFile);
+    }
+} apiLatencyProfilerExitDump;
+} // namespace
+
+uint32_t ApiLatencyProfiler::registerApi(const char *apiName) {
+    std::lock_guard<std::mutex> lock(apiLatencyProfilerMutex);
+    auto apiId = apisCount.load();
+    for (uint32_t i = 0; i < apiId; i++) {
+        if (std::strcmp(apiNames[i], apiName) == 0) {
+            return i;
+        }
+    }
+    if (apiId == maxApis) {
+        return maxApis;
+    }
+    apiNames[apiId] = apiName;
+    apisCount = apiId + 1;
+    return apiId;
+}
+
+ApiLatencyProfiler::ThreadData *ApiLatencyProfiler::getThreadData() {
+    if (threadApiLatencyData != nullptr && threadApiLatencyDataGeneration == generation.load()) {
+        return threadApiLatencyData;
+    }
+
+    std::lock_guard<std::mutex> lock(apiLatencyProfilerMutex);
+    auto threadId = threadsCount.load();
+    if (threadId == maxThreads) {
+        return nullptr;
+    }
+    threads[threadId] = new ThreadData();
+    threadsCount = threadId + 1;
+    threadApiLatencyData = threads[threadId];
+    threadApiLatencyDataGeneration = generation.load();
+    return threadApiLatencyData;
+}
+
+uint32_t ApiLatencyProfiler::getBucketIndex(uint64_t latencyInNs) {
+    if (latencyInNs == 0) {
+        return 0;
+    }
+    return std::min(Math::log2(latencyInNs), bucketsCount - 1);
+}
+
+void ApiLatencyProfiler::record(uint32_t apiId, uint64_t latencyInNs) {
+    if (apiId >= maxApis) {
+        return;
+    }
+    auto threadData = getThreadData();
+    if (threadData == nullptr) {
+        return;
+    }
+
+    // counters are written only by owning thread, plain load and store avoid locked instructions
+    auto &callsCount = threadData->callsCount[apiId];
+    callsCount.store(callsCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    auto &bucket = threadData->buckets[apiId][getBucketIndex(latencyInNs)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+uint64_t ApiLatencyProfiler::getCallsCount(uint32_t apiId) {
+    std::lock_guard<std::mutex> lock(apiLatencyProfilerMutex);
+    uint64_t callsCount = 0;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        callsCount += threads[i]->callsCount[apiId].load(std::memory_order_relaxed);
+    }
+    return callsCount;
+}
+
+uint64_t ApiLatencyProfiler::getBucketCount(uint32_t apiId, uint32_t bucket) {
+    std::lock_guard<std::mutex> lock(apiLatencyProfilerMutex);
+    uint64_t bucketCount = 0;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        bucketCount += threads[i]->buckets[apiId][bucket].load(std::memory_order_relaxed);
+    }
+    return bucketCount;
+}
+
+void ApiLatencyProfiler::dump(std::ostream &out) {
+    out << "api,calls";
+    for (uint32_t bucket = 0; bucket < bucketsCount; bucket++) {
+        out << ",<" << (1ull << (bucket + 1)) << "ns";
+    }
+    out << "\n";
+
+    for (uint32_t apiId = 0; apiId < getApisCount(); apiId++) {
+        auto callsCount = getCallsCount(apiId);
+        if (callsCount == 0) {
+            continue;
+        }
+        out << apiNames[apiId] << "," << callsCount;
+        for (uint32_t bucket = 0; bucket < bucketsCount; bucket++) {
+            out << "," << getBucketCount(apiId, bucket);
+        }
+        out << "\n";
+    }
+    out.flush();
+}
+
+void ApiLatencyProfiler::destroyAll() {
+    std::lock_guard<std::mutex> lock(apiLatencyProfilerMutex);
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        delete threads[i];
+        threads[i] = nullptr;
+    }
+    threadsCount = 0;
+    generation++;
+}
 } // namespace NEO
@@ -1,14 +1,17 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/timer_util.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <memory>
 #include <sstream>
@@ -97,6 +100,63 @@ class PerfProfiler {
     std::vector<SystemLog> systemLogs;
 };
 
+// Always-on counterpart of PerfProfiler: per thread call counts and log2 latency histograms of API functions.
+// Hot path only updates thread owned counters, histograms of all threads are summed on query and dumped at exit.
+class ApiLatencyProfiler {
+  public:
+    static constexpr uint32_t maxApis = 256;
+    // bucket i counts latencies in [2^i, 2^(i+1)) ns, last bucket also takes longer ones
+    static constexpr uint32_t bucketsCount = 32;
+    static constexpr uint32_t maxThreads = PerfProfiler::objectsNumber;
+
+    struct ThreadData {
+        std::atomic<uint64_t> callsCount[maxApis];
+        std::atomic<uint64_t> buckets[maxApis][bucketsCount];
+    };
+
+    static uint32_t registerApi(const char *apiName);
+    static void record(uint32_t apiId, uint64_t latencyInNs);
+
+    static uint32_t getApisCount() { return apisCount.load(); }
+    static const char *getApiName(uint32_t apiId) { return apiNames[apiId]; }
+    static uint64_t getCallsCount(uint32_t apiId);
+    static uint64_t getBucketCount(uint32_t apiId, uint32_t bucket);
+    static uint32_t getThreadsCount() { return threadsCount.load(); }
+
+    static uint32_t getBucketIndex(uint64_t latencyInNs);
+    static void dump(std::ostream &out);
+    static void destroyAll();
+
+  protected:
+    static ThreadData *getThreadData();
+
+    static std::atomic<uint32_t> apisCount;
+    static const char *apiNames[maxApis];
+    static std::atomic<uint32_t> threadsCount;
+    static std::atomic<uint32_t> generation;
+    static ThreadData *threads[maxThreads];
+};
+
+struct ApiLatencyProfilerWrapper {
+    ApiLatencyProfilerWrapper(uint32_t apiId) : apiId(apiId) {
+        if (DebugManager.flags.EnableApiLatencyHistograms.get() == 1) {
+            enabled = true;
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ApiLatencyProfilerWrapper() {
+        if (enabled) {
+            auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            ApiLatencyProfiler::record(apiId, static_cast<uint64_t>(latency.count()));
+        }
+    }
+
+    std::chrono::steady_clock::time_point start;
+    uint32_t apiId;
+    bool enabled = false;
+};
+
 #if KMD_PROFILING == 1
 
 extern thread_local PerfProfiler *gPerfProfiler;
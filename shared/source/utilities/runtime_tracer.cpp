@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/runtime_tracer.h"
+
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+
+namespace NEO {
+
+std::atomic<uint32_t> RuntimeTracer::threadsCount(0);
+std::atomic<uint32_t> RuntimeTracer::generation(0);
+RuntimeTracer::ThreadTrace *RuntimeTracer::threads[RuntimeTracer::maxThreads] = {
+    nullptr,
+};
+
+namespace {
+std::mutex runtimeTracerMutex;
+thread_local RuntimeTracer::ThreadTrace *threadTrace = nullptr;
+thread_local uint32_t threadTraceGeneration = 0;
+
+struct RuntimeTracerExitDump {
+    ~RuntimeTracerExitDump() {
+        // ring buffers exist only when tracing was enabled, so debug settings are not needed at exit
+        if (RuntimeTracer::getThreadsCount() == 0) {
+            return;
+        }
+        std::ofstream traceFile("runtime_trace.json", std::ios::trunc);
+        RuntimeTracer::dump(traceFile);
+    }
+} runtimeTracerExitDump;
+} // namespace
+
+RuntimeTracer::ThreadTrace *RuntimeTracer::getThreadTrace() {
+    if (threadTrace != nullptr && threadTraceGeneration == generation.load()) {
+        return threadTrace;
+    }
+
+    std::lock_guard<std::mutex> lock(runtimeTracerMutex);
+    auto threadId = threadsCount.load();
+    if (threadId == maxThreads) {
+        return nullptr;
+    }
+    threads[threadId] = new ThreadTrace();
+    threads[threadId]->threadId = threadId + 1;
+    threadsCount = threadId + 1;
+    threadTrace = threads[threadId];
+    threadTraceGeneration = generation.load();
+    return threadTrace;
+}
+
+void RuntimeTracer::addEvent(const TraceEvent &event) {
+    auto trace = getThreadTrace();
+    if (trace == nullptr) {
+        return;
+    }
+
+    // single writer per ring, index is published after event is written
+    auto writeIndex = trace->writeIndex.load(std::memory_order_relaxed);
+    trace->events[writeIndex % ringSize] = event;
+    trace->writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+void RuntimeTracer::addHostInterval(const char *name, uint64_t startInNs, uint64_t durationInNs) {
+    addEvent({name, startInNs, durationInNs, 0u, 0u});
+}
+
+void RuntimeTracer::addGpuInterval(const char *name, uint64_t startInNs, uint64_t durationInNs, uint32_t engineId, uint32_t argument) {
+    addEvent({name, startInNs, durationInNs, gpuTrackBase + engineId, argument});
+}
+
+void RuntimeTracer::dump(std::ostream &out) {
+    std::lock_guard<std::mutex> lock(runtimeTracerMutex);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        auto trace = threads[i];
+        auto writeIndex = trace->writeIndex.load(std::memory_order_acquire);
+        auto eventsCount = std::min(writeIndex, static_cast<uint64_t>(ringSize));
+        for (auto index = writeIndex - eventsCount; index < writeIndex; index++) {
+            auto &event = trace->events[index % ringSize];
+            auto tid = event.track != 0 ? event.track : trace->threadId;
+            out << (first ? "\n" : ",\n");
+            out << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                << ",\"ts\":" << event.startInNs / 1000 << "." << event.startInNs % 1000 / 100
+                << ",\"dur\":" << event.durationInNs / 1000 << "." << event.durationInNs % 1000 / 100;
+            if (event.track != 0) {
+                out << ",\"args\":{\"command\":" << event.argument << "}";
+            }
+            out << "}";
+            first = false;
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    out.flush();
+}
+
+void RuntimeTracer::destroyAll() {
+    std::lock_guard<std::mutex> lock(runtimeTracerMutex);
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        delete threads[i];
+        threads[i] = nullptr;
+    }
+    threadsCount = 0;
+    generation++;
+}
+} // namespace NEO
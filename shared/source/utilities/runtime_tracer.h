@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace NEO {
+
+// Host side intervals of runtime internals (enqueue, flush, submission, residency, waits) and GPU execution intervals,
+// exported as Chrome trace event JSON, which can be opened in chrome://tracing or Perfetto UI.
+// Every thread writes to its own ring buffer, so recording takes no locks; oldest events are overwritten when ring is full.
+class RuntimeTracer {
+  public:
+    static constexpr uint32_t ringSize = 16384;
+    static constexpr uint32_t maxThreads = 4096;
+    // GPU intervals are shown on tracks separate from host threads, one per engine context
+    static constexpr uint32_t gpuTrackBase = 0x10000;
+
+    struct TraceEvent {
+        const char *name;
+        uint64_t startInNs;
+        uint64_t durationInNs;
+        uint32_t track;
+        uint32_t argument;
+    };
+
+    struct ThreadTrace {
+        std::atomic<uint64_t> writeIndex;
+        uint32_t threadId;
+        TraceEvent events[ringSize];
+    };
+
+    static bool isEnabled() {
+        return DebugManager.flags.EnableRuntimeTracing.get() == 1;
+    }
+
+    static uint64_t getTimestampInNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static void addHostInterval(const char *name, uint64_t startInNs, uint64_t durationInNs);
+    static void addGpuInterval(const char *name, uint64_t startInNs, uint64_t durationInNs, uint32_t engineId, uint32_t argument);
+
+    static uint32_t getThreadsCount() { return threadsCount.load(); }
+    static void dump(std::ostream &out);
+    static void destroyAll();
+
+  protected:
+    static void addEvent(const TraceEvent &event);
+    static ThreadTrace *getThreadTrace();
+
+    static std::atomic<uint32_t> threadsCount;
+    static std::atomic<uint32_t> generation;
+    static ThreadTrace *threads[maxThreads];
+};
+
+struct RuntimeTraceScope {
+    RuntimeTraceScope(const char *name) : name(name) {
+        if (RuntimeTracer::isEnabled()) {
+            enabled = true;
+            start = RuntimeTracer::getTimestampInNs();
+        }
+    }
+
+    ~RuntimeTraceScope() {
+        if (enabled) {
+            RuntimeTracer::addHostInterval(name, start, RuntimeTracer::getTimestampInNs() - start);
+        }
+    }
+
+    const char *name;
+    uint64_t start = 0;
+    bool enabled = false;
+};
+
+#define RUNTIME_TRACE_SCOPE(name) \
+    NEO::RuntimeTraceScope runtimeTraceScopeForSingleCall(name)
+} // namespace NEO
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
+#include "shared/source/utilities/lock_free_stack.h"
 
 #include <atomic>
 #include <cstdint>
@@ -205,9 +206,9 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
-    IDList<NodeType> freeTags;
-    IDList<NodeType> usedTags;
-    IDList<NodeType> deferredTags;
+    LockFreeStack<NodeType> freeTags;
+    LockFreeStack<NodeType> deferredTags;
+    std::atomic<size_t> usedTagsCount{0u};
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
 };
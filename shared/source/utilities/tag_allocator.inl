@@ -18,16 +18,20 @@ TagAllocator<TagType>::TagAllocator(uint32_t rootDeviceIndex, MemoryManager *mem
 
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
-    if (freeTags.peekIsEmpty()) {
+    auto node = freeTags.removeFrontOne();
+    if (!node) {
         releaseDeferredTags();
+        node = freeTags.removeFrontOne();
     }
-    auto node = freeTags.removeFrontOne().release();
     if (!node) {
         std::unique_lock<std::mutex> lock(allocatorMutex);
-        populateFreeTags();
-        node = freeTags.removeFrontOne().release();
+        node = freeTags.removeFrontOne();
+        while (!node) {
+            populateFreeTags();
+            node = freeTags.removeFrontOne();
+        }
     }
-    usedTags.pushFrontOne(*node);
+    usedTagsCount++;
     node->incRefCount();
     node->initialize();
     return node;
@@ -35,42 +39,52 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
-    auto nodeT = static_cast<NodeType *>(node);
-    auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
-    UNUSED_VARIABLE(usedNode);
-    freeTags.pushFrontOne(*nodeT);
+    DEBUG_BREAK_IF(usedTagsCount == 0u);
+    usedTagsCount--;
+    freeTags.pushFrontOne(*static_cast<NodeType *>(node));
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
-    auto nodeT = static_cast<NodeType *>(node);
-    auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(!usedNode);
-    deferredTags.pushFrontOne(*usedNode);
+    DEBUG_BREAK_IF(usedTagsCount == 0u);
+    usedTagsCount--;
+    deferredTags.pushFrontOne(*static_cast<NodeType *>(node));
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::releaseDeferredTags() {
-    IDList<NodeType, false> pendingFreeTags;
-    IDList<NodeType, false> pendingDeferredTags;
-    auto currentNode = deferredTags.detachNodes();
+    struct NodeChain {
+        NodeType *first = nullptr;
+        NodeType *last = nullptr;
+
+        void pushFront(NodeType &node) {
+            node.next = first;
+            first = &node;
+            if (last == nullptr) {
+                last = &node;
+            }
+        }
+    };
+    NodeChain pendingFreeTags;
+    NodeChain pendingDeferredTags;
 
+    // whole list is detached at once, so concurrent callers never process the same node
+    auto currentNode = deferredTags.detachNodes();
     while (currentNode != nullptr) {
         auto nextNode = currentNode->next;
         if (currentNode->canBeReleased()) {
-            pendingFreeTags.pushFrontOne(*currentNode);
+            pendingFreeTags.pushFront(*currentNode);
         } else {
-            pendingDeferredTags.pushFrontOne(*currentNode);
+            pendingDeferredTags.pushFront(*currentNode);
         }
         currentNode = nextNode;
     }
 
-    if (!pendingFreeTags.peekIsEmpty()) {
-        freeTags.splice(*pendingFreeTags.detachNodes());
+    if (pendingFreeTags.first != nullptr) {
+        freeTags.pushFrontChain(*pendingFreeTags.first, *pendingFreeTags.last);
     }
-    if (!pendingDeferredTags.peekIsEmpty()) {
-        deferredTags.splice(*pendingDeferredTags.detachNodes());
+    if (pendingDeferredTags.first != nullptr) {
+        deferredTags.pushFrontChain(*pendingDeferredTags.first, *pendingDeferredTags.last);
     }
 }
 
@@ -92,11 +106,12 @@ void TagAllocator<TagType>::populateFreeTags() {
         nodesMemory[i].tagForCpuAccess = reinterpret_cast<TagType *>(ptrOffset(graphicsAllocation->getUnderlyingBuffer(), tagOffset));
         nodesMemory[i].gpuAddress = graphicsAllocation->getGpuAddress() + tagOffset;
         nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
-
-        freeTags.pushTailOne(nodesMemory[i]);
+        nodesMemory[i].next = (i + 1 < tagCount) ? &nodesMemory[i + 1] : nullptr;
     }
 
+    auto nodes = nodesMemory.get();
     tagPoolMemory.push_back(std::move(nodesMemory));
+    freeTags.pushFrontChain(nodes[0], nodes[tagCount - 1]);
 }
 
 template <typename TagType>
@@ -8,18 +8,57 @@
 #include "shared/source/utilities/wait_util.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include <algorithm>
+#include <chrono>
 
 namespace NEO {
 
 namespace WaitUtils {
 
 uint32_t waitCount = defaultWaitCount;
+int64_t spinMicroseconds = defaultSpinMicroseconds;
+WaitPolicy defaultWaitPolicy = WaitPolicy::spin;
+
+WaitStage getWaitStage(WaitPolicy policy, int64_t elapsedMicroseconds) {
+    if (policy == WaitPolicy::spin || elapsedMicroseconds < spinMicroseconds) {
+        return WaitStage::spin;
+    }
+    if (elapsedMicroseconds < spinMicroseconds + monitorWaitMicroseconds &&
+        CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureWaitpkg)) {
+        return WaitStage::monitorWait;
+    }
+    return WaitStage::sleep;
+}
+
+void waitWithPolicy(WaitPolicy policy, volatile void *monitorAddress, int64_t elapsedMicroseconds) {
+    auto stage = getWaitStage(policy, elapsedMicroseconds);
+    if (stage == WaitStage::monitorWait && monitorAddress != nullptr) {
+        if (CpuIntrinsics::umwait(monitorAddress, monitorWaitTimestampCounterDelta)) {
+            return;
+        }
+        stage = WaitStage::sleep;
+    }
+    if (stage == WaitStage::sleep) {
+        auto sleepTime = std::min(std::max(elapsedMicroseconds / 8, static_cast<int64_t>(1)), maxSleepMicroseconds);
+        std::this_thread::sleep_for(std::chrono::microseconds(sleepTime));
+        return;
+    }
+    waitFunction(nullptr, 0u);
+}
 
 void init() {
     int32_t overrideWaitCount = DebugManager.flags.WaitLoopCount.get();
     if (overrideWaitCount != -1) {
         waitCount = static_cast<uint32_t>(overrideWaitCount);
     }
+    if (DebugManager.flags.HostWaitPolicy.get() != -1) {
+        defaultWaitPolicy = static_cast<WaitPolicy>(DebugManager.flags.HostWaitPolicy.get());
+    }
+    if (DebugManager.flags.HostWaitSpinMicroseconds.get() != -1) {
+        spinMicroseconds = static_cast<int64_t>(DebugManager.flags.HostWaitSpinMicroseconds.get());
+    }
 }
 
 } // namespace WaitUtils
@@ -15,8 +15,25 @@ namespace NEO {
 
 namespace WaitUtils {
 
+enum class WaitPolicy : int32_t {
+    spin = 0,
+    spinThenSleep = 1
+};
+
+enum class WaitStage : uint32_t {
+    spin,
+    monitorWait,
+    sleep
+};
+
 constexpr uint32_t defaultWaitCount = 1u;
+constexpr int64_t defaultSpinMicroseconds = 50;
+constexpr int64_t monitorWaitMicroseconds = 1000;
+constexpr uint64_t monitorWaitTimestampCounterDelta = 100000u;
+constexpr int64_t maxSleepMicroseconds = 1000;
 extern uint32_t waitCount;
+extern int64_t spinMicroseconds;
+extern WaitPolicy defaultWaitPolicy;
 
 inline bool waitFunction(volatile uint32_t *pollAddress, uint32_t expectedValue) {
     for (uint32_t i = 0; i < waitCount; i++) {
@@ -31,6 +48,11 @@ inline bool waitFunction(volatile uint32_t *pollAddress, uint32_t expectedValue)
     return false;
 }
 
+WaitStage getWaitStage(WaitPolicy policy, int64_t elapsedMicroseconds);
+
+// spins first, then waits on monitorAddress with umwait if available, finally sleeps with growing intervals
+void waitWithPolicy(WaitPolicy policy, volatile void *monitorAddress, int64_t elapsedMicroseconds);
+
 void init();
 } // namespace WaitUtils
 
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+WorkerPool::WorkerPool(size_t maxWorkers) : WorkerPool(maxWorkers, 0u) {
+}
+
+WorkerPool::WorkerPool(size_t maxWorkers, uint64_t cpuAffinityMask) : maxWorkers(std::max(maxWorkers, static_cast<size_t>(1))),
+                                                                      cpuAffinityMask(cpuAffinityMask) {
+    // event callbacks unblock application threads, builds may keep workers busy for long time
+    clientQueues[static_cast<size_t>(WorkerPoolClient::EventCallbacks)].priority = 0;
+    clientQueues[static_cast<size_t>(WorkerPoolClient::Generic)].priority = 1;
+    clientQueues[static_cast<size_t>(WorkerPoolClient::Build)].priority = 2;
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    condition.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+void WorkerPool::enqueue(WorkerPoolClient client, Task &&task) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &clientQueue = clientQueues[static_cast<size_t>(client)];
+    clientQueue.tasks.push_back({nextSequenceNumber++, std::move(task)});
+    clientQueue.statistics.enqueuedTasks++;
+    clientQueue.statistics.queueDepth = clientQueue.tasks.size();
+    clientQueue.statistics.maxQueueDepth = std::max(clientQueue.statistics.maxQueueDepth, clientQueue.tasks.size());
+    queuedTasks++;
+    if (idleWorkers < queuedTasks && workers.size() < maxWorkers) {
+        workers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+        if (cpuAffinityMask != 0u) {
+            workers.back()->setAffinityMask(cpuAffinityMask);
+        }
+    }
+    condition.notify_one();
+}
+
+void WorkerPool::setClientPriority(WorkerPoolClient client, int32_t priority) {
+    std::lock_guard<std::mutex> lock(mtx);
+    clientQueues[static_cast<size_t>(client)].priority = priority;
+}
+
+void WorkerPool::waitForClientTasks(WorkerPoolClient client) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto &clientQueue = clientQueues[static_cast<size_t>(client)];
+    clientTasksFinishedCondition.wait(lock, [&]() { return clientQueue.tasks.empty() && clientQueue.runningTasks == 0u; });
+}
+
+WorkerPool::ClientStatistics WorkerPool::getClientStatistics(WorkerPoolClient client) {
+    std::lock_guard<std::mutex> lock(mtx);
+    return clientQueues[static_cast<size_t>(client)].statistics;
+}
+
+size_t WorkerPool::getWorkersCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return workers.size();
+}
+
+WorkerPool::ClientQueue *WorkerPool::selectClientQueue() {
+    // called with mtx acquired
+    ClientQueue *selectedQueue = nullptr;
+    for (auto &clientQueue : clientQueues) {
+        if (clientQueue.tasks.empty()) {
+            continue;
+        }
+        if (selectedQueue == nullptr || clientQueue.priority < selectedQueue->priority ||
+            (clientQueue.priority == selectedQueue->priority && clientQueue.tasks.front().sequenceNumber < selectedQueue->tasks.front().sequenceNumber)) {
+            selectedQueue = &clientQueue;
+        }
+    }
+    return selectedQueue;
+}
+
+void *WorkerPool::run(void *arg) {
+    auto workerPool = reinterpret_cast<WorkerPool *>(arg);
+    std::unique_lock<std::mutex> lock(workerPool->mtx);
+    while (true) {
+        if (workerPool->queuedTasks == 0u) {
+            if (workerPool->stopping) {
+                break;
+            }
+            workerPool->idleWorkers++;
+            workerPool->condition.wait(lock, [&]() { return workerPool->queuedTasks != 0u || workerPool->stopping; });
+            workerPool->idleWorkers--;
+            continue;
+        }
+
+        auto clientQueue = workerPool->selectClientQueue();
+        auto task = std::move(clientQueue->tasks.front().task);
+        clientQueue->tasks.pop_front();
+        clientQueue->statistics.queueDepth = clientQueue->tasks.size();
+        clientQueue->runningTasks++;
+        workerPool->queuedTasks--;
+        lock.unlock();
+        task();
+        lock.lock();
+        clientQueue->runningTasks--;
+        clientQueue->statistics.executedTasks++;
+        if (clientQueue->tasks.empty() && clientQueue->runningTasks == 0u) {
+            workerPool->clientTasksFinishedCondition.notify_all();
+        }
+    }
+    return nullptr;
+}
+} // namespace NEO
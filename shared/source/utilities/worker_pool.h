@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+enum class WorkerPoolClient : uint32_t {
+    Generic = 0,
+    Build,
+    EventCallbacks,
+    Count
+};
+
+// Threads are created on demand, up to maxWorkers, when no idle worker can pick up enqueued task.
+// Each client has its own queue, idle worker picks task of client with highest priority (lowest value),
+// clients with equal priority are served in enqueue order.
+// Destructor waits until all enqueued tasks are finished.
+class WorkerPool : NonCopyableOrMovableClass {
+  public:
+    using Task = std::function<void()>;
+
+    struct ClientStatistics {
+        uint64_t enqueuedTasks = 0u;
+        uint64_t executedTasks = 0u;
+        size_t queueDepth = 0u;
+        size_t maxQueueDepth = 0u;
+    };
+
+    WorkerPool(size_t maxWorkers);
+    WorkerPool(size_t maxWorkers, uint64_t cpuAffinityMask);
+    ~WorkerPool();
+
+    void enqueue(Task &&task) { enqueue(WorkerPoolClient::Generic, std::move(task)); }
+    void enqueue(WorkerPoolClient client, Task &&task);
+
+    void setClientPriority(WorkerPoolClient client, int32_t priority);
+    // must not be called from task of the same client
+    void waitForClientTasks(WorkerPoolClient client);
+    ClientStatistics getClientStatistics(WorkerPoolClient client);
+
+    size_t getWorkersCount();
+
+  protected:
+    struct QueuedTask {
+        uint64_t sequenceNumber;
+        Task task;
+    };
+    struct ClientQueue {
+        std::deque<QueuedTask> tasks;
+        ClientStatistics statistics;
+        int32_t priority = 0;
+        size_t runningTasks = 0u;
+    };
+
+    static void *run(void *arg);
+    ClientQueue *selectClientQueue();
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::array<ClientQueue, static_cast<size_t>(WorkerPoolClient::Count)> clientQueues;
+    std::mutex mtx;
+    std::condition_variable condition;
+    std::condition_variable clientTasksFinishedCondition;
+    size_t maxWorkers = 1;
+    size_t idleWorkers = 0;
+    size_t queuedTasks = 0;
+    uint64_t nextSequenceNumber = 0;
+    uint64_t cpuAffinityMask = 0;
+    bool stopping = false;
+};
+} // namespace NEO
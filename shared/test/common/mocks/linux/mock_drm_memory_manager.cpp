@@ -21,6 +21,9 @@ off_t lseekReturn = 4096u;
 std::atomic<int> lseekCalledCount(0);
 int closeInputFd = 0;
 std::atomic<int> closeCalledCount(0);
+int fstatReturn = -1;
+ino_t fstatInode = 0;
+std::atomic<int> fstatCalledCount(0);
 std::vector<void *> mmapVector(64);
 
 TestedDrmMemoryManager::TestedDrmMemoryManager(ExecutionEnvironment &executionEnvironment) : MemoryManagerCreate(gemCloseWorkerMode::gemCloseWorkerInactive,
@@ -31,10 +34,14 @@ TestedDrmMemoryManager::TestedDrmMemoryManager(ExecutionEnvironment &executionEn
     this->munmapFunction = &munmapMock;
     this->lseekFunction = &lseekMock;
     this->closeFunction = &closeMock;
+    this->fstatFunction = &fstatMock;
     lseekReturn = 4096;
     lseekCalledCount = 0;
     closeInputFd = 0;
     closeCalledCount = 0;
+    fstatReturn = -1;
+    fstatInode = 0;
+    fstatCalledCount = 0;
     hostPtrManager.reset(new MockHostPtrManager);
 };
 
@@ -50,10 +57,14 @@ TestedDrmMemoryManager::TestedDrmMemoryManager(bool enableLocalMemory,
     this->munmapFunction = &munmapMock;
     this->lseekFunction = &lseekMock;
     this->closeFunction = &closeMock;
+    this->fstatFunction = &fstatMock;
     lseekReturn = 4096;
     lseekCalledCount = 0;
     closeInputFd = 0;
     closeCalledCount = 0;
+    fstatReturn = -1;
+    fstatInode = 0;
+    fstatCalledCount = 0;
 }
 
 void TestedDrmMemoryManager::injectPinBB(BufferObject *newPinBB, uint32_t rootDeviceIndex) {
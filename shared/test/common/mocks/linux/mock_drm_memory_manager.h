@@ -17,6 +17,9 @@ extern off_t lseekReturn;
 extern std::atomic<int> lseekCalledCount;
 extern int closeInputFd;
 extern std::atomic<int> closeCalledCount;
+extern int fstatReturn;
+extern ino_t fstatInode;
+extern std::atomic<int> fstatCalledCount;
 extern std::vector<void *> mmapVector;
 
 inline void *mmapMock(void *addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept {
@@ -54,6 +57,11 @@ inline int closeMock(int fd) {
     closeCalledCount++;
     return 0;
 }
+inline int fstatMock(int fd, struct stat *buf) noexcept {
+    fstatCalledCount++;
+    buf->st_ino = fstatInode;
+    return fstatReturn;
+}
 
 class ExecutionEnvironment;
 class BufferObject;
@@ -80,9 +88,11 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::getUserptrAlignment;
     using DrmMemoryManager::gfxPartitions;
     using DrmMemoryManager::lockResourceInLocalMemoryImpl;
+    using DrmMemoryManager::madviseFunction;
     using DrmMemoryManager::memoryForPinBBs;
     using DrmMemoryManager::mmapFunction;
     using DrmMemoryManager::munmapFunction;
+    using DrmMemoryManager::numaNodes;
     using DrmMemoryManager::pinBBs;
     using DrmMemoryManager::pinThreshold;
     using DrmMemoryManager::pushSharedBufferObject;
@@ -19,6 +19,7 @@
 
 #include "gmock/gmock.h"
 
+#include <atomic>
 #include <vector>
 
 using namespace NEO;
@@ -105,7 +106,13 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
 
     GraphicsAllocation *getClearColorAllocation() override { return nullptr; }
 
+    bool stopDirectSubmissionIfIdle(std::chrono::steady_clock::time_point now) override {
+        stopDirectSubmissionIfIdleCalled++;
+        return false;
+    }
+
     std::vector<char> instructionHeapReserveredData;
+    std::atomic<uint32_t> stopDirectSubmissionIfIdleCalled{0u};
     int *flushBatchedSubmissionsCallCounter = nullptr;
     uint32_t waitForCompletionWithTimeoutCalled = 0;
     uint32_t mockTagAddress = 0;
@@ -43,6 +43,8 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::getSizeStartSection;
     using BaseClass::getSizeSwitchRingBufferSection;
     using BaseClass::hwInfo;
+    using BaseClass::idleTimeout;
+    using BaseClass::lastDispatchTime;
     using BaseClass::osContext;
     using BaseClass::performDiagnosticMode;
     using BaseClass::ringBuffer;
@@ -54,6 +56,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::semaphorePtr;
     using BaseClass::semaphores;
     using BaseClass::setReturnAddress;
+    using BaseClass::statistics;
     using BaseClass::stopRingBuffer;
     using BaseClass::switchRingBuffersAllocations;
     using BaseClass::workloadMode;
@@ -52,6 +52,9 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     uint32_t getNumThreadsPerThreadGroup() const override {
         return 1;
     }
+    DispatchKernelTemplate *getDispatchTemplate() override {
+        return dispatchTemplate;
+    }
     void expectAnyMockFunctionCall();
 
     ::testing::NiceMock<MockGraphicsAllocation> mockAllocation;
@@ -64,5 +67,6 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     uint32_t groupSizes[3];
     bool localIdGenerationByRuntime = true;
     uint32_t requiredWalkGroupOrder = 0x0u;
+    DispatchKernelTemplate *dispatchTemplate = nullptr;
 };
 } // namespace NEO
@@ -9,6 +9,7 @@
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
@@ -177,6 +178,49 @@ TEST_F(CommandContainerTest, givenHeapAllocationsWhenDestroyCommandContainerThen
     EXPECT_TRUE(status);
 }
 
+TEST_F(CommandContainerTest, givenCmdBufferAllocationWhenDestroyCommandContainerThenCmdBufferAllocationIsReused) {
+    std::unique_ptr<CommandContainer> cmdContainer(new CommandContainer);
+    cmdContainer->initialize(pDevice);
+    auto cmdBufferAllocation = cmdContainer->getCmdBufferAllocations()[0];
+
+    cmdContainer.reset(new CommandContainer);
+    cmdContainer->initialize(pDevice);
+    ASSERT_EQ(1u, cmdContainer->getCmdBufferAllocations().size());
+    EXPECT_EQ(cmdBufferAllocation, cmdContainer->getCmdBufferAllocations()[0]);
+    EXPECT_EQ(cmdBufferAllocation, cmdContainer->getCommandStream()->getGraphicsAllocation());
+}
+
+TEST_F(CommandContainerTest, givenCmdBufferReleasedOnResetWhenAllocatingNextCmdBufferThenReleasedAllocationIsReused) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    cmdContainer.allocateNextCommandBuffer();
+    auto secondCmdBuffer = cmdContainer.getCmdBufferAllocations()[1];
+
+    cmdContainer.reset();
+    ASSERT_EQ(1u, cmdContainer.getCmdBufferAllocations().size());
+
+    cmdContainer.allocateNextCommandBuffer();
+    ASSERT_EQ(2u, cmdContainer.getCmdBufferAllocations().size());
+    EXPECT_EQ(secondCmdBuffer, cmdContainer.getCmdBufferAllocations()[1]);
+}
+
+HWTEST_F(CommandContainerTest, givenCmdBufferStillUsedByGpuWhenAllocatingNextCmdBufferThenNewAllocationIsCreated) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    cmdContainer.allocateNextCommandBuffer();
+    auto secondCmdBuffer = cmdContainer.getCmdBufferAllocations()[1];
+
+    auto tagValue = *csr.getTagAddress();
+    csr.taskCount = tagValue + 1;
+    cmdContainer.reset();
+
+    cmdContainer.allocateNextCommandBuffer();
+    ASSERT_EQ(2u, cmdContainer.getCmdBufferAllocations().size());
+    EXPECT_NE(secondCmdBuffer, cmdContainer.getCmdBufferAllocations()[1]);
+    csr.taskCount = tagValue;
+}
+
 TEST_F(CommandContainerTest, givenCommandContainerWhenResetThenStateIsReset) {
     CommandContainer cmdContainer;
     cmdContainer.initialize(pDevice);
@@ -426,6 +470,26 @@ TEST_F(CommandContainerTest, whenAllocateNextCmdBufferIsCalledThenNewAllocationI
     EXPECT_EQ(cmdContainer->getCmdBufferAllocations()[1], cmdContainer->getResidencyContainer().back());
 }
 
+TEST_F(CommandContainerTest, givenImmediateCmdListCsrWhenStoringCmdBuffersForReuseThenConsumedCmdBuffersAreRecycledThroughCsr) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    auto csr = pDevice->getDefaultEngine().commandStreamReceiver;
+    cmdContainer.setImmediateCmdListCsr(csr);
+
+    cmdContainer.getCommandStream()->getSpace(0x100);
+    auto firstCmdBuffer = cmdContainer.getCmdBufferAllocations()[0];
+    cmdContainer.allocateNextCommandBuffer();
+    EXPECT_EQ(0x100u, cmdContainer.getPreviousCmdBufferUsedSize());
+
+    cmdContainer.storeCmdBuffersForReuse(*csr->getTagAddress());
+    ASSERT_EQ(1u, cmdContainer.getCmdBufferAllocations().size());
+    EXPECT_NE(firstCmdBuffer, cmdContainer.getCmdBufferAllocations()[0]);
+
+    cmdContainer.allocateNextCommandBuffer();
+    ASSERT_EQ(2u, cmdContainer.getCmdBufferAllocations().size());
+    EXPECT_EQ(firstCmdBuffer, cmdContainer.getCmdBufferAllocations()[1]);
+}
+
 TEST_F(CommandContainerTest, whenResettingCommandContainerThenStoredCmdBuffersAreFreedAndStreamIsReplacedWithInitialBuffer) {
     std::unique_ptr<CommandContainer> cmdContainer(new CommandContainer);
     cmdContainer->initialize(pDevice);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/directory.h"
 
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "opencl/test/unit_test/global_environment.h"
@@ -19,8 +20,12 @@
 #include "opencl/test/unit_test/mocks/mock_program.h"
 #include "test.h"
 
+#include "os_inc.h"
+
 #include <array>
+#include <cstdio>
 #include <list>
+#include <map>
 #include <memory>
 
 using namespace NEO;
@@ -219,6 +224,36 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, givenSpecConstantsWhenGettingCachedFileNameThenHashDiffersPerSpecializationAndNotPerInsertionOrder) {
+    HardwareInfo hwInfo;
+    const char src[] = "spirv";
+    const char options[] = "-options";
+    const char internalOptions[] = "-internal";
+    ArrayRef<const char> srcRef(src, sizeof(src));
+    ArrayRef<const char> optionsRef(options, sizeof(options));
+    ArrayRef<const char> internalOptionsRef(internalOptions, sizeof(internalOptions));
+
+    std::unordered_map<uint32_t, uint64_t> specConstants1;
+    specConstants1[1] = 10u;
+    specConstants1[2] = 20u;
+    std::unordered_map<uint32_t, uint64_t> specConstants2;
+    specConstants2[2] = 20u;
+    specConstants2[1] = 10u;
+    std::unordered_map<uint32_t, uint64_t> specConstants3;
+    specConstants3[1] = 10u;
+    specConstants3[2] = 21u;
+
+    auto hashWithoutSpecConstants = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, internalOptionsRef);
+    auto hash1 = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, internalOptionsRef, specConstants1);
+    auto hash2 = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, internalOptionsRef, specConstants2);
+    auto hash3 = CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, internalOptionsRef, specConstants3);
+
+    EXPECT_EQ(hashWithoutSpecConstants, CompilerCache::getCachedFileName(hwInfo, srcRef, optionsRef, internalOptionsRef, {}));
+    EXPECT_NE(hashWithoutSpecConstants, hash1);
+    EXPECT_EQ(hash1, hash2);
+    EXPECT_NE(hash1, hash3);
+}
+
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     CompilerCache cache(CompilerCacheConfig{});
     bool ret = cache.cacheBinary("some_hash", nullptr, 12u);
@@ -253,6 +288,199 @@ TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoad
     EXPECT_NE(0U, size);
 }
 
+TEST(CompilerCacheTests, GivenCachedAndMissingBinariesWhenLoadingFromCacheThenHitsAndMissesAreCounted) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.memoryCacheEnabled = false;
+    CompilerCache cache(config);
+    const char data[16] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("STATISTICS_HASH", data, sizeof(data)));
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("STATISTICS_HASH", size));
+    EXPECT_EQ(sizeof(data), size);
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("----do-not-exists----", size));
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(0u, statistics.evictions);
+}
+
+TEST(CompilerCacheTests, GivenCachedBinaryWhenCachingIsFinishedThenOnlyCompleteEntryIsLeftInCacheDirectory) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".publish_test";
+    CompilerCache cache(config);
+    const char data[16] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("PUBLISH_HASH", data, sizeof(data)));
+
+    for (auto &file : Directory::getFiles(config.cacheDir)) {
+        EXPECT_EQ(std::string::npos, file.find("PUBLISH_HASH.publish_test.")) << file;
+    }
+    std::string entryPath = config.cacheDir + PATH_SEPARATOR + "PUBLISH_HASH" + config.cacheFileExtension;
+    EXPECT_EQ(0, std::remove(entryPath.c_str()));
+    std::remove((entryPath + ".lock").c_str());
+}
+
+TEST(CompilerCacheTests, GivenBinaryCachedByOneCacheWhenLoadingFromOtherCacheThenBinaryIsReturnedFromMemory) {
+    CompilerMemoryCache::getInstance().clear();
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".memory_test";
+    CompilerCache firstDeviceCache(config);
+    CompilerCache secondDeviceCache(config);
+    const char data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    EXPECT_TRUE(firstDeviceCache.cacheBinary("MEMORY_HASH", data, sizeof(data)));
+    std::string entryPath = config.cacheDir + PATH_SEPARATOR + "MEMORY_HASH" + config.cacheFileExtension;
+    EXPECT_EQ(0, std::remove(entryPath.c_str()));
+    std::remove((entryPath + ".lock").c_str());
+
+    size_t size = 0;
+    auto binary = secondDeviceCache.loadCachedBinary("MEMORY_HASH", size);
+    ASSERT_NE(nullptr, binary);
+    EXPECT_EQ(sizeof(data), size);
+    EXPECT_EQ(0, memcmp(data, binary.get(), sizeof(data)));
+    EXPECT_EQ(1u, secondDeviceCache.getStatistics().memoryHits);
+    EXPECT_EQ(0u, secondDeviceCache.getStatistics().hits);
+
+    CompilerMemoryCache::getInstance().clear();
+}
+
+TEST(CompilerCacheTests, GivenSharedCacheDirWhenBinaryIsCachedByOneProcessThenOtherProcessLoadsItFromSharedCache) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".shared_test";
+    config.memoryCacheEnabled = false;
+    config.sharedCacheDir = config.cacheDir + PATH_SEPARATOR + "shared";
+    CompilerCache publishingCache(config);
+    CompilerCache readingCache(config);
+    const char data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    EXPECT_TRUE(publishingCache.cacheBinary("SHARED_HASH", data, sizeof(data)));
+    std::string entryPath = config.cacheDir + PATH_SEPARATOR + "SHARED_HASH" + config.cacheFileExtension;
+    EXPECT_EQ(0, std::remove(entryPath.c_str()));
+    std::remove((entryPath + ".lock").c_str());
+
+    size_t size = 0;
+    auto binary = readingCache.loadCachedBinary("SHARED_HASH", size);
+    ASSERT_NE(nullptr, binary);
+    EXPECT_EQ(sizeof(data), size);
+    EXPECT_EQ(0, memcmp(data, binary.get(), sizeof(data)));
+    EXPECT_EQ(1u, readingCache.getStatistics().sharedHits);
+    EXPECT_EQ(0u, readingCache.getStatistics().hits);
+
+    std::string sharedEntryPath = config.sharedCacheDir + PATH_SEPARATOR + "SHARED_HASH" + config.cacheFileExtension;
+    EXPECT_EQ(0, std::remove(sharedEntryPath.c_str()));
+    std::remove((sharedEntryPath + ".lock").c_str());
+}
+
+TEST(CompilerCacheTests, GivenSharedCacheDirWhenBinaryIsLoadedFromDiskThenItIsPublishedToSharedCache) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".shared_publish_test";
+    config.memoryCacheEnabled = false;
+    CompilerCache diskOnlyCache(config);
+    const char data[8] = {};
+    EXPECT_TRUE(diskOnlyCache.cacheBinary("SHARED_PUBLISH_HASH", data, sizeof(data)));
+
+    config.sharedCacheDir = config.cacheDir + PATH_SEPARATOR + "shared";
+    CompilerCache cache(config);
+    size_t size = 0;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("SHARED_PUBLISH_HASH", size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary("SHARED_PUBLISH_HASH", size));
+    EXPECT_EQ(1u, cache.getStatistics().hits);
+    EXPECT_EQ(1u, cache.getStatistics().sharedHits);
+
+    for (auto &dir : {config.cacheDir, config.sharedCacheDir}) {
+        std::string entryPath = dir + PATH_SEPARATOR + "SHARED_PUBLISH_HASH" + config.cacheFileExtension;
+        EXPECT_EQ(0, std::remove(entryPath.c_str()));
+        std::remove((entryPath + ".lock").c_str());
+    }
+}
+
+TEST(CompilerMemoryCacheTests, GivenCapacityExceededWhenStoringBinaryThenLeastRecentlyUsedBinaryIsDropped) {
+    CompilerMemoryCache memoryCache(16u);
+    const char data[8] = {};
+    size_t size = 0;
+
+    memoryCache.store("FIRST_HASH", data, sizeof(data));
+    memoryCache.store("SECOND_HASH", data, sizeof(data));
+    EXPECT_NE(nullptr, memoryCache.load("FIRST_HASH", size));
+
+    memoryCache.store("THIRD_HASH", data, sizeof(data));
+    EXPECT_EQ(16u, memoryCache.getUsedSize());
+    EXPECT_EQ(nullptr, memoryCache.load("SECOND_HASH", size));
+    EXPECT_EQ(0u, size);
+    EXPECT_NE(nullptr, memoryCache.load("FIRST_HASH", size));
+    EXPECT_NE(nullptr, memoryCache.load("THIRD_HASH", size));
+}
+
+TEST(CompilerMemoryCacheTests, GivenBinaryLargerThanCapacityWhenStoringThenBinaryIsNotStored) {
+    CompilerMemoryCache memoryCache(4u);
+    const char data[8] = {};
+    size_t size = 0;
+
+    memoryCache.store("LARGE_HASH", data, sizeof(data));
+    EXPECT_EQ(0u, memoryCache.getUsedSize());
+    EXPECT_EQ(nullptr, memoryCache.load("LARGE_HASH", size));
+}
+
+class CompilerCacheWithAccessTimeMock : public CompilerCache {
+  public:
+    using CompilerCache::CompilerCache;
+
+    bool replaceFile(const std::string &sourcePath, const std::string &destinationPath) override {
+        accessTimes[getFileName(destinationPath)] = ++currentTime;
+        return CompilerCache::replaceFile(sourcePath, destinationPath);
+    }
+
+    bool getEntryInfo(const std::string &path, CacheEntry &entry) override {
+        if (!CompilerCache::getEntryInfo(path, entry)) {
+            return false;
+        }
+        entry.lastAccessTime = accessTimes[getFileName(path)];
+        return true;
+    }
+
+    void updateAccessTime(const std::string &path) override {
+        accessTimes[getFileName(path)] = ++currentTime;
+    }
+
+    static std::string getFileName(const std::string &path) {
+        return path.substr(path.find_last_of("/\\") + 1);
+    }
+
+    std::map<std::string, uint64_t> accessTimes;
+    uint64_t currentTime = 0u;
+};
+
+TEST(CompilerCacheTests, GivenCacheSizeExceededWhenCachingBinaryThenLeastRecentlyUsedEntryIsEvicted) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".eviction_test";
+    config.cacheSize = 64u;
+    config.memoryCacheEnabled = false;
+    CompilerCacheWithAccessTimeMock cache(config);
+    const char data[32] = {};
+    size_t size = 0;
+
+    EXPECT_TRUE(cache.cacheBinary("FIRST_HASH", data, sizeof(data)));
+    EXPECT_TRUE(cache.cacheBinary("SECOND_HASH", data, sizeof(data)));
+    EXPECT_NE(nullptr, cache.loadCachedBinary("FIRST_HASH", size));
+    EXPECT_EQ(0u, cache.getStatistics().evictions);
+
+    EXPECT_TRUE(cache.cacheBinary("THIRD_HASH", data, sizeof(data)));
+    EXPECT_EQ(1u, cache.getStatistics().evictions);
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("SECOND_HASH", size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary("FIRST_HASH", size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary("THIRD_HASH", size));
+
+    for (auto hash : {"FIRST_HASH", "THIRD_HASH"}) {
+        std::string entryPath = config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension;
+        std::remove(entryPath.c_str());
+        std::remove((entryPath + ".lock").c_str());
+    }
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -306,6 +534,7 @@ TEST(CompilerInterfaceCachedTests, GivenCachedBinaryWhenBuildingThenSuccessIsRet
     MockDevice device;
     auto err = compilerInterface->build(device, inputArgs, translationOutput);
     EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_TRUE(translationOutput.deviceBinaryLoadedFromCache);
 
     gEnvironment->fclPopDebugVars();
     gEnvironment->igcPopDebugVars();
@@ -30,6 +30,15 @@ struct WhiteBox<NEO::LinkerInput> : NEO::LinkerInput {
     using BaseClass::valid;
 };
 
+template <>
+struct WhiteBox<NEO::Linker> : NEO::Linker {
+    using BaseClass = NEO::Linker;
+    using BaseClass::BaseClass;
+
+    using BaseClass::minRelocationsForParallelPatching;
+    using BaseClass::relocatedSymbolsById;
+};
+
 template <typename MockT, typename ReturnT, typename... ArgsT>
 struct LightMockConfig {
     using MockReturnT = ReturnT;
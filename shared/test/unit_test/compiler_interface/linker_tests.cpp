@@ -930,6 +930,97 @@ TEST(LinkerTests, givenUnresolvedExternalWhenPatchingInstructionsThenLinkPartial
     EXPECT_EQ(std::string(entry.r_symbol), std::string(unresolvedExternals[0].unresolvedRelocation.symbolName));
 }
 
+TEST(LinkerInputTests, givenRelocationsInInstructionSegmentsWhenGettingResolvedRelocationsThenSymbolNamesAreResolvedOnce) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.symbols["A"] = NEO::SymbolInfo{0, 8, NEO::SegmentType::GlobalVariables};
+    linkerInput.symbols["B"] = NEO::SymbolInfo{8, 8, NEO::SegmentType::GlobalConstants};
+
+    NEO::LinkerInput::RelocationInfo relocA, relocB, relocC;
+    relocA.symbolName = "A";
+    relocB.symbolName = "B";
+    relocC.symbolName = "C";
+    linkerInput.relocations.push_back({relocA, relocC});
+    linkerInput.relocations.push_back({relocB});
+
+    auto &resolvedRelocations = linkerInput.getResolvedRelocations();
+    ASSERT_EQ(2U, resolvedRelocations.symbols.size());
+    ASSERT_EQ(2U, resolvedRelocations.symbolIdsPerInstSegment.size());
+    EXPECT_EQ(3U, resolvedRelocations.relocationsCount);
+
+    ASSERT_EQ(2U, resolvedRelocations.symbolIdsPerInstSegment[0].size());
+    auto symbolAId = resolvedRelocations.symbolIdsPerInstSegment[0][0];
+    ASSERT_NE(NEO::LinkerInput::ResolvedRelocations::unresolvedSymbolId, symbolAId);
+    EXPECT_EQ("A", resolvedRelocations.symbols[symbolAId]->first);
+    EXPECT_EQ(NEO::LinkerInput::ResolvedRelocations::unresolvedSymbolId, resolvedRelocations.symbolIdsPerInstSegment[0][1]);
+
+    ASSERT_EQ(1U, resolvedRelocations.symbolIdsPerInstSegment[1].size());
+    auto symbolBId = resolvedRelocations.symbolIdsPerInstSegment[1][0];
+    ASSERT_NE(NEO::LinkerInput::ResolvedRelocations::unresolvedSymbolId, symbolBId);
+    EXPECT_EQ("B", resolvedRelocations.symbols[symbolBId]->first);
+
+    EXPECT_EQ(&resolvedRelocations, &linkerInput.getResolvedRelocations());
+}
+
+TEST(LinkerInputTests, givenResolvedRelocationsWhenDecodingRelocationTableThenRelocationsAreResolvedAgain) {
+    NEO::LinkerInput linkerInput;
+    vISA::GenRelocEntry entry = {};
+    entry.r_symbol[0] = 'A';
+    entry.r_offset = 8;
+    entry.r_type = vISA::GenRelocType::R_SYM_ADDR;
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(&entry, 1, 0));
+    EXPECT_EQ(1U, linkerInput.getResolvedRelocations().relocationsCount);
+
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(&entry, 1, 1));
+    EXPECT_EQ(2U, linkerInput.getResolvedRelocations().relocationsCount);
+}
+
+TEST(LinkerTests, givenManyInstructionSegmentsWhenPatchingInParallelThenAllSegmentsArePatchedAndUnresolvedExternalsAreReportedInSegmentOrder) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    linkerInput.symbols["A"] = NEO::SymbolInfo{16, 8, NEO::SegmentType::GlobalVariables};
+
+    constexpr uint32_t segmentsCount = 8;
+    NEO::LinkerInput::RelocationInfo resolvedReloc, unresolvedReloc;
+    resolvedReloc.symbolName = "A";
+    resolvedReloc.offset = 0;
+    resolvedReloc.type = NEO::LinkerInput::RelocationInfo::Type::Address;
+    unresolvedReloc.symbolName = "B";
+    unresolvedReloc.offset = 8;
+    unresolvedReloc.type = NEO::LinkerInput::RelocationInfo::Type::Address;
+    for (uint32_t segmentId = 0; segmentId < segmentsCount; segmentId++) {
+        linkerInput.relocations.push_back({resolvedReloc});
+        if (segmentId % 2) {
+            linkerInput.relocations.back().push_back(unresolvedReloc);
+        }
+    }
+
+    std::vector<std::vector<char>> instructionSegments(segmentsCount, std::vector<char>(16, 0));
+    NEO::Linker::PatchableSegments patchableInstructionSegments;
+    for (auto &instructionSegment : instructionSegments) {
+        patchableInstructionSegments.push_back({instructionSegment.data(), instructionSegment.size()});
+    }
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.minRelocationsForParallelPatching = 0;
+    NEO::Linker::SegmentInfo globalVar, globalConst, exportedFunc;
+    globalVar.gpuAddress = 0x1000;
+    globalVar.segmentSize = 64;
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    auto linkResult = linker.link(globalVar, globalConst, exportedFunc,
+                                  nullptr, nullptr, patchableInstructionSegments,
+                                  unresolvedExternals, nullptr, nullptr, nullptr);
+    EXPECT_EQ(NEO::LinkingStatus::LinkedPartially, linkResult);
+
+    for (auto &instructionSegment : instructionSegments) {
+        EXPECT_EQ(globalVar.gpuAddress + 16, *reinterpret_cast<uintptr_t *>(instructionSegment.data()));
+    }
+    ASSERT_EQ(segmentsCount / 2, unresolvedExternals.size());
+    for (uint32_t i = 0; i < unresolvedExternals.size(); i++) {
+        EXPECT_EQ(2 * i + 1, unresolvedExternals[i].instructionsSegmentId);
+        EXPECT_EQ("B", unresolvedExternals[i].unresolvedRelocation.symbolName);
+    }
+}
+
 TEST(LinkerTests, givenValidSymbolsAndRelocationsThenInstructionSegmentsAreProperlyPatched) {
     NEO::LinkerInput linkerInput;
 
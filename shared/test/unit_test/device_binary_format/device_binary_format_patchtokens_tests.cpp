@@ -154,3 +154,31 @@ TEST(DecodeSingleDeviceBinaryPatchtokens, GivenValidBinaryThenOutputIsProperlyPo
     EXPECT_TRUE(decodeErrors.empty());
     ASSERT_EQ(1U, programInfo.kernelInfos.size());
 }
+
+TEST(DecodeSingleDeviceBinaryPatchtokens, GivenTrustedBinaryThenValidationIsSkippedButDecodeErrorsAreReported) {
+    PatchTokensTestData::ValidProgramWithConstantSurface programTokens;
+    std::vector<uint8_t> constantSurfaceToken(programTokens.storage.begin() + sizeof(*programTokens.headerMutable), programTokens.storage.end());
+    programTokens.storage.insert(programTokens.storage.end(), constantSurfaceToken.begin(), constantSurfaceToken.end());
+    programTokens.recalcTokPtr();
+
+    NEO::ProgramInfo programInfo;
+    NEO::SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = programTokens.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(programInfo, singleBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::UnhandledBinary, error);
+
+    NEO::ProgramInfo trustedProgramInfo;
+    singleBinary.trusted = true;
+    decodeErrors.clear();
+    error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(trustedProgramInfo, singleBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::Success, error);
+    EXPECT_TRUE(decodeErrors.empty());
+
+    NEO::SingleDeviceBinary invalidBinary;
+    invalidBinary.trusted = true;
+    error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(trustedProgramInfo, invalidBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, error);
+    EXPECT_STREQ("ProgramFromPatchtokens wasn't successfully decoded", decodeErrors.c_str());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -653,6 +653,38 @@ TEST(YamlTokenize, GivenCommentThenTokenizeTillEndOfLineAsOneToken) {
     }
 }
 
+TEST(YamlCountLines, GivenTextThenReturnsNumberOfLinesIncludingUnterminatedLastLine) {
+    EXPECT_EQ(0U, NEO::Yaml::countLines(""));
+    EXPECT_EQ(1U, NEO::Yaml::countLines("a : b"));
+    EXPECT_EQ(1U, NEO::Yaml::countLines("a : b\n"));
+    EXPECT_EQ(2U, NEO::Yaml::countLines("a : b\nc : d"));
+    EXPECT_EQ(3U, NEO::Yaml::countLines("\n\n\n"));
+}
+
+TEST(YamlTokenize, GivenTextExceedingCachesStackCapacityThenReservesSpaceUpFrontAndTokenizesAllLines) {
+    std::string yaml;
+    constexpr size_t numEntries = 1024;
+    for (size_t i = 0; i < numEntries; ++i) {
+        yaml += "key" + std::to_string(i) + " : value # comment\n";
+    }
+
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_TRUE(warnings.empty()) << warnings;
+
+    EXPECT_LE(numEntries, lines.capacity());
+    EXPECT_LE(numEntries * NEO::Yaml::estimatedTokensPerLine, tokens.capacity());
+    ASSERT_EQ(numEntries, lines.size());
+    ASSERT_EQ(numEntries * 6, tokens.size());
+    EXPECT_EQ(Token(" comment", NEO::Yaml::Token::Comment), tokens[tokens.size() - 2]);
+    EXPECT_EQ(Token("\n", NEO::Yaml::Token::SingleCharacter), tokens[tokens.size() - 1]);
+}
+
 TEST(YamlTokenize, GivenEmptyCommentMarkerThenDontCreateEmptyComment) {
     ConstStringRef yaml = "orange : green #\n";
 
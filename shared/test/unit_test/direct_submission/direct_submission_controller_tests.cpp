@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/direct_submission_controller.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "test.h"
+
+using namespace NEO;
+
+struct DirectSubmissionControllerMock : public DirectSubmissionController {
+    using DirectSubmissionController::checkNewSubmissions;
+    using DirectSubmissionController::directSubmissionControllingThread;
+    using DirectSubmissionController::directSubmissions;
+    using DirectSubmissionController::directSubmissionsMutex;
+    using DirectSubmissionController::idleTimeout;
+    using DirectSubmissionController::keepControlling;
+};
+
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegisteringCsrThenControllingThreadIsStartedAndCsrIsChecked) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionIdleTimeout.set(1000000);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+
+    DirectSubmissionControllerMock controller;
+    EXPECT_EQ(1000000, controller.idleTimeout.count());
+    EXPECT_EQ(nullptr, controller.directSubmissionControllingThread.get());
+
+    controller.registerDirectSubmission(&csr);
+    EXPECT_NE(nullptr, controller.directSubmissionControllingThread.get());
+    EXPECT_TRUE(controller.keepControlling);
+
+    {
+        std::lock_guard<std::mutex> lock(controller.directSubmissionsMutex);
+        EXPECT_EQ(1u, controller.directSubmissions.size());
+        controller.checkNewSubmissions(std::chrono::steady_clock::now());
+    }
+    EXPECT_LE(1u, csr.stopDirectSubmissionIfIdleCalled.load());
+
+    controller.unregisterDirectSubmission(&csr);
+    std::lock_guard<std::mutex> lock(controller.directSubmissionsMutex);
+    EXPECT_TRUE(controller.directSubmissions.empty());
+}
+
+TEST(DirectSubmissionControllerTests, givenIdleTimeoutDisabledWhenRegisteringCsrThenControllingThreadIsNotStarted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionIdleTimeout.set(0);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+
+    DirectSubmissionControllerMock controller;
+    controller.registerDirectSubmission(&csr);
+    EXPECT_EQ(nullptr, controller.directSubmissionControllingThread.get());
+    EXPECT_TRUE(controller.directSubmissions.empty());
+}
+
+TEST(DirectSubmissionControllerTests, givenExecutionEnvironmentWhenGettingDirectSubmissionControllerThenSameControllerIsReturned) {
+    MockExecutionEnvironment executionEnvironment;
+    auto controller = executionEnvironment.getDirectSubmissionController();
+    EXPECT_NE(nullptr, controller);
+    EXPECT_EQ(controller, executionEnvironment.getDirectSubmissionController());
+}
@@ -806,15 +806,15 @@ HWTEST_F(DirectSubmissionDispatchBufferTest,
     GraphicsAllocation *oldRingAllocation = directSubmission.ringCommandStream.getGraphicsAllocation();
     directSubmission.ringCommandStream.getSpace(directSubmission.ringCommandStream.getAvailableSpace() -
                                                 directSubmission.getSizeSwitchRingBufferSection());
-    uint64_t submitGpuVa = oldRingAllocation->getGpuAddress() + directSubmission.ringCommandStream.getUsed();
 
     ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
     EXPECT_TRUE(ret);
     EXPECT_NE(oldRingAllocation, directSubmission.ringCommandStream.getGraphicsAllocation());
+    uint64_t submitGpuVa = directSubmission.ringCommandStream.getGraphicsAllocation()->getGpuAddress();
     EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
     EXPECT_EQ(2u, directSubmission.currentQueueWorkCount);
     EXPECT_EQ(1u, directSubmission.submitCount);
-    size_t submitSize = directSubmission.getSizeSwitchRingBufferSection();
+    size_t submitSize = directSubmission.getSizeDispatch();
     EXPECT_EQ(submitSize, directSubmission.submitSize);
     EXPECT_EQ(submitGpuVa, directSubmission.submitGpuAddress);
     EXPECT_EQ(1u, directSubmission.handleResidencyCount);
@@ -823,6 +823,123 @@ HWTEST_F(DirectSubmissionDispatchBufferTest,
     EXPECT_TRUE(directSubmission.ringStart);
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenMultipleBatchBuffersWhenDispatchingCommandBuffersThenBuffersAreChainedWithSingleSemaphoreUpdate) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+    size_t usedBeforeDispatch = directSubmission.ringCommandStream.getUsed();
+    uint64_t chainedStartGpuVa = directSubmission.ringCommandStream.getGraphicsAllocation()->getGpuAddress() + usedBeforeDispatch +
+                                 directSubmission.getSizeStartSection();
+
+    uint8_t secondBbStart[64];
+    BatchBuffer secondBatchBuffer = batchBuffer;
+    secondBatchBuffer.endCmdPtr = &secondBbStart[0];
+    secondBatchBuffer.startOffset = 0x40;
+    BatchBuffer *batchBuffers[] = {&batchBuffer, &secondBatchBuffer};
+
+    ret = directSubmission.dispatchCommandBuffers(batchBuffers, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(2u, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(1u, directSubmission.getStatistics().submissions);
+    EXPECT_EQ(1u, directSubmission.getStatistics().coalescedBatchBuffers);
+
+    size_t expectedDispatchSize = directSubmission.getSizeDispatch() + directSubmission.getSizeStartSection();
+    EXPECT_EQ(usedBeforeDispatch + expectedDispatchSize, directSubmission.ringCommandStream.getUsed());
+
+    auto firstReturn = reinterpret_cast<MI_BATCH_BUFFER_START *>(&bbStart[0]);
+    EXPECT_EQ(chainedStartGpuVa, firstReturn->getBatchBufferStartAddressGraphicsaddress472());
+
+    HardwareParse hwParse;
+    hwParse.parseCommands<FamilyType>(directSubmission.ringCommandStream, usedBeforeDispatch);
+    auto bbStarts = findAll<MI_BATCH_BUFFER_START *>(hwParse.cmdList.begin(), hwParse.cmdList.end());
+    ASSERT_LE(2u, bbStarts.size());
+    EXPECT_EQ(commandBuffer->getGpuAddress(), genCmdCast<MI_BATCH_BUFFER_START *>(*bbStarts[0])->getBatchBufferStartAddressGraphicsaddress472());
+    EXPECT_EQ(commandBuffer->getGpuAddress() + 0x40, genCmdCast<MI_BATCH_BUFFER_START *>(*bbStarts[1])->getBatchBufferStartAddressGraphicsaddress472());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenDirectSubmissionIdleLongerThanTimeoutWhenCheckingIdleStateThenRingIsStoppedAndRestartedOnNextDispatch) {
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    directSubmission.idleTimeout = std::chrono::microseconds(1000);
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(1u, directSubmission.getStatistics().submissions);
+
+    auto now = directSubmission.lastDispatchTime;
+    EXPECT_FALSE(directSubmission.stopRingBufferIfIdle(now + std::chrono::microseconds(999)));
+    EXPECT_TRUE(directSubmission.ringStart);
+
+    size_t usedBeforeStop = directSubmission.ringCommandStream.getUsed();
+    EXPECT_TRUE(directSubmission.stopRingBufferIfIdle(now + std::chrono::microseconds(1000)));
+    EXPECT_FALSE(directSubmission.ringStart);
+    EXPECT_EQ(usedBeforeStop + directSubmission.getSizeEnd(), directSubmission.ringCommandStream.getUsed());
+    EXPECT_EQ(1u, directSubmission.getStatistics().ringStops);
+    EXPECT_FALSE(directSubmission.stopRingBufferIfIdle(now + std::chrono::microseconds(2000)));
+    EXPECT_EQ(1u, directSubmission.getStatistics().ringStops);
+
+    uint32_t submitCount = directSubmission.submitCount;
+    uint64_t submitGpuVa = directSubmission.ringCommandStream.getGraphicsAllocation()->getGpuAddress() +
+                           directSubmission.ringCommandStream.getUsed();
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_TRUE(directSubmission.ringStart);
+    EXPECT_EQ(submitCount + 1, directSubmission.submitCount);
+    EXPECT_EQ(submitGpuVa, directSubmission.submitGpuAddress);
+    EXPECT_EQ(directSubmission.getSizeDispatch(), directSubmission.submitSize);
+    EXPECT_EQ(1u, directSubmission.getStatistics().ringRestarts);
+    EXPECT_EQ(2u, directSubmission.getStatistics().submissions);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenIdleTimeoutDisabledWhenCheckingIdleStateThenRingIsNotStopped) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionIdleTimeout.set(0);
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    EXPECT_EQ(0, directSubmission.idleTimeout.count());
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+
+    EXPECT_FALSE(directSubmission.stopRingBufferIfIdle(directSubmission.lastDispatchTime + std::chrono::hours(1)));
+    EXPECT_TRUE(directSubmission.ringStart);
+    EXPECT_EQ(0u, directSubmission.getStatistics().ringStops);
+}
+
+HWTEST_F(DirectSubmissionTest, givenStoppedRingWhenStartingRingThenRestartIsCounted) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(0u, directSubmission.getStatistics().ringRestarts);
+
+    directSubmission.stopRingBuffer();
+    EXPECT_FALSE(directSubmission.ringStart);
+    EXPECT_EQ(1u, directSubmission.getStatistics().ringStops);
+
+    ret = directSubmission.startRingBuffer();
+    EXPECT_TRUE(ret);
+    EXPECT_TRUE(directSubmission.ringStart);
+    EXPECT_EQ(1u, directSubmission.getStatistics().ringRestarts);
+}
+
 HWTEST_F(DirectSubmissionTest, givenSuperBaseCsrWhenCheckingDirectSubmissionAvailableThenReturnFalse) {
     VariableBackup<UltHwConfig> backup(&ultHwConfig);
     ultHwConfig.csrSuperBaseCallDirectSubmissionAvailable = true;
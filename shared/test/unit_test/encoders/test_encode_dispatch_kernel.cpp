@@ -8,6 +8,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/preamble.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/kernel/kernel_descriptor_from_patchtokens.h"
@@ -60,6 +61,92 @@ HWTEST_F(CommandEncodeStatesTest, givenenDispatchInterfaceWhenDispatchKernelThen
     ASSERT_NE(itorPC, commands.end());
 }
 
+HWTEST_F(CommandEncodeStatesTest, givenDispatchTemplateWhenDispatchingKernelAgainThenWalkerIsCopiedFromTemplateWithNewGroupCountAndHeapOffsets) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    DispatchKernelTemplate dispatchTemplate;
+    dispatchInterface->dispatchTemplate = &dispatchTemplate;
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, false,
+                                             pDevice, NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_TRUE(dispatchTemplate.valid);
+
+    uint32_t newDims[] = {4, 2, 1};
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), newDims, false, false, dispatchInterface.get(), 0, false, false,
+                                             pDevice, NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer->getCommandStream()->getCpuBase(), 0), cmdContainer->getCommandStream()->getUsed());
+    auto walkers = findAll<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_EQ(2u, walkers.size());
+    auto firstWalker = genCmdCast<WALKER_TYPE *>(*walkers[0]);
+    auto secondWalker = genCmdCast<WALKER_TYPE *>(*walkers[1]);
+
+    EXPECT_EQ(2u, firstWalker->getThreadGroupIdXDimension());
+    EXPECT_EQ(4u, secondWalker->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, secondWalker->getThreadGroupIdYDimension());
+    EXPECT_EQ(1u, secondWalker->getThreadGroupIdZDimension());
+    EXPECT_EQ(firstWalker->getSimdSize(), secondWalker->getSimdSize());
+    EXPECT_EQ(firstWalker->getThreadWidthCounterMaximum(), secondWalker->getThreadWidthCounterMaximum());
+    EXPECT_EQ(firstWalker->getRightExecutionMask(), secondWalker->getRightExecutionMask());
+    EXPECT_NE(firstWalker->getIndirectDataStartAddress(), secondWalker->getIndirectDataStartAddress());
+    EXPECT_NE(firstWalker->getInterfaceDescriptorOffset(), secondWalker->getInterfaceDescriptorOffset());
+}
+
+HWTEST_F(CommandEncodeStatesTest, givenIndirectWalkerWhenEncodingRepeatedIndirectDispatchThenWalkerIsCopiedWithNewThreadDataAndStatesAreNotProgrammed) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+    EncodedDispatchKernelData encodedData;
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), nullptr, true, true, dispatchInterface.get(), 0, false, false,
+                                             pDevice, NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false, &encodedData);
+    auto firstWalkerCmd = encodedData.walkerCmd;
+    auto firstCrossThreadData = encodedData.crossThreadData;
+    auto dshUsed = cmdContainer->getIndirectHeap(HeapType::DYNAMIC_STATE)->getUsed();
+    auto sshUsed = cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE)->getUsed();
+    auto iohUsed = cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed();
+
+    EncodeDispatchKernel<FamilyType>::encodeRepeatedIndirect(*cmdContainer.get(), firstWalkerCmd, dispatchInterface.get(), pDevice, &encodedData);
+    EXPECT_NE(firstWalkerCmd, encodedData.walkerCmd);
+    EXPECT_NE(firstCrossThreadData, encodedData.crossThreadData);
+    EXPECT_EQ(dshUsed, cmdContainer->getIndirectHeap(HeapType::DYNAMIC_STATE)->getUsed());
+    EXPECT_EQ(sshUsed, cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE)->getUsed());
+    EXPECT_LT(iohUsed, cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed());
+
+    auto firstWalker = reinterpret_cast<WALKER_TYPE *>(firstWalkerCmd);
+    auto secondWalker = reinterpret_cast<WALKER_TYPE *>(encodedData.walkerCmd);
+    EXPECT_TRUE(secondWalker->getPredicateEnable());
+    EXPECT_TRUE(secondWalker->getIndirectParameterEnable());
+    EXPECT_EQ(firstWalker->getInterfaceDescriptorOffset(), secondWalker->getInterfaceDescriptorOffset());
+    EXPECT_EQ(firstWalker->getIndirectDataLength(), secondWalker->getIndirectDataLength());
+    EXPECT_LT(firstWalker->getIndirectDataStartAddress(), secondWalker->getIndirectDataStartAddress());
+}
+
+HWTEST_F(CommandEncodeStatesTest, givenDispatchTemplateWhenKernelStateChangesThenTemplateIsEncodedAgain) {
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    DispatchKernelTemplate dispatchTemplate;
+    dispatchInterface->dispatchTemplate = &dispatchTemplate;
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, false,
+                                             pDevice, NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_EQ(NEO::PreemptionMode::Disabled, dispatchTemplate.state.preemptionMode);
+    EXPECT_FALSE(dispatchTemplate.state.isPredicate);
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, true, dispatchInterface.get(), 0, false, false,
+                                             pDevice, NEO::PreemptionMode::ThreadGroup, requiresUncachedMocs, partitionCount, false);
+    EXPECT_TRUE(dispatchTemplate.valid);
+    EXPECT_EQ(NEO::PreemptionMode::ThreadGroup, dispatchTemplate.state.preemptionMode);
+    EXPECT_TRUE(dispatchTemplate.state.isPredicate);
+}
+
 using CommandEncodeStatesUncachedMocsTests = Test<CommandEncodeStatesFixture>;
 
 HWTEST_F(CommandEncodeStatesUncachedMocsTests, whenEncodingDispatchKernelWithUncachedMocsAndDirtyHeapsThenCorrectMocsIsSet) {
@@ -310,6 +397,32 @@ HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenSlmTotalSizeEqualZeroW
     EXPECT_EQ(expectedValue, interfaceDescriptorData->getSharedLocalMemorySize());
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenKernelsWithChangingSlmSizesWhenDispatchingThenOnlyL3ConfigChangesAfterFirstKernelAreEncoded) {
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    auto &hwInfo = pDevice->getHardwareInfo();
+    auto l3ConfigWithSlm = PreambleHelper<FamilyType>::getL3Config(hwInfo, true);
+    auto l3ConfigWithoutSlm = PreambleHelper<FamilyType>::getL3Config(hwInfo, false);
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+    for (uint32_t slmTotalSize : {1u, 2u, 0u, 4u}) {
+        EXPECT_CALL(*dispatchInterface.get(), getSlmTotalSize()).WillRepeatedly(::testing::Return(slmTotalSize));
+        EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, false,
+                                                 pDevice, NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    }
+
+    EXPECT_EQ(l3ConfigWithSlm, cmdContainer->initialL3Config);
+    EXPECT_EQ(l3ConfigWithSlm, cmdContainer->lastSentL3Config);
+    uint32_t expectedChanges = PreambleHelper<FamilyType>::isL3Configurable(hwInfo) && l3ConfigWithSlm != l3ConfigWithoutSlm ? 2u : 0u;
+    EXPECT_EQ(expectedChanges, cmdContainer->l3ConfigChangesCount);
+
+    cmdContainer->reset();
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), cmdContainer->initialL3Config);
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), cmdContainer->lastSentL3Config);
+    EXPECT_EQ(0u, cmdContainer->l3ConfigChangesCount);
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenOneBindingTableEntryWhenDispatchingKernelThenBindingTableOffsetIsCorrect) {
     using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
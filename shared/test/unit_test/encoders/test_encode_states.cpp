@@ -31,6 +31,57 @@ HWTEST_F(CommandEncodeStatesTest, GivenCommandStreamWhenEncodeCopySamplerStateTh
     auto pSmplr = reinterpret_cast<SAMPLER_STATE *>(ptrOffset(dsh->getCpuBase(), samplerStateOffset));
     EXPECT_EQ(pSmplr->getIndirectStatePointer(), usedBefore);
 }
+
+HWTEST_F(CommandEncodeStatesTest, givenStateDeduplicationEnabledWhenCopyingIdenticalSamplerStatesThenPreviousCopyIsReferenced) {
+    using SAMPLER_STATE = typename FamilyType::SAMPLER_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHeapStateDeduplication.set(1);
+    uint32_t numSamplers = 1;
+    SAMPLER_STATE samplerStates[2] = {FamilyType::cmdInitSamplerState, FamilyType::cmdInitSamplerState};
+
+    auto dsh = cmdContainer->getIndirectHeap(HeapType::DYNAMIC_STATE);
+    auto firstOffset = EncodeStates<FamilyType>::copySamplerState(dsh, 0, numSamplers, 0, &samplerStates[0], nullptr);
+    auto usedAfterFirstCopy = dsh->getUsed();
+
+    auto secondOffset = EncodeStates<FamilyType>::copySamplerState(dsh, 0, numSamplers, 0, &samplerStates[1], nullptr);
+    EXPECT_EQ(firstOffset, secondOffset);
+    EXPECT_EQ(usedAfterFirstCopy, dsh->getUsed());
+
+    samplerStates[1].setIndirectStatePointer(0x40);
+    auto thirdOffset = EncodeStates<FamilyType>::copySamplerState(dsh, 0, numSamplers, 0, &samplerStates[1], nullptr);
+    EXPECT_NE(firstOffset, thirdOffset);
+    EXPECT_LT(usedAfterFirstCopy, dsh->getUsed());
+}
+
+HWTEST_F(CommandEncodeStatesTest, givenStateDeduplicationEnabledWhenPushingIdenticalKernelSurfaceStateHeapThenPreviousBindingTableIsReferenced) {
+    using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHeapStateDeduplication.set(1);
+
+    struct alignas(64) KernelSsh {
+        RENDER_SURFACE_STATE surfaceState;
+        BINDING_TABLE_STATE bindingTable[16];
+    } kernelSsh = {};
+    kernelSsh.surfaceState = FamilyType::cmdInitRenderSurfaceState;
+    kernelSsh.bindingTable[0] = FamilyType::cmdInitBindingTableState;
+    kernelSsh.bindingTable[0].setSurfaceStatePointer(0);
+
+    auto ssh = cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE);
+    ssh->getSpace(sizeof(RENDER_SURFACE_STATE));
+    ssh->align(FamilyType::BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+    auto firstOffset = EncodeSurfaceState<FamilyType>::pushBindingTableAndSurfaceStates(*ssh, 1, &kernelSsh, sizeof(kernelSsh), 1, offsetof(KernelSsh, bindingTable));
+    auto usedAfterFirstPush = ssh->getUsed();
+
+    auto secondOffset = EncodeSurfaceState<FamilyType>::pushBindingTableAndSurfaceStates(*ssh, 1, &kernelSsh, sizeof(kernelSsh), 1, offsetof(KernelSsh, bindingTable));
+    EXPECT_EQ(firstOffset, secondOffset);
+    EXPECT_EQ(usedAfterFirstPush, ssh->getUsed());
+
+    DebugManager.flags.EnableHeapStateDeduplication.set(0);
+    auto thirdOffset = EncodeSurfaceState<FamilyType>::pushBindingTableAndSurfaceStates(*ssh, 1, &kernelSsh, sizeof(kernelSsh), 1, offsetof(KernelSsh, bindingTable));
+    EXPECT_NE(firstOffset, thirdOffset);
+}
+
 using BindlessCommandEncodeStatesTest = Test<MemManagerFixture>;
 
 HWTEST_F(BindlessCommandEncodeStatesTest, GivenBindlessEnabledWhenBorderColorWithoutAlphaThenBorderColorPtrReturned) {
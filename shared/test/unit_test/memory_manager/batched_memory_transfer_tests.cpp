@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/batched_memory_transfer.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/test/common/fixtures/device_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/test_macros/test_checks_shared.h"
+
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
+#include "test.h"
+
+using namespace NEO;
+
+using BatchedMemoryTransferTest = Test<DeviceFixture>;
+
+TEST(BatchedMemoryTransfer, whenDebugFlagIsSetThenBatchedTransferIsEnabled) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(BatchedMemoryTransfer::isEnabled());
+
+    DebugManager.flags.EnableBatchedModuleUpload.set(1);
+    EXPECT_TRUE(BatchedMemoryTransfer::isEnabled());
+}
+
+TEST_F(BatchedMemoryTransferTest, givenAllocationsInSystemMemoryWhenSubmittingThenContentsAreCopiedWithoutCopyEngine) {
+    uint8_t firstBuffer[64] = {};
+    uint8_t secondBuffer[64] = {};
+    MockGraphicsAllocation firstAllocation(firstBuffer, sizeof(firstBuffer));
+    MockGraphicsAllocation secondAllocation(secondBuffer, sizeof(secondBuffer));
+    const uint8_t firstData[16] = {1, 2, 3, 4};
+    const uint8_t secondData[32] = {5, 6, 7, 8};
+
+    BatchedMemoryTransfer transfer(*pDevice);
+    transfer.add(&firstAllocation, 8, firstData, sizeof(firstData));
+    transfer.add(&secondAllocation, 0, secondData, sizeof(secondData));
+    EXPECT_EQ(2u, transfer.getChunksCount());
+    EXPECT_EQ(0, firstBuffer[8]);
+
+    EXPECT_TRUE(transfer.submit());
+    EXPECT_FALSE(transfer.isSubmittedToCopyEngine());
+    EXPECT_EQ(0u, transfer.getChunksCount());
+    EXPECT_EQ(0, memcmp(firstBuffer + 8, firstData, sizeof(firstData)));
+    EXPECT_EQ(0, memcmp(secondBuffer, secondData, sizeof(secondData)));
+}
+
+TEST_F(BatchedMemoryTransferTest, givenChunkAddedAgainForSameRangeWhenSubmittingThenOnlyLatestContentsAreCopied) {
+    uint8_t buffer[64] = {};
+    MockGraphicsAllocation allocation(buffer, sizeof(buffer));
+    uint8_t data[16] = {1, 2, 3, 4};
+
+    BatchedMemoryTransfer transfer(*pDevice);
+    transfer.add(&allocation, 0, data, sizeof(data));
+    data[0] = 9;
+    transfer.add(&allocation, 0, data, sizeof(data));
+    EXPECT_EQ(1u, transfer.getChunksCount());
+
+    data[0] = 0;
+    EXPECT_TRUE(transfer.submit());
+    EXPECT_EQ(9, buffer[0]);
+}
+
+TEST_F(BatchedMemoryTransferTest, givenChunkWithoutSourceMemoryWhenSubmittingThenDestinationIsZeroed) {
+    uint8_t buffer[64];
+    memset(buffer, 0xff, sizeof(buffer));
+    MockGraphicsAllocation allocation(buffer, sizeof(buffer));
+
+    BatchedMemoryTransfer transfer(*pDevice);
+    transfer.add(&allocation, 0, nullptr, 32);
+    EXPECT_TRUE(transfer.submit());
+
+    uint8_t zeros[32] = {};
+    EXPECT_EQ(0, memcmp(buffer, zeros, sizeof(zeros)));
+    EXPECT_EQ(0xff, buffer[32]);
+}
+
+HWTEST_F(BatchedMemoryTransferTest, givenAllocationInLocalMemoryAndCopyEngineWhenSubmittingThenAllChunksAreCopiedWithSingleBlitSubmission) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    REQUIRE_BLITTER_OR_SKIP(&hwInfo);
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo));
+    auto &copyEngines = device->getEngineGroups()[static_cast<size_t>(EngineGroupType::Copy)];
+    if (copyEngines.empty()) {
+        GTEST_SKIP();
+    }
+    auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(copyEngines[0].commandStreamReceiver);
+
+    uint8_t buffer[128] = {};
+    MockGraphicsAllocation isaAllocation(buffer, sizeof(buffer));
+    isaAllocation.overrideMemoryPool(MemoryPool::LocalMemory);
+    MockGraphicsAllocation globalsAllocation(buffer, sizeof(buffer));
+    globalsAllocation.overrideMemoryPool(MemoryPool::LocalMemory);
+    const uint8_t data[64] = {1, 2, 3, 4};
+
+    BatchedMemoryTransfer transfer(*device);
+    transfer.add(&isaAllocation, 0, data, sizeof(data));
+    transfer.add(&globalsAllocation, 64, data, sizeof(data));
+    EXPECT_TRUE(transfer.submit());
+
+    EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
+    EXPECT_TRUE(transfer.isSubmittedToCopyEngine());
+    EXPECT_EQ(0, buffer[0]);
+
+    transfer.wait();
+    EXPECT_FALSE(transfer.isSubmittedToCopyEngine());
+    EXPECT_EQ(bcsCsr->peekTaskCount(), bcsCsr->latestWaitForCompletionWithTimeoutTaskCount.load());
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/kernel_isa_cache.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/test/common/fixtures/device_fixture.h"
+
+#include "test.h"
+
+using namespace NEO;
+
+using KernelIsaCacheTest = Test<DeviceFixture>;
+
+TEST_F(KernelIsaCacheTest, givenIdenticalIsaWhenObtainingAllocationThenSameAllocationIsReturnedAndFreedByLastUser) {
+    KernelIsaCache cache;
+    const char isa[64] = {1, 2, 3, 4};
+
+    auto allocation = cache.obtainAllocation(*pDevice, isa, sizeof(isa), GraphicsAllocation::AllocationType::KERNEL_ISA);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(allocation, cache.obtainAllocation(*pDevice, isa, sizeof(isa), GraphicsAllocation::AllocationType::KERNEL_ISA));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_EQ(0, memcmp(isa, allocation->getUnderlyingBuffer(), sizeof(isa)));
+
+    EXPECT_FALSE(cache.releaseAllocation(allocation));
+    EXPECT_TRUE(cache.releaseAllocation(allocation));
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    pDevice->getMemoryManager()->freeGraphicsMemory(allocation);
+}
+
+TEST_F(KernelIsaCacheTest, givenDifferentIsaOrAllocationTypeWhenObtainingAllocationThenSeparateAllocationsAreReturned) {
+    KernelIsaCache cache;
+    const char isa[64] = {1, 2, 3, 4};
+    const char otherIsa[64] = {1, 2, 3, 5};
+
+    auto allocation = cache.obtainAllocation(*pDevice, isa, sizeof(isa), GraphicsAllocation::AllocationType::KERNEL_ISA);
+    auto otherIsaAllocation = cache.obtainAllocation(*pDevice, otherIsa, sizeof(otherIsa), GraphicsAllocation::AllocationType::KERNEL_ISA);
+    auto internalIsaAllocation = cache.obtainAllocation(*pDevice, isa, sizeof(isa), GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL);
+    auto shorterIsaAllocation = cache.obtainAllocation(*pDevice, isa, sizeof(isa) / 2, GraphicsAllocation::AllocationType::KERNEL_ISA);
+
+    EXPECT_NE(allocation, otherIsaAllocation);
+    EXPECT_NE(allocation, internalIsaAllocation);
+    EXPECT_NE(allocation, shorterIsaAllocation);
+    EXPECT_EQ(4u, cache.getEntriesCount());
+
+    for (auto cachedAllocation : {allocation, otherIsaAllocation, internalIsaAllocation, shorterIsaAllocation}) {
+        EXPECT_TRUE(cache.releaseAllocation(cachedAllocation));
+        pDevice->getMemoryManager()->freeGraphicsMemory(cachedAllocation);
+    }
+    EXPECT_EQ(0u, cache.getEntriesCount());
+}
+
+TEST_F(KernelIsaCacheTest, givenAllocationNotObtainedFromCacheWhenReleasingThenCallerHasToFreeIt) {
+    KernelIsaCache cache;
+    auto allocation = pDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize,
+                                                                                         GraphicsAllocation::AllocationType::KERNEL_ISA, pDevice->getDeviceBitfield()});
+    EXPECT_TRUE(cache.releaseAllocation(allocation));
+    pDevice->getMemoryManager()->freeGraphicsMemory(allocation);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/memory_usage_statistics.h"
+
+#include "test.h"
+
+using namespace NEO;
+
+TEST(MemoryUsageStatisticsTest, givenRegisteredAllocationsWhenGettingCountersThenCountersAreTrackedPerAllocationTypeAndMemoryPool) {
+    MemoryUsageStatistics statistics;
+
+    EXPECT_EQ(1u, statistics.registerAllocation(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::LocalMemory, 0x1000));
+    EXPECT_EQ(2u, statistics.registerAllocation(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::LocalMemory, 0x2000));
+    EXPECT_EQ(3u, statistics.registerAllocation(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::System4KBPages, 0x4000));
+    EXPECT_EQ(4u, statistics.registerAllocation(GraphicsAllocation::AllocationType::KERNEL_ISA, MemoryPool::LocalMemory, 0x8000));
+
+    auto counters = statistics.getCounters(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::LocalMemory);
+    EXPECT_EQ(0x3000u, counters.currentSize);
+    EXPECT_EQ(0x3000u, counters.peakSize);
+    EXPECT_EQ(2u, counters.currentCount);
+    EXPECT_EQ(2u, counters.allocationsCount);
+    EXPECT_EQ(0u, counters.freesCount);
+
+    EXPECT_EQ(0x4000u, statistics.getCounters(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::System4KBPages).currentSize);
+    EXPECT_EQ(0x8000u, statistics.getCounters(GraphicsAllocation::AllocationType::KERNEL_ISA, MemoryPool::LocalMemory).currentSize);
+    EXPECT_EQ(0u, statistics.getCounters(GraphicsAllocation::AllocationType::KERNEL_ISA, MemoryPool::System4KBPages).allocationsCount);
+
+    auto totalCounters = statistics.getTotalCounters();
+    EXPECT_EQ(0xF000u, totalCounters.currentSize);
+    EXPECT_EQ(4u, totalCounters.currentCount);
+    EXPECT_EQ(4u, totalCounters.allocationsCount);
+}
+
+TEST(MemoryUsageStatisticsTest, givenUnregisteredAllocationsWhenGettingCountersThenCurrentUsageDropsAndPeakIsKept) {
+    MemoryUsageStatistics statistics;
+
+    statistics.registerAllocation(GraphicsAllocation::AllocationType::COMMAND_BUFFER, MemoryPool::System4KBPages, 0x1000);
+    statistics.registerAllocation(GraphicsAllocation::AllocationType::COMMAND_BUFFER, MemoryPool::System4KBPages, 0x2000);
+    statistics.unregisterAllocation(GraphicsAllocation::AllocationType::COMMAND_BUFFER, MemoryPool::System4KBPages, 0x2000);
+    statistics.registerAllocation(GraphicsAllocation::AllocationType::COMMAND_BUFFER, MemoryPool::System4KBPages, 0x1000);
+
+    auto counters = statistics.getCounters(GraphicsAllocation::AllocationType::COMMAND_BUFFER, MemoryPool::System4KBPages);
+    EXPECT_EQ(0x2000u, counters.currentSize);
+    EXPECT_EQ(0x3000u, counters.peakSize);
+    EXPECT_EQ(2u, counters.currentCount);
+    EXPECT_EQ(3u, counters.allocationsCount);
+    EXPECT_EQ(1u, counters.freesCount);
+
+    auto totalCounters = statistics.getTotalCounters();
+    EXPECT_EQ(0x2000u, totalCounters.currentSize);
+    EXPECT_EQ(0x3000u, totalCounters.peakSize);
+    EXPECT_EQ(1u, totalCounters.freesCount);
+}
+
+TEST(MemoryUsageStatisticsTest, givenRegisteredAllocationsWhenPrintingThenOnlyUsedCountersAndTotalArePrinted) {
+    MemoryUsageStatistics statistics;
+    statistics.registerAllocation(GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER, MemoryPool::System4KBPages, 0x1000);
+
+    testing::internal::CaptureStdout();
+    statistics.print(1u);
+    auto output = testing::internal::GetCapturedStdout();
+
+    char expectedTypeLine[256];
+    snprintf(expectedTypeLine, sizeof(expectedTypeLine), "Memory usage: root device 1, allocation type %u, memory pool %u: current 4096 bytes in 1 allocations, peak 4096 bytes, allocated 1 times, freed 0 times\n",
+             static_cast<uint32_t>(GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER), static_cast<uint32_t>(MemoryPool::System4KBPages));
+    std::string expectedOutput = std::string(expectedTypeLine) +
+                                 "Memory usage: root device 1, total: current 4096 bytes in 1 allocations, peak 4096 bytes, allocated 1 times, freed 0 times\n";
+    EXPECT_EQ(expectedOutput, output);
+}
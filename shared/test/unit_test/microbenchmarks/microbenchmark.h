@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace NEO {
+namespace Microbenchmark {
+
+constexpr std::chrono::milliseconds minimalMeasurementTime{200};
+
+extern volatile uint64_t sink;
+
+// keeps benchmarked result alive, so compiler cannot drop computation producing it
+template <typename T>
+inline void doNotOptimize(const T &value) {
+    sink = sink + static_cast<uint64_t>(value);
+}
+
+// Runs whole batch of operations until minimal measurement time elapses.
+// Average time per operation is reported as test property, so it is present in --gtest_output report,
+// and as "neo_microbenchmark,<name>,<operations>,<ns per operation>" line on stdout.
+template <typename BatchT>
+double measure(const std::string &name, size_t operationsPerBatch, BatchT &&batch) {
+    using Clock = std::chrono::steady_clock;
+
+    batch();
+
+    size_t batchesCount = 0;
+    auto start = Clock::now();
+    Clock::duration elapsed{};
+    do {
+        batch();
+        batchesCount++;
+        elapsed = Clock::now() - start;
+    } while (elapsed < minimalMeasurementTime);
+
+    auto operationsCount = batchesCount * operationsPerBatch;
+    auto nsPerOperation = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / operationsCount;
+
+    ::testing::Test::RecordProperty(name, std::to_string(nsPerOperation));
+    printf("neo_microbenchmark,%s,%zu,%.3f\n", name.c_str(), operationsCount, nsPerOperation);
+    return nsPerOperation;
+}
+} // namespace Microbenchmark
+} // namespace NEO
@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/idlist.h"
+#include "shared/source/utilities/iflist.h"
+#include "shared/source/utilities/tag_allocator.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/unit_test/microbenchmarks/microbenchmark.h"
+
+#include "opencl/source/event/hw_timestamps.h"
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "test.h"
+
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+// Microbenchmarks are disabled tests, they are executed by run_shared_microbenchmarks target
+
+namespace NEO {
+namespace Microbenchmark {
+volatile uint64_t sink = 0u;
+} // namespace Microbenchmark
+} // namespace NEO
+
+namespace {
+struct ListNode : public IDNode<ListNode> {
+};
+
+struct ForwardListNode : public IFNode<ForwardListNode> {
+};
+
+uint32_t nextRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+std::string createZeInfo(size_t kernelsCount) {
+    std::stringstream zeInfo;
+    zeInfo << "kernels:\n";
+    for (size_t kernel = 0; kernel < kernelsCount; kernel++) {
+        zeInfo << "  - name: kernel_" << kernel << "\n"
+               << "    execution_env:\n"
+               << "      grf_count: 128\n"
+               << "      has_no_stateless_write: true\n"
+               << "      simd_size: 32\n"
+               << "    payload_arguments:\n"
+               << "      - arg_type: global_id_offset\n"
+               << "        offset: 0\n"
+               << "        size: 12\n"
+               << "      - arg_type: local_size\n"
+               << "        offset: 12\n"
+               << "        size: 12\n"
+               << "      - arg_type: arg_bypointer\n"
+               << "        offset: 32\n"
+               << "        size: 8\n"
+               << "        arg_index: 0\n"
+               << "        addrmode: stateless\n"
+               << "        addrspace: global\n"
+               << "        access_type: readwrite\n"
+               << "    per_thread_payload_arguments:\n"
+               << "      - arg_type: local_id\n"
+               << "        offset: 0\n"
+               << "        size: 192\n"
+               << "    binding_table_indices:\n"
+               << "      - bti_value: 0\n"
+               << "        arg_index: 0\n";
+    }
+    return zeInfo.str();
+}
+} // namespace
+
+TEST(SharedDataStructuresMicrobenchmark, DISABLED_givenFragmentedHeapAllocatorWhenAllocatingAndFreeingThenTimePerOperationIsReported) {
+    constexpr size_t chunksCount = 4096;
+    HeapAllocator heapAllocator(0x10000000ull, chunksCount * 4 * MemoryConstants::pageSize);
+
+    // every other chunk is freed, so allocations are served from fragmented free lists
+    std::vector<std::pair<uint64_t, size_t>> chunks;
+    for (size_t i = 0; i < chunksCount; i++) {
+        size_t size = (i % 4 + 1) * MemoryConstants::pageSize;
+        auto ptr = heapAllocator.allocate(size);
+        ASSERT_NE(0u, ptr);
+        chunks.push_back({ptr, size});
+    }
+    std::vector<size_t> freedSizes;
+    for (size_t i = 1; i < chunksCount; i += 2) {
+        heapAllocator.free(chunks[i].first, chunks[i].second);
+        freedSizes.push_back(chunks[i].second);
+    }
+
+    Microbenchmark::measure("HeapAllocator_fragmented_allocateFree", freedSizes.size() * 2, [&]() {
+        for (auto freedSize : freedSizes) {
+            size_t size = freedSize;
+            auto ptr = heapAllocator.allocate(size);
+            heapAllocator.free(ptr, size);
+            Microbenchmark::doNotOptimize(ptr);
+        }
+    });
+
+    for (size_t i = 0; i < chunksCount; i += 2) {
+        heapAllocator.free(chunks[i].first, chunks[i].second);
+    }
+}
+
+TEST(SharedDataStructuresMicrobenchmark, DISABLED_givenTagAllocatorSharedByThreadsWhenGettingAndReturningTagsThenTimePerOperationIsReported) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    TagAllocator<HwTimeStamps> tagAllocator(0, executionEnvironment.memoryManager.get(), 512, MemoryConstants::cacheLineSize,
+                                            sizeof(HwTimeStamps), false, DeviceBitfield(1));
+
+    constexpr size_t operationsPerThread = 10000;
+    for (auto threadsCount : {1u, 2u, 4u, 8u}) {
+        Microbenchmark::measure("TagAllocator_getReturn_threads" + std::to_string(threadsCount), threadsCount * operationsPerThread * 2, [&]() {
+            std::vector<std::thread> threads;
+            std::vector<uint64_t> results(threadsCount, 0u);
+            for (uint32_t thread = 0; thread < threadsCount; thread++) {
+                threads.emplace_back([&, thread]() {
+                    for (size_t i = 0; i < operationsPerThread; i++) {
+                        auto tag = tagAllocator.getTag();
+                        results[thread] += tag->getGpuAddress();
+                        tag->returnTag();
+                    }
+                });
+            }
+            for (uint32_t thread = 0; thread < threadsCount; thread++) {
+                threads[thread].join();
+                Microbenchmark::doNotOptimize(results[thread]);
+            }
+        });
+    }
+}
+
+TEST(SharedDataStructuresMicrobenchmark, DISABLED_givenSvmAllocsManagerWithManyAllocationsWhenLookingUpPointersThenTimePerLookupIsReported) {
+    constexpr uint64_t baseGpuAddress = 0x10000000ull;
+    constexpr size_t allocationSize = MemoryConstants::cacheLineSize;
+    constexpr size_t lookupsPerBatch = 10000;
+    MockGraphicsAllocation allocation(nullptr, baseGpuAddress, allocationSize);
+
+    for (auto allocationsCount : {1000u, 10000u, 100000u, 1000000u}) {
+        SVMAllocsManager svmManager(nullptr, false);
+        // allocations differ only by offset in pool, so single graphics allocation backs all of them
+        for (uint32_t i = 0; i < allocationsCount; i++) {
+            SvmAllocationData svmData(0u);
+            svmData.gpuAllocations.addAllocation(&allocation);
+            svmData.size = allocationSize;
+            svmData.offsetInUsmPool = i * allocationSize;
+            svmManager.insertSVMAlloc(svmData);
+        }
+        ASSERT_EQ(allocationsCount, svmManager.getNumAllocs());
+
+        std::vector<const void *> lookupPtrs;
+        uint32_t randomState = 1u;
+        for (size_t i = 0; i < lookupsPerBatch; i++) {
+            auto offset = (nextRandom(randomState) % allocationsCount) * allocationSize + allocationSize / 2;
+            lookupPtrs.push_back(reinterpret_cast<const void *>(static_cast<uintptr_t>(baseGpuAddress + offset)));
+        }
+
+        Microbenchmark::measure("SVMAllocsManager_getSVMAlloc_allocations" + std::to_string(allocationsCount), lookupsPerBatch, [&]() {
+            for (auto ptr : lookupPtrs) {
+                Microbenchmark::doNotOptimize(svmManager.getSVMAlloc(ptr)->size);
+            }
+        });
+    }
+}
+
+TEST(SharedDataStructuresMicrobenchmark, DISABLED_givenIntrusiveListsWhenPushingAndRemovingNodesThenTimePerOperationIsReported) {
+    constexpr size_t nodesCount = 1024;
+    std::vector<ListNode> listNodes(nodesCount);
+    std::vector<ForwardListNode> forwardListNodes(nodesCount);
+
+    IDList<ListNode, true, false> threadSafeList;
+    Microbenchmark::measure("IDList_threadSafe_pushFrontRemoveFront", nodesCount * 2, [&]() {
+        for (auto &node : listNodes) {
+            threadSafeList.pushFrontOne(node);
+        }
+        for (size_t i = 0; i < nodesCount; i++) {
+            Microbenchmark::doNotOptimize(threadSafeList.removeFrontOne().release() != nullptr);
+        }
+    });
+
+    IDList<ListNode, false, false> list;
+    Microbenchmark::measure("IDList_pushTailRemoveOne", nodesCount * 2, [&]() {
+        for (auto &node : listNodes) {
+            list.pushTailOne(node);
+        }
+        for (auto &node : listNodes) {
+            Microbenchmark::doNotOptimize(list.removeOne(node).release() != nullptr);
+        }
+    });
+
+    IFList<ForwardListNode, true, false> threadSafeForwardList;
+    Microbenchmark::measure("IFList_threadSafe_pushFrontDetach", nodesCount, [&]() {
+        for (auto &node : forwardListNodes) {
+            threadSafeForwardList.pushFrontOne(node);
+        }
+        Microbenchmark::doNotOptimize(threadSafeForwardList.detachNodes() != nullptr);
+    });
+
+    constexpr uint32_t threadsCount = 4;
+    std::vector<ForwardListNode> contendedNodes(nodesCount * threadsCount);
+    Microbenchmark::measure("IFList_threadSafe_pushFront_threads" + std::to_string(threadsCount), contendedNodes.size(), [&]() {
+        std::vector<std::thread> threads;
+        for (uint32_t thread = 0; thread < threadsCount; thread++) {
+            threads.emplace_back([&, thread]() {
+                for (size_t i = 0; i < nodesCount; i++) {
+                    threadSafeForwardList.pushFrontOne(contendedNodes[thread * nodesCount + i]);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        Microbenchmark::doNotOptimize(threadSafeForwardList.detachNodes() != nullptr);
+    });
+}
+
+TEST(SharedDataStructuresMicrobenchmark, DISABLED_givenSimdWidthWhenGeneratingLocalIdsThenTimePerWorkgroupIsReported) {
+    constexpr uint32_t grfSize = 32u;
+    const std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+
+    for (uint16_t simd : {1u, 8u, 16u, 32u}) {
+        for (auto localWorkgroupSize : {std::array<uint16_t, 3>{{256, 1, 1}}, std::array<uint16_t, 3>{{16, 16, 4}}}) {
+            auto lws = localWorkgroupSize[0] * localWorkgroupSize[1] * localWorkgroupSize[2];
+            auto bufferSize = getPerThreadSizeLocalIDs(simd, grfSize) * getThreadsPerWG(simd, lws);
+            auto buffer = alignedMalloc(bufferSize, 64);
+
+            std::string name = "LocalIDs_simd" + std::to_string(simd) + "_lws" + std::to_string(localWorkgroupSize[0]) + "x" +
+                               std::to_string(localWorkgroupSize[1]) + "x" + std::to_string(localWorkgroupSize[2]);
+            Microbenchmark::measure(name, 1, [&]() {
+                generateLocalIDs(buffer, simd, localWorkgroupSize, dimensionsOrder, false, grfSize);
+                Microbenchmark::doNotOptimize(*reinterpret_cast<uint16_t *>(buffer));
+            });
+            alignedFree(buffer);
+        }
+    }
+}
+
+TEST(SharedDataStructuresMicrobenchmark, DISABLED_givenLargeZeInfoWhenTokenizingThenTimePerLineIsReported) {
+    auto zeInfo = createZeInfo(500);
+    auto linesCount = Yaml::countLines(zeInfo);
+
+    Microbenchmark::measure("Yaml_tokenize_zeInfo_500kernels_perLine", linesCount, [&]() {
+        Yaml::LinesCache lines;
+        Yaml::TokensCache tokens;
+        std::string errors;
+        std::string warnings;
+        bool success = Yaml::tokenize(zeInfo, lines, tokens, errors, warnings);
+        EXPECT_TRUE(success);
+        Microbenchmark::doNotOptimize(tokens.size());
+    });
+}
+
+TEST(SharedDataStructuresMicrobenchmark, DISABLED_givenDataOfVariousSizesWhenHashingThenTimePerByteIsReported) {
+    std::vector<char> data(MemoryConstants::megaByte);
+    uint32_t randomState = 1u;
+    for (auto &byte : data) {
+        byte = static_cast<char>(nextRandom(randomState));
+    }
+
+    for (size_t size : {64u, 4096u, 1048576u}) {
+        auto iterations = data.size() / size;
+        Microbenchmark::measure("Hash_" + std::to_string(size) + "B_perByte", iterations * size, [&]() {
+            for (size_t i = 0; i < iterations; i++) {
+                Microbenchmark::doNotOptimize(Hash::hash(data.data() + i * size, size));
+            }
+        });
+    }
+}
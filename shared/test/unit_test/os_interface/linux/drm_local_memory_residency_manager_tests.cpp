@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_local_memory_residency_manager.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+
+#include "test.h"
+
+using namespace NEO;
+
+struct MockDrmLocalMemoryResidencyManager : public DrmLocalMemoryResidencyManager {
+    using DrmLocalMemoryResidencyManager::DrmLocalMemoryResidencyManager;
+    using DrmLocalMemoryResidencyManager::lruList;
+};
+
+TEST(DrmLocalMemoryResidencyManagerTest, givenRegisteredAllocationsWhenUnregisteringThenUsedSizeIsUpdated) {
+    MockDrmLocalMemoryResidencyManager residencyManager(0x3000);
+    MockGraphicsAllocation allocation1(nullptr, 0x1000);
+    MockGraphicsAllocation allocation2(nullptr, 0x2000);
+
+    residencyManager.registerAllocation(allocation1);
+    residencyManager.registerAllocation(allocation2);
+    residencyManager.registerAllocation(allocation2);
+
+    auto statistics = residencyManager.getStatistics();
+    EXPECT_EQ(2u, statistics.trackedCount);
+    EXPECT_EQ(0x3000u, statistics.usedSize);
+
+    residencyManager.unregisterAllocation(allocation1);
+    statistics = residencyManager.getStatistics();
+    EXPECT_EQ(1u, statistics.trackedCount);
+    EXPECT_EQ(0x2000u, statistics.usedSize);
+
+    residencyManager.unregisterAllocation(allocation1);
+    residencyManager.unregisterAllocation(allocation2);
+    EXPECT_EQ(0u, residencyManager.getStatistics().usedSize);
+}
+
+TEST(DrmLocalMemoryResidencyManagerTest, givenAllocationsMarkedUsedWhenReservingOverBudgetThenLeastRecentlyUsedAllocationIsEvicted) {
+    MockDrmLocalMemoryResidencyManager residencyManager(0x3000);
+    MockGraphicsAllocation allocation1(nullptr, 0x1000);
+    MockGraphicsAllocation allocation2(nullptr, 0x1000);
+    MockGraphicsAllocation allocation3(nullptr, 0x1000);
+
+    residencyManager.registerAllocation(allocation1);
+    residencyManager.registerAllocation(allocation2);
+    residencyManager.registerAllocation(allocation3);
+    residencyManager.markUsed({&allocation1});
+    EXPECT_EQ(&allocation2, residencyManager.lruList.front().allocation);
+
+    std::vector<GraphicsAllocation *> evictedAllocations;
+    EXPECT_TRUE(residencyManager.reserve(0x1000, [&](GraphicsAllocation &allocation) {
+        evictedAllocations.push_back(&allocation);
+        return true;
+    }));
+
+    ASSERT_EQ(1u, evictedAllocations.size());
+    EXPECT_EQ(&allocation2, evictedAllocations[0]);
+    EXPECT_TRUE(residencyManager.isEvicted(allocation2));
+    EXPECT_FALSE(residencyManager.isEvicted(allocation1));
+    EXPECT_FALSE(residencyManager.isMemoryBudgetExhausted());
+
+    auto statistics = residencyManager.getStatistics();
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_EQ(0x1000u, statistics.evictedBytes);
+    EXPECT_EQ(1u, statistics.evictedCount);
+    EXPECT_EQ(0x2000u, statistics.usedSize);
+
+    residencyManager.markUsed({&allocation2, &allocation3});
+    EXPECT_EQ(1u, residencyManager.getStatistics().refaults);
+
+    residencyManager.unregisterAllocation(allocation2);
+    EXPECT_EQ(0x2000u, residencyManager.getStatistics().usedSize);
+}
+
+TEST(DrmLocalMemoryResidencyManagerTest, givenBusyAllocationsWhenReservingOverBudgetThenReservationFailsAndBudgetIsExhausted) {
+    MockDrmLocalMemoryResidencyManager residencyManager(0x2000);
+    MockGraphicsAllocation allocation1(nullptr, 0x1000);
+    MockGraphicsAllocation allocation2(nullptr, 0x1000);
+
+    residencyManager.registerAllocation(allocation1);
+    residencyManager.registerAllocation(allocation2);
+
+    uint32_t evictCalled = 0u;
+    EXPECT_FALSE(residencyManager.reserve(0x1000, [&](GraphicsAllocation &allocation) {
+        evictCalled++;
+        return false;
+    }));
+    EXPECT_EQ(2u, evictCalled);
+    EXPECT_TRUE(residencyManager.isMemoryBudgetExhausted());
+    EXPECT_EQ(1u, residencyManager.getStatistics().failedReservations);
+    EXPECT_EQ(0u, residencyManager.getStatistics().evictions);
+
+    residencyManager.unregisterAllocation(allocation1);
+    EXPECT_FALSE(residencyManager.isMemoryBudgetExhausted());
+
+    EXPECT_TRUE(residencyManager.reserve(0x1000, [&](GraphicsAllocation &allocation) {
+        evictCalled++;
+        return false;
+    }));
+    EXPECT_EQ(2u, evictCalled);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+
+#include "test.h"
+
+using namespace NEO;
+
+TEST(DrmMemoryOperationsHandlerBindTest, givenTileLocalResidencyDisabledWhenCheckingAllocationOfSubDeviceThenItIsBoundInAllVmsOfContext) {
+    MockGraphicsAllocation allocation(nullptr, 0x1000);
+    allocation.setSubDevicesBitfield(0b01);
+
+    EXPECT_TRUE(DrmMemoryOperationsHandlerBind::isBoundInVm(allocation, 0b11, 0u));
+    EXPECT_TRUE(DrmMemoryOperationsHandlerBind::isBoundInVm(allocation, 0b11, 1u));
+}
+
+TEST(DrmMemoryOperationsHandlerBindTest, givenTileLocalResidencyEnabledWhenCheckingAllocationOfSubDeviceThenItIsBoundOnlyInVmOfItsTile) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTileLocalResidency.set(1);
+    MockGraphicsAllocation allocation(nullptr, 0x1000);
+    allocation.setSubDevicesBitfield(0b10);
+
+    EXPECT_FALSE(DrmMemoryOperationsHandlerBind::isBoundInVm(allocation, 0b11, 0u));
+    EXPECT_TRUE(DrmMemoryOperationsHandlerBind::isBoundInVm(allocation, 0b11, 1u));
+}
+
+TEST(DrmMemoryOperationsHandlerBindTest, givenTileLocalResidencyEnabledWhenCheckingAllocationOfRootDeviceThenItIsBoundInAllVmsOfContext) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTileLocalResidency.set(1);
+    MockGraphicsAllocation allocation(nullptr, 0x1000);
+    EXPECT_TRUE(allocation.getSubDevicesBitfield().none());
+
+    EXPECT_TRUE(DrmMemoryOperationsHandlerBind::isBoundInVm(allocation, 0b11, 0u));
+    EXPECT_TRUE(DrmMemoryOperationsHandlerBind::isBoundInVm(allocation, 0b11, 1u));
+}
+
+TEST(DrmMemoryOperationsHandlerBindTest, givenTileLocalResidencyEnabledWhenContextDoesNotUseTilesOfAllocationThenAllocationIsBoundInVmOfContext) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTileLocalResidency.set(1);
+    MockGraphicsAllocation allocation(nullptr, 0x1000);
+    allocation.setSubDevicesBitfield(0b01);
+
+    EXPECT_TRUE(DrmMemoryOperationsHandlerBind::isBoundInVm(allocation, 0b10, 1u));
+}
@@ -57,7 +57,7 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocsWhenInsertingAllocsThenAllo
     EXPECT_EQ(pageFaultManager->memoryData[alloc2].size, 20u);
     EXPECT_EQ(pageFaultManager->memoryData[alloc2].unifiedMemoryManager, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
 
-    auto invalidAccess = [&]() { return pageFaultManager->memoryData.at(alloc1); };
+    auto invalidAccess = [&]() { pageFaultManager->memoryData.at(alloc1); };
     EXPECT_THROW(invalidAccess(), std::out_of_range);
 }
 
@@ -229,6 +229,32 @@ TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProper
     EXPECT_TRUE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenAdjacentTrackedAllocationsWhenVerifyingAddressesThenAllocationContainingAddressIsSelected) {
+    void *alloc1 = reinterpret_cast<void *>(0x1000);
+    void *alloc2 = reinterpret_cast<void *>(0x1010);
+    void *alloc3 = reinterpret_cast<void *>(0x2000);
+
+    pageFaultManager->insertAllocation(alloc3, 0x10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->insertAllocation(alloc1, 0x10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 0x20, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    EXPECT_EQ(pageFaultManager->memoryData.size(), 3u);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc1, 0xF)));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc1);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc2, 0x1F)));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, 0x20u);
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(alloc2, 0x20)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0xFFF)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(alloc3, 0x10)));
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc3));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc3);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 3);
+}
+
 TEST_F(PageFaultManagerTest, givenInitialPlacementCpuWhenVerifyingPagefaultThenFirstAccessDoesNotInvokeTransfer) {
     void *alloc = reinterpret_cast<void *>(0x1);
 
@@ -398,6 +424,233 @@ TEST_F(PageFaultManagerTest, givenAllocationMovedToGpuDomainWhenVerifyingPagefau
     EXPECT_TRUE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenMigrationBlockSizeSetWhenInsertingAllocationThenBlocksAreTracked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmMigrationBlockSize.set(64);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    void *smallAlloc = reinterpret_cast<void *>(0x100000);
+    size_t blockSize = 64 * MemoryConstants::kiloByte;
+
+    pageFaultManager->insertAllocation(alloc, 3 * blockSize + 1, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->insertAllocation(smallAlloc, blockSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+
+    EXPECT_EQ(blockSize, pageFaultManager->memoryData[alloc].blockSize);
+    EXPECT_EQ(4u, pageFaultManager->memoryData[alloc].cpuBlocks.size());
+    for (auto cpuBlock : pageFaultManager->memoryData[alloc].cpuBlocks) {
+        EXPECT_TRUE(cpuBlock);
+    }
+    EXPECT_EQ(0u, pageFaultManager->memoryData[smallAlloc].blockSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[smallAlloc].cpuBlocks.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationBlockSizeSetAndAubHandlerSelectedWhenInsertingAllocationThenWholeAllocationIsMigrated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmMigrationBlockSize.set(64);
+    pageFaultManager->gpuDomainHandler = &MockPageFaultManager::handleGpuDomainTransferForAubAndTbx;
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    pageFaultManager->insertAllocation(alloc, 4 * 64 * MemoryConstants::kiloByte, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+
+    EXPECT_EQ(0u, pageFaultManager->memoryData[alloc].blockSize);
+}
+
+TEST_F(PageFaultManagerTest, givenBlockTrackedAllocationInGpuDomainWhenPageFaultOccursThenOnlyFaultingBlockIsMigratedToCpu) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmMigrationBlockSize.set(64);
+
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    size_t blockSize = 64 * MemoryConstants::kiloByte;
+    size_t allocSize = 4 * blockSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(0u, pageFaultManager->transferRangeToGpuOffset);
+    EXPECT_EQ(allocSize, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(allocSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+
+    auto faultAddress = ptrOffset(alloc, 2 * blockSize + 10);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(faultAddress));
+
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(2 * blockSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(blockSize, pageFaultManager->transferRangeToCpuSize);
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(ptrOffset(alloc, 2 * blockSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(blockSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(2, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(2 * blockSize, pageFaultManager->transferRangeToGpuOffset);
+    EXPECT_EQ(blockSize, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(allocSize + blockSize, pageFaultManager->transferredToGpuSize);
+    EXPECT_EQ(ptrOffset(alloc, 2 * blockSize), pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(blockSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData[alloc].domain);
+}
+
+TEST_F(PageFaultManagerTest, givenPrefetchBlocksSetWhenPageFaultOccursOnBlockTrackedAllocationThenFollowingBlocksAreMigratedWithinAllocation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmMigrationBlockSize.set(64);
+    DebugManager.flags.UsmMigrationPrefetchBlocks.set(2);
+
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    size_t blockSize = 64 * MemoryConstants::kiloByte;
+    size_t allocSize = 3 * blockSize + MemoryConstants::pageSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->memoryData[alloc].domain = PageFaultManager::AllocationDomain::Gpu;
+    pageFaultManager->memoryData[alloc].cpuBlocks.assign(4, false);
+    pageFaultManager->memoryData[alloc].cpuBlocks[2] = true;
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, blockSize)));
+
+    EXPECT_EQ(2, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(blockSize + MemoryConstants::pageSize, pageFaultManager->transferredToCpuSize);
+    EXPECT_EQ(3 * blockSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferRangeToCpuSize);
+    EXPECT_EQ(2, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_FALSE(pageFaultManager->memoryData[alloc].cpuBlocks[0]);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].cpuBlocks[1]);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].cpuBlocks[3]);
+}
+
+TEST_F(PageFaultManagerTest, givenBlockTrackedAllocationWithInitialPlacementGpuWhenPageFaultOccursThenBlockIsUnprotectedWithoutTransfer) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmMigrationBlockSize.set(64);
+
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    size_t blockSize = 64 * MemoryConstants::kiloByte;
+
+    MemoryProperties memoryProperties{};
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 4 * blockSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, memoryProperties);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+    EXPECT_EQ(0, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(blockSize, pageFaultManager->accessAllowedSize);
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(2, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(4 * blockSize, pageFaultManager->accessAllowedSize);
+}
+
+TEST_F(PageFaultManagerTest, givenReadMostlyAllocationInGpuDomainWhenPageFaultOccursThenAllocationIsDuplicatedAndMovedBackWithoutTransfer) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    size_t allocSize = 4 * MemoryConstants::pageSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->setReadMostly(alloc, true);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryReadAccessCalled);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryReadAccessAddress);
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::CpuReadOnly, pageFaultManager->memoryData[alloc].domain);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(2, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData[alloc].domain);
+}
+
+TEST_F(PageFaultManagerTest, givenDuplicatedReadMostlyAllocationWhenCpuWritesThenAllocationIsMovedToCpuDomainAndTransferredBack) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    size_t allocSize = 4 * MemoryConstants::pageSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->setReadMostly(alloc, true);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(allocSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(2, pageFaultManager->transferToGpuCalled);
+
+    pageFaultManager->setReadMostly(alloc, false);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+    EXPECT_EQ(2, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryReadAccessCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+}
+
+TEST_F(PageFaultManagerTest, givenDuplicatedReadMostlyAllocationWhenRemovingThenCpuAccessIsAllowed) {
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, MemoryConstants::pageSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->setReadMostly(alloc, true);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+}
+
+TEST_F(PageFaultManagerTest, givenGpuPreferredLocationWhenPageFaultOccursThenOnlyFaultingBlockIsMigratedToCpu) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    size_t blockSize = PageFaultManager::preferredLocationBlockSize;
+    size_t allocSize = 4 * blockSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+
+    pageFaultManager->setPreferredGpuLocation(alloc, true);
+    EXPECT_EQ(blockSize, pageFaultManager->memoryData[alloc].blockSize);
+    EXPECT_EQ(4u, pageFaultManager->memoryData[alloc].cpuBlocks.size());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, blockSize + 10)));
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(blockSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(blockSize, pageFaultManager->transferRangeToCpuSize);
+
+    pageFaultManager->setPreferredGpuLocation(alloc, false);
+    EXPECT_EQ(0u, pageFaultManager->memoryData[alloc].blockSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].cpuBlocks.empty());
+    EXPECT_EQ(3, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(allocSize, pageFaultManager->transferredToCpuSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+}
+
+TEST_F(PageFaultManagerTest, givenSmallAllocationOrAubHandlerWhenSettingGpuPreferredLocationThenBlocksAreNotTracked) {
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    void *smallAlloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(smallAlloc, PageFaultManager::preferredLocationBlockSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->setPreferredGpuLocation(smallAlloc, true);
+    EXPECT_EQ(0u, pageFaultManager->memoryData[smallAlloc].blockSize);
+
+    pageFaultManager->gpuDomainHandler = &MockPageFaultManager::handleGpuDomainTransferForAubAndTbx;
+    pageFaultManager->insertAllocation(alloc, 4 * PageFaultManager::preferredLocationBlockSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->setPreferredGpuLocation(alloc, true);
+    EXPECT_EQ(0u, pageFaultManager->memoryData[alloc].blockSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].gpuPreferred);
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableIsCalledThenAllocIsAubWritable) {
     MockExecutionEnvironment executionEnvironment;
     REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
@@ -27,6 +27,10 @@ class MockPageFaultManager : public PageFaultManager {
         allowedMemoryAccessAddress = ptr;
         accessAllowedSize = size;
     }
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override {
+        allowMemoryReadAccessCalled++;
+        allowedMemoryReadAccessAddress = ptr;
+    }
     void protectCPUMemoryAccess(void *ptr, size_t size) override {
         protectMemoryCalled++;
         protectedMemoryAccessAddress = ptr;
@@ -41,6 +45,18 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToCpuCalled++;
+        transferredToCpuSize += size;
+        transferRangeToCpuOffset = offset;
+        transferRangeToCpuSize = size;
+    }
+    void transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToGpuCalled++;
+        transferredToGpuSize += size;
+        transferRangeToGpuOffset = offset;
+        transferRangeToGpuSize = size;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -64,14 +80,24 @@ class MockPageFaultManager : public PageFaultManager {
     }
 
     int allowMemoryAccessCalled = 0;
+    int allowMemoryReadAccessCalled = 0;
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferRangeToCpuCalled = 0;
+    int transferRangeToGpuCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
+    void *allowedMemoryReadAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferRangeToCpuOffset = 0;
+    size_t transferRangeToCpuSize = 0;
+    size_t transferRangeToGpuOffset = 0;
+    size_t transferRangeToGpuSize = 0;
+    size_t transferredToCpuSize = 0;
+    size_t transferredToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
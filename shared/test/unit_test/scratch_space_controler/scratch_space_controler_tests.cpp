@@ -6,6 +6,9 @@
  */
 
 #include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 
@@ -82,4 +85,82 @@ HWTEST_F(ScratchComtrolerTests, givenCommandQueueWhenProgramHeapBindlessCalledTh
     scratchController->programBindlessSurfaceStateForScratch(nullptr, 0, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty, scratchController->residencyContainer);
 
     EXPECT_TRUE(static_cast<MockScratchSpaceControllerBase *>(scratchController.get())->programBindlessSurfaceStateForScratchCalled);
-}
\ No newline at end of file
+}
+
+using ScratchSpacePoolTests = Test<DeviceFixture>;
+
+TEST_F(ScratchSpacePoolTests, givenReleasedIdleAllocationWhenObtainingAllocationOfNotBiggerSizeThenAllocationIsReused) {
+    ScratchSpacePool pool(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment());
+
+    auto allocation = pool.obtainAllocation(MemoryConstants::pageSize64k, pDevice->getDeviceBitfield());
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(GraphicsAllocation::AllocationType::SCRATCH_SURFACE, allocation->getAllocationType());
+    auto allocatedBytes = pool.getAllocatedBytes();
+    EXPECT_LE(MemoryConstants::pageSize64k, allocatedBytes);
+
+    pool.releaseAllocation(allocation, pDevice->getDeviceBitfield());
+    EXPECT_EQ(allocatedBytes, pool.getPooledBytes());
+
+    EXPECT_EQ(allocation, pool.obtainAllocation(MemoryConstants::pageSize, pDevice->getDeviceBitfield()));
+    EXPECT_EQ(allocatedBytes, pool.getAllocatedBytes());
+    EXPECT_EQ(allocatedBytes, pool.getPeakAllocatedBytes());
+    EXPECT_EQ(0u, pool.getPooledBytes());
+
+    pool.releaseAllocation(allocation, pDevice->getDeviceBitfield());
+}
+
+TEST_F(ScratchSpacePoolTests, givenReleasedAllocationStillUsedByGpuWhenObtainingAllocationThenNewAllocationIsCreated) {
+    ScratchSpacePool pool(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment());
+    auto &engine = pDevice->getDefaultEngine();
+
+    auto allocation = pool.obtainAllocation(MemoryConstants::pageSize, pDevice->getDeviceBitfield());
+    allocation->updateTaskCount(*engine.commandStreamReceiver->getTagAddress() + 1, engine.osContext->getContextId());
+    pool.releaseAllocation(allocation, pDevice->getDeviceBitfield());
+
+    auto newAllocation = pool.obtainAllocation(MemoryConstants::pageSize, pDevice->getDeviceBitfield());
+    EXPECT_NE(allocation, newAllocation);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize() + newAllocation->getUnderlyingBufferSize(), pool.getAllocatedBytes());
+
+    allocation->updateTaskCount(*engine.commandStreamReceiver->getTagAddress(), engine.osContext->getContextId());
+    pool.releaseAllocation(newAllocation, pDevice->getDeviceBitfield());
+}
+
+TEST_F(ScratchSpacePoolTests, givenPoolSizeLimitWhenReleasingAllocationOverLimitThenAllocationIsFreed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ScratchSpacePoolSizeLimit.set(0);
+    ScratchSpacePool pool(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment());
+
+    auto allocation = pool.obtainAllocation(MemoryConstants::pageSize, pDevice->getDeviceBitfield());
+    EXPECT_NE(0u, pool.getAllocatedBytes());
+
+    pool.releaseAllocation(allocation, pDevice->getDeviceBitfield());
+    EXPECT_EQ(0u, pool.getPooledBytes());
+    EXPECT_EQ(0u, pool.getAllocatedBytes());
+    EXPECT_NE(0u, pool.getPeakAllocatedBytes());
+}
+
+HWTEST_F(ScratchSpacePoolTests, givenScratchSpacePoolEnabledWhenScratchControllerIsDestroyedThenNextControllerReusesItsScratchAllocation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableScratchSpacePool.set(1);
+
+    MockCsrHw2<FamilyType> csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+    auto execEnv = pDevice->getExecutionEnvironment();
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    auto scratchController = std::make_unique<MockScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+    scratchController->setRequiredScratchSpace(nullptr, 0, 0x400, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    auto allocation = scratchController->getScratchSpaceAllocation();
+    ASSERT_NE(nullptr, allocation);
+    scratchController.reset();
+
+    auto pool = execEnv->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->getScratchSpacePool(pDevice->getRootDeviceIndex());
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), pool->getPooledBytes());
+
+    scratchController = std::make_unique<MockScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+    scratchController->setRequiredScratchSpace(nullptr, 0, 0x400, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    EXPECT_EQ(allocation, scratchController->getScratchSpaceAllocation());
+    EXPECT_EQ(0u, pool->getPooledBytes());
+}
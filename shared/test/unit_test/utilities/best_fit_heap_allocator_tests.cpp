@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/best_fit_heap_allocator.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include "test.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+const uint64_t heapBase = 0x100000000llu;
+const size_t heapSize = 64 * MemoryConstants::megaByte;
+} // namespace
+
+TEST(BestFitHeapAllocatorTest, givenEmptyHeapWhenAllocatingThenAddressesFromHeapBaseAreReturnedAndUsageIsUpdated) {
+    BestFitHeapAllocator heapAllocator(heapBase, heapSize, MemoryConstants::pageSize);
+
+    size_t size = 100u;
+    auto ptr = heapAllocator.allocate(size);
+    EXPECT_EQ(heapBase, ptr);
+    EXPECT_EQ(MemoryConstants::pageSize, size);
+
+    size = MemoryConstants::pageSize;
+    auto ptr2 = heapAllocator.allocate(size);
+    EXPECT_EQ(heapBase + MemoryConstants::pageSize, ptr2);
+
+    EXPECT_EQ(2 * MemoryConstants::pageSize, heapAllocator.getUsedSize());
+    EXPECT_EQ(heapSize - 2 * MemoryConstants::pageSize, heapAllocator.getLeftSize());
+
+    heapAllocator.free(ptr, MemoryConstants::pageSize);
+    heapAllocator.free(ptr2, MemoryConstants::pageSize);
+    EXPECT_EQ(0u, heapAllocator.getUsedSize());
+    EXPECT_EQ(1u, heapAllocator.getFreeRangesCount());
+}
+
+TEST(BestFitHeapAllocatorTest, givenZeroSizeOrTooBigRequestWhenAllocatingThenNullAddressIsReturned) {
+    BestFitHeapAllocator heapAllocator(heapBase, heapSize, MemoryConstants::pageSize);
+
+    size_t size = 0u;
+    EXPECT_EQ(0llu, heapAllocator.allocate(size));
+
+    size = heapSize + MemoryConstants::pageSize;
+    EXPECT_EQ(0llu, heapAllocator.allocate(size));
+
+    size = heapSize;
+    EXPECT_EQ(heapBase, heapAllocator.allocate(size));
+
+    size = MemoryConstants::pageSize;
+    EXPECT_EQ(0llu, heapAllocator.allocate(size));
+}
+
+TEST(BestFitHeapAllocatorTest, givenFragmentedHeapWhenAllocatingThenSmallestFittingFreeRangeIsUsed) {
+    BestFitHeapAllocator heapAllocator(heapBase, heapSize, MemoryConstants::pageSize);
+
+    uint64_t ptrs[6] = {};
+    const size_t sizes[6] = {4 * MemoryConstants::pageSize, MemoryConstants::pageSize,
+                             2 * MemoryConstants::pageSize, MemoryConstants::pageSize,
+                             3 * MemoryConstants::pageSize, MemoryConstants::pageSize};
+    for (auto i = 0u; i < 6u; i++) {
+        size_t size = sizes[i];
+        ptrs[i] = heapAllocator.allocate(size);
+        ASSERT_NE(0llu, ptrs[i]);
+    }
+    heapAllocator.free(ptrs[0], sizes[0]);
+    heapAllocator.free(ptrs[2], sizes[2]);
+    heapAllocator.free(ptrs[4], sizes[4]);
+
+    size_t size = 2 * MemoryConstants::pageSize;
+    EXPECT_EQ(ptrs[2], heapAllocator.allocate(size));
+
+    size = 2 * MemoryConstants::pageSize;
+    EXPECT_EQ(ptrs[4], heapAllocator.allocate(size));
+
+    size = 2 * MemoryConstants::pageSize;
+    EXPECT_EQ(ptrs[0], heapAllocator.allocate(size));
+    EXPECT_EQ(2 * MemoryConstants::pageSize, size);
+}
+
+TEST(BestFitHeapAllocatorTest, givenNeighbouringFreedRangesWhenFreeingRangeBetweenThemThenAllRangesAreCoalesced) {
+    BestFitHeapAllocator heapAllocator(heapBase, heapSize, MemoryConstants::pageSize);
+
+    uint64_t ptrs[4] = {};
+    for (auto &ptr : ptrs) {
+        size_t size = MemoryConstants::pageSize;
+        ptr = heapAllocator.allocate(size);
+    }
+    heapAllocator.free(ptrs[0], MemoryConstants::pageSize);
+    heapAllocator.free(ptrs[2], MemoryConstants::pageSize);
+    EXPECT_EQ(3u, heapAllocator.getFreeRangesCount());
+
+    heapAllocator.free(ptrs[1], MemoryConstants::pageSize);
+    EXPECT_EQ(2u, heapAllocator.getFreeRangesCount());
+
+    size_t size = 3 * MemoryConstants::pageSize;
+    EXPECT_EQ(ptrs[0], heapAllocator.allocate(size));
+
+    heapAllocator.free(ptrs[0], 3 * MemoryConstants::pageSize);
+    heapAllocator.free(ptrs[3], MemoryConstants::pageSize);
+    EXPECT_EQ(1u, heapAllocator.getFreeRangesCount());
+
+    size = heapSize;
+    EXPECT_EQ(heapBase, heapAllocator.allocate(size));
+}
+
+TEST(BestFitHeapAllocatorTest, givenAllocationAlignmentWhenAllocatingThenSizesAndAddressesAreAligned) {
+    const size_t alignment = MemoryConstants::pageSize64k;
+    BestFitHeapAllocator heapAllocator(heapBase, heapSize, alignment);
+
+    for (auto i = 0u; i < 16u; i++) {
+        size_t size = MemoryConstants::pageSize * (i + 1);
+        auto ptr = heapAllocator.allocate(size);
+        EXPECT_EQ(0u, ptr % alignment);
+        EXPECT_EQ(0u, size % alignment);
+    }
+}
+
+TEST(BestFitHeapAllocatorTest, givenNullAddressWhenFreeingThenNothingChanges) {
+    BestFitHeapAllocator heapAllocator(heapBase, heapSize, MemoryConstants::pageSize);
+    heapAllocator.free(0llu, MemoryConstants::pageSize);
+    EXPECT_EQ(heapSize, heapAllocator.getLeftSize());
+    EXPECT_EQ(1u, heapAllocator.getFreeRangesCount());
+}
+
+template <typename AllocatorT>
+int64_t measureFragmentedAllocations(AllocatorT &heapAllocator, uint32_t seed) {
+    constexpr uint32_t initialAllocations = 20000u;
+    constexpr uint32_t churnIterations = 200000u;
+
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> pages(1, 64);
+
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    allocations.reserve(initialAllocations);
+    for (auto i = 0u; i < initialAllocations; i++) {
+        size_t size = pages(generator) * MemoryConstants::pageSize;
+        auto ptr = heapAllocator.allocate(size);
+        if (ptr) {
+            allocations.push_back({ptr, size});
+        }
+    }
+    for (auto i = 0u; i < allocations.size(); i += 2) {
+        heapAllocator.free(allocations[i].first, allocations[i].second);
+        allocations[i].first = 0llu;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto i = 0u; i < churnIterations; i++) {
+        auto &allocation = allocations[generator() % allocations.size()];
+        if (allocation.first) {
+            heapAllocator.free(allocation.first, allocation.second);
+            allocation.first = 0llu;
+        } else {
+            allocation.second = pages(generator) * MemoryConstants::pageSize;
+            allocation.first = heapAllocator.allocate(allocation.second);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    for (auto &allocation : allocations) {
+        heapAllocator.free(allocation.first, allocation.second);
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+TEST(BestFitHeapAllocatorTest, DISABLED_profilingFragmentedAllocationsWithHeapAllocatorVsBestFitHeapAllocator) {
+    const uint64_t benchmarkHeapSize = 4 * MemoryConstants::gigaByte;
+    const uint32_t seed = 0x1234u;
+
+    HeapAllocator heapAllocator(heapBase, benchmarkHeapSize, MemoryConstants::pageSize);
+    auto heapAllocatorTime = measureFragmentedAllocations(heapAllocator, seed);
+
+    BestFitHeapAllocator bestFitHeapAllocator(heapBase, benchmarkHeapSize, MemoryConstants::pageSize);
+    auto bestFitHeapAllocatorTime = measureFragmentedAllocations(bestFitHeapAllocator, seed);
+
+    EXPECT_EQ(0u, bestFitHeapAllocator.getUsedSize());
+    EXPECT_EQ(1u, bestFitHeapAllocator.getFreeRangesCount());
+
+    std::cout << "HeapAllocator: " << heapAllocatorTime << " us" << std::endl
+              << "BestFitHeapAllocator: " << bestFitHeapAllocatorTime << " us" << std::endl;
+}
@@ -8,6 +8,7 @@
 #include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/iflist.h"
+#include "shared/source/utilities/lock_free_stack.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/stackvec.h"
 #include "shared/test/unit_test/utilities/containers_tests_helpers.h"
@@ -18,6 +19,7 @@
 #include <cinttypes>
 #include <memory>
 #include <numeric>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -1000,6 +1002,60 @@ void iDRefListTestPushFrontOne() {
     list.reset();
 }
 
+TEST(LockFreeStack, WhenPushingAndRemovingNodesThenLastPushedNodeIsReturnedFirst) {
+    DummyFNode nodes[3];
+    LockFreeStack<DummyFNode> stack;
+    EXPECT_TRUE(stack.peekIsEmpty());
+    EXPECT_EQ(nullptr, stack.removeFrontOne());
+
+    nodes[1].next = &nodes[2];
+    stack.pushFrontChain(nodes[1], nodes[2]);
+    stack.pushFrontOne(nodes[0]);
+    EXPECT_EQ(&nodes[0], stack.peekHead());
+    EXPECT_TRUE(stack.peekContains(nodes[2]));
+
+    EXPECT_EQ(&nodes[0], stack.removeFrontOne());
+    EXPECT_EQ(nullptr, nodes[0].next);
+    EXPECT_FALSE(stack.peekContains(nodes[0]));
+
+    auto detached = stack.detachNodes();
+    EXPECT_EQ(&nodes[1], detached);
+    EXPECT_EQ(&nodes[2], detached->next);
+    EXPECT_TRUE(stack.peekIsEmpty());
+}
+
+TEST(LockFreeStack, GivenMultipleThreadsWhenNodesAreRemovedAndPushedBackThenNoNodeIsLost) {
+    constexpr size_t nodesCount = 64;
+    constexpr size_t threadsCount = 4;
+    constexpr size_t iterations = 1000;
+    DummyFNode nodes[nodesCount];
+    LockFreeStack<DummyFNode> stack;
+    for (auto &node : nodes) {
+        stack.pushFrontOne(node);
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back([&stack]() {
+            for (size_t j = 0; j < iterations; j++) {
+                auto node = stack.removeFrontOne();
+                if (node) {
+                    stack.pushFrontOne(*node);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    size_t nodesFound = 0;
+    for (auto node = stack.peekHead(); node != nullptr; node = node->next) {
+        nodesFound++;
+    }
+    EXPECT_EQ(nodesCount, nodesFound);
+}
+
 TEST(IDRefList, GivenThreadSafeWhenPushingFrontOneThenResultIsCorrect) {
     iDRefListTestPushFrontOne<true>();
 }
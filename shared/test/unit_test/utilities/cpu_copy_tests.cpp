@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(CpuCopyTest, givenUnalignedPointersWhenCopyingNonTemporalThenAllBytesAreCopiedAndGuardBytesAreUntouched) {
+    for (size_t size : {0u, 1u, 15u, 64u, 100u, 4097u}) {
+        auto src = createPattern(size + 1);
+        std::vector<uint8_t> dst(size + 3, 0xcd);
+
+        CpuCopy::copyNonTemporal(dst.data() + 1, src.data() + 1, size);
+
+        EXPECT_EQ(0xcd, dst[0]);
+        EXPECT_EQ(0, memcmp(dst.data() + 1, src.data() + 1, size));
+        EXPECT_EQ(0xcd, dst[size + 1]);
+        EXPECT_EQ(0xcd, dst[size + 2]);
+    }
+}
+
+TEST(CpuCopyTest, givenCopyAboveThresholdsWhenCopyingThenDataIsSplitAcrossChunksAndCopiedCompletely) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CpuCopyParallelThreshold.set(0);
+    DebugManager.flags.CpuCopyNonTemporalThreshold.set(0);
+    EXPECT_EQ(0u, CpuCopy::getParallelThreshold());
+    EXPECT_EQ(0u, CpuCopy::getNonTemporalThreshold());
+
+    size_t size = 3 * CpuCopy::minChunkSize + 5;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0);
+
+    CpuCopy::copy(dst.data(), src.data(), size);
+    EXPECT_EQ(src, dst);
+}
+
+TEST(CpuCopyTest, givenDefaultFlagsWhenGettingThresholdsThenDefaultValuesAreReturned) {
+    EXPECT_EQ(CpuCopy::defaultParallelThreshold, CpuCopy::getParallelThreshold());
+    EXPECT_LE(CpuCopy::defaultNonTemporalThreshold, CpuCopy::getNonTemporalThreshold());
+}
+
+TEST(CpuCopyTest, givenPitchedRowsWhenCopyingRowsThenOnlyRowBytesAreCopied) {
+    constexpr size_t rowSize = 100;
+    constexpr size_t srcRowPitch = 128;
+    constexpr size_t dstRowPitch = 160;
+    constexpr size_t rowsCount = 5;
+    auto src = createPattern(srcRowPitch * rowsCount);
+
+    for (auto thresholds : {-1, 0}) {
+        DebugManagerStateRestore restore;
+        DebugManager.flags.CpuCopyParallelThreshold.set(thresholds);
+        DebugManager.flags.CpuCopyNonTemporalThreshold.set(thresholds);
+
+        std::vector<uint8_t> dst(dstRowPitch * rowsCount, 0xcd);
+        CpuCopy::copyRows(dst.data(), dstRowPitch, src.data(), srcRowPitch, rowSize, rowsCount);
+
+        for (size_t row = 0; row < rowsCount; row++) {
+            EXPECT_EQ(0, memcmp(&dst[row * dstRowPitch], &src[row * srcRowPitch], rowSize));
+            for (size_t i = rowSize; i < dstRowPitch; i++) {
+                EXPECT_EQ(0xcd, dst[row * dstRowPitch + i]);
+            }
+        }
+    }
+}
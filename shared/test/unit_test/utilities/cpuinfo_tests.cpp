@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -75,6 +75,7 @@ TEST(CpuInfoTest, giveFunctionIsNotAvailableWhenFeatureIsNotSupportedThenMaskBit
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }
@@ -111,6 +112,7 @@ TEST(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitIsO
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }
@@ -147,6 +149,7 @@ TEST(CpuInfoTest, whenFeatureIsSupportedThenMaskBitIsOn) {
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }
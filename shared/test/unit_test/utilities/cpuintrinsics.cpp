@@ -14,6 +14,7 @@ namespace CpuIntrinsicsTests {
 //std::atomic is used for sake of sanitation in MT tests
 std::atomic<uintptr_t> lastClFlushedPtr(0u);
 std::atomic<uint32_t> pauseCounter(0u);
+std::atomic<uint32_t> umwaitCounter(0u);
 
 volatile uint32_t *pauseAddress = nullptr;
 uint32_t pauseValue = 0u;
@@ -33,5 +34,10 @@ void pause() {
     }
 }
 
+bool umwait(volatile void *monitorAddress, uint64_t timestampCounterDelta) {
+    CpuIntrinsicsTests::umwaitCounter++;
+    return true;
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
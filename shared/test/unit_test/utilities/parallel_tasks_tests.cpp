@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_tasks.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelTasksTest, givenMultipleTasksWhenRunningParallelTasksThenEachTaskIsExecutedOnce) {
+    std::vector<std::atomic<uint32_t>> executions(16);
+    for (auto &execution : executions) {
+        execution = 0;
+    }
+    auto task = [&](size_t taskId) {
+        executions[taskId]++;
+    };
+
+    runParallelTasks(executions.size(), 4, task);
+
+    for (auto &execution : executions) {
+        EXPECT_EQ(1u, execution.load());
+    }
+}
+
+TEST(ParallelTasksTest, givenSingleWorkerWhenRunningParallelTasksThenTasksAreExecutedInOrderOnCallingThread) {
+    auto callingThreadId = std::this_thread::get_id();
+    std::vector<size_t> executedTasks;
+    bool executedOnCallingThread = true;
+    auto task = [&](size_t taskId) {
+        executedOnCallingThread &= (std::this_thread::get_id() == callingThreadId);
+        executedTasks.push_back(taskId);
+    };
+
+    runParallelTasks(3, 1, task);
+
+    EXPECT_TRUE(executedOnCallingThread);
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2}), executedTasks);
+}
+
+TEST(ParallelTasksTest, givenZeroWorkersWhenRunningParallelTasksThenTasksAreExecutedOnCallingThread) {
+    size_t executedTasks = 0;
+    auto task = [&](size_t taskId) {
+        executedTasks++;
+    };
+
+    runParallelTasks(2, 0, task);
+    EXPECT_EQ(2u, executedTasks);
+
+    runParallelTasks(0, 4, task);
+    EXPECT_EQ(2u, executedTasks);
+}
@@ -1,17 +1,19 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/utilities/perf_profiler.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "test.h"
 
 #include "gtest/gtest.h"
 
 #include <chrono>
+#include <limits>
 #include <thread>
 
 using namespace NEO;
@@ -290,3 +292,84 @@ TEST(PerfProfiler, GivenSysLogBuilderWhenReadingAndWritingThenLogIsCorrect) {
     EXPECT_EQ(timeW, timeR);
     EXPECT_EQ(idW, idR);
 }
+
+TEST(ApiLatencyProfiler, givenLatencyWhenGettingBucketIndexThenLog2OfLatencyLimitedToLastBucketIsReturned) {
+    EXPECT_EQ(0u, ApiLatencyProfiler::getBucketIndex(0));
+    EXPECT_EQ(0u, ApiLatencyProfiler::getBucketIndex(1));
+    EXPECT_EQ(1u, ApiLatencyProfiler::getBucketIndex(3));
+    EXPECT_EQ(10u, ApiLatencyProfiler::getBucketIndex(1024));
+    EXPECT_EQ(ApiLatencyProfiler::bucketsCount - 1, ApiLatencyProfiler::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(ApiLatencyProfiler, givenSameApiNameWhenRegisteringApiThenSameIdIsReturned) {
+    auto apiId = ApiLatencyProfiler::registerApi("apiLatencyProfilerTestApi");
+    EXPECT_EQ(apiId, ApiLatencyProfiler::registerApi("apiLatencyProfilerTestApi"));
+    EXPECT_NE(apiId, ApiLatencyProfiler::registerApi("apiLatencyProfilerOtherTestApi"));
+    EXPECT_STREQ("apiLatencyProfilerTestApi", ApiLatencyProfiler::getApiName(apiId));
+}
+
+TEST(ApiLatencyProfiler, givenLatenciesRecordedByTwoThreadsWhenQueryingHistogramThenCountsOfBothThreadsAreSummed) {
+    auto apiId = ApiLatencyProfiler::registerApi("apiLatencyProfilerTestApi");
+
+    ApiLatencyProfiler::record(apiId, 1024);
+    std::thread thread([apiId]() {
+        ApiLatencyProfiler::record(apiId, 1500);
+        ApiLatencyProfiler::record(apiId, 10);
+    });
+    thread.join();
+
+    EXPECT_EQ(2u, ApiLatencyProfiler::getThreadsCount());
+    EXPECT_EQ(3u, ApiLatencyProfiler::getCallsCount(apiId));
+    EXPECT_EQ(2u, ApiLatencyProfiler::getBucketCount(apiId, 10));
+    EXPECT_EQ(1u, ApiLatencyProfiler::getBucketCount(apiId, 3));
+
+    ApiLatencyProfiler::destroyAll();
+    EXPECT_EQ(0u, ApiLatencyProfiler::getThreadsCount());
+}
+
+TEST(ApiLatencyProfiler, givenHistogramsDestroyedWhenRecordingAgainThenCountingStartsFromZero) {
+    auto apiId = ApiLatencyProfiler::registerApi("apiLatencyProfilerTestApi");
+
+    ApiLatencyProfiler::record(apiId, 1);
+    ApiLatencyProfiler::destroyAll();
+    ApiLatencyProfiler::record(apiId, 1);
+
+    EXPECT_EQ(1u, ApiLatencyProfiler::getThreadsCount());
+    EXPECT_EQ(1u, ApiLatencyProfiler::getCallsCount(apiId));
+
+    ApiLatencyProfiler::destroyAll();
+}
+
+TEST(ApiLatencyProfiler, givenHistogramsEnabledWhenWrapperIsDestroyedThenCallIsRecorded) {
+    DebugManagerStateRestore restorer;
+    auto apiId = ApiLatencyProfiler::registerApi("apiLatencyProfilerTestApi");
+
+    {
+        ApiLatencyProfilerWrapper wrapper(apiId);
+    }
+    EXPECT_EQ(0u, ApiLatencyProfiler::getThreadsCount());
+
+    DebugManager.flags.EnableApiLatencyHistograms.set(1);
+    {
+        ApiLatencyProfilerWrapper wrapper(apiId);
+    }
+    EXPECT_EQ(1u, ApiLatencyProfiler::getCallsCount(apiId));
+
+    ApiLatencyProfiler::destroyAll();
+}
+
+TEST(ApiLatencyProfiler, givenRecordedCallsWhenDumpingThenOnlyCalledApisAreWritten) {
+    auto apiId = ApiLatencyProfiler::registerApi("apiLatencyProfilerTestApi");
+    ApiLatencyProfiler::registerApi("apiLatencyProfilerOtherTestApi");
+    ApiLatencyProfiler::record(apiId, 2);
+
+    std::stringstream out;
+    ApiLatencyProfiler::dump(out);
+    auto dump = out.str();
+
+    EXPECT_EQ(0u, dump.find("api,calls,<2ns,<4ns"));
+    EXPECT_NE(std::string::npos, dump.find("apiLatencyProfilerTestApi,1,0,1,0"));
+    EXPECT_EQ(std::string::npos, dump.find("apiLatencyProfilerOtherTestApi"));
+
+    ApiLatencyProfiler::destroyAll();
+}
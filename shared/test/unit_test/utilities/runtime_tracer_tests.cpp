@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/runtime_tracer.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace NEO;
+
+namespace {
+size_t countOccurrences(const std::string &text, const std::string &token) {
+    size_t count = 0;
+    for (auto position = text.find(token); position != std::string::npos; position = text.find(token, position + 1)) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+TEST(RuntimeTracer, givenTracingDisabledWhenTraceScopeEndsThenNothingIsRecorded) {
+    {
+        RUNTIME_TRACE_SCOPE("disabledScope");
+    }
+    EXPECT_EQ(0u, RuntimeTracer::getThreadsCount());
+}
+
+TEST(RuntimeTracer, givenTracingEnabledWhenTraceScopeEndsThenCompleteEventIsDumped) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableRuntimeTracing.set(1);
+
+    {
+        RUNTIME_TRACE_SCOPE("enabledScope");
+    }
+    EXPECT_EQ(1u, RuntimeTracer::getThreadsCount());
+
+    std::stringstream out;
+    RuntimeTracer::dump(out);
+    auto trace = out.str();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"enabledScope\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"));
+    EXPECT_NE(std::string::npos, trace.find("\"displayTimeUnit\":\"ns\"}"));
+
+    RuntimeTracer::destroyAll();
+    EXPECT_EQ(0u, RuntimeTracer::getThreadsCount());
+}
+
+TEST(RuntimeTracer, givenIntervalsFromTwoThreadsWhenDumpingThenEachThreadHasOwnTrack) {
+    RuntimeTracer::addHostInterval("mainThreadInterval", 1000, 2000);
+    std::thread thread([]() {
+        RuntimeTracer::addHostInterval("otherThreadInterval", 1500, 500);
+    });
+    thread.join();
+
+    std::stringstream out;
+    RuntimeTracer::dump(out);
+    auto trace = out.str();
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"mainThreadInterval\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":1.0,\"dur\":2.0}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"otherThreadInterval\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":1.5,\"dur\":0.5}"));
+
+    RuntimeTracer::destroyAll();
+}
+
+TEST(RuntimeTracer, givenGpuIntervalWhenDumpingThenIntervalIsOnEngineTrackWithCommandArgument) {
+    RuntimeTracer::addGpuInterval("gpuExecution", 3000, 1000, 2, 0x11F0);
+
+    std::stringstream out;
+    RuntimeTracer::dump(out);
+    std::stringstream expected;
+    expected << "{\"name\":\"gpuExecution\",\"ph\":\"X\",\"pid\":1,\"tid\":" << RuntimeTracer::gpuTrackBase + 2
+             << ",\"ts\":3.0,\"dur\":1.0,\"args\":{\"command\":" << 0x11F0 << "}}";
+    EXPECT_NE(std::string::npos, out.str().find(expected.str()));
+
+    RuntimeTracer::destroyAll();
+}
+
+TEST(RuntimeTracer, givenMoreIntervalsThanRingSizeWhenDumpingThenOnlyNewestIntervalsAreWritten) {
+    RuntimeTracer::addHostInterval("oldestInterval", 0, 1);
+    for (uint32_t i = 0; i < RuntimeTracer::ringSize; i++) {
+        RuntimeTracer::addHostInterval("interval", i, 1);
+    }
+
+    std::stringstream out;
+    RuntimeTracer::dump(out);
+    auto trace = out.str();
+    EXPECT_EQ(std::string::npos, trace.find("oldestInterval"));
+    EXPECT_EQ(static_cast<size_t>(RuntimeTracer::ringSize), countOccurrences(trace, "\"ph\":\"X\""));
+
+    RuntimeTracer::destroyAll();
+}
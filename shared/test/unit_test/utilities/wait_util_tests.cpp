@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/wait_util.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
@@ -17,6 +18,7 @@ using namespace NEO;
 
 namespace CpuIntrinsicsTests {
 extern std::atomic<uint32_t> pauseCounter;
+extern std::atomic<uint32_t> umwaitCounter;
 } // namespace CpuIntrinsicsTests
 
 TEST(WaitTest, givenDefaultSettingsWhenNoPollAddressProvidedThenPauseDefaultTimeAndReturnFalse) {
@@ -91,3 +93,57 @@ TEST(WaitTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsCriteriaThenPaus
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST(WaitTest, givenDebugFlagsSetWhenInitIsCalledThenDefaultWaitPolicyAndSpinTimeAreOverridden) {
+    DebugManagerStateRestore restore;
+    VariableBackup<WaitUtils::WaitPolicy> backupWaitPolicy(&WaitUtils::defaultWaitPolicy);
+    VariableBackup<int64_t> backupSpinMicroseconds(&WaitUtils::spinMicroseconds);
+
+    EXPECT_EQ(WaitUtils::WaitPolicy::spin, WaitUtils::defaultWaitPolicy);
+    EXPECT_EQ(WaitUtils::defaultSpinMicroseconds, WaitUtils::spinMicroseconds);
+
+    DebugManager.flags.HostWaitPolicy.set(1);
+    DebugManager.flags.HostWaitSpinMicroseconds.set(20);
+    WaitUtils::init();
+
+    EXPECT_EQ(WaitUtils::WaitPolicy::spinThenSleep, WaitUtils::defaultWaitPolicy);
+    EXPECT_EQ(20, WaitUtils::spinMicroseconds);
+}
+
+TEST(WaitTest, givenSpinPolicyWhenWaitingThenAlwaysSpin) {
+    EXPECT_EQ(WaitUtils::WaitStage::spin, WaitUtils::getWaitStage(WaitUtils::WaitPolicy::spin, 0));
+    EXPECT_EQ(WaitUtils::WaitStage::spin, WaitUtils::getWaitStage(WaitUtils::WaitPolicy::spin, 1000000));
+
+    volatile uint32_t pollValue = 0u;
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    WaitUtils::waitWithPolicy(WaitUtils::WaitPolicy::spin, &pollValue, 1000000);
+    EXPECT_EQ(oldPauseCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+}
+
+TEST(WaitTest, givenSpinThenSleepPolicyWhenElapsedTimeGrowsThenWaitStagesChangeFromSpinToSleep) {
+    auto policy = WaitUtils::WaitPolicy::spinThenSleep;
+    auto spinTime = WaitUtils::spinMicroseconds;
+    bool waitpkgSupported = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureWaitpkg);
+
+    EXPECT_EQ(WaitUtils::WaitStage::spin, WaitUtils::getWaitStage(policy, 0));
+    EXPECT_EQ(WaitUtils::WaitStage::spin, WaitUtils::getWaitStage(policy, spinTime - 1));
+    EXPECT_EQ(waitpkgSupported ? WaitUtils::WaitStage::monitorWait : WaitUtils::WaitStage::sleep, WaitUtils::getWaitStage(policy, spinTime));
+    EXPECT_EQ(WaitUtils::WaitStage::sleep, WaitUtils::getWaitStage(policy, spinTime + WaitUtils::monitorWaitMicroseconds));
+}
+
+TEST(WaitTest, givenSpinThenSleepPolicyWhenWaitingPastSpinTimeThenPauseIsNotCalled) {
+    volatile uint32_t pollValue = 0u;
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    bool waitpkgSupported = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureWaitpkg);
+
+    WaitUtils::waitWithPolicy(WaitUtils::WaitPolicy::spinThenSleep, &pollValue, WaitUtils::spinMicroseconds);
+    EXPECT_EQ(oldPauseCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount + (waitpkgSupported ? 1u : 0u), CpuIntrinsicsTests::umwaitCounter);
+
+    WaitUtils::waitWithPolicy(WaitUtils::WaitPolicy::spinThenSleep, &pollValue, WaitUtils::spinMicroseconds + WaitUtils::monitorWaitMicroseconds);
+    EXPECT_EQ(oldPauseCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount + (waitpkgSupported ? 1u : 0u), CpuIntrinsicsTests::umwaitCounter);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace NEO;
+
+TEST(WorkerPoolTest, givenEnqueuedTasksWhenWorkerPoolIsDestroyedThenAllTasksAreExecuted) {
+    std::atomic<uint32_t> executedTasks{0};
+    {
+        WorkerPool workerPool(2);
+        for (uint32_t i = 0; i < 10; i++) {
+            workerPool.enqueue([&]() { executedTasks++; });
+        }
+    }
+    EXPECT_EQ(10u, executedTasks.load());
+}
+
+TEST(WorkerPoolTest, givenMoreTasksThanMaxWorkersWhenEnqueuingThenWorkersCountIsLimited) {
+    std::atomic<bool> releaseTasks{false};
+    WorkerPool workerPool(2);
+    for (uint32_t i = 0; i < 5; i++) {
+        workerPool.enqueue([&]() {
+            while (!releaseTasks) {
+            }
+        });
+    }
+    EXPECT_EQ(2u, workerPool.getWorkersCount());
+    releaseTasks = true;
+}
+
+TEST(WorkerPoolTest, givenNoTasksWhenWorkerPoolIsCreatedThenNoWorkerIsCreated) {
+    WorkerPool workerPool(4);
+    EXPECT_EQ(0u, workerPool.getWorkersCount());
+}
+
+TEST(WorkerPoolTest, givenTasksOfClientsWithDifferentPrioritiesWhenWorkerIsBusyThenTaskOfHigherPriorityClientIsExecutedFirst) {
+    std::atomic<bool> blockingTaskStarted{false};
+    std::atomic<bool> releaseTasks{false};
+    std::vector<WorkerPoolClient> executionOrder;
+    {
+        WorkerPool workerPool(1);
+        workerPool.enqueue([&]() {
+            blockingTaskStarted = true;
+            while (!releaseTasks) {
+            }
+        });
+        while (!blockingTaskStarted) {
+        }
+        workerPool.enqueue(WorkerPoolClient::Build, [&]() { executionOrder.push_back(WorkerPoolClient::Build); });
+        workerPool.enqueue(WorkerPoolClient::Generic, [&]() { executionOrder.push_back(WorkerPoolClient::Generic); });
+        workerPool.enqueue(WorkerPoolClient::EventCallbacks, [&]() { executionOrder.push_back(WorkerPoolClient::EventCallbacks); });
+        releaseTasks = true;
+    }
+    ASSERT_EQ(3u, executionOrder.size());
+    EXPECT_EQ(WorkerPoolClient::EventCallbacks, executionOrder[0]);
+    EXPECT_EQ(WorkerPoolClient::Generic, executionOrder[1]);
+    EXPECT_EQ(WorkerPoolClient::Build, executionOrder[2]);
+}
+
+TEST(WorkerPoolTest, givenClientsWithEqualPrioritiesWhenWorkerIsBusyThenTasksAreExecutedInEnqueueOrder) {
+    std::atomic<bool> blockingTaskStarted{false};
+    std::atomic<bool> releaseTasks{false};
+    std::vector<WorkerPoolClient> executionOrder;
+    {
+        WorkerPool workerPool(1);
+        workerPool.setClientPriority(WorkerPoolClient::EventCallbacks, 2);
+        workerPool.enqueue([&]() {
+            blockingTaskStarted = true;
+            while (!releaseTasks) {
+            }
+        });
+        while (!blockingTaskStarted) {
+        }
+        workerPool.enqueue(WorkerPoolClient::Build, [&]() { executionOrder.push_back(WorkerPoolClient::Build); });
+        workerPool.enqueue(WorkerPoolClient::EventCallbacks, [&]() { executionOrder.push_back(WorkerPoolClient::EventCallbacks); });
+        releaseTasks = true;
+    }
+    ASSERT_EQ(2u, executionOrder.size());
+    EXPECT_EQ(WorkerPoolClient::Build, executionOrder[0]);
+    EXPECT_EQ(WorkerPoolClient::EventCallbacks, executionOrder[1]);
+}
+
+TEST(WorkerPoolTest, givenEnqueuedTasksWhenWaitingForClientTasksThenStatisticsOfClientAreUpdated) {
+    std::atomic<bool> releaseTasks{false};
+    WorkerPool workerPool(1);
+    for (uint32_t i = 0; i < 3; i++) {
+        workerPool.enqueue(WorkerPoolClient::Build, [&]() {
+            while (!releaseTasks) {
+            }
+        });
+    }
+    auto statistics = workerPool.getClientStatistics(WorkerPoolClient::Build);
+    EXPECT_EQ(3u, statistics.enqueuedTasks);
+    EXPECT_LE(2u, statistics.maxQueueDepth);
+
+    releaseTasks = true;
+    workerPool.waitForClientTasks(WorkerPoolClient::Build);
+    statistics = workerPool.getClientStatistics(WorkerPoolClient::Build);
+    EXPECT_EQ(3u, statistics.executedTasks);
+    EXPECT_EQ(0u, statistics.queueDepth);
+    EXPECT_EQ(0u, workerPool.getClientStatistics(WorkerPoolClient::EventCallbacks).enqueuedTasks);
+}